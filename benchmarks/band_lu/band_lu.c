@@ -0,0 +1,184 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Benchmark for the banded LU factorization and solve used by the band linear
+ * solver. A random band matrix with equal upper and lower bandwidths is
+ * factored and solved with SUNLinSol_Band and, when available,
+ * SUNLinSol_LapackBand (dgbtrf and dgbtrs) over a range of sizes and
+ * bandwidths. The minimum time over the repetitions is reported along with
+ * the max norm of the residual of the solution.
+ * ---------------------------------------------------------------------------*/
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sundials/sundials_core.h>
+#include <sunlinsol/sunlinsol_band.h>
+#include <sunmatrix/sunmatrix_band.h>
+#include <time.h>
+
+#if defined(USE_LAPACK)
+#include <sunlinsol/sunlinsol_lapackband.h>
+#endif
+
+static double get_time(void);
+static int run(const char* name, SUNLinearSolver LS, SUNMatrix A0, SUNMatrix A,
+               N_Vector x, N_Vector b, N_Vector r, int reps);
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx  = NULL;
+  SUNMatrix A0       = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  N_Vector x = NULL, b = NULL, r = NULL;
+
+  sunindextype sizes[]  = {1000, 10000, 100000, 1000000};
+  sunindextype widths[] = {1, 2, 4, 8};
+  int nsizes = 4, nwidths = 4, reps = 10;
+  int i, is, iw;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--n") && i + 1 < argc)
+    {
+      sizes[0] = atol(argv[++i]);
+      nsizes   = 1;
+    }
+    else if (!strcmp(argv[i], "--bw") && i + 1 < argc)
+    {
+      widths[0] = atol(argv[++i]);
+      nwidths   = 1;
+    }
+    else if (!strcmp(argv[i], "--reps") && i + 1 < argc)
+    {
+      reps = atoi(argv[++i]);
+    }
+    else
+    {
+      printf("Usage: %s [--n <size>] [--bw <bandwidth>] [--reps <int>]\n",
+             argv[0]);
+      return (strcmp(argv[i], "--help") == 0) ? 0 : 1;
+    }
+  }
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  printf("%-12s %10s %4s %14s %14s %12s\n", "solver", "N", "bw", "setup (s)",
+         "solve (s)", "residual");
+
+  for (is = 0; is < nsizes; is++)
+  {
+    for (iw = 0; iw < nwidths; iw++)
+    {
+      sunindextype n  = sizes[is];
+      sunindextype bw = widths[iw];
+      sunindextype j, k;
+
+      x  = N_VNew_Serial(n, sunctx);
+      b  = N_VClone(x);
+      r  = N_VClone(x);
+      A0 = SUNBandMatrix(n, bw, bw, sunctx);
+      A  = SUNBandMatrix(n, bw, bw, sunctx);
+      if (!x || !b || !r || !A0 || !A) { return 1; }
+
+      /* random entries in [-1, 1] with a weakly weighted diagonal so that
+         rows are exchanged during the factorization */
+      srand(42);
+      for (j = 0; j < n; j++)
+      {
+        for (k = SUNMAX(0, j - bw); k <= SUNMIN(n - 1, j + bw); k++)
+        {
+          SM_ELEMENT_B(A0, k, j) = SUN_RCONST(2.0) * rand() / RAND_MAX -
+                                   SUN_RCONST(1.0);
+        }
+        SM_ELEMENT_B(A0, j, j) += SUN_RCONST(0.5);
+      }
+      N_VConst(SUN_RCONST(1.0), b);
+
+      printf("%-12s %10ld %4ld", "band", (long int)n, (long int)bw);
+      LS = SUNLinSol_Band(x, A, sunctx);
+      if (run("band", LS, A0, A, x, b, r, reps)) { return 1; }
+      SUNLinSolFree(LS);
+
+#if defined(USE_LAPACK)
+      printf("%-12s %10ld %4ld", "lapackband", (long int)n, (long int)bw);
+      LS = SUNLinSol_LapackBand(x, A, sunctx);
+      if (run("lapackband", LS, A0, A, x, b, r, reps)) { return 1; }
+      SUNLinSolFree(LS);
+#endif
+
+      SUNMatDestroy(A0);
+      SUNMatDestroy(A);
+      N_VDestroy(x);
+      N_VDestroy(b);
+      N_VDestroy(r);
+    }
+  }
+
+  SUNContext_Free(&sunctx);
+
+  return 0;
+}
+
+/* Times the setup and solve and prints the minimum times and the residual */
+static int run(const char* name, SUNLinearSolver LS, SUNMatrix A0, SUNMatrix A,
+               N_Vector x, N_Vector b, N_Vector r, int reps)
+{
+  double start, setup_time = 0.0, solve_time = 0.0, elapsed;
+  int i;
+
+  if (!LS || SUNLinSolInitialize(LS)) { return 1; }
+
+  for (i = 0; i < reps; i++)
+  {
+    if (SUNMatCopy(A0, A)) { return 1; }
+
+    start = get_time();
+    if (SUNLinSolSetup(LS, A))
+    {
+      fprintf(stderr, "%s: setup failed\n", name);
+      return 1;
+    }
+    elapsed = get_time() - start;
+    if (i == 0 || elapsed < setup_time) { setup_time = elapsed; }
+
+    start = get_time();
+    if (SUNLinSolSolve(LS, A, x, b, SUN_RCONST(0.0)))
+    {
+      fprintf(stderr, "%s: solve failed\n", name);
+      return 1;
+    }
+    elapsed = get_time() - start;
+    if (i == 0 || elapsed < solve_time) { solve_time = elapsed; }
+  }
+
+  /* r = A0 x - b */
+  if (SUNMatMatvec(A0, x, r)) { return 1; }
+  N_VLinearSum(SUN_RCONST(1.0), r, SUN_RCONST(-1.0), b, r);
+
+  printf(" %14.6e %14.6e %12.4e\n", setup_time, solve_time,
+         (double)N_VMaxNorm(r));
+
+  return 0;
+}
+
+static double get_time(void)
+{
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  struct timespec spec;
+  clock_gettime(CLOCK_MONOTONIC, &spec);
+  return (double)spec.tv_sec + 1.0e-9 * (double)spec.tv_nsec;
+#else
+  return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
@@ -0,0 +1,876 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Single node (CPU only) benchmark driver that runs one of the problems in
+ * problems.hpp with CVODE, ARKODE (ERK, DIRK, IMEX, LSRK, or MRI), IDA, or
+ * KINSOL using the serial, OpenMP, or Pthreads NVector and a dense, band, KLU,
+ * or SPGMR linear solver. The wall clock times, integrator statistics, and
+ * memory high-water mark are written as a JSON object to stdout or a file.
+ * ---------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <arkode/arkode_arkstep.h>
+#include <arkode/arkode_erkstep.h>
+#include <arkode/arkode_lsrkstep.h>
+#include <arkode/arkode_mristep.h>
+#include <cvode/cvode.h>
+#include <ida/ida.h>
+#include <kinsol/kinsol.h>
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_core.hpp>
+#include <sunlinsol/sunlinsol_band.h>
+#include <sunlinsol/sunlinsol_dense.h>
+#include <sunlinsol/sunlinsol_spgmr.h>
+#include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_dense.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#if defined(USE_OPENMP)
+#include <nvector/nvector_openmp.h>
+#endif
+
+#if defined(USE_PTHREADS)
+#include <nvector/nvector_pthreads.h>
+#endif
+
+#if defined(USE_KLU)
+#include <sunlinsol/sunlinsol_klu.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#define HAVE_GETRUSAGE
+#endif
+
+#include "problems.hpp"
+
+// -----------------------------------------------------------------------------
+// Benchmark options and data
+// -----------------------------------------------------------------------------
+
+struct Options
+{
+  std::string problem    = "brusselator1d"; // test problem
+  std::string integrator = "cvode";         // integrator/solver
+  std::string nvector    = "serial";        // vector implementation
+  std::string linsol     = "band";          // linear solver
+  sunindextype size      = 100;             // problem size parameter
+  int nthreads           = 1;               // threads for OpenMP/Pthreads
+  bool dqjac             = false;           // use difference quotient Jacobians
+  sunrealtype rtol       = SUN_RCONST(-1.0); // override default tolerances
+  sunrealtype atol       = SUN_RCONST(-1.0);
+  std::string output;                        // JSON output file (or stdout)
+
+  int parse(int argc, char* argv[]);
+  void help();
+};
+
+struct Bench
+{
+  Problem* prob = nullptr;
+  Triplets J;
+  std::vector<sunrealtype> mass;
+};
+
+// Integrator statistics written to the JSON output
+using Stats = std::map<std::string, long int>;
+
+static double wall_time()
+{
+  using clock = std::chrono::steady_clock;
+  return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+}
+
+static long int max_rss_kb()
+{
+#if defined(HAVE_GETRUSAGE)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage)) { return -1; }
+#if defined(__APPLE__)
+  return static_cast<long int>(usage.ru_maxrss / 1024); // bytes on macOS
+#else
+  return static_cast<long int>(usage.ru_maxrss);
+#endif
+#else
+  return -1;
+#endif
+}
+
+static int check_flag(int flag, const char* funcname)
+{
+  if (flag < 0)
+  {
+    std::cerr << "ERROR: " << funcname << " returned " << flag << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+static int check_ptr(const void* ptr, const char* funcname)
+{
+  if (ptr == nullptr)
+  {
+    std::cerr << "ERROR: " << funcname << " returned NULL" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Matrix helpers
+// -----------------------------------------------------------------------------
+
+// Copy scale * J + shift * diag(d) into a dense, band, or CSC sparse matrix
+static int FillMatrix(SUNMatrix A, const Triplets& J, sunrealtype scale,
+                      sunrealtype shift, const sunrealtype* d)
+{
+  SUNMatZero(A);
+
+  switch (SUNMatGetID(A))
+  {
+  case SUNMATRIX_DENSE:
+    for (sunindextype k = 0; k < J.size(); k++)
+    {
+      SM_ELEMENT_D(A, J.rows[k], J.cols[k]) += scale * J.vals[k];
+    }
+    for (sunindextype i = 0; d && i < SM_COLUMNS_D(A); i++)
+    {
+      SM_ELEMENT_D(A, i, i) += shift * d[i];
+    }
+    break;
+  case SUNMATRIX_BAND:
+    for (sunindextype k = 0; k < J.size(); k++)
+    {
+      SM_ELEMENT_B(A, J.rows[k], J.cols[k]) += scale * J.vals[k];
+    }
+    for (sunindextype i = 0; d && i < SM_COLUMNS_B(A); i++)
+    {
+      SM_ELEMENT_B(A, i, i) += shift * d[i];
+    }
+    break;
+  case SUNMATRIX_SPARSE:
+  {
+    if (J.size() > SM_NNZ_S(A)) { return -1; }
+    sunindextype* colptrs = SM_INDEXPTRS_S(A);
+    sunindextype* rowvals = SM_INDEXVALS_S(A);
+    sunrealtype* data     = SM_DATA_S(A);
+    for (sunindextype k = 0; k < J.size(); k++)
+    {
+      rowvals[k] = J.rows[k];
+      data[k]    = scale * J.vals[k];
+      if (d && J.rows[k] == J.cols[k]) { data[k] += shift * d[J.rows[k]]; }
+      colptrs[J.cols[k] + 1] = k + 1;
+    }
+    // fill in pointers for any empty columns
+    for (sunindextype j = 1; j <= SM_COLUMNS_S(A); j++)
+    {
+      if (colptrs[j] < colptrs[j - 1]) { colptrs[j] = colptrs[j - 1]; }
+    }
+    break;
+  }
+  default: return -1;
+  }
+
+  return 0;
+}
+
+// Create the matrix and linear solver, A is NULL for matrix-free solvers
+static int CreateLinearSolver(const Options& opts, Problem& prob, N_Vector y,
+                              SUNMatrix* A, SUNLinearSolver* LS, SUNContext ctx)
+{
+  *A  = nullptr;
+  *LS = nullptr;
+
+  if (opts.linsol == "dense")
+  {
+    *A  = SUNDenseMatrix(prob.N, prob.N, ctx);
+    *LS = SUNLinSol_Dense(y, *A, ctx);
+  }
+  else if (opts.linsol == "band")
+  {
+    *A  = SUNBandMatrix(prob.N, prob.mu, prob.ml, ctx);
+    *LS = SUNLinSol_Band(y, *A, ctx);
+  }
+  else if (opts.linsol == "klu")
+  {
+#if defined(USE_KLU)
+    // evaluate the Jacobian once to determine the number of nonzeros
+    Triplets J;
+    std::vector<sunrealtype> y0(prob.N);
+    prob.InitialCondition(y0.data());
+    prob.Jac(SUN_RCONST(0.0), y0.data(), J, Part::full);
+    *A  = SUNSparseMatrix(prob.N, prob.N, J.size(), CSC_MAT, ctx);
+    *LS = SUNLinSol_KLU(y, *A, ctx);
+#else
+    std::cerr << "ERROR: SUNDIALS was not built with KLU" << std::endl;
+    return 1;
+#endif
+  }
+  else if (opts.linsol == "spgmr")
+  {
+    *LS = SUNLinSol_SPGMR(y, SUN_PREC_NONE, 0, ctx);
+  }
+  else
+  {
+    std::cerr << "ERROR: unknown linear solver " << opts.linsol << std::endl;
+    return 1;
+  }
+
+  if (check_ptr(*LS, "linear solver constructor")) { return 1; }
+  return 0;
+}
+
+// Matrix-based solvers use the analytic Jacobian unless --dqjac is given, KLU
+// always needs the analytic Jacobian
+static bool UseAnalyticJac(const Options& opts, SUNMatrix A)
+{
+  if (A == nullptr) { return false; }
+  return !opts.dqjac || SUNMatGetID(A) == SUNMATRIX_SPARSE;
+}
+
+// -----------------------------------------------------------------------------
+// Problem callbacks
+// -----------------------------------------------------------------------------
+
+static int RhsFull(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  Bench* b = static_cast<Bench*>(user_data);
+  b->prob->Rhs(t, N_VGetArrayPointer(y), N_VGetArrayPointer(ydot), Part::full);
+  return 0;
+}
+
+static int RhsNonstiff(sunrealtype t, N_Vector y, N_Vector ydot,
+                       void* user_data)
+{
+  Bench* b = static_cast<Bench*>(user_data);
+  b->prob->Rhs(t, N_VGetArrayPointer(y), N_VGetArrayPointer(ydot),
+               Part::nonstiff);
+  return 0;
+}
+
+static int RhsStiff(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  Bench* b = static_cast<Bench*>(user_data);
+  b->prob->Rhs(t, N_VGetArrayPointer(y), N_VGetArrayPointer(ydot), Part::stiff);
+  return 0;
+}
+
+static int JacFull(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix J,
+                   void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+  Bench* b = static_cast<Bench*>(user_data);
+  b->J.clear();
+  b->prob->Jac(t, N_VGetArrayPointer(y), b->J, Part::full);
+  return FillMatrix(J, b->J, SUN_RCONST(1.0), SUN_RCONST(0.0), nullptr);
+}
+
+static int JacStiff(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix J,
+                    void* user_data, N_Vector tmp1, N_Vector tmp2,
+                    N_Vector tmp3)
+{
+  Bench* b = static_cast<Bench*>(user_data);
+  b->J.clear();
+  b->prob->Jac(t, N_VGetArrayPointer(y), b->J, Part::stiff);
+  return FillMatrix(J, b->J, SUN_RCONST(1.0), SUN_RCONST(0.0), nullptr);
+}
+
+static int DomEig(sunrealtype t, N_Vector y, N_Vector fn, sunrealtype* lambdaR,
+                  sunrealtype* lambdaI, void* user_data, N_Vector temp1,
+                  N_Vector temp2, N_Vector temp3)
+{
+  Bench* b = static_cast<Bench*>(user_data);
+  *lambdaR = -b->prob->SpectralRadius(t, N_VGetArrayPointer(y));
+  *lambdaI = SUN_RCONST(0.0);
+  return 0;
+}
+
+// IDA residual F(t, y, y') = M y' - g(t, y)
+static int Res(sunrealtype t, N_Vector y, N_Vector yp, N_Vector r,
+               void* user_data)
+{
+  Bench* b            = static_cast<Bench*>(user_data);
+  sunrealtype* rdata  = N_VGetArrayPointer(r);
+  sunrealtype* ypdata = N_VGetArrayPointer(yp);
+  b->prob->Rhs(t, N_VGetArrayPointer(y), rdata, Part::full);
+  for (sunindextype i = 0; i < b->prob->N; i++)
+  {
+    rdata[i] = b->mass[i] * ypdata[i] - rdata[i];
+  }
+  return 0;
+}
+
+// IDA Jacobian dF/dy + cj dF/dy' = cj M - dg/dy
+static int ResJac(sunrealtype t, sunrealtype cj, N_Vector y, N_Vector yp,
+                  N_Vector r, SUNMatrix J, void* user_data, N_Vector tmp1,
+                  N_Vector tmp2, N_Vector tmp3)
+{
+  Bench* b = static_cast<Bench*>(user_data);
+  b->J.clear();
+  b->prob->Jac(t, N_VGetArrayPointer(y), b->J, Part::full);
+  return FillMatrix(J, b->J, SUN_RCONST(-1.0), cj, b->mass.data());
+}
+
+// KINSOL steady state residual g(0, y)
+static int Func(N_Vector y, N_Vector g, void* user_data)
+{
+  return RhsFull(SUN_RCONST(0.0), y, g, user_data);
+}
+
+static int FuncJac(N_Vector y, N_Vector g, SUNMatrix J, void* user_data,
+                   N_Vector tmp1, N_Vector tmp2)
+{
+  return JacFull(SUN_RCONST(0.0), y, g, J, user_data, tmp1, tmp2, nullptr);
+}
+
+// -----------------------------------------------------------------------------
+// Solver drivers, each returns the setup and solve times and statistics
+// -----------------------------------------------------------------------------
+
+static int RunCVODE(const Options& opts, Bench& bench, N_Vector y,
+                    SUNContext ctx, Stats& stats, double& solve_time)
+{
+  Problem& prob = *bench.prob;
+
+  void* mem = CVodeCreate(CV_BDF, ctx);
+  if (check_ptr(mem, "CVodeCreate")) { return 1; }
+
+  int flag = CVodeInit(mem, RhsFull, SUN_RCONST(0.0), y);
+  if (check_flag(flag, "CVodeInit")) { return 1; }
+
+  flag = CVodeSStolerances(mem, prob.rtol, prob.atol);
+  if (check_flag(flag, "CVodeSStolerances")) { return 1; }
+
+  flag = CVodeSetUserData(mem, &bench);
+  if (check_flag(flag, "CVodeSetUserData")) { return 1; }
+
+  flag = CVodeSetMaxNumSteps(mem, 1000000);
+  if (check_flag(flag, "CVodeSetMaxNumSteps")) { return 1; }
+
+  SUNMatrix A;
+  SUNLinearSolver LS;
+  if (CreateLinearSolver(opts, prob, y, &A, &LS, ctx)) { return 1; }
+
+  flag = CVodeSetLinearSolver(mem, LS, A);
+  if (check_flag(flag, "CVodeSetLinearSolver")) { return 1; }
+
+  if (UseAnalyticJac(opts, A))
+  {
+    flag = CVodeSetJacFn(mem, JacFull);
+    if (check_flag(flag, "CVodeSetJacFn")) { return 1; }
+  }
+
+  sunrealtype t = SUN_RCONST(0.0);
+  double start  = wall_time();
+  flag          = CVode(mem, prob.tf, y, &t, CV_NORMAL);
+  solve_time    = wall_time() - start;
+  if (check_flag(flag, "CVode")) { return 1; }
+
+  long int val;
+  CVodeGetNumSteps(mem, &val);
+  stats["steps"] = val;
+  CVodeGetNumErrTestFails(mem, &val);
+  stats["error_test_fails"] = val;
+  CVodeGetNumRhsEvals(mem, &val);
+  stats["rhs_evals"] = val;
+  CVodeGetNumLinRhsEvals(mem, &val);
+  stats["rhs_evals_linsol"] = val;
+  CVodeGetNumNonlinSolvIters(mem, &val);
+  stats["nonlinear_iters"] = val;
+  CVodeGetNumLinSolvSetups(mem, &val);
+  stats["linear_setups"] = val;
+  CVodeGetNumJacEvals(mem, &val);
+  stats["jac_evals"] = val;
+  CVodeGetNumLinIters(mem, &val);
+  stats["linear_iters"] = val;
+
+  CVodeFree(&mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+static int RunARKODE(const Options& opts, Bench& bench, N_Vector y,
+                     SUNContext ctx, Stats& stats, double& solve_time)
+{
+  Problem& prob       = *bench.prob;
+  const sunrealtype t0 = SUN_RCONST(0.0);
+  const std::string& method = opts.integrator;
+
+  void* mem                      = nullptr;
+  void* inner_mem                = nullptr;
+  MRIStepInnerStepper inner_step = nullptr;
+  bool implicit                  = false;
+  ARKLsJacFn jac                 = JacFull;
+
+  if (method == "arkode-erk") { mem = ERKStepCreate(RhsFull, t0, y, ctx); }
+  else if (method == "arkode-dirk")
+  {
+    mem      = ARKStepCreate(nullptr, RhsFull, t0, y, ctx);
+    implicit = true;
+  }
+  else if (method == "arkode-imex")
+  {
+    mem      = ARKStepCreate(RhsNonstiff, RhsStiff, t0, y, ctx);
+    implicit = true;
+    jac      = JacStiff;
+  }
+  else if (method == "arkode-lsrk")
+  {
+    mem = LSRKStepCreateSTS(RhsFull, t0, y, ctx);
+    if (check_ptr(mem, "LSRKStepCreateSTS")) { return 1; }
+    int flag = LSRKStepSetDomEigFn(mem, DomEig);
+    if (check_flag(flag, "LSRKStepSetDomEigFn")) { return 1; }
+  }
+  else if (method == "arkode-mri")
+  {
+    // explicit fast reactions, implicit slow diffusion
+    inner_mem = ERKStepCreate(RhsNonstiff, t0, y, ctx);
+    if (check_ptr(inner_mem, "ERKStepCreate")) { return 1; }
+    int flag = ARKodeSStolerances(inner_mem, prob.rtol, prob.atol);
+    if (check_flag(flag, "ARKodeSStolerances")) { return 1; }
+    flag = ARKodeSetUserData(inner_mem, &bench);
+    if (check_flag(flag, "ARKodeSetUserData")) { return 1; }
+    flag = ARKodeCreateMRIStepInnerStepper(inner_mem, &inner_step);
+    if (check_flag(flag, "ARKodeCreateMRIStepInnerStepper")) { return 1; }
+    mem      = MRIStepCreate(nullptr, RhsStiff, t0, y, inner_step, ctx);
+    implicit = true;
+    jac      = JacStiff;
+  }
+  else
+  {
+    std::cerr << "ERROR: unknown integrator " << method << std::endl;
+    return 1;
+  }
+  if (check_ptr(mem, "ARKODE stepper constructor")) { return 1; }
+
+  int flag = ARKodeSStolerances(mem, prob.rtol, prob.atol);
+  if (check_flag(flag, "ARKodeSStolerances")) { return 1; }
+
+  flag = ARKodeSetUserData(mem, &bench);
+  if (check_flag(flag, "ARKodeSetUserData")) { return 1; }
+
+  flag = ARKodeSetMaxNumSteps(mem, 1000000);
+  if (check_flag(flag, "ARKodeSetMaxNumSteps")) { return 1; }
+
+  SUNMatrix A        = nullptr;
+  SUNLinearSolver LS = nullptr;
+  if (implicit)
+  {
+    if (CreateLinearSolver(opts, prob, y, &A, &LS, ctx)) { return 1; }
+
+    flag = ARKodeSetLinearSolver(mem, LS, A);
+    if (check_flag(flag, "ARKodeSetLinearSolver")) { return 1; }
+
+    if (UseAnalyticJac(opts, A))
+    {
+      flag = ARKodeSetJacFn(mem, jac);
+      if (check_flag(flag, "ARKodeSetJacFn")) { return 1; }
+    }
+  }
+
+  sunrealtype t = t0;
+  double start  = wall_time();
+  flag          = ARKodeEvolve(mem, prob.tf, y, &t, ARK_NORMAL);
+  solve_time    = wall_time() - start;
+  if (check_flag(flag, "ARKodeEvolve")) { return 1; }
+
+  long int val;
+  ARKodeGetNumSteps(mem, &val);
+  stats["steps"] = val;
+  ARKodeGetNumErrTestFails(mem, &val);
+  stats["error_test_fails"] = val;
+  // total evaluations of all (slow) partitions
+  ARKodeGetNumRhsEvals(mem, 0, &val);
+  stats["rhs_evals"] = val;
+  if (implicit)
+  {
+    ARKodeGetNumRhsEvals(mem, 1, &val);
+    stats["rhs_evals"] += val;
+    stats["rhs_evals_implicit"] = val;
+  }
+  if (inner_mem)
+  {
+    ARKodeGetNumSteps(inner_mem, &val);
+    stats["fast_steps"] = val;
+    ARKodeGetNumRhsEvals(inner_mem, 0, &val);
+    stats["fast_rhs_evals"] = val;
+  }
+  if (implicit)
+  {
+    ARKodeGetNumNonlinSolvIters(mem, &val);
+    stats["nonlinear_iters"] = val;
+    ARKodeGetNumLinSolvSetups(mem, &val);
+    stats["linear_setups"] = val;
+    ARKodeGetNumJacEvals(mem, &val);
+    stats["jac_evals"] = val;
+    ARKodeGetNumLinIters(mem, &val);
+    stats["linear_iters"] = val;
+    ARKodeGetNumLinRhsEvals(mem, &val);
+    stats["rhs_evals_linsol"] = val;
+  }
+
+  ARKodeFree(&mem);
+  if (inner_mem)
+  {
+    MRIStepInnerStepper_Free(&inner_step);
+    ARKodeFree(&inner_mem);
+  }
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+static int RunIDA(const Options& opts, Bench& bench, N_Vector y, SUNContext ctx,
+                  Stats& stats, double& solve_time)
+{
+  Problem& prob = *bench.prob;
+
+  // consistent initial derivative y' = g(0, y0) for the differential components
+  N_Vector yp = N_VClone(y);
+  if (check_ptr(yp, "N_VClone")) { return 1; }
+  RhsFull(SUN_RCONST(0.0), y, yp, &bench);
+  sunrealtype* ypdata = N_VGetArrayPointer(yp);
+  for (sunindextype i = 0; i < prob.N; i++) { ypdata[i] *= bench.mass[i]; }
+
+  void* mem = IDACreate(ctx);
+  if (check_ptr(mem, "IDACreate")) { return 1; }
+
+  int flag = IDAInit(mem, Res, SUN_RCONST(0.0), y, yp);
+  if (check_flag(flag, "IDAInit")) { return 1; }
+
+  flag = IDASStolerances(mem, prob.rtol, prob.atol);
+  if (check_flag(flag, "IDASStolerances")) { return 1; }
+
+  flag = IDASetUserData(mem, &bench);
+  if (check_flag(flag, "IDASetUserData")) { return 1; }
+
+  flag = IDASetMaxNumSteps(mem, 1000000);
+  if (check_flag(flag, "IDASetMaxNumSteps")) { return 1; }
+
+  SUNMatrix A;
+  SUNLinearSolver LS;
+  if (CreateLinearSolver(opts, prob, y, &A, &LS, ctx)) { return 1; }
+
+  flag = IDASetLinearSolver(mem, LS, A);
+  if (check_flag(flag, "IDASetLinearSolver")) { return 1; }
+
+  if (UseAnalyticJac(opts, A))
+  {
+    flag = IDASetJacFn(mem, ResJac);
+    if (check_flag(flag, "IDASetJacFn")) { return 1; }
+  }
+
+  sunrealtype t = SUN_RCONST(0.0);
+  double start  = wall_time();
+  flag          = IDASolve(mem, prob.tf, &t, y, yp, IDA_NORMAL);
+  solve_time    = wall_time() - start;
+  if (check_flag(flag, "IDASolve")) { return 1; }
+
+  long int val;
+  IDAGetNumSteps(mem, &val);
+  stats["steps"] = val;
+  IDAGetNumErrTestFails(mem, &val);
+  stats["error_test_fails"] = val;
+  IDAGetNumResEvals(mem, &val);
+  stats["rhs_evals"] = val;
+  IDAGetNumLinResEvals(mem, &val);
+  stats["rhs_evals_linsol"] = val;
+  IDAGetNumNonlinSolvIters(mem, &val);
+  stats["nonlinear_iters"] = val;
+  IDAGetNumLinSolvSetups(mem, &val);
+  stats["linear_setups"] = val;
+  IDAGetNumJacEvals(mem, &val);
+  stats["jac_evals"] = val;
+  IDAGetNumLinIters(mem, &val);
+  stats["linear_iters"] = val;
+
+  IDAFree(&mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(yp);
+
+  return 0;
+}
+
+static int RunKINSOL(const Options& opts, Bench& bench, N_Vector y,
+                     SUNContext ctx, Stats& stats, double& solve_time)
+{
+  Problem& prob = *bench.prob;
+
+  N_Vector scale = N_VClone(y);
+  if (check_ptr(scale, "N_VClone")) { return 1; }
+  N_VConst(SUN_RCONST(1.0), scale);
+
+  void* mem = KINCreate(ctx);
+  if (check_ptr(mem, "KINCreate")) { return 1; }
+
+  int flag = KINInit(mem, Func, y);
+  if (check_flag(flag, "KINInit")) { return 1; }
+
+  flag = KINSetUserData(mem, &bench);
+  if (check_flag(flag, "KINSetUserData")) { return 1; }
+
+  flag = KINSetFuncNormTol(mem, prob.atol);
+  if (check_flag(flag, "KINSetFuncNormTol")) { return 1; }
+
+  flag = KINSetMaxSetupCalls(mem, 1);
+  if (check_flag(flag, "KINSetMaxSetupCalls")) { return 1; }
+
+  SUNMatrix A;
+  SUNLinearSolver LS;
+  if (CreateLinearSolver(opts, prob, y, &A, &LS, ctx)) { return 1; }
+
+  flag = KINSetLinearSolver(mem, LS, A);
+  if (check_flag(flag, "KINSetLinearSolver")) { return 1; }
+
+  if (UseAnalyticJac(opts, A))
+  {
+    flag = KINSetJacFn(mem, FuncJac);
+    if (check_flag(flag, "KINSetJacFn")) { return 1; }
+  }
+
+  double start = wall_time();
+  flag         = KINSol(mem, y, KIN_LINESEARCH, scale, scale);
+  solve_time   = wall_time() - start;
+  if (check_flag(flag, "KINSol")) { return 1; }
+
+  long int val;
+  KINGetNumNonlinSolvIters(mem, &val);
+  stats["nonlinear_iters"] = val;
+  KINGetNumFuncEvals(mem, &val);
+  stats["rhs_evals"] = val;
+  KINGetNumJacEvals(mem, &val);
+  stats["jac_evals"] = val;
+  KINGetNumLinIters(mem, &val);
+  stats["linear_iters"] = val;
+  KINGetNumLinFuncEvals(mem, &val);
+  stats["rhs_evals_linsol"] = val;
+
+  KINFree(&mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(scale);
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Main program
+// -----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+  Options opts;
+  if (opts.parse(argc, argv)) { return 1; }
+
+  std::unique_ptr<Problem> prob = CreateProblem(opts.problem, opts.size);
+  if (!prob)
+  {
+    std::cerr << "ERROR: unknown problem " << opts.problem << std::endl;
+    return 1;
+  }
+  if (opts.rtol > SUN_RCONST(0.0)) { prob->rtol = opts.rtol; }
+  if (opts.atol > SUN_RCONST(0.0)) { prob->atol = opts.atol; }
+
+  // check that the problem and integrator are compatible
+  const std::string& integ = opts.integrator;
+  const bool explicit_method = (integ == "arkode-erk" ||
+                                integ == "arkode-lsrk");
+  const bool split_method = (integ == "arkode-imex" || integ == "arkode-mri");
+  if ((prob->dae && integ != "ida") || (prob->stiff && explicit_method) ||
+      (!prob->split && (split_method || integ == "arkode-lsrk")) ||
+      (!prob->steady && integ == "kinsol"))
+  {
+    std::cerr << "ERROR: problem " << prob->name
+              << " is not supported by integrator " << integ << std::endl;
+    return 1;
+  }
+
+  sundials::Context ctx;
+
+  Bench bench;
+  bench.prob = prob.get();
+  bench.mass.resize(prob->N);
+  prob->Mass(bench.mass.data());
+
+  double start = wall_time();
+
+  N_Vector y = nullptr;
+  if (opts.nvector == "serial") { y = N_VNew_Serial(prob->N, ctx); }
+#if defined(USE_OPENMP)
+  else if (opts.nvector == "openmp")
+  {
+    y = N_VNew_OpenMP(prob->N, opts.nthreads, ctx);
+  }
+#endif
+#if defined(USE_PTHREADS)
+  else if (opts.nvector == "pthreads")
+  {
+    y = N_VNew_Pthreads(prob->N, opts.nthreads, ctx);
+  }
+#endif
+  else
+  {
+    std::cerr << "ERROR: unsupported NVector " << opts.nvector << std::endl;
+    return 1;
+  }
+  if (check_ptr(y, "NVector constructor")) { return 1; }
+  prob->InitialCondition(N_VGetArrayPointer(y));
+
+  Stats stats;
+  double solve_time = 0.0;
+  int flag          = 0;
+
+  if (integ == "cvode")
+  {
+    flag = RunCVODE(opts, bench, y, ctx, stats, solve_time);
+  }
+  else if (integ.compare(0, 6, "arkode") == 0)
+  {
+    flag = RunARKODE(opts, bench, y, ctx, stats, solve_time);
+  }
+  else if (integ == "ida")
+  {
+    flag = RunIDA(opts, bench, y, ctx, stats, solve_time);
+  }
+  else if (integ == "kinsol")
+  {
+    flag = RunKINSOL(opts, bench, y, ctx, stats, solve_time);
+  }
+  else
+  {
+    std::cerr << "ERROR: unknown integrator " << integ << std::endl;
+    flag = 1;
+  }
+
+  const double total_time = wall_time() - start;
+
+  N_VDestroy(y);
+
+  if (flag) { return 1; }
+
+  // write the results
+  FILE* fp = stdout;
+  if (!opts.output.empty())
+  {
+    fp = std::fopen(opts.output.c_str(), "w");
+    if (fp == nullptr)
+    {
+      std::cerr << "ERROR: could not open " << opts.output << std::endl;
+      return 1;
+    }
+  }
+
+  std::fprintf(fp, "{\n");
+  std::fprintf(fp, "  \"problem\": \"%s\",\n", prob->name.c_str());
+  std::fprintf(fp, "  \"integrator\": \"%s\",\n", integ.c_str());
+  std::fprintf(fp, "  \"nvector\": \"%s\",\n", opts.nvector.c_str());
+  std::fprintf(fp, "  \"linear_solver\": \"%s\",\n",
+               explicit_method ? "none" : opts.linsol.c_str());
+  std::fprintf(fp, "  \"jacobian\": \"%s\",\n",
+               opts.dqjac ? "difference-quotient" : "analytic");
+  std::fprintf(fp, "  \"num_threads\": %d,\n", opts.nthreads);
+  std::fprintf(fp, "  \"num_equations\": %ld,\n",
+               static_cast<long int>(prob->N));
+  std::fprintf(fp, "  \"rtol\": %g,\n", static_cast<double>(prob->rtol));
+  std::fprintf(fp, "  \"atol\": %g,\n", static_cast<double>(prob->atol));
+  std::fprintf(fp, "  \"solve_time\": %.6e,\n", solve_time);
+  std::fprintf(fp, "  \"total_time\": %.6e,\n", total_time);
+  std::fprintf(fp, "  \"max_rss_kb\": %ld,\n", max_rss_kb());
+  std::fprintf(fp, "  \"stats\": {");
+  const char* sep = "\n";
+  for (const auto& s : stats)
+  {
+    std::fprintf(fp, "%s    \"%s\": %ld", sep, s.first.c_str(), s.second);
+    sep = ",\n";
+  }
+  std::fprintf(fp, "\n  }\n}\n");
+
+  if (fp != stdout) { std::fclose(fp); }
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Command line options
+// -----------------------------------------------------------------------------
+
+int Options::parse(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; i++)
+  {
+    const std::string arg = argv[i];
+    if (arg == "--help")
+    {
+      help();
+      return 1;
+    }
+    if (arg == "--dqjac")
+    {
+      dqjac = true;
+      continue;
+    }
+    if (i + 1 >= argc)
+    {
+      std::cerr << "ERROR: missing value for " << arg << std::endl;
+      return 1;
+    }
+    const std::string val = argv[++i];
+    if (arg == "--problem") { problem = val; }
+    else if (arg == "--integrator") { integrator = val; }
+    else if (arg == "--nvector") { nvector = val; }
+    else if (arg == "--linsol") { linsol = val; }
+    else if (arg == "--size") { size = std::atol(val.c_str()); }
+    else if (arg == "--nthreads") { nthreads = std::atoi(val.c_str()); }
+    else if (arg == "--rtol") { rtol = std::atof(val.c_str()); }
+    else if (arg == "--atol") { atol = std::atof(val.c_str()); }
+    else if (arg == "--output") { output = val; }
+    else
+    {
+      std::cerr << "ERROR: unknown option " << arg << std::endl;
+      help();
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void Options::help()
+{
+  std::cout
+    << "Integrator benchmark suite options:\n"
+    << "  --problem <str>    robertson, kinetics, robertson_dae,\n"
+    << "                     brusselator1d, or brusselator2d\n"
+    << "                     (default brusselator1d)\n"
+    << "  --integrator <str> cvode, arkode-erk, arkode-dirk, arkode-imex,\n"
+    << "                     arkode-lsrk, arkode-mri, ida, or kinsol\n"
+    << "                     (default cvode)\n"
+    << "  --nvector <str>    serial, openmp, or pthreads (default serial)\n"
+    << "  --linsol <str>     dense, band, klu, or spgmr (default band)\n"
+    << "  --size <int>       mesh points per direction for the Brusselator\n"
+    << "                     problems or batch size for kinetics\n"
+    << "                     (default 100)\n"
+    << "  --nthreads <int>   number of OpenMP/Pthreads threads (default 1)\n"
+    << "  --dqjac            use difference quotient dense/band Jacobians\n"
+    << "  --rtol <real>      relative tolerance (default problem specific)\n"
+    << "  --atol <real>      absolute tolerance (default problem specific)\n"
+    << "  --output <file>    JSON output file (default stdout)\n";
+}
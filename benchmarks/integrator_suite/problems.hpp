@@ -0,0 +1,397 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Test problems for the single node integrator benchmark suite. Each problem is
+ * written in the form
+ *
+ *   M y' = g(t, y) = g_n(t, y) + g_s(t, y)
+ *
+ * where M is a diagonal matrix with ones for differential components and zeros
+ * for algebraic components, g_n is a nonstiff (or slow) term, and g_s is a
+ * stiff (or fast) term. Problems without a natural splitting only define the
+ * full right-hand side.
+ *
+ * All problem functions act on raw arrays so they can be used with any NVector
+ * that provides access to a contiguous host data array.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef INTEGRATOR_SUITE_PROBLEMS_HPP_
+#define INTEGRATOR_SUITE_PROBLEMS_HPP_
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sundials/sundials_types.h>
+
+// Right-hand side partitions
+enum class Part
+{
+  full,
+  nonstiff,
+  stiff
+};
+
+// Jacobian entries stored in column-major order with increasing row indices
+// within each column (i.e., ready to be copied into a CSC matrix)
+struct Triplets
+{
+  std::vector<sunindextype> rows;
+  std::vector<sunindextype> cols;
+  std::vector<sunrealtype> vals;
+
+  void clear()
+  {
+    rows.clear();
+    cols.clear();
+    vals.clear();
+  }
+
+  void add(sunindextype i, sunindextype j, sunrealtype v)
+  {
+    rows.push_back(i);
+    cols.push_back(j);
+    vals.push_back(v);
+  }
+
+  sunindextype size() const { return static_cast<sunindextype>(vals.size()); }
+};
+
+class Problem
+{
+public:
+  virtual ~Problem() = default;
+
+  std::string name;
+
+  sunindextype N  = 0; // number of equations
+  sunindextype mu = 0; // Jacobian upper bandwidth
+  sunindextype ml = 0; // Jacobian lower bandwidth
+
+  bool stiff  = true;  // the full problem is stiff
+  bool split  = false; // g_n and g_s are defined
+  bool dae    = false; // the problem has algebraic components
+  bool steady = false; // the problem has a steady state for KINSOL
+
+  sunrealtype tf   = SUN_RCONST(1.0);
+  sunrealtype rtol = SUN_RCONST(1.0e-6);
+  sunrealtype atol = SUN_RCONST(1.0e-10);
+
+  // Initial condition (or initial guess for the steady state)
+  virtual void InitialCondition(sunrealtype* y) = 0;
+
+  // Right-hand side g(t,y) or one of its partitions
+  virtual void Rhs(sunrealtype t, const sunrealtype* y, sunrealtype* g,
+                   Part part) = 0;
+
+  // Jacobian of g(t,y) or one of its partitions, every diagonal entry must be
+  // included in the pattern (possibly with a zero value)
+  virtual void Jac(sunrealtype t, const sunrealtype* y, Triplets& J,
+                   Part part) = 0;
+
+  // Diagonal of the mass matrix
+  virtual void Mass(sunrealtype* m)
+  {
+    for (sunindextype i = 0; i < N; i++) { m[i] = SUN_RCONST(1.0); }
+  }
+
+  // Estimate of the spectral radius of the Jacobian of g_s (for LSRKStep)
+  virtual sunrealtype SpectralRadius(sunrealtype t, const sunrealtype* y)
+  {
+    return SUN_RCONST(0.0);
+  }
+};
+
+// -----------------------------------------------------------------------------
+// Robertson chemical kinetics, a batch of nbatch independent (slightly
+// perturbed) copies gives a large, block diagonal sparse problem. With dae =
+// true the third equation is replaced by the mass conservation constraint.
+// -----------------------------------------------------------------------------
+
+class Robertson : public Problem
+{
+public:
+  Robertson(sunindextype nbatch_in, bool dae_in) : nbatch(nbatch_in)
+  {
+    name = dae_in ? "robertson_dae"
+                  : ((nbatch > 1) ? "kinetics" : "robertson");
+    N    = 3 * nbatch;
+    mu   = 2;
+    ml   = 2;
+    dae  = dae_in;
+    tf   = SUN_RCONST(4.0e5);
+    rtol = SUN_RCONST(1.0e-4);
+    atol = SUN_RCONST(1.0e-8);
+  }
+
+  void InitialCondition(sunrealtype* y) override
+  {
+    for (sunindextype b = 0; b < nbatch; b++)
+    {
+      y[3 * b]     = SUN_RCONST(1.0);
+      y[3 * b + 1] = SUN_RCONST(0.0);
+      y[3 * b + 2] = SUN_RCONST(0.0);
+    }
+  }
+
+  void Rhs(sunrealtype t, const sunrealtype* y, sunrealtype* g, Part) override
+  {
+    for (sunindextype b = 0; b < nbatch; b++)
+    {
+      const sunrealtype* yb = y + 3 * b;
+      sunrealtype* gb       = g + 3 * b;
+      const sunrealtype k1  = rate(b);
+
+      const sunrealtype r1 = k1 * yb[0];
+      const sunrealtype r2 = k2 * yb[1] * yb[2];
+      const sunrealtype r3 = k3 * yb[1] * yb[1];
+
+      gb[0] = -r1 + r2;
+      gb[1] = r1 - r2 - r3;
+      if (dae) { gb[2] = SUN_RCONST(1.0) - yb[0] - yb[1] - yb[2]; }
+      else { gb[2] = r3; }
+    }
+  }
+
+  void Jac(sunrealtype t, const sunrealtype* y, Triplets& J, Part) override
+  {
+    for (sunindextype b = 0; b < nbatch; b++)
+    {
+      const sunrealtype* yb  = y + 3 * b;
+      const sunindextype o   = 3 * b;
+      const sunrealtype k1   = rate(b);
+      const sunrealtype mone = SUN_RCONST(-1.0);
+
+      J.add(o, o, -k1);
+      J.add(o + 1, o, k1);
+      J.add(o + 2, o, dae ? mone : SUN_RCONST(0.0));
+
+      J.add(o, o + 1, k2 * yb[2]);
+      J.add(o + 1, o + 1, -k2 * yb[2] - SUN_RCONST(2.0) * k3 * yb[1]);
+      J.add(o + 2, o + 1, dae ? mone : SUN_RCONST(2.0) * k3 * yb[1]);
+
+      J.add(o, o + 2, k2 * yb[1]);
+      J.add(o + 1, o + 2, -k2 * yb[1]);
+      J.add(o + 2, o + 2, dae ? mone : SUN_RCONST(0.0));
+    }
+  }
+
+  void Mass(sunrealtype* m) override
+  {
+    for (sunindextype b = 0; b < nbatch; b++)
+    {
+      m[3 * b]     = SUN_RCONST(1.0);
+      m[3 * b + 1] = SUN_RCONST(1.0);
+      m[3 * b + 2] = dae ? SUN_RCONST(0.0) : SUN_RCONST(1.0);
+    }
+  }
+
+private:
+  sunindextype nbatch;
+  const sunrealtype k2 = SUN_RCONST(1.0e4);
+  const sunrealtype k3 = SUN_RCONST(3.0e7);
+
+  // vary the slow rate across the batch so the copies are not identical
+  sunrealtype rate(sunindextype b) const
+  {
+    const sunrealtype k = static_cast<sunrealtype>(b % 7);
+    return SUN_RCONST(0.04) * (SUN_RCONST(1.0) + SUN_RCONST(0.1) * k);
+  }
+};
+
+// -----------------------------------------------------------------------------
+// Brusselator reaction-diffusion problem in 1D or 2D on the unit interval or
+// square with Dirichlet boundary conditions u = A, v = B / A,
+//
+//   u_t = A + u^2 v - (B + 1) u + alpha lap(u)
+//   v_t = B u - u^2 v + alpha lap(v)
+//
+// The unknowns are interleaved at each interior mesh node. The reactions are
+// the nonstiff partition and diffusion is the stiff partition.
+// -----------------------------------------------------------------------------
+
+class Brusselator : public Problem
+{
+public:
+  Brusselator(int dim_in, sunindextype nx_in) : dim(dim_in), nx(nx_in)
+  {
+    name   = (dim == 1) ? "brusselator1d" : "brusselator2d";
+    nnodes = (dim == 1) ? nx : nx * nx;
+    N      = 2 * nnodes;
+    mu     = (dim == 1) ? 2 : 2 * nx;
+    ml     = mu;
+    stiff  = false; // stiffness depends on the mesh size
+    split  = true;
+    steady = true;
+    tf     = (dim == 1) ? SUN_RCONST(10.0) : SUN_RCONST(1.0);
+    rtol   = SUN_RCONST(1.0e-6);
+    atol   = SUN_RCONST(1.0e-10);
+    dx     = SUN_RCONST(1.0) / static_cast<sunrealtype>(nx + 1);
+    cdiff  = alpha / (dx * dx);
+  }
+
+  void InitialCondition(sunrealtype* y) override
+  {
+    const sunrealtype pi = SUN_RCONST(4.0) * std::atan(SUN_RCONST(1.0));
+    for (sunindextype n = 0; n < nnodes; n++)
+    {
+      const sunrealtype x = static_cast<sunrealtype>(n % nx + 1) * dx;
+      const sunrealtype yc = static_cast<sunrealtype>(n / nx + 1) * dx;
+      const sunrealtype z  = (dim == 1) ? SUN_RCONST(1.0) : std::sin(pi * yc);
+      y[2 * n]     = A + std::sin(SUN_RCONST(2.0) * pi * x) * z;
+      y[2 * n + 1] = B / A;
+    }
+  }
+
+  void Rhs(sunrealtype t, const sunrealtype* y, sunrealtype* g,
+           Part part) override
+  {
+    const bool react = (part != Part::stiff);
+    const bool diff  = (part != Part::nonstiff);
+
+    for (sunindextype n = 0; n < nnodes; n++)
+    {
+      const sunrealtype u = y[2 * n];
+      const sunrealtype v = y[2 * n + 1];
+
+      sunrealtype gu = SUN_RCONST(0.0);
+      sunrealtype gv = SUN_RCONST(0.0);
+
+      if (react)
+      {
+        gu = A + u * u * v - (B + SUN_RCONST(1.0)) * u;
+        gv = B * u - u * u * v;
+      }
+
+      if (diff)
+      {
+        const sunindextype i = n % nx;
+        const sunindextype j = n / nx;
+
+        // neighbor values (boundary values outside of the domain)
+        sunrealtype su = -SUN_RCONST(2.0) * dim * u;
+        sunrealtype sv = -SUN_RCONST(2.0) * dim * v;
+
+        su += (i > 0) ? y[2 * (n - 1)] : A;
+        sv += (i > 0) ? y[2 * (n - 1) + 1] : B / A;
+        su += (i < nx - 1) ? y[2 * (n + 1)] : A;
+        sv += (i < nx - 1) ? y[2 * (n + 1) + 1] : B / A;
+
+        if (dim == 2)
+        {
+          su += (j > 0) ? y[2 * (n - nx)] : A;
+          sv += (j > 0) ? y[2 * (n - nx) + 1] : B / A;
+          su += (j < nx - 1) ? y[2 * (n + nx)] : A;
+          sv += (j < nx - 1) ? y[2 * (n + nx) + 1] : B / A;
+        }
+
+        gu += cdiff * su;
+        gv += cdiff * sv;
+      }
+
+      g[2 * n]     = gu;
+      g[2 * n + 1] = gv;
+    }
+  }
+
+  void Jac(sunrealtype t, const sunrealtype* y, Triplets& J, Part part) override
+  {
+    const bool react = (part != Part::stiff);
+    const bool diff  = (part != Part::nonstiff);
+
+    const sunrealtype cdiag = diff ? -SUN_RCONST(2.0) * dim * cdiff
+                                   : SUN_RCONST(0.0);
+
+    for (sunindextype n = 0; n < nnodes; n++)
+    {
+      const sunindextype i = n % nx;
+      const sunindextype j = n / nx;
+
+      const sunrealtype u = y[2 * n];
+      const sunrealtype v = y[2 * n + 1];
+
+      // reaction Jacobian block at node n
+      sunrealtype duu = SUN_RCONST(0.0);
+      sunrealtype dvu = SUN_RCONST(0.0);
+      sunrealtype duv = SUN_RCONST(0.0);
+      sunrealtype dvv = SUN_RCONST(0.0);
+
+      if (react)
+      {
+        duu = SUN_RCONST(2.0) * u * v - (B + SUN_RCONST(1.0));
+        dvu = B - SUN_RCONST(2.0) * u * v;
+        duv = u * u;
+        dvv = -u * u;
+      }
+
+      // columns for species s at node n, rows in increasing order
+      for (int s = 0; s < 2; s++)
+      {
+        const sunindextype col = 2 * n + s;
+
+        if (diff && dim == 2 && j > 0) { J.add(col - 2 * nx, col, cdiff); }
+        if (diff && i > 0) { J.add(col - 2, col, cdiff); }
+
+        J.add(2 * n, col, (s == 0) ? duu + cdiag : duv);
+        J.add(2 * n + 1, col, (s == 0) ? dvu : dvv + cdiag);
+
+        if (diff && i < nx - 1) { J.add(col + 2, col, cdiff); }
+        if (diff && dim == 2 && j < nx - 1) { J.add(col + 2 * nx, col, cdiff); }
+      }
+    }
+  }
+
+  sunrealtype SpectralRadius(sunrealtype t, const sunrealtype* y) override
+  {
+    // Gershgorin bound for the diffusion operator
+    return SUN_RCONST(4.0) * dim * cdiff;
+  }
+
+private:
+  int dim;
+  sunindextype nx;
+  sunindextype nnodes;
+  sunrealtype dx;
+  sunrealtype cdiff;
+  const sunrealtype A     = SUN_RCONST(1.0);
+  const sunrealtype B     = SUN_RCONST(3.0);
+  const sunrealtype alpha = SUN_RCONST(0.02);
+};
+
+// Create a problem by name
+inline std::unique_ptr<Problem> CreateProblem(const std::string& name,
+                                              sunindextype size)
+{
+  if (name == "robertson")
+  {
+    return std::unique_ptr<Problem>(new Robertson(1, false));
+  }
+  if (name == "kinetics")
+  {
+    return std::unique_ptr<Problem>(new Robertson(size, false));
+  }
+  if (name == "robertson_dae")
+  {
+    return std::unique_ptr<Problem>(new Robertson(1, true));
+  }
+  if (name == "brusselator1d")
+  {
+    return std::unique_ptr<Problem>(new Brusselator(1, size));
+  }
+  if (name == "brusselator2d")
+  {
+    return std::unique_ptr<Problem>(new Brusselator(2, size));
+  }
+  return nullptr;
+}
+
+#endif
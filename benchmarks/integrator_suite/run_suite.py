@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+# ------------------------------------------------------------------------------
+# SUNDIALS Copyright Start
+# Copyright (c) 2002-2025, Lawrence Livermore National Security
+# and Southern Methodist University.
+# All rights reserved.
+#
+# See the top-level LICENSE and NOTICE files for details.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# SUNDIALS Copyright End
+# ------------------------------------------------------------------------------
+# Run the integrator benchmark suite over a set of configurations, collect the
+# JSON results into a single file, and optionally compare against a baseline.
+# ------------------------------------------------------------------------------
+
+import argparse
+import itertools
+import json
+import subprocess
+import sys
+
+# Supported integrators for each problem
+PROBLEMS = {
+    "robertson": ["cvode", "arkode-dirk", "ida"],
+    "kinetics": ["cvode", "arkode-dirk", "ida"],
+    "robertson_dae": ["ida"],
+    "brusselator1d": [
+        "cvode",
+        "arkode-erk",
+        "arkode-dirk",
+        "arkode-imex",
+        "arkode-lsrk",
+        "arkode-mri",
+        "ida",
+        "kinsol",
+    ],
+    "brusselator2d": ["cvode", "arkode-dirk", "arkode-imex", "ida", "kinsol"],
+}
+
+EXPLICIT = ["arkode-erk", "arkode-lsrk"]
+
+
+def key(result):
+    """Unique name for a benchmark configuration"""
+    return "/".join(
+        str(result[k])
+        for k in ["problem", "integrator", "nvector", "linear_solver", "num_threads"]
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the integrator benchmark suite")
+    parser.add_argument("executable", help="path to the integrator_suite executable")
+    parser.add_argument("--problems", nargs="+", default=list(PROBLEMS.keys()))
+    parser.add_argument("--nvectors", nargs="+", default=["serial"])
+    parser.add_argument("--linsols", nargs="+", default=["dense", "band", "spgmr"])
+    parser.add_argument("--nthreads", type=int, default=1)
+    parser.add_argument("--size", type=int, default=None)
+    parser.add_argument("--output", default="integrator_suite.json")
+    parser.add_argument("--baseline", help="JSON results file to compare against")
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=0.1,
+        help="allowed relative increase in solve time (default 0.1)",
+    )
+    args = parser.parse_args()
+
+    results = []
+    for problem in args.problems:
+        for integrator, nvector, linsol in itertools.product(
+            PROBLEMS[problem], args.nvectors, args.linsols
+        ):
+            # explicit methods do not use a linear solver, only run them once
+            if integrator in EXPLICIT and linsol != args.linsols[0]:
+                continue
+            cmd = [
+                args.executable,
+                "--problem",
+                problem,
+                "--integrator",
+                integrator,
+                "--nvector",
+                nvector,
+                "--linsol",
+                linsol,
+                "--nthreads",
+                str(args.nthreads),
+            ]
+            if args.size:
+                cmd += ["--size", str(args.size)]
+            proc = subprocess.run(cmd, capture_output=True, text=True)
+            if proc.returncode != 0:
+                print("FAILED: " + " ".join(cmd[1:]), file=sys.stderr)
+                print(proc.stderr, file=sys.stderr)
+                continue
+            result = json.loads(proc.stdout)
+            print(f"{key(result)}: {result['solve_time']:.3e} s")
+            results.append(result)
+
+    with open(args.output, "w") as f:
+        json.dump(results, f, indent=2)
+
+    if not args.baseline:
+        return 0
+
+    # compare solve times and counters against the baseline
+    with open(args.baseline) as f:
+        baseline = {key(r): r for r in json.load(f)}
+
+    regressions = 0
+    for result in results:
+        base = baseline.get(key(result))
+        if base is None:
+            continue
+        limit = (1.0 + args.tolerance) * base["solve_time"]
+        if result["solve_time"] > limit:
+            print(
+                f"REGRESSION {key(result)}: solve time "
+                f"{result['solve_time']:.3e} > {limit:.3e}"
+            )
+            regressions += 1
+        for name, value in result["stats"].items():
+            if name in base["stats"] and value > base["stats"][name]:
+                print(f"CHANGED {key(result)}: {name} {base['stats'][name]} -> {value}")
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# SUNDIALS Copyright Start
+# Copyright (c) 2002-2025, Lawrence Livermore National Security
+# and Southern Methodist University.
+# All rights reserved.
+#
+# See the top-level LICENSE and NOTICE files for details.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# SUNDIALS Copyright End
+# -----------------------------------------------------------------------------
+# This script runs an NVector benchmark executable over a range of vector
+# lengths, from sizes that fit in the L1 cache to sizes that only fit in main
+# memory, and prints a table of the achieved bandwidth for each operation. The
+# output files are named output_nelem_nvec_nsum_ntest_timing.txt so they can
+# also be processed with plot_nvector_performance_results.py.
+# -----------------------------------------------------------------------------
+
+import argparse
+import os
+import shlex
+import subprocess
+import sys
+
+
+def parse_output(fname):
+    """Return a dictionary of (GB/s, % peak) for each operation, fused
+    operations use the fused rates"""
+    rates = {}
+    with open(fname) as f:
+        for line in f:
+            split_line = line.split()
+            if not split_line or not split_line[0].startswith("N_V"):
+                continue
+            if len(split_line) == 8:
+                rates[split_line[0]] = (float(split_line[5]), float(split_line[7]))
+            elif len(split_line) == 15:
+                rates[split_line[0]] = (float(split_line[9]), float(split_line[11]))
+    return rates
+
+
+def main():
+
+    parser = argparse.ArgumentParser(
+        description="Sweep vector lengths with an NVector performance benchmark"
+    )
+
+    parser.add_argument("executable", type=str, help="Benchmark executable")
+    parser.add_argument(
+        "--launcher", type=str, default="", help="Launch command e.g., 'mpirun -n 4'"
+    )
+    parser.add_argument(
+        "--minexp", type=int, default=8, help="Smallest length is 2^minexp"
+    )
+    parser.add_argument(
+        "--maxexp", type=int, default=26, help="Largest length is 2^maxexp"
+    )
+    parser.add_argument("--nvecs", type=int, default=4, help="Number of vectors")
+    parser.add_argument("--nsums", type=int, default=2, help="Number of sums")
+    parser.add_argument("--ntests", type=int, default=20, help="Number of tests")
+    parser.add_argument(
+        "--cachesize", type=int, default=0, help="Cache size (MB) to clear"
+    )
+    parser.add_argument(
+        "--outdir", type=str, default=".", help="Directory for output files"
+    )
+    parser.add_argument(
+        "--gbs",
+        dest="gbs",
+        action="store_true",
+        help="Print GB/s rather than the percentage of the peak bandwidth",
+    )
+
+    args = parser.parse_args()
+
+    if not os.path.isdir(args.outdir):
+        os.makedirs(args.outdir)
+
+    lengths = [2**e for e in range(args.minexp, args.maxexp + 1)]
+    results = []
+
+    for n in lengths:
+        fname = os.path.join(
+            args.outdir,
+            f"output_{n}_{args.nvecs}_{args.nsums}_{args.ntests}_1.txt",
+        )
+        cmd = shlex.split(args.launcher) + [
+            args.executable,
+            str(n),
+            str(args.nvecs),
+            str(args.nsums),
+            str(args.ntests),
+            str(args.cachesize),
+            "1",
+        ]
+        print(" ".join(cmd), file=sys.stderr)
+        with open(fname, "w") as f:
+            subprocess.run(cmd, stdout=f, check=True)
+        results.append(parse_output(fname))
+
+    # print a table with one row per operation and one column per length
+    value = 0 if args.gbs else 1
+    header = "GB/s" if args.gbs else "% Peak"
+    print(f"\n{header} by vector size (KiB in double precision):")
+    print(f"{'Operation':>33s}" + "".join(f" {n * 8 // 1024:>8d}" for n in lengths))
+    for op in results[0]:
+        row = "".join(
+            f" {r[op][value]:8.1f}" if op in r else f" {'-':>8s}" for r in results
+        )
+        print(f"{op:>33s}{row}")
+
+
+if __name__ == "__main__":
+    main()
@@ -39,6 +39,7 @@ int main(int argc, char* argv[])
 {
   SUNContext ctx = NULL; /* SUNDIALS context */
   N_Vector X     = NULL; /* test vector      */
+  N_Vector Xf    = NULL; /* fused ops vector */
   sunindextype veclen;   /* vector length    */
 
   int print_timing; /* output timings     */
@@ -152,6 +153,19 @@ int main(int argc, char* argv[])
       flag = Test_N_VLinearCombinationVectorArray(X, veclen, nvecs, nsums,
                                                   ntests);
     }
+
+    /* compare the cache-blocked fused operations to unblocked loops */
+    Xf = N_VNew_Serial(veclen, ctx);
+    N_VEnableFusedOps_Serial(Xf, SUNTRUE);
+    if (print_timing)
+    {
+      printf("\n\n cache blocking: nvecs= %d (fused = blocked, unfused = "
+             "unblocked)\n",
+             nvecs);
+    }
+    if (print_timing) { PrintTableHeader(2); }
+    flag = Test_N_VFusedBlocking(Xf, veclen, nvecs, ntests);
+    N_VDestroy(Xf);
   }
 
   /* Free vectors */
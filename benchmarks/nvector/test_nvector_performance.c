@@ -39,10 +39,20 @@
 static double get_time(void);
 static void time_stats(N_Vector X, double* times, int start, int ntimes,
                        double* avg, double* sdev, double* min, double* max);
+static void print_time1(const char* test, double words, double flops,
+                        double avg, double sdev, double min, double max);
+static void print_time2(const char* test, double words, double flops,
+                        double avg1, double sdev1, double min1, double max1,
+                        double avg2, double sdev2, double min2, double max2);
+static void print_rates(double words, double flops, double time);
+static double measure_triad_bandwidth(void);
 
 int print_time = 0; /* flag for printing timing data */
 int nwarmups   = 1; /* number of extra tests to perform and ignore in average */
 
+/* STREAM triad bandwidth (GB/s) used for roofline output, 0 if not available */
+double peak_bw = 0.0;
+
 #if defined(SUNDIALS_HAVE_POSIX_TIMERS)
 time_t base_time_tv_sec = 0; /* Base time; makes time values returned
                                 by get_time easier to read when
@@ -51,15 +61,21 @@ time_t base_time_tv_sec = 0; /* Base time; makes time values returned
                               */
 #endif
 
-#define FMT1 "%33s %22.15e %22.15e %22.15e %22.15e\n"
-#define PRINT_TIME1(test, time, sdev, min, max) \
-  if (print_time) printf(FMT1, test, time, sdev, min, max)
-
-#define FMT2 \
-  "%33s %22.15e %22.15e %22.15e %22.15e %22.15e %22.15e %22.15e %22.15e\n"
-#define PRINT_TIME2(test, time1, sdev1, min1, max1, time2, sdev2, min2, max2) \
-  if (print_time)                                                             \
-  printf(FMT2, test, time1, sdev1, min1, max1, time2, sdev2, min2, max2)
+/* Timing output macros, words and flops are the number of sunrealtype values
+   moved to/from memory and floating point operations per vector entry. These
+   are the minimum amounts required by the operation so the unfused rates are
+   the effective bandwidth achieved by the equivalent sequence of operations. */
+#define PRINT_TIME1(test, words, flops, time, sdev, min, max) \
+  if (print_time)                                             \
+  print_time1(test, (double)(words) * (double)local_length,   \
+              (double)(flops) * (double)local_length, time, sdev, min, max)
+
+#define PRINT_TIME2(test, words, flops, time1, sdev1, min1, max1, time2,  \
+                    sdev2, min2, max2)                                    \
+  if (print_time)                                                         \
+  print_time2(test, (double)(words) * (double)local_length,               \
+              (double)(flops) * (double)local_length, time1, sdev1, min1, \
+              max1, time2, sdev2, min2, max2)
 
 /* -----------------------------------------------------------------------------
  * N_VLinearSum Tests
@@ -100,7 +116,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-1a", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-1a", 3, 1, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 1b: y = -x + y, (Vaxpy Case 2)
@@ -123,7 +139,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-1b", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-1b", 3, 1, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 1c: y = ax + y, (Vaxpy Case 3)
@@ -147,7 +163,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-1c", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-1c", 3, 2, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 2a: x = x + y, (Vaxpy Case 1)
@@ -170,7 +186,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-2a", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-2a", 3, 1, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 2b: x = x - y, (Vaxpy Case 2)
@@ -193,7 +209,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-2b", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-2b", 3, 1, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 2c: x = x + by, (Vaxpy Case 3)
@@ -217,7 +233,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-2c", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-2c", 3, 2, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 3: z = x + y, (VSum)
@@ -241,7 +257,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-3", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-3", 3, 1, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 4a: z = x - y, (VDiff)
@@ -265,7 +281,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-4a", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-4a", 3, 1, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 4b: z = -x + y, (VDiff)
@@ -289,7 +305,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-4b", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-4b", 3, 1, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 5a: z = x + by, (VLin1)
@@ -314,7 +330,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-5a", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-5a", 3, 2, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 5b: z = ax + y, (VLin1)
@@ -339,7 +355,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-5b", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-5b", 3, 2, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 6a: z = -x + by, (VLin2)
@@ -364,7 +380,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-6a", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-6a", 3, 2, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 6b: z = ax - y, (VLin2)
@@ -389,7 +405,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-6b", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-6b", 3, 2, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 7: z = a(x + y), (VScaleSum)
@@ -414,7 +430,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-7", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-7", 3, 2, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 8: z = a(x - y), (VScaleDiff)
@@ -440,7 +456,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-8", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-8", 3, 3, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 9: z = ax + by, All Other Cases
@@ -466,7 +482,7 @@ int Test_N_VLinearSum(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VLinearSum-9", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VLinearSum-9", 3, 3, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -504,7 +520,7 @@ int Test_N_VConst(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VConst", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VConst", 1, 0, avgtime, sdevtime, mintime, maxtime);
 
   free(times);
 
@@ -546,7 +562,7 @@ int Test_N_VProd(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VProd", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VProd", 3, 1, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -591,7 +607,7 @@ int Test_N_VDiv(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VDiv", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VDiv", 3, 1, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -639,7 +655,7 @@ int Test_N_VScale(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VScale-1", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VScale-1", 2, 1, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 2: z = x, VCopy
@@ -662,7 +678,7 @@ int Test_N_VScale(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VScale-2", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VScale-2", 2, 0, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 3: z = -x, VNeg
@@ -685,7 +701,7 @@ int Test_N_VScale(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VScale-3", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VScale-3", 2, 1, avgtime, sdevtime, mintime, maxtime);
 
   /*
    * Case 4: z = cx, All other cases
@@ -709,7 +725,7 @@ int Test_N_VScale(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VScale-4", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VScale-4", 2, 1, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -751,7 +767,7 @@ int Test_N_VAbs(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VAbs", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VAbs", 2, 1, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -793,7 +809,7 @@ int Test_N_VInv(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VInv", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VInv", 2, 1, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -837,7 +853,7 @@ int Test_N_VAddConst(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VAddConst", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VAddConst", 2, 1, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -879,7 +895,7 @@ int Test_N_VDotProd(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VDotProd", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VDotProd", 2, 2, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -916,7 +932,7 @@ int Test_N_VMaxNorm(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VMaxNorm", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VMaxNorm", 1, 2, avgtime, sdevtime, mintime, maxtime);
 
   free(times);
 
@@ -956,7 +972,7 @@ int Test_N_VWrmsNorm(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VWrmsNorm", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VWrmsNorm", 2, 3, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -1004,7 +1020,7 @@ int Test_N_VWrmsNormMask(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VWrmsNormMask", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VWrmsNormMask", 3, 3, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -1042,7 +1058,7 @@ int Test_N_VMin(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VMin", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VMin", 1, 1, avgtime, sdevtime, mintime, maxtime);
 
   free(times);
 
@@ -1082,7 +1098,7 @@ int Test_N_VWL2Norm(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VWL2Norm", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VWL2Norm", 2, 3, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -1119,7 +1135,7 @@ int Test_N_VL1Norm(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VL1Norm", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VL1Norm", 1, 2, avgtime, sdevtime, mintime, maxtime);
 
   free(times);
 
@@ -1161,7 +1177,7 @@ int Test_N_VCompare(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VCompare", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VCompare", 2, 2, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -1203,7 +1219,7 @@ int Test_N_VInvTest(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VInvTest", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VInvTest", 2, 2, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -1247,7 +1263,7 @@ int Test_N_VConstrMask(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VConstrMask", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VConstrMask", 3, 3, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -1294,7 +1310,7 @@ int Test_N_VMinQuotient(N_Vector X, sunindextype local_length, int ntests)
 
   /* get average time ignoring the first nwarmups tests */
   time_stats(X, times, nwarmups, ntests, &avgtime, &sdevtime, &mintime, &maxtime);
-  PRINT_TIME1("N_VMinQuotient", avgtime, sdevtime, mintime, maxtime);
+  PRINT_TIME1("N_VMinQuotient", 2, 2, avgtime, sdevtime, mintime, maxtime);
 
   /* Free vectors */
   free(times);
@@ -1390,8 +1406,9 @@ int Test_N_VLinearCombination(N_Vector X, sunindextype local_length, int nvecs,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VLinearCombination-1", favgtime, fsdevtime, fmintime, fmaxtime,
-              uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VLinearCombination-1", nvecs + 1, 2 * (nvecs - 1), favgtime,
+              fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime, umintime,
+              umaxtime);
 
   /*
    * Case 2: Y[0] = sum c[i] Y[i], c[0] != 1
@@ -1458,8 +1475,9 @@ int Test_N_VLinearCombination(N_Vector X, sunindextype local_length, int nvecs,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VLinearCombination-2", favgtime, fsdevtime, fmintime, fmaxtime,
-              uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VLinearCombination-2", nvecs + 1, 2 * nvecs - 1, favgtime,
+              fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime, umintime,
+              umaxtime);
 
   /*
    * Case 3: X = sum c[i] Y[i]
@@ -1520,8 +1538,9 @@ int Test_N_VLinearCombination(N_Vector X, sunindextype local_length, int nvecs,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VLinearCombination-3", favgtime, fsdevtime, fmintime, fmaxtime,
-              uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VLinearCombination-3", nvecs + 1, 2 * nvecs - 1, favgtime,
+              fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime, umintime,
+              umaxtime);
 
   /* Free vectors */
   free(ftimes);
@@ -1605,8 +1624,9 @@ int Test_N_VScaleAddMulti(N_Vector X, sunindextype local_length, int nvecs,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VScaleAddMulti-1", favgtime, fsdevtime, fmintime, fmaxtime,
-              uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VScaleAddMulti-1", 2 * nvecs + 1, 2 * nvecs, favgtime,
+              fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime, umintime,
+              umaxtime);
 
   /*
    * Case 2: Z[i] = c[i] x + Y[i], N_VScaleAddMulti
@@ -1657,8 +1677,9 @@ int Test_N_VScaleAddMulti(N_Vector X, sunindextype local_length, int nvecs,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VScaleAddMulti-2", favgtime, fsdevtime, fmintime, fmaxtime,
-              uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VScaleAddMulti-2", 2 * nvecs + 1, 2 * nvecs, favgtime,
+              fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime, umintime,
+              umaxtime);
 
   /* Free vectors */
   free(ftimes);
@@ -1730,8 +1751,8 @@ int Test_N_VDotProdMulti(N_Vector X, sunindextype local_length, int nvecs,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VDotProdMulti", favgtime, fsdevtime, fmintime, fmaxtime,
-              uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VDotProdMulti", nvecs + 1, 2 * nvecs, favgtime, fsdevtime,
+              fmintime, fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
 
   /* Free vectors */
   free(ftimes);
@@ -1817,8 +1838,9 @@ int Test_N_VLinearSumVectorArray(N_Vector V, sunindextype local_length,
              &fmaxtime);
   time_stats(V, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VLinearSumVectorArray", favgtime, fsdevtime, fmintime,
-              fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VLinearSumVectorArray", 3 * nvecs, 3 * nvecs, favgtime,
+              fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime, umintime,
+              umaxtime);
 
   /* Free vectors */
   free(ftimes);
@@ -1901,8 +1923,8 @@ int Test_N_VScaleVectorArray(N_Vector X, sunindextype local_length, int nvecs,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VScaleVectorArray-1", favgtime, fsdevtime, fmintime, fmaxtime,
-              uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VScaleVectorArray-1", 2 * nvecs, nvecs, favgtime, fsdevtime,
+              fmintime, fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
 
   /*
    * Case 2: Z[j] = c[j] Y[j]
@@ -1951,8 +1973,8 @@ int Test_N_VScaleVectorArray(N_Vector X, sunindextype local_length, int nvecs,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VScaleVectorArray-2", favgtime, fsdevtime, fmintime, fmaxtime,
-              uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VScaleVectorArray-2", 2 * nvecs, nvecs, favgtime, fsdevtime,
+              fmintime, fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
 
   /* Free vectors */
   free(ftimes);
@@ -2027,8 +2049,8 @@ int Test_N_VConstVectorArray(N_Vector X, sunindextype local_length, int nvecs,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VConstVectorArray", favgtime, fsdevtime, fmintime, fmaxtime,
-              uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VConstVectorArray", nvecs, 0, favgtime, fsdevtime, fmintime,
+              fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
 
   /* Free vectors */
   free(ftimes);
@@ -2109,8 +2131,9 @@ int Test_N_VWrmsNormVectorArray(N_Vector X, sunindextype local_length,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VWrmsNormVectorArray", favgtime, fsdevtime, fmintime, fmaxtime,
-              uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VWrmsNormVectorArray", 2 * nvecs, 3 * nvecs, favgtime,
+              fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime, umintime,
+              umaxtime);
 
   /* Free vectors */
   free(ftimes);
@@ -2196,8 +2219,9 @@ int Test_N_VWrmsNormMaskVectorArray(N_Vector X, sunindextype local_length,
              &fmaxtime);
   time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VWrmsNormMaskVectorArray", favgtime, fsdevtime, fmintime,
-              fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VWrmsNormMaskVectorArray", 2 * nvecs + 1, 3 * nvecs, favgtime,
+              fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime, umintime,
+              umaxtime);
 
   /* Free vectors */
   free(ftimes);
@@ -2312,8 +2336,9 @@ int Test_N_VScaleAddMultiVectorArray(N_Vector V, sunindextype local_length,
              &fmaxtime);
   time_stats(V, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VScaleAddMultiVectorArray-1", favgtime, fsdevtime, fmintime,
-              fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VScaleAddMultiVectorArray-1", nvecs * (2 * nsums + 1),
+              2 * nvecs * nsums, favgtime, fsdevtime, fmintime, fmaxtime,
+              uavgtime, usdevtime, umintime, umaxtime);
 
   /*
    * Case 2: Z[j][k] = c[j] X[k] + Y[j][k]
@@ -2386,8 +2411,9 @@ int Test_N_VScaleAddMultiVectorArray(N_Vector V, sunindextype local_length,
              &fmaxtime);
   time_stats(V, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VScaleAddMultiVectorArray-2", favgtime, fsdevtime, fmintime,
-              fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VScaleAddMultiVectorArray-2", nvecs * (2 * nsums + 1),
+              2 * nvecs * nsums, favgtime, fsdevtime, fmintime, fmaxtime,
+              uavgtime, usdevtime, umintime, umaxtime);
 
   /* Free vectors */
   free(ftimes);
@@ -2512,8 +2538,9 @@ int Test_N_VLinearCombinationVectorArray(N_Vector V, sunindextype local_length,
              &fmaxtime);
   time_stats(V, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VLinearCombinationVectorArray-1", favgtime, fsdevtime,
-              fmintime, fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VLinearCombinationVectorArray-1", nvecs * (nsums + 1),
+              2 * nvecs * (nsums - 1), favgtime, fsdevtime, fmintime, fmaxtime,
+              uavgtime, usdevtime, umintime, umaxtime);
 
   /*
    * Case 2: X[0][k] = sum c[j] X[j][k], c[0] != 1
@@ -2594,8 +2621,9 @@ int Test_N_VLinearCombinationVectorArray(N_Vector V, sunindextype local_length,
              &fmaxtime);
   time_stats(V, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VLinearCombinationVectorArray-2", favgtime, fsdevtime,
-              fmintime, fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VLinearCombinationVectorArray-2", nvecs * (nsums + 1),
+              nvecs * (2 * nsums - 1), favgtime, fsdevtime, fmintime, fmaxtime,
+              uavgtime, usdevtime, umintime, umaxtime);
 
   /*
    * Case 3: Z[j][k] = sum c[j] X[j][k]
@@ -2676,8 +2704,9 @@ int Test_N_VLinearCombinationVectorArray(N_Vector V, sunindextype local_length,
              &fmaxtime);
   time_stats(V, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
              &umaxtime);
-  PRINT_TIME2("N_VLinearCombinationVectorArray-3", favgtime, fsdevtime,
-              fmintime, fmaxtime, uavgtime, usdevtime, umintime, umaxtime);
+  PRINT_TIME2("N_VLinearCombinationVectorArray-3", nvecs * (nsums + 1),
+              nvecs * (2 * nsums - 1), favgtime, fsdevtime, fmintime, fmaxtime,
+              uavgtime, usdevtime, umintime, umaxtime);
 
   /* Free vectors */
   free(ftimes);
@@ -2698,19 +2727,186 @@ int Test_N_VLinearCombinationVectorArray(N_Vector V, sunindextype local_length,
 /* ----------------------------------------------------------------------
  * Print table headers for test output
  * --------------------------------------------------------------------*/
+/* ----------------------------------------------------------------------
+ * Blocked fused operations versus unblocked reference loops
+ *
+ * Compares N_VLinearCombination, N_VScaleAddMulti, and N_VDotProdMulti of X
+ * (reported in the fused columns) to reference loops that process one vector
+ * at a time over the data arrays (reported in the unfused columns), i.e., the
+ * loops used by implementations without cache blocking. The vector must have
+ * its data on the host and the fused operations enabled.
+ * --------------------------------------------------------------------*/
+int Test_N_VFusedBlocking(N_Vector X, sunindextype local_length, int nvecs,
+                          int ntests)
+{
+  double start_time, stop_time;
+  double favgtime, fsdevtime, fmintime, fmaxtime;
+  double uavgtime, usdevtime, umintime, umaxtime;
+  double *ftimes, *utimes;
+  int i, j;
+  sunindextype k;
+  int ier = 0;
+  sunrealtype sum;
+  sunrealtype *c, *xd, *yd, *zd;
+  N_Vector *Y, *Z;
+
+  /* allocate timing arrays */
+  ftimes = (double*)malloc((ntests + nwarmups) * sizeof(double));
+  utimes = (double*)malloc((ntests + nwarmups) * sizeof(double));
+
+  /* create additional nvectors and array of scaling factors */
+  c = (sunrealtype*)malloc(nvecs * sizeof(sunrealtype));
+  Y = N_VCloneVectorArray(nvecs, X);
+  Z = N_VCloneVectorArray(nvecs, X);
+
+  /* fill vector data */
+  N_VRand(X, local_length, NEG_ONE, ONE);
+  for (j = 0; j < nvecs; j++)
+  {
+    N_VRand(Y[j], local_length, NEG_ONE, ONE);
+    c[j] = ((sunrealtype)rand() / (sunrealtype)RAND_MAX) + 1.0;
+  }
+  xd = N_VGetArrayPointer(X);
+
+  /*
+   * X = sum c[j] Y[j]
+   */
+
+  for (i = 0; i < ntests + nwarmups; i++)
+  {
+    ClearCache();
+    start_time = get_time();
+    yd         = N_VGetArrayPointer(Y[0]);
+    for (k = 0; k < local_length; k++) { xd[k] = c[0] * yd[k]; }
+    for (j = 1; j < nvecs; j++)
+    {
+      yd = N_VGetArrayPointer(Y[j]);
+      for (k = 0; k < local_length; k++) { xd[k] += c[j] * yd[k]; }
+    }
+    stop_time = get_time();
+
+    utimes[i] = stop_time - start_time;
+  }
+
+  for (i = 0; i < ntests + nwarmups; i++)
+  {
+    ClearCache();
+    start_time = get_time();
+    ier        = N_VLinearCombination(nvecs, c, Y, X);
+    stop_time  = get_time();
+
+    ftimes[i] = stop_time - start_time;
+  }
+
+  time_stats(X, ftimes, nwarmups, ntests, &favgtime, &fsdevtime, &fmintime,
+             &fmaxtime);
+  time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
+             &umaxtime);
+  PRINT_TIME2("N_VLinearCombination-blocked", nvecs + 1, 2 * nvecs - 1,
+              favgtime, fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime,
+              umintime, umaxtime);
+
+  /*
+   * Z[j] = c[j] X + Y[j]
+   */
+
+  for (i = 0; i < ntests + nwarmups; i++)
+  {
+    ClearCache();
+    start_time = get_time();
+    for (j = 0; j < nvecs; j++)
+    {
+      yd = N_VGetArrayPointer(Y[j]);
+      zd = N_VGetArrayPointer(Z[j]);
+      for (k = 0; k < local_length; k++) { zd[k] = c[j] * xd[k] + yd[k]; }
+    }
+    stop_time = get_time();
+
+    utimes[i] = stop_time - start_time;
+  }
+
+  for (i = 0; i < ntests + nwarmups; i++)
+  {
+    ClearCache();
+    start_time = get_time();
+    ier        = N_VScaleAddMulti(nvecs, c, X, Y, Z);
+    stop_time  = get_time();
+
+    ftimes[i] = stop_time - start_time;
+  }
+
+  time_stats(X, ftimes, nwarmups, ntests, &favgtime, &fsdevtime, &fmintime,
+             &fmaxtime);
+  time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
+             &umaxtime);
+  PRINT_TIME2("N_VScaleAddMulti-blocked", 2 * nvecs + 1, 2 * nvecs, favgtime,
+              fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime, umintime,
+              umaxtime);
+
+  /*
+   * c[j] = X . Y[j]
+   */
+
+  for (i = 0; i < ntests + nwarmups; i++)
+  {
+    ClearCache();
+    start_time = get_time();
+    for (j = 0; j < nvecs; j++)
+    {
+      yd  = N_VGetArrayPointer(Y[j]);
+      sum = ZERO;
+      for (k = 0; k < local_length; k++) { sum += xd[k] * yd[k]; }
+      c[j] = sum;
+    }
+    stop_time = get_time();
+
+    utimes[i] = stop_time - start_time;
+  }
+
+  for (i = 0; i < ntests + nwarmups; i++)
+  {
+    ClearCache();
+    start_time = get_time();
+    ier        = N_VDotProdMulti(nvecs, X, Y, c);
+    stop_time  = get_time();
+
+    ftimes[i] = stop_time - start_time;
+  }
+
+  time_stats(X, ftimes, nwarmups, ntests, &favgtime, &fsdevtime, &fmintime,
+             &fmaxtime);
+  time_stats(X, utimes, nwarmups, ntests, &uavgtime, &usdevtime, &umintime,
+             &umaxtime);
+  PRINT_TIME2("N_VDotProdMulti-blocked", nvecs + 1, 2 * nvecs, favgtime,
+              fsdevtime, fmintime, fmaxtime, uavgtime, usdevtime, umintime,
+              umaxtime);
+
+  /* Free vectors */
+  free(ftimes);
+  free(utimes);
+  free(c);
+  N_VDestroyVectorArray(Y, nvecs);
+  N_VDestroyVectorArray(Z, nvecs);
+
+  return (ier);
+}
+
 void PrintTableHeader(int type)
 {
   switch (type)
   {
   case 1:
-    printf("\n%33s %22s %22s %22s %22s\n", "Operation", "Avg", "Std Dev", "Min",
-           "Max");
+    printf("\n%33s %22s %22s %22s %22s %15s %15s %8s\n", "Operation", "Avg",
+           "Std Dev", "Min", "Max", "GB/s", "GFLOP/s", "% Peak");
     break;
 
   case 2:
-    printf("\n%33s %22s %22s %22s %22s %22s %22s %22s %22s\n", "Operation",
-           "Avg Fused", "Std Dev Fused", "Min Fused", "Max Fused",
-           "Avg Unfused", "Std Dev Unfused", "Min Unfused", "Max Unfused");
+    printf("\n%33s %22s %22s %22s %22s %22s %22s %22s %22s %15s %15s %8s %15s "
+           "%15s %8s\n",
+           "Operation", "Avg Fused", "Std Dev Fused", "Min Fused", "Max Fused",
+           "Avg Unfused", "Std Dev Unfused", "Min Unfused", "Max Unfused",
+           "GB/s Fused", "GFLOP/s Fused", "% Peak", "GB/s Unfused",
+           "GFLOP/s Unfused", "% Peak");
     break;
   }
 }
@@ -2739,6 +2935,17 @@ void SetTiming(int onoff, int myid)
   /* only print from the root process */
   if (myid == 0) { print_time = onoff; }
   else { print_time = 0; }
+
+  /* get the peak bandwidth for the roofline output, the host STREAM triad
+     bandwidth may be overridden (e.g., with a device bandwidth) by setting the
+     environment variable NVECTOR_BENCHMARK_PEAK_BW in GB/s */
+  if (print_time)
+  {
+    const char* peak_bw_env = getenv("NVECTOR_BENCHMARK_PEAK_BW");
+    if (peak_bw_env) { peak_bw = atof(peak_bw_env); }
+    else { peak_bw = measure_triad_bandwidth(); }
+    printf("Peak bandwidth: %g GB/s\n", peak_bw);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -2823,6 +3030,102 @@ static double get_time(void)
   return time;
 }
 
+/* ----------------------------------------------------------------------
+ * STREAM triad, a = b + s * c, bandwidth in GB/s using the best time
+ * from several trials with arrays much larger than the last level cache
+ * --------------------------------------------------------------------*/
+static double measure_triad_bandwidth(void)
+{
+  const long int n         = 1L << 23; /* 64 MB per array in double precision */
+  const int ntrials        = 10;
+  const sunrealtype scalar = SUN_RCONST(3.0);
+  sunrealtype *a, *b, *c;
+  double start_time, elapsed, min_time;
+  long int i;
+  int k;
+
+  a = (sunrealtype*)malloc(n * sizeof(sunrealtype));
+  b = (sunrealtype*)malloc(n * sizeof(sunrealtype));
+  c = (sunrealtype*)malloc(n * sizeof(sunrealtype));
+  if (!a || !b || !c)
+  {
+    free(a);
+    free(b);
+    free(c);
+    return 0.0;
+  }
+
+  /* first touch with the same thread layout as the triad loop */
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+  for (i = 0; i < n; i++)
+  {
+    a[i] = ZERO;
+    b[i] = ONE;
+    c[i] = TWO;
+  }
+
+  min_time = 0.0;
+  for (k = 0; k < ntrials; k++)
+  {
+    start_time = get_time();
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (i = 0; i < n; i++) { a[i] = b[i] + scalar * c[i]; }
+    elapsed = get_time() - start_time;
+    if (k == 0 || elapsed < min_time) { min_time = elapsed; }
+  }
+
+  free(a);
+  free(b);
+  free(c);
+
+  if (min_time <= 0.0) { return 0.0; }
+  return 3.0 * (double)n * (double)sizeof(sunrealtype) / min_time / 1.0e9;
+}
+
+/* ----------------------------------------------------------------------
+ * Print timing data along with the achieved bandwidth (GB/s), flop rate
+ * (GFLOP/s), and percentage of the peak bandwidth based on the min time
+ * --------------------------------------------------------------------*/
+static void print_rates(double words, double flops, double time)
+{
+  double gbs    = 0.0;
+  double gflops = 0.0;
+  double peak   = 0.0;
+
+  if (time > 0.0)
+  {
+    gbs    = words * (double)sizeof(sunrealtype) / time / 1.0e9;
+    gflops = flops / time / 1.0e9;
+  }
+  if (peak_bw > 0.0) { peak = 100.0 * gbs / peak_bw; }
+
+  printf(" %15.5e %15.5e %8.2f", gbs, gflops, peak);
+}
+
+static void print_time1(const char* test, double words, double flops,
+                        double avg, double sdev, double min, double max)
+{
+  printf("%33s %22.15e %22.15e %22.15e %22.15e", test, avg, sdev, min, max);
+  print_rates(words, flops, min);
+  printf("\n");
+}
+
+static void print_time2(const char* test, double words, double flops,
+                        double avg1, double sdev1, double min1, double max1,
+                        double avg2, double sdev2, double min2, double max2)
+{
+  printf("%33s %22.15e %22.15e %22.15e %22.15e %22.15e %22.15e %22.15e "
+         "%22.15e",
+         test, avg1, sdev1, min1, max1, avg2, sdev2, min2, max2);
+  print_rates(words, flops, min1);
+  print_rates(words, flops, min2);
+  printf("\n");
+}
+
 /* ----------------------------------------------------------------------
  * compute average, standard deviation, max, and min
  * --------------------------------------------------------------------*/
@@ -81,6 +81,10 @@ int Test_N_VScaleAddMultiVectorArray(N_Vector X, sunindextype local_length,
                                      int nvecs, int nsums, int ntests);
 int Test_N_VLinearCombinationVectorArray(N_Vector X, sunindextype local_length,
                                          int nvecs, int nsums, int tests);
+
+/* Cache blocking tests (host data and fused operations required) */
+int Test_N_VFusedBlocking(N_Vector X, sunindextype local_length, int nvecs,
+                          int ntests);
 /* Turn timing on/off */
 void SetTiming(int onoff, int myid);
 
@@ -141,6 +141,8 @@ list(APPEND SUNDIALS_BUILD_LIST "BUILD_NVECTOR_KOKKOS")
 # required modules are in the build list, but cannot be disabled
 set(BUILD_SUNMATRIX_BAND TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_BAND")
+set(BUILD_SUNMATRIX_BLOCKTRIDIAG TRUE)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_BLOCKTRIDIAG")
 set(BUILD_SUNMATRIX_DENSE TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_DENSE")
 set(BUILD_SUNMATRIX_SPARSE TRUE)
@@ -200,8 +202,12 @@ list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_SLUNRLOC")
 # required modules are in the build list, but cannot be disabled
 set(BUILD_SUNLINSOL_BAND TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_BAND")
+set(BUILD_SUNLINSOL_BLOCKTRIDIAG TRUE)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_BLOCKTRIDIAG")
 set(BUILD_SUNLINSOL_DENSE TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_DENSE")
+set(BUILD_SUNLINSOL_MIXEDPREC TRUE)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_MIXEDPREC")
 set(BUILD_SUNLINSOL_PCG TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_PCG")
 set(BUILD_SUNLINSOL_SPBCGS TRUE)
@@ -1096,15 +1096,8 @@ static SUNErrCode TaskLocalNewton_Free(SUNNonlinearSolver NLS)
     NLS->content = NULL;
   }
 
-  /* free the ops structure */
-  if (NLS->ops)
-  {
-    free(NLS->ops);
-    NLS->ops = NULL;
-  }
-
-  /* free the nonlinear solver */
-  free(NLS);
+  /* free the ops structure and the nonlinear solver */
+  SUNNonlinSolFreeEmpty(NLS);
 
   return SUN_SUCCESS;
 }
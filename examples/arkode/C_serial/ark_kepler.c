@@ -42,12 +42,14 @@
  * The program also accepts command line arguments to change the method
  * used and time-stepping strategy. The program has the following CLI arguments:
  *
- *   --step-mode <fixed, adapt>  should we use a fixed time-step or adaptive time-step (default fixed)
+ *   --step-mode <fixed, adapt, reversible>  should we use a fixed time-step, adaptive time-step, or time reversible step control with SPRK (default fixed)
  *   --stepper <SPRK, ERK>       should we use SPRKStep or ARKStep with an ERK method (default SPRK)
  *   --method <string>           which method to use (default ARKODE_SPRK_MCLACHLAN_4_4)
  *   --use-compensated-sums      turns on compensated summation in ARKODE where applicable
  *   --disable-tstop             turns off tstop mode
- *   --dt <Real>                 the fixed-time step size to use if fixed time stepping is turned on (default 0.01)
+ *   --dt <Real>                 the fixed-time step size, or the transformed step size with reversible step control (default 0.01)
+ *   --rtol <Real>               the relative tolerance with adaptive time stepping (default 0.01)
+ *   --atol <Real>               the absolute tolerance with adaptive time stepping (default 0.01)
  *   --tf <Real>                 the final time for the simulation (default 100)
  *   --nout                      number of output times
  *   --count-orbits              use rootfinding to count the number of completed orbits
@@ -103,6 +105,10 @@ static int dydt(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data);
 static int velocity(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data);
 static int force(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data);
 
+/* step density callback function for the reversible step control */
+static int density(sunrealtype t, N_Vector y, sunrealtype* rho,
+                   sunrealtype* rho_dot, void* user_data);
+
 /* g(q) callback function for rootfinding */
 static int rootfn(sunrealtype t, N_Vector y, sunrealtype* gout, void* user_data);
 
@@ -128,6 +134,8 @@ int SolveProblem(ProgramArgs* args, ProblemResult* result, SUNContext sunctx)
   const int num_output_times = args->num_output_times;
   const char* method_name    = args->method_name;
   const sunrealtype dt       = args->dt;
+  const sunrealtype rtol     = args->rtol;
+  const sunrealtype atol     = args->atol;
   sunrealtype Tf             = args->tf;
 
   /* Default problem parameters */
@@ -175,11 +183,25 @@ int SolveProblem(ProgramArgs* args, ProblemResult* result, SUNContext sunctx)
       retval = ARKodeSetMaxNumSteps(arkode_mem, ((long int)ceil(Tf / dt)) + 1);
       if (check_retval(&retval, "ARKodeSetMaxNumSteps", 1)) { return 1; }
     }
+    else if (step_mode == 1)
+    {
+      retval = ARKodeSStolerances(arkode_mem, rtol, atol);
+      if (check_retval(&retval, "ARKodeSStolerances", 1)) { return 1; }
+
+      retval = ARKodeSetMaxNumSteps(arkode_mem, -1);
+      if (check_retval(&retval, "ARKodeSetMaxNumSteps", 1)) { return 1; }
+    }
     else
     {
-      fprintf(stderr,
-              "ERROR: adaptive time-steps are not supported with SPRKStep\n");
-      return 1;
+      /* the step sizes follow |q|^(3/2) with dt in the transformed time */
+      retval = SPRKStepSetReversibleStepControl(arkode_mem, density, dt);
+      if (check_retval(&retval, "SPRKStepSetReversibleStepControl", 1))
+      {
+        return 1;
+      }
+
+      retval = ARKodeSetMaxNumSteps(arkode_mem, -1);
+      if (check_retval(&retval, "ARKodeSetMaxNumSteps", 1)) { return 1; }
     }
 
     retval = ARKodeSetUserData(arkode_mem, (void*)udata);
@@ -207,7 +229,7 @@ int SolveProblem(ProgramArgs* args, ProblemResult* result, SUNContext sunctx)
     if (step_mode == 0) { retval = ARKodeSetFixedStep(arkode_mem, dt); }
     else
     {
-      retval = ARKodeSStolerances(arkode_mem, dt, dt);
+      retval = ARKodeSStolerances(arkode_mem, rtol, atol);
       if (check_retval(&retval, "ARKodeSStolerances", 1)) { return 1; }
     }
   }
@@ -437,6 +459,20 @@ int force(sunrealtype t, N_Vector yvec, N_Vector ydotvec, void* user_data)
   return 0;
 }
 
+int density(sunrealtype t, N_Vector yvec, sunrealtype* rho,
+            sunrealtype* rho_dot, void* user_data)
+{
+  sunrealtype* y        = N_VGetArrayPointer(yvec);
+  const sunrealtype qTq = y[0] * y[0] + y[1] * y[1];
+  const sunrealtype qTp = y[0] * y[2] + y[1] * y[3];
+
+  /* rho = |q|^(-3/2) and d rho/dt = -3/2 |q|^(-7/2) q^T p */
+  *rho     = SUNRpowerR(qTq, SUN_RCONST(-0.75));
+  *rho_dot = SUN_RCONST(-1.5) * (*rho) * qTp / qTq;
+
+  return 0;
+}
+
 int rootfn(sunrealtype t, N_Vector yvec, sunrealtype* gout, void* user_data)
 {
   sunrealtype* y       = N_VGetArrayPointer(yvec);
@@ -33,6 +33,8 @@ typedef struct
   int count_orbits;
   int check_order;
   sunrealtype dt;
+  sunrealtype rtol;
+  sunrealtype atol;
   sunrealtype tf;
   const char* method_name;
 } ProgramArgs;
@@ -64,12 +66,14 @@ static void PrintHelp(void)
   fprintf(stderr, "ark_kepler: an ARKODE example demonstrating the SPRKStep "
                   "time-stepping module solving the Kepler problem\n");
   /* clang-format off */
-  fprintf(stderr, "  --step-mode <fixed, adapt>  should we use a fixed time-step or adaptive time-step (default fixed)\n");
+  fprintf(stderr, "  --step-mode <fixed, adapt, reversible>  should we use a fixed time-step, adaptive time-step, or time reversible step control with SPRK (default fixed)\n");
   fprintf(stderr, "  --stepper <SPRK, ERK>       should we use SPRKStep or ARKStep with an ERK method (default SPRK)\n");
   fprintf(stderr, "  --method <string>           which method to use (default ARKODE_SPRK_MCLACHLAN_4_4)\n");
   fprintf(stderr, "  --use-compensated-sums      turns on compensated summation in ARKODE where applicable\n");
   fprintf(stderr, "  --disable-tstop             turns off tstop mode\n");
-  fprintf(stderr, "  --dt <Real>                 the fixed-time step size to use if fixed time stepping is turned on (default 0.01)\n");
+  fprintf(stderr, "  --dt <Real>                 the fixed-time step size, or the transformed step size with reversible step control (default 0.01)\n");
+  fprintf(stderr, "  --rtol <Real>               the relative tolerance with adaptive time stepping (default 0.01)\n");
+  fprintf(stderr, "  --atol <Real>               the absolute tolerance with adaptive time stepping (default 0.01)\n");
   fprintf(stderr, "  --tf <Real>                 the final time for the simulation (default 100)\n");
   fprintf(stderr, "  --nout <int>                the number of output times (default 100)\n");
   fprintf(stderr, "  --count-orbits              use rootfinding to count the number of completed orbits\n");
@@ -88,6 +92,8 @@ static int ParseArgs(int argc, char* argv[], ProgramArgs* args)
   args->use_compsums     = 0;
   args->use_tstop        = 1;
   args->dt               = SUN_RCONST(1e-2);
+  args->rtol             = SUN_RCONST(1e-2);
+  args->atol             = SUN_RCONST(1e-2);
   args->tf               = SUN_RCONST(100.);
   args->check_order      = 0;
   args->num_output_times = 50;
@@ -99,9 +105,11 @@ static int ParseArgs(int argc, char* argv[], ProgramArgs* args)
       argi++;
       if (!strcmp(argv[argi], "fixed")) { args->step_mode = 0; }
       else if (!strcmp(argv[argi], "adapt")) { args->step_mode = 1; }
+      else if (!strcmp(argv[argi], "reversible")) { args->step_mode = 2; }
       else
       {
-        fprintf(stderr, "ERROR: --step-mode must be 'fixed' or 'adapt'\n");
+        fprintf(stderr, "ERROR: --step-mode must be 'fixed', 'adapt', or "
+                        "'reversible'\n");
         return 1;
       }
     }
@@ -126,6 +134,16 @@ static int ParseArgs(int argc, char* argv[], ProgramArgs* args)
       argi++;
       args->dt = atof(argv[argi]);
     }
+    else if (!strcmp(argv[argi], "--rtol"))
+    {
+      argi++;
+      args->rtol = atof(argv[argi]);
+    }
+    else if (!strcmp(argv[argi], "--atol"))
+    {
+      argi++;
+      args->atol = atof(argv[argi]);
+    }
     else if (!strcmp(argv[argi], "--tf"))
     {
       argi++;
@@ -156,6 +174,12 @@ static int ParseArgs(int argc, char* argv[], ProgramArgs* args)
     }
   }
 
+  if (args->step_mode == 2 && args->stepper != 0)
+  {
+    fprintf(stderr, "ERROR: --step-mode reversible requires --stepper SPRK\n");
+    return 1;
+  }
+
   if (!args->method_name)
   {
     if (args->stepper == 0) { args->method_name = "ARKODE_SPRK_MCLACHLAN_4_4"; }
@@ -176,6 +200,11 @@ static void PrintArgs(ProgramArgs* args)
   fprintf(stdout, "  use tstop:            %d\n", args->use_tstop);
   fprintf(stdout, "  use compensated sums: %d\n", args->use_compsums);
   fprintf(stdout, "  dt:                   %Lg\n", (long double)args->dt);
+  if (args->step_mode == 1)
+  {
+    fprintf(stdout, "  rtol:                 %Lg\n", (long double)args->rtol);
+    fprintf(stdout, "  atol:                 %Lg\n", (long double)args->atol);
+  }
   fprintf(stdout, "  Tf:                   %Lg\n", (long double)args->tf);
   fprintf(stdout, "  nout:                 %d\n\n", args->num_output_times);
 }
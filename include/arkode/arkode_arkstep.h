@@ -90,6 +90,8 @@ SUNDIALS_EXPORT int ARKStepSetTableNum(void* arkode_mem,
                                        ARKODE_ERKTableID etable);
 SUNDIALS_EXPORT int ARKStepSetTableName(void* arkode_mem, const char* itable,
                                         const char* etable);
+SUNDIALS_EXPORT int ARKStepSetStageGroupNumThreads(void* arkode_mem,
+                                                   int nthreads);
 
 /* Optional output functions */
 SUNDIALS_EXPORT int ARKStepGetCurrentButcherTables(void* arkode_mem,
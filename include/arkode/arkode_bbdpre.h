@@ -44,6 +44,8 @@ SUNDIALS_EXPORT int ARKBBDPrecInit(void* arkode_mem, sunindextype Nlocal,
 SUNDIALS_EXPORT int ARKBBDPrecReInit(void* arkode_mem, sunindextype mudq,
                                      sunindextype mldq, sunrealtype dqrely);
 
+SUNDIALS_EXPORT int ARKBBDPrecSetNumSubBlocks(void* arkode_mem, int nsub);
+
 /* Optional output functions */
 
 SUNDIALS_DEPRECATED_EXPORT_MSG(
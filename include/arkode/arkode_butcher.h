@@ -59,6 +59,8 @@ SUNDIALS_EXPORT void ARKodeButcherTable_Write(ARKodeButcherTable B,
                                               FILE* outfile);
 SUNDIALS_EXPORT sunbooleantype
 ARKodeButcherTable_IsStifflyAccurate(ARKodeButcherTable B);
+SUNDIALS_EXPORT int ARKodeButcherTable_GetStageGroups(ARKodeButcherTable B,
+                                                      int* ngroups, int* group);
 SUNDIALS_EXPORT int ARKodeButcherTable_CheckOrder(ARKodeButcherTable B, int* q,
                                                   int* p, FILE* outfile);
 SUNDIALS_EXPORT int ARKodeButcherTable_CheckARKOrder(ARKodeButcherTable B1,
@@ -54,7 +54,8 @@ typedef enum
   ARKODE_BACKWARD_EULER_1_1,
   ARKODE_IMPLICIT_MIDPOINT_1_2,
   ARKODE_IMPLICIT_TRAPEZOIDAL_2_2,
-  ARKODE_MAX_DIRK_NUM = ARKODE_IMPLICIT_TRAPEZOIDAL_2_2
+  ARKODE_PDIRK_3_2_3,
+  ARKODE_MAX_DIRK_NUM = ARKODE_PDIRK_3_2_3
 } ARKODE_DIRKTableID;
 
 /* Accessor routine to load built-in DIRK table */
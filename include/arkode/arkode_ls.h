@@ -99,6 +99,9 @@ SUNDIALS_EXPORT int ARKodeSetMassLinearSolver(void* arkode_mem,
 SUNDIALS_EXPORT int ARKodeSetJacFn(void* arkode_mem, ARKLsJacFn jac);
 SUNDIALS_EXPORT int ARKodeSetMassFn(void* arkode_mem, ARKLsMassFn mass);
 SUNDIALS_EXPORT int ARKodeSetJacEvalFrequency(void* arkode_mem, long int msbj);
+SUNDIALS_EXPORT int ARKodeSetAdaptiveJacEval(void* arkode_mem,
+                                             sunbooleantype onoff);
+SUNDIALS_EXPORT int ARKodeSetDQJacNumThreads(void* arkode_mem, int nthreads);
 SUNDIALS_EXPORT int ARKodeSetLinearSolutionScaling(void* arkode_mem,
                                                    sunbooleantype onoff);
 SUNDIALS_EXPORT int ARKodeSetEpsLin(void* arkode_mem, sunrealtype eplifac);
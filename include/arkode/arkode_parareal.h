@@ -0,0 +1,52 @@
+/*---------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *---------------------------------------------------------------
+ * This is the header file for the ARKODE parareal module, a
+ * shared-memory parallel-in-time driver built on SUNStepper.
+ *--------------------------------------------------------------*/
+
+#ifndef ARKODE_PARAREAL_H_
+#define ARKODE_PARAREAL_H_
+
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_stepper.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+SUNDIALS_EXPORT void* ARKPararealCreate(SUNStepper coarse, int nfine,
+                                        SUNStepper* fine, SUNContext sunctx);
+
+SUNDIALS_EXPORT int ARKPararealSetNumSlices(void* pr_mem, int nslices);
+
+SUNDIALS_EXPORT int ARKPararealSetMaxIters(void* pr_mem, int maxiters);
+
+SUNDIALS_EXPORT int ARKPararealSetTolerances(void* pr_mem, sunrealtype reltol,
+                                             sunrealtype abstol);
+
+SUNDIALS_EXPORT int ARKPararealEvolve(void* pr_mem, sunrealtype t0,
+                                      N_Vector y0, sunrealtype tf, N_Vector yf);
+
+SUNDIALS_EXPORT int ARKPararealGetNumIters(void* pr_mem, int* niters);
+
+SUNDIALS_EXPORT int ARKPararealGetTotalIters(void* pr_mem, long int* niters);
+
+SUNDIALS_EXPORT int ARKPararealGetUpdateNorm(void* pr_mem, sunrealtype* unorm);
+
+SUNDIALS_EXPORT void ARKPararealFree(void** pr_mem);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -37,6 +37,17 @@ static const int SPRKSTEP_DEFAULT_6  = ARKODE_SPRK_YOSHIDA_6_8;
 static const int SPRKSTEP_DEFAULT_8  = ARKODE_SPRK_SUZUKI_UMENO_8_16;
 static const int SPRKSTEP_DEFAULT_10 = ARKODE_SPRK_SOFRONIOU_10_36;
 
+/* -----------------------
+ * SPRKStep Function Types
+ * ----------------------- */
+
+typedef int (*SPRKStepForceUpdateFn)(sunrealtype t, N_Vector q, sunrealtype c,
+                                     N_Vector p, void* user_data);
+
+typedef int (*SPRKStepStepDensityFn)(sunrealtype t, N_Vector y,
+                                     sunrealtype* rho, sunrealtype* rho_dot,
+                                     void* user_data);
+
 /* -------------------
  * Exported Functions
  * ------------------- */
@@ -53,6 +64,12 @@ SUNDIALS_EXPORT int SPRKStepSetUseCompensatedSums(void* arkode_mem,
 SUNDIALS_EXPORT int SPRKStepSetMethod(void* arkode_mem,
                                       ARKodeSPRKTable sprk_storage);
 SUNDIALS_EXPORT int SPRKStepSetMethodName(void* arkode_mem, const char* method);
+SUNDIALS_EXPORT int SPRKStepSetPartitioned(void* arkode_mem,
+                                           sunbooleantype onoff);
+SUNDIALS_EXPORT int SPRKStepSetForceUpdateFn(void* arkode_mem,
+                                             SPRKStepForceUpdateFn fu);
+SUNDIALS_EXPORT int SPRKStepSetReversibleStepControl(
+  void* arkode_mem, SPRKStepStepDensityFn density, sunrealtype eps);
 
 /* Optional output functions */
 SUNDIALS_EXPORT int SPRKStepGetCurrentMethod(void* arkode_mem,
@@ -46,6 +46,8 @@ SUNDIALS_EXPORT int CVBBDPrecInit(void* cvode_mem, sunindextype Nlocal,
 SUNDIALS_EXPORT int CVBBDPrecReInit(void* cvode_mem, sunindextype mudq,
                                     sunindextype mldq, sunrealtype dqrely);
 
+SUNDIALS_EXPORT int CVBBDPrecSetNumSubBlocks(void* cvode_mem, int nsub);
+
 /* Optional output functions */
 
 SUNDIALS_DEPRECATED_EXPORT_MSG(
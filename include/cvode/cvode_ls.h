@@ -85,6 +85,9 @@ SUNDIALS_EXPORT int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS,
 
 SUNDIALS_EXPORT int CVodeSetJacFn(void* cvode_mem, CVLsJacFn jac);
 SUNDIALS_EXPORT int CVodeSetJacEvalFrequency(void* cvode_mem, long int msbj);
+SUNDIALS_EXPORT int CVodeSetAdaptiveJacEval(void* cvode_mem,
+                                            sunbooleantype onoff);
+SUNDIALS_EXPORT int CVodeSetDQJacNumThreads(void* cvode_mem, int nthreads);
 SUNDIALS_EXPORT int CVodeSetLinearSolutionScaling(void* cvode_mem,
                                                   sunbooleantype onoff);
 SUNDIALS_EXPORT int CVodeSetDeltaGammaMaxBadJac(void* cvode_mem,
@@ -96,6 +99,7 @@ SUNDIALS_EXPORT int CVodeSetPreconditioner(void* cvode_mem, CVLsPrecSetupFn pset
 SUNDIALS_EXPORT int CVodeSetJacTimes(void* cvode_mem, CVLsJacTimesSetupFn jtsetup,
                                      CVLsJacTimesVecFn jtimes);
 SUNDIALS_EXPORT int CVodeSetLinSysFn(void* cvode_mem, CVLsLinSysFn linsys);
+SUNDIALS_EXPORT int CVodeSetMaxBroydenUpdates(void* cvode_mem, int maxupd);
 
 /*-----------------------------------------------------------------
   Optional outputs from the CVLS linear solver interface
@@ -108,6 +112,8 @@ SUNDIALS_DEPRECATED_EXPORT_MSG(
   "Work space functions will be removed in version 8.0.0")
 int CVodeGetLinWorkSpace(void* cvode_mem, long int* lenrwLS, long int* leniwLS);
 SUNDIALS_EXPORT int CVodeGetNumJacEvals(void* cvode_mem, long int* njevals);
+SUNDIALS_EXPORT int CVodeGetNumBroydenUpdates(void* cvode_mem,
+                                              long int* nbroy);
 SUNDIALS_EXPORT int CVodeGetNumPrecEvals(void* cvode_mem, long int* npevals);
 SUNDIALS_EXPORT int CVodeGetNumPrecSolves(void* cvode_mem, long int* npsolves);
 SUNDIALS_EXPORT int CVodeGetNumLinIters(void* cvode_mem, long int* nliters);
@@ -191,6 +191,8 @@ SUNDIALS_EXPORT int CVodeWFtolerances(void* cvode_mem, CVEwtFn efun);
 /* Optional input functions */
 
 SUNDIALS_EXPORT int CVodeSetConstraints(void* cvode_mem, N_Vector constraints);
+SUNDIALS_EXPORT int CVodeSetContiguousHistory(void* cvode_mem,
+                                              sunbooleantype contiguous);
 SUNDIALS_EXPORT int CVodeSetDeltaGammaMaxLSetup(void* cvode_mem,
                                                 sunrealtype dgmax_lsetup);
 SUNDIALS_EXPORT int CVodeSetInitStep(void* cvode_mem, sunrealtype hin);
@@ -210,6 +212,7 @@ SUNDIALS_EXPORT int CVodeSetNonlinConvCoef(void* cvode_mem, sunrealtype nlscoef)
 SUNDIALS_EXPORT int CVodeSetNonlinearSolver(void* cvode_mem,
                                             SUNNonlinearSolver NLS);
 SUNDIALS_EXPORT int CVodeSetStabLimDet(void* cvode_mem, sunbooleantype stldet);
+SUNDIALS_EXPORT int CVodeSetStepTrace(void* cvode_mem, SUNStepTrace trace);
 SUNDIALS_EXPORT int CVodeSetStopTime(void* cvode_mem, sunrealtype tstop);
 SUNDIALS_EXPORT int CVodeSetInterpolateStopTime(void* cvode_mem,
                                                 sunbooleantype interp);
@@ -93,6 +93,9 @@ SUNDIALS_EXPORT int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS,
 
 SUNDIALS_EXPORT int CVodeSetJacFn(void* cvode_mem, CVLsJacFn jac);
 SUNDIALS_EXPORT int CVodeSetJacEvalFrequency(void* cvode_mem, long int msbj);
+SUNDIALS_EXPORT int CVodeSetAdaptiveJacEval(void* cvode_mem,
+                                            sunbooleantype onoff);
+SUNDIALS_EXPORT int CVodeSetDQJacNumThreads(void* cvode_mem, int nthreads);
 SUNDIALS_EXPORT int CVodeSetLinearSolutionScaling(void* cvode_mem,
                                                   sunbooleantype onoff);
 SUNDIALS_EXPORT int CVodeSetDeltaGammaMaxBadJac(void* cvode_mem,
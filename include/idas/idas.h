@@ -189,12 +189,14 @@ SUNDIALS_EXPORT int IDASetMaxBacksIC(void* ida_mem, int maxbacks);
 
 /* Optional input functions */
 SUNDIALS_EXPORT int IDASetDeltaCjLSetup(void* ida_max, sunrealtype dcj);
+SUNDIALS_EXPORT int IDASetAdaptiveJacEval(void* ida_mem, sunbooleantype onoff);
 SUNDIALS_EXPORT int IDASetUserData(void* ida_mem, void* user_data);
 SUNDIALS_EXPORT int IDASetMaxOrd(void* ida_mem, int maxord);
 SUNDIALS_EXPORT int IDASetMaxNumSteps(void* ida_mem, long int mxsteps);
 SUNDIALS_EXPORT int IDASetInitStep(void* ida_mem, sunrealtype hin);
 SUNDIALS_EXPORT int IDASetMaxStep(void* ida_mem, sunrealtype hmax);
 SUNDIALS_EXPORT int IDASetMinStep(void* ida_mem, sunrealtype hmin);
+SUNDIALS_EXPORT int IDASetStepTrace(void* ida_mem, SUNStepTrace trace);
 SUNDIALS_EXPORT int IDASetStopTime(void* ida_mem, sunrealtype tstop);
 SUNDIALS_EXPORT int IDAClearStopTime(void* ida_mem);
 SUNDIALS_EXPORT int IDASetMaxErrTestFails(void* ida_mem, int maxnef);
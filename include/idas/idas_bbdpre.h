@@ -49,6 +49,8 @@ SUNDIALS_EXPORT int IDABBDPrecInit(void* ida_mem, sunindextype Nlocal,
 SUNDIALS_EXPORT int IDABBDPrecReInit(void* ida_mem, sunindextype mudq,
                                      sunindextype mldq, sunrealtype dq_rel_yy);
 
+SUNDIALS_EXPORT int IDABBDPrecSetNumSubBlocks(void* ida_mem, int nsub);
+
 /* Optional output functions */
 
 SUNDIALS_DEPRECATED_EXPORT_MSG(
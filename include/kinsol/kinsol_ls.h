@@ -75,6 +75,8 @@ SUNDIALS_EXPORT int KINSetJacFn(void* kinmem, KINLsJacFn jac);
 SUNDIALS_EXPORT int KINSetPreconditioner(void* kinmem, KINLsPrecSetupFn psetup,
                                          KINLsPrecSolveFn psolve);
 SUNDIALS_EXPORT int KINSetJacTimesVecFn(void* kinmem, KINLsJacTimesVecFn jtv);
+SUNDIALS_EXPORT int KINSetMaxBroydenUpdates(void* kinmem, int maxupd);
+SUNDIALS_EXPORT int KINSetDQJacNumThreads(void* kinmem, int nthreads);
 
 /*-----------------------------------------------------------------
   Optional outputs from the KINLS linear solver interface
@@ -86,6 +88,7 @@ SUNDIALS_DEPRECATED_EXPORT_MSG(
   "Work space functions will be removed in version 8.0.0")
 int KINGetLinWorkSpace(void* kinmem, long int* lenrwLS, long int* leniwLS);
 SUNDIALS_EXPORT int KINGetNumJacEvals(void* kinmem, long int* njevals);
+SUNDIALS_EXPORT int KINGetNumBroydenUpdates(void* kinmem, long int* nbroy);
 SUNDIALS_EXPORT int KINGetNumLinFuncEvals(void* kinmem, long int* nfevals);
 SUNDIALS_EXPORT int KINGetNumPrecEvals(void* kinmem, long int* npevals);
 SUNDIALS_EXPORT int KINGetNumPrecSolves(void* kinmem, long int* npsolves);
@@ -57,6 +57,7 @@ struct _N_VectorContent_MPIManyVector
   sunindextype global_length;  /* overall global manyvector length */
   N_Vector* subvec_array;      /* pointer to N_Vector array        */
   sunbooleantype own_data;     /* flag indicating data ownership   */
+  int num_threads;             /* threads for subvector operations */
 };
 
 typedef struct _N_VectorContent_MPIManyVector* N_VectorContent_MPIManyVector;
@@ -88,6 +89,9 @@ SUNErrCode N_VSetSubvectorArrayPointer_MPIManyVector(sunrealtype* v_data,
 SUNDIALS_EXPORT
 sunindextype N_VGetNumSubvectors_MPIManyVector(N_Vector v);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VSetNumThreads_MPIManyVector(N_Vector v, int num_threads);
+
 /* standard vector operations */
 SUNDIALS_EXPORT
 N_Vector_ID N_VGetVectorID_MPIManyVector(N_Vector v);
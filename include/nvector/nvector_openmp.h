@@ -57,10 +57,11 @@ extern "C" {
 
 struct _N_VectorContent_OpenMP
 {
-  sunindextype length;     /* vector length            */
-  sunbooleantype own_data; /* data ownership flag      */
-  sunrealtype* data;       /* data array               */
-  int num_threads;         /* number of OpenMP threads */
+  sunindextype length;        /* vector length                  */
+  sunbooleantype own_data;    /* data ownership flag            */
+  sunrealtype* data;          /* data array                     */
+  int num_threads;            /* number of OpenMP threads       */
+  sunbooleantype first_touch; /* first-touch the data of clones */
 };
 
 typedef struct _N_VectorContent_OpenMP* N_VectorContent_OpenMP;
@@ -68,7 +69,7 @@ typedef struct _N_VectorContent_OpenMP* N_VectorContent_OpenMP;
 /*
  * -----------------------------------------------------------------
  * Macros NV_CONTENT_OMP, NV_DATA_OMP, NV_OWN_DATA_OMP,
- *        NV_LENGTH_OMP, and NV_Ith_OMP
+ *        NV_LENGTH_OMP, NV_FIRST_TOUCH_OMP, and NV_Ith_OMP
  * -----------------------------------------------------------------
  */
 
@@ -82,6 +83,8 @@ typedef struct _N_VectorContent_OpenMP* N_VectorContent_OpenMP;
 
 #define NV_DATA_OMP(v) (NV_CONTENT_OMP(v)->data)
 
+#define NV_FIRST_TOUCH_OMP(v) (NV_CONTENT_OMP(v)->first_touch)
+
 #define NV_Ith_OMP(v, i) (NV_DATA_OMP(v)[i])
 
 /*
@@ -102,6 +105,13 @@ SUNDIALS_EXPORT
 N_Vector N_VMake_OpenMP(sunindextype vec_length, sunrealtype* v_data,
                         int num_threads, SUNContext sunctx);
 
+SUNDIALS_EXPORT
+N_Vector N_VNewFirstTouch_OpenMP(sunindextype vec_length, int num_threads,
+                                 SUNContext sunctx);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VSetFirstTouch_OpenMP(N_Vector v, sunbooleantype onoff);
+
 SUNDIALS_EXPORT
 sunindextype N_VGetLength_OpenMP(N_Vector v);
 
@@ -206,6 +216,14 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_OpenMP(int nvec, N_Vector x, N_Vector* Y,
                                   sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VProjectSubtract_OpenMP(int nvec, N_Vector x, N_Vector* Y,
+                                     sunrealtype* dotprods,
+                                     sunrealtype* sqrnorms);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VPascalUpdate_OpenMP(int nvec, sunrealtype c, N_Vector* Z);
+
 /* vector array operations */
 
 SUNDIALS_EXPORT
@@ -272,6 +290,12 @@ SUNErrCode N_VEnableScaleAddMulti_OpenMP(N_Vector v, sunbooleantype tf);
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableDotProdMulti_OpenMP(N_Vector v, sunbooleantype tf);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableProjectSubtract_OpenMP(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnablePascalUpdate_OpenMP(N_Vector v, sunbooleantype tf);
+
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearSumVectorArray_OpenMP(N_Vector v, sunbooleantype tf);
 
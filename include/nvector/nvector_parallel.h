@@ -214,6 +214,14 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_Parallel(int nvec, N_Vector x, N_Vector* Y,
                                     sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VProjectSubtract_Parallel(int nvec, N_Vector x, N_Vector* Y,
+                                       sunrealtype* dotprods,
+                                       sunrealtype* sqrnorms);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VPascalUpdate_Parallel(int nvec, sunrealtype c, N_Vector* Z);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray_Parallel(int nvec, sunrealtype a,
@@ -308,6 +316,12 @@ SUNErrCode N_VEnableScaleAddMulti_Parallel(N_Vector v, sunbooleantype tf);
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableDotProdMulti_Parallel(N_Vector v, sunbooleantype tf);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableProjectSubtract_Parallel(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnablePascalUpdate_Parallel(N_Vector v, sunbooleantype tf);
+
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearSumVectorArray_Parallel(N_Vector v, sunbooleantype tf);
 
@@ -239,6 +239,8 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
 SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
                                     sunrealtype* dotprods);
+SUNDIALS_EXPORT
+SUNErrCode N_VPascalUpdate_Pthreads(int nvec, sunrealtype c, N_Vector* Z);
 
 /* vector array operations */
 SUNDIALS_EXPORT
@@ -301,6 +303,9 @@ SUNErrCode N_VEnableScaleAddMulti_Pthreads(N_Vector v, sunbooleantype tf);
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableDotProdMulti_Pthreads(N_Vector v, sunbooleantype tf);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VEnablePascalUpdate_Pthreads(N_Vector v, sunbooleantype tf);
+
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearSumVectorArray_Pthreads(N_Vector v, sunbooleantype tf);
 
@@ -192,6 +192,13 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
 SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_Serial(int nvec, N_Vector x, N_Vector* Y,
                                   sunrealtype* dotprods);
+SUNDIALS_EXPORT
+SUNErrCode N_VProjectSubtract_Serial(int nvec, N_Vector x, N_Vector* Y,
+                                     sunrealtype* dotprods,
+                                     sunrealtype* sqrnorms);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VPascalUpdate_Serial(int nvec, sunrealtype c, N_Vector* Z);
 
 /* vector array operations */
 SUNDIALS_EXPORT
@@ -259,6 +266,12 @@ SUNErrCode N_VEnableScaleAddMulti_Serial(N_Vector v, sunbooleantype tf);
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableDotProdMulti_Serial(N_Vector v, sunbooleantype tf);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableProjectSubtract_Serial(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnablePascalUpdate_Serial(N_Vector v, sunbooleantype tf);
+
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearSumVectorArray_Serial(N_Vector v, sunbooleantype tf);
 
@@ -28,6 +28,31 @@
 extern "C" {
 #endif
 
+struct _generic_N_Vector;
+struct _generic_N_Vector_Ops;
+
+/* Frees a pooled vector without returning it to the pool */
+typedef void (*SUNVectorPoolFreeFn)(struct _generic_N_Vector* v);
+
+/* A destroyed vector kept by the context for reuse */
+struct SUNVectorPoolEntry_
+{
+  struct _generic_N_Vector* v; /* pooled vector                   */
+  int id;                      /* vector ID of the implementation */
+  sunindextype length;         /* vector length                   */
+  SUNVectorPoolFreeFn free_fn; /* frees the vector                */
+};
+
+/* A vector operations table shared by several vectors */
+struct SUNVectorOpsEntry_
+{
+  struct _generic_N_Vector_Ops* ops; /* shared table               */
+  long int refcount;                 /* number of vectors using it */
+};
+
+/* A block of the object arena */
+struct SUNArenaBlock_;
+
 struct SUNContext_
 {
   SUNProfiler profiler;
@@ -37,8 +62,132 @@ struct SUNContext_
   SUNErrCode last_err;
   SUNErrHandler err_handler;
   SUNComm comm;
+
+  /* Vector pool (destroyed vectors reused by N_VClone) */
+  sunbooleantype vpool_enabled;      /* is the pool used?               */
+  struct SUNVectorPoolEntry_* vpool; /* pooled vectors, oldest first    */
+  long int vpool_size;               /* number of pooled vectors        */
+  long int vpool_capacity;           /* allocated length of vpool       */
+  long int vpool_nhits;              /* clones served from the pool     */
+  long int vpool_nmisses;            /* clones not served from the pool */
+  long int vpool_high_water;         /* max number of pooled vectors    */
+
+  /* Object arena (object headers, ops tables, and small content structs) */
+  sunbooleantype arena_enabled; /* allocate new objects in the arena? */
+  struct SUNArenaBlock_* arena; /* arena blocks, current block first  */
+  long int arena_nblocks;       /* number of arena blocks             */
+  long int arena_nlive;         /* live allocations in the arena      */
+  long int arena_nbytes;        /* bytes allocated from the arena     */
+
+  /* Shared vector operations tables */
+  sunbooleantype vops_enabled;    /* share vector operations tables? */
+  struct SUNVectorOpsEntry_* vops; /* shared tables                   */
+  long int vops_size;             /* number of shared tables         */
+  long int vops_capacity;         /* allocated length of vops        */
 };
 
+/*
+  This function returns a shared vector operations table with the same
+  operations as the given table and increments its reference count. A new
+  shared table is created if none of the shared tables match.
+
+  :param sunctx: the SUNContext object
+  :param ops: the operations table
+
+  :return: the shared table, or NULL if sharing is disabled or the allocation
+    of a new table failed
+*/
+SUNDIALS_EXPORT
+struct _generic_N_Vector_Ops* SUNContext_AcquireVectorOps(
+  SUNContext sunctx, struct _generic_N_Vector_Ops* ops);
+
+/*
+  This function decrements the reference count of a shared vector operations
+  table and frees the table when it is no longer used.
+
+  :param sunctx: the SUNContext object (may be NULL)
+  :param ops: the operations table
+
+  :return: SUNTRUE if ops is a shared table, SUNFALSE otherwise (the caller
+    owns the table)
+*/
+SUNDIALS_EXPORT
+sunbooleantype SUNContext_ReleaseVectorOps(SUNContext sunctx,
+                                           struct _generic_N_Vector_Ops* ops);
+
+/*
+  This function checks if a vector operations table is shared.
+
+  :param sunctx: the SUNContext object (may be NULL)
+  :param ops: the operations table
+
+  :return: SUNTRUE if ops is a shared table, SUNFALSE otherwise
+*/
+SUNDIALS_EXPORT
+sunbooleantype SUNContext_IsSharedVectorOps(SUNContext sunctx,
+                                            struct _generic_N_Vector_Ops* ops);
+
+/*
+  This function allocates memory for a SUNDIALS object header, ops table, or
+  content structure. If the object arena of the context is enabled, small
+  requests are served from the arena, otherwise the memory is allocated with
+  malloc.
+
+  :param sunctx: the SUNContext object (may be NULL)
+  :param size: the number of bytes to allocate
+
+  :return: a pointer to the memory or NULL if the allocation failed
+*/
+SUNDIALS_EXPORT
+void* SUNContext_ArenaAlloc(SUNContext sunctx, size_t size);
+
+/*
+  This function releases memory obtained from SUNContext_ArenaAlloc or malloc.
+  Memory in the object arena is released in bulk when all arena allocations
+  have been released or when the context is freed, any other memory is freed
+  immediately.
+
+  :param sunctx: the SUNContext object (may be NULL)
+  :param ptr: the memory to release (may be NULL)
+*/
+SUNDIALS_EXPORT
+void SUNContext_ArenaFree(SUNContext sunctx, void* ptr);
+
+/*
+  This function removes a vector with the given vector ID and length from the
+  vector pool of the context. Vector implementations call it when cloning a
+  vector.
+
+  :param sunctx: the SUNContext object
+  :param id: the vector ID of the implementation
+  :param length: the vector length
+
+  :return: the pooled vector, or NULL if the pool is disabled or holds no
+    matching vector
+*/
+SUNDIALS_EXPORT
+struct _generic_N_Vector* SUNContext_TakePooledVector(SUNContext sunctx, int id,
+                                                      sunindextype length);
+
+/*
+  This function adds a vector to the vector pool of the context. Vector
+  implementations call it when destroying a vector that owns its data and
+  free the vector themselves if it is not pooled.
+
+  :param sunctx: the SUNContext object
+  :param v: the vector
+  :param id: the vector ID of the implementation
+  :param length: the vector length
+  :param free_fn: the function freeing the vector when the pool is trimmed
+
+  :return: SUNTRUE if the vector was pooled, SUNFALSE otherwise
+*/
+SUNDIALS_EXPORT
+sunbooleantype SUNContext_PoolVector(SUNContext sunctx,
+                                     struct _generic_N_Vector* v, int id,
+                                     sunindextype length,
+                                     SUNVectorPoolFreeFn free_fn);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,71 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * !!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * This is a 'private' header file and should not be used in user
+ * code. It is subject to change without warning.
+ * !!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * -----------------------------------------------------------------
+ * Private helpers for N_Vector implementations that share their
+ * operations tables (see SUNContext_SetSharedVectorOps). A shared
+ * table is immutable, an implementation that modifies the table of
+ * a vector must call N_VUnshareOps before and may call N_VShareOps
+ * after the modification.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_NVECTOR_IMPL_H
+#define _SUNDIALS_NVECTOR_IMPL_H
+
+#include <sundials/sundials_nvector.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/*
+  This function creates an empty vector with the same operations as w. The
+  new vector uses a shared operations table if sharing is enabled and a copy
+  of the operations of w otherwise.
+
+  :param w: the template vector
+
+  :return: the new vector, or NULL if an allocation failed
+*/
+SUNDIALS_EXPORT
+N_Vector N_VNewEmptyWithOps(N_Vector w);
+
+/*
+  This function replaces the operations table of v with the equivalent shared
+  table if sharing is enabled. Otherwise the table is not changed.
+
+  :param v: the vector
+
+  :return: a SUNErrCode
+*/
+SUNDIALS_EXPORT
+SUNErrCode N_VShareOps(N_Vector v);
+
+/*
+  This function replaces a shared operations table of v with a private copy
+  that may be modified. Otherwise the table is not changed.
+
+  :param v: the vector
+
+  :return: a SUNErrCode
+*/
+SUNDIALS_EXPORT
+SUNErrCode N_VUnshareOps(N_Vector v);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -109,6 +109,23 @@ SUNDIALS_EXPORT
 void SUNDlsMat_bandGBTRS(sunrealtype** a, sunindextype n, sunindextype smu,
                          sunindextype ml, sunindextype* p, sunrealtype* b);
 
+/*
+ * -----------------------------------------------------------------
+ * Function: SUNDlsMat_bandGBTRSMultiple
+ * -----------------------------------------------------------------
+ * SUNDlsMat_bandGBTRSMultiple solves the nrhs N-dimensional systems
+ * A x_j = b_j, j = 0,...,nrhs-1, using the LU factorization and
+ * pivots computed by SUNDlsMat_bandGBTRF. Each column of the band
+ * factors is applied to all right-hand sides before moving to the
+ * next column. The solutions are returned in b.
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+void SUNDlsMat_bandGBTRSMultiple(sunrealtype** a, sunindextype n,
+                                 sunindextype smu, sunindextype ml,
+                                 sunindextype* p, int nrhs, sunrealtype** b);
+
 /*
  * -----------------------------------------------------------------
  * Function: SUNDlsMat_BandCopy
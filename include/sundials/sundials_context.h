@@ -56,6 +56,32 @@ SUNErrCode SUNContext_GetLogger(SUNContext sunctx, SUNLogger* logger);
 SUNDIALS_EXPORT
 SUNErrCode SUNContext_SetLogger(SUNContext sunctx, SUNLogger logger);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_SetVectorPool(SUNContext sunctx, sunbooleantype onoff);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_TrimVectorPool(SUNContext sunctx, long int max_pooled);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_GetVectorPoolStats(SUNContext sunctx, long int* nhits,
+                                         long int* nmisses, long int* npooled,
+                                         long int* high_water);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_SetArena(SUNContext sunctx, sunbooleantype onoff);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_GetArenaStats(SUNContext sunctx, long int* nblocks,
+                                    long int* nlive, long int* nbytes);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_SetSharedVectorOps(SUNContext sunctx,
+                                         sunbooleantype onoff);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_GetNumSharedVectorOps(SUNContext sunctx,
+                                            long int* ntables);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNContext_Free(SUNContext* ctx);
 
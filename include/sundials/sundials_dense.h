@@ -83,6 +83,22 @@ SUNDIALS_EXPORT
 void SUNDlsMat_denseGETRS(sunrealtype** a, sunindextype n, sunindextype* p,
                           sunrealtype* b);
 
+/*
+ * ----------------------------------------------------------------------------
+ * Function : SUNDlsMat_denseGETRSMultiple
+ * ----------------------------------------------------------------------------
+ * SUNDlsMat_denseGETRSMultiple solves the nrhs N-dimensional systems
+ * A x_j = b_j, j = 0,...,nrhs-1, using the LU factorization and pivots computed
+ * by SUNDlsMat_denseGETRF. Each column of the factors is applied to all of the
+ * right-hand sides before moving to the next column so the factors are read
+ * from memory once rather than nrhs times. The solutions are returned in b.
+ * ----------------------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+void SUNDlsMat_denseGETRSMultiple(sunrealtype** a, sunindextype n,
+                                  sunindextype* p, int nrhs, sunrealtype** b);
+
 /*
  * ----------------------------------------------------------------------------
  * Functions : SUNDlsMat_DensePOTRF and SUNDlsMat_DensePOTRS
@@ -96,6 +96,8 @@ typedef enum
   SUNLINEARSOLVER_ONEMKLDENSE,
   SUNLINEARSOLVER_GINKGO,
   SUNLINEARSOLVER_KOKKOSDENSE,
+  SUNLINEARSOLVER_MIXEDPREC,
+  SUNLINEARSOLVER_BLOCKTRIDIAG,
   SUNLINEARSOLVER_CUSTOM
 } SUNLinearSolver_ID;
 
@@ -122,6 +124,8 @@ struct _generic_SUNLinearSolver_Ops
   SUNErrCode (*initialize)(SUNLinearSolver);
   int (*setup)(SUNLinearSolver, SUNMatrix);
   int (*solve)(SUNLinearSolver, SUNMatrix, N_Vector, N_Vector, sunrealtype);
+  int (*solvemultiple)(SUNLinearSolver, SUNMatrix, int, N_Vector*, N_Vector*,
+                       sunrealtype);
   int (*numiters)(SUNLinearSolver);
   sunrealtype (*resnorm)(SUNLinearSolver);
   sunindextype (*lastflag)(SUNLinearSolver);
@@ -181,6 +185,10 @@ SUNDIALS_EXPORT
 int SUNLinSolSolve(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
                    sunrealtype tol);
 
+SUNDIALS_EXPORT
+int SUNLinSolSolveMultiple(SUNLinearSolver S, SUNMatrix A, int nrhs,
+                           N_Vector* X, N_Vector* B, sunrealtype tol);
+
 /* TODO(CJB): We should consider changing the return type to long int since
  batched solvers could in theory return a very large number here. */
 SUNDIALS_EXPORT
@@ -148,6 +148,9 @@ struct _generic_N_Vector_Ops
   SUNErrCode (*nvscaleaddmulti)(int, sunrealtype*, N_Vector, N_Vector*,
                                 N_Vector*);
   SUNErrCode (*nvdotprodmulti)(int, N_Vector, N_Vector*, sunrealtype*);
+  SUNErrCode (*nvprojectsubtract)(int, N_Vector, N_Vector*, sunrealtype*,
+                                  sunrealtype*);
+  SUNErrCode (*nvpascalupdate)(int, sunrealtype, N_Vector*);
 
   /* OPTIONAL vector array operations */
   SUNErrCode (*nvlinearsumvectorarray)(int, sunrealtype, N_Vector*, sunrealtype,
@@ -266,6 +269,13 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti(int nvec, N_Vector x, N_Vector* Y,
                            sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VProjectSubtract(int nvec, N_Vector x, N_Vector* Y,
+                              sunrealtype* dotprods, sunrealtype* sqrnorms);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VPascalUpdate(int nvec, sunrealtype c, N_Vector* Z);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray(int nvec, sunrealtype a, N_Vector* X,
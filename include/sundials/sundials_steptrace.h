@@ -0,0 +1,102 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNDIALS step trace class. A step trace records one fixed-size
+ * entry per step attempt of an integrator (time, step size, error
+ * estimate, order, status, and solver work) into preallocated
+ * column arrays.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_STEPTRACE_H
+#define _SUNDIALS_STEPTRACE_H
+
+#include <stdio.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Outcome of a step attempt */
+typedef enum
+{
+  SUN_STEPTRACE_SUCCESS,      /* the step attempt was accepted           */
+  SUN_STEPTRACE_ERRTEST_FAIL, /* the step attempt failed the error test  */
+  SUN_STEPTRACE_SOLVE_FAIL,   /* the nonlinear or stage solve failed     */
+  SUN_STEPTRACE_OTHER_FAIL    /* projection, constraints, etc. failed    */
+} SUNStepTraceStatus;
+
+/* Columns of the trace, the first SUN_STEPTRACE_NUM_REAL_FIELDS are
+   stored as sunrealtype and the remaining fields as long int */
+typedef enum
+{
+  SUN_STEPTRACE_TIME,      /* time at the start of the attempt        */
+  SUN_STEPTRACE_STEPSIZE,  /* step size of the attempt                */
+  SUN_STEPTRACE_ERROR,     /* local error estimate (zero if not set)  */
+  SUN_STEPTRACE_ORDER,     /* method order of the attempt             */
+  SUN_STEPTRACE_STATUS,    /* SUNStepTraceStatus of the attempt       */
+  SUN_STEPTRACE_NLS_ITERS, /* nonlinear iterations in the attempt     */
+  SUN_STEPTRACE_LS_ITERS,  /* linear iterations in the attempt        */
+  SUN_STEPTRACE_JAC_EVALS, /* Jacobian evaluations in the attempt     */
+  SUN_STEPTRACE_LS_SETUPS  /* linear solver setups in the attempt     */
+} SUNStepTraceField;
+
+#define SUN_STEPTRACE_NUM_REAL_FIELDS 3
+#define SUN_STEPTRACE_NUM_FIELDS      9
+
+typedef _SUNDIALS_STRUCT_ SUNStepTrace_* SUNStepTrace;
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_Create(long int capacity, SUNContext sunctx,
+                               SUNStepTrace* trace);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_Destroy(SUNStepTrace* trace);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_BeginStep(SUNStepTrace trace, sunrealtype t,
+                                  sunrealtype h, int order, long int nni,
+                                  long int nli, long int nje, long int nsetups);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_EndStep(SUNStepTrace trace, SUNStepTraceStatus status,
+                                sunrealtype dsm, long int nni, long int nli,
+                                long int nje, long int nsetups);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_GetNumRecords(SUNStepTrace trace, long int* num_records);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_GetNumDropped(SUNStepTrace trace, long int* num_dropped);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_GetRealField(SUNStepTrace trace, SUNStepTraceField field,
+                                     sunrealtype** values);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_GetLongField(SUNStepTrace trace, SUNStepTraceField field,
+                                     long int** values);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_Write(SUNStepTrace trace, FILE* outfile,
+                              SUNOutputFormat fmt);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_WriteBinary(SUNStepTrace trace, FILE* outfile);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepTrace_Reset(SUNStepTrace trace);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SUNDIALS_STEPTRACE_H */
@@ -0,0 +1,87 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the block-tridiagonal implementation
+ * of the SUNLINSOL module, SUNLINSOL_BLOCKTRIDIAG.
+ *
+ * Note:
+ *   - The definition of the generic SUNLinearSolver structure can
+ *     be found in the header file sundials_linearsolver.h.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _SUNLINSOL_BLOCKTRIDIAG_H
+#define _SUNLINSOL_BLOCKTRIDIAG_H
+
+#include <sundials/sundials_dense.h>
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+#include <sunmatrix/sunmatrix_blocktridiag.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* ---------------------------------------------------
+ * Block-tridiagonal Implementation of SUNLinearSolver
+ * --------------------------------------------------- */
+
+struct _SUNLinearSolverContent_BlockTridiag
+{
+  sunindextype N;
+  sunindextype nblocks;
+  sunindextype blocksize;
+  sunindextype* pivots;
+  sunrealtype** cols;
+  sunrealtype** rhs;
+  sunindextype last_flag;
+};
+
+typedef struct _SUNLinearSolverContent_BlockTridiag*
+  SUNLinearSolverContent_BlockTridiag;
+
+/* ----------------------------------------------
+ * Exported Functions for SUNLINSOL_BLOCKTRIDIAG
+ * ---------------------------------------------- */
+
+SUNDIALS_EXPORT
+SUNLinearSolver SUNLinSol_BlockTridiag(N_Vector y, SUNMatrix A,
+                                       SUNContext sunctx);
+
+SUNDIALS_EXPORT
+SUNLinearSolver_Type SUNLinSolGetType_BlockTridiag(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNLinearSolver_ID SUNLinSolGetID_BlockTridiag(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSolInitialize_BlockTridiag(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+int SUNLinSolSetup_BlockTridiag(SUNLinearSolver S, SUNMatrix A);
+
+SUNDIALS_EXPORT
+int SUNLinSolSolve_BlockTridiag(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                                N_Vector b, sunrealtype tol);
+
+SUNDIALS_EXPORT
+sunindextype SUNLinSolLastFlag_BlockTridiag(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSolFree_BlockTridiag(SUNLinearSolver S);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -75,6 +75,10 @@ SUNDIALS_EXPORT
 int SUNLinSolSolve_Dense(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
                          sunrealtype tol);
 
+SUNDIALS_EXPORT
+int SUNLinSolSolveMultiple_Dense(SUNLinearSolver S, SUNMatrix A, int nrhs,
+                                 N_Vector* X, N_Vector* B, sunrealtype tol);
+
 SUNDIALS_EXPORT
 sunindextype SUNLinSolLastFlag_Dense(SUNLinearSolver S);
 
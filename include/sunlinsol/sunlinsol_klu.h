@@ -101,6 +101,8 @@ struct _SUNLinearSolverContent_KLU
   sun_klu_numeric* numeric;
   sun_klu_common common;
   KLUSolveFn klu_solver;
+  sunrealtype* rhs; /* workspace for multiple right-hand sides */
+  sunindextype rhs_length;
 };
 
 typedef struct _SUNLinearSolverContent_KLU* SUNLinearSolverContent_KLU;
@@ -134,6 +136,9 @@ SUNDIALS_EXPORT SUNErrCode SUNLinSolInitialize_KLU(SUNLinearSolver S);
 SUNDIALS_EXPORT int SUNLinSolSetup_KLU(SUNLinearSolver S, SUNMatrix A);
 SUNDIALS_EXPORT int SUNLinSolSolve_KLU(SUNLinearSolver S, SUNMatrix A,
                                        N_Vector x, N_Vector b, sunrealtype tol);
+SUNDIALS_EXPORT int SUNLinSolSolveMultiple_KLU(SUNLinearSolver S, SUNMatrix A,
+                                               int nrhs, N_Vector* X,
+                                               N_Vector* B, sunrealtype tol);
 SUNDIALS_EXPORT sunindextype SUNLinSolLastFlag_KLU(SUNLinearSolver S);
 SUNDIALS_DEPRECATED_EXPORT_MSG(
   "Work space functions will be removed in version 8.0.0")
@@ -42,6 +42,8 @@ struct _SUNLinearSolverContent_LapackDense
   sunindextype N;
   sunindextype* pivots;
   sunindextype last_flag;
+  sunrealtype* rhs; /* workspace for multiple right-hand sides */
+  sunindextype rhs_length;
 };
 
 typedef struct _SUNLinearSolverContent_LapackDense* SUNLinearSolverContent_LapackDense;
@@ -59,6 +61,9 @@ SUNDIALS_EXPORT int SUNLinSolSetup_LapackDense(SUNLinearSolver S, SUNMatrix A);
 SUNDIALS_EXPORT int SUNLinSolSolve_LapackDense(SUNLinearSolver S, SUNMatrix A,
                                                N_Vector x, N_Vector b,
                                                sunrealtype tol);
+SUNDIALS_EXPORT int SUNLinSolSolveMultiple_LapackDense(
+  SUNLinearSolver S, SUNMatrix A, int nrhs, N_Vector* X, N_Vector* B,
+  sunrealtype tol);
 SUNDIALS_EXPORT sunindextype SUNLinSolLastFlag_LapackDense(SUNLinearSolver S);
 SUNDIALS_DEPRECATED_EXPORT_MSG(
   "Work space functions will be removed in version 8.0.0")
@@ -0,0 +1,107 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the mixed-precision dense/band
+ * implementation of the SUNLINSOL module, SUNLINSOL_MIXEDPREC.
+ *
+ * The solver copies a dense or band SUNMatrix into single
+ * precision, computes its LU factorization in single precision,
+ * and recovers the accuracy of sunrealtype in the solve through
+ * iterative refinement using the original matrix.
+ *
+ * Notes:
+ *   - The definition of the generic SUNLinearSolver structure can
+ *     be found in the header file sundials_linearsolver.h.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _SUNLINSOL_MIXEDPREC_H
+#define _SUNLINSOL_MIXEDPREC_H
+
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+#include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_dense.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Default maximum number of iterative refinement steps */
+#define SUNMIXEDPREC_MAXITERS_DEFAULT 10
+
+/* ---------------------------------------------------
+ * Mixed-Precision Implementation of SUNLinearSolver
+ * --------------------------------------------------- */
+
+struct _SUNLinearSolverContent_MixedPrec
+{
+  SUNMatrix_ID matid;   /* ID of the matrix being factored     */
+  sunindextype N;       /* matrix size                         */
+  sunindextype ldim;    /* leading dimension of the factors    */
+  sunindextype mu;      /* upper bandwidth (band only)         */
+  sunindextype ml;      /* lower bandwidth (band only)         */
+  sunindextype smu;     /* storage upper bandwidth (band only) */
+  float* data;          /* single precision LU factors         */
+  float** cols;         /* column pointers into data           */
+  float* work;          /* single precision correction         */
+  sunindextype* pivots; /* pivot array                         */
+  N_Vector res;         /* residual vector                     */
+  N_Vector rhs;         /* copy of b when solving in place     */
+  int max_iters;        /* maximum refinement steps            */
+  int num_iters;        /* refinement steps in the last solve  */
+  sunindextype last_flag;
+};
+
+typedef struct _SUNLinearSolverContent_MixedPrec* SUNLinearSolverContent_MixedPrec;
+
+/* ------------------------------------------
+ * Exported Functions for SUNLINSOL_MIXEDPREC
+ * ------------------------------------------ */
+
+SUNDIALS_EXPORT
+SUNLinearSolver SUNLinSol_MixedPrec(N_Vector y, SUNMatrix A, SUNContext sunctx);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSol_MixedPrecSetMaxIters(SUNLinearSolver S, int max_iters);
+
+SUNDIALS_EXPORT
+SUNLinearSolver_Type SUNLinSolGetType_MixedPrec(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNLinearSolver_ID SUNLinSolGetID_MixedPrec(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSolInitialize_MixedPrec(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+int SUNLinSolSetup_MixedPrec(SUNLinearSolver S, SUNMatrix A);
+
+SUNDIALS_EXPORT
+int SUNLinSolSolve_MixedPrec(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                             N_Vector b, sunrealtype tol);
+
+SUNDIALS_EXPORT
+int SUNLinSolNumIters_MixedPrec(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+sunindextype SUNLinSolLastFlag_MixedPrec(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSolFree_MixedPrec(SUNLinearSolver S);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
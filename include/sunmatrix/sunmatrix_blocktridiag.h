@@ -0,0 +1,128 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the block-tridiagonal implementation
+ * of the SUNMATRIX module, SUNMATRIX_BLOCKTRIDIAG.
+ *
+ * Notes:
+ *   - The definition of the generic SUNMatrix structure can be found
+ *     in the header file sundials_matrix.h.
+ *   - The matrix has nblocks x nblocks square blocks of size
+ *     blocksize, of which only the diagonal, sub-diagonal, and
+ *     super-diagonal blocks are stored. Each block is stored
+ *     column-major and the three blocks of a block row are
+ *     contiguous, ordered sub-diagonal, diagonal, super-diagonal.
+ *     The sub-diagonal block of the first block row and the
+ *     super-diagonal block of the last block row are stored but
+ *     are not part of the matrix and are kept zero.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _SUNMATRIX_BLOCKTRIDIAG_H
+#define _SUNMATRIX_BLOCKTRIDIAG_H
+
+#include <stdio.h>
+#include <sundials/sundials_matrix.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* -----------------------------------------------
+ * Block-tridiagonal implementation of SUNMatrix
+ * ----------------------------------------------- */
+
+struct _SUNMatrixContent_BlockTridiag
+{
+  sunindextype N;
+  sunindextype nblocks;
+  sunindextype blocksize;
+  sunrealtype* data;
+  sunindextype ldata;
+  sunrealtype** blocks;
+};
+
+typedef struct _SUNMatrixContent_BlockTridiag* SUNMatrixContent_BlockTridiag;
+
+/* --------------------------------------------
+ * Macros for access to SUNMATRIX_BLOCKTRIDIAG
+ * -------------------------------------------- */
+
+#define SM_CONTENT_BT(A) ((SUNMatrixContent_BlockTridiag)(A->content))
+
+#define SM_ROWS_BT(A) (SM_CONTENT_BT(A)->N)
+
+#define SM_COLUMNS_BT(A) (SM_CONTENT_BT(A)->N)
+
+#define SM_NBLOCKS_BT(A) (SM_CONTENT_BT(A)->nblocks)
+
+#define SM_BLOCKSIZE_BT(A) (SM_CONTENT_BT(A)->blocksize)
+
+#define SM_LDATA_BT(A) (SM_CONTENT_BT(A)->ldata)
+
+#define SM_DATA_BT(A) (SM_CONTENT_BT(A)->data)
+
+#define SM_BLOCKS_BT(A) (SM_CONTENT_BT(A)->blocks)
+
+/* block (I,J) of the matrix, |I - J| <= 1, the blocks of block row I are
+   blocks[3I], blocks[3I+1], and blocks[3I+2] */
+#define SM_BLOCK_BT(A, I, J) ((SM_CONTENT_BT(A)->blocks)[2 * (I) + (J) + 1])
+
+#define SM_BLOCK_ELEMENT_BT(block, i, j, bs) ((block)[(j) * (bs) + (i)])
+
+#define SM_ELEMENT_BT(A, i, j)                                            \
+  SM_BLOCK_ELEMENT_BT(SM_BLOCK_BT(A, (i) / SM_BLOCKSIZE_BT(A),            \
+                                  (j) / SM_BLOCKSIZE_BT(A)),              \
+                      (i) % SM_BLOCKSIZE_BT(A), (j) % SM_BLOCKSIZE_BT(A), \
+                      SM_BLOCKSIZE_BT(A))
+
+/* ------------------------------------------------
+ * Exported Functions for SUNMATRIX_BLOCKTRIDIAG
+ * ------------------------------------------------ */
+
+SUNDIALS_EXPORT SUNMatrix SUNBlockTridiagMatrix(sunindextype nblocks,
+                                                sunindextype blocksize,
+                                                SUNContext sunctx);
+
+SUNDIALS_EXPORT void SUNBlockTridiagMatrix_Print(SUNMatrix A, FILE* outfile);
+
+SUNDIALS_EXPORT sunindextype SUNBlockTridiagMatrix_Rows(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockTridiagMatrix_Columns(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockTridiagMatrix_NumBlocks(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockTridiagMatrix_BlockSize(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockTridiagMatrix_LData(SUNMatrix A);
+SUNDIALS_EXPORT sunrealtype* SUNBlockTridiagMatrix_Data(SUNMatrix A);
+SUNDIALS_EXPORT sunrealtype* SUNBlockTridiagMatrix_Block(SUNMatrix A,
+                                                         sunindextype I,
+                                                         sunindextype J);
+
+SUNDIALS_EXPORT SUNMatrix_ID SUNMatGetID_BlockTridiag(SUNMatrix A);
+SUNDIALS_EXPORT SUNMatrix SUNMatClone_BlockTridiag(SUNMatrix A);
+SUNDIALS_EXPORT void SUNMatDestroy_BlockTridiag(SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatZero_BlockTridiag(SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatCopy_BlockTridiag(SUNMatrix A, SUNMatrix B);
+SUNDIALS_EXPORT SUNErrCode SUNMatScaleAdd_BlockTridiag(sunrealtype c,
+                                                       SUNMatrix A,
+                                                       SUNMatrix B);
+SUNDIALS_EXPORT SUNErrCode SUNMatScaleAddI_BlockTridiag(sunrealtype c,
+                                                        SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatMatvec_BlockTridiag(SUNMatrix A, N_Vector x,
+                                                     N_Vector y);
+SUNDIALS_EXPORT SUNErrCode SUNMatHermitianTransposeVec_BlockTridiag(SUNMatrix A,
+                                                                    N_Vector x,
+                                                                    N_Vector y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
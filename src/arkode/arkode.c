@@ -30,6 +30,7 @@
 
 #include "arkode_impl.h"
 #include "arkode_interp_impl.h"
+#include "arkode_ls_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 #include "sundials/sundials_context.h"
 #include "sundials/sundials_logger.h"
@@ -907,6 +908,8 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
                  "step = %li, tn = " SUN_FORMAT_G ", h = " SUN_FORMAT_G,
                  ark_mem->nst + 1, ark_mem->tn, ark_mem->h);
 
+      arkTraceBeginStep(ark_mem);
+
       /* Call time stepper module to attempt a step:
             0 => step completed successfully
            >0 => step encountered recoverable failure; reduce step if possible
@@ -917,6 +920,7 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
         /* Log fatal errors here, other returns handled below */
         SUNLogInfo(ARK_LOGGER, "end-step-attempt",
                    "status = failed step, kflag = %i", kflag);
+        arkTraceEndStepIf(ark_mem, SUNTRUE, SUN_STEPTRACE_SOLVE_FAIL, ZERO);
         break;
       }
 
@@ -925,6 +929,8 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
 
       SUNLogInfoIf(kflag != ARK_SUCCESS, ARK_LOGGER, "end-step-attempt",
                    "status = failed step, kflag = %i", kflag);
+      arkTraceEndStepIf(ark_mem, kflag != ARK_SUCCESS, SUN_STEPTRACE_SOLVE_FAIL,
+                        ZERO);
 
       if (kflag < 0) { break; }
 
@@ -939,6 +945,8 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
 
         SUNLogInfoIf(kflag != ARK_SUCCESS, ARK_LOGGER, "end-step-attempt",
                      "status = failed relaxtion, kflag = %i", kflag);
+        arkTraceEndStepIf(ark_mem, kflag != ARK_SUCCESS,
+                          SUN_STEPTRACE_OTHER_FAIL, ZERO);
 
         if (kflag < 0) { break; }
       }
@@ -950,6 +958,8 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
 
         SUNLogInfoIf(kflag != ARK_SUCCESS, ARK_LOGGER, "end-step-attempt",
                      "status = failed constraints, kflag = %i", kflag);
+        arkTraceEndStepIf(ark_mem, kflag != ARK_SUCCESS,
+                          SUN_STEPTRACE_OTHER_FAIL, ZERO);
 
         if (kflag < 0) { break; }
       }
@@ -960,6 +970,7 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
       {
         ark_mem->eta = ONE;
         SUNLogInfo(ARK_LOGGER, "end-step-attempt", "status = success");
+        arkTraceEndStepIf(ark_mem, SUNTRUE, SUN_STEPTRACE_SUCCESS, dsm);
         break;
       }
 
@@ -972,6 +983,8 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
                      "status = failed error test, dsm = " SUN_FORMAT_G
                      ", kflag = %i",
                      dsm, kflag);
+        arkTraceEndStepIf(ark_mem, kflag != ARK_SUCCESS,
+                          SUN_STEPTRACE_ERRTEST_FAIL, dsm);
 
         if (kflag < 0) { break; }
       }
@@ -982,6 +995,7 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
         ark_mem->last_kflag = kflag;
         kflag               = ARK_SUCCESS;
         SUNLogInfo(ARK_LOGGER, "end-step-attempt", "status = success");
+        arkTraceEndStepIf(ark_mem, SUNTRUE, SUN_STEPTRACE_SUCCESS, dsm);
         break;
       }
 
@@ -990,6 +1004,7 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
       {
         SUNLogInfo(ARK_LOGGER, "end-step-attempt",
                    "status = success, dsm = " SUN_FORMAT_G, dsm);
+        arkTraceEndStepIf(ark_mem, SUNTRUE, SUN_STEPTRACE_SUCCESS, dsm);
         break;
       }
 
@@ -1277,7 +1292,7 @@ void ARKodeFree(void** arkode_mem)
     ark_mem->relax_mem = NULL;
   }
 
-  free(*arkode_mem);
+  SUNContext_ArenaFree(ark_mem->sunctx, ark_mem);
   *arkode_mem = NULL;
 }
 
@@ -1491,7 +1506,8 @@ ARKodeMem arkCreate(SUNContext sunctx)
   }
 
   ark_mem = NULL;
-  ark_mem = (ARKodeMem)malloc(sizeof(struct ARKodeMemRec));
+  ark_mem = (ARKodeMem)SUNContext_ArenaAlloc(sunctx,
+                                             sizeof(struct ARKodeMemRec));
   if (ark_mem == NULL)
   {
     arkProcessError(NULL, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
@@ -1590,6 +1606,9 @@ ARKodeMem arkCreate(SUNContext sunctx)
   /* No user-supplied stage postprocessing function yet */
   ark_mem->ProcessStage = NULL;
 
+  /* No step trace yet */
+  ark_mem->trace = NULL;
+
   /* No user_data pointer yet */
   ark_mem->user_data = NULL;
 
@@ -3441,6 +3460,63 @@ sunbooleantype arkAllocVecArray(int count, N_Vector tmpl, N_Vector** v,
   return (SUNTRUE);
 }
 
+/*---------------------------------------------------------------
+  arkTraceBeginStep and arkTraceEndStepIf:
+
+  These routines store the state at the start of a step attempt
+  and (if condition is true) record the outcome of the attempt in
+  the step trace, if one is attached.
+  ---------------------------------------------------------------*/
+static void arkTraceCounters(ARKodeMem ark_mem, long int* nni, long int* nli,
+                             long int* nje, long int* nsetups)
+{
+  ARKLsMem arkls_mem = NULL;
+
+  *nni = *nli = *nje = *nsetups = 0;
+
+  if (ark_mem->step_getnumnonlinsolviters)
+  {
+    ark_mem->step_getnumnonlinsolviters(ark_mem, nni);
+  }
+  if (ark_mem->step_getnumlinsolvsetups)
+  {
+    ark_mem->step_getnumlinsolvsetups(ark_mem, nsetups);
+  }
+  if (ark_mem->step_getlinmem)
+  {
+    arkls_mem = (ARKLsMem)(ark_mem->step_getlinmem(ark_mem));
+  }
+  if (arkls_mem)
+  {
+    *nli = arkls_mem->nli;
+    *nje = arkls_mem->nje;
+  }
+}
+
+void arkTraceBeginStep(ARKodeMem ark_mem)
+{
+  long int nni, nli, nje, nsetups;
+  int order;
+
+  if (!ark_mem->trace) { return; }
+
+  order = (ark_mem->hadapt_mem) ? ark_mem->hadapt_mem->q : 0;
+  arkTraceCounters(ark_mem, &nni, &nli, &nje, &nsetups);
+  SUNStepTrace_BeginStep(ark_mem->trace, ark_mem->tn, ark_mem->h, order, nni,
+                         nli, nje, nsetups);
+}
+
+void arkTraceEndStepIf(ARKodeMem ark_mem, sunbooleantype condition,
+                       SUNStepTraceStatus status, sunrealtype dsm)
+{
+  long int nni, nli, nje, nsetups;
+
+  if (!ark_mem->trace || !condition) { return; }
+
+  arkTraceCounters(ark_mem, &nni, &nli, &nje, &nsetups);
+  SUNStepTrace_EndStep(ark_mem->trace, status, dsm, nni, nli, nje, nsetups);
+}
+
 /*---------------------------------------------------------------
   arkFreeVec and arkFreeVecArray:
 
@@ -364,6 +364,9 @@ int arkStep_Resize(ARKodeMem ark_mem, N_Vector y0,
   retval = arkStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return (retval); }
 
+  /* Free the concurrent stage group data (recreated in arkStep_Init) */
+  arkStep_StageGroupFree(ark_mem);
+
   /* Determine change in vector sizes */
   lrw1 = liw1 = 0;
   if (y0->ops->nvspace != NULL) { N_VSpace(y0, &lrw1, &liw1); }
@@ -517,6 +520,9 @@ void arkStep_Free(ARKodeMem ark_mem)
       ark_mem->lrw -= Blrw;
     }
 
+    /* free the concurrent stage group data */
+    arkStep_StageGroupFree(ark_mem);
+
     /* free the nonlinear solver memory (if applicable) */
     if ((step_mem->NLS != NULL) && (step_mem->ownNLS))
     {
@@ -1214,6 +1220,10 @@ int arkStep_Init(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tout,
     }
   }
 
+  /* Set up the concurrent solves of independent implicit stage groups */
+  retval = arkStep_StageGroupInit(ark_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
   /* Signal to shared arkode module that full RHS evaluations are required */
   ark_mem->call_fullrhs = SUNTRUE;
 
@@ -1662,6 +1672,7 @@ int arkStep_TakeStep_Z(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
 {
   int retval, is, is_start, mode;
   sunbooleantype implicit_stage;
+  sunbooleantype group_stage;
   sunbooleantype deduce_stage;
   sunbooleantype save_stages;
   sunbooleantype stiffly_accurate;
@@ -1896,6 +1907,11 @@ int arkStep_TakeStep_Z(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
       if (SUNRabs(step_mem->Bi->A[is][is]) > TINY) { implicit_stage = SUNTRUE; }
     }
 
+    /* determine if the stage is solved concurrently with the other stages of
+       its group (see arkStep_StageGroupInit) */
+    group_stage = implicit_stage && (step_mem->stage_mem != NULL) &&
+                  (step_mem->stage_mem[is].group_end > 0);
+
     /* determine if the stage RHS will be deduced from the implicit solve */
     deduce_stage = step_mem->deduce_rhs && implicit_stage;
 
@@ -1924,8 +1940,9 @@ int arkStep_TakeStep_Z(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     }
 
     /* if implicit, call built-in and user-supplied predictors
-       (results placed in zpred) */
-    if (implicit_stage)
+       (results placed in zpred), for a concurrently solved stage this is
+       done for all stages of its group in arkStep_StageGroupSetup */
+    if (implicit_stage && !group_stage)
     {
       retval = arkStep_Predict(ark_mem, is, step_mem->zpred);
       if (retval != ARK_SUCCESS)
@@ -1953,18 +1970,50 @@ int arkStep_TakeStep_Z(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     }
 
     /* set up explicit data for evaluation of ARK stage (store in sdata) */
-    retval = arkStep_StageSetup(ark_mem, implicit_stage);
-    if (retval != ARK_SUCCESS)
+    if (!group_stage)
     {
-      SUNLogInfo(ARK_LOGGER, "end-stage",
-                 "status = failed stage setup, retval = %i", retval);
-      return (retval);
+      retval = arkStep_StageSetup(ark_mem, implicit_stage);
+      if (retval != ARK_SUCCESS)
+      {
+        SUNLogInfo(ARK_LOGGER, "end-stage",
+                   "status = failed stage setup, retval = %i", retval);
+        return (retval);
+      }
+
+      SUNLogExtraDebugVec(ARK_LOGGER, "rhs data", step_mem->sdata, "sdata(:) =");
     }
 
-    SUNLogExtraDebugVec(ARK_LOGGER, "rhs data", step_mem->sdata, "sdata(:) =");
+    /* solve all stages of a concurrently solved group at its first stage */
+    if (group_stage && (is == step_mem->stage_mem[is].group_first))
+    {
+      retval = arkStep_StageGroupSetup(ark_mem, is);
+      if (retval != ARK_SUCCESS)
+      {
+        SUNLogInfo(ARK_LOGGER, "end-stage",
+                   "status = failed group setup, retval = %i", retval);
+        return (retval);
+      }
+
+      *nflagPtr = arkStep_NlsStageGroup(ark_mem, is, *nflagPtr);
+      if (*nflagPtr != ARK_SUCCESS)
+      {
+        SUNLogInfo(ARK_LOGGER, "end-stage",
+                   "status = failed group solve, nflag = %i", *nflagPtr);
+        return (TRY_AGAIN);
+      }
+    }
 
     /* perform implicit solve if required */
-    if (implicit_stage)
+    if (group_stage)
+    {
+      /* copy the stage solution and data of the concurrent solve to ycur,
+         zcor, and sdata */
+      arkStep_StageGroupLoad(ark_mem, is);
+
+      SUNLogExtraDebugVec(ARK_LOGGER, "implicit stage", ark_mem->ycur,
+                          "z_%i(:) =", is);
+    }
+    else if (implicit_stage)
     {
       /* implicit solve result is stored in ark_mem->ycur;
          return with positive value on anything but success */
@@ -2789,6 +2838,22 @@ int arkStep_CheckButcherTables(ARKodeMem ark_mem)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  arkStep_PrevStages
+
+  This routine returns the number of previous stages whose RHS
+  is available to stage i.  The stages of a concurrently solved
+  group only use the stages of the earlier groups.
+  ---------------------------------------------------------------*/
+static int arkStep_PrevStages(ARKodeARKStepMem step_mem, int i)
+{
+  if ((step_mem->stage_mem != NULL) && (step_mem->stage_mem[i].group_end > 0))
+  {
+    return (step_mem->stage_mem[i].group_first);
+  }
+  return (i);
+}
+
 /*---------------------------------------------------------------
   arkStep_Predict
 
@@ -2801,7 +2866,7 @@ int arkStep_CheckButcherTables(ARKodeMem ark_mem)
   ---------------------------------------------------------------*/
 int arkStep_Predict(ARKodeMem ark_mem, int istage, N_Vector yguess)
 {
-  int i, retval, jstage, nvec;
+  int i, retval, jstage, nvec, nprev;
   sunrealtype tau;
   sunrealtype h;
   ARKodeARKStepMem step_mem;
@@ -2830,6 +2895,9 @@ int arkStep_Predict(ARKodeMem ark_mem, int istage, N_Vector yguess)
   cvals = step_mem->cvals;
   Xvecs = step_mem->Xvecs;
 
+  /* previous stages available for the prediction */
+  nprev = arkStep_PrevStages(step_mem, istage);
+
   /* if the first step, use initial condition as guess */
   if (ark_mem->initsetup)
   {
@@ -2875,7 +2943,7 @@ int arkStep_Predict(ARKodeMem ark_mem, int istage, N_Vector yguess)
 
     /* determine if any previous stages in step meet criteria */
     jstage = -1;
-    for (i = 0; i < istage; i++)
+    for (i = 0; i < nprev; i++)
     {
       jstage = (step_mem->Bi->c[i] != ZERO) ? i : jstage;
     }
@@ -2884,7 +2952,7 @@ int arkStep_Predict(ARKodeMem ark_mem, int istage, N_Vector yguess)
     if (jstage == -1) { break; }
 
     /* find the "optimal" previous stage to use */
-    for (i = 0; i < istage; i++)
+    for (i = 0; i < nprev; i++)
     {
       if ((step_mem->Bi->c[i] > step_mem->Bi->c[jstage]) &&
           (step_mem->Bi->c[i] != ZERO))
@@ -2933,7 +3001,7 @@ int arkStep_Predict(ARKodeMem ark_mem, int istage, N_Vector yguess)
     }
     if (step_mem->implicit)
     { /* Implicit pieces */
-      for (jstage = 0; jstage < istage; jstage++)
+      for (jstage = 0; jstage < nprev; jstage++)
       {
         cvals[nvec] = ark_mem->h * step_mem->Bi->A[istage][jstage];
         Xvecs[nvec] = step_mem->Fi[jstage];
@@ -3097,8 +3165,9 @@ int arkStep_StageSetup(ARKodeMem ark_mem, sunbooleantype implicit)
     }
   }
   if (step_mem->implicit)
-  { /* Implicit pieces */
-    for (j = 0; j < i; j++)
+  { /* Implicit pieces (only earlier groups for a concurrently solved stage) */
+    jmax = arkStep_PrevStages(step_mem, i);
+    for (j = 0; j < jmax; j++)
     {
       cvals[nvec] = ark_mem->h * step_mem->Bi->A[i][j];
       Xvecs[nvec] = step_mem->Fi[j];
@@ -3140,6 +3209,60 @@ int arkStep_StageSetup(ARKodeMem ark_mem, sunbooleantype implicit)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  arkStep_StageGroupSetup
+
+  This routine calls the built-in and user-supplied predictors
+  and sets up the explicit data (see arkStep_StageSetup) for each
+  stage of the concurrently solved group starting at stage is,
+  and stores them in the stage data of the group.  The stages of
+  a group only depend on the stages of the earlier groups so all
+  of them can be set up before the group is solved.
+  ---------------------------------------------------------------*/
+int arkStep_StageGroupSetup(ARKodeMem ark_mem, int is)
+{
+  ARKodeARKStepMem step_mem;
+  ARKodeARKStepStageMem st;
+  int i, retval;
+
+  /* access ARKodeARKStepMem structure */
+  retval = arkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  for (i = is; i < step_mem->stage_mem[is].group_end; i++)
+  {
+    st = &(step_mem->stage_mem[i]);
+
+    step_mem->istage = i;
+    ark_mem->tcur    = ark_mem->tn + step_mem->Bi->c[i] * ark_mem->h;
+    st->tcur         = ark_mem->tcur;
+
+    retval = arkStep_Predict(ark_mem, i, step_mem->zpred);
+    if (retval != ARK_SUCCESS) { return (retval); }
+
+    if (step_mem->stage_predict)
+    {
+      retval = step_mem->stage_predict(ark_mem->tcur, step_mem->zpred,
+                                       ark_mem->user_data);
+      if (retval < 0) { return (ARK_USER_PREDICT_FAIL); }
+      if (retval > 0) { return (TRY_AGAIN); }
+    }
+
+    SUNLogExtraDebugVec(ARK_LOGGER, "predictor", step_mem->zpred, "zpred(:) =");
+
+    retval = arkStep_StageSetup(ark_mem, SUNTRUE);
+    if (retval != ARK_SUCCESS) { return (retval); }
+
+    SUNLogExtraDebugVec(ARK_LOGGER, "rhs data", step_mem->sdata, "sdata(:) =");
+
+    N_VScale(ONE, step_mem->zpred, st->zpred);
+    N_VScale(ONE, step_mem->sdata, st->sdata);
+    st->gamma = step_mem->gamma;
+  }
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   arkStep_ComputeSolutions
 
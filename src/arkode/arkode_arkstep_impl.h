@@ -57,6 +57,43 @@ extern "C" {
   ARK time step module data structure
   ===============================================================*/
 
+/*---------------------------------------------------------------
+  Types : struct ARKodeARKStepStageMemRec, ARKodeARKStepStageMem
+  ---------------------------------------------------------------
+  The type ARKodeARKStepStageMem is type pointer to struct
+  ARKodeARKStepStageMemRec.  This structure contains the data to
+  solve one stage of a group of independent implicit stages
+  concurrently with the other stages of the group.
+  ---------------------------------------------------------------*/
+typedef struct ARKodeARKStepStageMemRec
+{
+  ARKodeMem ark_mem; /* ARKODE memory structure                 */
+  int stage;         /* stage index                             */
+  int group_first;   /* first stage of the group                */
+  int group_end;     /* one past the last stage of the group,
+                        0 if the stage is solved sequentially   */
+
+  sunrealtype tcur;  /* stage time                              */
+  sunrealtype gamma; /* gamma = h * A(i,i)                      */
+  sunrealtype crate; /* estimated nonlin convergence rate       */
+  sunrealtype delp;  /* norm of previous nonlinear solver update */
+
+  N_Vector zpred; /* predicted stage solution                   */
+  N_Vector zcor;  /* stage correction                           */
+  N_Vector sdata; /* old stage data in residual                 */
+  N_Vector ycur;  /* stage solution                             */
+
+  SUNNonlinearSolver NLS; /* Newton solver of the stage              */
+  SUNMatrix A;            /* stage matrix I - gamma J, NULL => ARKLS */
+  SUNLinearSolver LS;     /* stage linear solver, NULL => ARKLS      */
+
+  long int nfi;       /* num fi calls               */
+  long int nls_iters; /* num nonlinear solver iters */
+  long int nls_fails; /* num nonlinear solver fails */
+  int retval;         /* return flag of the stage solve */
+
+}* ARKodeARKStepStageMem;
+
 /*---------------------------------------------------------------
   Types : struct ARKodeARKStepMemRec, ARKodeARKStepMem
   ---------------------------------------------------------------
@@ -126,6 +163,11 @@ typedef struct ARKodeARKStepMemRec
   sunbooleantype jcur;  /* is Jacobian info for lin solver current? */
   N_Vector fn_implicit; /* alias to saved implicit function evaluation */
 
+  /* Concurrent solves of independent implicit stage groups */
+  int stage_nthreads;              /* threads per stage group, 1 => off */
+  ARKodeARKStepStageMem stage_mem; /* per-stage data                   */
+  int nstage_mem;                  /* length of stage_mem              */
+
   /* Linear Solver Data */
   ARKLinsolInitFn linit;
   ARKLinsolSetupFn lsetup;
@@ -247,6 +289,11 @@ int arkStep_Predict(ARKodeMem ark_mem, int istage, N_Vector yguess);
 int arkStep_StageSetup(ARKodeMem ark_mem, sunbooleantype implicit);
 int arkStep_NlsInit(ARKodeMem ark_mem);
 int arkStep_Nls(ARKodeMem ark_mem, int nflag);
+int arkStep_StageGroupInit(ARKodeMem ark_mem);
+void arkStep_StageGroupFree(ARKodeMem ark_mem);
+int arkStep_StageGroupSetup(ARKodeMem ark_mem, int is);
+int arkStep_NlsStageGroup(ARKodeMem ark_mem, int is, int nflag);
+void arkStep_StageGroupLoad(ARKodeMem ark_mem, int is);
 int arkStep_SetNlsSysFn(ARKodeMem ark_mem);
 int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsm);
 int arkStep_ComputeSolutions_MassFixed(ARKodeMem ark_mem, sunrealtype* dsm);
@@ -275,6 +322,10 @@ int arkStep_NlsLSetup(sunbooleantype jbad, sunbooleantype* jcur,
 int arkStep_NlsLSolve(N_Vector delta, void* arkode_mem);
 int arkStep_NlsConvTest(SUNNonlinearSolver NLS, N_Vector y, N_Vector del,
                         sunrealtype tol, N_Vector ewt, void* arkode_mem);
+int arkStep_NlsStageResidual(N_Vector zcor, N_Vector r, void* stage_mem);
+int arkStep_NlsStageLSolve(N_Vector delta, void* stage_mem);
+int arkStep_NlsStageConvTest(SUNNonlinearSolver NLS, N_Vector y, N_Vector del,
+                             sunrealtype tol, N_Vector ewt, void* stage_mem);
 
 /* private functions for relaxation */
 int arkStep_SetRelaxFn(ARKodeMem ark_mem, ARKRelaxFn rfn, ARKRelaxJacFn rjac);
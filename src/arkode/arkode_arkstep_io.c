@@ -514,6 +514,29 @@ int ARKStepSetTableName(void* arkode_mem, const char* itable, const char* etable
                              arkButcherTableERKNameToID(etable)));
 }
 
+/*---------------------------------------------------------------
+  ARKStepSetStageGroupNumThreads:
+
+  Specifies the number of threads used to solve the stages of
+  each group of independent implicit stages concurrently.  Values
+  less than two (the default) solve the stages sequentially.  The
+  setting takes effect when the integrator is (re)initialized.
+  ---------------------------------------------------------------*/
+int ARKStepSetStageGroupNumThreads(void* arkode_mem, int nthreads)
+{
+  ARKodeMem ark_mem;
+  ARKodeARKStepMem step_mem;
+  int retval;
+
+  /* access ARKodeMem and ARKodeARKStepMem structures */
+  retval = arkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  step_mem->stage_nthreads = (nthreads < 2) ? 1 : nthreads;
+
+  return (ARK_SUCCESS);
+}
+
 /*===============================================================
   Exported optional output functions.
   ===============================================================*/
@@ -710,6 +733,8 @@ int arkStep_SetDefaults(ARKodeMem ark_mem)
   step_mem->jcur     = SUNFALSE;
   step_mem->convfail = ARK_NO_FAILURES;
   step_mem->stage_predict = NULL; /* no user-supplied stage predictor */
+  step_mem->stage_nthreads = 1;   /* solve the stages sequentially */
+  arkStep_StageGroupFree(ark_mem);
 
   /* Remove pre-existing Butcher tables */
   if (step_mem->Be)
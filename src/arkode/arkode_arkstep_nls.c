@@ -19,9 +19,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sundials/sundials_math.h>
+#include <sunnonlinsol/sunnonlinsol_newton.h>
 
 #include "arkode_arkstep_impl.h"
 #include "arkode_impl.h"
+#include "sundials_macros.h"
 
 /*===============================================================
   Interface routines supplied to ARKODE
@@ -456,6 +458,372 @@ int arkStep_Nls(ARKodeMem ark_mem, int nflag)
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  arkStep_StageGroupInit
+
+  This routine sets up the concurrent solves of the groups of
+  independent implicit stages (see
+  ARKodeButcherTable_GetStageGroups) when more than one thread
+  was selected with ARKStepSetStageGroupNumThreads.  Each stage
+  of a group with at least two stages gets its own predictor,
+  correction, stage data, and solution vectors and its own
+  Newton solver.  All but the last stage of a group also get
+  their own matrix and linear solver, the last stage uses the
+  matrix and linear solver attached to ARKODE.  The stages that
+  are solved one after another keep group_end = 0.
+  ---------------------------------------------------------------*/
+int arkStep_StageGroupInit(ARKodeMem ark_mem)
+{
+  ARKodeARKStepMem step_mem;
+  ARKodeARKStepStageMem st;
+  int i, j, first, end, ngroups, nconc, retval;
+  int* groups;
+
+  /* access ARKodeARKStepMem structure */
+  retval = arkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* free the data of a previous initialization */
+  arkStep_StageGroupFree(ark_mem);
+
+  if ((step_mem->stage_nthreads < 2) || !step_mem->implicit)
+  {
+    return (ARK_SUCCESS);
+  }
+
+  /* determine the stage groups */
+  groups = (int*)malloc(step_mem->stages * sizeof(int));
+  if (groups == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_ARKMEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+
+  retval = ARKodeButcherTable_GetStageGroups(step_mem->Bi, &ngroups, groups);
+  if (retval != 0)
+  {
+    free(groups);
+    arkProcessError(ark_mem, ARK_INVALID_TABLE, __LINE__, __func__, __FILE__,
+                    "Unable to determine the stage groups");
+    return (ARK_INVALID_TABLE);
+  }
+
+  /* replace the group index of each stage by one past the last stage of its
+     group if the group has at least two stages that are all implicit, and by
+     zero otherwise (only the entries of later groups are read below) */
+  nconc = 0;
+  for (first = 0; first < step_mem->stages; first = end)
+  {
+    for (end = first + 1;
+         end < step_mem->stages && groups[end] == groups[first]; end++) {}
+
+    for (i = first; i < end; i++)
+    {
+      if (SUNRabs(step_mem->Bi->A[i][i]) <= TINY) { break; }
+    }
+    if ((end - first > 1) && (i == end)) { nconc++; }
+    else { i = 0; }
+
+    for (j = first; j < end; j++) { groups[j] = i; }
+  }
+
+  /* nothing to do if the method has no such group */
+  if (nconc == 0)
+  {
+    free(groups);
+    return (ARK_SUCCESS);
+  }
+
+  if (step_mem->explicit || (step_mem->mass_type != MASS_IDENTITY) ||
+      (step_mem->lsetup == NULL) ||
+      (SUNNonlinSolGetType(step_mem->NLS) != SUNNONLINEARSOLVER_ROOTFIND))
+  {
+    free(groups);
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Concurrent stage solves require a DIRK method, an "
+                    "identity mass matrix, a Newton-type nonlinear solver, "
+                    "and a matrix-based linear solver");
+    return (ARK_ILL_INPUT);
+  }
+
+  step_mem->stage_mem = (ARKodeARKStepStageMem)calloc(step_mem->stages,
+                                                      sizeof(*st));
+  if (step_mem->stage_mem == NULL)
+  {
+    free(groups);
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_ARKMEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+  step_mem->nstage_mem = step_mem->stages;
+
+  for (i = 0; i < step_mem->stages; i++)
+  {
+    step_mem->stage_mem[i].ark_mem     = ark_mem;
+    step_mem->stage_mem[i].stage       = i;
+    step_mem->stage_mem[i].group_first = i;
+  }
+
+  retval = ARK_SUCCESS;
+  for (first = 0; first < step_mem->stages && retval == ARK_SUCCESS; first = end)
+  {
+    end = (groups[first] > 0) ? groups[first] : first + 1;
+    if (groups[first] == 0) { continue; }
+
+    for (j = first; j < end; j++)
+    {
+      st              = &(step_mem->stage_mem[j]);
+      st->group_first = first;
+      st->group_end   = end;
+
+      if (!arkAllocVec(ark_mem, ark_mem->ewt, &(st->zpred)) ||
+          !arkAllocVec(ark_mem, ark_mem->ewt, &(st->zcor)) ||
+          !arkAllocVec(ark_mem, ark_mem->ewt, &(st->sdata)) ||
+          !arkAllocVec(ark_mem, ark_mem->ewt, &(st->ycur)))
+      {
+        arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                        MSG_ARK_ARKMEM_FAIL);
+        retval = ARK_MEM_FAIL;
+        break;
+      }
+
+      st->NLS = SUNNonlinSol_Newton(ark_mem->ewt, ark_mem->sunctx);
+      if (st->NLS == NULL)
+      {
+        arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                        "Error creating default Newton solver");
+        retval = ARK_MEM_FAIL;
+        break;
+      }
+
+      if (SUNNonlinSolSetSysFn(st->NLS, arkStep_NlsStageResidual) ||
+          SUNNonlinSolSetLSolveFn(st->NLS, arkStep_NlsStageLSolve) ||
+          SUNNonlinSolSetConvTestFn(st->NLS, arkStep_NlsStageConvTest, st) ||
+          SUNNonlinSolInitialize(st->NLS))
+      {
+        arkProcessError(ark_mem, ARK_NLS_INIT_FAIL, __LINE__, __func__,
+                        __FILE__, MSG_NLS_INIT_FAIL);
+        retval = ARK_NLS_INIT_FAIL;
+        break;
+      }
+
+      /* the last stage of the group uses the attached linear solver */
+      if (j < end - 1)
+      {
+        retval = arkLsStageCreate(ark_mem, &(st->A), &(st->LS));
+        if (retval != ARKLS_SUCCESS)
+        {
+          retval = (retval == ARKLS_MEM_FAIL) ? ARK_MEM_FAIL : ARK_ILL_INPUT;
+          break;
+        }
+      }
+    }
+  }
+
+  free(groups);
+
+  if (retval != ARK_SUCCESS) { arkStep_StageGroupFree(ark_mem); }
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  arkStep_StageGroupFree
+
+  This routine frees the data of the concurrent stage solves.
+  ---------------------------------------------------------------*/
+void arkStep_StageGroupFree(ARKodeMem ark_mem)
+{
+  ARKodeARKStepMem step_mem;
+  ARKodeARKStepStageMem st;
+  int i;
+
+  step_mem = (ARKodeARKStepMem)ark_mem->step_mem;
+  if ((step_mem == NULL) || (step_mem->stage_mem == NULL)) { return; }
+
+  for (i = 0; i < step_mem->nstage_mem; i++)
+  {
+    st = &(step_mem->stage_mem[i]);
+    arkFreeVec(ark_mem, &(st->zpred));
+    arkFreeVec(ark_mem, &(st->zcor));
+    arkFreeVec(ark_mem, &(st->sdata));
+    arkFreeVec(ark_mem, &(st->ycur));
+    if (st->NLS != NULL) { SUNNonlinSolFree(st->NLS); }
+    if (st->LS != NULL) { SUNLinSolFree(st->LS); }
+    if (st->A != NULL) { SUNMatDestroy(st->A); }
+  }
+
+  free(step_mem->stage_mem);
+  step_mem->stage_mem  = NULL;
+  step_mem->nstage_mem = 0;
+}
+
+/*---------------------------------------------------------------
+  arkStep_NlsStageGroup
+
+  This routine solves the nonlinear systems of the concurrently
+  solved group starting at stage is, after the stages were set up
+  with arkStep_StageGroupSetup.  The linear solver setup of the
+  last stage updates the Jacobian (if needed) and the stages then
+  form and factor their own matrices from this Jacobian and solve
+  their systems concurrently.  If a stage fails to converge with
+  an old Jacobian, the group is solved once more with a new one.
+  The fi evaluations and nonlinear solver statistics of the
+  stages are added to the ARKStep counters.
+  ---------------------------------------------------------------*/
+int arkStep_NlsStageGroup(ARKodeMem ark_mem, int is, int nflag)
+{
+  ARKodeARKStepMem step_mem;
+  ARKodeARKStepStageMem st, st_last;
+  sunbooleantype jbad, jcur;
+  int i, ie, nthreads, retval;
+
+  /* access ARKodeARKStepMem structure */
+  retval = arkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  ie       = step_mem->stage_mem[is].group_end;
+  st_last  = &(step_mem->stage_mem[ie - 1]);
+  nthreads = SUNMIN(step_mem->stage_nthreads, ie - is);
+
+  /* set the interface 'convfail' flag as in arkStep_Nls */
+  if (step_mem->linear)
+  {
+    step_mem->convfail = (nflag == FIRST_CALL) ? ARK_NO_FAILURES
+                                               : ARK_FAIL_OTHER;
+  }
+  else
+  {
+    step_mem->convfail = ((nflag == FIRST_CALL) || (nflag == PREV_ERR_FAIL))
+                           ? ARK_NO_FAILURES
+                           : ARK_FAIL_OTHER;
+  }
+
+  /* apply the current maximum number of nonlinear iterations */
+  for (i = is; i < ie; i++)
+  {
+    retval = SUNNonlinSolSetMaxIters(step_mem->stage_mem[i].NLS,
+                                     step_mem->maxcor);
+    if (retval != SUN_SUCCESS) { return (ARK_NLS_OP_ERR); }
+  }
+
+  /* the setup of the attached linear solver is for the last stage */
+  step_mem->istage = ie - 1;
+  step_mem->gamma  = st_last->gamma;
+  ark_mem->tcur    = st_last->tcur;
+
+  SUNLogInfo(ARK_LOGGER, "begin-nonlinear-solve",
+             "group = %i-%i, threads = %i, tol = %.16g", is, ie - 1, nthreads,
+             step_mem->nlscoef);
+
+  jbad = SUNFALSE;
+  for (;;)
+  {
+    /* evaluate fi at the predictor of the last stage for the Jacobian */
+    N_VScale(ONE, st_last->zpred, ark_mem->ycur);
+    retval = step_mem->nls_fi(ark_mem->tcur, ark_mem->ycur,
+                              step_mem->Fi[ie - 1], ark_mem->user_data);
+    step_mem->nfi++;
+    if (retval < 0) { return (ARK_RHSFUNC_FAIL); }
+    if (retval > 0) { return (RHSFUNC_RECVR); }
+
+    retval = arkStep_NlsLSetup(jbad, &jcur, ark_mem);
+    if (retval != ARK_SUCCESS) { return (retval); }
+
+    /* the other stages form and factor their own matrices */
+    step_mem->nsetups += ie - is - 1;
+
+    /* solve the stages of the group concurrently */
+    SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+    for (i = is; i < ie; i++)
+    {
+      ARKodeARKStepStageMem sti = &(step_mem->stage_mem[i]);
+      sunrealtype nlscoef       = step_mem->nlscoef;
+      int flag                  = ARK_SUCCESS;
+
+      sti->nfi       = 0;
+      sti->nls_iters = 0;
+      sti->nls_fails = 0;
+      sti->crate     = ONE;
+      sti->delp      = ZERO;
+
+      /* form and factor the matrix of the stage from the saved Jacobian */
+      if (sti->LS != NULL)
+      {
+        flag = arkLsStageSetup(ark_mem, sti->gamma, sti->A, sti->LS);
+        if (flag < 0) { flag = ARK_LSETUP_FAIL; }
+        else if (flag > 0) { flag = CONV_FAIL; }
+      }
+
+      if (flag == ARK_SUCCESS)
+      {
+        N_VConst(ZERO, sti->zcor);
+        flag = SUNNonlinSolSolve(sti->NLS, sti->zpred, sti->zcor, ark_mem->ewt,
+                                 nlscoef, SUNFALSE, sti);
+        (void)SUNNonlinSolGetNumIters(sti->NLS, &(sti->nls_iters));
+        (void)SUNNonlinSolGetNumConvFails(sti->NLS, &(sti->nls_fails));
+
+        if (flag == SUN_SUCCESS)
+        {
+          N_VLinearSum(ONE, sti->zcor, ONE, sti->zpred, sti->ycur);
+        }
+        else if (flag == SUN_NLS_CONV_RECVR) { flag = CONV_FAIL; }
+      }
+
+      sti->retval = flag;
+    }
+
+    /* accumulate the counters and find the first failure */
+    retval = ARK_SUCCESS;
+    for (i = is; i < ie; i++)
+    {
+      st = &(step_mem->stage_mem[i]);
+      step_mem->nfi += st->nfi;
+      step_mem->nls_iters += st->nls_iters;
+      step_mem->nls_fails += st->nls_fails;
+      if (retval == ARK_SUCCESS) { retval = st->retval; }
+    }
+
+    /* retry once with a new Jacobian after a convergence failure */
+    if ((retval == CONV_FAIL) && !jcur && !jbad)
+    {
+      jbad = SUNTRUE;
+      continue;
+    }
+    break;
+  }
+
+  SUNLogInfo(ARK_LOGGER, "end-nonlinear-solve", "status = %s, retval = %i",
+             (retval == ARK_SUCCESS) ? "success" : "failed", retval);
+
+  if (retval == ARK_SUCCESS) { step_mem->jcur = SUNFALSE; }
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  arkStep_StageGroupLoad
+
+  This routine copies the solution, correction, and stage data
+  of the concurrently solved stage is to ark_mem->ycur and
+  step_mem->zcor and step_mem->sdata, and restores the stage
+  index, time, and gamma, so the stage is processed as if it was
+  solved by arkStep_Nls.
+  ---------------------------------------------------------------*/
+void arkStep_StageGroupLoad(ARKodeMem ark_mem, int is)
+{
+  ARKodeARKStepMem step_mem = (ARKodeARKStepMem)ark_mem->step_mem;
+  ARKodeARKStepStageMem st  = &(step_mem->stage_mem[is]);
+
+  N_VScale(ONE, st->ycur, ark_mem->ycur);
+  N_VScale(ONE, st->zcor, step_mem->zcor);
+  N_VScale(ONE, st->sdata, step_mem->sdata);
+  step_mem->istage = is;
+  step_mem->gamma  = st->gamma;
+  ark_mem->tcur    = st->tcur;
+}
+
 /*===============================================================
   Interface routines supplied to the SUNNonlinearSolver module
   ===============================================================*/
@@ -1196,6 +1564,119 @@ int arkStep_NlsConvTest(SUNNonlinearSolver NLS,
   return (SUN_NLS_CONTINUE);
 }
 
+/*---------------------------------------------------------------
+  arkStep_NlsStageResidual
+
+  This routine evaluates the nonlinear residual of a concurrently
+  solved stage (see arkStep_NlsResidual_MassIdent) using the data
+  of the stage, i.e.,
+     z = zp + zc (stored in st->ycur)
+     Fi(z) (stored in step_mem->Fi[st->stage])
+     r = zc - gamma*Fi(z) - st->sdata
+  ---------------------------------------------------------------*/
+int arkStep_NlsStageResidual(N_Vector zcor, N_Vector r, void* stage_mem)
+{
+  ARKodeARKStepStageMem st  = (ARKodeARKStepStageMem)stage_mem;
+  ARKodeMem ark_mem         = st->ark_mem;
+  ARKodeARKStepMem step_mem = (ARKodeARKStepMem)ark_mem->step_mem;
+  sunrealtype c[3];
+  N_Vector X[3];
+  int retval;
+
+  /* update 'ycur' value as stored predictor + current corrector */
+  N_VLinearSum(ONE, st->zpred, ONE, zcor, st->ycur);
+
+  /* compute implicit RHS */
+  retval = step_mem->nls_fi(st->tcur, st->ycur, step_mem->Fi[st->stage],
+                            ark_mem->user_data);
+  st->nfi++;
+  if (retval < 0) { return (ARK_RHSFUNC_FAIL); }
+  if (retval > 0) { return (RHSFUNC_RECVR); }
+
+  /* compute residual via linear combination */
+  c[0]   = ONE;
+  X[0]   = zcor;
+  c[1]   = -ONE;
+  X[1]   = st->sdata;
+  c[2]   = -st->gamma;
+  X[2]   = step_mem->Fi[st->stage];
+  retval = N_VLinearCombination(3, c, X, r);
+  if (retval != 0) { return (ARK_VECTOROP_ERR); }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkStep_NlsStageLSolve
+
+  This routine solves the linear system of a concurrently solved
+  stage with its own matrix and linear solver (or the attached
+  ones for the last stage of the group).
+  ---------------------------------------------------------------*/
+int arkStep_NlsStageLSolve(N_Vector b, void* stage_mem)
+{
+  ARKodeARKStepStageMem st = (ARKodeARKStepStageMem)stage_mem;
+  int retval;
+
+  retval = arkLsStageSolve(st->ark_mem, st->A, st->LS, b);
+
+  if (retval < 0) { return (ARK_LSOLVE_FAIL); }
+  if (retval > 0) { return (CONV_FAIL); }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkStep_NlsStageConvTest
+
+  This routine provides the nonlinear solver convergence test of
+  a concurrently solved stage (see arkStep_NlsConvTest) using the
+  convergence rate estimate of the stage.
+  ---------------------------------------------------------------*/
+int arkStep_NlsStageConvTest(SUNNonlinearSolver NLS,
+                             SUNDIALS_MAYBE_UNUSED N_Vector y, N_Vector del,
+                             sunrealtype tol, N_Vector ewt, void* stage_mem)
+{
+  ARKodeARKStepStageMem st  = (ARKodeARKStepStageMem)stage_mem;
+  ARKodeARKStepMem step_mem = (ARKodeARKStepMem)st->ark_mem->step_mem;
+  sunrealtype delnrm, dcon;
+  int m, retval;
+
+  /* if the problem is linearly implicit, just return success */
+  if (step_mem->linear) { return (SUN_SUCCESS); }
+
+  /* compute the norm of the correction */
+  delnrm = N_VWrmsNorm(del, ewt);
+
+  /* get the current nonlinear solver iteration count */
+  retval = SUNNonlinSolGetCurIter(NLS, &m);
+  if (retval != ARK_SUCCESS) { return (ARK_MEM_NULL); }
+
+  /* update the stored estimate of the convergence rate */
+  if (m > 0)
+  {
+    st->crate = SUNMAX(step_mem->crdown * st->crate, delnrm / st->delp);
+  }
+
+  /* compute our scaled error norm for testing convergence */
+  dcon = SUNMIN(st->crate, ONE) * delnrm / tol;
+
+  /* check for convergence; if so return with success */
+  if (dcon <= ONE) { return (SUN_SUCCESS); }
+
+  /* check for divergence */
+  if ((m >= 1) && (delnrm > step_mem->rdiv * st->delp))
+  {
+    return (SUN_NLS_CONV_RECVR);
+  }
+
+  /* save norm of correction for next iteration */
+  st->delp = delnrm;
+
+  /* return with flag that there is more work to do */
+  return (SUN_NLS_CONTINUE);
+}
+
 /*===============================================================
   EOF
   ===============================================================*/
@@ -21,6 +21,7 @@
 #include <nvector/nvector_serial.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sundials/sundials_band.h>
 #include <sundials/sundials_math.h>
 
 #include "arkode_bbdpre_impl.h"
@@ -31,6 +32,9 @@
 #define ZERO         SUN_RCONST(0.0)
 #define ONE          SUN_RCONST(1.0)
 
+/* pivots of the band LU factorization of a sub-block */
+#define BAND_PIVOTS(S) (((SUNLinearSolverContent_Band)((S)->content))->pivots)
+
 /* Prototypes of functions ARKBBDPrecSetup and ARKBBDPrecSolve */
 static int ARKBBDPrecSetup(sunrealtype t, N_Vector y, N_Vector fy,
                            sunbooleantype jok, sunbooleantype* jcurPtr,
@@ -44,7 +48,15 @@ static int ARKBBDPrecFree(ARKodeMem ark_mem);
 
 /* Prototype for difference quotient Jacobian calculation routine */
 static int ARKBBDDQJac(ARKBBDPrecData pdata, sunrealtype t, N_Vector y,
-                       N_Vector gy, N_Vector ytemp, N_Vector gtemp);
+                       N_Vector gy);
+
+/* Prototypes for sub-block utility routines */
+static int arkBBDAllocSubBlocks(ARKodeMem ark_mem, ARKBBDPrecData pdata,
+                                int nsub, ARKBBDSubBlock* sub);
+static void arkBBDFreeSubBlocks(ARKodeMem ark_mem, int nsub,
+                                ARKBBDSubBlock sub);
+static void arkBBDWorkSpace(ARKBBDPrecData pdata);
+static int arkBBDSubBlockRetval(ARKBBDPrecData pdata);
 
 /*---------------------------------------------------------------
  User-Callable Functions: initialization, reinit and free
@@ -56,8 +68,7 @@ int ARKBBDPrecInit(void* arkode_mem, sunindextype Nlocal, sunindextype mudq,
   ARKodeMem ark_mem;
   ARKLsMem arkls_mem;
   ARKBBDPrecData pdata;
-  sunindextype muk, mlk, storage_mu, lrw1, liw1;
-  long int lrw, liw;
+  sunindextype muk, mlk;
   int retval;
 
   /* access ARKodeMem and ARKLsMem structure */
@@ -94,68 +105,10 @@ int ARKBBDPrecInit(void* arkode_mem, sunindextype Nlocal, sunindextype mudq,
   pdata->mukeep     = muk;
   pdata->mlkeep     = mlk;
 
-  /* Allocate memory for saved Jacobian */
-  pdata->savedJ = SUNBandMatrixStorage(Nlocal, muk, mlk, muk, ark_mem->sunctx);
-  if (pdata->savedJ == NULL)
-  {
-    free(pdata);
-    pdata = NULL;
-    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSG_BBD_MEM_FAIL);
-    return (ARKLS_MEM_FAIL);
-  }
-
-  /* Allocate memory for preconditioner matrix */
-  storage_mu    = SUNMIN(Nlocal - 1, muk + mlk);
-  pdata->savedP = NULL;
-  pdata->savedP = SUNBandMatrixStorage(Nlocal, muk, mlk, storage_mu,
-                                       ark_mem->sunctx);
-  if (pdata->savedP == NULL)
-  {
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSG_BBD_MEM_FAIL);
-    return (ARKLS_MEM_FAIL);
-  }
-
-  /* Allocate memory for temporary N_Vectors */
-
-  pdata->zlocal = NULL;
-  pdata->zlocal = N_VNewEmpty_Serial(Nlocal, ark_mem->sunctx);
-  if (pdata->zlocal == NULL)
-  {
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSG_BBD_MEM_FAIL);
-    return (ARKLS_MEM_FAIL);
-  }
-
-  pdata->rlocal = NULL;
-  pdata->rlocal = N_VNewEmpty_Serial(Nlocal, ark_mem->sunctx);
-  if (pdata->rlocal == NULL)
-  {
-    N_VDestroy(pdata->zlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSG_BBD_MEM_FAIL);
-    return (ARKLS_MEM_FAIL);
-  }
-
+  /* Allocate memory for temporary N_Vector */
   pdata->tmp1 = NULL;
   if (!arkAllocVec(ark_mem, ark_mem->tempv1, &(pdata->tmp1)))
   {
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
     free(pdata);
     pdata = NULL;
     arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
@@ -163,114 +116,30 @@ int ARKBBDPrecInit(void* arkode_mem, sunindextype Nlocal, sunindextype mudq,
     return (ARKLS_MEM_FAIL);
   }
 
-  pdata->tmp2 = NULL;
-  if (!arkAllocVec(ark_mem, ark_mem->tempv1, &(pdata->tmp2)))
-  {
-    arkFreeVec(ark_mem, &(pdata->tmp1));
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSG_BBD_MEM_FAIL);
-    return (ARKLS_MEM_FAIL);
-  }
-
-  pdata->tmp3 = NULL;
-  if (!arkAllocVec(ark_mem, ark_mem->tempv1, &(pdata->tmp3)))
-  {
-    arkFreeVec(ark_mem, &(pdata->tmp1));
-    arkFreeVec(ark_mem, &(pdata->tmp2));
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSG_BBD_MEM_FAIL);
-    return (ARKLS_MEM_FAIL);
-  }
-
-  /* Allocate memory for banded linear solver */
-  pdata->LS = NULL;
-  pdata->LS = SUNLinSol_Band(pdata->rlocal, pdata->savedP, ark_mem->sunctx);
-  if (pdata->LS == NULL)
-  {
-    arkFreeVec(ark_mem, &(pdata->tmp1));
-    arkFreeVec(ark_mem, &(pdata->tmp2));
-    arkFreeVec(ark_mem, &(pdata->tmp3));
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSG_BBD_MEM_FAIL);
-    return (ARKLS_MEM_FAIL);
-  }
+  /* Store Nlocal to be used in ARKBBDPrecSetup */
+  pdata->n_local = Nlocal;
 
-  /* initialize band linear solver object */
-  retval = SUNLinSolInitialize(pdata->LS);
-  if (pdata->LS == NULL)
+  /* Allocate matrices and band linear solver for a single local block */
+  pdata->nsub = 1;
+  pdata->sub  = NULL;
+  retval      = arkBBDAllocSubBlocks(ark_mem, pdata, 1, &(pdata->sub));
+  if (retval != ARKLS_SUCCESS)
   {
     arkFreeVec(ark_mem, &(pdata->tmp1));
-    arkFreeVec(ark_mem, &(pdata->tmp2));
-    arkFreeVec(ark_mem, &(pdata->tmp3));
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    SUNLinSolFree(pdata->LS);
     free(pdata);
     pdata = NULL;
-    arkProcessError(ark_mem, ARKLS_SUNLS_FAIL, __LINE__, __func__, __FILE__,
-                    MSG_BBD_SUNLS_FAIL);
-    return (ARKLS_SUNLS_FAIL);
+    arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                    (retval == ARKLS_MEM_FAIL) ? MSG_BBD_MEM_FAIL
+                                               : MSG_BBD_SUNLS_FAIL);
+    return (retval);
   }
+  pdata->jvalid = SUNFALSE;
 
   /* Set dqrely based on input dqrely (0 implies default). */
   pdata->dqrely = (dqrely > ZERO) ? dqrely : SUNRsqrt(ark_mem->uround);
 
-  /* Store Nlocal to be used in ARKBBDPrecSetup */
-  pdata->n_local = Nlocal;
-
   /* Set work space sizes and initialize nge */
-  pdata->rpwsize = 0;
-  pdata->ipwsize = 0;
-  if (ark_mem->tempv1->ops->nvspace)
-  {
-    N_VSpace(ark_mem->tempv1, &lrw1, &liw1);
-    pdata->rpwsize += 3 * lrw1;
-    pdata->ipwsize += 3 * liw1;
-  }
-  if (pdata->rlocal->ops->nvspace)
-  {
-    N_VSpace(pdata->rlocal, &lrw1, &liw1);
-    pdata->rpwsize += 2 * lrw1;
-    pdata->ipwsize += 2 * liw1;
-  }
-  if (pdata->savedJ->ops->space)
-  {
-    retval = SUNMatSpace(pdata->savedJ, &lrw, &liw);
-    pdata->rpwsize += lrw;
-    pdata->ipwsize += liw;
-  }
-  if (pdata->savedP->ops->space)
-  {
-    retval = SUNMatSpace(pdata->savedP, &lrw, &liw);
-    pdata->rpwsize += lrw;
-    pdata->ipwsize += liw;
-  }
-  if (pdata->LS->ops->space)
-  {
-    retval = SUNLinSolSpace(pdata->LS, &lrw, &liw);
-    pdata->rpwsize += lrw;
-    pdata->ipwsize += liw;
-  }
+  arkBBDWorkSpace(pdata);
   pdata->nge = 0;
 
   /* make sure P_data is free from any previous allocations */
@@ -325,6 +194,59 @@ int ARKBBDPrecReInit(void* arkode_mem, sunindextype mudq, sunindextype mldq,
   return (ARKLS_SUCCESS);
 }
 
+/*-------------------------------------------------------------*/
+int ARKBBDPrecSetNumSubBlocks(void* arkode_mem, int nsub)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  ARKBBDPrecData pdata;
+  ARKBBDSubBlock sub;
+  int retval;
+
+  /* access ARKodeMem and ARKLsMem structure */
+  retval = arkLs_AccessARKODELMem(arkode_mem, __func__, &ark_mem, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* Return immediately if ARKBBDPrecData is NULL */
+  if (arkls_mem->P_data == NULL)
+  {
+    arkProcessError(ark_mem, ARKLS_PMEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_BBD_PMEM_NULL);
+    return (ARKLS_PMEM_NULL);
+  }
+  pdata = (ARKBBDPrecData)arkls_mem->P_data;
+
+  if (nsub < 1 || nsub > pdata->n_local)
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_BBD_BAD_NSUB);
+    return (ARKLS_ILL_INPUT);
+  }
+  if (nsub == pdata->nsub) { return (ARKLS_SUCCESS); }
+
+  /* Allocate the new sub-blocks before releasing the current ones */
+  sub    = NULL;
+  retval = arkBBDAllocSubBlocks(ark_mem, pdata, nsub, &sub);
+  if (retval != ARKLS_SUCCESS)
+  {
+    arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                    (retval == ARKLS_MEM_FAIL) ? MSG_BBD_MEM_FAIL
+                                               : MSG_BBD_SUNLS_FAIL);
+    return (retval);
+  }
+
+  arkBBDFreeSubBlocks(ark_mem, pdata->nsub, pdata->sub);
+  pdata->nsub = nsub;
+  pdata->sub  = sub;
+
+  /* The next setup must compute new Jacobian blocks */
+  pdata->jvalid = SUNFALSE;
+
+  arkBBDWorkSpace(pdata);
+
+  return (ARKLS_SUCCESS);
+}
+
 /*-------------------------------------------------------------*/
 int ARKBBDPrecGetWorkSpace(void* arkode_mem, long int* lenrwBBDP,
                            long int* leniwBBDP)
@@ -433,32 +355,32 @@ static int ARKBBDPrecSetup(sunrealtype t, N_Vector y,
                            sunrealtype gamma, void* bbd_data)
 {
   ARKBBDPrecData pdata;
+  ARKBBDSubBlock sub;
   ARKodeMem ark_mem;
-  int retval;
+  int retval, s;
 
   pdata = (ARKBBDPrecData)bbd_data;
 
   ark_mem = (ARKodeMem)pdata->arkode_mem;
+  sub     = pdata->sub;
 
   /* If jok = SUNTRUE, use saved copy of J */
-  if (jok)
-  {
-    *jcurPtr = SUNFALSE;
-    retval   = SUNMatCopy(pdata->savedJ, pdata->savedP);
-    if (retval < 0)
-    {
-      arkProcessError(ark_mem, -1, __LINE__, __func__, __FILE__,
-                      MSG_BBD_SUNMAT_FAIL);
-      return (-1);
-    }
-    if (retval > 0) { return (1); }
+  if (jok && pdata->jvalid) { *jcurPtr = SUNFALSE; }
 
-    /* Otherwise call ARKBBDDQJac for new J value */
-  }
+  /* Otherwise call ARKBBDDQJac for new J value */
   else
   {
     *jcurPtr = SUNTRUE;
-    retval   = SUNMatZero(pdata->savedJ);
+
+    /* The sub-blocks share one SUNContext, so the parallel regions call the
+       object operations directly rather than the generic wrappers, which
+       access the profiler and error state stored in the context. */
+    SUNDIALS_OMP_PARALLEL_FOR(pdata->nsub)
+    for (s = 0; s < pdata->nsub; s++)
+    {
+      sub[s].retval = sub[s].savedJ->ops->zero(sub[s].savedJ);
+    }
+    retval = arkBBDSubBlockRetval(pdata);
     if (retval < 0)
     {
       arkProcessError(ark_mem, -1, __LINE__, __func__, __FILE__,
@@ -467,7 +389,7 @@ static int ARKBBDPrecSetup(sunrealtype t, N_Vector y,
     }
     if (retval > 0) { return (1); }
 
-    retval = ARKBBDDQJac(pdata, t, y, pdata->tmp1, pdata->tmp2, pdata->tmp3);
+    retval = ARKBBDDQJac(pdata, t, y, pdata->tmp1);
     if (retval < 0)
     {
       arkProcessError(ark_mem, -1, __LINE__, __func__, __FILE__,
@@ -476,28 +398,36 @@ static int ARKBBDPrecSetup(sunrealtype t, N_Vector y,
     }
     if (retval > 0) { return (1); }
 
-    retval = SUNMatCopy(pdata->savedJ, pdata->savedP);
-    if (retval < 0)
+    pdata->jvalid = SUNTRUE;
+  }
+
+  /* Copy J, scale and add I to get P = I - gamma*J, and do the LU
+     factorization of each sub-block. Matrix failures are flagged with -1,
+     failures of the band linear solver with the solver return value. */
+  SUNDIALS_OMP_PARALLEL_FOR(pdata->nsub)
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    if (sub[s].savedJ->ops->copy(sub[s].savedJ, sub[s].savedP) ||
+        sub[s].savedP->ops->scaleaddi(-gamma, sub[s].savedP))
     {
-      arkProcessError(ark_mem, -1, __LINE__, __func__, __FILE__,
-                      MSG_BBD_SUNMAT_FAIL);
-      return (-1);
+      sub[s].retval = -1;
     }
-    if (retval > 0) { return (1); }
+    else { sub[s].retval = sub[s].LS->ops->setup(sub[s].LS, sub[s].savedP); }
   }
 
-  /* Scale and add I to get P = I - gamma*J */
-  retval = SUNMatScaleAddI(-gamma, pdata->savedP);
-  if (retval)
+  /* Return the first error flag */
+  for (s = 0; s < pdata->nsub; s++)
   {
-    arkProcessError(ark_mem, -1, __LINE__, __func__, __FILE__,
-                    MSG_BBD_SUNMAT_FAIL);
-    return (-1);
+    if (sub[s].retval == -1)
+    {
+      arkProcessError(ark_mem, -1, __LINE__, __func__, __FILE__,
+                      MSG_BBD_SUNMAT_FAIL);
+      return (-1);
+    }
+    if (sub[s].retval != 0) { return (sub[s].retval); }
   }
 
-  /* Do LU factorization of matrix and return error flag */
-  retval = SUNLinSolSetup_Band(pdata->LS, pdata->savedP);
-  return (retval);
+  return (0);
 }
 
 /*---------------------------------------------------------------
@@ -526,24 +456,39 @@ static int ARKBBDPrecSolve(SUNDIALS_MAYBE_UNUSED sunrealtype t,
                            SUNDIALS_MAYBE_UNUSED sunrealtype delta,
                            SUNDIALS_MAYBE_UNUSED int lr, void* bbd_data)
 {
-  int retval;
   ARKBBDPrecData pdata;
+  ARKBBDSubBlock sub;
+  sunrealtype *r_data, *z_data;
+  int s;
 
-  pdata = (ARKBBDPrecData)bbd_data;
-
-  /* Attach local data arrays for r and z to rlocal and zlocal */
-  N_VSetArrayPointer(N_VGetArrayPointer(r), pdata->rlocal);
-  N_VSetArrayPointer(N_VGetArrayPointer(z), pdata->zlocal);
-
-  /* Call banded solver object to do the work */
-  retval = SUNLinSolSolve(pdata->LS, pdata->savedP, pdata->zlocal,
-                          pdata->rlocal, ZERO);
+  pdata  = (ARKBBDPrecData)bbd_data;
+  sub    = pdata->sub;
+  r_data = N_VGetArrayPointer(r);
+  z_data = N_VGetArrayPointer(z);
 
-  /* Detach local data arrays from rlocal and zlocal */
-  N_VSetArrayPointer(NULL, pdata->rlocal);
-  N_VSetArrayPointer(NULL, pdata->zlocal);
+  SUNDIALS_OMP_PARALLEL_FOR(pdata->nsub)
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    /* Attach local data arrays for r and z to rlocal and zlocal */
+    sub[s].rlocal->ops->nvsetarraypointer(r_data + sub[s].offset,
+                                          sub[s].rlocal);
+    sub[s].zlocal->ops->nvsetarraypointer(z_data + sub[s].offset,
+                                          sub[s].zlocal);
+
+    /* Copy r to z and solve with the band LU factors. The factors are used
+       directly as SUNLinSolSolve_Band calls the generic vector operations. */
+    sub[s].zlocal->ops->nvscale(ONE, sub[s].rlocal, sub[s].zlocal);
+    SUNDlsMat_bandGBTRS(SM_COLS_B(sub[s].savedP), SM_COLUMNS_B(sub[s].savedP),
+                        SM_SUBAND_B(sub[s].savedP), SM_LBAND_B(sub[s].savedP),
+                        BAND_PIVOTS(sub[s].LS), z_data + sub[s].offset);
+    sub[s].retval = 0;
+
+    /* Detach local data arrays from rlocal and zlocal */
+    sub[s].rlocal->ops->nvsetarraypointer(NULL, sub[s].rlocal);
+    sub[s].zlocal->ops->nvsetarraypointer(NULL, sub[s].zlocal);
+  }
 
-  return (retval);
+  return (arkBBDSubBlockRetval(pdata));
 }
 
 /*-------------------------------------------------------------*/
@@ -561,14 +506,8 @@ static int ARKBBDPrecFree(ARKodeMem ark_mem)
   if (arkls_mem->P_data == NULL) { return (0); }
   pdata = (ARKBBDPrecData)arkls_mem->P_data;
 
-  SUNLinSolFree(pdata->LS);
+  arkBBDFreeSubBlocks(ark_mem, pdata->nsub, pdata->sub);
   arkFreeVec(ark_mem, &(pdata->tmp1));
-  arkFreeVec(ark_mem, &(pdata->tmp2));
-  arkFreeVec(ark_mem, &(pdata->tmp3));
-  N_VDestroy(pdata->zlocal);
-  N_VDestroy(pdata->rlocal);
-  SUNMatDestroy(pdata->savedP);
-  SUNMatDestroy(pdata->savedJ);
 
   free(pdata);
   pdata = NULL;
@@ -589,21 +528,28 @@ static int ARKBBDPrecFree(ARKodeMem ark_mem)
  But the band matrix kept has bandwidth = mlkeep + mukeep + 1.
  This routine also assumes that the local elements of a vector are
  stored contiguously.
+
+ When the local block is split into sub-blocks, the column groups
+ are distributed over the sub-blocks' work vectors in a round-robin
+ fashion and evaluated concurrently. Each group sets the columns of
+ all sub-blocks, keeping only the elements that lie inside the
+ sub-block of the column.
 ---------------------------------------------------------------*/
 static int ARKBBDDQJac(ARKBBDPrecData pdata, sunrealtype t, N_Vector y,
-                       N_Vector gy, N_Vector ytemp, N_Vector gtemp)
+                       N_Vector gy)
 {
   ARKodeMem ark_mem;
-  sunrealtype gnorm, minInc, inc, inc_inv, yj, conj;
-  sunindextype group, i, j, width, ngroups, i1, i2;
-  sunrealtype *y_data, *ewt_data, *gy_data, *gtemp_data;
-  sunrealtype *ytemp_data, *col_j, *cns_data;
-  int retval;
+  ARKBBDSubBlock sub;
+  sunrealtype gnorm, minInc;
+  sunindextype width, ngroups;
+  sunrealtype *y_data, *ewt_data, *gy_data, *cns_data;
+  int retval, s;
 
   ark_mem = (ARKodeMem)pdata->arkode_mem;
+  sub     = pdata->sub;
 
-  /* Load ytemp with y = predicted solution vector */
-  N_VScale(ONE, y, ytemp);
+  /* Load each ytemp with y = predicted solution vector */
+  for (s = 0; s < pdata->nsub; s++) { N_VScale(ONE, y, sub[s].ytemp); }
 
   /* Call cfn and gloc to get base value of g(t,y) */
   if (pdata->cfn != NULL)
@@ -612,16 +558,14 @@ static int ARKBBDDQJac(ARKBBDPrecData pdata, sunrealtype t, N_Vector y,
     if (retval != 0) { return (retval); }
   }
 
-  retval = pdata->gloc(pdata->n_local, t, ytemp, gy, ark_mem->user_data);
+  retval = pdata->gloc(pdata->n_local, t, sub[0].ytemp, gy, ark_mem->user_data);
   pdata->nge++;
   if (retval != 0) { return (retval); }
 
   /* Obtain pointers to the data for various vectors */
-  y_data     = N_VGetArrayPointer(y);
-  gy_data    = N_VGetArrayPointer(gy);
-  ewt_data   = N_VGetArrayPointer(ark_mem->ewt);
-  ytemp_data = N_VGetArrayPointer(ytemp);
-  gtemp_data = N_VGetArrayPointer(gtemp);
+  y_data   = N_VGetArrayPointer(y);
+  gy_data  = N_VGetArrayPointer(gy);
+  ewt_data = N_VGetArrayPointer(ark_mem->ewt);
   cns_data = (ark_mem->constraintsSet) ? N_VGetArrayPointer(ark_mem->constraints)
                                        : NULL;
 
@@ -635,69 +579,269 @@ static int ARKBBDDQJac(ARKBBDPrecData pdata, sunrealtype t, N_Vector y,
   width   = pdata->mldq + pdata->mudq + 1;
   ngroups = SUNMIN(width, pdata->n_local);
 
-  /* Loop over groups */
-  for (group = 1; group <= ngroups; group++)
+  /* Loop over the groups assigned to each set of work vectors */
+  SUNDIALS_OMP_PARALLEL_FOR(pdata->nsub)
+  for (s = 0; s < pdata->nsub; s++)
   {
-    /* Increment all y_j in group */
-    for (j = group - 1; j < pdata->n_local; j += width)
-    {
-      inc = SUNMAX(pdata->dqrely * SUNRabs(y_data[j]), minInc / ewt_data[j]);
-      yj  = y_data[j];
+    sunrealtype inc, inc_inv, yj, conj;
+    sunrealtype *ytemp_data, *gtemp_data, *col_j;
+    sunindextype group, i, j, i1, i2, off;
+    int b;
 
-      /* Adjust sign(inc) again if yj has an inequality constraint. */
-      if (ark_mem->constraintsSet)
+    ytemp_data    = sub[s].ytemp->ops->nvgetarraypointer(sub[s].ytemp);
+    gtemp_data    = sub[s].gtemp->ops->nvgetarraypointer(sub[s].gtemp);
+    sub[s].nge    = 0;
+    sub[s].retval = 0;
+
+    for (group = s + 1; group <= ngroups; group += pdata->nsub)
+    {
+      /* Increment all y_j in group */
+      for (j = group - 1; j < pdata->n_local; j += width)
       {
-        conj = cns_data[j];
-        if (SUNRabs(conj) == ONE)
-        {
-          if ((yj + inc) * conj < ZERO) { inc = -inc; }
-        }
-        else if (SUNRabs(conj) == TWO)
+        inc = SUNMAX(pdata->dqrely * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+        yj  = y_data[j];
+
+        /* Adjust sign(inc) again if yj has an inequality constraint. */
+        if (ark_mem->constraintsSet)
         {
-          if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          }
         }
-      }
 
-      ytemp_data[j] += inc;
-    }
-
-    /* Evaluate g with incremented y */
-    retval = pdata->gloc(pdata->n_local, t, ytemp, gtemp, ark_mem->user_data);
-    pdata->nge++;
-    if (retval != 0) { return (retval); }
+        ytemp_data[j] += inc;
+      }
 
-    /* Restore ytemp, then form and load difference quotients */
-    for (j = group - 1; j < pdata->n_local; j += width)
-    {
-      yj            = y_data[j];
-      ytemp_data[j] = y_data[j];
-      col_j         = SUNBandMatrix_Column(pdata->savedJ, j);
-      inc = SUNMAX(pdata->dqrely * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+      /* Evaluate g with incremented y */
+      sub[s].retval = pdata->gloc(pdata->n_local, t, sub[s].ytemp,
+                                  sub[s].gtemp, ark_mem->user_data);
+      sub[s].nge++;
+      if (sub[s].retval != 0) { break; }
 
-      if (ark_mem->constraintsSet)
+      /* Restore ytemp, then form and load difference quotients */
+      b = 0;
+      for (j = group - 1; j < pdata->n_local; j += width)
       {
-        conj = cns_data[j];
-        if (SUNRabs(conj) == ONE)
+        yj            = y_data[j];
+        ytemp_data[j] = y_data[j];
+        inc = SUNMAX(pdata->dqrely * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+        if (ark_mem->constraintsSet)
         {
-          if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          }
         }
-        else if (SUNRabs(conj) == TWO)
+
+        /* Find the sub-block containing column j */
+        while (j >= sub[b].offset + sub[b].n) { b++; }
+        off   = sub[b].offset;
+        col_j = SM_COLUMN_B(sub[b].savedJ, j - off);
+
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(off, j - pdata->mukeep);
+        i2      = SUNMIN(j + pdata->mlkeep, off + sub[b].n - 1);
+        for (i = i1; i <= i2; i++)
         {
-          if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          SM_COLUMN_ELEMENT_B(col_j, i - off, j - off) =
+            inc_inv * (gtemp_data[i] - gy_data[i]);
         }
       }
+    }
+  }
 
-      inc_inv = ONE / inc;
-      i1      = SUNMAX(0, j - pdata->mukeep);
-      i2      = SUNMIN(j + pdata->mlkeep, pdata->n_local - 1);
-      for (i = i1; i <= i2; i++)
-      {
-        SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv * (gtemp_data[i] - gy_data[i]);
-      }
+  for (s = 0; s < pdata->nsub; s++) { pdata->nge += sub[s].nge; }
+
+  return (arkBBDSubBlockRetval(pdata));
+}
+
+/*---------------------------------------------------------------
+ arkBBDAllocSubBlocks:
+
+ This routine splits the local block into nsub sub-blocks of
+ nearly equal size and allocates the band matrices, band linear
+ solver, and work vectors of each sub-block. The half-bandwidths
+ kept are limited by the sub-block size. On failure all memory
+ allocated here is released and ARKLS_MEM_FAIL or ARKLS_SUNLS_FAIL
+ is returned.
+---------------------------------------------------------------*/
+static int arkBBDAllocSubBlocks(ARKodeMem ark_mem, ARKBBDPrecData pdata,
+                                int nsub, ARKBBDSubBlock* sub)
+{
+  ARKBBDSubBlock sb;
+  sunindextype n, muk, mlk, storage_mu;
+  int s;
+
+  sb = NULL;
+  sb = (ARKBBDSubBlock)malloc(nsub * sizeof(struct ARKBBDSubBlockRec));
+  if (sb == NULL) { return (ARKLS_MEM_FAIL); }
+
+  for (s = 0; s < nsub; s++)
+  {
+    sb[s].savedJ = NULL;
+    sb[s].savedP = NULL;
+    sb[s].LS     = NULL;
+    sb[s].zlocal = NULL;
+    sb[s].rlocal = NULL;
+    sb[s].ytemp  = NULL;
+    sb[s].gtemp  = NULL;
+    sb[s].nge    = 0;
+    sb[s].retval = 0;
+  }
+
+  for (s = 0; s < nsub; s++)
+  {
+    /* The first (n_local mod nsub) sub-blocks have one extra row */
+    n            = pdata->n_local / nsub;
+    sb[s].n      = n + ((s < pdata->n_local % nsub) ? 1 : 0);
+    sb[s].offset = s * n + SUNMIN(s, pdata->n_local % nsub);
+
+    muk        = SUNMIN(sb[s].n - 1, pdata->mukeep);
+    mlk        = SUNMIN(sb[s].n - 1, pdata->mlkeep);
+    storage_mu = SUNMIN(sb[s].n - 1, muk + mlk);
+
+    sb[s].savedJ = SUNBandMatrixStorage(sb[s].n, muk, mlk, muk,
+                                        ark_mem->sunctx);
+    sb[s].savedP = SUNBandMatrixStorage(sb[s].n, muk, mlk, storage_mu,
+                                        ark_mem->sunctx);
+    sb[s].zlocal = N_VNewEmpty_Serial(sb[s].n, ark_mem->sunctx);
+    sb[s].rlocal = N_VNewEmpty_Serial(sb[s].n, ark_mem->sunctx);
+    if (sb[s].savedJ == NULL || sb[s].savedP == NULL ||
+        sb[s].zlocal == NULL || sb[s].rlocal == NULL ||
+        !arkAllocVec(ark_mem, ark_mem->tempv1, &(sb[s].ytemp)) ||
+        !arkAllocVec(ark_mem, ark_mem->tempv1, &(sb[s].gtemp)))
+    {
+      arkBBDFreeSubBlocks(ark_mem, nsub, sb);
+      return (ARKLS_MEM_FAIL);
+    }
+
+    /* Allocate and initialize the band linear solver object */
+    sb[s].LS = SUNLinSol_Band(sb[s].rlocal, sb[s].savedP, ark_mem->sunctx);
+    if (sb[s].LS == NULL)
+    {
+      arkBBDFreeSubBlocks(ark_mem, nsub, sb);
+      return (ARKLS_MEM_FAIL);
+    }
+    if (SUNLinSolInitialize(sb[s].LS) != SUN_SUCCESS)
+    {
+      arkBBDFreeSubBlocks(ark_mem, nsub, sb);
+      return (ARKLS_SUNLS_FAIL);
     }
   }
 
-  return (0);
+  *sub = sb;
+  return (ARKLS_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+ arkBBDFreeSubBlocks:
+
+ This routine frees the sub-block array and all objects owned by
+ its entries.
+---------------------------------------------------------------*/
+static void arkBBDFreeSubBlocks(ARKodeMem ark_mem, int nsub,
+                                ARKBBDSubBlock sub)
+{
+  int s;
+
+  if (sub == NULL) { return; }
+
+  for (s = 0; s < nsub; s++)
+  {
+    if (sub[s].LS) { SUNLinSolFree(sub[s].LS); }
+    arkFreeVec(ark_mem, &(sub[s].ytemp));
+    arkFreeVec(ark_mem, &(sub[s].gtemp));
+    if (sub[s].zlocal) { N_VDestroy(sub[s].zlocal); }
+    if (sub[s].rlocal) { N_VDestroy(sub[s].rlocal); }
+    if (sub[s].savedP) { SUNMatDestroy(sub[s].savedP); }
+    if (sub[s].savedJ) { SUNMatDestroy(sub[s].savedJ); }
+  }
+  free(sub);
+}
+
+/*---------------------------------------------------------------
+ arkBBDWorkSpace:
+
+ This routine sets the real and integer work space sizes of the
+ preconditioner.
+---------------------------------------------------------------*/
+static void arkBBDWorkSpace(ARKBBDPrecData pdata)
+{
+  ARKBBDSubBlock sub;
+  sunindextype lrw1, liw1;
+  long int lrw, liw;
+  int s;
+
+  sub            = pdata->sub;
+  pdata->rpwsize = 0;
+  pdata->ipwsize = 0;
+  if (pdata->tmp1->ops->nvspace)
+  {
+    N_VSpace(pdata->tmp1, &lrw1, &liw1);
+    pdata->rpwsize += (1 + 2 * pdata->nsub) * lrw1;
+    pdata->ipwsize += (1 + 2 * pdata->nsub) * liw1;
+  }
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    if (sub[s].rlocal->ops->nvspace)
+    {
+      N_VSpace(sub[s].rlocal, &lrw1, &liw1);
+      pdata->rpwsize += 2 * lrw1;
+      pdata->ipwsize += 2 * liw1;
+    }
+    if (sub[s].savedJ->ops->space)
+    {
+      SUNMatSpace(sub[s].savedJ, &lrw, &liw);
+      pdata->rpwsize += lrw;
+      pdata->ipwsize += liw;
+    }
+    if (sub[s].savedP->ops->space)
+    {
+      SUNMatSpace(sub[s].savedP, &lrw, &liw);
+      pdata->rpwsize += lrw;
+      pdata->ipwsize += liw;
+    }
+    if (sub[s].LS->ops->space)
+    {
+      SUNLinSolSpace(sub[s].LS, &lrw, &liw);
+      pdata->rpwsize += lrw;
+      pdata->ipwsize += liw;
+    }
+  }
+}
+
+/*---------------------------------------------------------------
+ arkBBDSubBlockRetval:
+
+ This routine combines the return values of the sub-blocks. It
+ returns the first negative (unrecoverable) value if there is one,
+ otherwise the first positive (recoverable) value, and 0 if all
+ sub-blocks succeeded.
+---------------------------------------------------------------*/
+static int arkBBDSubBlockRetval(ARKBBDPrecData pdata)
+{
+  int retval, s;
+
+  retval = 0;
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    if (pdata->sub[s].retval < 0) { return (pdata->sub[s].retval); }
+    if (retval == 0) { retval = pdata->sub[s].retval; }
+  }
+
+  return (retval);
 }
 
 /*---------------------------------------------------------------
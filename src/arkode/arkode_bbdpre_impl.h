@@ -25,6 +25,30 @@
 extern "C" {
 #endif
 
+/*---------------------------------------------------------------
+ Type: ARKBBDSubBlock
+
+ The local block may be split into several independent diagonal
+ sub-blocks, each with its own band matrices and band solver, so
+ that they can be formed, factored, and solved concurrently. The
+ ytemp and gtemp vectors are the difference quotient work vectors
+ of the thread that handles the sub-block.
+---------------------------------------------------------------*/
+typedef struct ARKBBDSubBlockRec
+{
+  sunindextype offset; /* first local row of the sub-block */
+  sunindextype n;      /* number of rows in the sub-block  */
+  SUNMatrix savedJ;
+  SUNMatrix savedP;
+  SUNLinearSolver LS;
+  N_Vector zlocal;
+  N_Vector rlocal;
+  N_Vector ytemp;
+  N_Vector gtemp;
+  long int nge;
+  int retval;
+}* ARKBBDSubBlock;
+
 /*---------------------------------------------------------------
  Type: ARKBBDPrecData
 ---------------------------------------------------------------*/
@@ -37,14 +61,10 @@ typedef struct ARKBBDPrecDataRec
   ARKCommFn cfn;
 
   /* set by ARKBBDPrecSetup and used by ARKBBDPrecSolve */
-  SUNMatrix savedJ;
-  SUNMatrix savedP;
-  SUNLinearSolver LS;
+  int nsub;
+  ARKBBDSubBlock sub;
   N_Vector tmp1;
-  N_Vector tmp2;
-  N_Vector tmp3;
-  N_Vector zlocal;
-  N_Vector rlocal;
+  sunbooleantype jvalid;
 
   /* set by ARKBBDPrecAlloc and used by ARKBBDPrecSetup */
   sunindextype n_local;
@@ -75,6 +95,8 @@ typedef struct ARKBBDPrecDataRec
   "BBD peconditioner memory is NULL. ARKBBDPrecInit must be called."
 #define MSG_BBD_FUNC_FAILED \
   "The gloc or cfn routine failed in an unrecoverable manner."
+#define MSG_BBD_BAD_NSUB \
+  "The number of sub-blocks must be between 1 and the local block size."
 
 #ifdef __cplusplus
 }
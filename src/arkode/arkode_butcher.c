@@ -435,6 +435,53 @@ sunbooleantype ARKodeButcherTable_IsStifflyAccurate(ARKodeButcherTable B)
   return SUNTRUE;
 }
 
+/*---------------------------------------------------------------
+  Routine to partition the stages of a (diagonally implicit)
+  Butcher table into groups of consecutive, mutually independent
+  stages.  Stages i and j are in the same group when neither
+  depends on the other, i.e., A[i][j] = A[j][i] = 0.  All stage
+  solves within a group may therefore be performed concurrently
+  once all earlier groups have been computed.
+
+  Inputs:
+     B: Butcher table to partition
+
+  Outputs:
+     ngroups: number of stage groups
+     group: array of length B->stages (allocated by the caller)
+        holding the group index of each stage [optional]
+
+  Return values:
+     0 (success)
+     -1 (failure): B or ngroups is NULL
+  ---------------------------------------------------------------*/
+int ARKodeButcherTable_GetStageGroups(ARKodeButcherTable B, int* ngroups,
+                                      int* group)
+{
+  int i, j, start;
+
+  if (B == NULL || ngroups == NULL) { return (-1); }
+
+  *ngroups = 0;
+  start    = 0;
+  for (i = 0; i < B->stages; i++)
+  {
+    /* start a new group if stage i is coupled to the current group */
+    for (j = start; j < i; j++)
+    {
+      if (SUNRabs(B->A[i][j]) > TINY)
+      {
+        start = i;
+        break;
+      }
+    }
+    if (start == i) { (*ngroups)++; }
+    if (group) { group[i] = *ngroups - 1; }
+  }
+
+  return (0);
+}
+
 /*---------------------------------------------------------------
   Routine to determine the analytical order of accuracy for a
   specified Butcher table.  We check the analytical [necessary]
@@ -566,6 +566,9 @@ struct ARKodeMemRec
   /* User-supplied stage solution post-processing function */
   ARKPostProcessFn ProcessStage;
 
+  /* Step trace, NULL if disabled */
+  SUNStepTrace trace;
+
   sunbooleantype use_compensated_sums;
 
   /* Adjoint solver data */
@@ -663,6 +666,9 @@ int arkCheckConvergence(ARKodeMem ark_mem, int* nflagPtr, int* ncfPtr);
 int arkCheckConstraints(ARKodeMem ark_mem, int* nflag, int* constrfails);
 int arkCheckTemporalError(ARKodeMem ark_mem, int* nflagPtr, int* nefPtr,
                           sunrealtype dsm);
+void arkTraceBeginStep(ARKodeMem ark_mem);
+void arkTraceEndStepIf(ARKodeMem ark_mem, sunbooleantype condition,
+                       SUNStepTraceStatus status, sunrealtype dsm);
 int arkAccessHAdaptMem(void* arkode_mem, const char* fname, ARKodeMem* ark_mem,
                        ARKodeHAdaptMem* hadapt_mem);
 
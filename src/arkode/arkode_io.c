@@ -1230,6 +1230,28 @@ int ARKodeSetStopTime(void* arkode_mem, sunrealtype tstop)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetStepTrace:
+
+  Attaches a step trace that records every step attempt, a NULL
+  trace disables recording.
+  ---------------------------------------------------------------*/
+int ARKodeSetStepTrace(void* arkode_mem, SUNStepTrace trace)
+{
+  ARKodeMem ark_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  ark_mem->trace = trace;
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeSetInterpolateStopTime:
 
@@ -18,7 +18,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sundials/sundials_math.h>
+#include <sunlinsol/sunlinsol_band.h>
+#include <sunlinsol/sunlinsol_dense.h>
 #include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_blocktridiag.h>
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunmatrix/sunmatrix_sparse.h>
 
@@ -216,6 +219,8 @@ int ARKodeSetLinearSolver(void* arkode_mem, SUNLinearSolver LS, SUNMatrix A)
   /* Set default values for the rest of the LS parameters */
   arkls_mem->msbj      = ARKLS_MSBJ;
   arkls_mem->jbad      = SUNTRUE;
+  sunJacPolicy_Init(&arkls_mem->jpolicy, SUNFALSE);
+  sunDQThreads_Init(&arkls_mem->dqthreads);
   arkls_mem->eplifac   = ARKLS_EPLIN;
   arkls_mem->last_flag = ARKLS_SUCCESS;
 
@@ -782,6 +787,93 @@ int ARKodeSetJacEvalFrequency(void* arkode_mem, long int msbj)
   return (ARKLS_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetAdaptiveJacEval enables or disables choosing when to
+  recompute the Jacobian matrix and/or preconditioner from the
+  measured solver costs.
+  ---------------------------------------------------------------*/
+int ARKodeSetAdaptiveJacEval(void* arkode_mem, sunbooleantype onoff)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  int retval;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__,
+                    "time-stepping module does not require an algebraic "
+                    "solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  if (onoff && !SUN_JACPOLICY_AVAILABLE)
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The adaptive policy requires POSIX or Windows timers.");
+    return (ARKLS_ILL_INPUT);
+  }
+
+  /* store input and return */
+  sunJacPolicy_Init(&arkls_mem->jpolicy, onoff);
+
+  return (ARKLS_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSetDQJacNumThreads sets the number of threads used to
+  evaluate the columns of the internal dense or band DQ Jacobian.
+  With more than one thread the implicit RHS function is called
+  concurrently with the same (shared) user_data pointer and must
+  be thread-safe.
+  ---------------------------------------------------------------*/
+int ARKodeSetDQJacNumThreads(void* arkode_mem, int nthreads)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  int retval;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not require an algebraic solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* values < 2 select the serial approximation */
+  sunDQThreads_SetNumThreads(&arkls_mem->dqthreads, nthreads);
+
+  return (ARKLS_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeSetLinearSolutionScaling enables or disables scaling the
   linear solver solution to account for changes in gamma.
@@ -2569,7 +2661,7 @@ int arkLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   ARKodeMem ark_mem;
   ARKLsMem arkls_mem;
   ARKRhsFn fi;
-  int retval;
+  int retval, nthreads;
 
   /* access ARKodeMem and ARKLsMem structures */
   retval = arkLs_AccessARKODELMem(arkode_mem, __func__, &ark_mem, &arkls_mem);
@@ -2606,15 +2698,31 @@ int arkLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
     return (ARKLS_ILL_INPUT);
   }
 
+  /* Number of threads for the dense and band approximations */
+  nthreads = arkls_mem->dqthreads.nthreads;
+
   /* Call the matrix-structure-specific DQ approximation routine */
-  if (SUNMatGetID(Jac) == SUNMATRIX_DENSE)
+  if (SUNMatGetID(Jac) == SUNMATRIX_DENSE && nthreads > 1)
+  {
+    retval = arkLsDenseDQJacThreaded(t, y, fy, Jac, ark_mem, arkls_mem, fi);
+  }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_DENSE)
   {
     retval = arkLsDenseDQJac(t, y, fy, Jac, ark_mem, arkls_mem, fi, tmp1);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BAND && nthreads > 1)
+  {
+    retval = arkLsBandDQJacThreaded(t, y, fy, Jac, ark_mem, arkls_mem, fi);
+  }
   else if (SUNMatGetID(Jac) == SUNMATRIX_BAND)
   {
     retval = arkLsBandDQJac(t, y, fy, Jac, ark_mem, arkls_mem, fi, tmp1, tmp2);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BLOCKTRIDIAG)
+  {
+    retval = arkLsBlockTridiagDQJac(t, y, fy, Jac, ark_mem, arkls_mem, fi, tmp1,
+                                    tmp2);
+  }
   else
   {
     arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -2829,6 +2937,376 @@ int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  arkLsDenseDQJacThreaded:
+
+  This routine generates the same dense difference quotient
+  approximation as arkLsDenseDQJac with the columns distributed over
+  the threads set by ARKodeSetDQJacNumThreads. Thread s perturbs its
+  own copy of y and computes the columns s, s + nthreads, ... so the
+  implicit RHS function is called concurrently.
+  ---------------------------------------------------------------*/
+int arkLsDenseDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                            SUNMatrix Jac, ARKodeMem ark_mem,
+                            ARKLsMem arkls_mem, ARKRhsFn fi)
+{
+  sunrealtype fnorm, minInc, srur;
+  sunrealtype *y_data, *fy_data, *ewt_data, *cns_data;
+  sunindextype N;
+  sunDQThread* thread;
+  int nthreads, s;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access matrix dimension */
+  N = SUNDenseMatrix_Columns(Jac);
+
+  /* Allocate the work vectors of each thread (on first use) */
+  if (sunDQThreads_Alloc(&arkls_mem->dqthreads, y, SUNFALSE))
+  {
+    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (ARKLS_MEM_FAIL);
+  }
+  nthreads = arkls_mem->dqthreads.nthreads;
+  thread   = arkls_mem->dqthreads.thread;
+
+  /* Obtain pointers to the data for ewt, y, fy */
+  ewt_data = N_VGetArrayPointer(ark_mem->ewt);
+  y_data   = N_VGetArrayPointer(y);
+  fy_data  = N_VGetArrayPointer(fy);
+  if (ark_mem->constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(ark_mem->constraints);
+  }
+
+  /* Load each ytemp with y */
+  for (s = 0; s < nthreads; s++) { N_VScale(ONE, y, thread[s].ytemp); }
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(ark_mem->uround);
+  fnorm  = N_VWrmsNorm(fy, ark_mem->rwt);
+  minInc = (fnorm != ZERO)
+             ? (MIN_INC_MULT * SUNRabs(ark_mem->h) * ark_mem->uround * N * fnorm)
+             : ONE;
+
+  /* Loop over the columns assigned to each thread */
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < nthreads; s++)
+  {
+    sunrealtype inc, inc_inv, conj;
+    sunrealtype *ytemp_data, *ftemp_data, *col_j;
+    sunindextype i, j;
+
+    ytemp_data       = N_VGetArrayPointer(thread[s].ytemp);
+    ftemp_data       = N_VGetArrayPointer(thread[s].ftemp);
+    thread[s].nfe    = 0;
+    thread[s].retval = 0;
+
+    for (j = s; j < N; j += nthreads)
+    {
+      inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) if y_j has an inequality constraint. */
+      if (ark_mem->constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((y_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((y_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[j] += inc;
+
+      thread[s].retval = fi(t, thread[s].ytemp, thread[s].ftemp,
+                            ark_mem->user_data);
+      thread[s].nfe++;
+      if (thread[s].retval != 0) { break; }
+
+      ytemp_data[j] = y_data[j];
+
+      /* Generate the jth col of J(tn,y) */
+      inc_inv = ONE / inc;
+      col_j   = SUNDenseMatrix_Column(Jac, j);
+      for (i = 0; i < N; i++)
+      {
+        col_j[i] = inc_inv * (ftemp_data[i] - fy_data[i]);
+      }
+    }
+  }
+
+  return (sunDQThreads_Finalize(&arkls_mem->dqthreads, &arkls_mem->nfeDQ));
+}
+
+/*---------------------------------------------------------------
+  arkLsBandDQJacThreaded:
+
+  This routine generates the same banded difference quotient
+  approximation as arkLsBandDQJac with the column groups distributed
+  over the threads set by ARKodeSetDQJacNumThreads. Thread s perturbs
+  its own copy of y and computes the groups s + 1, s + 1 + nthreads,
+  ... so the implicit RHS function is called concurrently.
+  ---------------------------------------------------------------*/
+int arkLsBandDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                           SUNMatrix Jac, ARKodeMem ark_mem,
+                           ARKLsMem arkls_mem, ARKRhsFn fi)
+{
+  sunrealtype fnorm, minInc, srur;
+  sunrealtype *ewt_data, *fy_data, *y_data, *cns_data;
+  sunindextype width, ngroups, N, mupper, mlower;
+  sunDQThread* thread;
+  int nthreads, s;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access matrix dimensions */
+  N      = SUNBandMatrix_Columns(Jac);
+  mupper = SUNBandMatrix_UpperBandwidth(Jac);
+  mlower = SUNBandMatrix_LowerBandwidth(Jac);
+
+  /* Allocate the work vectors of each thread (on first use) */
+  if (sunDQThreads_Alloc(&arkls_mem->dqthreads, y, SUNFALSE))
+  {
+    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (ARKLS_MEM_FAIL);
+  }
+  nthreads = arkls_mem->dqthreads.nthreads;
+  thread   = arkls_mem->dqthreads.thread;
+
+  /* Obtain pointers to the data for ewt, fy, y */
+  ewt_data = N_VGetArrayPointer(ark_mem->ewt);
+  fy_data  = N_VGetArrayPointer(fy);
+  y_data   = N_VGetArrayPointer(y);
+  if (ark_mem->constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(ark_mem->constraints);
+  }
+
+  /* Load each ytemp with y = predicted y vector */
+  for (s = 0; s < nthreads; s++) { N_VScale(ONE, y, thread[s].ytemp); }
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(ark_mem->uround);
+  fnorm  = N_VWrmsNorm(fy, ark_mem->rwt);
+  minInc = (fnorm != ZERO)
+             ? (MIN_INC_MULT * SUNRabs(ark_mem->h) * ark_mem->uround * N * fnorm)
+             : ONE;
+
+  /* Set bandwidth and number of column groups for band differencing */
+  width   = mlower + mupper + 1;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over the column groups assigned to each thread */
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < nthreads; s++)
+  {
+    sunrealtype inc, inc_inv, conj;
+    sunrealtype *ytemp_data, *ftemp_data, *col_j;
+    sunindextype group, i, j, i1, i2;
+
+    ytemp_data       = N_VGetArrayPointer(thread[s].ytemp);
+    ftemp_data       = N_VGetArrayPointer(thread[s].ftemp);
+    thread[s].nfe    = 0;
+    thread[s].retval = 0;
+
+    for (group = s + 1; group <= ngroups; group += nthreads)
+    {
+      /* Increment all y_j in group */
+      for (j = group - 1; j < N; j += width)
+      {
+        inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+        /* Adjust sign(inc) if yj has an inequality constraint. */
+        if (ark_mem->constraintsSet)
+        {
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+          }
+        }
+
+        ytemp_data[j] += inc;
+      }
+
+      /* Evaluate f with incremented y */
+      thread[s].retval = fi(t, thread[s].ytemp, thread[s].ftemp,
+                            ark_mem->user_data);
+      thread[s].nfe++;
+      if (thread[s].retval != 0) { break; }
+
+      /* Restore ytemp, then form and load difference quotients */
+      for (j = group - 1; j < N; j += width)
+      {
+        ytemp_data[j] = y_data[j];
+        col_j         = SUNBandMatrix_Column(Jac, j);
+        inc           = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+        /* Adjust sign(inc) as before. */
+        if (ark_mem->constraintsSet)
+        {
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+          }
+        }
+
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(0, j - mupper);
+        i2      = SUNMIN(j + mlower, N - 1);
+        for (i = i1; i <= i2; i++)
+        {
+          SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv *
+                                             (ftemp_data[i] - fy_data[i]);
+        }
+      }
+    }
+  }
+
+  return (sunDQThreads_Finalize(&arkls_mem->dqthreads, &arkls_mem->nfeDQ));
+}
+
+/*---------------------------------------------------------------
+  arkLsBlockTridiagDQJac:
+
+  This routine generates a block-tridiagonal difference quotient
+  approximation to the Jacobian of f(t,y). Columns whose blocks are
+  at least three block columns apart do not share any nonzero rows,
+  so the columns are perturbed in 3*blocksize groups as in the band
+  case. The entries of each column are loaded directly into the
+  sub-diagonal, diagonal, and super-diagonal blocks using the
+  SUNMATRIX_BLOCKTRIDIAG accessor macros.
+  ---------------------------------------------------------------*/
+int arkLsBlockTridiagDQJac(sunrealtype t, N_Vector y, N_Vector fy,
+                           SUNMatrix Jac, ARKodeMem ark_mem,
+                           ARKLsMem arkls_mem, ARKRhsFn fi, N_Vector tmp1,
+                           N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, conj;
+  sunrealtype *block, *ewt_data, *fy_data, *ftemp_data, *y_data, *ytemp_data;
+  sunrealtype* cns_data;
+  sunindextype group, i, j, width, ngroups, I, I1, I2;
+  sunindextype N, bs, nb;
+  int retval = 0;
+
+  /* access matrix dimensions */
+  N  = SM_COLUMNS_BT(Jac);
+  bs = SM_BLOCKSIZE_BT(Jac);
+  nb = SM_NBLOCKS_BT(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(ark_mem->ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  cns_data = (ark_mem->constraintsSet) ? N_VGetArrayPointer(ark_mem->constraints)
+                                       : NULL;
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(ark_mem->uround);
+  fnorm  = N_VWrmsNorm(fy, ark_mem->rwt);
+  minInc = (fnorm != ZERO)
+             ? (MIN_INC_MULT * SUNRabs(ark_mem->h) * ark_mem->uround * N * fnorm)
+             : ONE;
+
+  /* Set width and number of column groups for block differencing */
+  width   = 3 * bs;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over column groups. */
+  for (group = 1; group <= ngroups; group++)
+  {
+    /* Increment all y_j in group */
+    for (j = group - 1; j < N; j += width)
+    {
+      inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (ark_mem->constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[j] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = fi(t, ytemp, ftemp, ark_mem->user_data);
+    arkls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (j = group - 1; j < N; j += width)
+    {
+      ytemp_data[j] = y_data[j];
+      inc           = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) as before. */
+      if (ark_mem->constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      inc_inv = ONE / inc;
+      I1      = SUNMAX(0, j / bs - 1);
+      I2      = SUNMIN(j / bs + 1, nb - 1);
+      for (I = I1; I <= I2; I++)
+      {
+        block = SM_BLOCK_BT(Jac, I, j / bs);
+        for (i = 0; i < bs; i++)
+        {
+          SM_BLOCK_ELEMENT_BT(block, i, j % bs, bs) =
+            inc_inv * (ftemp_data[I * bs + i] - fy_data[I * bs + i]);
+        }
+      }
+    }
+  }
+
+  return (retval);
+}
+
 /*---------------------------------------------------------------
   arkLsDQJtimes:
 
@@ -3011,13 +3489,14 @@ int arkLsInitialize(ARKodeMem ark_mem)
       /* Check if an internal or user-supplied Jacobian function is used */
       if (arkls_mem->jacDQ)
       {
-        /* Internal difference quotient Jacobian. Check that A is dense or band,
-           otherwise return an error */
+        /* Internal difference quotient Jacobian. Check that A is dense, band,
+           or block-tridiagonal, otherwise return an error */
         retval = 0;
         if (arkls_mem->A->ops->getid)
         {
           if ((SUNMatGetID(arkls_mem->A) == SUNMATRIX_DENSE) ||
-              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BAND))
+              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BAND) ||
+              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BLOCKTRIDIAG))
           {
             arkls_mem->jac    = arkLsDQJac;
             arkls_mem->J_data = ark_mem;
@@ -3119,6 +3598,7 @@ int arkLsInitialize(ARKodeMem ark_mem)
 
   /* reset counters */
   arkLsInitializeCounters(arkls_mem);
+  sunJacPolicy_Init(&arkls_mem->jpolicy, arkls_mem->jpolicy.enabled);
 
   /* Set Jacobian-vector product related fields, based on jtimesDQ */
   if (arkls_mem->jtimesDQ)
@@ -3169,7 +3649,7 @@ int arkLsSetup(ARKodeMem ark_mem, int convfail, sunrealtype tpred,
   void* ark_step_massmem = NULL;
   SUNMatrix M            = NULL;
   sunrealtype gamma, gamrat;
-  sunbooleantype dgamma_fail, *jcur;
+  sunbooleantype dgamma_fail, jstale, *jcur;
   int retval;
 
   /* access ARKLsMem structure */
@@ -3199,12 +3679,19 @@ int arkLsSetup(ARKodeMem ark_mem, int convfail, sunrealtype tpred,
     return (arkls_mem->last_flag);
   }
 
-  /* Use initsetup, gamma/gammap, and convfail to set J/P eval. flag jok;
+  /* Use initsetup, the Jacobian age (or the adaptive policy), gamma/gammap,
+     and convfail to set J/P eval. flag jok;
      Note: the "ARK_FAIL_BAD_J" test is asking whether the nonlinear
      solver converged due to a bad system Jacobian AND our gamma was
      fine, indicating that the J and/or P were invalid */
-  arkls_mem->jbad = (ark_mem->initsetup) ||
-                    (ark_mem->nst >= arkls_mem->nstlj + arkls_mem->msbj) ||
+  if (arkls_mem->jpolicy.enabled)
+  {
+    jstale = sunJacPolicy_Update(&arkls_mem->jpolicy, ark_mem->nst);
+    sunJacPolicy_BeginSetup(&arkls_mem->jpolicy);
+  }
+  else { jstale = (ark_mem->nst >= arkls_mem->nstlj + arkls_mem->msbj); }
+
+  arkls_mem->jbad = (ark_mem->initsetup) || jstale ||
                     ((convfail == ARK_FAIL_BAD_J) && (!dgamma_fail)) ||
                     (convfail == ARK_FAIL_OTHER);
 
@@ -3291,6 +3778,12 @@ int arkLsSetup(ARKodeMem ark_mem, int convfail, sunrealtype tpred,
     if (arkls_mem->jbad) { *jcurPtr = SUNTRUE; }
   }
 
+  /* Update the measured setup costs */
+  if (arkls_mem->jpolicy.enabled)
+  {
+    sunJacPolicy_EndSetup(&arkls_mem->jpolicy, *jcurPtr);
+  }
+
   return (arkls_mem->last_flag);
 }
 
@@ -3320,6 +3813,12 @@ int arkLsSolve(ARKodeMem ark_mem, N_Vector b, sunrealtype tnow, N_Vector ynow,
   retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
   if (retval != ARK_SUCCESS) { return (retval); }
 
+  /* Update the measured Newton iteration cost */
+  if (arkls_mem->jpolicy.enabled)
+  {
+    sunJacPolicy_Solve(&arkls_mem->jpolicy, mnewt);
+  }
+
   /* Set scalar tcur and vectors ycur and fcur for use by the
      Atimes and Psolve interface routines */
   arkls_mem->tcur = tnow;
@@ -3516,6 +4015,105 @@ int arkLsSolve(ARKodeMem ark_mem, N_Vector b, sunrealtype tnow, N_Vector ynow,
   return (0);
 }
 
+/*---------------------------------------------------------------
+  arkLsStageCreate creates a matrix and a linear solver for a
+  stage that is solved concurrently with the other stages of its
+  group (see arkStep_StageGroupInit).  The matrix is a clone of
+  the attached matrix and the solver is the dense or band solver
+  matching its type.  Only direct solvers with a dense or band
+  matrix and without a user-supplied linear system function are
+  supported.
+  ---------------------------------------------------------------*/
+int arkLsStageCreate(ARKodeMem ark_mem, SUNMatrix* A, SUNLinearSolver* LS)
+{
+  ARKLsMem arkls_mem;
+  int retval;
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  if (arkls_mem->iterative || arkls_mem->user_linsys ||
+      ((SUNMatGetID(arkls_mem->A) != SUNMATRIX_DENSE) &&
+       (SUNMatGetID(arkls_mem->A) != SUNMATRIX_BAND)))
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Concurrent stage solves require a direct linear solver "
+                    "with a dense or band matrix and the internal linear "
+                    "system function");
+    return (ARKLS_ILL_INPUT);
+  }
+
+  *A = SUNMatClone(arkls_mem->A);
+  if (*A == NULL)
+  {
+    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (ARKLS_MEM_FAIL);
+  }
+
+  if (SUNMatGetID(*A) == SUNMATRIX_DENSE)
+  {
+    *LS = SUNLinSol_Dense(arkls_mem->x, *A, ark_mem->sunctx);
+  }
+  else { *LS = SUNLinSol_Band(arkls_mem->x, *A, ark_mem->sunctx); }
+  if (*LS == NULL)
+  {
+    SUNMatDestroy(*A);
+    *A = NULL;
+    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (ARKLS_MEM_FAIL);
+  }
+
+  if (SUNLinSolInitialize(*LS) != SUN_SUCCESS)
+  {
+    arkProcessError(ark_mem, ARKLS_SUNLS_FAIL, __LINE__, __func__, __FILE__,
+                    "Unable to initialize the stage linear solver");
+    return (ARKLS_SUNLS_FAIL);
+  }
+
+  return (ARKLS_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkLsStageSetup forms and factors the stage matrix
+  A = I - gamma*J from the Jacobian saved by the last call to
+  arkLsSetup.  This routine is called concurrently for the stages
+  of a group and therefore only reads the ARKLS data.
+  ---------------------------------------------------------------*/
+int arkLsStageSetup(ARKodeMem ark_mem, sunrealtype gamma, SUNMatrix A,
+                    SUNLinearSolver LS)
+{
+  ARKLsMem arkls_mem = (ARKLsMem)ark_mem->step_getlinmem(ark_mem);
+
+  if (SUNMatCopy(arkls_mem->savedJ, A)) { return (ARKLS_SUNMAT_FAIL); }
+  if (SUNMatScaleAddI(-gamma, A)) { return (ARKLS_SUNMAT_FAIL); }
+
+  return (SUNLinSolSetup(LS, A));
+}
+
+/*---------------------------------------------------------------
+  arkLsStageSolve solves A x = b in place with the matrix and
+  linear solver of a concurrently solved stage, or with the
+  attached ones if LS is NULL.  This routine is called
+  concurrently for the stages of a group.
+  ---------------------------------------------------------------*/
+int arkLsStageSolve(ARKodeMem ark_mem, SUNMatrix A, SUNLinearSolver LS,
+                    N_Vector b)
+{
+  ARKLsMem arkls_mem;
+
+  if (LS == NULL)
+  {
+    arkls_mem = (ARKLsMem)ark_mem->step_getlinmem(ark_mem);
+    A         = arkls_mem->A;
+    LS        = arkls_mem->LS;
+  }
+
+  return (SUNLinSolSolve(LS, A, b, b, ZERO));
+}
+
 /*---------------------------------------------------------------
   arkLsFree frees memory associates with the ARKLs system
   solver interface.
@@ -3543,6 +4141,9 @@ int arkLsFree(ARKodeMem ark_mem)
     arkls_mem->x = NULL;
   }
 
+  /* Free threaded DQ Jacobian work vectors */
+  sunDQThreads_Free(&arkls_mem->dqthreads);
+
   /* Free savedJ memory */
   if (arkls_mem->savedJ)
   {
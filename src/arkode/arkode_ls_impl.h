@@ -21,6 +21,8 @@
 #include <arkode/arkode_ls.h>
 
 #include "arkode_impl.h"
+#include "sundials_dqjac_impl.h"
+#include "sundials_jacpolicy_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -87,6 +89,12 @@ typedef struct ARKLsMemRec
   long int njtimes;  /* njtimes = total number of calls to jtimes    */
   sunrealtype tnlj;  /* tnlj = t_n at last jac/pset call             */
 
+  /* Adaptive Jacobian evaluation policy (replaces msbj when enabled) */
+  sunJacPolicy jpolicy;
+
+  /* Threaded difference quotient Jacobian (dense and band) */
+  sunDQThreads dqthreads;
+
   /* Preconditioner computation
     (a) user-provided:
         - P_data == user_data
@@ -216,6 +224,16 @@ int arkLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
 int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                    ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
                    N_Vector tmp1, N_Vector tmp2);
+int arkLsDenseDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                            SUNMatrix Jac, ARKodeMem ark_mem,
+                            ARKLsMem arkls_mem, ARKRhsFn fi);
+int arkLsBandDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                           SUNMatrix Jac, ARKodeMem ark_mem,
+                           ARKLsMem arkls_mem, ARKRhsFn fi);
+int arkLsBlockTridiagDQJac(sunrealtype t, N_Vector y, N_Vector fy,
+                           SUNMatrix Jac, ARKodeMem ark_mem,
+                           ARKLsMem arkls_mem, ARKRhsFn fi, N_Vector tmp1,
+                           N_Vector tmp2);
 
 /* Generic linit/lsetup/lsolve/lfree interface routines for ARKODE to call */
 int arkLsInitialize(ARKodeMem ark_mem);
@@ -226,6 +244,13 @@ int arkLsSolve(ARKodeMem ark_mem, N_Vector b, sunrealtype tcur, N_Vector ycur,
                N_Vector fcur, sunrealtype eRnrm, int mnewt);
 int arkLsFree(ARKodeMem ark_mem);
 
+/* Matrix and linear solver routines for concurrent stage solves */
+int arkLsStageCreate(ARKodeMem ark_mem, SUNMatrix* A, SUNLinearSolver* LS);
+int arkLsStageSetup(ARKodeMem ark_mem, sunrealtype gamma, SUNMatrix A,
+                    SUNLinearSolver LS);
+int arkLsStageSolve(ARKodeMem ark_mem, SUNMatrix A, SUNLinearSolver LS,
+                    N_Vector b);
+
 /* Generic minit/msetup/mmult/msolve/mfree routines for ARKODE to call */
 int arkLsMassInitialize(ARKodeMem ark_mem);
 int arkLsMassSetup(ARKodeMem ark_mem, sunrealtype t, N_Vector vtemp1,
@@ -0,0 +1,522 @@
+/*---------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *---------------------------------------------------------------
+ * This is the implementation file for the ARKODE parareal module.
+ *
+ * The interval [t0, tf] is split into N slices [t_n, t_{n+1}]
+ * and the slice initial values U_n are computed with the
+ * parareal iteration
+ *
+ *   U_{n+1}^{k+1} = G(U_n^{k+1}) + F(U_n^k) - G(U_n^k),
+ *
+ * where G is the (cheap) coarse propagator and F the (accurate)
+ * fine propagator over one slice. The fine propagations of an
+ * iteration are independent and are executed concurrently with
+ * one fine SUNStepper per thread, while the coarse propagations
+ * form a serial sweep. After k iterations the first k slice
+ * values agree with the sequential fine solution, so these
+ * slices are skipped in later iterations. This is also the
+ * two-level MGRIT algorithm with F-relaxation.
+ *--------------------------------------------------------------*/
+
+#include <stdlib.h>
+
+#include <arkode/arkode.h>
+#include <arkode/arkode_parareal.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_nvector.h>
+
+#include "arkode_impl.h"
+#include "arkode_parareal_impl.h"
+#include "sundials_macros.h"
+
+#define MSG_PARAREAL_NO_MEM "pr_mem = NULL illegal."
+
+/*---------------------------------------------------------------
+  Private helper functions
+  ---------------------------------------------------------------*/
+
+static sunbooleantype arkPararealCheckStepper(SUNStepper stepper)
+{
+  SUNStepper_Ops ops;
+
+  if (stepper == NULL) { return SUNFALSE; }
+  ops = stepper->ops;
+  return ops->evolve != NULL && ops->reset != NULL &&
+         ops->setstoptime != NULL && ops->setstepdirection != NULL;
+}
+
+static void arkPararealFreeVectors(ARKPararealMem pr_mem)
+{
+  if (pr_mem->U) { N_VDestroyVectorArray(pr_mem->U, pr_mem->nalloc + 1); }
+  if (pr_mem->F) { N_VDestroyVectorArray(pr_mem->F, pr_mem->nalloc); }
+  if (pr_mem->G) { N_VDestroyVectorArray(pr_mem->G, pr_mem->nalloc); }
+  if (pr_mem->tmp) { N_VDestroy(pr_mem->tmp); }
+  pr_mem->U      = NULL;
+  pr_mem->F      = NULL;
+  pr_mem->G      = NULL;
+  pr_mem->tmp    = NULL;
+  pr_mem->nalloc = 0;
+}
+
+static int arkPararealAllocVectors(ARKPararealMem pr_mem, N_Vector tmpl)
+{
+  if (pr_mem->nalloc == pr_mem->nslices) { return ARK_SUCCESS; }
+
+  arkPararealFreeVectors(pr_mem);
+
+  pr_mem->U   = N_VCloneVectorArray(pr_mem->nslices + 1, tmpl);
+  pr_mem->F   = N_VCloneVectorArray(pr_mem->nslices, tmpl);
+  pr_mem->G   = N_VCloneVectorArray(pr_mem->nslices, tmpl);
+  pr_mem->tmp = N_VClone(tmpl);
+  if (pr_mem->U == NULL || pr_mem->F == NULL || pr_mem->G == NULL ||
+      pr_mem->tmp == NULL)
+  {
+    pr_mem->nalloc = pr_mem->nslices;
+    arkPararealFreeVectors(pr_mem);
+    return ARK_MEM_FAIL;
+  }
+  pr_mem->nalloc = pr_mem->nslices;
+
+  return ARK_SUCCESS;
+}
+
+/* Evolves y0 at t0 to y1 at t1 with the given stepper */
+static int arkPararealPropagate(SUNStepper stepper, sunrealtype t0,
+                                sunrealtype t1, N_Vector y0, N_Vector y1)
+{
+  sunrealtype tret;
+
+  if (SUNStepper_Reset(stepper, t0, y0)) { return ARK_INNERSTEP_FAIL; }
+  if (SUNStepper_SetStepDirection(stepper, t1 - t0))
+  {
+    return ARK_INNERSTEP_FAIL;
+  }
+  if (SUNStepper_SetStopTime(stepper, t1)) { return ARK_INNERSTEP_FAIL; }
+  if (SUNStepper_Evolve(stepper, t1, y1, &tret)) { return ARK_INNERSTEP_FAIL; }
+
+  return ARK_SUCCESS;
+}
+
+/* Time at the start of slice n */
+static sunrealtype arkPararealSliceTime(ARKPararealMem pr_mem, sunrealtype t0,
+                                        sunrealtype tf, int n)
+{
+  if (n == pr_mem->nslices) { return tf; }
+  return t0 + (tf - t0) * ((sunrealtype)n / (sunrealtype)pr_mem->nslices);
+}
+
+/* Fine propagation of the slices first + i, first + i + nthreads, ... with
+   the i-th fine stepper */
+static int arkPararealFineSweep(ARKPararealMem pr_mem, int i, int nthreads,
+                                int first, sunrealtype t0, sunrealtype tf)
+{
+  int n, retval;
+
+  for (n = first + i; n < pr_mem->nslices; n += nthreads)
+  {
+    retval = arkPararealPropagate(pr_mem->fine[i],
+                                  arkPararealSliceTime(pr_mem, t0, tf, n),
+                                  arkPararealSliceTime(pr_mem, t0, tf, n + 1),
+                                  pr_mem->U[n], pr_mem->F[n]);
+    if (retval != ARK_SUCCESS) { return retval; }
+  }
+
+  return ARK_SUCCESS;
+}
+
+/*---------------------------------------------------------------
+  Exported functions
+  ---------------------------------------------------------------*/
+
+/*---------------------------------------------------------------
+  ARKPararealCreate:
+
+  Creates the parareal memory structure from a coarse stepper and
+  nfine fine steppers. Up to nfine slices are propagated with the
+  fine steppers concurrently, so the fine steppers must not share
+  any mutable state.
+  ---------------------------------------------------------------*/
+void* ARKPararealCreate(SUNStepper coarse, int nfine, SUNStepper* fine,
+                        SUNContext sunctx)
+{
+  ARKPararealMem pr_mem;
+  int i;
+
+  if (sunctx == NULL)
+  {
+    arkProcessError(NULL, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NULL_SUNCTX);
+    return NULL;
+  }
+
+  if (!arkPararealCheckStepper(coarse))
+  {
+    arkProcessError(NULL, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The coarse stepper must be non-NULL and implement "
+                    "SUNStepper_Evolve, SUNStepper_Reset, "
+                    "SUNStepper_SetStopTime, and SUNStepper_SetStepDirection");
+    return NULL;
+  }
+
+  if (nfine < 1 || fine == NULL)
+  {
+    arkProcessError(NULL, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "At least one fine stepper is required");
+    return NULL;
+  }
+
+  for (i = 0; i < nfine; i++)
+  {
+    if (!arkPararealCheckStepper(fine[i]))
+    {
+      arkProcessError(NULL, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "fine[%d] must be non-NULL and implement "
+                      "SUNStepper_Evolve, SUNStepper_Reset, "
+                      "SUNStepper_SetStopTime, and SUNStepper_SetStepDirection",
+                      i);
+      return NULL;
+    }
+  }
+
+  pr_mem = (ARKPararealMem)malloc(sizeof(struct ARKPararealMemRec));
+  if (pr_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_ARKMEM_FAIL);
+    return NULL;
+  }
+
+  pr_mem->sunctx = sunctx;
+  pr_mem->coarse = coarse;
+  pr_mem->nfine  = nfine;
+  pr_mem->fine   = NULL;
+  pr_mem->flags  = NULL;
+
+  pr_mem->nslices  = nfine;
+  pr_mem->maxiters = 0;
+  pr_mem->reltol   = ARK_PARAREAL_RELTOL;
+  pr_mem->abstol   = ARK_PARAREAL_ABSTOL;
+
+  pr_mem->nalloc = 0;
+  pr_mem->U      = NULL;
+  pr_mem->F      = NULL;
+  pr_mem->G      = NULL;
+  pr_mem->tmp    = NULL;
+
+  pr_mem->niters    = 0;
+  pr_mem->ntotiters = 0;
+  pr_mem->unorm     = SUN_RCONST(0.0);
+
+  pr_mem->fine  = (SUNStepper*)malloc(nfine * sizeof(SUNStepper));
+  pr_mem->flags = (int*)malloc(nfine * sizeof(int));
+  if (pr_mem->fine == NULL || pr_mem->flags == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_ARKMEM_FAIL);
+    ARKPararealFree((void**)&pr_mem);
+    return NULL;
+  }
+  for (i = 0; i < nfine; i++) { pr_mem->fine[i] = fine[i]; }
+
+  return (void*)pr_mem;
+}
+
+/*---------------------------------------------------------------
+  ARKPararealSetNumSlices:
+
+  Sets the number of time slices (default nfine).
+  ---------------------------------------------------------------*/
+int ARKPararealSetNumSlices(void* pr_mem, int nslices)
+{
+  ARKPararealMem pr;
+
+  if (pr_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_PARAREAL_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+  pr = (ARKPararealMem)pr_mem;
+
+  if (nslices < 0)
+  {
+    arkProcessError(NULL, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The number of slices must be non-negative");
+    return ARK_ILL_INPUT;
+  }
+
+  pr->nslices = (nslices == 0) ? pr->nfine : nslices;
+
+  return ARK_SUCCESS;
+}
+
+/*---------------------------------------------------------------
+  ARKPararealSetMaxIters:
+
+  Sets the maximum number of parareal iterations. A value of zero
+  (the default) allows as many iterations as there are slices, at
+  which point the iteration reproduces the fine solution.
+  ---------------------------------------------------------------*/
+int ARKPararealSetMaxIters(void* pr_mem, int maxiters)
+{
+  if (pr_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_PARAREAL_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+
+  ((ARKPararealMem)pr_mem)->maxiters = (maxiters < 0) ? 0 : maxiters;
+
+  return ARK_SUCCESS;
+}
+
+/*---------------------------------------------------------------
+  ARKPararealSetTolerances:
+
+  Sets the tolerances for the convergence test. The iteration has
+  converged when, for every slice, the change in the slice value
+  satisfies ||U^k - U^{k-1}||_max <= reltol ||U^k||_max + abstol.
+  Non-positive values restore the defaults.
+  ---------------------------------------------------------------*/
+int ARKPararealSetTolerances(void* pr_mem, sunrealtype reltol,
+                             sunrealtype abstol)
+{
+  ARKPararealMem pr;
+
+  if (pr_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_PARAREAL_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+  pr = (ARKPararealMem)pr_mem;
+
+  pr->reltol = (reltol <= SUN_RCONST(0.0)) ? ARK_PARAREAL_RELTOL : reltol;
+  pr->abstol = (abstol <= SUN_RCONST(0.0)) ? ARK_PARAREAL_ABSTOL : abstol;
+
+  return ARK_SUCCESS;
+}
+
+/*---------------------------------------------------------------
+  ARKPararealEvolve:
+
+  Computes the solution yf at tf of the IVP with initial value y0
+  at t0 with the parareal iteration. Returns ARK_SUCCESS if the
+  iteration converged and ARK_CONV_FAILURE if the maximum number
+  of iterations was reached first, in which case yf holds the
+  last iterate.
+  ---------------------------------------------------------------*/
+int ARKPararealEvolve(void* pr_mem, sunrealtype t0, N_Vector y0,
+                      sunrealtype tf, N_Vector yf)
+{
+  ARKPararealMem pr;
+  N_Vector Unew, tmp;
+  sunrealtype tn, tn1, dnorm, ynorm;
+  sunbooleantype converged;
+  int N, maxiters, first, nthreads, i, k, n, retval;
+
+  if (pr_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_PARAREAL_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+  pr = (ARKPararealMem)pr_mem;
+
+  if (y0 == NULL || yf == NULL)
+  {
+    arkProcessError(NULL, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NULL_Y0);
+    return ARK_ILL_INPUT;
+  }
+
+  if (tf == t0)
+  {
+    arkProcessError(NULL, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_ARK_TOO_CLOSE);
+    return ARK_ILL_INPUT;
+  }
+
+  retval = arkPararealAllocVectors(pr, y0);
+  if (retval != ARK_SUCCESS)
+  {
+    arkProcessError(NULL, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return ARK_MEM_FAIL;
+  }
+
+  N        = pr->nslices;
+  maxiters = (pr->maxiters > 0 && pr->maxiters < N) ? pr->maxiters : N;
+
+  pr->niters = 0;
+  pr->unorm  = SUN_RCONST(0.0);
+
+  /* initial coarse sweep */
+  N_VScale(SUN_RCONST(1.0), y0, pr->U[0]);
+  for (n = 0; n < N; n++)
+  {
+    tn     = arkPararealSliceTime(pr, t0, tf, n);
+    tn1    = arkPararealSliceTime(pr, t0, tf, n + 1);
+    retval = arkPararealPropagate(pr->coarse, tn, tn1, pr->U[n], pr->G[n]);
+    if (retval != ARK_SUCCESS) { return retval; }
+    N_VScale(SUN_RCONST(1.0), pr->G[n], pr->U[n + 1]);
+  }
+
+  converged = SUNFALSE;
+  for (k = 1; k <= maxiters && !converged; k++)
+  {
+    /* the slices before first have converged to the fine solution */
+    first    = k - 1;
+    nthreads = SUNMIN(pr->nfine, N - first);
+
+    /* concurrent fine propagation of the remaining slices */
+    SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+    for (i = 0; i < nthreads; i++)
+    {
+      pr->flags[i] = arkPararealFineSweep(pr, i, nthreads, first, t0, tf);
+    }
+    for (i = 0; i < nthreads; i++)
+    {
+      if (pr->flags[i] != ARK_SUCCESS) { return pr->flags[i]; }
+    }
+
+    /* serial coarse sweep applying the parareal correction, the value at the
+       end of the first remaining slice is the fine solution */
+    pr->unorm = SUN_RCONST(0.0);
+    converged = SUNTRUE;
+    for (n = first; n < N; n++)
+    {
+      if (n == first) { N_VScale(SUN_RCONST(1.0), pr->G[n], pr->tmp); }
+      else
+      {
+        tn     = arkPararealSliceTime(pr, t0, tf, n);
+        tn1    = arkPararealSliceTime(pr, t0, tf, n + 1);
+        retval = arkPararealPropagate(pr->coarse, tn, tn1, pr->U[n], pr->tmp);
+        if (retval != ARK_SUCCESS) { return retval; }
+      }
+
+      /* Unew = G(U^{k}_n) + F(U^{k-1}_n) - G(U^{k-1}_n), stored in G[n] */
+      Unew = pr->G[n];
+      if (n == first) { N_VScale(SUN_RCONST(1.0), pr->F[n], Unew); }
+      else
+      {
+        N_VLinearSum(SUN_RCONST(1.0), pr->F[n], -SUN_RCONST(1.0), Unew, Unew);
+        N_VLinearSum(SUN_RCONST(1.0), pr->tmp, SUN_RCONST(1.0), Unew, Unew);
+      }
+
+      /* change in the slice value, F[n] is no longer needed */
+      N_VLinearSum(SUN_RCONST(1.0), Unew, -SUN_RCONST(1.0), pr->U[n + 1],
+                   pr->F[n]);
+      dnorm     = N_VMaxNorm(pr->F[n]);
+      ynorm     = N_VMaxNorm(Unew);
+      pr->unorm = SUNMAX(pr->unorm, dnorm);
+      if (dnorm > pr->reltol * ynorm + pr->abstol) { converged = SUNFALSE; }
+
+      /* rotate the vectors so that U[n+1] = Unew and G[n] = G(U^{k}_n) */
+      tmp          = pr->U[n + 1];
+      pr->U[n + 1] = Unew;
+      pr->G[n]     = pr->tmp;
+      pr->tmp      = tmp;
+    }
+
+    pr->niters++;
+    pr->ntotiters++;
+
+    /* after N iterations all slices agree with the fine solution */
+    if (k == N) { converged = SUNTRUE; }
+  }
+
+  N_VScale(SUN_RCONST(1.0), pr->U[N], yf);
+
+  return converged ? ARK_SUCCESS : ARK_CONV_FAILURE;
+}
+
+/*---------------------------------------------------------------
+  ARKPararealGetNumIters:
+
+  Returns the number of iterations in the last call to
+  ARKPararealEvolve.
+  ---------------------------------------------------------------*/
+int ARKPararealGetNumIters(void* pr_mem, int* niters)
+{
+  if (pr_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_PARAREAL_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+
+  *niters = ((ARKPararealMem)pr_mem)->niters;
+
+  return ARK_SUCCESS;
+}
+
+/*---------------------------------------------------------------
+  ARKPararealGetTotalIters:
+
+  Returns the total number of iterations in all calls to
+  ARKPararealEvolve.
+  ---------------------------------------------------------------*/
+int ARKPararealGetTotalIters(void* pr_mem, long int* niters)
+{
+  if (pr_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_PARAREAL_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+
+  *niters = ((ARKPararealMem)pr_mem)->ntotiters;
+
+  return ARK_SUCCESS;
+}
+
+/*---------------------------------------------------------------
+  ARKPararealGetUpdateNorm:
+
+  Returns the largest max norm of the change in a slice value in
+  the last iteration.
+  ---------------------------------------------------------------*/
+int ARKPararealGetUpdateNorm(void* pr_mem, sunrealtype* unorm)
+{
+  if (pr_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_PARAREAL_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+
+  *unorm = ((ARKPararealMem)pr_mem)->unorm;
+
+  return ARK_SUCCESS;
+}
+
+/*---------------------------------------------------------------
+  ARKPararealFree:
+
+  Frees the parareal memory structure. The steppers are owned by
+  the user and are not destroyed.
+  ---------------------------------------------------------------*/
+void ARKPararealFree(void** pr_mem)
+{
+  ARKPararealMem pr;
+
+  if (pr_mem == NULL || *pr_mem == NULL) { return; }
+  pr = (ARKPararealMem)(*pr_mem);
+
+  arkPararealFreeVectors(pr);
+  free(pr->fine);
+  free(pr->flags);
+  free(pr);
+  *pr_mem = NULL;
+}
@@ -0,0 +1,56 @@
+/*---------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *---------------------------------------------------------------
+ * Implementation header file for the ARKODE parareal module.
+ *--------------------------------------------------------------*/
+
+#ifndef ARKODE_PARAREAL_IMPL_H_
+#define ARKODE_PARAREAL_IMPL_H_
+
+#include <arkode/arkode_parareal.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_stepper.h>
+
+/* Default convergence tolerances */
+#define ARK_PARAREAL_RELTOL SUN_RCONST(1.0e-6)
+#define ARK_PARAREAL_ABSTOL SUN_RCONST(1.0e-10)
+
+typedef struct ARKPararealMemRec
+{
+  SUNContext sunctx;
+
+  /* propagators */
+  SUNStepper coarse; /* coarse propagator, used serially                */
+  SUNStepper* fine;  /* fine propagators, one per concurrent time slice */
+  int nfine;         /* number of fine propagators                      */
+
+  /* options */
+  int nslices;        /* number of time slices (default nfine)             */
+  int maxiters;       /* maximum number of iterations (0 = nslices)        */
+  sunrealtype reltol; /* relative and absolute tolerances on the change in */
+  sunrealtype abstol; /* the slice initial values between iterations       */
+
+  /* slice vectors */
+  int nalloc;  /* number of slices the vectors are allocated for */
+  N_Vector* U; /* initial values of the slices, U[nslices] = yf  */
+  N_Vector* F; /* fine propagation of each slice                 */
+  N_Vector* G; /* coarse propagation of each slice               */
+  N_Vector tmp;
+  int* flags; /* return flags of the fine propagators */
+
+  /* statistics */
+  int niters;         /* iterations in the last call to ARKPararealEvolve */
+  long int ntotiters; /* total number of iterations                       */
+  sunrealtype unorm;  /* max norm of the last update of the slice values  */
+
+}* ARKPararealMem;
+
+#endif
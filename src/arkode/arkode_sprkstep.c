@@ -18,6 +18,7 @@
 #include "arkode/arkode_sprkstep.h"
 
 #include <arkode/arkode.h>
+#include <nvector/nvector_manyvector.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -120,6 +121,10 @@ void* SPRKStepCreate(ARKRhsFn f1, ARKRhsFn f2, sunrealtype t0, N_Vector y0,
   ark_mem->step_getnumrhsevals  = sprkStep_GetNumRhsEvals;
   ark_mem->step_mem             = (void*)step_mem;
 
+  /* Set stepper capabilities */
+  ark_mem->step_supports_adaptive = SUNTRUE;
+  ark_mem->step_getestlocalerrors = sprkStep_GetEstLocalErrors;
+
   /* Set default values for optional inputs */
   retval = sprkStep_SetDefaults((void*)ark_mem);
   if (retval != ARK_SUCCESS)
@@ -137,7 +142,9 @@ void* SPRKStepCreate(ARKRhsFn f1, ARKRhsFn f2, sunrealtype t0, N_Vector y0,
   /* Initialize the counters */
   step_mem->nf1    = 0;
   step_mem->nf2    = 0;
+  step_mem->nde    = 0;
   step_mem->istage = 0;
+  step_mem->znst   = -1;
 
   /* SPRKStep uses Lagrange interpolation by default, since Hermite is
      less compatible with these methods. */
@@ -219,7 +226,9 @@ int SPRKStepReInit(void* arkode_mem, ARKRhsFn f1, ARKRhsFn f2, sunrealtype t0,
   /* Initialize the counters */
   step_mem->nf1    = 0;
   step_mem->nf2    = 0;
+  step_mem->nde    = 0;
   step_mem->istage = 0;
+  step_mem->znst   = -1;
 
   /* Zero yerr for compensated summation */
   if (ark_mem->use_compensated_sums) { N_VConst(ZERO, step_mem->yerr); }
@@ -279,6 +288,18 @@ int sprkStep_Resize(ARKodeMem ark_mem, N_Vector y0,
     N_VConst(ZERO, step_mem->yerr);
   }
 
+  if (step_mem->yerr_new)
+  {
+    if (!arkResizeVec(ark_mem, resize, resize_data, lrw_diff, liw_diff, y0,
+                      &step_mem->yerr_new))
+    {
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      "Unable to resize vector");
+      return (ARK_MEM_FAIL);
+    }
+  }
+  step_mem->yerr_nst = -1;
+
   return (ARK_SUCCESS);
 }
 
@@ -303,6 +324,8 @@ int sprkStep_Reset(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tR,
   {
     N_VConst(SUN_RCONST(0.0), step_mem->yerr);
   }
+  step_mem->yerr_nst = -1;
+  step_mem->znst     = -1;
   return (ARK_SUCCESS);
 }
 
@@ -333,6 +356,15 @@ void sprkStep_Free(ARKodeMem ark_mem)
       step_mem->yerr = NULL;
     }
 
+    if (step_mem->yerr_new != NULL)
+    {
+      arkFreeVec(ark_mem, &step_mem->yerr_new);
+      step_mem->yerr_new = NULL;
+    }
+
+    free(step_mem->dahat);
+    free(step_mem->da);
+
     ARKodeSPRKTable_Free(step_mem->method);
 
     free(ark_mem->step_mem);
@@ -425,8 +457,49 @@ int sprkStep_Init(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tout,
     ark_mem->interp_degree = 1;
   }
 
+  /* Compute the embedding used for temporal error estimation */
+  free(step_mem->dahat);
+  free(step_mem->da);
+  step_mem->dahat = (sunrealtype*)calloc(step_mem->method->stages,
+                                         sizeof(sunrealtype));
+  step_mem->da = (sunrealtype*)calloc(step_mem->method->stages,
+                                      sizeof(sunrealtype));
+  if (step_mem->dahat == NULL || step_mem->da == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+  step_mem->p = sprkStep_ComputeEmbedding(step_mem->method, step_mem->dahat,
+                                          step_mem->da);
+
+  /* Store the method and embedding orders for the step size controller */
+  ark_mem->hadapt_mem->q = step_mem->method->q;
+  ark_mem->hadapt_mem->p = step_mem->p;
+
+  /* Ensure that if adaptivity or error accumulation is enabled, then the
+     method has an embedding */
+  if ((!ark_mem->fixedstep || (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE)) &&
+      (step_mem->p < 1))
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Temporal error estimation requires an SPRK method of "
+                    "order 2 or higher");
+    return (ARK_ILL_INPUT);
+  }
+
+  /* The reversible step size control replaces the fixed step size */
+  if (step_mem->density && !ark_mem->fixedstep)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Reversible step size control requires fixed step mode");
+    return (ARK_ILL_INPUT);
+  }
+
   /* Zero yerr for compensated summation */
   if (ark_mem->use_compensated_sums) { N_VConst(ZERO, step_mem->yerr); }
+  step_mem->yerr_nst = -1;
+  step_mem->znst     = -1;
 
   return (ARK_SUCCESS);
 }
@@ -529,6 +602,7 @@ int sprkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
   N_Vector curr_stage        = NULL;
   sunrealtype ci             = SUN_RCONST(0.0);
   sunrealtype chati          = SUN_RCONST(0.0);
+  sunbooleantype estimate    = SUNFALSE;
   int is                     = 0;
   int retval                 = 0;
 
@@ -536,6 +610,18 @@ int sprkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
   retval = sprkStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return (retval); }
 
+  /* select the step size with the reversible control */
+  if (step_mem->density)
+  {
+    retval = sprkStep_ReversibleStepSize(ark_mem, step_mem);
+    if (retval != ARK_SUCCESS) { return (retval); }
+  }
+
+  /* zero the local error estimate */
+  estimate = !ark_mem->fixedstep ||
+             (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE);
+  if (estimate) { N_VConst(ZERO, ark_mem->tempv4); }
+
   prev_stage = ark_mem->yn;
   curr_stage = ark_mem->ycur;
   for (is = 0; is < step_mem->method->stages; is++)
@@ -571,6 +657,13 @@ int sprkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
       return ARK_RHSFUNC_FAIL;
     }
 
+    /* accumulate the local error estimate */
+    if (estimate)
+    {
+      N_VLinearSum(ONE, ark_mem->tempv4, ark_mem->h * step_mem->dahat[is],
+                   step_mem->sdata, ark_mem->tempv4);
+    }
+
     /* position update */
     N_VLinearSum(ONE, prev_stage, ark_mem->h * ahati, step_mem->sdata,
                  curr_stage);
@@ -596,6 +689,13 @@ int sprkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
       return ARK_RHSFUNC_FAIL;
     }
 
+    /* accumulate the local error estimate */
+    if (estimate)
+    {
+      N_VLinearSum(ONE, ark_mem->tempv4, ark_mem->h * step_mem->da[is],
+                   step_mem->sdata, ark_mem->tempv4);
+    }
+
     /* velocity update */
     N_VLinearSum(ONE, curr_stage, ark_mem->h * ai, step_mem->sdata, curr_stage);
 
@@ -623,6 +723,173 @@ int sprkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
   *nflagPtr = 0;
   *dsmPtr   = 0;
 
+  /* compute the local error estimate norm */
+  if (estimate)
+  {
+    *dsmPtr = N_VWrmsNorm(ark_mem->tempv4, ark_mem->ewt);
+    SUNLogExtraDebugVec(ARK_LOGGER, "error estimate", ark_mem->tempv4,
+                        "yerr(:) =");
+  }
+
+  SUNLogExtraDebugVec(ARK_LOGGER, "updated solution", ark_mem->ycur, "ycur(:) =");
+
+  return ARK_SUCCESS;
+}
+
+/* Partitioned formulation of SPRK for a ManyVector state y = [p, q].
+   The momentum and position subvectors of ycur are updated in place, so each
+   half stage only touches the part of the state that changes and the RHS
+   outputs do not need to be zeroed. The update and the local error estimate
+   are applied with a single fused vector operation, and the optional force
+   update function evaluates f1 and updates p in one call. */
+int sprkStep_TakeStep_Partitioned(ARKodeMem ark_mem, sunrealtype* dsmPtr,
+                                  int* nflagPtr)
+{
+  ARKodeSPRKStepMem step_mem = NULL;
+  N_Vector p                 = NULL;
+  N_Vector q                 = NULL;
+  N_Vector f1p               = NULL;
+  N_Vector f2q               = NULL;
+  N_Vector Z[2]              = {NULL, NULL};
+  sunrealtype cvals[2]       = {ZERO, ZERO};
+  sunrealtype ci             = SUN_RCONST(0.0);
+  sunrealtype chati          = SUN_RCONST(0.0);
+  sunbooleantype estimate    = SUNFALSE;
+  int nvec                   = 1;
+  int is                     = 0;
+  int retval                 = 0;
+
+  /* access ARKodeSPRKStepMem structure */
+  retval = sprkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* select the step size with the reversible control */
+  if (step_mem->density)
+  {
+    retval = sprkStep_ReversibleStepSize(ark_mem, step_mem);
+    if (retval != ARK_SUCCESS) { return (retval); }
+  }
+
+  /* zero the local error estimate */
+  estimate = !ark_mem->fixedstep ||
+             (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE);
+  if (estimate) { N_VConst(ZERO, ark_mem->tempv4); }
+  nvec = estimate ? 2 : 1;
+
+  /* access the momentum and position subvectors */
+  p   = N_VGetSubvector_ManyVector(ark_mem->ycur, 0);
+  q   = N_VGetSubvector_ManyVector(ark_mem->ycur, 1);
+  f1p = N_VGetSubvector_ManyVector(step_mem->sdata, 0);
+  f2q = N_VGetSubvector_ManyVector(step_mem->sdata, 1);
+
+  /* the stages are computed in place in ycur */
+  N_VScale(ONE, ark_mem->yn, ark_mem->ycur);
+
+  for (is = 0; is < step_mem->method->stages; is++)
+  {
+    /* load/compute coefficients */
+    sunrealtype ai    = step_mem->method->a[is];
+    sunrealtype ahati = step_mem->method->ahat[is];
+
+    ci += ai;
+    chati += ahati;
+
+    /* store current stage index */
+    step_mem->istage = is;
+
+    SUNLogInfo(ARK_LOGGER, "begin-stage",
+               "stage = %i, t = " SUN_FORMAT_G ", that = " SUN_FORMAT_G, is,
+               ark_mem->tn + ci * ark_mem->h, ark_mem->tn + chati * ark_mem->h);
+    SUNLogExtraDebugVec(ARK_LOGGER, "stage", ark_mem->ycur, "z2_%i(:) =", is);
+
+    /* momentum update p = p + h ahat_i f1(q) */
+    if (step_mem->force_update && !estimate)
+    {
+      retval = step_mem->force_update(ark_mem->tn + chati * ark_mem->h, q,
+                                      ark_mem->h * ahati, p,
+                                      ark_mem->user_data);
+      step_mem->nf1++;
+    }
+    else
+    {
+      retval = sprkStep_f1(step_mem, ark_mem->tn + chati * ark_mem->h,
+                           ark_mem->ycur, step_mem->sdata, ark_mem->user_data);
+
+      SUNLogExtraDebugVec(ARK_LOGGER, "stage RHS", f1p, "f1_%i(:) =", is);
+
+      if (retval == 0)
+      {
+        /* fused update and local error estimate accumulation */
+        cvals[0] = ark_mem->h * ahati;
+        cvals[1] = ark_mem->h * step_mem->dahat[is];
+        Z[0]     = p;
+        Z[1]     = N_VGetSubvector_ManyVector(ark_mem->tempv4, 0);
+        N_VScaleAddMulti(nvec, cvals, f1p, Z, Z);
+      }
+    }
+
+    if (retval != 0)
+    {
+      SUNLogInfo(ARK_LOGGER, "end-stage",
+                 "status = failed rhs eval, retval = %i", retval);
+      return ARK_RHSFUNC_FAIL;
+    }
+
+    /* set current stage time(s) */
+    ark_mem->tcur = ark_mem->tn + chati * ark_mem->h;
+
+    SUNLogExtraDebugVec(ARK_LOGGER, "stage", ark_mem->ycur, "z1_%i(:) =", is);
+
+    /* position update q = q + h a_i f2(p) */
+    retval = sprkStep_f2(step_mem, ark_mem->tn + ci * ark_mem->h, ark_mem->ycur,
+                         step_mem->sdata, ark_mem->user_data);
+
+    SUNLogExtraDebugVec(ARK_LOGGER, "stage RHS", f2q, "f2_%i(:) =", is);
+
+    if (retval != 0)
+    {
+      SUNLogInfo(ARK_LOGGER, "end-stage",
+                 "status = failed rhs eval, retval = %i", retval);
+      return ARK_RHSFUNC_FAIL;
+    }
+
+    /* fused update and local error estimate accumulation */
+    cvals[0] = ark_mem->h * ai;
+    cvals[1] = ark_mem->h * step_mem->da[is];
+    Z[0]     = q;
+    Z[1]     = N_VGetSubvector_ManyVector(ark_mem->tempv4, 1);
+    N_VScaleAddMulti(nvec, cvals, f2q, Z, Z);
+
+    /* apply user-supplied stage postprocessing function (if supplied) */
+    if (ark_mem->ProcessStage != NULL)
+    {
+      retval = ark_mem->ProcessStage(ark_mem->tcur, ark_mem->ycur,
+                                     ark_mem->user_data);
+      if (retval != 0)
+      {
+        SUNLogInfo(ARK_LOGGER, "end-stage",
+                   "status = failed postprocess stage, retval = %i", retval);
+        return (ARK_POSTPROCESS_STAGE_FAIL);
+      }
+    }
+
+    /* keep track of the stage number */
+    step_mem->istage++;
+
+    SUNLogInfo(ARK_LOGGER, "end-stage", "status = success");
+  }
+
+  *nflagPtr = 0;
+  *dsmPtr   = 0;
+
+  /* compute the local error estimate norm */
+  if (estimate)
+  {
+    *dsmPtr = N_VWrmsNorm(ark_mem->tempv4, ark_mem->ewt);
+    SUNLogExtraDebugVec(ARK_LOGGER, "error estimate", ark_mem->tempv4,
+                        "yerr(:) =");
+  }
+
   SUNLogExtraDebugVec(ARK_LOGGER, "updated solution", ark_mem->ycur, "ycur(:) =");
 
   return ARK_SUCCESS;
@@ -638,8 +905,10 @@ int sprkStep_TakeStep_Compensated(ARKodeMem ark_mem, sunrealtype* dsmPtr,
   N_Vector delta_Yi          = NULL;
   N_Vector yn_plus_delta_Yi  = NULL;
   N_Vector diff              = NULL;
+  N_Vector yerr_out          = NULL;
   sunrealtype ci             = SUN_RCONST(0.0);
   sunrealtype chati          = SUN_RCONST(0.0);
+  sunbooleantype estimate    = SUNFALSE;
   int is                     = 0;
   int retval                 = 0;
 
@@ -647,11 +916,47 @@ int sprkStep_TakeStep_Compensated(ARKodeMem ark_mem, sunrealtype* dsmPtr,
   retval = sprkStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return (retval); }
 
+  /* select the step size with the reversible control */
+  if (step_mem->density)
+  {
+    retval = sprkStep_ReversibleStepSize(ark_mem, step_mem);
+    if (retval != ARK_SUCCESS) { return (retval); }
+  }
+
   /* Vector shortcuts */
   delta_Yi         = ark_mem->tempv1;
   yn_plus_delta_Yi = ark_mem->tempv2;
   diff             = ark_mem->tempv3;
 
+  /* With adaptive steps the compensation computed in the last attempted step
+     is only used if that step was accepted */
+  if (step_mem->yerr_nst >= 0)
+  {
+    if (ark_mem->nst != step_mem->yerr_nst)
+    {
+      yerr_out           = step_mem->yerr;
+      step_mem->yerr     = step_mem->yerr_new;
+      step_mem->yerr_new = yerr_out;
+    }
+    step_mem->yerr_nst = -1;
+  }
+
+  yerr_out = step_mem->yerr;
+  if (!ark_mem->fixedstep)
+  {
+    if (!step_mem->yerr_new &&
+        !arkAllocVec(ark_mem, ark_mem->yn, &step_mem->yerr_new))
+    {
+      return (ARK_MEM_FAIL);
+    }
+    yerr_out = step_mem->yerr_new;
+  }
+
+  /* zero the local error estimate */
+  estimate = !ark_mem->fixedstep ||
+             (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE);
+  if (estimate) { N_VConst(ZERO, ark_mem->tempv4); }
+
   /* [ \Delta P_0 ] = [ 0 ]
      [ \Delta Q_0 ] = [ 0 ] */
   N_VConst(ZERO, delta_Yi);
@@ -695,6 +1000,13 @@ int sprkStep_TakeStep_Compensated(ARKodeMem ark_mem, sunrealtype* dsmPtr,
       return (ARK_RHSFUNC_FAIL);
     }
 
+    /* accumulate the local error estimate */
+    if (estimate)
+    {
+      N_VLinearSum(ONE, ark_mem->tempv4, ark_mem->h * step_mem->dahat[is],
+                   step_mem->sdata, ark_mem->tempv4);
+    }
+
     /* Incremental position update:
        [ \Delta P_i ] = [ \Delta P_{i-1} ] + [ sdata ]
        [            ] = [                ] + [       ] */
@@ -725,6 +1037,13 @@ int sprkStep_TakeStep_Compensated(ARKodeMem ark_mem, sunrealtype* dsmPtr,
       return (ARK_RHSFUNC_FAIL);
     }
 
+    /* accumulate the local error estimate */
+    if (estimate)
+    {
+      N_VLinearSum(ONE, ark_mem->tempv4, ark_mem->h * step_mem->da[is],
+                   step_mem->sdata, ark_mem->tempv4);
+    }
+
     /* Incremental velocity update:
        [            ] = [                ] + [       ]
        [ \Delta Q_i ] = [ \Delta Q_{i-1} ] + [ sdata ] */
@@ -753,11 +1072,23 @@ int sprkStep_TakeStep_Compensated(ARKodeMem ark_mem, sunrealtype* dsmPtr,
   N_VLinearSum(ONE, delta_Yi, -ONE, step_mem->yerr, delta_Yi);
   N_VLinearSum(ONE, ark_mem->yn, ONE, delta_Yi, ark_mem->ycur);
   N_VLinearSum(ONE, ark_mem->ycur, -ONE, ark_mem->yn, diff);
-  N_VLinearSum(ONE, diff, -ONE, delta_Yi, step_mem->yerr);
+  N_VLinearSum(ONE, diff, -ONE, delta_Yi, yerr_out);
 
   *nflagPtr = 0;
   *dsmPtr   = SUN_RCONST(0.0);
 
+  /* with adaptive steps the new compensation is used in the next step if
+     this step is accepted */
+  if (!ark_mem->fixedstep) { step_mem->yerr_nst = ark_mem->nst; }
+
+  /* compute the local error estimate norm */
+  if (estimate)
+  {
+    *dsmPtr = N_VWrmsNorm(ark_mem->tempv4, ark_mem->ewt);
+    SUNLogExtraDebugVec(ARK_LOGGER, "error estimate", ark_mem->tempv4,
+                        "yerr(:) =");
+  }
+
   SUNLogExtraDebugVec(ARK_LOGGER, "updated solution", ark_mem->ycur, "ycur(:) =");
 
   return 0;
@@ -816,6 +1147,280 @@ int sprkStep_AccessStepMem(ARKodeMem ark_mem, const char* fname,
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  sprkStep_ReversibleStepSize:
+
+  Sets the step size with the symmetric step size control of
+  Hairer and Soderlind. With the step density rho(y) and
+  G(y) = (d rho/dt) / rho, the step density at the midpoint of
+  step n is updated by
+
+    z_{n+1/2} = z_{n-1/2} + eps G(y_n),
+
+  starting from z_{1/2} = rho(y_0) + eps G(y_0) / 2, and the step
+  size is h_n = eps / z_{n+1/2}. The update is the leapfrog method
+  for d rho/d tau = G in the transformed time tau with dt/d tau =
+  1/rho, so the step sequence is symmetric and the integration
+  is time reversible when combined with a symmetric SPRK method.
+  The density is updated once per step, the last step is
+  shortened if it would pass the stop time.
+  ---------------------------------------------------------------*/
+int sprkStep_ReversibleStepSize(ARKodeMem ark_mem, ARKodeSPRKStepMem step_mem)
+{
+  sunrealtype rho     = ZERO;
+  sunrealtype rho_dot = ZERO;
+  sunrealtype G       = ZERO;
+  int retval          = 0;
+
+  if (step_mem->znst != ark_mem->nst)
+  {
+    retval = step_mem->density(ark_mem->tn, ark_mem->yn, &rho, &rho_dot,
+                               ark_mem->user_data);
+    step_mem->nde++;
+    if (retval != 0)
+    {
+      arkProcessError(ark_mem, ARK_RHSFUNC_FAIL, __LINE__, __func__,
+                      __FILE__, "The step density function failed");
+      return (ARK_RHSFUNC_FAIL);
+    }
+    if (rho <= ZERO)
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "The step density must be positive");
+      return (ARK_ILL_INPUT);
+    }
+
+    G = rho_dot / rho;
+    if (step_mem->znst < 0) { step_mem->zhalf = rho + HALF * step_mem->eps * G; }
+    else { step_mem->zhalf += step_mem->eps * G; }
+    step_mem->znst = ark_mem->nst;
+
+    if (step_mem->zhalf <= ZERO)
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "The midpoint step density is not positive, reduce "
+                      "the transformed step size");
+      return (ARK_ILL_INPUT);
+    }
+  }
+
+  ark_mem->h = step_mem->eps / step_mem->zhalf;
+
+  /* limit the step size if the step would pass tstop */
+  if (ark_mem->tstopset &&
+      (ark_mem->tn + ark_mem->h - ark_mem->tstop) * ark_mem->h > ZERO)
+  {
+    ark_mem->h = (ark_mem->tstop - ark_mem->tn) * (ONE - FOUR * ark_mem->uround);
+  }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  sprkStep_MinNormWeights:
+
+  Computes the minimum-norm weights w of length s satisfying the
+  m conditions R w = b, where R is an m x s row-major matrix with
+  m <= SPRK_MAX_EMB_ROWS. Conditions that are linear combinations
+  of the preceding ones are skipped if they are consistent with
+  them. Returns SUNFALSE if the conditions are inconsistent.
+  ---------------------------------------------------------------*/
+#define SPRK_MAX_EMB_ROWS 5
+
+static sunbooleantype sprkStep_MinNormWeights(int s, int m,
+                                              const sunrealtype* R,
+                                              const sunrealtype* b,
+                                              sunrealtype* w)
+{
+  sunrealtype M[SPRK_MAX_EMB_ROWS][SPRK_MAX_EMB_ROWS];
+  sunrealtype lambda[SPRK_MAX_EMB_ROWS];
+  sunbooleantype skip[SPRK_MAX_EMB_ROWS];
+  sunrealtype scale, bscale, tol, tmp;
+  int i, j, k;
+
+  /* form the Gram matrix M = R R^T and copy the right-hand side */
+  scale  = ZERO;
+  bscale = ZERO;
+  for (i = 0; i < m; i++)
+  {
+    for (j = 0; j < m; j++)
+    {
+      M[i][j] = ZERO;
+      for (k = 0; k < s; k++) { M[i][j] += R[i * s + k] * R[j * s + k]; }
+    }
+    scale     = SUNMAX(scale, M[i][i]);
+    bscale    = SUNMAX(bscale, SUNRabs(b[i]));
+    lambda[i] = b[i];
+  }
+  tol = SUNRsqrt(SUN_UNIT_ROUNDOFF);
+
+  /* solve M lambda = b with symmetric Gaussian elimination, the Schur
+     complements remain positive semi-definite so a (nearly) zero pivot
+     indicates a dependent condition */
+  for (k = 0; k < m; k++)
+  {
+    skip[k] = (M[k][k] <= tol * scale);
+    if (skip[k])
+    {
+      if (SUNRabs(lambda[k]) > tol * bscale) { return SUNFALSE; }
+      continue;
+    }
+    for (i = k + 1; i < m; i++)
+    {
+      tmp = M[i][k] / M[k][k];
+      for (j = k; j < m; j++) { M[i][j] -= tmp * M[k][j]; }
+      lambda[i] -= tmp * lambda[k];
+    }
+  }
+  for (k = m - 1; k >= 0; k--)
+  {
+    if (skip[k])
+    {
+      lambda[k] = ZERO;
+      continue;
+    }
+    for (j = k + 1; j < m; j++) { lambda[k] -= M[k][j] * lambda[j]; }
+    lambda[k] /= M[k][k];
+  }
+
+  /* w = R^T lambda */
+  for (k = 0; k < s; k++)
+  {
+    w[k] = ZERO;
+    for (i = 0; i < m; i++) { w[k] += R[i * s + k] * lambda[i]; }
+  }
+
+  return SUNTRUE;
+}
+
+/*---------------------------------------------------------------
+  sprkStep_EmbeddedPartition:
+
+  Computes embedded weights for one partition of an SPRK method
+  and stores the difference to the method weights in dw. The
+  stage values of the partition are evaluated at the nodes X
+  (the sum of the other partition's weights up to the stage) and
+  Y holds the second level sums needed for the order 3
+  conditions, see sprkStep_ComputeEmbedding. The embedded weights
+  satisfy the order conditions up to order p for separable
+  problems and one condition of order p+1 is replaced by zero,
+  trying each candidate in turn until the conditions are
+  linearly independent.
+  ---------------------------------------------------------------*/
+static sunbooleantype sprkStep_EmbeddedPartition(int s, int p,
+                                                 const sunrealtype* X,
+                                                 const sunrealtype* Y,
+                                                 const sunrealtype* w,
+                                                 sunrealtype* R,
+                                                 sunrealtype* dw)
+{
+  sunrealtype b[SPRK_MAX_EMB_ROWS];
+  int ncand, icand, m, k;
+
+  /* order conditions up to order p */
+  m = 0;
+  for (k = 0; k < s; k++) { R[m * s + k] = ONE; }
+  b[m++] = ONE;
+  if (p >= 2)
+  {
+    for (k = 0; k < s; k++) { R[m * s + k] = X[k]; }
+    b[m++] = ONE / TWO;
+  }
+  if (p >= 3)
+  {
+    for (k = 0; k < s; k++) { R[m * s + k] = X[k] * X[k]; }
+    b[m++] = ONE / SUN_RCONST(3.0);
+    for (k = 0; k < s; k++) { R[m * s + k] = Y[k]; }
+    b[m++] = ONE / SUN_RCONST(6.0);
+  }
+
+  /* candidate conditions of order p+1 */
+  ncand = (p == 1) ? 1 : 2;
+  for (icand = 0; icand < ncand; icand++)
+  {
+    for (k = 0; k < s; k++)
+    {
+      if (p == 1) { R[m * s + k] = X[k]; }
+      else if (p == 2)
+      {
+        R[m * s + k] = (icand == 0) ? X[k] * X[k] : Y[k];
+      }
+      else
+      {
+        R[m * s + k] = (icand == 0) ? X[k] * X[k] * X[k] : X[k] * Y[k];
+      }
+    }
+    b[m] = ZERO;
+
+    if (sprkStep_MinNormWeights(s, m + 1, R, b, dw))
+    {
+      for (k = 0; k < s; k++) { dw[k] = w[k] - dw[k]; }
+      return SUNTRUE;
+    }
+  }
+
+  return SUNFALSE;
+}
+
+/*---------------------------------------------------------------
+  sprkStep_ComputeEmbedding:
+
+  Computes embedded weights for an SPRK method that reuse its
+  stage evaluations. In stage i, f1 is evaluated with the q
+  values at the node C_i = sum_{j<i} a_j and f2 with the p values
+  at the node Chat_i = sum_{j<=i} ahat_j. For separable problems
+  the order conditions for the f1 weights w up to order 3 are
+
+    sum w_i = 1, sum w_i C_i = 1/2,
+    sum w_i C_i^2 = 1/3, sum w_i sum_{j<i} a_j Chat_j = 1/6,
+
+  and similarly for the f2 weights with the roles of the
+  partitions exchanged. The embedding order is the largest
+  p <= min(q-1, 3) for which embedded weights exist for both
+  partitions. The differences between the method and embedded
+  weights are returned in dahat and da, and the embedding order
+  is returned (0 if no embedding exists).
+  ---------------------------------------------------------------*/
+int sprkStep_ComputeEmbedding(ARKodeSPRKTable method, sunrealtype* dahat,
+                              sunrealtype* da)
+{
+  sunrealtype *C, *Chat, *D, *Dhat, *R;
+  int s, p, i;
+
+  s = method->stages;
+  p = SUNMIN(method->q - 1, 3);
+  if (p < 1) { return 0; }
+
+  C = (sunrealtype*)malloc((4 + SPRK_MAX_EMB_ROWS) * s * sizeof(sunrealtype));
+  if (C == NULL) { return 0; }
+  Chat = C + s;
+  D    = C + 2 * s;
+  Dhat = C + 3 * s;
+  R    = C + 4 * s;
+
+  /* stage nodes and second level sums */
+  for (i = 0; i < s; i++)
+  {
+    C[i]    = (i == 0) ? ZERO : C[i - 1] + method->a[i - 1];
+    Chat[i] = (i == 0) ? method->ahat[0] : Chat[i - 1] + method->ahat[i];
+    D[i]    = (i == 0) ? ZERO : D[i - 1] + method->a[i - 1] * Chat[i - 1];
+    Dhat[i] = (i == 0) ? method->ahat[0] * C[0]
+                       : Dhat[i - 1] + method->ahat[i] * C[i];
+  }
+
+  for (; p > 0; p--)
+  {
+    if (sprkStep_EmbeddedPartition(s, p, C, D, method->ahat, R, dahat) &&
+        sprkStep_EmbeddedPartition(s, p, Chat, Dhat, method->a, R, da))
+    {
+      break;
+    }
+  }
+
+  free(C);
+  return p;
+}
+
 /*===============================================================
   EOF
   ===============================================================*/
@@ -51,6 +51,23 @@ typedef struct ARKodeSPRKStepMemRec
   N_Vector sdata;         /* persisted stage data */
   N_Vector yerr;          /* error vector for compensated summation */
 
+  /* Embedded error estimation (adaptive steps) */
+  int p;              /* embedding order (0 = no embedding)           */
+  sunrealtype* dahat; /* ahat minus the embedded f1 weights           */
+  sunrealtype* da;    /* a minus the embedded f2 weights              */
+  N_Vector yerr_new;  /* compensation after a step not yet accepted   */
+  long int yerr_nst;  /* step counter when yerr_new was set (-1 none) */
+
+  /* Partitioned formulation (ManyVector state y = [p, q]) */
+  sunbooleantype partitioned;         /* update p and q subvectors in place */
+  SPRKStepForceUpdateFn force_update; /* fused p = p + c f1(t,q) (optional) */
+
+  /* Time-reversible step size control */
+  SPRKStepStepDensityFn density; /* step density rho(y) and d rho/dt     */
+  sunrealtype eps;               /* step size in the transformed time    */
+  sunrealtype zhalf;             /* step density at the step midpoint    */
+  long int znst;                 /* step counter when zhalf was set (-1) */
+
   /* SPRK problem specification */
   ARKRhsFn f1; /* p' = f1(t,q) = - dV(t,q)/dq  */
   ARKRhsFn f2; /* q' = f2(t,p) =   dT(t,p)/dp  */
@@ -58,6 +75,7 @@ typedef struct ARKodeSPRKStepMemRec
   /* Counters */
   long int nf1; /* number of calls to f1        */
   long int nf2; /* number of calls to f2        */
+  long int nde; /* number of calls to density   */
   int istage;
 
 }* ARKodeSPRKStepMem;
@@ -73,9 +91,12 @@ int sprkStep_FullRHS(ARKodeMem ark_mem, sunrealtype t, N_Vector y, N_Vector f,
 int sprkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr);
 int sprkStep_TakeStep_Compensated(ARKodeMem ark_mem, sunrealtype* dsmPtr,
                                   int* nflagPtr);
+int sprkStep_TakeStep_Partitioned(ARKodeMem ark_mem, sunrealtype* dsmPtr,
+                                  int* nflagPtr);
 int sprkStep_SetUserData(ARKodeMem ark_mem, void* user_data);
 int sprkStep_SetDefaults(ARKodeMem ark_mem);
 int sprkStep_SetOrder(ARKodeMem ark_mem, int ord);
+int sprkStep_GetEstLocalErrors(ARKodeMem ark_mem, N_Vector ele);
 int sprkStep_PrintAllStats(ARKodeMem ark_mem, FILE* outfile, SUNOutputFormat fmt);
 int sprkStep_WriteParameters(ARKodeMem ark_mem, FILE* fp);
 int sprkStep_Reset(ARKodeMem ark_mem, sunrealtype tR, N_Vector yR);
@@ -91,6 +112,9 @@ int sprkStep_AccessARKODEStepMem(void* arkode_mem, const char* fname,
                                  ARKodeMem* ark_mem, ARKodeSPRKStepMem* step_mem);
 int sprkStep_AccessStepMem(ARKodeMem ark_mem, const char* fname,
                            ARKodeSPRKStepMem* step_mem);
+int sprkStep_ComputeEmbedding(ARKodeSPRKTable method, sunrealtype* dahat,
+                              sunrealtype* da);
+int sprkStep_ReversibleStepSize(ARKodeMem ark_mem, ARKodeSPRKStepMem step_mem);
 
 /* f1 = p' (Force evaluation) */
 int sprkStep_f1(ARKodeSPRKStepMem step_mem, sunrealtype tcur, N_Vector ycur,
@@ -19,6 +19,7 @@
  * minimal, but the documentation changes will be significant.
  *--------------------------------------------------------------*/
 
+#include <nvector/nvector_manyvector.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <sundials/sundials_math.h>
@@ -65,12 +66,120 @@ int SPRKStepSetUseCompensatedSums(void* arkode_mem, sunbooleantype onoff)
   else
   {
     ark_mem->use_compensated_sums = SUNFALSE;
-    ark_mem->step                 = sprkStep_TakeStep;
+    ark_mem->step = step_mem->partitioned ? sprkStep_TakeStep_Partitioned
+                                          : sprkStep_TakeStep;
   }
 
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  SPRKStepSetPartitioned:
+
+  Turns on/off the partitioned formulation for a ManyVector state
+  with the subvectors p and q.
+  ---------------------------------------------------------------*/
+int SPRKStepSetPartitioned(void* arkode_mem, sunbooleantype onoff)
+{
+  ARKodeMem ark_mem          = NULL;
+  ARKodeSPRKStepMem step_mem = NULL;
+  int retval                 = 0;
+
+  /* access ARKodeMem and ARKodeSPRKStepMem structures */
+  retval = sprkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                        &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  if (onoff)
+  {
+    if (N_VGetVectorID(ark_mem->yn) != SUNDIALS_NVEC_MANYVECTOR ||
+        N_VGetNumSubvectors_ManyVector(ark_mem->yn) != 2)
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "The partitioned formulation requires a ManyVector "
+                      "with two subvectors");
+      return (ARK_ILL_INPUT);
+    }
+    step_mem->partitioned = SUNTRUE;
+  }
+  else { step_mem->partitioned = SUNFALSE; }
+
+  /* compensated summation uses the standard formulation */
+  if (!ark_mem->use_compensated_sums)
+  {
+    ark_mem->step = step_mem->partitioned ? sprkStep_TakeStep_Partitioned
+                                          : sprkStep_TakeStep;
+  }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  SPRKStepSetForceUpdateFn:
+
+  Specifies the optional function that evaluates f1 and applies
+  the momentum update in one call (partitioned formulation only).
+  ---------------------------------------------------------------*/
+int SPRKStepSetForceUpdateFn(void* arkode_mem, SPRKStepForceUpdateFn fu)
+{
+  ARKodeMem ark_mem          = NULL;
+  ARKodeSPRKStepMem step_mem = NULL;
+  int retval                 = 0;
+
+  /* access ARKodeMem and ARKodeSPRKStepMem structures */
+  retval = sprkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                        &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  step_mem->force_update = fu;
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  SPRKStepSetReversibleStepControl:
+
+  Enables the time reversible step size control with the given
+  step density function and transformed step size, or disables it
+  when the density function is NULL. The control requires fixed
+  step mode, which is enabled with eps as the placeholder step.
+  ---------------------------------------------------------------*/
+int SPRKStepSetReversibleStepControl(void* arkode_mem,
+                                     SPRKStepStepDensityFn density,
+                                     sunrealtype eps)
+{
+  ARKodeMem ark_mem          = NULL;
+  ARKodeSPRKStepMem step_mem = NULL;
+  int retval                 = 0;
+
+  /* access ARKodeMem and ARKodeSPRKStepMem structures */
+  retval = sprkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                        &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* disable the reversible control */
+  if (density == NULL)
+  {
+    step_mem->density = NULL;
+    step_mem->eps     = ZERO;
+    step_mem->znst    = -1;
+    return (ARK_SUCCESS);
+  }
+
+  if (eps == ZERO)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The transformed step size must be nonzero");
+    return (ARK_ILL_INPUT);
+  }
+
+  step_mem->density = density;
+  step_mem->eps     = eps;
+  step_mem->znst    = -1;
+
+  return (ARKodeSetFixedStep(arkode_mem, eps));
+}
+
 /*---------------------------------------------------------------
   SPRKStepSetMethod:
 
@@ -219,8 +328,14 @@ int SPRKStepGetNumRhsEvals(void* arkode_mem, long int* nf1, long int* nf2)
   ---------------------------------------------------------------*/
 int sprkStep_SetDefaults(ARKodeMem ark_mem)
 {
+  int retval = 0;
+
   /* use the default method order */
-  return (sprkStep_SetOrder(ark_mem, 0));
+  retval = sprkStep_SetOrder(ark_mem, 0);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* Load the default SUNAdaptController (used with adaptive steps) */
+  return (arkReplaceAdaptController(ark_mem, NULL, SUNTRUE));
 }
 
 /*---------------------------------------------------------------
@@ -253,6 +368,29 @@ int sprkStep_SetOrder(ARKodeMem ark_mem, int ord)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  sprkStep_GetEstLocalErrors: Returns the current local truncation
+  error estimate vector
+  ---------------------------------------------------------------*/
+int sprkStep_GetEstLocalErrors(ARKodeMem ark_mem, N_Vector ele)
+{
+  int retval;
+  ARKodeSPRKStepMem step_mem;
+  retval = sprkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* return an error if local truncation error is not computed */
+  if ((ark_mem->fixedstep && (ark_mem->AccumErrorType == ARK_ACCUMERROR_NONE)) ||
+      (step_mem->p <= 0))
+  {
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* otherwise, copy local truncation error vector to output */
+  N_VScale(ONE, ark_mem->tempv4, ele);
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   sprkStep_PrintAllStats:
 
@@ -269,6 +407,11 @@ int sprkStep_PrintAllStats(ARKodeMem ark_mem, FILE* outfile, SUNOutputFormat fmt
 
   sunfprintf_long(outfile, fmt, SUNFALSE, "f1 RHS fn evals", step_mem->nf1);
   sunfprintf_long(outfile, fmt, SUNFALSE, "f2 RHS fn evals", step_mem->nf2);
+  if (step_mem->density)
+  {
+    sunfprintf_long(outfile, fmt, SUNFALSE, "Step density fn evals",
+                    step_mem->nde);
+  }
 
   return (ARK_SUCCESS);
 }
@@ -60,6 +60,7 @@ module farkode_arkstep_mod
   integer(C_SIZE_T), public :: size = 0
  end type
  public :: FARKStepSetTableName
+ public :: FARKStepSetStageGroupNumThreads
  public :: FARKStepGetCurrentButcherTables
  public :: FARKStepGetTimestepperStats
  public :: FARKStepCreateMRIStepInnerStepper
@@ -303,6 +304,15 @@ type(SwigArrayWrapper) :: farg3
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKStepSetStageGroupNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FARKStepSetStageGroupNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKStepGetCurrentButcherTables(farg1, farg2, farg3) &
 bind(C, name="_wrap_FARKStepGetCurrentButcherTables") &
 result(fresult)
@@ -1964,6 +1974,22 @@ fresult = swigc_FARKStepSetTableName(farg1, farg2, farg3)
 swig_result = fresult
 end function
 
+function FARKStepSetStageGroupNumThreads(arkode_mem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = arkode_mem
+farg2 = nthreads
+fresult = swigc_FARKStepSetStageGroupNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
 function FARKStepGetCurrentButcherTables(arkode_mem, bi, be) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
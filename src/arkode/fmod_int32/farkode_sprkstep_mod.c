@@ -315,6 +315,50 @@ SWIGEXPORT int _wrap_FSPRKStepSetMethodName(void *farg1, SwigArrayWrapper *farg2
 }
 
 
+SWIGEXPORT int _wrap_FSPRKStepSetPartitioned(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)SPRKStepSetPartitioned(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSPRKStepSetForceUpdateFn(void *farg1, SPRKStepForceUpdateFn farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  SPRKStepForceUpdateFn arg2 = (SPRKStepForceUpdateFn) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (SPRKStepForceUpdateFn)(farg2);
+  result = (int)SPRKStepSetForceUpdateFn(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSPRKStepSetReversibleStepControl(void *farg1, SPRKStepStepDensityFn farg2, double const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  SPRKStepStepDensityFn arg2 = (SPRKStepStepDensityFn) 0 ;
+  sunrealtype arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (SPRKStepStepDensityFn)(farg2);
+  arg3 = (sunrealtype)(*farg3);
+  result = (int)SPRKStepSetReversibleStepControl(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSPRKStepGetCurrentMethod(void *farg1, void *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -43,6 +43,9 @@ module farkode_sprkstep_mod
   integer(C_SIZE_T), public :: size = 0
  end type
  public :: FSPRKStepSetMethodName
+ public :: FSPRKStepSetPartitioned
+ public :: FSPRKStepSetForceUpdateFn
+ public :: FSPRKStepSetReversibleStepControl
  public :: FSPRKStepGetCurrentMethod
  public :: FSPRKStepReset
  public :: FSPRKStepRootInit
@@ -129,6 +132,34 @@ type(SwigArrayWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSPRKStepSetPartitioned(farg1, farg2) &
+bind(C, name="_wrap_FSPRKStepSetPartitioned") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSPRKStepSetForceUpdateFn(farg1, farg2) &
+bind(C, name="_wrap_FSPRKStepSetForceUpdateFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSPRKStepSetReversibleStepControl(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSPRKStepSetReversibleStepControl") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+real(C_DOUBLE), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSPRKStepGetCurrentMethod(farg1, farg2) &
 bind(C, name="_wrap_FSPRKStepGetCurrentMethod") &
 result(fresult)
@@ -543,6 +574,57 @@ fresult = swigc_FSPRKStepSetMethodName(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSPRKStepSetPartitioned(arkode_mem, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = arkode_mem
+farg2 = onoff
+fresult = swigc_FSPRKStepSetPartitioned(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSPRKStepSetForceUpdateFn(arkode_mem, fu) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+type(C_FUNPTR), intent(in), value :: fu
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+
+farg1 = arkode_mem
+farg2 = fu
+fresult = swigc_FSPRKStepSetForceUpdateFn(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSPRKStepSetReversibleStepControl(arkode_mem, density, eps) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+type(C_FUNPTR), intent(in), value :: density
+real(C_DOUBLE), intent(in) :: eps
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+real(C_DOUBLE) :: farg3 
+
+farg1 = arkode_mem
+farg2 = density
+farg3 = eps
+fresult = swigc_FSPRKStepSetReversibleStepControl(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FSPRKStepGetCurrentMethod(arkode_mem, sprk_storage) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -360,6 +360,19 @@ SWIGEXPORT int _wrap_FARKStepSetTableName(void *farg1, SwigArrayWrapper *farg2,
   return fresult;
 }
 
+SWIGEXPORT int _wrap_FARKStepSetStageGroupNumThreads(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)ARKStepSetStageGroupNumThreads(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
 
 SWIGEXPORT int _wrap_FARKStepGetCurrentButcherTables(void *farg1, void *farg2, void *farg3) {
   int fresult ;
@@ -605,6 +605,20 @@ SWIGEXPORT int _wrap_FARKodeClearStopTime(void *farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FARKodeSetStepTrace(void *farg1, void *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  SUNStepTrace arg2 = (SUNStepTrace) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (SUNStepTrace)(farg2);
+  result = (int)ARKodeSetStepTrace(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKodeSetFixedStep(void *farg1, double const *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -2485,6 +2499,20 @@ SWIGEXPORT int _wrap_FARKBBDPrecReInit(void *farg1, int64_t const *farg2, int64_
 }
 
 
+SWIGEXPORT int _wrap_FARKBBDPrecSetNumSubBlocks(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)ARKBBDPrecSetNumSubBlocks(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKBBDPrecGetWorkSpace(void *farg1, long *farg2, long *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3233,6 +3261,34 @@ SWIGEXPORT int _wrap_FARKodeSetJacEvalFrequency(void *farg1, long const *farg2)
 }
 
 
+SWIGEXPORT int _wrap_FARKodeSetAdaptiveJacEval(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)ARKodeSetAdaptiveJacEval(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FARKodeSetDQJacNumThreads(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)ARKodeSetDQJacNumThreads(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKodeSetLinearSolutionScaling(void *farg1, int const *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
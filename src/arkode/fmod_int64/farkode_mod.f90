@@ -138,6 +138,7 @@ module farkode_mod
  public :: FARKodeSetInterpolateStopTime
  public :: FARKodeSetStopTime
  public :: FARKodeClearStopTime
+ public :: FARKodeSetStepTrace
  public :: FARKodeSetFixedStep
  public :: FARKodeSetStepDirection
  public :: FARKodeSetUserData
@@ -272,6 +273,7 @@ module farkode_mod
  public :: FARKBandPrecGetNumRhsEvals
  public :: FARKBBDPrecInit
  public :: FARKBBDPrecReInit
+ public :: FARKBBDPrecSetNumSubBlocks
  public :: FARKBBDPrecGetWorkSpace
  public :: FARKBBDPrecGetNumGfnEvals
 
@@ -347,7 +349,8 @@ module farkode_mod
   enumerator :: ARKODE_BACKWARD_EULER_1_1
   enumerator :: ARKODE_IMPLICIT_MIDPOINT_1_2
   enumerator :: ARKODE_IMPLICIT_TRAPEZOIDAL_2_2
-  enumerator :: ARKODE_MAX_DIRK_NUM = ARKODE_IMPLICIT_TRAPEZOIDAL_2_2
+  enumerator :: ARKODE_PDIRK_3_2_3
+  enumerator :: ARKODE_MAX_DIRK_NUM = ARKODE_PDIRK_3_2_3
  end enum
  integer, parameter, public :: ARKODE_DIRKTableID = kind(ARKODE_DIRK_NONE)
  public :: ARKODE_DIRK_NONE, ARKODE_MIN_DIRK_NUM, ARKODE_SDIRK_2_1_2, ARKODE_BILLINGTON_3_3_2, ARKODE_TRBDF2_3_3_2, &
@@ -356,7 +359,8 @@ module farkode_mod
     ARKODE_ARK437L2SA_DIRK_7_3_4, ARKODE_ARK548L2SAb_DIRK_8_4_5, ARKODE_ESDIRK324L2SA_4_2_3, ARKODE_ESDIRK325L2SA_5_2_3, &
     ARKODE_ESDIRK32I5L2SA_5_2_3, ARKODE_ESDIRK436L2SA_6_3_4, ARKODE_ESDIRK43I6L2SA_6_3_4, ARKODE_QESDIRK436L2SA_6_3_4, &
     ARKODE_ESDIRK437L2SA_7_3_4, ARKODE_ESDIRK547L2SA_7_4_5, ARKODE_ESDIRK547L2SA2_7_4_5, ARKODE_ARK2_DIRK_3_1_2, &
-    ARKODE_BACKWARD_EULER_1_1, ARKODE_IMPLICIT_MIDPOINT_1_2, ARKODE_IMPLICIT_TRAPEZOIDAL_2_2, ARKODE_MAX_DIRK_NUM
+    ARKODE_BACKWARD_EULER_1_1, ARKODE_IMPLICIT_MIDPOINT_1_2, ARKODE_IMPLICIT_TRAPEZOIDAL_2_2, ARKODE_PDIRK_3_2_3, &
+    ARKODE_MAX_DIRK_NUM
  public :: FARKodeButcherTable_LoadDIRK
  public :: FARKodeButcherTable_LoadDIRKByName
  public :: FARKodeButcherTable_DIRKIDToName
@@ -474,6 +478,8 @@ module farkode_mod
  public :: FARKodeSetJacFn
  public :: FARKodeSetMassFn
  public :: FARKodeSetJacEvalFrequency
+ public :: FARKodeSetAdaptiveJacEval
+ public :: FARKodeSetDQJacNumThreads
  public :: FARKodeSetLinearSolutionScaling
  public :: FARKodeSetEpsLin
  public :: FARKodeSetMassEpsLin
@@ -673,6 +679,15 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeSetStepTrace(farg1, farg2) &
+bind(C, name="_wrap_FARKodeSetStepTrace") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKodeSetFixedStep(farg1, farg2) &
 bind(C, name="_wrap_FARKodeSetFixedStep") &
 result(fresult)
@@ -1880,6 +1895,15 @@ real(C_DOUBLE), intent(in) :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKBBDPrecSetNumSubBlocks(farg1, farg2) &
+bind(C, name="_wrap_FARKBBDPrecSetNumSubBlocks") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKBBDPrecGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FARKBBDPrecGetWorkSpace") &
 result(fresult)
@@ -2390,6 +2414,24 @@ integer(C_LONG), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeSetAdaptiveJacEval(farg1, farg2) &
+bind(C, name="_wrap_FARKodeSetAdaptiveJacEval") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FARKodeSetDQJacNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FARKodeSetDQJacNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKodeSetLinearSolutionScaling(farg1, farg2) &
 bind(C, name="_wrap_FARKodeSetLinearSolutionScaling") &
 result(fresult)
@@ -2834,6 +2876,22 @@ fresult = swigc_FARKodeClearStopTime(farg1)
 swig_result = fresult
 end function
 
+function FARKodeSetStepTrace(arkode_mem, trace) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+type(C_PTR) :: trace
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = arkode_mem
+farg2 = trace
+fresult = swigc_FARKodeSetStepTrace(farg1, farg2)
+swig_result = fresult
+end function
+
 function FARKodeSetFixedStep(arkode_mem, hfixed) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5040,6 +5098,22 @@ fresult = swigc_FARKBBDPrecReInit(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FARKBBDPrecSetNumSubBlocks(arkode_mem, nsub) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(C_INT), intent(in) :: nsub
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = arkode_mem
+farg2 = nsub
+fresult = swigc_FARKBBDPrecSetNumSubBlocks(farg1, farg2)
+swig_result = fresult
+end function
+
 function FARKBBDPrecGetWorkSpace(arkode_mem, lenrwbbdp, leniwbbdp) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5881,6 +5955,38 @@ fresult = swigc_FARKodeSetJacEvalFrequency(farg1, farg2)
 swig_result = fresult
 end function
 
+function FARKodeSetAdaptiveJacEval(arkode_mem, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = arkode_mem
+farg2 = onoff
+fresult = swigc_FARKodeSetAdaptiveJacEval(farg1, farg2)
+swig_result = fresult
+end function
+
+function FARKodeSetDQJacNumThreads(arkode_mem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = arkode_mem
+farg2 = nthreads
+fresult = swigc_FARKodeSetDQJacNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
 function FARKodeSetLinearSolutionScaling(arkode_mem, onoff) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -29,6 +29,7 @@
 #include <sunnonlinsol/sunnonlinsol_newton.h>
 
 #include "cvode_impl.h"
+#include "cvode_ls_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 
 /*=================================================================*/
@@ -148,6 +149,13 @@ static int cvYddNorm(CVodeMem cv_mem, sunrealtype hg, sunrealtype* yddnrm);
 
 static int cvStep(CVodeMem cv_mem);
 
+/* Step trace functions */
+
+static void cvTraceCounters(CVodeMem cv_mem, long int* nli, long int* nje);
+static void cvTraceBeginStep(CVodeMem cv_mem);
+static void cvTraceEndStepIf(CVodeMem cv_mem, sunbooleantype condition,
+                             SUNStepTraceStatus status, sunrealtype dsm);
+
 /* Function called at beginning of step */
 
 static void cvAdjustParams(CVodeMem cv_mem);
@@ -250,7 +258,7 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   }
 
   cv_mem = NULL;
-  cv_mem = (CVodeMem)malloc(sizeof(struct CVodeMemRec));
+  cv_mem = (CVodeMem)SUNContext_ArenaAlloc(sunctx, sizeof(struct CVodeMemRec));
   if (cv_mem == NULL)
   {
     cvProcessError(NULL, 0, __LINE__, __func__, __FILE__, MSGCV_CVMEM_FAIL);
@@ -279,6 +287,7 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_e_data           = NULL;
   cv_mem->cv_monitorfun       = NULL;
   cv_mem->cv_monitor_interval = 0;
+  cv_mem->cv_trace            = NULL;
   cv_mem->cv_qmax             = maxord;
   cv_mem->cv_mxstep           = MXSTEP_DEFAULT;
   cv_mem->cv_mxhnil           = MXHNIL_DEFAULT;
@@ -343,6 +352,11 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_MallocDone            = SUNFALSE;
   cv_mem->cv_constraintsMallocDone = SUNFALSE;
 
+  /* Allocate the Nordsieck history array as separate vectors */
+
+  cv_mem->cv_zn_contig = SUNFALSE;
+  cv_mem->cv_zn_data   = NULL;
+
   /* Initialize nonlinear solver variables */
   cv_mem->NLS    = NULL;
   cv_mem->ownNLS = SUNFALSE;
@@ -1815,7 +1829,7 @@ void CVodeFree(void** cvode_mem)
 
   if (cv_mem->proj_mem) { cvProjFree(&(cv_mem->proj_mem)); }
 
-  free(*cvode_mem);
+  SUNContext_ArenaFree(cv_mem->cv_sunctx, cv_mem);
   *cvode_mem = NULL;
 }
 
@@ -1865,8 +1879,6 @@ static sunbooleantype cvCheckNvector(N_Vector tmpl)
 
 static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl)
 {
-  int i, j;
-
   /* Allocate ewt, acor, tempv, ftemp */
 
   cv_mem->cv_ewt = N_VClone(tmpl);
@@ -1931,21 +1943,16 @@ static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl)
 
   /* Allocate zn[0] ... zn[qmax] */
 
-  for (j = 0; j <= cv_mem->cv_qmax; j++)
+  if (!cvAllocHistory(cv_mem, tmpl, cv_mem->cv_qmax))
   {
-    cv_mem->cv_zn[j] = N_VClone(tmpl);
-    if (cv_mem->cv_zn[j] == NULL)
-    {
-      N_VDestroy(cv_mem->cv_ewt);
-      N_VDestroy(cv_mem->cv_acor);
-      N_VDestroy(cv_mem->cv_tempv);
-      N_VDestroy(cv_mem->cv_ftemp);
-      N_VDestroy(cv_mem->cv_vtemp1);
-      N_VDestroy(cv_mem->cv_vtemp2);
-      N_VDestroy(cv_mem->cv_vtemp3);
-      for (i = 0; i < j; i++) { N_VDestroy(cv_mem->cv_zn[i]); }
-      return (SUNFALSE);
-    }
+    N_VDestroy(cv_mem->cv_ewt);
+    N_VDestroy(cv_mem->cv_acor);
+    N_VDestroy(cv_mem->cv_tempv);
+    N_VDestroy(cv_mem->cv_ftemp);
+    N_VDestroy(cv_mem->cv_vtemp1);
+    N_VDestroy(cv_mem->cv_vtemp2);
+    N_VDestroy(cv_mem->cv_vtemp3);
+    return (SUNFALSE);
   }
 
   /* Update solver workspace lengths  */
@@ -1966,7 +1973,7 @@ static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl)
 
 static void cvFreeVectors(CVodeMem cv_mem)
 {
-  int j, maxord;
+  int maxord;
 
   maxord = cv_mem->cv_qmax_alloc;
 
@@ -1977,7 +1984,7 @@ static void cvFreeVectors(CVodeMem cv_mem)
   N_VDestroy(cv_mem->cv_vtemp1);
   N_VDestroy(cv_mem->cv_vtemp2);
   N_VDestroy(cv_mem->cv_vtemp3);
-  for (j = 0; j <= maxord; j++) { N_VDestroy(cv_mem->cv_zn[j]); }
+  cvFreeHistory(cv_mem, maxord);
 
   cv_mem->cv_lrw -= (maxord + 8) * cv_mem->cv_lrw1;
   cv_mem->cv_liw -= (maxord + 8) * cv_mem->cv_liw1;
@@ -1997,6 +2004,84 @@ static void cvFreeVectors(CVodeMem cv_mem)
   }
 }
 
+/*
+ * cvAllocHistory
+ *
+ * This routine allocates the Nordsieck array zn[0], ..., zn[maxord]. If
+ * contiguous storage was requested (see CVodeSetContiguousHistory) and the
+ * vectors store their (local) data in a single host array, the data of all
+ * of the vectors is allocated as one block and zn[j] is a vector that uses
+ * the j-th slice of the block. Otherwise each vector is cloned from tmpl.
+ * If all memory allocations are successful, cvAllocHistory returns SUNTRUE.
+ * Otherwise all allocated memory is freed and cvAllocHistory returns
+ * SUNFALSE.
+ */
+
+sunbooleantype cvAllocHistory(CVodeMem cv_mem, N_Vector tmpl, int maxord)
+{
+  int i, j;
+  sunindextype nloc;
+  N_Vector_ID id;
+
+  nloc               = 0;
+  cv_mem->cv_zn_data = NULL;
+
+  if (cv_mem->cv_zn_contig)
+  {
+    id = N_VGetVectorID(tmpl);
+    if (id == SUNDIALS_NVEC_SERIAL || id == SUNDIALS_NVEC_OPENMP ||
+        id == SUNDIALS_NVEC_PTHREADS || id == SUNDIALS_NVEC_PARALLEL)
+    {
+      nloc = N_VGetLocalLength(tmpl);
+    }
+    if (nloc > 0)
+    {
+      cv_mem->cv_zn_data =
+        (sunrealtype*)malloc((maxord + 1) * nloc * sizeof(sunrealtype));
+      if (cv_mem->cv_zn_data == NULL) { return (SUNFALSE); }
+    }
+  }
+
+  for (j = 0; j <= maxord; j++)
+  {
+    if (cv_mem->cv_zn_data)
+    {
+      cv_mem->cv_zn[j] = N_VCloneEmpty(tmpl);
+      if (cv_mem->cv_zn[j])
+      {
+        N_VSetArrayPointer(cv_mem->cv_zn_data + j * nloc, cv_mem->cv_zn[j]);
+      }
+    }
+    else { cv_mem->cv_zn[j] = N_VClone(tmpl); }
+
+    if (cv_mem->cv_zn[j] == NULL)
+    {
+      for (i = 0; i < j; i++) { N_VDestroy(cv_mem->cv_zn[i]); }
+      free(cv_mem->cv_zn_data);
+      cv_mem->cv_zn_data = NULL;
+      return (SUNFALSE);
+    }
+  }
+
+  return (SUNTRUE);
+}
+
+/*
+ * cvFreeHistory
+ *
+ * This routine frees the Nordsieck array allocated in cvAllocHistory.
+ */
+
+void cvFreeHistory(CVodeMem cv_mem, int maxord)
+{
+  int j;
+
+  for (j = 0; j <= maxord; j++) { N_VDestroy(cv_mem->cv_zn[j]); }
+
+  free(cv_mem->cv_zn_data);
+  cv_mem->cv_zn_data = NULL;
+}
+
 /*
  * -----------------------------------------------------------------
  * Initial setup
@@ -2404,6 +2489,8 @@ static int cvStep(CVodeMem cv_mem)
                ", q = %d",
                cv_mem->cv_nst + 1, cv_mem->cv_tn, cv_mem->cv_h, cv_mem->cv_q);
 
+    cvTraceBeginStep(cv_mem);
+
     cvPredict(cv_mem);
     cvSet(cv_mem);
 
@@ -2413,6 +2500,9 @@ static int cvStep(CVodeMem cv_mem)
     SUNLogInfoIf(kflag == PREDICT_AGAIN || kflag != DO_ERROR_TEST, CV_LOGGER,
                  "end-step-attempt", "status = failed solve, kflag = %i", kflag);
 
+    cvTraceEndStepIf(cv_mem, kflag != DO_ERROR_TEST, SUN_STEPTRACE_SOLVE_FAIL,
+                     ZERO);
+
     /* Go back in loop if we need to predict again (nflag=PREV_CONV_FAIL) */
     if (kflag == PREDICT_AGAIN) { continue; }
 
@@ -2430,6 +2520,9 @@ static int cvStep(CVodeMem cv_mem)
       SUNLogInfoIf(pflag != CV_SUCCESS, CV_LOGGER, "end-step-attempt",
                    "status = failed projection, pflag = %i", pflag);
 
+      cvTraceEndStepIf(cv_mem, pflag != CV_SUCCESS, SUN_STEPTRACE_OTHER_FAIL,
+                       ZERO);
+
       /* Go back in loop if we need to predict again (nflag=PREV_PROJ_FAIL) */
       if (pflag == PREDICT_AGAIN) { continue; }
 
@@ -2445,6 +2538,9 @@ static int cvStep(CVodeMem cv_mem)
                  ", eflag = %i",
                  dsm, eflag);
 
+    cvTraceEndStepIf(cv_mem, eflag != CV_SUCCESS, SUN_STEPTRACE_ERRTEST_FAIL,
+                     dsm);
+
     /* Go back in loop if we need to predict again (nflag=PREV_ERR_FAIL) */
     if (eflag == TRY_AGAIN) { continue; }
 
@@ -2457,6 +2553,7 @@ static int cvStep(CVodeMem cv_mem)
 
   SUNLogInfo(CV_LOGGER, "end-step-attempt",
              "status = success, dsm = " SUN_FORMAT_G, dsm);
+  cvTraceEndStepIf(cv_mem, SUNTRUE, SUN_STEPTRACE_SUCCESS, dsm);
 
   /* Nonlinear system solve and error test were both successful.
      Update data, and consider change of step and/or order.       */
@@ -2482,6 +2579,73 @@ static int cvStep(CVodeMem cv_mem)
   return (CV_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Step trace functions
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * cvTraceCounters
+ *
+ * This routine returns the linear iteration and Jacobian evaluation
+ * counters of the CVLS interface, or zero for other linear solver
+ * interfaces.
+ */
+
+static void cvTraceCounters(CVodeMem cv_mem, long int* nli, long int* nje)
+{
+  CVLsMem cvls_mem;
+
+  *nli = 0;
+  *nje = 0;
+
+  if (cv_mem->cv_lmem && cv_mem->cv_linit == cvLsInitialize)
+  {
+    cvls_mem = (CVLsMem)(cv_mem->cv_lmem);
+    *nli     = cvls_mem->nli;
+    *nje     = cvls_mem->nje;
+  }
+}
+
+/*
+ * cvTraceBeginStep
+ *
+ * This routine stores the state at the start of a step attempt in
+ * the step trace, if one is attached.
+ */
+
+static void cvTraceBeginStep(CVodeMem cv_mem)
+{
+  long int nli, nje;
+
+  if (!cv_mem->cv_trace) { return; }
+
+  cvTraceCounters(cv_mem, &nli, &nje);
+  SUNStepTrace_BeginStep(cv_mem->cv_trace, cv_mem->cv_tn, cv_mem->cv_h,
+                         cv_mem->cv_q, cv_mem->cv_nni, nli, nje,
+                         cv_mem->cv_nsetups);
+}
+
+/*
+ * cvTraceEndStepIf
+ *
+ * If condition is true, this routine records the outcome of the
+ * current step attempt in the step trace, if one is attached.
+ */
+
+static void cvTraceEndStepIf(CVodeMem cv_mem, sunbooleantype condition,
+                             SUNStepTraceStatus status, sunrealtype dsm)
+{
+  long int nli, nje;
+
+  if (!cv_mem->cv_trace || !condition) { return; }
+
+  cvTraceCounters(cv_mem, &nli, &nje);
+  SUNStepTrace_EndStep(cv_mem->cv_trace, status, dsm, cv_mem->cv_nni, nli, nje,
+                       cv_mem->cv_nsetups);
+}
+
 /*
  * -----------------------------------------------------------------
  * Function called at beginning of step
@@ -2736,15 +2900,14 @@ void cvRescale(CVodeMem cv_mem)
  *
  * This routine advances tn by the tentative step size h, and computes
  * the predicted array z_n(0), which is overwritten on zn.  The
- * prediction of zn is done by repeated additions.
+ * prediction of zn is done by repeated additions, which are fused into a
+ * single pass over the array when the vectors provide N_VPascalUpdate.
  * If tstop is enabled, it is possible for tn + h to be past tstop by roundoff,
  * and in that case, we reset tn (after incrementing by h) to tstop.
  */
 
 static void cvPredict(CVodeMem cv_mem)
 {
-  int j, k;
-
   cv_mem->cv_tn += cv_mem->cv_h;
   if (cv_mem->cv_tstopset)
   {
@@ -2754,14 +2917,7 @@ static void cvPredict(CVodeMem cv_mem)
     }
   }
 
-  for (k = 1; k <= cv_mem->cv_q; k++)
-  {
-    for (j = cv_mem->cv_q; j >= k; j--)
-    {
-      N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], ONE, cv_mem->cv_zn[j],
-                   cv_mem->cv_zn[j - 1]);
-    }
-  }
+  (void)N_VPascalUpdate(cv_mem->cv_q + 1, ONE, cv_mem->cv_zn);
 
   SUNLogExtraDebugVec(CV_LOGGER, "return", cv_mem->cv_zn[0], "zn_0(:) =");
 }
@@ -3310,17 +3466,8 @@ static int cvHandleNFlag(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 
 void cvRestore(CVodeMem cv_mem, sunrealtype saved_t)
 {
-  int j, k;
-
   cv_mem->cv_tn = saved_t;
-  for (k = 1; k <= cv_mem->cv_q; k++)
-  {
-    for (j = cv_mem->cv_q; j >= k; j--)
-    {
-      N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], -ONE, cv_mem->cv_zn[j],
-                   cv_mem->cv_zn[j - 1]);
-    }
-  }
+  (void)N_VPascalUpdate(cv_mem->cv_q + 1, -ONE, cv_mem->cv_zn);
 }
 
 /*
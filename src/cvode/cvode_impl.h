@@ -224,6 +224,9 @@ typedef struct CVodeMemRec
                              zn[j] is a vector of length N (j=0,...,q)
                              zn[j] = [1/factorial(j)] * h^j *
                              (jth derivative of the interpolating polynomial) */
+  sunbooleantype cv_zn_contig; /* allocate zn data as one contiguous block   */
+  sunrealtype* cv_zn_data;     /* data of zn[0],...,zn[qmax_alloc] if
+                                  allocated as one block (NULL otherwise)    */
 
   /*-------------------
     Vectors of length N
@@ -409,6 +412,7 @@ typedef struct CVodeMemRec
     -------------------------------------------*/
   CVMonitorFn cv_monitorfun;    /* func called with CVODE mem and user data  */
   long int cv_monitor_interval; /* step interval to call cv_monitorfun       */
+  SUNStepTrace cv_trace;        /* step trace, NULL if disabled              */
 
   /*-------------------------
     Stability Limit Detection
@@ -625,6 +629,11 @@ int cvDoProjection(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 int cvProjInit(CVodeProjMem proj_mem);
 int cvProjFree(CVodeProjMem* proj_mem);
 
+/* Allocate and free the Nordsieck history array */
+
+sunbooleantype cvAllocHistory(CVodeMem cv_mem, N_Vector tmpl, int maxord);
+void cvFreeHistory(CVodeMem cv_mem, int maxord);
+
 /* Restore tn and undo prediction to reattempt a step */
 
 void cvRestore(CVodeMem cv_mem, sunrealtype saved_t);
@@ -267,6 +267,30 @@ int CVodeSetStabLimDet(void* cvode_mem, sunbooleantype sldet)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeSetStepTrace
+ *
+ * Attaches a step trace that records every step attempt, a NULL
+ * trace disables recording
+ */
+
+int CVodeSetStepTrace(void* cvode_mem, SUNStepTrace trace)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  cv_mem->cv_trace = trace;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeSetInitStep
  *
@@ -992,6 +1016,67 @@ int CVodeSetConstraints(void* cvode_mem, N_Vector constraints)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeSetContiguousHistory
+ *
+ * Specifies if the Nordsieck history array is allocated as one contiguous
+ * block. If the solver memory has already been allocated, the history array
+ * is reallocated and its current values are copied to the new storage.
+ */
+
+int CVodeSetContiguousHistory(void* cvode_mem, sunbooleantype contiguous)
+{
+  CVodeMem cv_mem;
+  N_Vector zn_old[L_MAX];
+  sunrealtype* zn_data_old;
+  int j;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  contiguous = contiguous ? SUNTRUE : SUNFALSE;
+  if (contiguous == cv_mem->cv_zn_contig) { return (CV_SUCCESS); }
+
+  cv_mem->cv_zn_contig = contiguous;
+
+  if (!(cv_mem->cv_MallocDone)) { return (CV_SUCCESS); }
+
+  /* Reallocate the history array and copy the current values */
+
+  for (j = 0; j <= cv_mem->cv_qmax_alloc; j++)
+  {
+    zn_old[j] = cv_mem->cv_zn[j];
+  }
+  zn_data_old = cv_mem->cv_zn_data;
+
+  if (!cvAllocHistory(cv_mem, zn_old[0], cv_mem->cv_qmax_alloc))
+  {
+    for (j = 0; j <= cv_mem->cv_qmax_alloc; j++)
+    {
+      cv_mem->cv_zn[j] = zn_old[j];
+    }
+    cv_mem->cv_zn_data   = zn_data_old;
+    cv_mem->cv_zn_contig = !contiguous;
+    cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSGCV_MEM_FAIL);
+    return (CV_MEM_FAIL);
+  }
+
+  for (j = 0; j <= cv_mem->cv_qmax_alloc; j++)
+  {
+    N_VScale(ONE, zn_old[j], cv_mem->cv_zn[j]);
+    N_VDestroy(zn_old[j]);
+  }
+  free(zn_data_old);
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeSetUseIntegratorFusedKernels
  *
@@ -20,6 +20,7 @@
 #include <string.h>
 #include <sundials/sundials_math.h>
 #include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_blocktridiag.h>
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunmatrix/sunmatrix_sparse.h>
 
@@ -201,6 +202,9 @@ int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS, SUNMatrix A)
   /* Set default values for the rest of the LS parameters */
   cvls_mem->msbj       = CVLS_MSBJ;
   cvls_mem->jbad       = SUNTRUE;
+  sunJacPolicy_Init(&cvls_mem->jpolicy, SUNFALSE);
+  sunDQThreads_Init(&cvls_mem->dqthreads);
+  sunBroyden_Init(&cvls_mem->broyden);
   cvls_mem->dgmax_jbad = CVLS_DGMAX;
   cvls_mem->eplifac    = CVLS_EPLIN;
   cvls_mem->last_flag  = CVLS_SUCCESS;
@@ -421,6 +425,81 @@ int CVodeSetJacEvalFrequency(void* cvode_mem, long int msbj)
   return (CVLS_SUCCESS);
 }
 
+/* CVodeSetAdaptiveJacEval enables or disables choosing when to recompute the
+   Jacobian matrix and/or preconditioner from the measured solver costs */
+int CVodeSetAdaptiveJacEval(void* cvode_mem, sunbooleantype onoff)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* access CVLsMem structure; store input and return */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  if (onoff && !SUN_JACPOLICY_AVAILABLE)
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "The adaptive policy requires POSIX or Windows timers.");
+    return (CVLS_ILL_INPUT);
+  }
+
+  sunJacPolicy_Init(&cvls_mem->jpolicy, onoff);
+
+  return (CVLS_SUCCESS);
+}
+
+/* CVodeSetMaxBroydenUpdates sets the maximum number of Broyden updates
+   applied to the Newton matrix between linear solver setups */
+int CVodeSetMaxBroydenUpdates(void* cvode_mem, int maxupd)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  /* the updates require exact solves with the Newton matrix */
+  if (maxupd > 0 && cvls_mem->iterative)
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "Broyden updates require a direct linear solver.");
+    return (CVLS_ILL_INPUT);
+  }
+
+  /* allocate (or free) the update vectors */
+  if (sunBroyden_Alloc(&cvls_mem->broyden, maxupd, cv_mem->cv_tempv))
+  {
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+    return (CVLS_MEM_FAIL);
+  }
+
+  return (CVLS_SUCCESS);
+}
+
+/* CVodeSetDQJacNumThreads sets the number of threads used to
+   evaluate the columns of the internal dense or band DQ Jacobian. With more
+   than one thread the RHS function is called concurrently with the same
+   (shared) user_data pointer and must be thread-safe. */
+int CVodeSetDQJacNumThreads(void* cvode_mem, int nthreads)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  /* values < 2 select the serial approximation */
+  sunDQThreads_SetNumThreads(&cvls_mem->dqthreads, nthreads);
+
+  return (CVLS_SUCCESS);
+}
+
 /* CVodeSetLinearSolutionScaling enables or disables scaling the
    linear solver solution to account for changes in gamma. */
 int CVodeSetLinearSolutionScaling(void* cvode_mem, sunbooleantype onoff)
@@ -705,6 +784,21 @@ int CVodeGetNumJacEvals(void* cvode_mem, long int* njevals)
   return (CVLS_SUCCESS);
 }
 
+/* CVodeGetNumBroydenUpdates returns the number of Broyden updates
+   applied to the Newton matrix */
+int CVodeGetNumBroydenUpdates(void* cvode_mem, long int* nbroy)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* access CVLsMem structure; set output value and return */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+  *nbroy = cvls_mem->broyden.nbroy;
+  return (CVLS_SUCCESS);
+}
+
 /* CVodeGetNumLinRhsEvals returns the number of calls to the ODE
    function needed for the DQ Jacobian approximation or J*v product
    approximation */
@@ -981,7 +1075,7 @@ int cvLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
               SUNDIALS_MAYBE_UNUSED N_Vector tmp3)
 {
   CVodeMem cv_mem;
-  int retval;
+  int retval, nthreads;
 
   /* access CVodeMem structure */
   if (cvode_mem == NULL)
@@ -1014,15 +1108,30 @@ int cvLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
     return (CVLS_ILL_INPUT);
   }
 
+  /* Number of threads for the dense and band approximations */
+  nthreads = ((CVLsMem)cv_mem->cv_lmem)->dqthreads.nthreads;
+
   /* Call the matrix-structure-specific DQ approximation routine */
-  if (SUNMatGetID(Jac) == SUNMATRIX_DENSE)
+  if (SUNMatGetID(Jac) == SUNMATRIX_DENSE && nthreads > 1)
+  {
+    retval = cvLsDenseDQJacThreaded(t, y, fy, Jac, cv_mem);
+  }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_DENSE)
   {
     retval = cvLsDenseDQJac(t, y, fy, Jac, cv_mem, tmp1);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BAND && nthreads > 1)
+  {
+    retval = cvLsBandDQJacThreaded(t, y, fy, Jac, cv_mem);
+  }
   else if (SUNMatGetID(Jac) == SUNMATRIX_BAND)
   {
     retval = cvLsBandDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BLOCKTRIDIAG)
+  {
+    retval = cvLsBlockTridiagDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
+  }
   else
   {
     cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -1252,6 +1361,390 @@ int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*-----------------------------------------------------------------
+  cvLsDenseDQJacThreaded
+
+  This routine generates the same dense difference quotient
+  approximation as cvLsDenseDQJac with the columns distributed over
+  the threads set by CVodeSetDQJacNumThreads. Thread s perturbs its
+  own copy of y and computes the columns s, s + nthreads, ... so the
+  RHS function is called concurrently.
+  -----------------------------------------------------------------*/
+int cvLsDenseDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                           SUNMatrix Jac, CVodeMem cv_mem)
+{
+  sunrealtype fnorm, minInc, srur;
+  sunrealtype *y_data, *fy_data, *ewt_data, *cns_data;
+  sunindextype N;
+  sunDQThread* thread;
+  CVLsMem cvls_mem;
+  int nthreads, s;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* access matrix dimension */
+  N = SUNDenseMatrix_Columns(Jac);
+
+  /* Allocate the work vectors of each thread (on first use) */
+  if (sunDQThreads_Alloc(&cvls_mem->dqthreads, y, SUNFALSE))
+  {
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+    return (CVLS_MEM_FAIL);
+  }
+  nthreads = cvls_mem->dqthreads.nthreads;
+  thread   = cvls_mem->dqthreads.thread;
+
+  /* Obtain pointers to the data for ewt, y, fy */
+  ewt_data = N_VGetArrayPointer(cv_mem->cv_ewt);
+  y_data   = N_VGetArrayPointer(y);
+  fy_data  = N_VGetArrayPointer(fy);
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Load each ytemp with y */
+  for (s = 0; s < nthreads; s++) { N_VScale(ONE, y, thread[s].ytemp); }
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Loop over the columns assigned to each thread */
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < nthreads; s++)
+  {
+    sunrealtype inc, inc_inv, conj;
+    sunrealtype *ytemp_data, *ftemp_data, *col_j;
+    sunindextype i, j;
+
+    ytemp_data       = N_VGetArrayPointer(thread[s].ytemp);
+    ftemp_data       = N_VGetArrayPointer(thread[s].ftemp);
+    thread[s].nfe    = 0;
+    thread[s].retval = 0;
+
+    for (j = s; j < N; j += nthreads)
+    {
+      inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) if y_j has an inequality constraint. */
+      if (cv_mem->cv_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((y_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((y_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[j] += inc;
+
+      thread[s].retval = cv_mem->cv_f(t, thread[s].ytemp, thread[s].ftemp,
+                                      cv_mem->cv_user_data);
+      thread[s].nfe++;
+      if (thread[s].retval != 0) { break; }
+
+      ytemp_data[j] = y_data[j];
+
+      /* Generate the jth col of J(tn,y) */
+      inc_inv = ONE / inc;
+      col_j   = SUNDenseMatrix_Column(Jac, j);
+      for (i = 0; i < N; i++)
+      {
+        col_j[i] = inc_inv * (ftemp_data[i] - fy_data[i]);
+      }
+    }
+  }
+
+  return (sunDQThreads_Finalize(&cvls_mem->dqthreads, &cvls_mem->nfeDQ));
+}
+
+/*-----------------------------------------------------------------
+  cvLsBandDQJacThreaded
+
+  This routine generates the same banded difference quotient
+  approximation as cvLsBandDQJac with the column groups distributed
+  over the threads set by CVodeSetDQJacNumThreads. Thread s perturbs
+  its own copy of y and computes the groups s + 1, s + 1 + nthreads,
+  ... so the RHS function is called concurrently.
+  -----------------------------------------------------------------*/
+int cvLsBandDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                          SUNMatrix Jac, CVodeMem cv_mem)
+{
+  sunrealtype fnorm, minInc, srur;
+  sunrealtype *ewt_data, *fy_data, *y_data, *cns_data;
+  sunindextype width, ngroups, N, mupper, mlower;
+  sunDQThread* thread;
+  CVLsMem cvls_mem;
+  int nthreads, s;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* access matrix dimensions */
+  N      = SUNBandMatrix_Columns(Jac);
+  mupper = SUNBandMatrix_UpperBandwidth(Jac);
+  mlower = SUNBandMatrix_LowerBandwidth(Jac);
+
+  /* Allocate the work vectors of each thread (on first use) */
+  if (sunDQThreads_Alloc(&cvls_mem->dqthreads, y, SUNFALSE))
+  {
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+    return (CVLS_MEM_FAIL);
+  }
+  nthreads = cvls_mem->dqthreads.nthreads;
+  thread   = cvls_mem->dqthreads.thread;
+
+  /* Obtain pointers to the data for ewt, fy, y */
+  ewt_data = N_VGetArrayPointer(cv_mem->cv_ewt);
+  fy_data  = N_VGetArrayPointer(fy);
+  y_data   = N_VGetArrayPointer(y);
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Load each ytemp with y = predicted y vector */
+  for (s = 0; s < nthreads; s++) { N_VScale(ONE, y, thread[s].ytemp); }
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Set bandwidth and number of column groups for band differencing */
+  width   = mlower + mupper + 1;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over the column groups assigned to each thread */
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < nthreads; s++)
+  {
+    sunrealtype inc, inc_inv, conj;
+    sunrealtype *ytemp_data, *ftemp_data, *col_j;
+    sunindextype group, i, j, i1, i2;
+
+    ytemp_data       = N_VGetArrayPointer(thread[s].ytemp);
+    ftemp_data       = N_VGetArrayPointer(thread[s].ftemp);
+    thread[s].nfe    = 0;
+    thread[s].retval = 0;
+
+    for (group = s + 1; group <= ngroups; group += nthreads)
+    {
+      /* Increment all y_j in group */
+      for (j = group - 1; j < N; j += width)
+      {
+        inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+        /* Adjust sign(inc) if yj has an inequality constraint. */
+        if (cv_mem->cv_constraintsSet)
+        {
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+          }
+        }
+
+        ytemp_data[j] += inc;
+      }
+
+      /* Evaluate f with incremented y */
+      thread[s].retval = cv_mem->cv_f(t, thread[s].ytemp, thread[s].ftemp,
+                                      cv_mem->cv_user_data);
+      thread[s].nfe++;
+      if (thread[s].retval != 0) { break; }
+
+      /* Restore ytemp, then form and load difference quotients */
+      for (j = group - 1; j < N; j += width)
+      {
+        ytemp_data[j] = y_data[j];
+        col_j         = SUNBandMatrix_Column(Jac, j);
+        inc           = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+        /* Adjust sign(inc) as before. */
+        if (cv_mem->cv_constraintsSet)
+        {
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+          }
+        }
+
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(0, j - mupper);
+        i2      = SUNMIN(j + mlower, N - 1);
+        for (i = i1; i <= i2; i++)
+        {
+          SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv *
+                                             (ftemp_data[i] - fy_data[i]);
+        }
+      }
+    }
+  }
+
+  return (sunDQThreads_Finalize(&cvls_mem->dqthreads, &cvls_mem->nfeDQ));
+}
+
+/*-----------------------------------------------------------------
+  cvLsBlockTridiagDQJac
+
+  This routine generates a block-tridiagonal difference quotient
+  approximation to the Jacobian of f(t,y). Columns whose blocks are
+  at least three block columns apart do not share any nonzero rows,
+  so the columns are perturbed in 3*blocksize groups as in the band
+  case. The entries of each column are loaded directly into the
+  sub-diagonal, diagonal, and super-diagonal blocks using the
+  SUNMATRIX_BLOCKTRIDIAG accessor macros.
+  -----------------------------------------------------------------*/
+int cvLsBlockTridiagDQJac(sunrealtype t, N_Vector y, N_Vector fy,
+                          SUNMatrix Jac, CVodeMem cv_mem, N_Vector tmp1,
+                          N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, conj;
+  sunrealtype *block, *ewt_data, *fy_data, *ftemp_data;
+  sunrealtype *y_data, *ytemp_data, *cns_data;
+  sunindextype group, i, j, width, ngroups, I, I1, I2;
+  sunindextype N, bs, nb;
+  CVLsMem cvls_mem;
+  int retval = 0;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* access matrix dimensions */
+  N  = SM_COLUMNS_BT(Jac);
+  bs = SM_BLOCKSIZE_BT(Jac);
+  nb = SM_NBLOCKS_BT(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(cv_mem->cv_ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Set width and number of column groups for block differencing */
+  width   = 3 * bs;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over column groups. */
+  for (group = 1; group <= ngroups; group++)
+  {
+    /* Increment all y_j in group */
+    for (j = group - 1; j < N; j += width)
+    {
+      inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (cv_mem->cv_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[j] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = cv_mem->cv_f(t, ytemp, ftemp, cv_mem->cv_user_data);
+    cvls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (j = group - 1; j < N; j += width)
+    {
+      ytemp_data[j] = y_data[j];
+      inc           = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) as before. */
+      if (cv_mem->cv_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      inc_inv = ONE / inc;
+      I1      = SUNMAX(0, j / bs - 1);
+      I2      = SUNMIN(j / bs + 1, nb - 1);
+      for (I = I1; I <= I2; I++)
+      {
+        block = SM_BLOCK_BT(Jac, I, j / bs);
+        for (i = 0; i < bs; i++)
+        {
+          SM_BLOCK_ELEMENT_BT(block, i, j % bs, bs) =
+            inc_inv * (ftemp_data[I * bs + i] - fy_data[I * bs + i]);
+        }
+      }
+    }
+  }
+
+  return (retval);
+}
+
 /*-----------------------------------------------------------------
   cvLsDQJtimes
 
@@ -1430,13 +1923,14 @@ int cvLsInitialize(CVodeMem cv_mem)
       /* Check if an internal or user-supplied Jacobian function is used */
       if (cvls_mem->jacDQ)
       {
-        /* Internal difference quotient Jacobian. Check that A is dense or band,
-           otherwise return an error */
+        /* Internal difference quotient Jacobian. Check that A is dense, band,
+           or block-tridiagonal, otherwise return an error */
         retval = 0;
         if (cvls_mem->A->ops->getid)
         {
           if ((SUNMatGetID(cvls_mem->A) == SUNMATRIX_DENSE) ||
-              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BAND))
+              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BAND) ||
+              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BLOCKTRIDIAG))
           {
             cvls_mem->jac    = cvLsDQJac;
             cvls_mem->J_data = cv_mem;
@@ -1487,6 +1981,7 @@ int cvLsInitialize(CVodeMem cv_mem)
 
   /* reset counters */
   cvLsInitializeCounters(cvls_mem);
+  sunJacPolicy_Init(&cvls_mem->jpolicy, cvls_mem->jpolicy.enabled);
 
   /* Set Jacobian-vector product related fields, based on jtimesDQ */
   if (cvls_mem->jtimesDQ)
@@ -1536,6 +2031,7 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
 {
   CVLsMem cvls_mem;
   sunrealtype dgamma;
+  sunbooleantype jstale;
   int retval;
 
   /* access CVLsMem structure */
@@ -1558,10 +2054,18 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
   cvls_mem->ycur = ypred;
   cvls_mem->fcur = fpred;
 
-  /* Use nst, gamma/gammap, and convfail to set J/P eval. flag jok */
+  /* Use the Jacobian age (or the adaptive policy), gamma/gammap, and convfail
+     to set J/P eval. flag jok */
+  if (cvls_mem->jpolicy.enabled)
+  {
+    jstale = sunJacPolicy_Update(&cvls_mem->jpolicy, cv_mem->cv_nst);
+    sunJacPolicy_BeginSetup(&cvls_mem->jpolicy);
+  }
+  else { jstale = (cv_mem->cv_nst >= cvls_mem->nstlj + cvls_mem->msbj); }
+
   dgamma         = SUNRabs((cv_mem->cv_gamma / cv_mem->cv_gammap) - ONE);
   cvls_mem->jbad = (cv_mem->cv_nst == 0) || (cv_mem->first_step_after_resize) ||
-                   (cv_mem->cv_nst >= cvls_mem->nstlj + cvls_mem->msbj) ||
+                   jstale ||
                    ((convfail == CV_FAIL_BAD_J) &&
                     (dgamma < cvls_mem->dgmax_jbad)) ||
                    (convfail == CV_FAIL_OTHER);
@@ -1613,6 +2117,9 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
      pass the heuristic suggestions above to the user code(s) */
   cvls_mem->last_flag = SUNLinSolSetup(cvls_mem->LS, cvls_mem->A);
 
+  /* Discard Broyden updates of the previous matrix */
+  sunBroyden_Reset(&cvls_mem->broyden);
+
   /* If Matrix-free, update heuristics flags */
   if (cvls_mem->A == NULL)
   {
@@ -1628,6 +2135,12 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
     if (cvls_mem->jbad) { *jcurPtr = SUNTRUE; }
   }
 
+  /* Update the measured setup costs */
+  if (cvls_mem->jpolicy.enabled)
+  {
+    sunJacPolicy_EndSetup(&cvls_mem->jpolicy, *jcurPtr);
+  }
+
   return (cvls_mem->last_flag);
 }
 
@@ -1663,6 +2176,12 @@ int cvLsSolve(CVodeMem cv_mem, N_Vector b, N_Vector weight, N_Vector ynow,
   /* get current nonlinear solver iteration */
   retval = SUNNonlinSolGetCurIter(cv_mem->NLS, &curiter);
 
+  /* Update the measured Newton iteration cost */
+  if (cvls_mem->jpolicy.enabled)
+  {
+    sunJacPolicy_Solve(&cvls_mem->jpolicy, curiter);
+  }
+
   /* If the linear solver is iterative:
      test norm(b), if small, return x = 0 or x = b;
      set linear solver tolerance (in left/right scaled 2-norm) */
@@ -1780,6 +2299,16 @@ int cvLsSolve(CVodeMem cv_mem, N_Vector b, N_Vector weight, N_Vector ynow,
     N_VScale(TWO / (ONE + cv_mem->cv_gamrat), b, b);
   }
 
+  /* Apply the Broyden updates of the Newton matrix. An update is formed from
+     consecutive Newton iterations and the updates are discarded at the start
+     of each nonlinear solve. Updates from earlier steps lead the convergence
+     rate estimate carried over between steps to accept inaccurate iterates. */
+  if (cvls_mem->broyden.maxupd > 0 && retval == SUN_SUCCESS)
+  {
+    if (curiter == 0) { sunBroyden_Reset(&cvls_mem->broyden); }
+    sunBroyden_Solve(&cvls_mem->broyden, ynow, b);
+  }
+
   /* Retrieve statistics from iterative linear solvers */
   resnorm = ZERO;
   nli_inc = 0;
@@ -1873,6 +2402,12 @@ int cvLsFree(CVodeMem cv_mem)
     cvls_mem->x = NULL;
   }
 
+  /* Free Broyden update memory */
+  sunBroyden_Free(&cvls_mem->broyden);
+
+  /* Free threaded DQ Jacobian work vectors */
+  sunDQThreads_Free(&cvls_mem->dqthreads);
+
   /* Free savedJ memory */
   if (cvls_mem->savedJ)
   {
@@ -1912,6 +2447,8 @@ int cvLsInitializeCounters(CVLsMem cvls_mem)
   cvls_mem->ncfl     = 0;
   cvls_mem->njtsetup = 0;
   cvls_mem->njtimes  = 0;
+
+  cvls_mem->broyden.nbroy = 0;
   return (0);
 }
 
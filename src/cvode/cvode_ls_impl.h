@@ -21,6 +21,9 @@
 #include <cvode/cvode_ls.h>
 
 #include "cvode_impl.h"
+#include "sundials_broyden_impl.h"
+#include "sundials_dqjac_impl.h"
+#include "sundials_jacpolicy_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -90,6 +93,15 @@ typedef struct CVLsMemRec
   long int njtimes;  /* njtimes = total number of calls to jtimes    */
   sunrealtype tnlj;  /* tnlj = t_n at last jac/pset call             */
 
+  /* Adaptive Jacobian evaluation policy (replaces msbj when enabled) */
+  sunJacPolicy jpolicy;
+
+  /* Threaded difference quotient Jacobian (dense and band) */
+  sunDQThreads dqthreads;
+
+  /* Broyden corrections of the Newton matrix between setups */
+  sunBroyden broyden;
+
   /* Preconditioner computation
    * (a) user-provided:
    *     - P_data == user_data
@@ -150,6 +162,13 @@ int cvLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                    CVodeMem cv_mem, N_Vector tmp1);
 int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                   CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
+int cvLsDenseDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                           SUNMatrix Jac, CVodeMem cv_mem);
+int cvLsBandDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                          SUNMatrix Jac, CVodeMem cv_mem);
+int cvLsBlockTridiagDQJac(sunrealtype t, N_Vector y, N_Vector fy,
+                          SUNMatrix Jac, CVodeMem cv_mem, N_Vector tmp1,
+                          N_Vector tmp2);
 
 /* Generic linit/lsetup/lsolve/lfree interface routines for CVode to call */
 int cvLsInitialize(CVodeMem cv_mem);
@@ -71,6 +71,7 @@ module fcvode_mod
  public :: FCVodeSVtolerances
  public :: FCVodeWFtolerances
  public :: FCVodeSetConstraints
+ public :: FCVodeSetContiguousHistory
  public :: FCVodeSetDeltaGammaMaxLSetup
  public :: FCVodeSetInitStep
  public :: FCVodeSetLSetupFrequency
@@ -88,6 +89,7 @@ module fcvode_mod
  public :: FCVodeSetNonlinConvCoef
  public :: FCVodeSetNonlinearSolver
  public :: FCVodeSetStabLimDet
+ public :: FCVodeSetStepTrace
  public :: FCVodeSetStopTime
  public :: FCVodeSetInterpolateStopTime
  public :: FCVodeClearStopTime
@@ -148,6 +150,7 @@ module fcvode_mod
  public :: FCVBandPrecGetNumRhsEvals
  public :: FCVBBDPrecInit
  public :: FCVBBDPrecReInit
+ public :: FCVBBDPrecSetNumSubBlocks
  public :: FCVBBDPrecGetWorkSpace
  public :: FCVBBDPrecGetNumGfnEvals
  integer(C_INT), parameter, public :: CVDIAG_SUCCESS = 0_C_INT
@@ -176,6 +179,8 @@ module fcvode_mod
  public :: FCVodeSetLinearSolver
  public :: FCVodeSetJacFn
  public :: FCVodeSetJacEvalFrequency
+ public :: FCVodeSetAdaptiveJacEval
+ public :: FCVodeSetDQJacNumThreads
  public :: FCVodeSetLinearSolutionScaling
  public :: FCVodeSetDeltaGammaMaxBadJac
  public :: FCVodeSetEpsLin
@@ -183,11 +188,13 @@ module fcvode_mod
  public :: FCVodeSetPreconditioner
  public :: FCVodeSetJacTimes
  public :: FCVodeSetLinSysFn
+ public :: FCVodeSetMaxBroydenUpdates
  public :: FCVodeGetJac
  public :: FCVodeGetJacTime
  public :: FCVodeGetJacNumSteps
  public :: FCVodeGetLinWorkSpace
  public :: FCVodeGetNumJacEvals
+ public :: FCVodeGetNumBroydenUpdates
  public :: FCVodeGetNumPrecEvals
  public :: FCVodeGetNumPrecSolves
  public :: FCVodeGetNumLinIters
@@ -290,6 +297,15 @@ type(C_PTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetContiguousHistory(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetContiguousHistory") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetDeltaGammaMaxLSetup(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetDeltaGammaMaxLSetup") &
 result(fresult)
@@ -443,6 +459,15 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetStepTrace(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetStepTrace") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetStopTime(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetStopTime") &
 result(fresult)
@@ -986,6 +1011,15 @@ real(C_DOUBLE), intent(in) :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVBBDPrecSetNumSubBlocks(farg1, farg2) &
+bind(C, name="_wrap_FCVBBDPrecSetNumSubBlocks") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVBBDPrecGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FCVBBDPrecGetWorkSpace") &
 result(fresult)
@@ -1078,6 +1112,24 @@ integer(C_LONG), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetAdaptiveJacEval(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetAdaptiveJacEval") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FCVodeSetDQJacNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetDQJacNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetLinearSolutionScaling(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetLinearSolutionScaling") &
 result(fresult)
@@ -1143,6 +1195,15 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetMaxBroydenUpdates(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetMaxBroydenUpdates") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeGetJac(farg1, farg2) &
 bind(C, name="_wrap_FCVodeGetJac") &
 result(fresult)
@@ -1189,6 +1250,15 @@ type(C_PTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeGetNumBroydenUpdates(farg1, farg2) &
+bind(C, name="_wrap_FCVodeGetNumBroydenUpdates") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeGetNumPrecEvals(farg1, farg2) &
 bind(C, name="_wrap_FCVodeGetNumPrecEvals") &
 result(fresult)
@@ -1518,6 +1588,22 @@ fresult = swigc_FCVodeSetConstraints(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetContiguousHistory(cvode_mem, contiguous) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: contiguous
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = contiguous
+fresult = swigc_FCVodeSetContiguousHistory(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetDeltaGammaMaxLSetup(cvode_mem, dgmax_lsetup) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -1790,6 +1876,22 @@ fresult = swigc_FCVodeSetStabLimDet(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetStepTrace(cvode_mem, trace) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(C_PTR) :: trace
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = cvode_mem
+farg2 = trace
+fresult = swigc_FCVodeSetStepTrace(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetStopTime(cvode_mem, tstop) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2802,6 +2904,22 @@ fresult = swigc_FCVBBDPrecReInit(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FCVBBDPrecSetNumSubBlocks(cvode_mem, nsub) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: nsub
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = nsub
+fresult = swigc_FCVBBDPrecSetNumSubBlocks(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVBBDPrecGetWorkSpace(cvode_mem, lenrwbbdp, leniwbbdp) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2966,6 +3084,38 @@ fresult = swigc_FCVodeSetJacEvalFrequency(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetAdaptiveJacEval(cvode_mem, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = onoff
+fresult = swigc_FCVodeSetAdaptiveJacEval(farg1, farg2)
+swig_result = fresult
+end function
+
+function FCVodeSetDQJacNumThreads(cvode_mem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = nthreads
+fresult = swigc_FCVodeSetDQJacNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetLinearSolutionScaling(cvode_mem, onoff) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3084,6 +3234,22 @@ fresult = swigc_FCVodeSetLinSysFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetMaxBroydenUpdates(cvode_mem, maxupd) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: maxupd
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = maxupd
+fresult = swigc_FCVodeSetMaxBroydenUpdates(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeGetJac(cvode_mem, j) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3167,6 +3333,22 @@ fresult = swigc_FCVodeGetNumJacEvals(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeGetNumBroydenUpdates(cvode_mem, nbroy) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_LONG), dimension(*), target, intent(inout) :: nbroy
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = cvode_mem
+farg2 = c_loc(nbroy(1))
+fresult = swigc_FCVodeGetNumBroydenUpdates(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeGetNumPrecEvals(cvode_mem, npevals) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -193,6 +193,7 @@
 #include <sunnonlinsol/sunnonlinsol_newton.h>
 
 #include "cvodes_impl.h"
+#include "cvodes_ls_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 #include "sundials/sundials_context.h"
 
@@ -359,6 +360,13 @@ static int cvYddNorm(CVodeMem cv_mem, sunrealtype hg, sunrealtype* yddnrm);
 
 static int cvStep(CVodeMem cv_mem);
 
+/* Step trace functions */
+
+static void cvTraceCounters(CVodeMem cv_mem, long int* nli, long int* nje);
+static void cvTraceBeginStep(CVodeMem cv_mem);
+static void cvTraceEndStepIf(CVodeMem cv_mem, sunbooleantype condition,
+                             SUNStepTraceStatus status, sunrealtype dsm);
+
 /* Function called at beginning of step */
 
 static void cvAdjustParams(CVodeMem cv_mem);
@@ -368,6 +376,7 @@ static void cvAdjustBDF(CVodeMem cv_mem, int deltaq);
 static void cvIncreaseBDF(CVodeMem cv_mem);
 static void cvDecreaseBDF(CVodeMem cv_mem);
 static void cvPredict(CVodeMem cv_mem);
+static void cvPascalUpdateS(CVodeMem cv_mem, sunrealtype c, N_Vector* zS[]);
 static void cvSet(CVodeMem cv_mem);
 static void cvSetAdams(CVodeMem cv_mem);
 static sunrealtype cvAdamsStart(CVodeMem cv_mem, sunrealtype m[]);
@@ -485,7 +494,7 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   }
 
   cv_mem = NULL;
-  cv_mem = (CVodeMem)malloc(sizeof(struct CVodeMemRec));
+  cv_mem = (CVodeMem)SUNContext_ArenaAlloc(sunctx, sizeof(struct CVodeMemRec));
   if (cv_mem == NULL)
   {
     cvProcessError(NULL, 0, __LINE__, __func__, __FILE__, MSGCV_CVMEM_FAIL);
@@ -514,6 +523,7 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_e_data           = NULL;
   cv_mem->cv_monitorfun       = NULL;
   cv_mem->cv_monitor_interval = 0;
+  cv_mem->cv_trace            = NULL;
   cv_mem->cv_qmax             = maxord;
   cv_mem->cv_mxstep           = MXSTEP_DEFAULT;
   cv_mem->cv_mxhnil           = MXHNIL_DEFAULT;
@@ -624,6 +634,11 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_MallocDone            = SUNFALSE;
   cv_mem->cv_constraintsMallocDone = SUNFALSE;
 
+  /* Allocate the Nordsieck history array as separate vectors */
+
+  cv_mem->cv_zn_contig = SUNFALSE;
+  cv_mem->cv_zn_data   = NULL;
+
   cv_mem->cv_VabstolQMallocDone = SUNFALSE;
   cv_mem->cv_QuadMallocDone     = SUNFALSE;
 
@@ -822,11 +837,12 @@ int CVodeInit(void* cvode_mem, CVRhsFn f, sunrealtype t0, N_Vector y0)
   /* Set the linear solver addresses to NULL.
      (We check != NULL later, in CVode) */
 
-  cv_mem->cv_linit  = NULL;
-  cv_mem->cv_lsetup = NULL;
-  cv_mem->cv_lsolve = NULL;
-  cv_mem->cv_lfree  = NULL;
-  cv_mem->cv_lmem   = NULL;
+  cv_mem->cv_linit          = NULL;
+  cv_mem->cv_lsetup         = NULL;
+  cv_mem->cv_lsolve         = NULL;
+  cv_mem->cv_lsolvemultiple = NULL;
+  cv_mem->cv_lfree          = NULL;
+  cv_mem->cv_lmem           = NULL;
 
   /* Set forceSetup to SUNFALSE */
 
@@ -4453,7 +4469,7 @@ void CVodeFree(void** cvode_mem)
 
   if (cv_mem->proj_mem) { cvProjFree(&(cv_mem->proj_mem)); }
 
-  free(*cvode_mem);
+  SUNContext_ArenaFree(cv_mem->cv_sunctx, cv_mem);
   *cvode_mem = NULL;
 }
 
@@ -4640,8 +4656,6 @@ static sunbooleantype cvCheckNvector(N_Vector tmpl)
 
 static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl)
 {
-  int i, j;
-
   /* Allocate ewt, acor, tempv, ftemp */
 
   cv_mem->cv_ewt = N_VClone(tmpl);
@@ -4706,21 +4720,16 @@ static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl)
 
   /* Allocate zn[0] ... zn[qmax] */
 
-  for (j = 0; j <= cv_mem->cv_qmax; j++)
+  if (!cvAllocHistory(cv_mem, tmpl, cv_mem->cv_qmax))
   {
-    cv_mem->cv_zn[j] = N_VClone(tmpl);
-    if (cv_mem->cv_zn[j] == NULL)
-    {
-      N_VDestroy(cv_mem->cv_ewt);
-      N_VDestroy(cv_mem->cv_acor);
-      N_VDestroy(cv_mem->cv_tempv);
-      N_VDestroy(cv_mem->cv_ftemp);
-      N_VDestroy(cv_mem->cv_vtemp1);
-      N_VDestroy(cv_mem->cv_vtemp2);
-      N_VDestroy(cv_mem->cv_vtemp3);
-      for (i = 0; i < j; i++) { N_VDestroy(cv_mem->cv_zn[i]); }
-      return (SUNFALSE);
-    }
+    N_VDestroy(cv_mem->cv_ewt);
+    N_VDestroy(cv_mem->cv_acor);
+    N_VDestroy(cv_mem->cv_tempv);
+    N_VDestroy(cv_mem->cv_ftemp);
+    N_VDestroy(cv_mem->cv_vtemp1);
+    N_VDestroy(cv_mem->cv_vtemp2);
+    N_VDestroy(cv_mem->cv_vtemp3);
+    return (SUNFALSE);
   }
 
   /* Update solver workspace lengths  */
@@ -4741,7 +4750,7 @@ static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl)
 
 static void cvFreeVectors(CVodeMem cv_mem)
 {
-  int j, maxord;
+  int maxord;
 
   maxord = cv_mem->cv_qmax_alloc;
 
@@ -4752,7 +4761,7 @@ static void cvFreeVectors(CVodeMem cv_mem)
   N_VDestroy(cv_mem->cv_vtemp1);
   N_VDestroy(cv_mem->cv_vtemp2);
   N_VDestroy(cv_mem->cv_vtemp3);
-  for (j = 0; j <= maxord; j++) { N_VDestroy(cv_mem->cv_zn[j]); }
+  cvFreeHistory(cv_mem, maxord);
 
   cv_mem->cv_lrw -= (maxord + 8) * cv_mem->cv_lrw1;
   cv_mem->cv_liw -= (maxord + 8) * cv_mem->cv_liw1;
@@ -4772,6 +4781,84 @@ static void cvFreeVectors(CVodeMem cv_mem)
   }
 }
 
+/*
+ * cvAllocHistory
+ *
+ * This routine allocates the Nordsieck array zn[0], ..., zn[maxord]. If
+ * contiguous storage was requested (see CVodeSetContiguousHistory) and the
+ * vectors store their (local) data in a single host array, the data of all
+ * of the vectors is allocated as one block and zn[j] is a vector that uses
+ * the j-th slice of the block. Otherwise each vector is cloned from tmpl.
+ * If all memory allocations are successful, cvAllocHistory returns SUNTRUE.
+ * Otherwise all allocated memory is freed and cvAllocHistory returns
+ * SUNFALSE.
+ */
+
+sunbooleantype cvAllocHistory(CVodeMem cv_mem, N_Vector tmpl, int maxord)
+{
+  int i, j;
+  sunindextype nloc;
+  N_Vector_ID id;
+
+  nloc               = 0;
+  cv_mem->cv_zn_data = NULL;
+
+  if (cv_mem->cv_zn_contig)
+  {
+    id = N_VGetVectorID(tmpl);
+    if (id == SUNDIALS_NVEC_SERIAL || id == SUNDIALS_NVEC_OPENMP ||
+        id == SUNDIALS_NVEC_PTHREADS || id == SUNDIALS_NVEC_PARALLEL)
+    {
+      nloc = N_VGetLocalLength(tmpl);
+    }
+    if (nloc > 0)
+    {
+      cv_mem->cv_zn_data =
+        (sunrealtype*)malloc((maxord + 1) * nloc * sizeof(sunrealtype));
+      if (cv_mem->cv_zn_data == NULL) { return (SUNFALSE); }
+    }
+  }
+
+  for (j = 0; j <= maxord; j++)
+  {
+    if (cv_mem->cv_zn_data)
+    {
+      cv_mem->cv_zn[j] = N_VCloneEmpty(tmpl);
+      if (cv_mem->cv_zn[j])
+      {
+        N_VSetArrayPointer(cv_mem->cv_zn_data + j * nloc, cv_mem->cv_zn[j]);
+      }
+    }
+    else { cv_mem->cv_zn[j] = N_VClone(tmpl); }
+
+    if (cv_mem->cv_zn[j] == NULL)
+    {
+      for (i = 0; i < j; i++) { N_VDestroy(cv_mem->cv_zn[i]); }
+      free(cv_mem->cv_zn_data);
+      cv_mem->cv_zn_data = NULL;
+      return (SUNFALSE);
+    }
+  }
+
+  return (SUNTRUE);
+}
+
+/*
+ * cvFreeHistory
+ *
+ * This routine frees the Nordsieck array allocated in cvAllocHistory.
+ */
+
+void cvFreeHistory(CVodeMem cv_mem, int maxord)
+{
+  int j;
+
+  for (j = 0; j <= maxord; j++) { N_VDestroy(cv_mem->cv_zn[j]); }
+
+  free(cv_mem->cv_zn_data);
+  cv_mem->cv_zn_data = NULL;
+}
+
 /*
  * CVodeQuadAllocVectors
  *
@@ -5908,6 +5995,8 @@ static int cvStep(CVodeMem cv_mem)
                ", q = %d",
                cv_mem->cv_nst + 1, cv_mem->cv_tn, cv_mem->cv_h, cv_mem->cv_q);
 
+    cvTraceBeginStep(cv_mem);
+
     cvPredict(cv_mem);
     cvSet(cv_mem);
 
@@ -5919,6 +6008,9 @@ static int cvStep(CVodeMem cv_mem)
     SUNLogInfoIf(kflag == PREDICT_AGAIN || kflag != DO_ERROR_TEST, CV_LOGGER,
                  "end-step-attempt", "status = failed solve, kflag = %i", kflag);
 
+    cvTraceEndStepIf(cv_mem, kflag != DO_ERROR_TEST, SUN_STEPTRACE_SOLVE_FAIL,
+                     ZERO);
+
     /* Go back in loop if we need to predict again (nflag=PREV_CONV_FAIL) */
     if (kflag == PREDICT_AGAIN) { continue; }
 
@@ -5936,6 +6028,9 @@ static int cvStep(CVodeMem cv_mem)
       SUNLogInfoIf(pflag != CV_SUCCESS, CV_LOGGER, "end-step-attempt",
                    "status = failed projection, pflag = %i", pflag);
 
+      cvTraceEndStepIf(cv_mem, pflag != CV_SUCCESS, SUN_STEPTRACE_OTHER_FAIL,
+                       ZERO);
+
       /* Go back in loop if we need to predict again (nflag=PREV_PROJ_FAIL) */
       if (pflag == PREDICT_AGAIN) { continue; }
 
@@ -5952,6 +6047,9 @@ static int cvStep(CVodeMem cv_mem)
                  ", eflag = %i",
                  dsm, eflag);
 
+    cvTraceEndStepIf(cv_mem, eflag != CV_SUCCESS, SUN_STEPTRACE_ERRTEST_FAIL,
+                     dsm);
+
     /* Go back in loop if we need to predict again (nflag=PREV_ERR_FAIL) */
     if (eflag == TRY_AGAIN) { continue; }
 
@@ -5973,6 +6071,9 @@ static int cvStep(CVodeMem cv_mem)
                    "end-step-attempt", "status = failed quad solve, kflag = %i",
                    kflag);
 
+      cvTraceEndStepIf(cv_mem, kflag != DO_ERROR_TEST, SUN_STEPTRACE_SOLVE_FAIL,
+                       ZERO);
+
       if (kflag == PREDICT_AGAIN) { continue; }
       if (kflag != DO_ERROR_TEST) { return (kflag); }
 
@@ -5988,6 +6089,9 @@ static int cvStep(CVodeMem cv_mem)
                      ", eflag = %i",
                      dsmQ, eflag);
 
+        cvTraceEndStepIf(cv_mem, eflag != CV_SUCCESS,
+                         SUN_STEPTRACE_ERRTEST_FAIL, dsmQ);
+
         if (eflag == TRY_AGAIN) { continue; }
         if (eflag != CV_SUCCESS) { return (eflag); }
 
@@ -6014,6 +6118,8 @@ static int cvStep(CVodeMem cv_mem)
       SUNLogInfoIf(retval != 0, CV_LOGGER, "end-step-attempt",
                    "status = failed rhs eval, retval = %i", retval);
 
+      cvTraceEndStepIf(cv_mem, retval != 0, SUN_STEPTRACE_OTHER_FAIL, ZERO);
+
       if (retval < 0) { return (CV_RHSFUNC_FAIL); }
       if (retval > 0)
       {
@@ -6046,6 +6152,9 @@ static int cvStep(CVodeMem cv_mem)
                    "end-step-attempt", "status = failed sens solve, kflag = %i",
                    kflag);
 
+      cvTraceEndStepIf(cv_mem, kflag != DO_ERROR_TEST, SUN_STEPTRACE_SOLVE_FAIL,
+                       ZERO);
+
       if (kflag == PREDICT_AGAIN) { continue; }
       if (kflag != DO_ERROR_TEST) { return (kflag); }
 
@@ -6066,6 +6175,9 @@ static int cvStep(CVodeMem cv_mem)
                      ", eflag = %i",
                      dsmS, eflag);
 
+        cvTraceEndStepIf(cv_mem, eflag != CV_SUCCESS,
+                         SUN_STEPTRACE_ERRTEST_FAIL, dsmS);
+
         if (eflag == TRY_AGAIN) { continue; }
         if (eflag != CV_SUCCESS) { return (eflag); }
 
@@ -6098,6 +6210,9 @@ static int cvStep(CVodeMem cv_mem)
                    "end-step-attempt",
                    "status = failed quad sens solve, kflag = %i", kflag);
 
+      cvTraceEndStepIf(cv_mem, kflag != DO_ERROR_TEST, SUN_STEPTRACE_SOLVE_FAIL,
+                       ZERO);
+
       if (kflag == PREDICT_AGAIN) { continue; }
       if (kflag != DO_ERROR_TEST) { return (kflag); }
 
@@ -6114,6 +6229,9 @@ static int cvStep(CVodeMem cv_mem)
                      "= " SUN_FORMAT_G ", eflag = %i",
                      dsmQS, eflag);
 
+        cvTraceEndStepIf(cv_mem, eflag != CV_SUCCESS,
+                         SUN_STEPTRACE_ERRTEST_FAIL, dsmQS);
+
         if (eflag == TRY_AGAIN) { continue; }
         if (eflag != CV_SUCCESS) { return (eflag); }
 
@@ -6128,6 +6246,7 @@ static int cvStep(CVodeMem cv_mem)
 
   SUNLogInfo(CV_LOGGER, "end-step-attempt",
              "status = success, dsm = " SUN_FORMAT_G, dsm);
+  cvTraceEndStepIf(cv_mem, SUNTRUE, SUN_STEPTRACE_SUCCESS, dsm);
 
   /* Nonlinear system solve and error test were both successful.
      Update data, and consider change of step and/or order.       */
@@ -6182,6 +6301,73 @@ static int cvStep(CVodeMem cv_mem)
   return (CV_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Step trace functions
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * cvTraceCounters
+ *
+ * This routine returns the linear iteration and Jacobian evaluation
+ * counters of the CVLS interface, or zero for other linear solver
+ * interfaces.
+ */
+
+static void cvTraceCounters(CVodeMem cv_mem, long int* nli, long int* nje)
+{
+  CVLsMem cvls_mem;
+
+  *nli = 0;
+  *nje = 0;
+
+  if (cv_mem->cv_lmem && cv_mem->cv_linit == cvLsInitialize)
+  {
+    cvls_mem = (CVLsMem)(cv_mem->cv_lmem);
+    *nli     = cvls_mem->nli;
+    *nje     = cvls_mem->nje;
+  }
+}
+
+/*
+ * cvTraceBeginStep
+ *
+ * This routine stores the state at the start of a step attempt in
+ * the step trace, if one is attached.
+ */
+
+static void cvTraceBeginStep(CVodeMem cv_mem)
+{
+  long int nli, nje;
+
+  if (!cv_mem->cv_trace) { return; }
+
+  cvTraceCounters(cv_mem, &nli, &nje);
+  SUNStepTrace_BeginStep(cv_mem->cv_trace, cv_mem->cv_tn, cv_mem->cv_h,
+                         cv_mem->cv_q, cv_mem->cv_nni, nli, nje,
+                         cv_mem->cv_nsetups);
+}
+
+/*
+ * cvTraceEndStepIf
+ *
+ * If condition is true, this routine records the outcome of the
+ * current step attempt in the step trace, if one is attached.
+ */
+
+static void cvTraceEndStepIf(CVodeMem cv_mem, sunbooleantype condition,
+                             SUNStepTraceStatus status, sunrealtype dsm)
+{
+  long int nli, nje;
+
+  if (!cv_mem->cv_trace || !condition) { return; }
+
+  cvTraceCounters(cv_mem, &nli, &nje);
+  SUNStepTrace_EndStep(cv_mem->cv_trace, status, dsm, cv_mem->cv_nni, nli, nje,
+                       cv_mem->cv_nsetups);
+}
+
 /*
  * -----------------------------------------------------------------
  * Function called at beginning of step
@@ -6592,15 +6778,14 @@ void cvRescale(CVodeMem cv_mem)
  *
  * This routine advances tn by the tentative step size h, and computes
  * the predicted array z_n(0), which is overwritten on zn.  The
- * prediction of zn is done by repeated additions.
+ * prediction of zn is done by repeated additions, which are fused into a
+ * single pass over the array when the vectors provide N_VPascalUpdate.
  * If tstop is enabled, it is possible for tn + h to be past tstop by roundoff,
  * and in that case, we reset tn (after incrementing by h) to tstop.
  */
 
 static void cvPredict(CVodeMem cv_mem)
 {
-  int j, k;
-
   cv_mem->cv_tn += cv_mem->cv_h;
   if (cv_mem->cv_tstopset)
   {
@@ -6610,58 +6795,65 @@ static void cvPredict(CVodeMem cv_mem)
     }
   }
 
-  for (k = 1; k <= cv_mem->cv_q; k++)
-  {
-    for (j = cv_mem->cv_q; j >= k; j--)
-    {
-      N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], ONE, cv_mem->cv_zn[j],
-                   cv_mem->cv_zn[j - 1]);
-    }
-  }
+  (void)N_VPascalUpdate(cv_mem->cv_q + 1, ONE, cv_mem->cv_zn);
 
   SUNLogExtraDebugVec(CV_LOGGER, "forward", cv_mem->cv_zn[0], "zn_0(:) =");
 
   if (cv_mem->cv_quadr)
   {
-    for (k = 1; k <= cv_mem->cv_q; k++)
-    {
-      for (j = cv_mem->cv_q; j >= k; j--)
-      {
-        N_VLinearSum(ONE, cv_mem->cv_znQ[j - 1], ONE, cv_mem->cv_znQ[j],
-                     cv_mem->cv_znQ[j - 1]);
-      }
-    }
+    (void)N_VPascalUpdate(cv_mem->cv_q + 1, ONE, cv_mem->cv_znQ);
 
     SUNLogExtraDebugVec(CV_LOGGER, "quad", cv_mem->cv_znQ[0], "znQ_0(:) =");
   }
 
   if (cv_mem->cv_sensi)
   {
-    for (k = 1; k <= cv_mem->cv_q; k++)
+    cvPascalUpdateS(cv_mem, ONE, cv_mem->cv_znS);
+
+    SUNLogExtraDebugVecArray(CV_LOGGER, "sensi", cv_mem->cv_Ns,
+                             cv_mem->cv_znS[0], "znS_%d(:) =");
+  }
+
+  if (cv_mem->cv_quadr_sensi)
+  {
+    cvPascalUpdateS(cv_mem, ONE, cv_mem->cv_znQS);
+
+    SUNLogExtraDebugVecArray(CV_LOGGER, "quad-sensi", cv_mem->cv_Ns,
+                             cv_mem->cv_znQS[0], "znQS_%d(:) =");
+  }
+}
+
+/*
+ * cvPascalUpdateS
+ *
+ * This routine applies the repeated additions of cvPredict (c = 1) or
+ * cvRestore (c = -1) to the Nordsieck arrays of the sensitivities or
+ * quadrature sensitivities. When the vectors provide N_VPascalUpdate, the
+ * history of each sensitivity is updated in a single pass, otherwise the
+ * additions are done with vector array operations over all sensitivities.
+ */
+
+static void cvPascalUpdateS(CVodeMem cv_mem, sunrealtype c, N_Vector* zS[])
+{
+  int is, j, k;
+  N_Vector z[L_MAX];
+
+  if (zS[0][0]->ops->nvpascalupdate != NULL)
+  {
+    for (is = 0; is < cv_mem->cv_Ns; is++)
     {
-      for (j = cv_mem->cv_q; j >= k; j--)
-      {
-        (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, ONE, cv_mem->cv_znS[j - 1],
-                                      ONE, cv_mem->cv_znS[j],
-                                      cv_mem->cv_znS[j - 1]);
-        SUNLogExtraDebugVecArray(CV_LOGGER, "sensi", cv_mem->cv_Ns,
-                                 cv_mem->cv_znS[0], "znS_%d(:) =");
-      }
+      for (j = 0; j <= cv_mem->cv_q; j++) { z[j] = zS[j][is]; }
+      (void)N_VPascalUpdate(cv_mem->cv_q + 1, c, z);
     }
+    return;
   }
 
-  if (cv_mem->cv_quadr_sensi)
+  for (k = 1; k <= cv_mem->cv_q; k++)
   {
-    for (k = 1; k <= cv_mem->cv_q; k++)
+    for (j = cv_mem->cv_q; j >= k; j--)
     {
-      for (j = cv_mem->cv_q; j >= k; j--)
-      {
-        (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, ONE, cv_mem->cv_znQS[j - 1],
-                                      ONE, cv_mem->cv_znQS[j],
-                                      cv_mem->cv_znQS[j - 1]);
-        SUNLogExtraDebugVecArray(CV_LOGGER, "quad-sensi", cv_mem->cv_Ns,
-                                 cv_mem->cv_znQS[0], "znQS_%d(:) =");
-      }
+      (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, ONE, zS[j - 1], c, zS[j],
+                                    zS[j - 1]);
     }
   }
 }
@@ -7453,54 +7645,19 @@ static int cvHandleNFlag(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 
 void cvRestore(CVodeMem cv_mem, sunrealtype saved_t)
 {
-  int j, k;
-
   cv_mem->cv_tn = saved_t;
-  for (k = 1; k <= cv_mem->cv_q; k++)
-  {
-    for (j = cv_mem->cv_q; j >= k; j--)
-    {
-      N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], -ONE, cv_mem->cv_zn[j],
-                   cv_mem->cv_zn[j - 1]);
-    }
-  }
+  (void)N_VPascalUpdate(cv_mem->cv_q + 1, -ONE, cv_mem->cv_zn);
 
   if (cv_mem->cv_quadr)
   {
-    for (k = 1; k <= cv_mem->cv_q; k++)
-    {
-      for (j = cv_mem->cv_q; j >= k; j--)
-      {
-        N_VLinearSum(ONE, cv_mem->cv_znQ[j - 1], -ONE, cv_mem->cv_znQ[j],
-                     cv_mem->cv_znQ[j - 1]);
-      }
-    }
+    (void)N_VPascalUpdate(cv_mem->cv_q + 1, -ONE, cv_mem->cv_znQ);
   }
 
-  if (cv_mem->cv_sensi)
-  {
-    for (k = 1; k <= cv_mem->cv_q; k++)
-    {
-      for (j = cv_mem->cv_q; j >= k; j--)
-      {
-        (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, ONE, cv_mem->cv_znS[j - 1],
-                                      -ONE, cv_mem->cv_znS[j],
-                                      cv_mem->cv_znS[j - 1]);
-      }
-    }
-  }
+  if (cv_mem->cv_sensi) { cvPascalUpdateS(cv_mem, -ONE, cv_mem->cv_znS); }
 
   if (cv_mem->cv_quadr_sensi)
   {
-    for (k = 1; k <= cv_mem->cv_q; k++)
-    {
-      for (j = cv_mem->cv_q; j >= k; j--)
-      {
-        (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, ONE, cv_mem->cv_znQS[j - 1],
-                                      -ONE, cv_mem->cv_znQS[j],
-                                      cv_mem->cv_znQS[j - 1]);
-      }
-    }
+    cvPascalUpdateS(cv_mem, -ONE, cv_mem->cv_znQS);
   }
 }
 
@@ -23,6 +23,7 @@
 #include <nvector/nvector_serial.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sundials/sundials_band.h>
 #include <sundials/sundials_math.h>
 
 #include "cvodes_bbdpre_impl.h"
@@ -34,6 +35,9 @@
 #define ONE          SUN_RCONST(1.0)
 #define TWO          SUN_RCONST(2.0)
 
+/* pivots of the band LU factorization of a sub-block */
+#define BAND_PIVOTS(S) (((SUNLinearSolverContent_Band)((S)->content))->pivots)
+
 /* Prototypes of functions cvBBDPrecSetup and cvBBDPrecSolve */
 static int cvBBDPrecSetup(sunrealtype t, N_Vector y, N_Vector fy,
                           sunbooleantype jok, sunbooleantype* jcurPtr,
@@ -53,7 +57,14 @@ static int cvCfnWrapper(sunindextype NlocalB, sunrealtype t, N_Vector yB,
 
 /* Prototype for difference quotient Jacobian calculation routine */
 static int cvBBDDQJac(CVBBDPrecData pdata, sunrealtype t, N_Vector y,
-                      N_Vector gy, N_Vector ytemp, N_Vector gtemp);
+                      N_Vector gy);
+
+/* Prototypes for sub-block utility routines */
+static int cvBBDAllocSubBlocks(CVodeMem cv_mem, CVBBDPrecData pdata, int nsub,
+                               CVBBDSubBlock* sub);
+static void cvBBDFreeSubBlocks(int nsub, CVBBDSubBlock sub);
+static void cvBBDWorkSpace(CVBBDPrecData pdata);
+static int cvBBDSubBlockRetval(CVBBDPrecData pdata);
 
 /* Prototype for the backward pfree routine */
 static int CVBBDPrecFreeB(CVodeBMem cvB_mem);
@@ -72,8 +83,7 @@ int CVBBDPrecInit(void* cvode_mem, sunindextype Nlocal, sunindextype mudq,
   CVodeMem cv_mem;
   CVLsMem cvls_mem;
   CVBBDPrecData pdata;
-  sunindextype muk, mlk, storage_mu, lrw1, liw1;
-  long int lrw, liw;
+  sunindextype muk, mlk;
   int flag;
 
   if (cvode_mem == NULL)
@@ -122,97 +132,11 @@ int CVBBDPrecInit(void* cvode_mem, sunindextype Nlocal, sunindextype mudq,
   pdata->mukeep    = muk;
   pdata->mlkeep    = mlk;
 
-  /* Allocate memory for saved Jacobian */
-  pdata->savedJ = SUNBandMatrixStorage(Nlocal, muk, mlk, muk, cv_mem->cv_sunctx);
-  if (pdata->savedJ == NULL)
-  {
-    free(pdata);
-    pdata = NULL;
-    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                   MSGBBD_MEM_FAIL);
-    return (CVLS_MEM_FAIL);
-  }
-
-  /* Allocate memory for preconditioner matrix */
-  storage_mu    = SUNMIN(Nlocal - 1, muk + mlk);
-  pdata->savedP = NULL;
-  pdata->savedP = SUNBandMatrixStorage(Nlocal, muk, mlk, storage_mu,
-                                       cv_mem->cv_sunctx);
-  if (pdata->savedP == NULL)
-  {
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                   MSGBBD_MEM_FAIL);
-    return (CVLS_MEM_FAIL);
-  }
-
-  /* Allocate memory for temporary N_Vectors */
-  pdata->zlocal = NULL;
-  pdata->zlocal = N_VNewEmpty_Serial(Nlocal, cv_mem->cv_sunctx);
-  if (pdata->zlocal == NULL)
-  {
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                   MSGBBD_MEM_FAIL);
-    return (CVLS_MEM_FAIL);
-  }
-  pdata->rlocal = NULL;
-  pdata->rlocal = N_VNewEmpty_Serial(Nlocal, cv_mem->cv_sunctx);
-  if (pdata->rlocal == NULL)
-  {
-    N_VDestroy(pdata->zlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                   MSGBBD_MEM_FAIL);
-    return (CVLS_MEM_FAIL);
-  }
+  /* Allocate memory for temporary N_Vector */
   pdata->tmp1 = NULL;
   pdata->tmp1 = N_VClone(cv_mem->cv_tempv);
   if (pdata->tmp1 == NULL)
   {
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                   MSGBBD_MEM_FAIL);
-    return (CVLS_MEM_FAIL);
-  }
-  pdata->tmp2 = NULL;
-  pdata->tmp2 = N_VClone(cv_mem->cv_tempv);
-  if (pdata->tmp2 == NULL)
-  {
-    N_VDestroy(pdata->tmp1);
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                   MSGBBD_MEM_FAIL);
-    return (CVLS_MEM_FAIL);
-  }
-  pdata->tmp3 = NULL;
-  pdata->tmp3 = N_VClone(cv_mem->cv_tempv);
-  if (pdata->tmp3 == NULL)
-  {
-    N_VDestroy(pdata->tmp1);
-    N_VDestroy(pdata->tmp2);
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
     free(pdata);
     pdata = NULL;
     cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
@@ -220,83 +144,30 @@ int CVBBDPrecInit(void* cvode_mem, sunindextype Nlocal, sunindextype mudq,
     return (CVLS_MEM_FAIL);
   }
 
-  /* Allocate memory for banded linear solver */
-  pdata->LS = NULL;
-  pdata->LS = SUNLinSol_Band(pdata->rlocal, pdata->savedP, cv_mem->cv_sunctx);
-  if (pdata->LS == NULL)
-  {
-    N_VDestroy(pdata->tmp1);
-    N_VDestroy(pdata->tmp2);
-    N_VDestroy(pdata->tmp3);
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    free(pdata);
-    pdata = NULL;
-    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                   MSGBBD_MEM_FAIL);
-    return (CVLS_MEM_FAIL);
-  }
+  /* Store Nlocal to be used in CVBBDPrecSetup */
+  pdata->n_local = Nlocal;
 
-  /* initialize band linear solver object */
-  flag = SUNLinSolInitialize(pdata->LS);
-  if (flag != SUN_SUCCESS)
+  /* Allocate matrices and band linear solver for a single local block */
+  pdata->nsub = 1;
+  pdata->sub  = NULL;
+  flag        = cvBBDAllocSubBlocks(cv_mem, pdata, 1, &(pdata->sub));
+  if (flag != CVLS_SUCCESS)
   {
     N_VDestroy(pdata->tmp1);
-    N_VDestroy(pdata->tmp2);
-    N_VDestroy(pdata->tmp3);
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    SUNMatDestroy(pdata->savedP);
-    SUNMatDestroy(pdata->savedJ);
-    SUNLinSolFree(pdata->LS);
     free(pdata);
     pdata = NULL;
-    cvProcessError(cv_mem, CVLS_SUNLS_FAIL, __LINE__, __func__, __FILE__,
-                   MSGBBD_SUNLS_FAIL);
-    return (CVLS_SUNLS_FAIL);
+    cvProcessError(cv_mem, flag, __LINE__, __func__, __FILE__,
+                   (flag == CVLS_MEM_FAIL) ? MSGBBD_MEM_FAIL
+                                           : MSGBBD_SUNLS_FAIL);
+    return (flag);
   }
+  pdata->jvalid = SUNFALSE;
 
   /* Set pdata->dqrely based on input dqrely (0 implies default). */
   pdata->dqrely = (dqrely > ZERO) ? dqrely : SUNRsqrt(cv_mem->cv_uround);
 
-  /* Store Nlocal to be used in CVBBDPrecSetup */
-  pdata->n_local = Nlocal;
-
   /* Set work space sizes and initialize nge */
-  pdata->rpwsize = 0;
-  pdata->ipwsize = 0;
-  if (cv_mem->cv_tempv->ops->nvspace)
-  {
-    N_VSpace(cv_mem->cv_tempv, &lrw1, &liw1);
-    pdata->rpwsize += 3 * lrw1;
-    pdata->ipwsize += 3 * liw1;
-  }
-  if (pdata->rlocal->ops->nvspace)
-  {
-    N_VSpace(pdata->rlocal, &lrw1, &liw1);
-    pdata->rpwsize += 2 * lrw1;
-    pdata->ipwsize += 2 * liw1;
-  }
-  if (pdata->savedJ->ops->space)
-  {
-    flag = SUNMatSpace(pdata->savedJ, &lrw, &liw);
-    pdata->rpwsize += lrw;
-    pdata->ipwsize += liw;
-  }
-  if (pdata->savedP->ops->space)
-  {
-    flag = SUNMatSpace(pdata->savedP, &lrw, &liw);
-    pdata->rpwsize += lrw;
-    pdata->ipwsize += liw;
-  }
-  if (pdata->LS->ops->space)
-  {
-    flag = SUNLinSolSpace(pdata->LS, &lrw, &liw);
-    pdata->rpwsize += lrw;
-    pdata->ipwsize += liw;
-  }
+  cvBBDWorkSpace(pdata);
   pdata->nge = 0;
 
   /* make sure s_P_data is free from any previous allocations */
@@ -361,6 +232,69 @@ int CVBBDPrecReInit(void* cvode_mem, sunindextype mudq, sunindextype mldq,
   return (CVLS_SUCCESS);
 }
 
+int CVBBDPrecSetNumSubBlocks(void* cvode_mem, int nsub)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  CVBBDPrecData pdata;
+  CVBBDSubBlock sub;
+  int flag;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CVLS_MEM_NULL, __LINE__, __func__, __FILE__,
+                   MSGBBD_MEM_NULL);
+    return (CVLS_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  if (cv_mem->cv_lmem == NULL)
+  {
+    cvProcessError(cv_mem, CVLS_LMEM_NULL, __LINE__, __func__, __FILE__,
+                   MSGBBD_LMEM_NULL);
+    return (CVLS_LMEM_NULL);
+  }
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  if (cvls_mem->P_data == NULL)
+  {
+    cvProcessError(cv_mem, CVLS_PMEM_NULL, __LINE__, __func__, __FILE__,
+                   MSGBBD_PMEM_NULL);
+    return (CVLS_PMEM_NULL);
+  }
+  pdata = (CVBBDPrecData)cvls_mem->P_data;
+
+  if (nsub < 1 || nsub > pdata->n_local)
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGBBD_BAD_NSUB);
+    return (CVLS_ILL_INPUT);
+  }
+  if (nsub == pdata->nsub) { return (CVLS_SUCCESS); }
+
+  /* Allocate the new sub-blocks before releasing the current ones */
+  sub  = NULL;
+  flag = cvBBDAllocSubBlocks(cv_mem, pdata, nsub, &sub);
+  if (flag != CVLS_SUCCESS)
+  {
+    cvProcessError(cv_mem, flag, __LINE__, __func__, __FILE__,
+                   (flag == CVLS_MEM_FAIL) ? MSGBBD_MEM_FAIL
+                                           : MSGBBD_SUNLS_FAIL);
+    return (flag);
+  }
+
+  cvBBDFreeSubBlocks(pdata->nsub, pdata->sub);
+  pdata->nsub = nsub;
+  pdata->sub  = sub;
+
+  /* The next setup must compute new Jacobian blocks */
+  pdata->jvalid = SUNFALSE;
+
+  cvBBDWorkSpace(pdata);
+
+  return (CVLS_SUCCESS);
+}
+
 int CVBBDPrecGetWorkSpace(void* cvode_mem, long int* lenrwBBDP,
                           long int* leniwBBDP)
 {
@@ -485,31 +419,31 @@ static int cvBBDPrecSetup(sunrealtype t, N_Vector y,
                           void* bbd_data)
 {
   CVBBDPrecData pdata;
+  CVBBDSubBlock sub;
   CVodeMem cv_mem;
-  int retval;
+  int retval, s;
 
   pdata  = (CVBBDPrecData)bbd_data;
   cv_mem = (CVodeMem)pdata->cvode_mem;
+  sub    = pdata->sub;
 
   /* If jok = SUNTRUE, use saved copy of J */
-  if (jok)
-  {
-    *jcurPtr = SUNFALSE;
-    retval   = SUNMatCopy(pdata->savedJ, pdata->savedP);
-    if (retval < 0)
-    {
-      cvProcessError(cv_mem, -1, __LINE__, __func__, __FILE__,
-                     MSGBBD_SUNMAT_FAIL);
-      return (-1);
-    }
-    if (retval > 0) { return (1); }
+  if (jok && pdata->jvalid) { *jcurPtr = SUNFALSE; }
 
-    /* Otherwise call cvBBDDQJac for new J value */
-  }
+  /* Otherwise call cvBBDDQJac for new J value */
   else
   {
     *jcurPtr = SUNTRUE;
-    retval   = SUNMatZero(pdata->savedJ);
+
+    /* The sub-blocks share one SUNContext, so the parallel regions call the
+       object operations directly rather than the generic wrappers, which
+       access the profiler and error state stored in the context. */
+    SUNDIALS_OMP_PARALLEL_FOR(pdata->nsub)
+    for (s = 0; s < pdata->nsub; s++)
+    {
+      sub[s].retval = sub[s].savedJ->ops->zero(sub[s].savedJ);
+    }
+    retval = cvBBDSubBlockRetval(pdata);
     if (retval < 0)
     {
       cvProcessError(cv_mem, -1, __LINE__, __func__, __FILE__,
@@ -518,7 +452,7 @@ static int cvBBDPrecSetup(sunrealtype t, N_Vector y,
     }
     if (retval > 0) { return (1); }
 
-    retval = cvBBDDQJac(pdata, t, y, pdata->tmp1, pdata->tmp2, pdata->tmp3);
+    retval = cvBBDDQJac(pdata, t, y, pdata->tmp1);
     if (retval < 0)
     {
       cvProcessError(cv_mem, -1, __LINE__, __func__, __FILE__,
@@ -527,27 +461,36 @@ static int cvBBDPrecSetup(sunrealtype t, N_Vector y,
     }
     if (retval > 0) { return (1); }
 
-    retval = SUNMatCopy(pdata->savedJ, pdata->savedP);
-    if (retval < 0)
+    pdata->jvalid = SUNTRUE;
+  }
+
+  /* Copy J, scale and add I to get P = I - gamma*J, and do the LU
+     factorization of each sub-block. Matrix failures are flagged with -1,
+     failures of the band linear solver with the solver return value. */
+  SUNDIALS_OMP_PARALLEL_FOR(pdata->nsub)
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    if (sub[s].savedJ->ops->copy(sub[s].savedJ, sub[s].savedP) ||
+        sub[s].savedP->ops->scaleaddi(-gamma, sub[s].savedP))
     {
-      cvProcessError(cv_mem, -1, __LINE__, __func__, __FILE__,
-                     MSGBBD_SUNMAT_FAIL);
-      return (-1);
+      sub[s].retval = -1;
     }
-    if (retval > 0) { return (1); }
+    else { sub[s].retval = sub[s].LS->ops->setup(sub[s].LS, sub[s].savedP); }
   }
 
-  /* Scale and add I to get P = I - gamma*J */
-  retval = SUNMatScaleAddI(-gamma, pdata->savedP);
-  if (retval)
+  /* Return the first error flag */
+  for (s = 0; s < pdata->nsub; s++)
   {
-    cvProcessError(cv_mem, -1, __LINE__, __func__, __FILE__, MSGBBD_SUNMAT_FAIL);
-    return (-1);
+    if (sub[s].retval == -1)
+    {
+      cvProcessError(cv_mem, -1, __LINE__, __func__, __FILE__,
+                     MSGBBD_SUNMAT_FAIL);
+      return (-1);
+    }
+    if (sub[s].retval != 0) { return (sub[s].retval); }
   }
 
-  /* Do LU factorization of matrix and return error flag */
-  retval = SUNLinSolSetup_Band(pdata->LS, pdata->savedP);
-  return (retval);
+  return (0);
 }
 
 /*-----------------------------------------------------------------
@@ -576,24 +519,39 @@ static int cvBBDPrecSolve(SUNDIALS_MAYBE_UNUSED sunrealtype t,
                           SUNDIALS_MAYBE_UNUSED sunrealtype delta,
                           SUNDIALS_MAYBE_UNUSED int lr, void* bbd_data)
 {
-  int retval;
   CVBBDPrecData pdata;
+  CVBBDSubBlock sub;
+  sunrealtype *r_data, *z_data;
+  int s;
 
-  pdata = (CVBBDPrecData)bbd_data;
-
-  /* Attach local data arrays for r and z to rlocal and zlocal */
-  N_VSetArrayPointer(N_VGetArrayPointer(r), pdata->rlocal);
-  N_VSetArrayPointer(N_VGetArrayPointer(z), pdata->zlocal);
-
-  /* Call banded solver object to do the work */
-  retval = SUNLinSolSolve(pdata->LS, pdata->savedP, pdata->zlocal,
-                          pdata->rlocal, ZERO);
+  pdata  = (CVBBDPrecData)bbd_data;
+  sub    = pdata->sub;
+  r_data = N_VGetArrayPointer(r);
+  z_data = N_VGetArrayPointer(z);
 
-  /* Detach local data arrays from rlocal and zlocal */
-  N_VSetArrayPointer(NULL, pdata->rlocal);
-  N_VSetArrayPointer(NULL, pdata->zlocal);
+  SUNDIALS_OMP_PARALLEL_FOR(pdata->nsub)
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    /* Attach local data arrays for r and z to rlocal and zlocal */
+    sub[s].rlocal->ops->nvsetarraypointer(r_data + sub[s].offset,
+                                          sub[s].rlocal);
+    sub[s].zlocal->ops->nvsetarraypointer(z_data + sub[s].offset,
+                                          sub[s].zlocal);
+
+    /* Copy r to z and solve with the band LU factors. The factors are used
+       directly as SUNLinSolSolve_Band calls the generic vector operations. */
+    sub[s].zlocal->ops->nvscale(ONE, sub[s].rlocal, sub[s].zlocal);
+    SUNDlsMat_bandGBTRS(SM_COLS_B(sub[s].savedP), SM_COLUMNS_B(sub[s].savedP),
+                        SM_SUBAND_B(sub[s].savedP), SM_LBAND_B(sub[s].savedP),
+                        BAND_PIVOTS(sub[s].LS), z_data + sub[s].offset);
+    sub[s].retval = 0;
+
+    /* Detach local data arrays from rlocal and zlocal */
+    sub[s].rlocal->ops->nvsetarraypointer(NULL, sub[s].rlocal);
+    sub[s].zlocal->ops->nvsetarraypointer(NULL, sub[s].zlocal);
+  }
 
-  return (retval);
+  return (cvBBDSubBlockRetval(pdata));
 }
 
 static int cvBBDPrecFree(CVodeMem cv_mem)
@@ -607,14 +565,8 @@ static int cvBBDPrecFree(CVodeMem cv_mem)
   if (cvls_mem->P_data == NULL) { return (0); }
   pdata = (CVBBDPrecData)cvls_mem->P_data;
 
-  SUNLinSolFree(pdata->LS);
+  cvBBDFreeSubBlocks(pdata->nsub, pdata->sub);
   N_VDestroy(pdata->tmp1);
-  N_VDestroy(pdata->tmp2);
-  N_VDestroy(pdata->tmp3);
-  N_VDestroy(pdata->zlocal);
-  N_VDestroy(pdata->rlocal);
-  SUNMatDestroy(pdata->savedP);
-  SUNMatDestroy(pdata->savedJ);
 
   free(pdata);
   pdata = NULL;
@@ -635,24 +587,31 @@ static int cvBBDPrecFree(CVodeMem cv_mem)
   But the band matrix kept has bandwidth = mlkeep + mukeep + 1.
   This routine also assumes that the local elements of a vector are
   stored contiguously.
+
+  When the local block is split into sub-blocks, the column groups
+  are distributed over the sub-blocks' work vectors in a round-robin
+  fashion and evaluated concurrently. Each group sets the columns of
+  all sub-blocks, keeping only the elements that lie inside the
+  sub-block of the column.
   -----------------------------------------------------------------*/
 static int cvBBDDQJac(CVBBDPrecData pdata, sunrealtype t, N_Vector y,
-                      N_Vector gy, N_Vector ytemp, N_Vector gtemp)
+                      N_Vector gy)
 {
   CVodeMem cv_mem;
-  sunrealtype gnorm, minInc, inc, inc_inv, yj, conj;
-  sunindextype group, i, j, width, ngroups, i1, i2;
-  sunrealtype *y_data, *ewt_data, *gy_data, *gtemp_data;
-  sunrealtype *ytemp_data, *col_j, *cns_data;
-  int retval;
+  CVBBDSubBlock sub;
+  sunrealtype gnorm, minInc;
+  sunindextype width, ngroups;
+  sunrealtype *y_data, *ewt_data, *gy_data, *cns_data;
+  int retval, s, nthreads;
 
   /* initialize cns_data to avoid compiler warning */
   cns_data = NULL;
 
   cv_mem = (CVodeMem)pdata->cvode_mem;
+  sub    = pdata->sub;
 
-  /* Load ytemp with y = predicted solution vector */
-  N_VScale(ONE, y, ytemp);
+  /* Load each ytemp with y = predicted solution vector */
+  for (s = 0; s < pdata->nsub; s++) { N_VScale(ONE, y, sub[s].ytemp); }
 
   /* Call cfn and gloc to get base value of g(t,y) */
   if (pdata->cfn != NULL)
@@ -661,16 +620,15 @@ static int cvBBDDQJac(CVBBDPrecData pdata, sunrealtype t, N_Vector y,
     if (retval != 0) { return (retval); }
   }
 
-  retval = pdata->gloc(pdata->n_local, t, ytemp, gy, cv_mem->cv_user_data);
+  retval = pdata->gloc(pdata->n_local, t, sub[0].ytemp, gy,
+                       cv_mem->cv_user_data);
   pdata->nge++;
   if (retval != 0) { return (retval); }
 
   /* Obtain pointers to the data for various vectors */
-  y_data     = N_VGetArrayPointer(y);
-  gy_data    = N_VGetArrayPointer(gy);
-  ewt_data   = N_VGetArrayPointer(cv_mem->cv_ewt);
-  ytemp_data = N_VGetArrayPointer(ytemp);
-  gtemp_data = N_VGetArrayPointer(gtemp);
+  y_data   = N_VGetArrayPointer(y);
+  gy_data  = N_VGetArrayPointer(gy);
+  ewt_data = N_VGetArrayPointer(cv_mem->cv_ewt);
   if (cv_mem->cv_constraintsSet)
   {
     cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
@@ -686,69 +644,273 @@ static int cvBBDDQJac(CVBBDPrecData pdata, sunrealtype t, N_Vector y,
   width   = pdata->mldq + pdata->mudq + 1;
   ngroups = SUNMIN(width, pdata->n_local);
 
-  /* Loop over groups */
-  for (group = 1; group <= ngroups; group++)
+  /* Loop over the groups assigned to each set of work vectors. The adjoint
+     gloc wrapper interpolates the forward solution into shared storage, so
+     the groups of a backward problem are evaluated by a single thread. */
+  nthreads = (pdata->gloc == cvGlocWrapper) ? 1 : pdata->nsub;
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < pdata->nsub; s++)
   {
-    /* Increment all y_j in group */
-    for (j = group - 1; j < pdata->n_local; j += width)
-    {
-      inc = SUNMAX(pdata->dqrely * SUNRabs(y_data[j]), minInc / ewt_data[j]);
-      yj  = y_data[j];
+    sunrealtype inc, inc_inv, yj, conj;
+    sunrealtype *ytemp_data, *gtemp_data, *col_j;
+    sunindextype group, i, j, i1, i2, off;
+    int b;
 
-      /* Adjust sign(inc) again if yj has an inequality constraint. */
-      if (cv_mem->cv_constraintsSet)
+    ytemp_data    = sub[s].ytemp->ops->nvgetarraypointer(sub[s].ytemp);
+    gtemp_data    = sub[s].gtemp->ops->nvgetarraypointer(sub[s].gtemp);
+    sub[s].nge    = 0;
+    sub[s].retval = 0;
+
+    for (group = s + 1; group <= ngroups; group += pdata->nsub)
+    {
+      /* Increment all y_j in group */
+      for (j = group - 1; j < pdata->n_local; j += width)
       {
-        conj = cns_data[j];
-        if (SUNRabs(conj) == ONE)
-        {
-          if ((yj + inc) * conj < ZERO) { inc = -inc; }
-        }
-        else if (SUNRabs(conj) == TWO)
+        inc = SUNMAX(pdata->dqrely * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+        yj  = y_data[j];
+
+        /* Adjust sign(inc) again if yj has an inequality constraint. */
+        if (cv_mem->cv_constraintsSet)
         {
-          if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          }
         }
-      }
 
-      ytemp_data[j] += inc;
-    }
-
-    /* Evaluate g with incremented y */
-    retval = pdata->gloc(pdata->n_local, t, ytemp, gtemp, cv_mem->cv_user_data);
-    pdata->nge++;
-    if (retval != 0) { return (retval); }
+        ytemp_data[j] += inc;
+      }
 
-    /* Restore ytemp, then form and load difference quotients */
-    for (j = group - 1; j < pdata->n_local; j += width)
-    {
-      yj = ytemp_data[j] = y_data[j];
-      col_j              = SUNBandMatrix_Column(pdata->savedJ, j);
-      inc = SUNMAX(pdata->dqrely * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+      /* Evaluate g with incremented y */
+      sub[s].retval = pdata->gloc(pdata->n_local, t, sub[s].ytemp,
+                                  sub[s].gtemp, cv_mem->cv_user_data);
+      sub[s].nge++;
+      if (sub[s].retval != 0) { break; }
 
-      /* Adjust sign(inc) as before. */
-      if (cv_mem->cv_constraintsSet)
+      /* Restore ytemp, then form and load difference quotients */
+      b = 0;
+      for (j = group - 1; j < pdata->n_local; j += width)
       {
-        conj = cns_data[j];
-        if (SUNRabs(conj) == ONE)
+        yj            = y_data[j];
+        ytemp_data[j] = y_data[j];
+        inc = SUNMAX(pdata->dqrely * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+        /* Adjust sign(inc) as before. */
+        if (cv_mem->cv_constraintsSet)
         {
-          if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          }
         }
-        else if (SUNRabs(conj) == TWO)
+
+        /* Find the sub-block containing column j */
+        while (j >= sub[b].offset + sub[b].n) { b++; }
+        off   = sub[b].offset;
+        col_j = SM_COLUMN_B(sub[b].savedJ, j - off);
+
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(off, j - pdata->mukeep);
+        i2      = SUNMIN(j + pdata->mlkeep, off + sub[b].n - 1);
+        for (i = i1; i <= i2; i++)
         {
-          if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          SM_COLUMN_ELEMENT_B(col_j, i - off, j - off) =
+            inc_inv * (gtemp_data[i] - gy_data[i]);
         }
       }
+    }
+  }
 
-      inc_inv = ONE / inc;
-      i1      = SUNMAX(0, j - pdata->mukeep);
-      i2      = SUNMIN(j + pdata->mlkeep, pdata->n_local - 1);
-      for (i = i1; i <= i2; i++)
-      {
-        SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv * (gtemp_data[i] - gy_data[i]);
-      }
+  for (s = 0; s < pdata->nsub; s++) { pdata->nge += sub[s].nge; }
+
+  return (cvBBDSubBlockRetval(pdata));
+}
+
+/*-----------------------------------------------------------------
+  Function : cvBBDAllocSubBlocks
+  -----------------------------------------------------------------
+  This routine splits the local block into nsub sub-blocks of
+  nearly equal size and allocates the band matrices, band linear
+  solver, and work vectors of each sub-block. The half-bandwidths
+  kept are limited by the sub-block size. On failure all memory
+  allocated here is released and CVLS_MEM_FAIL or CVLS_SUNLS_FAIL
+  is returned.
+  -----------------------------------------------------------------*/
+static int cvBBDAllocSubBlocks(CVodeMem cv_mem, CVBBDPrecData pdata, int nsub,
+                               CVBBDSubBlock* sub)
+{
+  CVBBDSubBlock sb;
+  sunindextype n, muk, mlk, storage_mu;
+  int s;
+
+  sb = NULL;
+  sb = (CVBBDSubBlock)malloc(nsub * sizeof(struct CVBBDSubBlockRec));
+  if (sb == NULL) { return (CVLS_MEM_FAIL); }
+
+  for (s = 0; s < nsub; s++)
+  {
+    sb[s].savedJ = NULL;
+    sb[s].savedP = NULL;
+    sb[s].LS     = NULL;
+    sb[s].zlocal = NULL;
+    sb[s].rlocal = NULL;
+    sb[s].ytemp  = NULL;
+    sb[s].gtemp  = NULL;
+    sb[s].nge    = 0;
+    sb[s].retval = 0;
+  }
+
+  for (s = 0; s < nsub; s++)
+  {
+    /* The first (n_local mod nsub) sub-blocks have one extra row */
+    n            = pdata->n_local / nsub;
+    sb[s].n      = n + ((s < pdata->n_local % nsub) ? 1 : 0);
+    sb[s].offset = s * n + SUNMIN(s, pdata->n_local % nsub);
+
+    muk        = SUNMIN(sb[s].n - 1, pdata->mukeep);
+    mlk        = SUNMIN(sb[s].n - 1, pdata->mlkeep);
+    storage_mu = SUNMIN(sb[s].n - 1, muk + mlk);
+
+    sb[s].savedJ = SUNBandMatrixStorage(sb[s].n, muk, mlk, muk,
+                                        cv_mem->cv_sunctx);
+    sb[s].savedP = SUNBandMatrixStorage(sb[s].n, muk, mlk, storage_mu,
+                                        cv_mem->cv_sunctx);
+    sb[s].zlocal = N_VNewEmpty_Serial(sb[s].n, cv_mem->cv_sunctx);
+    sb[s].rlocal = N_VNewEmpty_Serial(sb[s].n, cv_mem->cv_sunctx);
+    sb[s].ytemp  = N_VClone(cv_mem->cv_tempv);
+    sb[s].gtemp  = N_VClone(cv_mem->cv_tempv);
+    if (sb[s].savedJ == NULL || sb[s].savedP == NULL ||
+        sb[s].zlocal == NULL || sb[s].rlocal == NULL || sb[s].ytemp == NULL ||
+        sb[s].gtemp == NULL)
+    {
+      cvBBDFreeSubBlocks(nsub, sb);
+      return (CVLS_MEM_FAIL);
+    }
+
+    /* Allocate and initialize the band linear solver object */
+    sb[s].LS = SUNLinSol_Band(sb[s].rlocal, sb[s].savedP, cv_mem->cv_sunctx);
+    if (sb[s].LS == NULL)
+    {
+      cvBBDFreeSubBlocks(nsub, sb);
+      return (CVLS_MEM_FAIL);
+    }
+    if (SUNLinSolInitialize(sb[s].LS) != SUN_SUCCESS)
+    {
+      cvBBDFreeSubBlocks(nsub, sb);
+      return (CVLS_SUNLS_FAIL);
     }
   }
 
-  return (0);
+  *sub = sb;
+  return (CVLS_SUCCESS);
+}
+
+/*-----------------------------------------------------------------
+  Function : cvBBDFreeSubBlocks
+  -----------------------------------------------------------------
+  This routine frees the sub-block array and all objects owned by
+  its entries.
+  -----------------------------------------------------------------*/
+static void cvBBDFreeSubBlocks(int nsub, CVBBDSubBlock sub)
+{
+  int s;
+
+  if (sub == NULL) { return; }
+
+  for (s = 0; s < nsub; s++)
+  {
+    if (sub[s].LS) { SUNLinSolFree(sub[s].LS); }
+    if (sub[s].ytemp) { N_VDestroy(sub[s].ytemp); }
+    if (sub[s].gtemp) { N_VDestroy(sub[s].gtemp); }
+    if (sub[s].zlocal) { N_VDestroy(sub[s].zlocal); }
+    if (sub[s].rlocal) { N_VDestroy(sub[s].rlocal); }
+    if (sub[s].savedP) { SUNMatDestroy(sub[s].savedP); }
+    if (sub[s].savedJ) { SUNMatDestroy(sub[s].savedJ); }
+  }
+  free(sub);
+}
+
+/*-----------------------------------------------------------------
+  Function : cvBBDWorkSpace
+  -----------------------------------------------------------------
+  This routine sets the real and integer work space sizes of the
+  preconditioner.
+  -----------------------------------------------------------------*/
+static void cvBBDWorkSpace(CVBBDPrecData pdata)
+{
+  CVBBDSubBlock sub;
+  sunindextype lrw1, liw1;
+  long int lrw, liw;
+  int s;
+
+  sub            = pdata->sub;
+  pdata->rpwsize = 0;
+  pdata->ipwsize = 0;
+  if (pdata->tmp1->ops->nvspace)
+  {
+    N_VSpace(pdata->tmp1, &lrw1, &liw1);
+    pdata->rpwsize += (1 + 2 * pdata->nsub) * lrw1;
+    pdata->ipwsize += (1 + 2 * pdata->nsub) * liw1;
+  }
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    if (sub[s].rlocal->ops->nvspace)
+    {
+      N_VSpace(sub[s].rlocal, &lrw1, &liw1);
+      pdata->rpwsize += 2 * lrw1;
+      pdata->ipwsize += 2 * liw1;
+    }
+    if (sub[s].savedJ->ops->space)
+    {
+      SUNMatSpace(sub[s].savedJ, &lrw, &liw);
+      pdata->rpwsize += lrw;
+      pdata->ipwsize += liw;
+    }
+    if (sub[s].savedP->ops->space)
+    {
+      SUNMatSpace(sub[s].savedP, &lrw, &liw);
+      pdata->rpwsize += lrw;
+      pdata->ipwsize += liw;
+    }
+    if (sub[s].LS->ops->space)
+    {
+      SUNLinSolSpace(sub[s].LS, &lrw, &liw);
+      pdata->rpwsize += lrw;
+      pdata->ipwsize += liw;
+    }
+  }
+}
+
+/*-----------------------------------------------------------------
+  Function : cvBBDSubBlockRetval
+  -----------------------------------------------------------------
+  This routine combines the return values of the sub-blocks. It
+  returns the first negative (unrecoverable) value if there is one,
+  otherwise the first positive (recoverable) value, and 0 if all
+  sub-blocks succeeded.
+  -----------------------------------------------------------------*/
+static int cvBBDSubBlockRetval(CVBBDPrecData pdata)
+{
+  int retval, s;
+
+  retval = 0;
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    if (pdata->sub[s].retval < 0) { return (pdata->sub[s].retval); }
+    if (retval == 0) { retval = pdata->sub[s].retval; }
+  }
+
+  return (retval);
 }
 
 /*================================================================
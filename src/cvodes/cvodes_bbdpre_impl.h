@@ -28,6 +28,31 @@
 extern "C" {
 #endif
 
+/*-----------------------------------------------------------------
+  Type: CVBBDSubBlock
+
+  The local block may be split into several independent diagonal
+  sub-blocks, each with its own band matrices and band solver, so
+  that they can be formed, factored, and solved concurrently. The
+  ytemp and gtemp vectors are the difference quotient work vectors
+  of the thread that handles the sub-block.
+  -----------------------------------------------------------------*/
+
+typedef struct CVBBDSubBlockRec
+{
+  sunindextype offset; /* first local row of the sub-block */
+  sunindextype n;      /* number of rows in the sub-block  */
+  SUNMatrix savedJ;
+  SUNMatrix savedP;
+  SUNLinearSolver LS;
+  N_Vector zlocal;
+  N_Vector rlocal;
+  N_Vector ytemp;
+  N_Vector gtemp;
+  long int nge;
+  int retval;
+}* CVBBDSubBlock;
+
 /*-----------------------------------------------------------------
   Type: CVBBDPrecData
   -----------------------------------------------------------------*/
@@ -41,14 +66,10 @@ typedef struct CVBBDPrecDataRec
   CVCommFn cfn;
 
   /* set by CVBBDPrecSetup and used by CVBBDPrecSolve */
-  SUNMatrix savedJ;
-  SUNMatrix savedP;
-  SUNLinearSolver LS;
+  int nsub;
+  CVBBDSubBlock sub;
   N_Vector tmp1;
-  N_Vector tmp2;
-  N_Vector tmp3;
-  N_Vector zlocal;
-  N_Vector rlocal;
+  sunbooleantype jvalid;
 
   /* set by CVBBDPrecInit and used by CVBBDPrecSetup */
   sunindextype n_local;
@@ -91,6 +112,8 @@ typedef struct CVBBDPrecDataRecB
   "BBD peconditioner memory is NULL. CVBBDPrecInit must be called."
 #define MSGBBD_FUNC_FAILED \
   "The gloc or cfn routine failed in an unrecoverable manner."
+#define MSGBBD_BAD_NSUB \
+  "The number of sub-blocks must be between 1 and the local block size."
 
 #define MSGBBD_NO_ADJ    "Illegal attempt to call before calling CVodeAdjInit."
 #define MSGBBD_BAD_WHICH "Illegal value for the which parameter."
@@ -122,6 +122,9 @@ int CVDiag(void* cvode_mem)
   lsolve = CVDiagSolve;
   lfree  = CVDiagFree;
 
+  /* The diagonal solver has no multiple right-hand side solve */
+  cv_mem->cv_lsolvemultiple = NULL;
+
   /* Get memory for CVDiagMemRec */
   cvdiag_mem = NULL;
   cvdiag_mem = (CVDiagMem)malloc(sizeof(CVDiagMemRec));
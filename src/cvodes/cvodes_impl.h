@@ -319,6 +319,9 @@ typedef struct CVodeMemRec
                              zn[j] is a vector of length N (j=0,...,q)
                              zn[j] = [1/factorial(j)] * h^j *
                              (jth derivative of the interpolating polynomial) */
+  sunbooleantype cv_zn_contig; /* allocate zn data as one contiguous block   */
+  sunrealtype* cv_zn_data;     /* data of zn[0],...,zn[qmax_alloc] if
+                                  allocated as one block (NULL otherwise)    */
 
   /*-------------------
     Vectors of length N
@@ -566,6 +569,9 @@ typedef struct CVodeMemRec
   int (*cv_lsolve)(struct CVodeMemRec* cv_mem, N_Vector b, N_Vector weight,
                    N_Vector ycur, N_Vector fcur);
 
+  int (*cv_lsolvemultiple)(struct CVodeMemRec* cv_mem, int nrhs, N_Vector* b,
+                           N_Vector* weight, N_Vector ycur, N_Vector fcur);
+
   int (*cv_lfree)(struct CVodeMemRec* cv_mem);
 
   /* Linear Solver specific memory */
@@ -619,6 +625,7 @@ typedef struct CVodeMemRec
     -------------------------------------------*/
   CVMonitorFn cv_monitorfun;    /* func called with CVODE mem and user data  */
   long int cv_monitor_interval; /* step interval to call cv_monitorfun       */
+  SUNStepTrace cv_trace;        /* step trace, NULL if disabled              */
 
   /*-------------------------
     Stability Limit Detection
@@ -1100,6 +1107,21 @@ struct CVadjMemRec
  * -----------------------------------------------------------------
  */
 
+/*
+ * -----------------------------------------------------------------
+ * int (*cv_lsolvemultiple)(CVodeMem cv_mem, int nrhs, N_Vector* b,
+ *                          N_Vector* weight, N_Vector ycur,
+ *                          N_Vector fcur);
+ * -----------------------------------------------------------------
+ * cv_lsolvemultiple is optional and solves the nrhs linear systems
+ * P x_j = b_j, with weight vectors weight[j], that share the same
+ * matrix P (e.g., the staggered sensitivity systems). It allows
+ * the linear solver to reuse the factorization of P across all
+ * right-hand sides in a single call. The return values are the
+ * same as for cv_lsolve.
+ * -----------------------------------------------------------------
+ */
+
 /*
  * -----------------------------------------------------------------
  * int (*cv_lfree)(CVodeMem cv_mem);
@@ -1152,6 +1174,11 @@ int cvDoProjection(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 int cvProjInit(CVodeProjMem proj_mem);
 int cvProjFree(CVodeProjMem* proj_mem);
 
+/* Allocate and free the Nordsieck history array */
+
+sunbooleantype cvAllocHistory(CVodeMem cv_mem, N_Vector tmpl, int maxord);
+void cvFreeHistory(CVodeMem cv_mem, int maxord);
+
 /* Restore tn and undo prediction to reattempt a step */
 
 void cvRestore(CVodeMem cv_mem, sunrealtype saved_t);
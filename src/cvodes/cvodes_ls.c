@@ -25,6 +25,7 @@
 #include <string.h>
 #include <sundials/sundials_math.h>
 #include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_blocktridiag.h>
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunmatrix/sunmatrix_sparse.h>
 
@@ -48,6 +49,11 @@ static int cvLsLinSys(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix A,
                       sunrealtype gamma, void* user_data, N_Vector tmp1,
                       N_Vector tmp2, N_Vector tmp3);
 
+static int cvLsCurIter(CVodeMem cv_mem);
+
+static int cvLsSolveSystem(CVodeMem cv_mem, N_Vector b, N_Vector weight,
+                           N_Vector ynow, N_Vector fnow, int curiter);
+
 /*=================================================================
   PRIVATE FUNCTION PROTOTYPES - backward problems
   =================================================================*/
@@ -218,10 +224,11 @@ int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS, SUNMatrix A)
   if (cv_mem->cv_lfree) { cv_mem->cv_lfree(cv_mem); }
 
   /* Set four main system linear solver function fields in cv_mem */
-  cv_mem->cv_linit  = cvLsInitialize;
-  cv_mem->cv_lsetup = cvLsSetup;
-  cv_mem->cv_lsolve = cvLsSolve;
-  cv_mem->cv_lfree  = cvLsFree;
+  cv_mem->cv_linit          = cvLsInitialize;
+  cv_mem->cv_lsetup         = cvLsSetup;
+  cv_mem->cv_lsolve         = cvLsSolve;
+  cv_mem->cv_lsolvemultiple = cvLsSolveMultiple;
+  cv_mem->cv_lfree          = cvLsFree;
 
   /* Allocate memory for CVLsMemRec */
   cvls_mem = NULL;
@@ -277,6 +284,8 @@ int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS, SUNMatrix A)
   /* Set default values for the rest of the LS parameters */
   cvls_mem->msbj       = CVLS_MSBJ;
   cvls_mem->jbad       = SUNTRUE;
+  sunJacPolicy_Init(&cvls_mem->jpolicy, SUNFALSE);
+  sunDQThreads_Init(&cvls_mem->dqthreads);
   cvls_mem->dgmax_jbad = CVLS_DGMAX;
   cvls_mem->eplifac    = CVLS_EPLIN;
   cvls_mem->last_flag  = CVLS_SUCCESS;
@@ -497,6 +506,50 @@ int CVodeSetJacEvalFrequency(void* cvode_mem, long int msbj)
   return (CVLS_SUCCESS);
 }
 
+/* CVodeSetAdaptiveJacEval enables or disables choosing when to recompute the
+   Jacobian matrix and/or preconditioner from the measured solver costs */
+int CVodeSetAdaptiveJacEval(void* cvode_mem, sunbooleantype onoff)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* access CVLsMem structure; store input and return */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  if (onoff && !SUN_JACPOLICY_AVAILABLE)
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "The adaptive policy requires POSIX or Windows timers.");
+    return (CVLS_ILL_INPUT);
+  }
+
+  sunJacPolicy_Init(&cvls_mem->jpolicy, onoff);
+
+  return (CVLS_SUCCESS);
+}
+
+/* CVodeSetDQJacNumThreads sets the number of threads used to
+   evaluate the columns of the internal dense or band DQ Jacobian. With more
+   than one thread the RHS function is called concurrently with the same
+   (shared) user_data pointer and must be thread-safe. */
+int CVodeSetDQJacNumThreads(void* cvode_mem, int nthreads)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  /* values < 2 select the serial approximation */
+  sunDQThreads_SetNumThreads(&cvls_mem->dqthreads, nthreads);
+
+  return (CVLS_SUCCESS);
+}
+
 /* CVodeSetLinearSolutionScaling enables or disables scaling the
    linear solver solution to account for changes in gamma. */
 int CVodeSetLinearSolutionScaling(void* cvode_mem, sunbooleantype onoff)
@@ -1059,7 +1112,7 @@ int cvLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
               SUNDIALS_MAYBE_UNUSED N_Vector tmp3)
 {
   CVodeMem cv_mem;
-  int retval;
+  int retval, nthreads;
 
   /* access CVodeMem structure */
   if (cvode_mem == NULL)
@@ -1092,15 +1145,30 @@ int cvLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
     return (CVLS_ILL_INPUT);
   }
 
+  /* Number of threads for the dense and band approximations */
+  nthreads = ((CVLsMem)cv_mem->cv_lmem)->dqthreads.nthreads;
+
   /* Call the matrix-structure-specific DQ approximation routine */
-  if (SUNMatGetID(Jac) == SUNMATRIX_DENSE)
+  if (SUNMatGetID(Jac) == SUNMATRIX_DENSE && nthreads > 1)
+  {
+    retval = cvLsDenseDQJacThreaded(t, y, fy, Jac, cv_mem);
+  }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_DENSE)
   {
     retval = cvLsDenseDQJac(t, y, fy, Jac, cv_mem, tmp1);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BAND && nthreads > 1)
+  {
+    retval = cvLsBandDQJacThreaded(t, y, fy, Jac, cv_mem);
+  }
   else if (SUNMatGetID(Jac) == SUNMATRIX_BAND)
   {
     retval = cvLsBandDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BLOCKTRIDIAG)
+  {
+    retval = cvLsBlockTridiagDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
+  }
   else
   {
     cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -1330,6 +1398,390 @@ int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*-----------------------------------------------------------------
+  cvLsDenseDQJacThreaded
+
+  This routine generates the same dense difference quotient
+  approximation as cvLsDenseDQJac with the columns distributed over
+  the threads set by CVodeSetDQJacNumThreads. Thread s perturbs its
+  own copy of y and computes the columns s, s + nthreads, ... so the
+  RHS function is called concurrently.
+  -----------------------------------------------------------------*/
+int cvLsDenseDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                           SUNMatrix Jac, CVodeMem cv_mem)
+{
+  sunrealtype fnorm, minInc, srur;
+  sunrealtype *y_data, *fy_data, *ewt_data, *cns_data;
+  sunindextype N;
+  sunDQThread* thread;
+  CVLsMem cvls_mem;
+  int nthreads, s;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* access matrix dimension */
+  N = SUNDenseMatrix_Columns(Jac);
+
+  /* Allocate the work vectors of each thread (on first use) */
+  if (sunDQThreads_Alloc(&cvls_mem->dqthreads, y, SUNFALSE))
+  {
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+    return (CVLS_MEM_FAIL);
+  }
+  nthreads = cvls_mem->dqthreads.nthreads;
+  thread   = cvls_mem->dqthreads.thread;
+
+  /* Obtain pointers to the data for ewt, y, fy */
+  ewt_data = N_VGetArrayPointer(cv_mem->cv_ewt);
+  y_data   = N_VGetArrayPointer(y);
+  fy_data  = N_VGetArrayPointer(fy);
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Load each ytemp with y */
+  for (s = 0; s < nthreads; s++) { N_VScale(ONE, y, thread[s].ytemp); }
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Loop over the columns assigned to each thread */
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < nthreads; s++)
+  {
+    sunrealtype inc, inc_inv, conj;
+    sunrealtype *ytemp_data, *ftemp_data, *col_j;
+    sunindextype i, j;
+
+    ytemp_data       = N_VGetArrayPointer(thread[s].ytemp);
+    ftemp_data       = N_VGetArrayPointer(thread[s].ftemp);
+    thread[s].nfe    = 0;
+    thread[s].retval = 0;
+
+    for (j = s; j < N; j += nthreads)
+    {
+      inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) if y_j has an inequality constraint. */
+      if (cv_mem->cv_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((y_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((y_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[j] += inc;
+
+      thread[s].retval = cv_mem->cv_f(t, thread[s].ytemp, thread[s].ftemp,
+                                      cv_mem->cv_user_data);
+      thread[s].nfe++;
+      if (thread[s].retval != 0) { break; }
+
+      ytemp_data[j] = y_data[j];
+
+      /* Generate the jth col of J(tn,y) */
+      inc_inv = ONE / inc;
+      col_j   = SUNDenseMatrix_Column(Jac, j);
+      for (i = 0; i < N; i++)
+      {
+        col_j[i] = inc_inv * (ftemp_data[i] - fy_data[i]);
+      }
+    }
+  }
+
+  return (sunDQThreads_Finalize(&cvls_mem->dqthreads, &cvls_mem->nfeDQ));
+}
+
+/*-----------------------------------------------------------------
+  cvLsBandDQJacThreaded
+
+  This routine generates the same banded difference quotient
+  approximation as cvLsBandDQJac with the column groups distributed
+  over the threads set by CVodeSetDQJacNumThreads. Thread s perturbs
+  its own copy of y and computes the groups s + 1, s + 1 + nthreads,
+  ... so the RHS function is called concurrently.
+  -----------------------------------------------------------------*/
+int cvLsBandDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                          SUNMatrix Jac, CVodeMem cv_mem)
+{
+  sunrealtype fnorm, minInc, srur;
+  sunrealtype *ewt_data, *fy_data, *y_data, *cns_data;
+  sunindextype width, ngroups, N, mupper, mlower;
+  sunDQThread* thread;
+  CVLsMem cvls_mem;
+  int nthreads, s;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* access matrix dimensions */
+  N      = SUNBandMatrix_Columns(Jac);
+  mupper = SUNBandMatrix_UpperBandwidth(Jac);
+  mlower = SUNBandMatrix_LowerBandwidth(Jac);
+
+  /* Allocate the work vectors of each thread (on first use) */
+  if (sunDQThreads_Alloc(&cvls_mem->dqthreads, y, SUNFALSE))
+  {
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+    return (CVLS_MEM_FAIL);
+  }
+  nthreads = cvls_mem->dqthreads.nthreads;
+  thread   = cvls_mem->dqthreads.thread;
+
+  /* Obtain pointers to the data for ewt, fy, y */
+  ewt_data = N_VGetArrayPointer(cv_mem->cv_ewt);
+  fy_data  = N_VGetArrayPointer(fy);
+  y_data   = N_VGetArrayPointer(y);
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Load each ytemp with y = predicted y vector */
+  for (s = 0; s < nthreads; s++) { N_VScale(ONE, y, thread[s].ytemp); }
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Set bandwidth and number of column groups for band differencing */
+  width   = mlower + mupper + 1;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over the column groups assigned to each thread */
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < nthreads; s++)
+  {
+    sunrealtype inc, inc_inv, conj;
+    sunrealtype *ytemp_data, *ftemp_data, *col_j;
+    sunindextype group, i, j, i1, i2;
+
+    ytemp_data       = N_VGetArrayPointer(thread[s].ytemp);
+    ftemp_data       = N_VGetArrayPointer(thread[s].ftemp);
+    thread[s].nfe    = 0;
+    thread[s].retval = 0;
+
+    for (group = s + 1; group <= ngroups; group += nthreads)
+    {
+      /* Increment all y_j in group */
+      for (j = group - 1; j < N; j += width)
+      {
+        inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+        /* Adjust sign(inc) if yj has an inequality constraint. */
+        if (cv_mem->cv_constraintsSet)
+        {
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+          }
+        }
+
+        ytemp_data[j] += inc;
+      }
+
+      /* Evaluate f with incremented y */
+      thread[s].retval = cv_mem->cv_f(t, thread[s].ytemp, thread[s].ftemp,
+                                      cv_mem->cv_user_data);
+      thread[s].nfe++;
+      if (thread[s].retval != 0) { break; }
+
+      /* Restore ytemp, then form and load difference quotients */
+      for (j = group - 1; j < N; j += width)
+      {
+        ytemp_data[j] = y_data[j];
+        col_j         = SUNBandMatrix_Column(Jac, j);
+        inc           = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+        /* Adjust sign(inc) as before. */
+        if (cv_mem->cv_constraintsSet)
+        {
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+          }
+        }
+
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(0, j - mupper);
+        i2      = SUNMIN(j + mlower, N - 1);
+        for (i = i1; i <= i2; i++)
+        {
+          SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv *
+                                             (ftemp_data[i] - fy_data[i]);
+        }
+      }
+    }
+  }
+
+  return (sunDQThreads_Finalize(&cvls_mem->dqthreads, &cvls_mem->nfeDQ));
+}
+
+/*-----------------------------------------------------------------
+  cvLsBlockTridiagDQJac
+
+  This routine generates a block-tridiagonal difference quotient
+  approximation to the Jacobian of f(t,y). Columns whose blocks are
+  at least three block columns apart do not share any nonzero rows,
+  so the columns are perturbed in 3*blocksize groups as in the band
+  case. The entries of each column are loaded directly into the
+  sub-diagonal, diagonal, and super-diagonal blocks using the
+  SUNMATRIX_BLOCKTRIDIAG accessor macros.
+  -----------------------------------------------------------------*/
+int cvLsBlockTridiagDQJac(sunrealtype t, N_Vector y, N_Vector fy,
+                          SUNMatrix Jac, CVodeMem cv_mem, N_Vector tmp1,
+                          N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, conj;
+  sunrealtype *block, *ewt_data, *fy_data, *ftemp_data;
+  sunrealtype *y_data, *ytemp_data, *cns_data;
+  sunindextype group, i, j, width, ngroups, I, I1, I2;
+  sunindextype N, bs, nb;
+  CVLsMem cvls_mem;
+  int retval = 0;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* access matrix dimensions */
+  N  = SM_COLUMNS_BT(Jac);
+  bs = SM_BLOCKSIZE_BT(Jac);
+  nb = SM_NBLOCKS_BT(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(cv_mem->cv_ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Set width and number of column groups for block differencing */
+  width   = 3 * bs;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over column groups. */
+  for (group = 1; group <= ngroups; group++)
+  {
+    /* Increment all y_j in group */
+    for (j = group - 1; j < N; j += width)
+    {
+      inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (cv_mem->cv_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[j] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = cv_mem->cv_f(t, ytemp, ftemp, cv_mem->cv_user_data);
+    cvls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (j = group - 1; j < N; j += width)
+    {
+      ytemp_data[j] = y_data[j];
+      inc           = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) as before. */
+      if (cv_mem->cv_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      inc_inv = ONE / inc;
+      I1      = SUNMAX(0, j / bs - 1);
+      I2      = SUNMIN(j / bs + 1, nb - 1);
+      for (I = I1; I <= I2; I++)
+      {
+        block = SM_BLOCK_BT(Jac, I, j / bs);
+        for (i = 0; i < bs; i++)
+        {
+          SM_BLOCK_ELEMENT_BT(block, i, j % bs, bs) =
+            inc_inv * (ftemp_data[I * bs + i] - fy_data[I * bs + i]);
+        }
+      }
+    }
+  }
+
+  return (retval);
+}
+
 /*-----------------------------------------------------------------
   cvLsDQJtimes
 
@@ -1508,13 +1960,14 @@ int cvLsInitialize(CVodeMem cv_mem)
       /* Check if an internal or user-supplied Jacobian function is used */
       if (cvls_mem->jacDQ)
       {
-        /* Internal difference quotient Jacobian. Check that A is dense or band,
-           otherwise return an error */
+        /* Internal difference quotient Jacobian. Check that A is dense, band,
+           or block-tridiagonal, otherwise return an error */
         retval = 0;
         if (cvls_mem->A->ops->getid)
         {
           if ((SUNMatGetID(cvls_mem->A) == SUNMATRIX_DENSE) ||
-              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BAND))
+              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BAND) ||
+              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BLOCKTRIDIAG))
           {
             cvls_mem->jac    = cvLsDQJac;
             cvls_mem->J_data = cv_mem;
@@ -1565,6 +2018,7 @@ int cvLsInitialize(CVodeMem cv_mem)
 
   /* reset counters */
   cvLsInitializeCounters(cvls_mem);
+  sunJacPolicy_Init(&cvls_mem->jpolicy, cvls_mem->jpolicy.enabled);
 
   /* Set Jacobian-vector product related fields, based on jtimesDQ */
   if (cvls_mem->jtimesDQ)
@@ -1614,6 +2068,7 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
 {
   CVLsMem cvls_mem;
   sunrealtype dgamma;
+  sunbooleantype jstale;
   int retval;
 
   /* access CVLsMem structure */
@@ -1636,10 +2091,18 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
   cvls_mem->ycur = ypred;
   cvls_mem->fcur = fpred;
 
-  /* Use nst, gamma/gammap, and convfail to set J/P eval. flag jok */
+  /* Use the Jacobian age (or the adaptive policy), gamma/gammap, and convfail
+     to set J/P eval. flag jok */
+  if (cvls_mem->jpolicy.enabled)
+  {
+    jstale = sunJacPolicy_Update(&cvls_mem->jpolicy, cv_mem->cv_nst);
+    sunJacPolicy_BeginSetup(&cvls_mem->jpolicy);
+  }
+  else { jstale = (cv_mem->cv_nst >= cvls_mem->nstlj + cvls_mem->msbj); }
+
   dgamma         = SUNRabs((cv_mem->cv_gamma / cv_mem->cv_gammap) - ONE);
   cvls_mem->jbad = (cv_mem->cv_nst == 0) || (cv_mem->first_step_after_resize) ||
-                   (cv_mem->cv_nst >= cvls_mem->nstlj + cvls_mem->msbj) ||
+                   jstale ||
                    ((convfail == CV_FAIL_BAD_J) &&
                     (dgamma < cvls_mem->dgmax_jbad)) ||
                    (convfail == CV_FAIL_OTHER);
@@ -1706,6 +2169,12 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
     if (cvls_mem->jbad) { *jcurPtr = SUNTRUE; }
   }
 
+  /* Update the measured setup costs */
+  if (cvls_mem->jpolicy.enabled)
+  {
+    sunJacPolicy_EndSetup(&cvls_mem->jpolicy, *jcurPtr);
+  }
+
   return (cvls_mem->last_flag);
 }
 
@@ -1721,14 +2190,7 @@ int cvLsSolve(CVodeMem cv_mem, N_Vector b, N_Vector weight, N_Vector ynow,
               N_Vector fnow)
 {
   CVLsMem cvls_mem;
-  sunrealtype bnorm = ZERO;
-  sunrealtype deltar, delta, w_mean;
-  int curiter, nli_inc, retval;
-  sunbooleantype do_sensi_sim, do_sensi_stg, do_sensi_stg1;
-
-  /* only used with logging */
-  SUNDIALS_MAYBE_UNUSED long int nps_inc;
-  SUNDIALS_MAYBE_UNUSED sunrealtype resnorm;
+  int curiter;
 
   /* access CVLsMem structure */
   if (cv_mem->cv_lmem == NULL)
@@ -1739,25 +2201,66 @@ int cvLsSolve(CVodeMem cv_mem, N_Vector b, N_Vector weight, N_Vector ynow,
   }
   cvls_mem = (CVLsMem)cv_mem->cv_lmem;
 
+  /* get current nonlinear solver iteration */
+  curiter = cvLsCurIter(cv_mem);
+
+  /* Update the measured Newton iteration cost */
+  if (cvls_mem->jpolicy.enabled)
+  {
+    sunJacPolicy_Solve(&cvls_mem->jpolicy, curiter);
+  }
+
+  return (cvLsSolveSystem(cv_mem, b, weight, ynow, fnow, curiter));
+}
+
+/*-----------------------------------------------------------------
+  cvLsCurIter
+
+  This routine returns the current iteration of the nonlinear
+  solver that calls the linear solver.
+  -----------------------------------------------------------------*/
+static int cvLsCurIter(CVodeMem cv_mem)
+{
+  int curiter = 0;
+  sunbooleantype do_sensi_sim, do_sensi_stg, do_sensi_stg1;
+
   /* are we computing sensitivities and with which approach? */
   do_sensi_sim  = (cv_mem->cv_sensi && (cv_mem->cv_ism == CV_SIMULTANEOUS));
   do_sensi_stg  = (cv_mem->cv_sensi && (cv_mem->cv_ism == CV_STAGGERED));
   do_sensi_stg1 = (cv_mem->cv_sensi && (cv_mem->cv_ism == CV_STAGGERED1));
 
-  /* get current nonlinear solver iteration */
-  if (do_sensi_sim)
-  {
-    retval = SUNNonlinSolGetCurIter(cv_mem->NLSsim, &curiter);
-  }
+  if (do_sensi_sim) { SUNNonlinSolGetCurIter(cv_mem->NLSsim, &curiter); }
   else if (do_sensi_stg && cv_mem->sens_solve)
   {
-    retval = SUNNonlinSolGetCurIter(cv_mem->NLSstg, &curiter);
+    SUNNonlinSolGetCurIter(cv_mem->NLSstg, &curiter);
   }
   else if (do_sensi_stg1 && cv_mem->sens_solve)
   {
-    retval = SUNNonlinSolGetCurIter(cv_mem->NLSstg1, &curiter);
+    SUNNonlinSolGetCurIter(cv_mem->NLSstg1, &curiter);
   }
-  else { retval = SUNNonlinSolGetCurIter(cv_mem->NLS, &curiter); }
+  else { SUNNonlinSolGetCurIter(cv_mem->NLS, &curiter); }
+
+  return (curiter);
+}
+
+/*-----------------------------------------------------------------
+  cvLsSolveSystem
+
+  This routine solves a single linear system for cvLsSolve and
+  cvLsSolveMultiple at the nonlinear iteration curiter. The
+  Jacobian policy is updated by the caller.
+  -----------------------------------------------------------------*/
+static int cvLsSolveSystem(CVodeMem cv_mem, N_Vector b, N_Vector weight,
+                           N_Vector ynow, N_Vector fnow, int curiter)
+{
+  CVLsMem cvls_mem  = (CVLsMem)cv_mem->cv_lmem;
+  sunrealtype bnorm = ZERO;
+  sunrealtype deltar, delta, w_mean;
+  int nli_inc, retval;
+
+  /* only used with logging */
+  SUNDIALS_MAYBE_UNUSED long int nps_inc;
+  SUNDIALS_MAYBE_UNUSED sunrealtype resnorm;
 
   /* If the linear solver is iterative:
      test norm(b), if small, return x = 0 or x = b;
@@ -1942,6 +2445,100 @@ int cvLsSolve(CVodeMem cv_mem, N_Vector b, N_Vector weight, N_Vector ynow,
   return (0);
 }
 
+/*-----------------------------------------------------------------
+  cvLsSolveMultiple
+
+  This routine solves several linear systems that share the
+  current matrix, e.g., the staggered sensitivity systems. With a
+  direct linear solver that provides SUNLinSolSolveMultiple all
+  right-hand sides are passed to the solver at once (in place);
+  otherwise, each system is solved in turn since iterative solvers
+  use a tolerance and scaling specific to each right-hand side.
+  The Jacobian policy is updated once per call.
+  -----------------------------------------------------------------*/
+int cvLsSolveMultiple(CVodeMem cv_mem, int nrhs, N_Vector* b, N_Vector* weight,
+                      N_Vector ynow, N_Vector fnow)
+{
+  CVLsMem cvls_mem;
+  int curiter, j, retval;
+
+  /* access CVLsMem structure */
+  if (cv_mem->cv_lmem == NULL)
+  {
+    cvProcessError(cv_mem, CVLS_LMEM_NULL, __LINE__, __func__, __FILE__,
+                   MSG_LS_LMEM_NULL);
+    return (CVLS_LMEM_NULL);
+  }
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* get current nonlinear solver iteration */
+  curiter = cvLsCurIter(cv_mem);
+
+  /* Update the measured Newton iteration cost once for all right-hand
+     sides. With the simultaneous corrector the state system was already
+     solved (and counted) by cvLsSolve in the same iteration. */
+  if (cvls_mem->jpolicy.enabled && cv_mem->cv_ism != CV_SIMULTANEOUS)
+  {
+    sunJacPolicy_Solve(&cvls_mem->jpolicy, curiter);
+  }
+
+  /* solve the systems one at a time if necessary */
+  if (cvls_mem->iterative || (cvls_mem->LS->ops->solvemultiple == NULL))
+  {
+    for (j = 0; j < nrhs; j++)
+    {
+      retval = cvLsSolveSystem(cv_mem, b[j], weight[j], ynow, fnow, curiter);
+      if (retval != 0) { return (retval); }
+    }
+    return (0);
+  }
+
+  SUNLogInfo(CV_LOGGER, "begin-linear-solve", "iterative = 0, nrhs = %i", nrhs);
+
+  /* Set vectors ycur and fcur for consistency with cvLsSolve */
+  cvls_mem->ycur = ynow;
+  cvls_mem->fcur = fnow;
+
+  /* Call solver, overwriting each b with its solution */
+  retval = SUNLinSolSolveMultiple(cvls_mem->LS, cvls_mem->A, nrhs, b, b, ZERO);
+
+  /* If using a BDF method and gamma has changed, scale the corrections to
+     account for change in gamma */
+  if (cvls_mem->scalesol && cv_mem->cv_gamrat != ONE)
+  {
+    for (j = 0; j < nrhs; j++)
+    {
+      N_VScale(TWO / (ONE + cv_mem->cv_gamrat), b[j], b[j]);
+    }
+  }
+
+  /* Increment ncfl counter */
+  if (retval != SUN_SUCCESS) { cvls_mem->ncfl++; }
+
+  /* Interpret solver return value  */
+  cvls_mem->last_flag = retval;
+
+  SUNLogInfoIf(retval == SUN_SUCCESS, CV_LOGGER, "end-linear-solve",
+               "status = success");
+  SUNLogInfoIf(retval != SUN_SUCCESS, CV_LOGGER, "end-linear-solve",
+               "status = failed, retval = %i", retval);
+
+  switch (retval)
+  {
+  case SUN_SUCCESS: return (0); break;
+  case SUNLS_PACKAGE_FAIL_REC:
+  case SUNLS_QRFACT_FAIL:
+  case SUNLS_LUFACT_FAIL: return (1); break;
+  case SUN_ERR_EXT_FAIL:
+    cvProcessError(cv_mem, SUN_ERR_EXT_FAIL, __LINE__, __func__, __FILE__,
+                   "Failure in SUNLinSol external package");
+    return (-1);
+    break;
+  }
+
+  return ((retval > 0) ? 1 : -1);
+}
+
 /*-----------------------------------------------------------------
   cvLsFree
 
@@ -1969,6 +2566,9 @@ int cvLsFree(CVodeMem cv_mem)
     cvls_mem->x = NULL;
   }
 
+  /* Free threaded DQ Jacobian work vectors */
+  sunDQThreads_Free(&cvls_mem->dqthreads);
+
   /* Free savedJ memory */
   if (cvls_mem->savedJ)
   {
@@ -21,6 +21,8 @@
 #include <cvodes/cvodes_ls.h>
 
 #include "cvodes_impl.h"
+#include "sundials_dqjac_impl.h"
+#include "sundials_jacpolicy_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -94,6 +96,12 @@ typedef struct CVLsMemRec
   long int njtimes;  /* njtimes = total number of calls to jtimes    */
   sunrealtype tnlj;  /* tnlj = t_n at last jac/pset call             */
 
+  /* Adaptive Jacobian evaluation policy (replaces msbj when enabled) */
+  sunJacPolicy jpolicy;
+
+  /* Threaded difference quotient Jacobian (dense and band) */
+  sunDQThreads dqthreads;
+
   /* Preconditioner computation
    * (a) user-provided:
    *     - P_data == user_data
@@ -154,6 +162,13 @@ int cvLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                    CVodeMem cv_mem, N_Vector tmp1);
 int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                   CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
+int cvLsDenseDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                           SUNMatrix Jac, CVodeMem cv_mem);
+int cvLsBandDQJacThreaded(sunrealtype t, N_Vector y, N_Vector fy,
+                          SUNMatrix Jac, CVodeMem cv_mem);
+int cvLsBlockTridiagDQJac(sunrealtype t, N_Vector y, N_Vector fy,
+                          SUNMatrix Jac, CVodeMem cv_mem, N_Vector tmp1,
+                          N_Vector tmp2);
 
 /* Generic linit/lsetup/lsolve/lfree interface routines for CVode to call */
 int cvLsInitialize(CVodeMem cv_mem);
@@ -162,6 +177,8 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
               N_Vector vtemp3);
 int cvLsSolve(CVodeMem cv_mem, N_Vector b, N_Vector weight, N_Vector ycur,
               N_Vector fcur);
+int cvLsSolveMultiple(CVodeMem cv_mem, int nrhs, N_Vector* b, N_Vector* weight,
+                      N_Vector ycur, N_Vector fcur);
 int cvLsFree(CVodeMem cv_mem);
 
 /* Auxiliary functions */
@@ -358,7 +358,19 @@ static int cvNlsLSolveSensSim(N_Vector deltaSim, void* cvode_mem)
   /* extract sensitivity deltas from the vector wrapper */
   deltaS = NV_VECS_SW(deltaSim) + 1;
 
-  /* solve the sensitivity linear systems */
+  /* solve the sensitivity linear systems, all at once if possible */
+  if (cv_mem->cv_lsolvemultiple)
+  {
+    retval = cv_mem->cv_lsolvemultiple(cv_mem, cv_mem->cv_Ns, deltaS,
+                                       cv_mem->cv_ewtS, cv_mem->cv_y,
+                                       cv_mem->cv_ftemp);
+
+    if (retval < 0) { return (CV_LSOLVE_FAIL); }
+    if (retval > 0) { return (SUN_NLS_CONV_RECVR); }
+
+    return (CV_SUCCESS);
+  }
+
   for (is = 0; is < cv_mem->cv_Ns; is++)
   {
     retval = cv_mem->cv_lsolve(cv_mem, deltaS[is], cv_mem->cv_ewtS[is],
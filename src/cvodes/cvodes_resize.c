@@ -349,16 +349,12 @@ int CVodeResizeHistory(void* cvode_mem, sunrealtype* t_hist, N_Vector* y_hist,
     cv_mem->cv_constraintsSet        = SUNFALSE;
   }
 
-  for (int j = 0; j <= cv_mem->cv_qmax_alloc; j++)
+  cvFreeHistory(cv_mem, cv_mem->cv_qmax_alloc);
+  if (!cvAllocHistory(cv_mem, y_hist[0], cv_mem->cv_qmax_alloc))
   {
-    N_VDestroy(cv_mem->cv_zn[j]);
-    cv_mem->cv_zn[j] = N_VClone(y_hist[0]);
-    if (!(cv_mem->cv_zn[j]))
-    {
-      cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
-                     "A vector allocation failed");
-      return CV_MEM_FAIL;
-    }
+    cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   "A vector allocation failed");
+    return CV_MEM_FAIL;
   }
 
   /* ----------------------- *
@@ -102,6 +102,7 @@ module fcvodes_mod
  public :: FCVodeSVtolerances
  public :: FCVodeWFtolerances
  public :: FCVodeSetConstraints
+ public :: FCVodeSetContiguousHistory
  public :: FCVodeSetDeltaGammaMaxLSetup
  public :: FCVodeSetInitStep
  public :: FCVodeSetLSetupFrequency
@@ -119,6 +120,7 @@ module fcvodes_mod
  public :: FCVodeSetNonlinConvCoef
  public :: FCVodeSetNonlinearSolver
  public :: FCVodeSetStabLimDet
+ public :: FCVodeSetStepTrace
  public :: FCVodeSetStopTime
  public :: FCVodeSetInterpolateStopTime
  public :: FCVodeClearStopTime
@@ -313,6 +315,7 @@ module fcvodes_mod
  public :: FCVBandPrecInitB
  public :: FCVBBDPrecInit
  public :: FCVBBDPrecReInit
+ public :: FCVBBDPrecSetNumSubBlocks
  public :: FCVBBDPrecGetWorkSpace
  public :: FCVBBDPrecGetNumGfnEvals
  public :: FCVBBDPrecInitB
@@ -347,6 +350,8 @@ module fcvodes_mod
  public :: FCVodeSetLinearSolver
  public :: FCVodeSetJacFn
  public :: FCVodeSetJacEvalFrequency
+ public :: FCVodeSetAdaptiveJacEval
+ public :: FCVodeSetDQJacNumThreads
  public :: FCVodeSetLinearSolutionScaling
  public :: FCVodeSetDeltaGammaMaxBadJac
  public :: FCVodeSetEpsLin
@@ -465,6 +470,15 @@ type(C_PTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetContiguousHistory(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetContiguousHistory") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetDeltaGammaMaxLSetup(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetDeltaGammaMaxLSetup") &
 result(fresult)
@@ -618,6 +632,15 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetStepTrace(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetStepTrace") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetStopTime(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetStopTime") &
 result(fresult)
@@ -2302,6 +2325,15 @@ real(C_DOUBLE), intent(in) :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVBBDPrecSetNumSubBlocks(farg1, farg2) &
+bind(C, name="_wrap_FCVBBDPrecSetNumSubBlocks") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVBBDPrecGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FCVBBDPrecGetWorkSpace") &
 result(fresult)
@@ -2432,6 +2464,24 @@ integer(C_LONG), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetAdaptiveJacEval(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetAdaptiveJacEval") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FCVodeSetDQJacNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetDQJacNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetLinearSolutionScaling(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetLinearSolutionScaling") &
 result(fresult)
@@ -2925,6 +2975,22 @@ fresult = swigc_FCVodeSetConstraints(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetContiguousHistory(cvode_mem, contiguous) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: contiguous
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = contiguous
+fresult = swigc_FCVodeSetContiguousHistory(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetDeltaGammaMaxLSetup(cvode_mem, dgmax_lsetup) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3197,6 +3263,22 @@ fresult = swigc_FCVodeSetStabLimDet(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetStepTrace(cvode_mem, trace) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(C_PTR) :: trace
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = cvode_mem
+farg2 = trace
+fresult = swigc_FCVodeSetStepTrace(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetStopTime(cvode_mem, tstop) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6312,6 +6394,22 @@ fresult = swigc_FCVBBDPrecReInit(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FCVBBDPrecSetNumSubBlocks(cvode_mem, nsub) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: nsub
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = nsub
+fresult = swigc_FCVBBDPrecSetNumSubBlocks(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVBBDPrecGetWorkSpace(cvode_mem, lenrwbbdp, leniwbbdp) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6557,6 +6655,38 @@ fresult = swigc_FCVodeSetJacEvalFrequency(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetAdaptiveJacEval(cvode_mem, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = onoff
+fresult = swigc_FCVodeSetAdaptiveJacEval(farg1, farg2)
+swig_result = fresult
+end function
+
+function FCVodeSetDQJacNumThreads(cvode_mem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = nthreads
+fresult = swigc_FCVodeSetDQJacNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetLinearSolutionScaling(cvode_mem, onoff) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
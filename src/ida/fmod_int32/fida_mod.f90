@@ -76,12 +76,14 @@ module fida_mod
  public :: FIDASetStepToleranceIC
  public :: FIDASetMaxBacksIC
  public :: FIDASetDeltaCjLSetup
+ public :: FIDASetAdaptiveJacEval
  public :: FIDASetUserData
  public :: FIDASetMaxOrd
  public :: FIDASetMaxNumSteps
  public :: FIDASetInitStep
  public :: FIDASetMaxStep
  public :: FIDASetMinStep
+ public :: FIDASetStepTrace
  public :: FIDASetStopTime
  public :: FIDAClearStopTime
  public :: FIDASetMaxErrTestFails
@@ -144,6 +146,7 @@ module fida_mod
  public :: FIDASetJacTimesResFn
  public :: FIDABBDPrecInit
  public :: FIDABBDPrecReInit
+ public :: FIDABBDPrecSetNumSubBlocks
  public :: FIDABBDPrecGetWorkSpace
  public :: FIDABBDPrecGetNumGfnEvals
  integer(C_INT), parameter, public :: IDALS_SUCCESS = 0_C_INT
@@ -164,6 +167,7 @@ module fida_mod
  public :: FIDASetLSNormFactor
  public :: FIDASetLinearSolutionScaling
  public :: FIDASetIncrementFactor
+ public :: FIDASetDQJacNumThreads
  public :: FIDAGetJac
  public :: FIDAGetJacCj
  public :: FIDAGetJacTime
@@ -324,6 +328,15 @@ real(C_DOUBLE), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetAdaptiveJacEval(farg1, farg2) &
+bind(C, name="_wrap_FIDASetAdaptiveJacEval") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetUserData(farg1, farg2) &
 bind(C, name="_wrap_FIDASetUserData") &
 result(fresult)
@@ -378,6 +391,15 @@ real(C_DOUBLE), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetStepTrace(farg1, farg2) &
+bind(C, name="_wrap_FIDASetStepTrace") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetStopTime(farg1, farg2) &
 bind(C, name="_wrap_FIDASetStopTime") &
 result(fresult)
@@ -939,6 +961,15 @@ real(C_DOUBLE), intent(in) :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDABBDPrecSetNumSubBlocks(farg1, farg2) &
+bind(C, name="_wrap_FIDABBDPrecSetNumSubBlocks") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDABBDPrecGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FIDABBDPrecGetWorkSpace") &
 result(fresult)
@@ -1033,6 +1064,15 @@ real(C_DOUBLE), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetDQJacNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FIDASetDQJacNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDAGetJac(farg1, farg2) &
 bind(C, name="_wrap_FIDAGetJac") &
 result(fresult)
@@ -1435,6 +1475,22 @@ fresult = swigc_FIDASetDeltaCjLSetup(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDASetAdaptiveJacEval(ida_mem, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = ida_mem
+farg2 = onoff
+fresult = swigc_FIDASetAdaptiveJacEval(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDASetUserData(ida_mem, user_data) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -1531,6 +1587,22 @@ fresult = swigc_FIDASetMinStep(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDASetStepTrace(ida_mem, trace) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(C_PTR) :: trace
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = ida_mem
+farg2 = trace
+fresult = swigc_FIDASetStepTrace(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDASetStopTime(ida_mem, tstop) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2575,6 +2647,22 @@ fresult = swigc_FIDABBDPrecReInit(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FIDABBDPrecSetNumSubBlocks(ida_mem, nsub) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_INT), intent(in) :: nsub
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = ida_mem
+farg2 = nsub
+fresult = swigc_FIDABBDPrecSetNumSubBlocks(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDABBDPrecGetWorkSpace(ida_mem, lenrwbbdp, leniwbbdp) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2747,6 +2835,22 @@ fresult = swigc_FIDASetIncrementFactor(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDASetDQJacNumThreads(ida_mem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = ida_mem
+farg2 = nthreads
+fresult = swigc_FIDASetDQJacNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDAGetJac(ida_mem, j) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -47,6 +47,10 @@
  *   Main IDAStep function
  *       IDAStep
  *       IDASetCoeffs
+ *   Step trace functions
+ *       IDATraceCounters
+ *       IDATraceBeginStep
+ *       IDATraceEndStep
  *   Nonlinear solver functions
  *       IDANls
  *       IDAPredict
@@ -89,6 +93,7 @@
 #include <sunnonlinsol/sunnonlinsol_newton.h>
 
 #include "ida_impl.h"
+#include "ida_ls_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 
 /*
@@ -202,6 +207,13 @@ static int IDAEwtSetSV(IDAMem IDA_mem, N_Vector ycur, N_Vector weight);
 
 static int IDAStep(IDAMem IDA_mem);
 
+/* Step trace functions */
+
+static void IDATraceCounters(IDAMem IDA_mem, long int* nli, long int* nje);
+static void IDATraceBeginStep(IDAMem IDA_mem);
+static void IDATraceEndStep(IDAMem IDA_mem, SUNStepTraceStatus status,
+                            sunrealtype dsm);
+
 /* Function called at beginning of step */
 
 static void IDASetCoeffs(IDAMem IDA_mem, sunrealtype* ck);
@@ -283,7 +295,7 @@ void* IDACreate(SUNContext sunctx)
   }
 
   IDA_mem = NULL;
-  IDA_mem = (IDAMem)malloc(sizeof(struct IDAMemRec));
+  IDA_mem = (IDAMem)SUNContext_ArenaAlloc(sunctx, sizeof(struct IDAMemRec));
   if (IDA_mem == NULL)
   {
     IDAProcessError(NULL, 0, __LINE__, __func__, __FILE__, MSG_MEM_FAIL);
@@ -306,6 +318,7 @@ void* IDACreate(SUNContext sunctx)
   IDA_mem->ida_user_efun      = SUNFALSE;
   IDA_mem->ida_efun           = NULL;
   IDA_mem->ida_edata          = NULL;
+  IDA_mem->ida_trace          = NULL;
   IDA_mem->ida_maxord         = MAXORD_DEFAULT;
   IDA_mem->ida_mxstep         = MXSTEP_DEFAULT;
   IDA_mem->ida_hmax_inv       = HMAX_INV_DEFAULT;
@@ -327,6 +340,7 @@ void* IDACreate(SUNContext sunctx)
   IDA_mem->ida_constraintsSet = SUNFALSE;
   IDA_mem->ida_tstopset       = SUNFALSE;
   IDA_mem->ida_dcj            = DCJ_DEFAULT;
+  sunJacPolicy_Init(&IDA_mem->ida_jpolicy, SUNFALSE);
 
   /* set the saved value maxord_alloc */
   IDA_mem->ida_maxord_alloc = MAXORD_DEFAULT;
@@ -509,6 +523,8 @@ int IDAInit(void* ida_mem, IDAResFn res, sunrealtype t0, N_Vector yy0,
   IDA_mem->ida_nnf     = 0;
   IDA_mem->ida_nsetups = 0;
 
+  sunJacPolicy_Init(&IDA_mem->ida_jpolicy, IDA_mem->ida_jpolicy.enabled);
+
   IDA_mem->ida_kused = 0;
   IDA_mem->ida_hused = ZERO;
   IDA_mem->ida_tolsf = ONE;
@@ -622,6 +638,8 @@ int IDAReInit(void* ida_mem, sunrealtype t0, N_Vector yy0, N_Vector yp0)
   IDA_mem->ida_nnf     = 0;
   IDA_mem->ida_nsetups = 0;
 
+  sunJacPolicy_Init(&IDA_mem->ida_jpolicy, IDA_mem->ida_jpolicy.enabled);
+
   IDA_mem->ida_kused = 0;
   IDA_mem->ida_hused = ZERO;
   IDA_mem->ida_tolsf = ONE;
@@ -1718,7 +1736,7 @@ void IDAFree(void** ida_mem)
     IDA_mem->ida_gactive = NULL;
   }
 
-  free(*ida_mem);
+  SUNContext_ArenaFree(IDA_mem->ida_sunctx, IDA_mem);
   *ida_mem = NULL;
 }
 
@@ -2508,6 +2526,8 @@ static int IDAStep(IDAMem IDA_mem)
                IDA_mem->ida_nst + 1, IDA_mem->ida_tn, IDA_mem->ida_hh,
                IDA_mem->ida_kk);
 
+    IDATraceBeginStep(IDA_mem);
+
     /*-----------------------
       Set method coefficients
       -----------------------*/
@@ -2562,6 +2582,13 @@ static int IDAStep(IDAMem IDA_mem)
                    "end-step-attempt", "status = failed solve, kflag = %i",
                    kflag);
 
+      if (nflag == ERROR_TEST_FAIL)
+      {
+        IDATraceEndStep(IDA_mem, SUN_STEPTRACE_ERRTEST_FAIL,
+                        ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
+      }
+      else { IDATraceEndStep(IDA_mem, SUN_STEPTRACE_SOLVE_FAIL, ZERO); }
+
       /* exit on nonrecoverable failure */
       if (kflag != PREDICT_AGAIN) { return (kflag); }
 
@@ -2578,6 +2605,8 @@ static int IDAStep(IDAMem IDA_mem)
   SUNLogInfo(IDA_LOGGER, "end-step-attempt",
              "status = success, dsm = " SUN_FORMAT_G,
              ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
+  IDATraceEndStep(IDA_mem, SUN_STEPTRACE_SUCCESS,
+                  ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
 
   /* Nonlinear system solve and error test were both successful;
      update data, and consider change of step and/or order */
@@ -2600,6 +2629,73 @@ static int IDAStep(IDAMem IDA_mem)
   return (IDA_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Step trace functions
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * IDATraceCounters
+ *
+ * This routine returns the linear iteration and Jacobian evaluation
+ * counters of the IDALS interface, or zero if no linear solver
+ * interface is attached.
+ */
+
+static void IDATraceCounters(IDAMem IDA_mem, long int* nli, long int* nje)
+{
+  IDALsMem idals_mem;
+
+  *nli = 0;
+  *nje = 0;
+
+  if (IDA_mem->ida_lmem && IDA_mem->ida_linit == idaLsInitialize)
+  {
+    idals_mem = (IDALsMem)(IDA_mem->ida_lmem);
+    *nli      = idals_mem->nli;
+    *nje      = idals_mem->nje;
+  }
+}
+
+/*
+ * IDATraceBeginStep
+ *
+ * This routine stores the state at the start of a step attempt in
+ * the step trace, if one is attached.
+ */
+
+static void IDATraceBeginStep(IDAMem IDA_mem)
+{
+  long int nli, nje;
+
+  if (!IDA_mem->ida_trace) { return; }
+
+  IDATraceCounters(IDA_mem, &nli, &nje);
+  SUNStepTrace_BeginStep(IDA_mem->ida_trace, IDA_mem->ida_tn, IDA_mem->ida_hh,
+                         IDA_mem->ida_kk, IDA_mem->ida_nni, nli, nje,
+                         IDA_mem->ida_nsetups);
+}
+
+/*
+ * IDATraceEndStep
+ *
+ * This routine records the outcome of the current step attempt in
+ * the step trace, if one is attached.
+ */
+
+static void IDATraceEndStep(IDAMem IDA_mem, SUNStepTraceStatus status,
+                            sunrealtype dsm)
+{
+  long int nli, nje;
+
+  if (!IDA_mem->ida_trace) { return; }
+
+  IDATraceCounters(IDA_mem, &nli, &nje);
+  SUNStepTrace_EndStep(IDA_mem->ida_trace, status, dsm, IDA_mem->ida_nni, nli,
+                       nje, IDA_mem->ida_nsetups);
+}
+
 /*
  * IDASetCoeffs
  *
@@ -2734,6 +2830,11 @@ static int IDANls(IDAMem IDA_mem)
       callLSetup = SUNTRUE;
     }
     if (IDA_mem->ida_cj != IDA_mem->ida_cjlast) { IDA_mem->ida_ss = HUNDRED; }
+    if (IDA_mem->ida_jpolicy.enabled &&
+        sunJacPolicy_Update(&IDA_mem->ida_jpolicy, IDA_mem->ida_nst))
+    {
+      callLSetup = SUNTRUE;
+    }
   }
 
   /* initial guess for the correction to the predictor */
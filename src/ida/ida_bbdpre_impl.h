@@ -29,6 +29,33 @@
 extern "C" {
 #endif
 
+/*
+ * -----------------------------------------------------------------
+ * Definition of IBBDSubBlock
+ *
+ * The local block may be split into several independent diagonal
+ * sub-blocks, each with its own band matrix and band solver, so
+ * that they can be formed, factored, and solved concurrently. The
+ * ytemp, yptemp, and gtemp vectors are the difference quotient
+ * work vectors of the thread that handles the sub-block.
+ * -----------------------------------------------------------------
+ */
+
+typedef struct IBBDSubBlockRec
+{
+  sunindextype offset; /* first local row of the sub-block */
+  sunindextype n;      /* number of rows in the sub-block  */
+  SUNMatrix PP;
+  SUNLinearSolver LS;
+  N_Vector zlocal;
+  N_Vector rlocal;
+  N_Vector ytemp;
+  N_Vector yptemp;
+  N_Vector gtemp;
+  long int nge;
+  int retval;
+}* IBBDSubBlock;
+
 /*
  * -----------------------------------------------------------------
  * Definition of IBBDPrecData
@@ -47,14 +74,9 @@ typedef struct IBBDPrecDataRec
   /* set by IDABBDPrecSetup and used by IDABBDPrecSetup and
      IDABBDPrecSolve functions */
   sunindextype n_local;
-  SUNMatrix PP;
-  SUNLinearSolver LS;
-  N_Vector zlocal;
-  N_Vector rlocal;
+  int nsub;
+  IBBDSubBlock sub;
   N_Vector tempv1;
-  N_Vector tempv2;
-  N_Vector tempv3;
-  N_Vector tempv4;
 
   /* available for optional output */
   long int rpwsize;
@@ -84,6 +106,8 @@ typedef struct IBBDPrecDataRec
   "BBD peconditioner memory is NULL. IDABBDPrecInit must be called."
 #define MSGBBD_FUNC_FAILED \
   "The Glocal or Gcomm routine failed in an unrecoverable manner."
+#define MSGBBD_BAD_NSUB \
+  "The number of sub-blocks must be between 1 and the local block size."
 
 #ifdef __cplusplus
 }
@@ -24,6 +24,7 @@
 #include <ida/ida.h>
 #include <sundials/priv/sundials_context_impl.h>
 
+#include "sundials_jacpolicy_impl.h"
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
 
@@ -105,6 +106,7 @@ typedef struct IDAMemRec
   sunbooleantype ida_user_efun; /* SUNTRUE if user provides efun         */
   IDAEwtFn ida_efun;            /* function to set ewt                   */
   void* ida_edata;              /* user pointer passed to efun           */
+  SUNStepTrace ida_trace;       /* step trace, NULL if disabled          */
 
   sunbooleantype ida_constraintsSet; /* constraints vector present:
                                         do constraints calc                   */
@@ -287,6 +289,8 @@ typedef struct IDAMemRec
   void* ida_lmem;      /* linear solver interface structure */
   sunrealtype ida_dcj; /* parameter that determines cj ratio thresholds for calling
                      * the linear solver setup function */
+  sunJacPolicy ida_jpolicy; /* adaptive policy for calling the linear solver
+                               setup function                               */
 
   /* Flag to indicate successful ida_linit call */
 
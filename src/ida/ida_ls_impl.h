@@ -21,6 +21,7 @@
 #include <ida/ida_ls.h>
 
 #include "ida_impl.h"
+#include "sundials_dqjac_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -57,6 +58,9 @@ typedef struct IDALsMemRec
   /* Matrix-based solver, scale solution to account for change in cj */
   sunbooleantype scalesol;
 
+  /* Threaded difference quotient Jacobian (dense and band) */
+  sunDQThreads dqthreads;
+
   /* Iterative solver tolerance */
   sunrealtype eplifac; /* nonlinear -> linear tol scaling factor       */
   sunrealtype nrmfac;  /* integrator -> LS norm conversion factor      */
@@ -131,6 +135,12 @@ int idaLsDenseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
 int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
                    N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
                    N_Vector tmp2, N_Vector tmp3);
+int idaLsDenseDQJacThreaded(sunrealtype tt, sunrealtype c_j, N_Vector yy,
+                            N_Vector yp, N_Vector rr, SUNMatrix Jac,
+                            IDAMem IDA_mem);
+int idaLsBandDQJacThreaded(sunrealtype tt, sunrealtype c_j, N_Vector yy,
+                           N_Vector yp, N_Vector rr, SUNMatrix Jac,
+                           IDAMem IDA_mem);
 
 /* Generic linit/lsetup/lsolve/lperf/lfree interface routines for IDA to call */
 int idaLsInitialize(IDAMem IDA_mem);
@@ -247,10 +247,21 @@ static int idaNlsLSetup(SUNDIALS_MAYBE_UNUSED sunbooleantype jbad,
   IDA_mem = (IDAMem)ida_mem;
 
   IDA_mem->ida_nsetups++;
+
+  if (IDA_mem->ida_jpolicy.enabled)
+  {
+    sunJacPolicy_BeginSetup(&IDA_mem->ida_jpolicy);
+  }
+
   retval = IDA_mem->ida_lsetup(IDA_mem, IDA_mem->ida_yy, IDA_mem->ida_yp,
                                IDA_mem->ida_savres, IDA_mem->ida_tempv1,
                                IDA_mem->ida_tempv2, IDA_mem->ida_tempv3);
 
+  if (IDA_mem->ida_jpolicy.enabled)
+  {
+    sunJacPolicy_EndSetup(&IDA_mem->ida_jpolicy, SUNTRUE);
+  }
+
   /* update Jacobian status */
   *jcur = SUNTRUE;
 
@@ -268,7 +279,7 @@ static int idaNlsLSetup(SUNDIALS_MAYBE_UNUSED sunbooleantype jbad,
 static int idaNlsLSolve(N_Vector delta, void* ida_mem)
 {
   IDAMem IDA_mem;
-  int retval;
+  int retval, curiter;
 
   if (ida_mem == NULL)
   {
@@ -277,6 +288,13 @@ static int idaNlsLSolve(N_Vector delta, void* ida_mem)
   }
   IDA_mem = (IDAMem)ida_mem;
 
+  /* Update the measured Newton iteration cost */
+  if (IDA_mem->ida_jpolicy.enabled)
+  {
+    (void)SUNNonlinSolGetCurIter(IDA_mem->NLS, &curiter);
+    sunJacPolicy_Solve(&IDA_mem->ida_jpolicy, curiter);
+  }
+
   retval = IDA_mem->ida_lsolve(IDA_mem, delta, IDA_mem->ida_ewt, IDA_mem->ida_yy,
                                IDA_mem->ida_yp, IDA_mem->ida_savres);
 
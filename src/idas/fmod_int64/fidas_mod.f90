@@ -101,12 +101,14 @@ module fidas_mod
  public :: FIDASetStepToleranceIC
  public :: FIDASetMaxBacksIC
  public :: FIDASetDeltaCjLSetup
+ public :: FIDASetAdaptiveJacEval
  public :: FIDASetUserData
  public :: FIDASetMaxOrd
  public :: FIDASetMaxNumSteps
  public :: FIDASetInitStep
  public :: FIDASetMaxStep
  public :: FIDASetMinStep
+ public :: FIDASetStepTrace
  public :: FIDASetStopTime
  public :: FIDAClearStopTime
  public :: FIDASetMaxErrTestFails
@@ -301,6 +303,7 @@ module fidas_mod
  public :: FIDAGetAdjCurrentCheckPoint
  public :: FIDABBDPrecInit
  public :: FIDABBDPrecReInit
+ public :: FIDABBDPrecSetNumSubBlocks
  public :: FIDABBDPrecGetWorkSpace
  public :: FIDABBDPrecGetNumGfnEvals
  public :: FIDABBDPrecInitB
@@ -325,6 +328,7 @@ module fidas_mod
  public :: FIDASetLSNormFactor
  public :: FIDASetLinearSolutionScaling
  public :: FIDASetIncrementFactor
+ public :: FIDASetDQJacNumThreads
  public :: FIDAGetJac
  public :: FIDAGetJacCj
  public :: FIDAGetJacTime
@@ -496,6 +500,15 @@ real(C_DOUBLE), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetAdaptiveJacEval(farg1, farg2) &
+bind(C, name="_wrap_FIDASetAdaptiveJacEval") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetUserData(farg1, farg2) &
 bind(C, name="_wrap_FIDASetUserData") &
 result(fresult)
@@ -550,6 +563,15 @@ real(C_DOUBLE), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetStepTrace(farg1, farg2) &
+bind(C, name="_wrap_FIDASetStepTrace") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetStopTime(farg1, farg2) &
 bind(C, name="_wrap_FIDASetStopTime") &
 result(fresult)
@@ -2244,6 +2266,15 @@ real(C_DOUBLE), intent(in) :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDABBDPrecSetNumSubBlocks(farg1, farg2) &
+bind(C, name="_wrap_FIDABBDPrecSetNumSubBlocks") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDABBDPrecGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FIDABBDPrecGetWorkSpace") &
 result(fresult)
@@ -2367,6 +2398,15 @@ real(C_DOUBLE), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetDQJacNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FIDASetDQJacNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDAGetJac(farg1, farg2) &
 bind(C, name="_wrap_FIDAGetJac") &
 result(fresult)
@@ -2884,6 +2924,22 @@ fresult = swigc_FIDASetDeltaCjLSetup(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDASetAdaptiveJacEval(ida_mem, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = ida_mem
+farg2 = onoff
+fresult = swigc_FIDASetAdaptiveJacEval(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDASetUserData(ida_mem, user_data) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2980,6 +3036,22 @@ fresult = swigc_FIDASetMinStep(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDASetStepTrace(ida_mem, trace) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(C_PTR) :: trace
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = ida_mem
+farg2 = trace
+fresult = swigc_FIDASetStepTrace(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDASetStopTime(ida_mem, tstop) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6125,6 +6197,22 @@ fresult = swigc_FIDABBDPrecReInit(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FIDABBDPrecSetNumSubBlocks(ida_mem, nsub) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_INT), intent(in) :: nsub
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = ida_mem
+farg2 = nsub
+fresult = swigc_FIDABBDPrecSetNumSubBlocks(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDABBDPrecGetWorkSpace(ida_mem, lenrwbbdp, leniwbbdp) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6362,6 +6450,22 @@ fresult = swigc_FIDASetIncrementFactor(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDASetDQJacNumThreads(ida_mem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = ida_mem
+farg2 = nthreads
+fresult = swigc_FIDASetDQJacNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDAGetJac(ida_mem, j) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
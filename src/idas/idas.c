@@ -85,6 +85,10 @@
  *   Main IDAStep function
  *       IDAStep
  *       IDASetCoeffs
+ *   Step trace functions
+ *       IDATraceCounters
+ *       IDATraceBeginStep
+ *       IDATraceEndStep
  *   Nonlinear solver functions
  *       IDANls
  *       IDAPredict
@@ -147,6 +151,7 @@
 #include <sunnonlinsol/sunnonlinsol_newton.h>
 
 #include "idas_impl.h"
+#include "idas_ls_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 
 /*
@@ -287,6 +292,13 @@ static int IDAQuadSensEwtSetSV(IDAMem IDA_mem, N_Vector* yScur,
 
 static int IDAStep(IDAMem IDA_mem);
 
+/* Step trace functions */
+
+static void IDATraceCounters(IDAMem IDA_mem, long int* nli, long int* nje);
+static void IDATraceBeginStep(IDAMem IDA_mem);
+static void IDATraceEndStep(IDAMem IDA_mem, SUNStepTraceStatus status,
+                            sunrealtype dsm);
+
 /* Function called at beginning of step */
 
 static void IDASetCoeffs(IDAMem IDA_mem, sunrealtype* ck);
@@ -412,7 +424,7 @@ void* IDACreate(SUNContext sunctx)
   }
 
   IDA_mem = NULL;
-  IDA_mem = (IDAMem)malloc(sizeof(struct IDAMemRec));
+  IDA_mem = (IDAMem)SUNContext_ArenaAlloc(sunctx, sizeof(struct IDAMemRec));
   if (IDA_mem == NULL)
   {
     IDAProcessError(NULL, 0, __LINE__, __func__, __FILE__, MSG_MEM_FAIL);
@@ -435,6 +447,7 @@ void* IDACreate(SUNContext sunctx)
   IDA_mem->ida_user_efun      = SUNFALSE;
   IDA_mem->ida_efun           = NULL;
   IDA_mem->ida_edata          = NULL;
+  IDA_mem->ida_trace          = NULL;
   IDA_mem->ida_maxord         = MAXORD_DEFAULT;
   IDA_mem->ida_mxstep         = MXSTEP_DEFAULT;
   IDA_mem->ida_hmax_inv       = HMAX_INV_DEFAULT;
@@ -456,6 +469,7 @@ void* IDACreate(SUNContext sunctx)
   IDA_mem->ida_constraintsSet = SUNFALSE;
   IDA_mem->ida_tstopset       = SUNFALSE;
   IDA_mem->ida_dcj            = DCJ_DEFAULT;
+  sunJacPolicy_Init(&IDA_mem->ida_jpolicy, SUNFALSE);
 
   /* set the saved value maxord_alloc */
   IDA_mem->ida_maxord_alloc = MAXORD_DEFAULT;
@@ -703,12 +717,13 @@ int IDAInit(void* ida_mem, IDAResFn res, sunrealtype t0, N_Vector yy0,
 
   /* Set the linear solver addresses to NULL */
 
-  IDA_mem->ida_linit  = NULL;
-  IDA_mem->ida_lsetup = NULL;
-  IDA_mem->ida_lsolve = NULL;
-  IDA_mem->ida_lperf  = NULL;
-  IDA_mem->ida_lfree  = NULL;
-  IDA_mem->ida_lmem   = NULL;
+  IDA_mem->ida_linit          = NULL;
+  IDA_mem->ida_lsetup         = NULL;
+  IDA_mem->ida_lsolve         = NULL;
+  IDA_mem->ida_lsolvemultiple = NULL;
+  IDA_mem->ida_lperf          = NULL;
+  IDA_mem->ida_lfree          = NULL;
+  IDA_mem->ida_lmem           = NULL;
 
   /* Set forceSetup to SUNFALSE */
 
@@ -724,6 +739,8 @@ int IDAInit(void* ida_mem, IDAResFn res, sunrealtype t0, N_Vector yy0,
   IDA_mem->ida_nnf     = 0;
   IDA_mem->ida_nsetups = 0;
 
+  sunJacPolicy_Init(&IDA_mem->ida_jpolicy, IDA_mem->ida_jpolicy.enabled);
+
   IDA_mem->ida_kused = 0;
   IDA_mem->ida_hused = ZERO;
   IDA_mem->ida_tolsf = ONE;
@@ -841,6 +858,8 @@ int IDAReInit(void* ida_mem, sunrealtype t0, N_Vector yy0, N_Vector yp0)
   IDA_mem->ida_nnf     = 0;
   IDA_mem->ida_nsetups = 0;
 
+  sunJacPolicy_Init(&IDA_mem->ida_jpolicy, IDA_mem->ida_jpolicy.enabled);
+
   IDA_mem->ida_kused = 0;
   IDA_mem->ida_hused = ZERO;
   IDA_mem->ida_tolsf = ONE;
@@ -4094,7 +4113,7 @@ void IDAFree(void** ida_mem)
   free(IDA_mem->ida_Zvecs);
   IDA_mem->ida_Zvecs = NULL;
 
-  free(*ida_mem);
+  SUNContext_ArenaFree(IDA_mem->ida_sunctx, IDA_mem);
   *ida_mem = NULL;
 }
 
@@ -5914,6 +5933,8 @@ static int IDAStep(IDAMem IDA_mem)
                IDA_mem->ida_nst + 1, IDA_mem->ida_tn, IDA_mem->ida_hh,
                IDA_mem->ida_kk);
 
+    IDATraceBeginStep(IDA_mem);
+
     /*-----------------------
       Set method coefficients
       -----------------------*/
@@ -5974,6 +5995,13 @@ static int IDAStep(IDAMem IDA_mem)
                    "end-step-attempt", "status = failed solve, kflag = %i",
                    kflag);
 
+      if (nflag == ERROR_TEST_FAIL)
+      {
+        IDATraceEndStep(IDA_mem, SUN_STEPTRACE_ERRTEST_FAIL,
+                        ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
+      }
+      else { IDATraceEndStep(IDA_mem, SUN_STEPTRACE_SOLVE_FAIL, ZERO); }
+
       /* exit on nonrecoverable failure */
       if (kflag != PREDICT_AGAIN) { return (kflag); }
 
@@ -6012,6 +6040,13 @@ static int IDAStep(IDAMem IDA_mem)
                      IDA_LOGGER, "end-step-attempt",
                      "status = failed quad solve, kflag = %i", kflag);
 
+        if (nflag == ERROR_TEST_FAIL)
+        {
+          IDATraceEndStep(IDA_mem, SUN_STEPTRACE_ERRTEST_FAIL,
+                          ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
+        }
+        else { IDATraceEndStep(IDA_mem, SUN_STEPTRACE_SOLVE_FAIL, ZERO); }
+
         /* exit on nonrecoverable failure */
         if (kflag != PREDICT_AGAIN) { return (kflag); }
 
@@ -6035,6 +6070,10 @@ static int IDAStep(IDAMem IDA_mem)
 
       SUNLogInfoIf(retval != 0, IDA_LOGGER, "end-step-attempt",
                    "status = failed res eval, retval = %i", retval);
+      if (retval != 0)
+      {
+        IDATraceEndStep(IDA_mem, SUN_STEPTRACE_OTHER_FAIL, ZERO);
+      }
 
       if (retval < 0) { return (IDA_RES_FAIL); }
       if (retval > 0) { continue; }
@@ -6068,6 +6107,13 @@ static int IDAStep(IDAMem IDA_mem)
                      IDA_LOGGER, "end-step-attempt",
                      "status = failed sens solve, kflag = %i", kflag);
 
+        if (nflag == ERROR_TEST_FAIL)
+        {
+          IDATraceEndStep(IDA_mem, SUN_STEPTRACE_ERRTEST_FAIL,
+                          ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
+        }
+        else { IDATraceEndStep(IDA_mem, SUN_STEPTRACE_SOLVE_FAIL, ZERO); }
+
         /* exit on nonrecoverable failure */
         if (kflag != PREDICT_AGAIN) { return (kflag); }
 
@@ -6107,6 +6153,13 @@ static int IDAStep(IDAMem IDA_mem)
                      IDA_LOGGER, "end-step-attempt",
                      "status = failed quad sens solve, kflag = %i", kflag);
 
+        if (nflag == ERROR_TEST_FAIL)
+        {
+          IDATraceEndStep(IDA_mem, SUN_STEPTRACE_ERRTEST_FAIL,
+                          ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
+        }
+        else { IDATraceEndStep(IDA_mem, SUN_STEPTRACE_SOLVE_FAIL, ZERO); }
+
         /* exit on nonrecoverable failure */
         if (kflag != PREDICT_AGAIN) { return (kflag); }
 
@@ -6124,6 +6177,8 @@ static int IDAStep(IDAMem IDA_mem)
   SUNLogInfo(IDA_LOGGER, "end-step-attempt",
              "status = success, dsm = " SUN_FORMAT_G,
              ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
+  IDATraceEndStep(IDA_mem, SUN_STEPTRACE_SUCCESS,
+                  ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
 
   /* Nonlinear system solve and error test were both successful;
      update data, and consider change of step and/or order */
@@ -6146,6 +6201,73 @@ static int IDAStep(IDAMem IDA_mem)
   return (IDA_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Step trace functions
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * IDATraceCounters
+ *
+ * This routine returns the linear iteration and Jacobian evaluation
+ * counters of the IDALS interface, or zero if no linear solver
+ * interface is attached.
+ */
+
+static void IDATraceCounters(IDAMem IDA_mem, long int* nli, long int* nje)
+{
+  IDALsMem idals_mem;
+
+  *nli = 0;
+  *nje = 0;
+
+  if (IDA_mem->ida_lmem && IDA_mem->ida_linit == idaLsInitialize)
+  {
+    idals_mem = (IDALsMem)(IDA_mem->ida_lmem);
+    *nli      = idals_mem->nli;
+    *nje      = idals_mem->nje;
+  }
+}
+
+/*
+ * IDATraceBeginStep
+ *
+ * This routine stores the state at the start of a step attempt in
+ * the step trace, if one is attached.
+ */
+
+static void IDATraceBeginStep(IDAMem IDA_mem)
+{
+  long int nli, nje;
+
+  if (!IDA_mem->ida_trace) { return; }
+
+  IDATraceCounters(IDA_mem, &nli, &nje);
+  SUNStepTrace_BeginStep(IDA_mem->ida_trace, IDA_mem->ida_tn, IDA_mem->ida_hh,
+                         IDA_mem->ida_kk, IDA_mem->ida_nni, nli, nje,
+                         IDA_mem->ida_nsetups);
+}
+
+/*
+ * IDATraceEndStep
+ *
+ * This routine records the outcome of the current step attempt in
+ * the step trace, if one is attached.
+ */
+
+static void IDATraceEndStep(IDAMem IDA_mem, SUNStepTraceStatus status,
+                            sunrealtype dsm)
+{
+  long int nli, nje;
+
+  if (!IDA_mem->ida_trace) { return; }
+
+  IDATraceCounters(IDA_mem, &nli, &nje);
+  SUNStepTrace_EndStep(IDA_mem->ida_trace, status, dsm, IDA_mem->ida_nni, nli,
+                       nje, IDA_mem->ida_nsetups);
+}
+
 /*
  * IDASetCoeffs
  *
@@ -6348,6 +6470,11 @@ static int IDANls(IDAMem IDA_mem)
       IDA_mem->ida_ss  = HUNDRED;
       IDA_mem->ida_ssS = HUNDRED;
     }
+    if (IDA_mem->ida_jpolicy.enabled &&
+        sunJacPolicy_Update(&IDA_mem->ida_jpolicy, IDA_mem->ida_nst))
+    {
+      callLSetup = SUNTRUE;
+    }
   }
 
   /* initial guess for the correction to the predictor */
@@ -27,6 +27,7 @@
 #include <nvector/nvector_serial.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sundials/sundials_band.h>
 #include <sundials/sundials_math.h>
 
 #include "idas_bbdpre_impl.h"
@@ -37,6 +38,9 @@
 #define ONE  SUN_RCONST(1.0)
 #define TWO  SUN_RCONST(2.0)
 
+/* pivots of the band LU factorization of a sub-block */
+#define BAND_PIVOTS(S) (((SUNLinearSolverContent_Band)((S)->content))->pivots)
+
 /* Prototypes of IDABBDPrecSetup and IDABBDPrecSolve */
 static int IDABBDPrecSetup(sunrealtype tt, N_Vector yy, N_Vector yp,
                            N_Vector rr, sunrealtype c_j, void* prec_data);
@@ -49,8 +53,14 @@ static int IDABBDPrecFree(IDAMem ida_mem);
 
 /* Prototype for difference quotient Jacobian calculation routine */
 static int IBBDDQJac(IBBDPrecData pdata, sunrealtype tt, sunrealtype cj,
-                     N_Vector yy, N_Vector yp, N_Vector gref, N_Vector ytemp,
-                     N_Vector yptemp, N_Vector gtemp);
+                     N_Vector yy, N_Vector yp, N_Vector gref);
+
+/* Prototypes for sub-block utility routines */
+static int IBBDAllocSubBlocks(IDAMem IDA_mem, IBBDPrecData pdata, int nsub,
+                              IBBDSubBlock* sub);
+static void IBBDFreeSubBlocks(int nsub, IBBDSubBlock sub);
+static void IBBDWorkSpace(IBBDPrecData pdata);
+static int IBBDSubBlockRetval(IBBDPrecData pdata);
 
 /* Wrapper functions for adjoint code */
 static int IDAAglocal(sunindextype NlocalB, sunrealtype tt, N_Vector yyB,
@@ -76,8 +86,7 @@ int IDABBDPrecInit(void* ida_mem, sunindextype Nlocal, sunindextype mudq,
   IDAMem IDA_mem;
   IDALsMem idals_mem;
   IBBDPrecData pdata;
-  sunindextype muk, mlk, storage_mu, lrw1, liw1;
-  long int lrw, liw;
+  sunindextype muk, mlk;
   int flag;
 
   if (ida_mem == NULL)
@@ -126,98 +135,11 @@ int IDABBDPrecInit(void* ida_mem, sunindextype Nlocal, sunindextype mudq,
   pdata->mukeep  = muk;
   pdata->mlkeep  = mlk;
 
-  /* Set extended upper half-bandwidth for PP (required for pivoting). */
-  storage_mu = SUNMIN(Nlocal - 1, muk + mlk);
-
-  /* Allocate memory for preconditioner matrix. */
-  pdata->PP = NULL;
-  pdata->PP = SUNBandMatrixStorage(Nlocal, muk, mlk, storage_mu,
-                                   IDA_mem->ida_sunctx);
-  if (pdata->PP == NULL)
-  {
-    free(pdata);
-    pdata = NULL;
-    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSGBBD_MEM_FAIL);
-    return (IDALS_MEM_FAIL);
-  }
-
-  /* Allocate memory for temporary N_Vectors */
-  pdata->zlocal = NULL;
-  pdata->zlocal = N_VNewEmpty_Serial(Nlocal, IDA_mem->ida_sunctx);
-  if (pdata->zlocal == NULL)
-  {
-    SUNMatDestroy(pdata->PP);
-    free(pdata);
-    pdata = NULL;
-    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSGBBD_MEM_FAIL);
-    return (IDALS_MEM_FAIL);
-  }
-  pdata->rlocal = NULL;
-  pdata->rlocal = N_VNewEmpty_Serial(Nlocal, IDA_mem->ida_sunctx);
-  if (pdata->rlocal == NULL)
-  {
-    N_VDestroy(pdata->zlocal);
-    SUNMatDestroy(pdata->PP);
-    free(pdata);
-    pdata = NULL;
-    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSGBBD_MEM_FAIL);
-    return (IDALS_MEM_FAIL);
-  }
+  /* Allocate memory for temporary N_Vector */
   pdata->tempv1 = NULL;
   pdata->tempv1 = N_VClone(IDA_mem->ida_tempv1);
   if (pdata->tempv1 == NULL)
   {
-    N_VDestroy(pdata->rlocal);
-    N_VDestroy(pdata->zlocal);
-    SUNMatDestroy(pdata->PP);
-    free(pdata);
-    pdata = NULL;
-    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSGBBD_MEM_FAIL);
-    return (IDALS_MEM_FAIL);
-  }
-  pdata->tempv2 = NULL;
-  pdata->tempv2 = N_VClone(IDA_mem->ida_tempv1);
-  if (pdata->tempv2 == NULL)
-  {
-    N_VDestroy(pdata->rlocal);
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->tempv1);
-    SUNMatDestroy(pdata->PP);
-    free(pdata);
-    pdata = NULL;
-    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSGBBD_MEM_FAIL);
-    return (IDALS_MEM_FAIL);
-  }
-  pdata->tempv3 = NULL;
-  pdata->tempv3 = N_VClone(IDA_mem->ida_tempv1);
-  if (pdata->tempv3 == NULL)
-  {
-    N_VDestroy(pdata->rlocal);
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->tempv1);
-    N_VDestroy(pdata->tempv2);
-    SUNMatDestroy(pdata->PP);
-    free(pdata);
-    pdata = NULL;
-    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSGBBD_MEM_FAIL);
-    return (IDALS_MEM_FAIL);
-  }
-  pdata->tempv4 = NULL;
-  pdata->tempv4 = N_VClone(IDA_mem->ida_tempv1);
-  if (pdata->tempv4 == NULL)
-  {
-    N_VDestroy(pdata->rlocal);
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->tempv1);
-    N_VDestroy(pdata->tempv2);
-    N_VDestroy(pdata->tempv3);
-    SUNMatDestroy(pdata->PP);
     free(pdata);
     pdata = NULL;
     IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
@@ -225,77 +147,29 @@ int IDABBDPrecInit(void* ida_mem, sunindextype Nlocal, sunindextype mudq,
     return (IDALS_MEM_FAIL);
   }
 
-  /* Allocate memory for banded linear solver */
-  pdata->LS = NULL;
-  pdata->LS = SUNLinSol_Band(pdata->rlocal, pdata->PP, IDA_mem->ida_sunctx);
-  if (pdata->LS == NULL)
-  {
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
-    N_VDestroy(pdata->tempv1);
-    N_VDestroy(pdata->tempv2);
-    N_VDestroy(pdata->tempv3);
-    N_VDestroy(pdata->tempv4);
-    SUNMatDestroy(pdata->PP);
-    free(pdata);
-    pdata = NULL;
-    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
-                    MSGBBD_MEM_FAIL);
-    return (IDALS_MEM_FAIL);
-  }
+  /* Store Nlocal to be used in IDABBDPrecSetup */
+  pdata->n_local = Nlocal;
 
-  /* initialize band linear solver object */
-  flag = SUNLinSolInitialize(pdata->LS);
-  if (flag != SUN_SUCCESS)
+  /* Allocate matrix and band linear solver for a single local block */
+  pdata->nsub = 1;
+  pdata->sub  = NULL;
+  flag        = IBBDAllocSubBlocks(IDA_mem, pdata, 1, &(pdata->sub));
+  if (flag != IDALS_SUCCESS)
   {
-    N_VDestroy(pdata->zlocal);
-    N_VDestroy(pdata->rlocal);
     N_VDestroy(pdata->tempv1);
-    N_VDestroy(pdata->tempv2);
-    N_VDestroy(pdata->tempv3);
-    N_VDestroy(pdata->tempv4);
-    SUNMatDestroy(pdata->PP);
-    SUNLinSolFree(pdata->LS);
     free(pdata);
     pdata = NULL;
-    IDAProcessError(IDA_mem, IDALS_SUNLS_FAIL, __LINE__, __func__, __FILE__,
-                    MSGBBD_SUNLS_FAIL);
-    return (IDALS_SUNLS_FAIL);
+    IDAProcessError(IDA_mem, flag, __LINE__, __func__, __FILE__,
+                    (flag == IDALS_MEM_FAIL) ? MSGBBD_MEM_FAIL
+                                             : MSGBBD_SUNLS_FAIL);
+    return (flag);
   }
 
   /* Set rel_yy based on input value dq_rel_yy (0 implies default). */
   pdata->rel_yy = (dq_rel_yy > ZERO) ? dq_rel_yy : SUNRsqrt(IDA_mem->ida_uround);
 
-  /* Store Nlocal to be used in IDABBDPrecSetup */
-  pdata->n_local = Nlocal;
-
   /* Set work space sizes and initialize nge. */
-  pdata->rpwsize = 0;
-  pdata->ipwsize = 0;
-  if (IDA_mem->ida_tempv1->ops->nvspace)
-  {
-    N_VSpace(IDA_mem->ida_tempv1, &lrw1, &liw1);
-    pdata->rpwsize += 4 * lrw1;
-    pdata->ipwsize += 4 * liw1;
-  }
-  if (pdata->rlocal->ops->nvspace)
-  {
-    N_VSpace(pdata->rlocal, &lrw1, &liw1);
-    pdata->rpwsize += 2 * lrw1;
-    pdata->ipwsize += 2 * liw1;
-  }
-  if (pdata->PP->ops->space)
-  {
-    flag = SUNMatSpace(pdata->PP, &lrw, &liw);
-    pdata->rpwsize += lrw;
-    pdata->ipwsize += liw;
-  }
-  if (pdata->LS->ops->space)
-  {
-    flag = SUNLinSolSpace(pdata->LS, &lrw, &liw);
-    pdata->rpwsize += lrw;
-    pdata->ipwsize += liw;
-  }
+  IBBDWorkSpace(pdata);
   pdata->nge = 0;
 
   /* make sure pdata is free from any previous allocations */
@@ -362,6 +236,67 @@ int IDABBDPrecReInit(void* ida_mem, sunindextype mudq, sunindextype mldq,
   return (IDALS_SUCCESS);
 }
 
+/*-------------------------------------------------------------*/
+int IDABBDPrecSetNumSubBlocks(void* ida_mem, int nsub)
+{
+  IDAMem IDA_mem;
+  IDALsMem idals_mem;
+  IBBDPrecData pdata;
+  IBBDSubBlock sub;
+  int flag;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDALS_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSGBBD_MEM_NULL);
+    return (IDALS_MEM_NULL);
+  }
+  IDA_mem = (IDAMem)ida_mem;
+
+  if (IDA_mem->ida_lmem == NULL)
+  {
+    IDAProcessError(IDA_mem, IDALS_LMEM_NULL, __LINE__, __func__, __FILE__,
+                    MSGBBD_LMEM_NULL);
+    return (IDALS_LMEM_NULL);
+  }
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+
+  if (idals_mem->pdata == NULL)
+  {
+    IDAProcessError(IDA_mem, IDALS_PMEM_NULL, __LINE__, __func__, __FILE__,
+                    MSGBBD_PMEM_NULL);
+    return (IDALS_PMEM_NULL);
+  }
+  pdata = (IBBDPrecData)idals_mem->pdata;
+
+  if (nsub < 1 || nsub > pdata->n_local)
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSGBBD_BAD_NSUB);
+    return (IDALS_ILL_INPUT);
+  }
+  if (nsub == pdata->nsub) { return (IDALS_SUCCESS); }
+
+  /* Allocate the new sub-blocks before releasing the current ones */
+  sub  = NULL;
+  flag = IBBDAllocSubBlocks(IDA_mem, pdata, nsub, &sub);
+  if (flag != IDALS_SUCCESS)
+  {
+    IDAProcessError(IDA_mem, flag, __LINE__, __func__, __FILE__,
+                    (flag == IDALS_MEM_FAIL) ? MSGBBD_MEM_FAIL
+                                             : MSGBBD_SUNLS_FAIL);
+    return (flag);
+  }
+
+  IBBDFreeSubBlocks(pdata->nsub, pdata->sub);
+  pdata->nsub = nsub;
+  pdata->sub  = sub;
+
+  IBBDWorkSpace(pdata);
+
+  return (IDALS_SUCCESS);
+}
+
 /*-------------------------------------------------------------*/
 int IDABBDPrecGetWorkSpace(void* ida_mem, long int* lenrwBBDP, long int* leniwBBDP)
 {
@@ -473,17 +408,22 @@ static int IDABBDPrecSetup(sunrealtype tt, N_Vector yy, N_Vector yp,
                            void* bbd_data)
 {
   IBBDPrecData pdata;
+  IBBDSubBlock sub;
   IDAMem IDA_mem;
-  int retval;
+  int retval, s;
 
   pdata = (IBBDPrecData)bbd_data;
 
   IDA_mem = (IDAMem)pdata->ida_mem;
+  sub     = pdata->sub;
 
   /* Call IBBDDQJac for a new Jacobian calculation and store in PP. */
-  retval = SUNMatZero(pdata->PP);
-  retval = IBBDDQJac(pdata, tt, c_j, yy, yp, pdata->tempv1, pdata->tempv2,
-                     pdata->tempv3, pdata->tempv4);
+  /* The sub-blocks share one SUNContext, so the parallel regions call the
+     object operations directly rather than the generic wrappers, which
+     access the profiler and error state stored in the context. */
+  SUNDIALS_OMP_PARALLEL_FOR(pdata->nsub)
+  for (s = 0; s < pdata->nsub; s++) { sub[s].PP->ops->zero(sub[s].PP); }
+  retval = IBBDDQJac(pdata, tt, c_j, yy, yp, pdata->tempv1);
   if (retval < 0)
   {
     IDAProcessError(IDA_mem, -1, __LINE__, __func__, __FILE__,
@@ -492,9 +432,14 @@ static int IDABBDPrecSetup(sunrealtype tt, N_Vector yy, N_Vector yp,
   }
   if (retval > 0) { return (+1); }
 
-  /* Do LU factorization of matrix and return error flag */
-  retval = SUNLinSolSetup_Band(pdata->LS, pdata->PP);
-  return (retval);
+  /* Do LU factorization of each sub-block and return error flag */
+  SUNDIALS_OMP_PARALLEL_FOR(pdata->nsub)
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    sub[s].retval = sub[s].LS->ops->setup(sub[s].LS, sub[s].PP);
+  }
+
+  return (IBBDSubBlockRetval(pdata));
 }
 
 /*---------------------------------------------------------------
@@ -526,23 +471,36 @@ static int IDABBDPrecSolve(SUNDIALS_MAYBE_UNUSED sunrealtype tt,
                            void* bbd_data)
 {
   IBBDPrecData pdata;
-  int retval;
+  IBBDSubBlock sub;
+  sunrealtype *rdata, *zdata;
+  int s;
 
   pdata = (IBBDPrecData)bbd_data;
+  sub   = pdata->sub;
+  rdata = N_VGetArrayPointer(rvec);
+  zdata = N_VGetArrayPointer(zvec);
 
-  /* Attach local data arrays for rvec and zvec to rlocal and zlocal */
-  N_VSetArrayPointer(N_VGetArrayPointer(rvec), pdata->rlocal);
-  N_VSetArrayPointer(N_VGetArrayPointer(zvec), pdata->zlocal);
-
-  /* Call banded solver object to do the work */
-  retval = SUNLinSolSolve(pdata->LS, pdata->PP, pdata->zlocal, pdata->rlocal,
-                          ZERO);
-
-  /* Detach local data arrays from rlocal and zlocal */
-  N_VSetArrayPointer(NULL, pdata->rlocal);
-  N_VSetArrayPointer(NULL, pdata->zlocal);
+  SUNDIALS_OMP_PARALLEL_FOR(pdata->nsub)
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    /* Attach local data arrays for rvec and zvec to rlocal and zlocal */
+    sub[s].rlocal->ops->nvsetarraypointer(rdata + sub[s].offset, sub[s].rlocal);
+    sub[s].zlocal->ops->nvsetarraypointer(zdata + sub[s].offset, sub[s].zlocal);
+
+    /* Copy r to z and solve with the band LU factors. The factors are used
+       directly as SUNLinSolSolve_Band calls the generic vector operations. */
+    sub[s].zlocal->ops->nvscale(ONE, sub[s].rlocal, sub[s].zlocal);
+    SUNDlsMat_bandGBTRS(SM_COLS_B(sub[s].PP), SM_COLUMNS_B(sub[s].PP),
+                        SM_SUBAND_B(sub[s].PP), SM_LBAND_B(sub[s].PP),
+                        BAND_PIVOTS(sub[s].LS), zdata + sub[s].offset);
+    sub[s].retval = 0;
+
+    /* Detach local data arrays from rlocal and zlocal */
+    sub[s].rlocal->ops->nvsetarraypointer(NULL, sub[s].rlocal);
+    sub[s].zlocal->ops->nvsetarraypointer(NULL, sub[s].zlocal);
+  }
 
-  return (retval);
+  return (IBBDSubBlockRetval(pdata));
 }
 
 /*-------------------------------------------------------------*/
@@ -557,14 +515,8 @@ static int IDABBDPrecFree(IDAMem IDA_mem)
   if (idals_mem->pdata == NULL) { return (0); }
   pdata = (IBBDPrecData)idals_mem->pdata;
 
-  SUNLinSolFree(pdata->LS);
-  N_VDestroy(pdata->rlocal);
-  N_VDestroy(pdata->zlocal);
+  IBBDFreeSubBlocks(pdata->nsub, pdata->sub);
   N_VDestroy(pdata->tempv1);
-  N_VDestroy(pdata->tempv2);
-  N_VDestroy(pdata->tempv3);
-  N_VDestroy(pdata->tempv4);
-  SUNMatDestroy(pdata->PP);
 
   free(pdata);
   pdata = NULL;
@@ -587,39 +539,44 @@ static int IDABBDPrecFree(IDAMem IDA_mem)
   bandwidth = mlkeep + mukeep + 1. This routine also assumes that
   the local elements of a vector are stored contiguously.
 
+  When the local block is split into sub-blocks, the column groups
+  are distributed over the sub-blocks' work vectors in a round-robin
+  fashion and evaluated concurrently. Each group sets the columns of
+  all sub-blocks, keeping only the elements that lie inside the
+  sub-block of the column.
+
   Return values are: 0 (success), > 0 (recoverable error),
   or < 0 (nonrecoverable error).
   ----------------------------------------------------------------*/
 static int IBBDDQJac(IBBDPrecData pdata, sunrealtype tt, sunrealtype cj,
-                     N_Vector yy, N_Vector yp, N_Vector gref, N_Vector ytemp,
-                     N_Vector yptemp, N_Vector gtemp)
+                     N_Vector yy, N_Vector yp, N_Vector gref)
 {
   IDAMem IDA_mem;
-  sunrealtype inc, inc_inv;
-  int retval;
-  sunindextype group, i, j, width, ngroups, i1, i2;
-  sunrealtype *ydata, *ypdata, *ytempdata, *yptempdata, *grefdata, *gtempdata;
+  IBBDSubBlock sub;
+  int retval, s, nthreads;
+  sunindextype width, ngroups;
+  sunrealtype *ydata, *ypdata, *grefdata;
   sunrealtype *cnsdata = NULL, *ewtdata;
-  sunrealtype *col_j, conj, yj, ypj, ewtj;
 
   IDA_mem = (IDAMem)pdata->ida_mem;
+  sub     = pdata->sub;
 
-  /* Initialize ytemp and yptemp. */
-  N_VScale(ONE, yy, ytemp);
-  N_VScale(ONE, yp, yptemp);
+  /* Initialize each ytemp and yptemp. */
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    N_VScale(ONE, yy, sub[s].ytemp);
+    N_VScale(ONE, yp, sub[s].yptemp);
+  }
 
   /* Obtain pointers as required to the data array of vectors. */
-  ydata     = N_VGetArrayPointer(yy);
-  ypdata    = N_VGetArrayPointer(yp);
-  gtempdata = N_VGetArrayPointer(gtemp);
-  ewtdata   = N_VGetArrayPointer(IDA_mem->ida_ewt);
+  ydata   = N_VGetArrayPointer(yy);
+  ypdata  = N_VGetArrayPointer(yp);
+  ewtdata = N_VGetArrayPointer(IDA_mem->ida_ewt);
   if (IDA_mem->ida_constraintsSet)
   {
     cnsdata = N_VGetArrayPointer(IDA_mem->ida_constraints);
   }
-  ytempdata  = N_VGetArrayPointer(ytemp);
-  yptempdata = N_VGetArrayPointer(yptemp);
-  grefdata   = N_VGetArrayPointer(gref);
+  grefdata = N_VGetArrayPointer(gref);
 
   /* Call gcomm and glocal to get base value of G(t,y,y'). */
   if (pdata->gcomm != NULL)
@@ -637,89 +594,286 @@ static int IBBDDQJac(IBBDPrecData pdata, sunrealtype tt, sunrealtype cj,
   width   = pdata->mldq + pdata->mudq + 1;
   ngroups = SUNMIN(width, pdata->n_local);
 
-  /* Loop over groups. */
-  for (group = 1; group <= ngroups; group++)
+  /* Loop over the groups assigned to each set of work vectors. The adjoint
+     glocal wrapper interpolates the forward solution into shared storage,
+     so the groups of a backward problem are evaluated by a single thread. */
+  nthreads = (pdata->glocal == IDAAglocal) ? 1 : pdata->nsub;
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < pdata->nsub; s++)
   {
-    /* Loop over the components in this group. */
-    for (j = group - 1; j < pdata->n_local; j += width)
+    sunrealtype inc, inc_inv, conj, yj, ypj, ewtj;
+    sunrealtype *ytempdata, *yptempdata, *gtempdata, *col_j;
+    sunindextype group, i, j, i1, i2, off;
+    int b;
+
+    ytempdata     = sub[s].ytemp->ops->nvgetarraypointer(sub[s].ytemp);
+    yptempdata    = sub[s].yptemp->ops->nvgetarraypointer(sub[s].yptemp);
+    gtempdata     = sub[s].gtemp->ops->nvgetarraypointer(sub[s].gtemp);
+    sub[s].nge    = 0;
+    sub[s].retval = 0;
+
+    for (group = s + 1; group <= ngroups; group += pdata->nsub)
     {
-      yj   = ydata[j];
-      ypj  = ypdata[j];
-      ewtj = ewtdata[j];
-
-      /* Set increment inc to yj based on rel_yy*abs(yj), with
-         adjustments using ypj and ewtj if this is small, and a further
-         adjustment to give it the same sign as hh*ypj. */
-      inc = pdata->rel_yy *
-            SUNMAX(SUNRabs(yj),
-                   SUNMAX(SUNRabs(IDA_mem->ida_hh * ypj), ONE / ewtj));
-      if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
-      inc = (yj + inc) - yj;
-
-      /* Adjust sign(inc) again if yj has an inequality constraint. */
-      if (IDA_mem->ida_constraintsSet)
+      /* Loop over the components in this group. */
+      for (j = group - 1; j < pdata->n_local; j += width)
       {
-        conj = cnsdata[j];
-        if (SUNRabs(conj) == ONE)
-        {
-          if ((yj + inc) * conj < ZERO) { inc = -inc; }
-        }
-        else if (SUNRabs(conj) == TWO)
+        yj   = ydata[j];
+        ypj  = ypdata[j];
+        ewtj = ewtdata[j];
+
+        /* Set increment inc to yj based on rel_yy*abs(yj), with
+           adjustments using ypj and ewtj if this is small, and a further
+           adjustment to give it the same sign as hh*ypj. */
+        inc = pdata->rel_yy *
+              SUNMAX(SUNRabs(yj),
+                     SUNMAX(SUNRabs(IDA_mem->ida_hh * ypj), ONE / ewtj));
+        if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
+        inc = (yj + inc) - yj;
+
+        /* Adjust sign(inc) again if yj has an inequality constraint. */
+        if (IDA_mem->ida_constraintsSet)
         {
-          if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          conj = cnsdata[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          }
         }
-      }
 
-      /* Increment yj and ypj. */
-      ytempdata[j] += inc;
-      yptempdata[j] += cj * inc;
-    }
+        /* Increment yj and ypj. */
+        ytempdata[j] += inc;
+        yptempdata[j] += cj * inc;
+      }
 
-    /* Evaluate G with incremented y and yp arguments. */
-    retval = pdata->glocal(pdata->n_local, tt, ytemp, yptemp, gtemp,
-                           IDA_mem->ida_user_data);
-    pdata->nge++;
-    if (retval != 0) { return (retval); }
+      /* Evaluate G with incremented y and yp arguments. */
+      sub[s].retval = pdata->glocal(pdata->n_local, tt, sub[s].ytemp,
+                                    sub[s].yptemp, sub[s].gtemp,
+                                    IDA_mem->ida_user_data);
+      sub[s].nge++;
+      if (sub[s].retval != 0) { break; }
 
-    /* Loop over components of the group again; restore ytemp and yptemp. */
-    for (j = group - 1; j < pdata->n_local; j += width)
-    {
-      yj = ytempdata[j] = ydata[j];
-      ypj = yptempdata[j] = ypdata[j];
-      ewtj                = ewtdata[j];
-
-      /* Set increment inc as before .*/
-      inc = pdata->rel_yy *
-            SUNMAX(SUNRabs(yj),
-                   SUNMAX(SUNRabs(IDA_mem->ida_hh * ypj), ONE / ewtj));
-      if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
-      inc = (yj + inc) - yj;
-      if (IDA_mem->ida_constraintsSet)
+      /* Loop over components of the group again; restore ytemp and yptemp. */
+      b = 0;
+      for (j = group - 1; j < pdata->n_local; j += width)
       {
-        conj = cnsdata[j];
-        if (SUNRabs(conj) == ONE)
+        yj = ytempdata[j] = ydata[j];
+        ypj = yptempdata[j] = ypdata[j];
+        ewtj                = ewtdata[j];
+
+        /* Set increment inc as before .*/
+        inc = pdata->rel_yy *
+              SUNMAX(SUNRabs(yj),
+                     SUNMAX(SUNRabs(IDA_mem->ida_hh * ypj), ONE / ewtj));
+        if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
+        inc = (yj + inc) - yj;
+        if (IDA_mem->ida_constraintsSet)
         {
-          if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          conj = cnsdata[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          }
         }
-        else if (SUNRabs(conj) == TWO)
+
+        /* Find the sub-block containing column j */
+        while (j >= sub[b].offset + sub[b].n) { b++; }
+        off = sub[b].offset;
+
+        /* Form difference quotients and load into PP. */
+        inc_inv = ONE / inc;
+        col_j   = SM_COLUMN_B(sub[b].PP, j - off);
+        i1      = SUNMAX(off, j - pdata->mukeep);
+        i2      = SUNMIN(j + pdata->mlkeep, off + sub[b].n - 1);
+        for (i = i1; i <= i2; i++)
         {
-          if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          SM_COLUMN_ELEMENT_B(col_j, i - off, j - off) =
+            inc_inv * (gtempdata[i] - grefdata[i]);
         }
       }
+    }
+  }
 
-      /* Form difference quotients and load into PP. */
-      inc_inv = ONE / inc;
-      col_j   = SUNBandMatrix_Column(pdata->PP, j);
-      i1      = SUNMAX(0, j - pdata->mukeep);
-      i2      = SUNMIN(j + pdata->mlkeep, pdata->n_local - 1);
-      for (i = i1; i <= i2; i++)
-      {
-        SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv * (gtempdata[i] - grefdata[i]);
-      }
+  for (s = 0; s < pdata->nsub; s++) { pdata->nge += sub[s].nge; }
+
+  return (IBBDSubBlockRetval(pdata));
+}
+
+/*---------------------------------------------------------------
+  IBBDAllocSubBlocks
+
+  This routine splits the local block into nsub sub-blocks of
+  nearly equal size and allocates the band matrix, band linear
+  solver, and work vectors of each sub-block. The half-bandwidths
+  kept are limited by the sub-block size. On failure all memory
+  allocated here is released and IDALS_MEM_FAIL or IDALS_SUNLS_FAIL
+  is returned.
+  ---------------------------------------------------------------*/
+static int IBBDAllocSubBlocks(IDAMem IDA_mem, IBBDPrecData pdata, int nsub,
+                              IBBDSubBlock* sub)
+{
+  IBBDSubBlock sb;
+  sunindextype n, muk, mlk, storage_mu;
+  int s;
+
+  sb = NULL;
+  sb = (IBBDSubBlock)malloc(nsub * sizeof(struct IBBDSubBlockRec));
+  if (sb == NULL) { return (IDALS_MEM_FAIL); }
+
+  for (s = 0; s < nsub; s++)
+  {
+    sb[s].PP     = NULL;
+    sb[s].LS     = NULL;
+    sb[s].zlocal = NULL;
+    sb[s].rlocal = NULL;
+    sb[s].ytemp  = NULL;
+    sb[s].yptemp = NULL;
+    sb[s].gtemp  = NULL;
+    sb[s].nge    = 0;
+    sb[s].retval = 0;
+  }
+
+  for (s = 0; s < nsub; s++)
+  {
+    /* The first (n_local mod nsub) sub-blocks have one extra row */
+    n            = pdata->n_local / nsub;
+    sb[s].n      = n + ((s < pdata->n_local % nsub) ? 1 : 0);
+    sb[s].offset = s * n + SUNMIN(s, pdata->n_local % nsub);
+
+    /* Set extended upper half-bandwidth for PP (required for pivoting). */
+    muk        = SUNMIN(sb[s].n - 1, pdata->mukeep);
+    mlk        = SUNMIN(sb[s].n - 1, pdata->mlkeep);
+    storage_mu = SUNMIN(sb[s].n - 1, muk + mlk);
+
+    sb[s].PP     = SUNBandMatrixStorage(sb[s].n, muk, mlk, storage_mu,
+                                        IDA_mem->ida_sunctx);
+    sb[s].zlocal = N_VNewEmpty_Serial(sb[s].n, IDA_mem->ida_sunctx);
+    sb[s].rlocal = N_VNewEmpty_Serial(sb[s].n, IDA_mem->ida_sunctx);
+    sb[s].ytemp  = N_VClone(IDA_mem->ida_tempv1);
+    sb[s].yptemp = N_VClone(IDA_mem->ida_tempv1);
+    sb[s].gtemp  = N_VClone(IDA_mem->ida_tempv1);
+    if (sb[s].PP == NULL || sb[s].zlocal == NULL || sb[s].rlocal == NULL ||
+        sb[s].ytemp == NULL || sb[s].yptemp == NULL || sb[s].gtemp == NULL)
+    {
+      IBBDFreeSubBlocks(nsub, sb);
+      return (IDALS_MEM_FAIL);
+    }
+
+    /* Allocate and initialize the band linear solver object */
+    sb[s].LS = SUNLinSol_Band(sb[s].rlocal, sb[s].PP, IDA_mem->ida_sunctx);
+    if (sb[s].LS == NULL)
+    {
+      IBBDFreeSubBlocks(nsub, sb);
+      return (IDALS_MEM_FAIL);
+    }
+    if (SUNLinSolInitialize(sb[s].LS) != SUN_SUCCESS)
+    {
+      IBBDFreeSubBlocks(nsub, sb);
+      return (IDALS_SUNLS_FAIL);
     }
   }
 
-  return (0);
+  *sub = sb;
+  return (IDALS_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  IBBDFreeSubBlocks
+
+  This routine frees the sub-block array and all objects owned by
+  its entries.
+  ---------------------------------------------------------------*/
+static void IBBDFreeSubBlocks(int nsub, IBBDSubBlock sub)
+{
+  int s;
+
+  if (sub == NULL) { return; }
+
+  for (s = 0; s < nsub; s++)
+  {
+    if (sub[s].LS) { SUNLinSolFree(sub[s].LS); }
+    if (sub[s].ytemp) { N_VDestroy(sub[s].ytemp); }
+    if (sub[s].yptemp) { N_VDestroy(sub[s].yptemp); }
+    if (sub[s].gtemp) { N_VDestroy(sub[s].gtemp); }
+    if (sub[s].zlocal) { N_VDestroy(sub[s].zlocal); }
+    if (sub[s].rlocal) { N_VDestroy(sub[s].rlocal); }
+    if (sub[s].PP) { SUNMatDestroy(sub[s].PP); }
+  }
+  free(sub);
+}
+
+/*---------------------------------------------------------------
+  IBBDWorkSpace
+
+  This routine sets the real and integer work space sizes of the
+  preconditioner.
+  ---------------------------------------------------------------*/
+static void IBBDWorkSpace(IBBDPrecData pdata)
+{
+  IBBDSubBlock sub;
+  sunindextype lrw1, liw1;
+  long int lrw, liw;
+  int s;
+
+  sub            = pdata->sub;
+  pdata->rpwsize = 0;
+  pdata->ipwsize = 0;
+  if (pdata->tempv1->ops->nvspace)
+  {
+    N_VSpace(pdata->tempv1, &lrw1, &liw1);
+    pdata->rpwsize += (1 + 3 * pdata->nsub) * lrw1;
+    pdata->ipwsize += (1 + 3 * pdata->nsub) * liw1;
+  }
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    if (sub[s].rlocal->ops->nvspace)
+    {
+      N_VSpace(sub[s].rlocal, &lrw1, &liw1);
+      pdata->rpwsize += 2 * lrw1;
+      pdata->ipwsize += 2 * liw1;
+    }
+    if (sub[s].PP->ops->space)
+    {
+      SUNMatSpace(sub[s].PP, &lrw, &liw);
+      pdata->rpwsize += lrw;
+      pdata->ipwsize += liw;
+    }
+    if (sub[s].LS->ops->space)
+    {
+      SUNLinSolSpace(sub[s].LS, &lrw, &liw);
+      pdata->rpwsize += lrw;
+      pdata->ipwsize += liw;
+    }
+  }
+}
+
+/*---------------------------------------------------------------
+  IBBDSubBlockRetval
+
+  This routine combines the return values of the sub-blocks. It
+  returns the first negative (unrecoverable) value if there is one,
+  otherwise the first positive (recoverable) value, and 0 if all
+  sub-blocks succeeded.
+  ---------------------------------------------------------------*/
+static int IBBDSubBlockRetval(IBBDPrecData pdata)
+{
+  int retval, s;
+
+  retval = 0;
+  for (s = 0; s < pdata->nsub; s++)
+  {
+    if (pdata->sub[s].retval < 0) { return (pdata->sub[s].retval); }
+    if (retval == 0) { retval = pdata->sub[s].retval; }
+  }
+
+  return (retval);
 }
 
 /*================================================================
@@ -23,6 +23,7 @@
 #include <idas/idas.h>
 #include <sundials/priv/sundials_context_impl.h>
 
+#include "sundials_jacpolicy_impl.h"
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
 
@@ -115,6 +116,7 @@ typedef struct IDAMemRec
   sunbooleantype ida_user_efun; /* SUNTRUE if user provides efun         */
   IDAEwtFn ida_efun;            /* function to set ewt                   */
   void* ida_edata;              /* user pointer passed to efun           */
+  SUNStepTrace ida_trace;       /* step trace, NULL if disabled          */
 
   sunbooleantype ida_constraintsSet; /* constraints vector present:
                                         do constraints calc                   */
@@ -462,6 +464,10 @@ typedef struct IDAMemRec
   int (*ida_lsolve)(struct IDAMemRec* idamem, N_Vector b, N_Vector weight,
                     N_Vector ycur, N_Vector ypcur, N_Vector rescur);
 
+  int (*ida_lsolvemultiple)(struct IDAMemRec* idamem, int nrhs, N_Vector* b,
+                            N_Vector* weight, N_Vector ycur, N_Vector ypcur,
+                            N_Vector rescur);
+
   int (*ida_lperf)(struct IDAMemRec* idamem, int perftask);
 
   int (*ida_lfree)(struct IDAMemRec* idamem);
@@ -471,6 +477,8 @@ typedef struct IDAMemRec
   void* ida_lmem;      /* linear solver interface structure */
   sunrealtype ida_dcj; /* parameter that determines cj ratio thresholds for calling
                      * the linear solver setup function */
+  sunJacPolicy ida_jpolicy; /* adaptive policy for calling the linear solver
+                               setup function                               */
 
   /* Flag to request a call to the setup routine */
 
@@ -907,6 +915,21 @@ struct IDAadjMemRec
  * -----------------------------------------------------------------
  */
 
+/*
+ * -----------------------------------------------------------------
+ * int (*ida_lsolvemultiple)(IDAMem IDA_mem, int nrhs, N_Vector* b,
+ *                           N_Vector* weight, N_Vector ycur,
+ *                           N_Vector ypcur, N_Vector rescur);
+ * -----------------------------------------------------------------
+ * ida_lsolvemultiple is optional and solves the nrhs linear systems
+ * P x_j = b_j, with weight vectors weight[j], that share the same
+ * matrix P (e.g., the staggered sensitivity systems). It allows
+ * the linear solver to reuse the factorization of P across all
+ * right-hand sides in a single call. The return values are the
+ * same as for ida_lsolve.
+ * -----------------------------------------------------------------
+ */
+
 /*
  * -----------------------------------------------------------------
  * int (*ida_lperf)(IDAMem IDA_mem, int perftask);
@@ -54,6 +54,32 @@ int IDASetDeltaCjLSetup(void* ida_mem, sunrealtype dcj)
 
 /*-----------------------------------------------------------------*/
 
+int IDASetAdaptiveJacEval(void* ida_mem, sunbooleantype onoff)
+{
+  IDAMem IDA_mem;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  if (onoff && !SUN_JACPOLICY_AVAILABLE)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The adaptive policy requires POSIX or Windows timers.");
+    return (IDA_ILL_INPUT);
+  }
+
+  sunJacPolicy_Init(&IDA_mem->ida_jpolicy, onoff);
+
+  return (IDA_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
 int IDASetUserData(void* ida_mem, void* user_data)
 {
   IDAMem IDA_mem;
@@ -354,6 +380,25 @@ int IDASetMinStep(void* ida_mem, sunrealtype hmin)
 
 /*-----------------------------------------------------------------*/
 
+int IDASetStepTrace(void* ida_mem, SUNStepTrace trace)
+{
+  IDAMem IDA_mem;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  IDA_mem->ida_trace = trace;
+
+  return (IDA_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
 int IDASetStopTime(void* ida_mem, sunrealtype tstop)
 {
   IDAMem IDA_mem;
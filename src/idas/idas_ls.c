@@ -186,10 +186,11 @@ int IDASetLinearSolver(void* ida_mem, SUNLinearSolver LS, SUNMatrix A)
   if (IDA_mem->ida_lfree) { IDA_mem->ida_lfree(IDA_mem); }
 
   /* Set four main system linear solver function fields in IDA_mem */
-  IDA_mem->ida_linit  = idaLsInitialize;
-  IDA_mem->ida_lsetup = idaLsSetup;
-  IDA_mem->ida_lsolve = idaLsSolve;
-  IDA_mem->ida_lfree  = idaLsFree;
+  IDA_mem->ida_linit          = idaLsInitialize;
+  IDA_mem->ida_lsetup         = idaLsSetup;
+  IDA_mem->ida_lsolve         = idaLsSolve;
+  IDA_mem->ida_lsolvemultiple = idaLsSolveMultiple;
+  IDA_mem->ida_lfree          = idaLsFree;
 
   /* Set ida_lperf if using an iterative SUNLinearSolver object */
   IDA_mem->ida_lperf = (iterative) ? idaLsPerf : NULL;
@@ -245,6 +246,7 @@ int IDASetLinearSolver(void* ida_mem, SUNLinearSolver LS, SUNMatrix A)
   idals_mem->eplifac   = PT05;
   idals_mem->dqincfac  = ONE;
   idals_mem->last_flag = IDALS_SUCCESS;
+  sunDQThreads_Init(&idals_mem->dqthreads);
 
   /* If LS supports ATimes, attach IDALs routine */
   if (LS->ops->setatimes)
@@ -465,6 +467,26 @@ int IDASetIncrementFactor(void* ida_mem, sunrealtype dqincfac)
   return (IDALS_SUCCESS);
 }
 
+/* IDASetDQJacNumThreads sets the number of threads used to evaluate the
+   columns of the internal dense or band DQ Jacobian. With more than one
+   thread the residual function is called concurrently with the same (shared)
+   user_data pointer and must be thread-safe. */
+int IDASetDQJacNumThreads(void* ida_mem, int nthreads)
+{
+  IDAMem IDA_mem;
+  IDALsMem idals_mem;
+  int retval;
+
+  /* access IDALsMem structure */
+  retval = idaLs_AccessLMem(ida_mem, __func__, &IDA_mem, &idals_mem);
+  if (retval != IDALS_SUCCESS) { return (retval); }
+
+  /* values < 2 select the serial approximation */
+  sunDQThreads_SetNumThreads(&idals_mem->dqthreads, nthreads);
+
+  return (IDALS_SUCCESS);
+}
+
 /* IDASetPreconditioner specifies the user-supplied psetup and psolve routines */
 int IDASetPreconditioner(void* ida_mem, IDALsPrecSetupFn psetup,
                          IDALsPrecSolveFn psolve)
@@ -931,7 +953,7 @@ int idaLsDQJac(sunrealtype t, sunrealtype c_j, N_Vector y, N_Vector yp,
                N_Vector r, SUNMatrix Jac, void* ida_mem, N_Vector tmp1,
                N_Vector tmp2, N_Vector tmp3)
 {
-  int retval;
+  int retval, nthreads;
   IDAMem IDA_mem;
   IDA_mem = (IDAMem)ida_mem;
 
@@ -964,11 +986,22 @@ int idaLsDQJac(sunrealtype t, sunrealtype c_j, N_Vector y, N_Vector yp,
     return (IDALS_ILL_INPUT);
   }
 
+  /* Number of threads for the dense and band approximations */
+  nthreads = ((IDALsMem)IDA_mem->ida_lmem)->dqthreads.nthreads;
+
   /* Call the matrix-structure-specific DQ approximation routine */
-  if (SUNMatGetID(Jac) == SUNMATRIX_DENSE)
+  if (SUNMatGetID(Jac) == SUNMATRIX_DENSE && nthreads > 1)
+  {
+    retval = idaLsDenseDQJacThreaded(t, c_j, y, yp, r, Jac, IDA_mem);
+  }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_DENSE)
   {
     retval = idaLsDenseDQJac(t, c_j, y, yp, r, Jac, IDA_mem, tmp1);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BAND && nthreads > 1)
+  {
+    retval = idaLsBandDQJacThreaded(t, c_j, y, yp, r, Jac, IDA_mem);
+  }
   else if (SUNMatGetID(Jac) == SUNMATRIX_BAND)
   {
     retval = idaLsBandDQJac(t, c_j, y, yp, r, Jac, IDA_mem, tmp1, tmp2, tmp3);
@@ -1229,6 +1262,288 @@ int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  idaLsDenseDQJacThreaded
+
+  This routine generates the same dense difference quotient
+  approximation as idaLsDenseDQJac with the columns distributed
+  over the threads set by IDASetDQJacNumThreads. Thread s perturbs
+  its own copies of yy and yp and computes the columns s,
+  s + nthreads, ... so the residual function is called
+  concurrently.
+---------------------------------------------------------------*/
+int idaLsDenseDQJacThreaded(sunrealtype tt, sunrealtype c_j, N_Vector yy,
+                            N_Vector yp, N_Vector rr, SUNMatrix Jac,
+                            IDAMem IDA_mem)
+{
+  sunrealtype srur;
+  sunrealtype *y_data, *yp_data, *r_data, *ewt_data, *cns_data = NULL;
+  sunindextype N;
+  sunDQThread* thread;
+  IDALsMem idals_mem;
+  int nthreads, s;
+
+  /* access LsMem interface structure */
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+
+  /* access matrix dimension */
+  N = SUNDenseMatrix_Columns(Jac);
+
+  /* Allocate the work vectors of each thread (on first use) */
+  if (sunDQThreads_Alloc(&idals_mem->dqthreads, yy, SUNTRUE))
+  {
+    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (IDALS_MEM_FAIL);
+  }
+  nthreads = idals_mem->dqthreads.nthreads;
+  thread   = idals_mem->dqthreads.thread;
+
+  /* Obtain pointers to the data for ewt, yy, yp, rr. */
+  ewt_data = N_VGetArrayPointer(IDA_mem->ida_ewt);
+  y_data   = N_VGetArrayPointer(yy);
+  yp_data  = N_VGetArrayPointer(yp);
+  r_data   = N_VGetArrayPointer(rr);
+  if (IDA_mem->ida_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(IDA_mem->ida_constraints);
+  }
+
+  /* Load each ytemp and yptemp with yy and yp */
+  for (s = 0; s < nthreads; s++)
+  {
+    N_VScale(ONE, yy, thread[s].ytemp);
+    N_VScale(ONE, yp, thread[s].yptemp);
+  }
+
+  srur = SUNRsqrt(IDA_mem->ida_uround);
+
+  /* Loop over the columns assigned to each thread */
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < nthreads; s++)
+  {
+    sunrealtype inc, inc_inv, yj, ypj, conj;
+    sunrealtype *ytemp_data, *yptemp_data, *rtemp_data, *col_j;
+    sunindextype i, j;
+
+    ytemp_data       = N_VGetArrayPointer(thread[s].ytemp);
+    yptemp_data      = N_VGetArrayPointer(thread[s].yptemp);
+    rtemp_data       = N_VGetArrayPointer(thread[s].ftemp);
+    thread[s].nfe    = 0;
+    thread[s].retval = 0;
+
+    for (j = s; j < N; j += nthreads)
+    {
+      yj  = y_data[j];
+      ypj = yp_data[j];
+
+      /* Set increment inc to y_j exactly as in idaLsDenseDQJac. */
+      inc = SUNMAX(srur * SUNMAX(SUNRabs(yj), SUNRabs(IDA_mem->ida_hh * ypj)),
+                   ONE / ewt_data[j]);
+
+      if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
+      inc = (yj + inc) - yj;
+
+      /* Adjust sign(inc) again if y_j has an inequality constraint. */
+      if (IDA_mem->ida_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((yj + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      /* Increment y_j and yp_j, call res, and break on error return. */
+      ytemp_data[j] += inc;
+      yptemp_data[j] += c_j * inc;
+
+      thread[s].retval = IDA_mem->ida_res(tt, thread[s].ytemp,
+                                          thread[s].yptemp, thread[s].ftemp,
+                                          IDA_mem->ida_user_data);
+      thread[s].nfe++;
+      if (thread[s].retval != 0) { break; }
+
+      /* Construct difference quotient in the jth column */
+      inc_inv = ONE / inc;
+      col_j   = SUNDenseMatrix_Column(Jac, j);
+      for (i = 0; i < N; i++)
+      {
+        col_j[i] = inc_inv * (rtemp_data[i] - r_data[i]);
+      }
+
+      /*  reset y_j, yp_j */
+      ytemp_data[j]  = yj;
+      yptemp_data[j] = ypj;
+    }
+  }
+
+  return (sunDQThreads_Finalize(&idals_mem->dqthreads, &idals_mem->nreDQ));
+}
+
+/*---------------------------------------------------------------
+  idaLsBandDQJacThreaded
+
+  This routine generates the same banded difference quotient
+  approximation as idaLsBandDQJac with the column groups
+  distributed over the threads set by IDASetDQJacNumThreads.
+  Thread s perturbs its own copies of yy and yp and computes the
+  groups s + 1, s + 1 + nthreads, ... so the residual function is
+  called concurrently.
+  ---------------------------------------------------------------*/
+int idaLsBandDQJacThreaded(sunrealtype tt, sunrealtype c_j, N_Vector yy,
+                           N_Vector yp, N_Vector rr, SUNMatrix Jac,
+                           IDAMem IDA_mem)
+{
+  sunrealtype srur;
+  sunrealtype *y_data, *yp_data, *r_data, *ewt_data, *cns_data = NULL;
+  sunindextype width, ngroups, N, mupper, mlower;
+  sunDQThread* thread;
+  IDALsMem idals_mem;
+  int nthreads, s;
+
+  /* access LsMem interface structure */
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+
+  /* access matrix dimensions */
+  N      = SUNBandMatrix_Columns(Jac);
+  mupper = SUNBandMatrix_UpperBandwidth(Jac);
+  mlower = SUNBandMatrix_LowerBandwidth(Jac);
+
+  /* Allocate the work vectors of each thread (on first use) */
+  if (sunDQThreads_Alloc(&idals_mem->dqthreads, yy, SUNTRUE))
+  {
+    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (IDALS_MEM_FAIL);
+  }
+  nthreads = idals_mem->dqthreads.nthreads;
+  thread   = idals_mem->dqthreads.thread;
+
+  /* Obtain pointers to the data for ewt, rr, yy, yp. */
+  ewt_data = N_VGetArrayPointer(IDA_mem->ida_ewt);
+  r_data   = N_VGetArrayPointer(rr);
+  y_data   = N_VGetArrayPointer(yy);
+  yp_data  = N_VGetArrayPointer(yp);
+  if (IDA_mem->ida_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(IDA_mem->ida_constraints);
+  }
+
+  /* Initialize each ytemp and yptemp. */
+  for (s = 0; s < nthreads; s++)
+  {
+    N_VScale(ONE, yy, thread[s].ytemp);
+    N_VScale(ONE, yp, thread[s].yptemp);
+  }
+
+  /* Compute miscellaneous values for the Jacobian computation. */
+  srur    = SUNRsqrt(IDA_mem->ida_uround);
+  width   = mlower + mupper + 1;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over the column groups assigned to each thread */
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < nthreads; s++)
+  {
+    sunrealtype inc, inc_inv, yj, ypj, conj, ewtj;
+    sunrealtype *ytemp_data, *yptemp_data, *rtemp_data, *col_j;
+    sunindextype group, i, j, i1, i2;
+
+    ytemp_data       = N_VGetArrayPointer(thread[s].ytemp);
+    yptemp_data      = N_VGetArrayPointer(thread[s].yptemp);
+    rtemp_data       = N_VGetArrayPointer(thread[s].ftemp);
+    thread[s].nfe    = 0;
+    thread[s].retval = 0;
+
+    for (group = s + 1; group <= ngroups; group += nthreads)
+    {
+      /* Increment all yy[j] and yp[j] for j in this group. */
+      for (j = group - 1; j < N; j += width)
+      {
+        yj   = y_data[j];
+        ypj  = yp_data[j];
+        ewtj = ewt_data[j];
+
+        /* Set increment inc to yj exactly as in idaLsBandDQJac. */
+        inc = SUNMAX(srur * SUNMAX(SUNRabs(yj), SUNRabs(IDA_mem->ida_hh * ypj)),
+                     ONE / ewtj);
+        if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
+        inc = (yj + inc) - yj;
+
+        /* Adjust sign(inc) again if yj has an inequality constraint. */
+        if (IDA_mem->ida_constraintsSet)
+        {
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          }
+        }
+
+        /* Increment yj and ypj. */
+        ytemp_data[j] += inc;
+        yptemp_data[j] += c_j * inc;
+      }
+
+      /* Call res routine with incremented arguments. */
+      thread[s].retval = IDA_mem->ida_res(tt, thread[s].ytemp,
+                                          thread[s].yptemp, thread[s].ftemp,
+                                          IDA_mem->ida_user_data);
+      thread[s].nfe++;
+      if (thread[s].retval != 0) { break; }
+
+      /* Loop over the indices j in this group again. */
+      for (j = group - 1; j < N; j += width)
+      {
+        /* Reset ytemp and yptemp components that were perturbed. */
+        yj = ytemp_data[j] = y_data[j];
+        ypj = yptemp_data[j] = yp_data[j];
+        col_j                = SUNBandMatrix_Column(Jac, j);
+        ewtj                 = ewt_data[j];
+
+        /* Set increment inc exactly as above. */
+        inc = SUNMAX(srur * SUNMAX(SUNRabs(yj), SUNRabs(IDA_mem->ida_hh * ypj)),
+                     ONE / ewtj);
+        if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
+        inc = (yj + inc) - yj;
+        if (IDA_mem->ida_constraintsSet)
+        {
+          conj = cns_data[j];
+          if (SUNRabs(conj) == ONE)
+          {
+            if ((yj + inc) * conj < ZERO) { inc = -inc; }
+          }
+          else if (SUNRabs(conj) == TWO)
+          {
+            if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+          }
+        }
+
+        /* Load the difference quotient Jacobian elements for column j */
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(0, j - mupper);
+        i2      = SUNMIN(j + mlower, N - 1);
+        for (i = i1; i <= i2; i++)
+        {
+          SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv *
+                                             (rtemp_data[i] - r_data[i]);
+        }
+      }
+    }
+  }
+
+  return (sunDQThreads_Finalize(&idals_mem->dqthreads, &idals_mem->nreDQ));
+}
+
 /*---------------------------------------------------------------
   idaLsDQJtimes
 
@@ -1664,6 +1979,88 @@ int idaLsSolve(IDAMem IDA_mem, N_Vector b, N_Vector weight, N_Vector ycur,
   return (0);
 }
 
+/*---------------------------------------------------------------
+ idaLsSolveMultiple: solves several linear systems that share the
+ current matrix, e.g., the staggered sensitivity systems. With a
+ direct linear solver that provides SUNLinSolSolveMultiple all
+ right-hand sides are passed to the solver at once (in place);
+ otherwise, each system is solved in turn with idaLsSolve since
+ iterative solvers use a tolerance and scaling specific to each
+ right-hand side.
+---------------------------------------------------------------*/
+int idaLsSolveMultiple(IDAMem IDA_mem, int nrhs, N_Vector* b, N_Vector* weight,
+                       N_Vector ycur, N_Vector ypcur, N_Vector rescur)
+{
+  IDALsMem idals_mem;
+  int j, retval;
+
+  /* access IDALsMem structure */
+  if (IDA_mem->ida_lmem == NULL)
+  {
+    IDAProcessError(IDA_mem, IDALS_LMEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_LS_LMEM_NULL);
+    return (IDALS_LMEM_NULL);
+  }
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+
+  /* solve the systems one at a time if necessary */
+  if (idals_mem->iterative || (idals_mem->LS->ops->solvemultiple == NULL))
+  {
+    for (j = 0; j < nrhs; j++)
+    {
+      retval = idaLsSolve(IDA_mem, b[j], weight[j], ycur, ypcur, rescur);
+      if (retval != 0) { return (retval); }
+    }
+    return (0);
+  }
+
+  SUNLogInfo(IDA_LOGGER, "begin-linear-solve", "iterative = 0, nrhs = %i",
+             nrhs);
+
+  /* Set vectors ycur, ypcur and rcur for consistency with idaLsSolve */
+  idals_mem->ycur  = ycur;
+  idals_mem->ypcur = ypcur;
+  idals_mem->rcur  = rescur;
+
+  /* Call solver, overwriting each b with its solution */
+  retval = SUNLinSolSolveMultiple(idals_mem->LS, idals_mem->J, nrhs, b, b, ZERO);
+
+  /* Scale the corrections to account for change in cj */
+  if (idals_mem->scalesol && (IDA_mem->ida_cjratio != ONE))
+  {
+    for (j = 0; j < nrhs; j++)
+    {
+      N_VScale(TWO / (ONE + IDA_mem->ida_cjratio), b[j], b[j]);
+    }
+  }
+
+  /* Increment ncfl counter */
+  if (retval != SUN_SUCCESS) { idals_mem->ncfl++; }
+
+  /* Interpret solver return value  */
+  idals_mem->last_flag = retval;
+
+  SUNLogInfoIf(retval == SUN_SUCCESS, IDA_LOGGER, "end-linear-solve",
+               "status = success");
+  SUNLogInfoIf(retval != SUN_SUCCESS, IDA_LOGGER, "end-linear-solve",
+               "status = failed, retval = %i", retval);
+
+  switch (retval)
+  {
+  case SUN_SUCCESS: return (0); break;
+  case SUNLS_PACKAGE_FAIL_REC:
+  case SUNLS_QRFACT_FAIL:
+  case SUNLS_LUFACT_FAIL: return (1); break;
+  case SUN_ERR_EXT_FAIL:
+    IDAProcessError(IDA_mem, SUN_ERR_EXT_FAIL, __LINE__, __func__, __FILE__,
+                    "Failure in SUNLinSol external package");
+    return (-1);
+    break;
+  }
+
+  return ((retval > 0) ? 1 : -1);
+}
+
 /*---------------------------------------------------------------
  idaLsPerf: accumulates performance statistics information
  for IDA
@@ -1758,6 +2155,9 @@ int idaLsFree(IDAMem IDA_mem)
     idals_mem->x = NULL;
   }
 
+  /* Free threaded DQ Jacobian work vectors */
+  sunDQThreads_Free(&idals_mem->dqthreads);
+
   /* Nullify other N_Vector pointers */
   idals_mem->ycur  = NULL;
   idals_mem->ypcur = NULL;
@@ -293,10 +293,20 @@ static int idaNlsLSetupSensSim(SUNDIALS_MAYBE_UNUSED sunbooleantype jbad,
   IDA_mem->ida_nsetups++;
   IDA_mem->ida_forceSetup = SUNFALSE;
 
+  if (IDA_mem->ida_jpolicy.enabled)
+  {
+    sunJacPolicy_BeginSetup(&IDA_mem->ida_jpolicy);
+  }
+
   retval = IDA_mem->ida_lsetup(IDA_mem, IDA_mem->ida_yy, IDA_mem->ida_yp,
                                IDA_mem->ida_savres, IDA_mem->ida_tempv1,
                                IDA_mem->ida_tempv2, IDA_mem->ida_tempv3);
 
+  if (IDA_mem->ida_jpolicy.enabled)
+  {
+    sunJacPolicy_EndSetup(&IDA_mem->ida_jpolicy, SUNTRUE);
+  }
+
   /* update Jacobian status */
   *jcur = SUNTRUE;
 
@@ -315,7 +325,7 @@ static int idaNlsLSetupSensSim(SUNDIALS_MAYBE_UNUSED sunbooleantype jbad,
 static int idaNlsLSolveSensSim(N_Vector deltaSim, void* ida_mem)
 {
   IDAMem IDA_mem;
-  int retval, is;
+  int retval, is, curiter;
   N_Vector delta;
   N_Vector* deltaS;
 
@@ -326,6 +336,13 @@ static int idaNlsLSolveSensSim(N_Vector deltaSim, void* ida_mem)
   }
   IDA_mem = (IDAMem)ida_mem;
 
+  /* Update the measured Newton iteration cost */
+  if (IDA_mem->ida_jpolicy.enabled)
+  {
+    (void)SUNNonlinSolGetCurIter(IDA_mem->NLSsim, &curiter);
+    sunJacPolicy_Solve(&IDA_mem->ida_jpolicy, curiter);
+  }
+
   /* extract state update vector from the vector wrapper */
   delta = NV_VEC_SW(deltaSim, 0);
 
@@ -339,7 +356,19 @@ static int idaNlsLSolveSensSim(N_Vector deltaSim, void* ida_mem)
   /* extract sensitivity deltas from the vector wrapper */
   deltaS = NV_VECS_SW(deltaSim) + 1;
 
-  /* solve the sensitivity linear systems */
+  /* solve the sensitivity linear systems, all at once if possible */
+  if (IDA_mem->ida_lsolvemultiple)
+  {
+    retval = IDA_mem->ida_lsolvemultiple(IDA_mem, IDA_mem->ida_Ns, deltaS,
+                                         IDA_mem->ida_ewtS, IDA_mem->ida_yy,
+                                         IDA_mem->ida_yp, IDA_mem->ida_savres);
+
+    if (retval < 0) { return (IDA_LSOLVE_FAIL); }
+    if (retval > 0) { return (IDA_LSOLVE_RECVR); }
+
+    return (IDA_SUCCESS);
+  }
+
   for (is = 0; is < IDA_mem->ida_Ns; is++)
   {
     retval = IDA_mem->ida_lsolve(IDA_mem, deltaS[is], IDA_mem->ida_ewtS[is],
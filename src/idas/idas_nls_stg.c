@@ -246,10 +246,20 @@ static int idaNlsLSetupSensStg(SUNDIALS_MAYBE_UNUSED sunbooleantype jbad,
 
   IDA_mem->ida_nsetupsS++;
 
+  if (IDA_mem->ida_jpolicy.enabled)
+  {
+    sunJacPolicy_BeginSetup(&IDA_mem->ida_jpolicy);
+  }
+
   retval = IDA_mem->ida_lsetup(IDA_mem, IDA_mem->ida_yy, IDA_mem->ida_yp,
                                IDA_mem->ida_delta, IDA_mem->ida_tmpS1,
                                IDA_mem->ida_tmpS2, IDA_mem->ida_tmpS3);
 
+  if (IDA_mem->ida_jpolicy.enabled)
+  {
+    sunJacPolicy_EndSetup(&IDA_mem->ida_jpolicy, SUNTRUE);
+  }
+
   /* update Jacobian status */
   *jcur = SUNTRUE;
 
@@ -268,7 +278,7 @@ static int idaNlsLSetupSensStg(SUNDIALS_MAYBE_UNUSED sunbooleantype jbad,
 static int idaNlsLSolveSensStg(N_Vector deltaStg, void* ida_mem)
 {
   IDAMem IDA_mem;
-  int retval, is;
+  int retval, is, curiter;
 
   if (ida_mem == NULL)
   {
@@ -277,6 +287,27 @@ static int idaNlsLSolveSensStg(N_Vector deltaStg, void* ida_mem)
   }
   IDA_mem = (IDAMem)ida_mem;
 
+  /* Update the measured Newton iteration cost */
+  if (IDA_mem->ida_jpolicy.enabled)
+  {
+    (void)SUNNonlinSolGetCurIter(IDA_mem->NLSstg, &curiter);
+    sunJacPolicy_Solve(&IDA_mem->ida_jpolicy, curiter);
+  }
+
+  /* solve the sensitivity linear systems, all at once if possible */
+  if (IDA_mem->ida_lsolvemultiple)
+  {
+    retval = IDA_mem->ida_lsolvemultiple(IDA_mem, IDA_mem->ida_Ns,
+                                         NV_VECS_SW(deltaStg),
+                                         IDA_mem->ida_ewtS, IDA_mem->ida_yy,
+                                         IDA_mem->ida_yp, IDA_mem->ida_delta);
+
+    if (retval < 0) { return (IDA_LSOLVE_FAIL); }
+    if (retval > 0) { return (IDA_LSOLVE_RECVR); }
+
+    return (IDA_SUCCESS);
+  }
+
   for (is = 0; is < IDA_mem->ida_Ns; is++)
   {
     retval = IDA_mem->ida_lsolve(IDA_mem, NV_VEC_SW(deltaStg, is),
@@ -124,10 +124,13 @@ module fkinsol_mod
  public :: FKINSetJacFn
  public :: FKINSetPreconditioner
  public :: FKINSetJacTimesVecFn
+ public :: FKINSetMaxBroydenUpdates
+ public :: FKINSetDQJacNumThreads
  public :: FKINGetJac
  public :: FKINGetJacNumIters
  public :: FKINGetLinWorkSpace
  public :: FKINGetNumJacEvals
+ public :: FKINGetNumBroydenUpdates
  public :: FKINGetNumLinFuncEvals
  public :: FKINGetNumPrecEvals
  public :: FKINGetNumPrecSolves
@@ -599,6 +602,24 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FKINSetMaxBroydenUpdates(farg1, farg2) &
+bind(C, name="_wrap_FKINSetMaxBroydenUpdates") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FKINSetDQJacNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FKINSetDQJacNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FKINGetJac(farg1, farg2) &
 bind(C, name="_wrap_FKINGetJac") &
 result(fresult)
@@ -636,6 +657,15 @@ type(C_PTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FKINGetNumBroydenUpdates(farg1, farg2) &
+bind(C, name="_wrap_FKINGetNumBroydenUpdates") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FKINGetNumLinFuncEvals(farg1, farg2) &
 bind(C, name="_wrap_FKINGetNumLinFuncEvals") &
 result(fresult)
@@ -1553,6 +1583,38 @@ fresult = swigc_FKINSetJacTimesVecFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FKINSetMaxBroydenUpdates(kinmem, maxupd) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: kinmem
+integer(C_INT), intent(in) :: maxupd
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = kinmem
+farg2 = maxupd
+fresult = swigc_FKINSetMaxBroydenUpdates(farg1, farg2)
+swig_result = fresult
+end function
+
+function FKINSetDQJacNumThreads(kinmem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: kinmem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = kinmem
+farg2 = nthreads
+fresult = swigc_FKINSetDQJacNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
 function FKINGetJac(kinmem, j) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -1620,6 +1682,22 @@ fresult = swigc_FKINGetNumJacEvals(farg1, farg2)
 swig_result = fresult
 end function
 
+function FKINGetNumBroydenUpdates(kinmem, nbroy) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: kinmem
+integer(C_LONG), dimension(*), target, intent(inout) :: nbroy
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = kinmem
+farg2 = c_loc(nbroy(1))
+fresult = swigc_FKINGetNumBroydenUpdates(farg1, farg2)
+swig_result = fresult
+end function
+
 function FKINGetNumLinFuncEvals(kinmem, nfevals) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -223,7 +223,7 @@ void* KINCreate(SUNContext sunctx)
   }
 
   kin_mem = NULL;
-  kin_mem = (KINMem)malloc(sizeof(struct KINMemRec));
+  kin_mem = (KINMem)SUNContext_ArenaAlloc(sunctx, sizeof(struct KINMemRec));
   if (kin_mem == NULL)
   {
     KINProcessError(kin_mem, 0, __LINE__, __func__, __FILE__, MSG_MEM_FAIL);
@@ -382,7 +382,7 @@ int KINInit(void* kinmem, KINSysFn func, N_Vector tmpl)
   {
     KINProcessError(kin_mem, KIN_MEM_FAIL, __LINE__, __func__, __FILE__,
                     MSG_MEM_FAIL);
-    free(kin_mem);
+    SUNContext_ArenaFree(kin_mem->kin_sunctx, kin_mem);
     kin_mem = NULL;
     SUNDIALS_MARK_FUNCTION_END(KIN_PROFILER);
     return (KIN_MEM_FAIL);
@@ -804,7 +804,7 @@ void KINFree(void** kinmem)
 
   if (kin_mem->kin_lfree != NULL) { kin_mem->kin_lfree(kin_mem); }
 
-  free(*kinmem);
+  SUNContext_ArenaFree(kin_mem->kin_sunctx, kin_mem);
   *kinmem = NULL;
 }
 
@@ -180,6 +180,8 @@ int KINSetLinearSolver(void* kinmem, SUNLinearSolver LS, SUNMatrix A)
 
   /* Set default values for the rest of the LS parameters */
   kinls_mem->last_flag = KINLS_SUCCESS;
+  sunBroyden_Init(&kinls_mem->broyden);
+  sunDQThreads_Init(&kinls_mem->dqthreads);
 
   /* If LS supports ATimes, attach KINLs routine */
   if (LS->ops->setatimes)
@@ -375,6 +377,57 @@ int KINSetJacTimesVecSysFn(void* kinmem, KINSysFn jtimesSysFn)
   return (KINLS_SUCCESS);
 }
 
+/* KINSetMaxBroydenUpdates sets the maximum number of Broyden updates applied
+   to the Jacobian between setups */
+int KINSetMaxBroydenUpdates(void* kinmem, int maxupd)
+{
+  int retval;
+  KINMem kin_mem     = NULL;
+  KINLsMem kinls_mem = NULL;
+
+  /* access KINLsMem structure */
+  retval = kinLs_AccessLMem(kinmem, __func__, &kin_mem, &kinls_mem);
+  if (retval != KIN_SUCCESS) { return (retval); }
+
+  /* the updates require exact solves with the Jacobian */
+  if (maxupd > 0 && kinls_mem->iterative)
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Broyden updates require a direct linear solver.");
+    return (KINLS_ILL_INPUT);
+  }
+
+  /* allocate (or free) the update vectors */
+  if (sunBroyden_Alloc(&kinls_mem->broyden, maxupd, kin_mem->kin_vtemp1))
+  {
+    KINProcessError(kin_mem, KINLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (KINLS_MEM_FAIL);
+  }
+
+  return (KINLS_SUCCESS);
+}
+
+/* KINSetDQJacNumThreads sets the number of threads used to evaluate the
+   columns of the internal dense or band DQ Jacobian. With more than one
+   thread the system function is called concurrently with the same (shared)
+   user_data pointer and must be thread-safe. */
+int KINSetDQJacNumThreads(void* kinmem, int nthreads)
+{
+  int retval;
+  KINMem kin_mem     = NULL;
+  KINLsMem kinls_mem = NULL;
+
+  /* access KINLsMem structure */
+  retval = kinLs_AccessLMem(kinmem, __func__, &kin_mem, &kinls_mem);
+  if (retval != KIN_SUCCESS) { return (retval); }
+
+  /* values < 2 select the serial approximation */
+  sunDQThreads_SetNumThreads(&kinls_mem->dqthreads, nthreads);
+
+  return (KINLS_SUCCESS);
+}
+
 /*==================================================================
   Optional Get routines
   ==================================================================*/
@@ -462,6 +515,22 @@ int KINGetNumJacEvals(void* kinmem, long int* njevals)
   return (KINLS_SUCCESS);
 }
 
+/*------------------------------------------------------------------
+  KINGetNumBroydenUpdates returns the number of Broyden updates
+  ------------------------------------------------------------------*/
+int KINGetNumBroydenUpdates(void* kinmem, long int* nbroy)
+{
+  KINMem kin_mem;
+  KINLsMem kinls_mem;
+  int retval;
+
+  /* access KINLsMem structure; set output value and return */
+  retval = kinLs_AccessLMem(kinmem, __func__, &kin_mem, &kinls_mem);
+  if (retval != KIN_SUCCESS) { return (retval); }
+  *nbroy = kinls_mem->broyden.nbroy;
+  return (KINLS_SUCCESS);
+}
+
 /*------------------------------------------------------------------
   KINGetNumPrecEvals returns the total number of preconditioner
   evaluations
@@ -711,7 +780,7 @@ int kinLsDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, void* kinmem,
                N_Vector tmp1, N_Vector tmp2)
 {
   KINMem kin_mem;
-  int retval;
+  int retval, nthreads;
 
   /* access KINMem structure */
   if (kinmem == NULL)
@@ -730,11 +799,22 @@ int kinLsDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, void* kinmem,
     return (KINLS_LMEM_NULL);
   }
 
+  /* Number of threads for the dense and band approximations */
+  nthreads = ((KINLsMem)kin_mem->kin_lmem)->dqthreads.nthreads;
+
   /* Call the matrix-structure-specific DQ approximation routine */
-  if (SUNMatGetID(Jac) == SUNMATRIX_DENSE)
+  if (SUNMatGetID(Jac) == SUNMATRIX_DENSE && nthreads > 1)
+  {
+    retval = kinLsDenseDQJacThreaded(u, fu, Jac, kin_mem);
+  }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_DENSE)
   {
     retval = kinLsDenseDQJac(u, fu, Jac, kin_mem, tmp1, tmp2);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BAND && nthreads > 1)
+  {
+    retval = kinLsBandDQJacThreaded(u, fu, Jac, kin_mem);
+  }
   else if (SUNMatGetID(Jac) == SUNMATRIX_BAND)
   {
     retval = kinLsBandDQJac(u, fu, Jac, kin_mem, tmp1, tmp2);
@@ -923,6 +1003,194 @@ int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
   return (0);
 }
 
+/*------------------------------------------------------------------
+  kinLsDenseDQJacThreaded
+
+  This routine generates the same dense difference quotient
+  approximation as kinLsDenseDQJac with the columns distributed over
+  the threads set by KINSetDQJacNumThreads. Thread s perturbs its
+  own copy of u and computes the columns s, s + nthreads, ... so the
+  system function is called concurrently.
+  ------------------------------------------------------------------*/
+int kinLsDenseDQJacThreaded(N_Vector u, N_Vector fu, SUNMatrix Jac,
+                            KINMem kin_mem)
+{
+  sunrealtype *u_data, *fu_data, *uscale_data;
+  sunindextype N;
+  sunDQThread* thread;
+  KINLsMem kinls_mem;
+  int nthreads, s;
+
+  /* access LsMem interface structure */
+  kinls_mem = (KINLsMem)kin_mem->kin_lmem;
+
+  /* access matrix dimension */
+  N = SUNDenseMatrix_Columns(Jac);
+
+  /* Allocate the work vectors of each thread (on first use) */
+  if (sunDQThreads_Alloc(&kinls_mem->dqthreads, u, SUNFALSE))
+  {
+    KINProcessError(kin_mem, KINLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (KINLS_MEM_FAIL);
+  }
+  nthreads = kinls_mem->dqthreads.nthreads;
+  thread   = kinls_mem->dqthreads.thread;
+
+  /* Obtain pointers to the data for u, fu and uscale */
+  u_data      = N_VGetArrayPointer(u);
+  fu_data     = N_VGetArrayPointer(fu);
+  uscale_data = N_VGetArrayPointer(kin_mem->kin_uscale);
+
+  /* Load each utemp with u */
+  for (s = 0; s < nthreads; s++) { N_VScale(ONE, u, thread[s].ytemp); }
+
+  /* Loop over the columns assigned to each thread */
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < nthreads; s++)
+  {
+    sunrealtype inc, inc_inv, ujsaved, ujscale, sign;
+    sunrealtype *utemp_data, *ftemp_data, *col_j;
+    sunindextype i, j;
+
+    utemp_data       = N_VGetArrayPointer(thread[s].ytemp);
+    ftemp_data       = N_VGetArrayPointer(thread[s].ftemp);
+    thread[s].nfe    = 0;
+    thread[s].retval = 0;
+
+    for (j = s; j < N; j += nthreads)
+    {
+      ujsaved = u_data[j];
+      ujscale = ONE / uscale_data[j];
+
+      /* Compute increment */
+      sign = (ujsaved >= ZERO) ? ONE : -ONE;
+      inc  = kin_mem->kin_sqrt_relfunc * SUNMAX(SUNRabs(ujsaved), ujscale) *
+            sign;
+
+      /* Increment u_j, call F(u), and return if error occurs */
+      utemp_data[j] += inc;
+
+      thread[s].retval = kin_mem->kin_func(thread[s].ytemp, thread[s].ftemp,
+                                           kin_mem->kin_user_data);
+      thread[s].nfe++;
+      if (thread[s].retval != 0) { break; }
+
+      /* reset u_j */
+      utemp_data[j] = ujsaved;
+
+      /* Construct difference quotient in the jth column */
+      inc_inv = ONE / inc;
+      col_j   = SUNDenseMatrix_Column(Jac, j);
+      for (i = 0; i < N; i++)
+      {
+        col_j[i] = inc_inv * (ftemp_data[i] - fu_data[i]);
+      }
+    }
+  }
+
+  return (sunDQThreads_Finalize(&kinls_mem->dqthreads, &kinls_mem->nfeDQ));
+}
+
+/*------------------------------------------------------------------
+  kinLsBandDQJacThreaded
+
+  This routine generates the same banded difference quotient
+  approximation as kinLsBandDQJac with the column groups distributed
+  over the threads set by KINSetDQJacNumThreads. Thread s perturbs
+  its own copy of u and computes the groups s + 1, s + 1 + nthreads,
+  ... so the system function is called concurrently.
+  ------------------------------------------------------------------*/
+int kinLsBandDQJacThreaded(N_Vector u, N_Vector fu, SUNMatrix Jac,
+                           KINMem kin_mem)
+{
+  sunrealtype *fu_data, *u_data, *uscale_data;
+  sunindextype width, ngroups, N, mupper, mlower;
+  sunDQThread* thread;
+  KINLsMem kinls_mem;
+  int nthreads, s;
+
+  /* access LsMem interface structure */
+  kinls_mem = (KINLsMem)kin_mem->kin_lmem;
+
+  /* access matrix dimensions */
+  N      = SUNBandMatrix_Columns(Jac);
+  mupper = SUNBandMatrix_UpperBandwidth(Jac);
+  mlower = SUNBandMatrix_LowerBandwidth(Jac);
+
+  /* Allocate the work vectors of each thread (on first use) */
+  if (sunDQThreads_Alloc(&kinls_mem->dqthreads, u, SUNFALSE))
+  {
+    KINProcessError(kin_mem, KINLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (KINLS_MEM_FAIL);
+  }
+  nthreads = kinls_mem->dqthreads.nthreads;
+  thread   = kinls_mem->dqthreads.thread;
+
+  /* Obtain pointers to the data for fu, u and uscale */
+  fu_data     = N_VGetArrayPointer(fu);
+  u_data      = N_VGetArrayPointer(u);
+  uscale_data = N_VGetArrayPointer(kin_mem->kin_uscale);
+
+  /* Load each utemp with u */
+  for (s = 0; s < nthreads; s++) { N_VScale(ONE, u, thread[s].ytemp); }
+
+  /* Set bandwidth and number of column groups for band differencing */
+  width   = mlower + mupper + 1;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over the column groups assigned to each thread */
+  SUNDIALS_OMP_PARALLEL_FOR(nthreads)
+  for (s = 0; s < nthreads; s++)
+  {
+    sunrealtype inc, inc_inv;
+    sunrealtype *utemp_data, *futemp_data, *col_j;
+    sunindextype group, i, j, i1, i2;
+
+    utemp_data       = N_VGetArrayPointer(thread[s].ytemp);
+    futemp_data      = N_VGetArrayPointer(thread[s].ftemp);
+    thread[s].nfe    = 0;
+    thread[s].retval = 0;
+
+    for (group = s + 1; group <= ngroups; group += nthreads)
+    {
+      /* Increment all utemp components in group */
+      for (j = group - 1; j < N; j += width)
+      {
+        inc = kin_mem->kin_sqrt_relfunc *
+              SUNMAX(SUNRabs(u_data[j]), ONE / SUNRabs(uscale_data[j]));
+        utemp_data[j] += inc;
+      }
+
+      /* Evaluate f with incremented u */
+      thread[s].retval = kin_mem->kin_func(thread[s].ytemp, thread[s].ftemp,
+                                           kin_mem->kin_user_data);
+      thread[s].nfe++;
+      if (thread[s].retval != 0) { break; }
+
+      /* Restore utemp components, then form and load difference quotients */
+      for (j = group - 1; j < N; j += width)
+      {
+        utemp_data[j] = u_data[j];
+        col_j         = SUNBandMatrix_Column(Jac, j);
+        inc           = kin_mem->kin_sqrt_relfunc *
+              SUNMAX(SUNRabs(u_data[j]), ONE / SUNRabs(uscale_data[j]));
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(0, j - mupper);
+        i2      = SUNMIN(j + mlower, N - 1);
+        for (i = i1; i <= i2; i++)
+        {
+          SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv *
+                                             (futemp_data[i] - fu_data[i]);
+        }
+      }
+    }
+  }
+
+  return (sunDQThreads_Finalize(&kinls_mem->dqthreads, &kinls_mem->nfeDQ));
+}
+
 /*------------------------------------------------------------------
   kinLsDQJtimes
 
@@ -1134,6 +1402,9 @@ int kinLsInitialize(KINMem kin_mem)
   }
   else { kinls_mem->tol_fac = ONE; }
 
+  /* Discard Broyden updates from a previous solve */
+  sunBroyden_Reset(&kinls_mem->broyden);
+
   /* Call LS initialize routine, and return result */
   kinls_mem->last_flag = SUNLinSolInitialize(kinls_mem->LS);
   return (kinls_mem->last_flag);
@@ -1191,6 +1462,9 @@ int kinLsSetup(KINMem kin_mem)
   /* Call LS setup routine -- the LS will call kinLsPSetup (if applicable) */
   kinls_mem->last_flag = SUNLinSolSetup(kinls_mem->LS, kinls_mem->J);
 
+  /* Discard Broyden updates of the previous Jacobian */
+  sunBroyden_Reset(&kinls_mem->broyden);
+
   /* save nni value from most recent lsetup call */
   kin_mem->kin_nnilset = kin_mem->kin_nni;
 
@@ -1297,6 +1571,14 @@ int kinLsSolve(KINMem kin_mem, N_Vector xx, N_Vector bb, sunrealtype* sJpnorm,
 
   /* SUNLinSolSolve returned SUN_SUCCESS or SUNLS_RES_REDUCED */
 
+  /* Apply the Broyden updates of the Jacobian in Newton iterations */
+  if (kinls_mem->broyden.maxupd > 0 &&
+      (kin_mem->kin_globalstrategy == KIN_NONE ||
+       kin_mem->kin_globalstrategy == KIN_LINESEARCH))
+  {
+    sunBroyden_Solve(&kinls_mem->broyden, kin_mem->kin_uu, xx);
+  }
+
   /* Compute auxiliary values for use in the linesearch and in KINForcingTerm.
      These will be subsequently corrected if the step is reduced by constraints
      or the linesearch. */
@@ -1358,6 +1640,12 @@ int kinLsFree(KINMem kin_mem)
   /* Nullify SUNMatrix pointer */
   kinls_mem->J = NULL;
 
+  /* Free Broyden update memory */
+  sunBroyden_Free(&kinls_mem->broyden);
+
+  /* Free threaded DQ Jacobian work vectors */
+  sunDQThreads_Free(&kinls_mem->dqthreads);
+
   /* Free preconditioner memory (if applicable) */
   if (kinls_mem->pfree) { kinls_mem->pfree(kin_mem); }
 
@@ -1379,6 +1667,8 @@ int kinLsInitializeCounters(KINLsMem kinls_mem)
   kinls_mem->nps     = 0;
   kinls_mem->ncfl    = 0;
   kinls_mem->njtimes = 0;
+
+  kinls_mem->broyden.nbroy = 0;
   return (0);
 }
 
@@ -21,6 +21,8 @@
 #include <kinsol/kinsol_ls.h>
 
 #include "kinsol_impl.h"
+#include "sundials_broyden_impl.h"
+#include "sundials_dqjac_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -74,6 +76,12 @@ typedef struct KINLsMemRec
 
   int last_flag; /* last error return flag                        */
 
+  /* Broyden corrections of the Jacobian between setups */
+  sunBroyden broyden;
+
+  /* Threaded difference quotient Jacobian (dense and band) */
+  sunDQThreads dqthreads;
+
   /* Preconditioner computation
      (a) user-provided:
          - pdata == user_data
@@ -123,6 +131,12 @@ int kinLsDenseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
 int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
                    N_Vector tmp1, N_Vector tmp2);
 
+int kinLsDenseDQJacThreaded(N_Vector u, N_Vector fu, SUNMatrix Jac,
+                            KINMem kin_mem);
+
+int kinLsBandDQJacThreaded(N_Vector u, N_Vector fu, SUNMatrix Jac,
+                           KINMem kin_mem);
+
 /* Generic linit/lsetup/lsolve/lfree interface routines for KINSOL to call */
 int kinLsInitialize(KINMem kin_mem);
 int kinLsSetup(KINMem kin_mem);
@@ -692,7 +692,7 @@ void N_VDestroy_Cuda(N_Vector v)
   /* free ops structure */
   if (v->ops != NULL)
   {
-    free(v->ops);
+    SUNContext_ArenaFree(v->sunctx, v->ops);
     v->ops = NULL;
   }
 
@@ -700,7 +700,7 @@ void N_VDestroy_Cuda(N_Vector v)
   vc = NVEC_CUDA_CONTENT(v);
   if (vc == NULL)
   {
-    free(v);
+    SUNContext_ArenaFree(v->sunctx, v);
     v = NULL;
     return;
   }
@@ -738,7 +738,7 @@ void N_VDestroy_Cuda(N_Vector v)
   free(vc);
 
   /* free vector */
-  free(v);
+  SUNContext_ArenaFree(v->sunctx, v);
 
   return;
 }
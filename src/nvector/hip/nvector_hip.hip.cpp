@@ -24,6 +24,7 @@
 
 #include "VectorArrayKernels.hip.hpp"
 #include "VectorKernels.hip.hpp"
+#include <sundials/priv/sundials_context_impl.h>
 #include "sundials/sundials_errors.h"
 #include "sundials_debug.h"
 #include "sundials_hip.h"
@@ -659,7 +660,7 @@ void N_VDestroy_Hip(N_Vector v)
   /* free ops structure */
   if (v->ops != NULL)
   {
-    free(v->ops);
+    SUNContext_ArenaFree(v->sunctx, v->ops);
     v->ops = NULL;
   }
 
@@ -667,7 +668,7 @@ void N_VDestroy_Hip(N_Vector v)
   vc = NVEC_HIP_CONTENT(v);
   if (vc == NULL)
   {
-    free(v);
+    SUNContext_ArenaFree(v->sunctx, v);
     v = NULL;
     return;
   }
@@ -704,7 +705,7 @@ void N_VDestroy_Hip(N_Vector v)
   free(vc);
 
   /* free vector */
-  free(v);
+  SUNContext_ArenaFree(v->sunctx, v);
 
   return;
 }
@@ -266,6 +266,20 @@ SWIGEXPORT int32_t _wrap_FN_VGetNumSubvectors_ManyVector(N_Vector farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FN_VSetNumThreads_ManyVector(N_Vector farg1, int const *farg2) {
+  int fresult ;
+  N_Vector arg1 = (N_Vector) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (N_Vector)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)N_VSetNumThreads_ManyVector(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FN_VGetVectorID_ManyVector(N_Vector farg1) {
   int fresult ;
   N_Vector arg1 = (N_Vector) 0 ;
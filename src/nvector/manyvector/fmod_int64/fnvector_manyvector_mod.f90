@@ -29,6 +29,7 @@ module fnvector_manyvector_mod
  public :: FN_VGetSubvector_ManyVector
  public :: FN_VSetSubvectorArrayPointer_ManyVector
  public :: FN_VGetNumSubvectors_ManyVector
+ public :: FN_VSetNumThreads_ManyVector
  public :: FN_VGetVectorID_ManyVector
  public :: FN_VPrint_ManyVector
  public :: FN_VPrintFile_ManyVector
@@ -124,6 +125,15 @@ type(C_PTR), value :: farg1
 integer(C_INT64_T) :: fresult
 end function
 
+function swigc_FN_VSetNumThreads_ManyVector(farg1, farg2) &
+bind(C, name="_wrap_FN_VSetNumThreads_ManyVector") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VGetVectorID_ManyVector(farg1) &
 bind(C, name="_wrap_FN_VGetVectorID_ManyVector") &
 result(fresult)
@@ -676,6 +686,22 @@ fresult = swigc_FN_VGetNumSubvectors_ManyVector(farg1)
 swig_result = fresult
 end function
 
+function FN_VSetNumThreads_ManyVector(v, num_threads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(N_Vector), target, intent(inout) :: v
+integer(C_INT), intent(in) :: num_threads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(v)
+farg2 = num_threads
+fresult = swigc_FN_VSetNumThreads_ManyVector(farg1, farg2)
+swig_result = fresult
+end function
+
 function FN_VGetVectorID_ManyVector(v) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
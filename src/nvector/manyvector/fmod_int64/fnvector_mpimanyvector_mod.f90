@@ -30,6 +30,7 @@ module fnvector_mpimanyvector_mod
  public :: FN_VGetSubvector_MPIManyVector
  public :: FN_VSetSubvectorArrayPointer_MPIManyVector
  public :: FN_VGetNumSubvectors_MPIManyVector
+ public :: FN_VSetNumThreads_MPIManyVector
  public :: FN_VGetVectorID_MPIManyVector
  public :: FN_VPrint_MPIManyVector
  public :: FN_VPrintFile_MPIManyVector
@@ -145,6 +146,15 @@ type(C_PTR), value :: farg1
 integer(C_INT64_T) :: fresult
 end function
 
+function swigc_FN_VSetNumThreads_MPIManyVector(farg1, farg2) &
+bind(C, name="_wrap_FN_VSetNumThreads_MPIManyVector") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VGetVectorID_MPIManyVector(farg1) &
 bind(C, name="_wrap_FN_VGetVectorID_MPIManyVector") &
 result(fresult)
@@ -798,6 +808,22 @@ fresult = swigc_FN_VGetNumSubvectors_MPIManyVector(farg1)
 swig_result = fresult
 end function
 
+function FN_VSetNumThreads_MPIManyVector(v, num_threads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(N_Vector), target, intent(inout) :: v
+integer(C_INT), intent(in) :: num_threads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(v)
+farg2 = num_threads
+fresult = swigc_FN_VSetNumThreads_MPIManyVector(farg1, farg2)
+swig_result = fresult
+end function
+
 function FN_VGetVectorID_MPIManyVector(v) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -59,6 +59,21 @@
 #define MANYVECTOR_SUBVECS(v)     (MANYVECTOR_CONTENT(v)->subvec_array)
 #define MANYVECTOR_SUBVEC(v, i)   (MANYVECTOR_SUBVECS(v)[i])
 #define MANYVECTOR_OWN_DATA(v)    (MANYVECTOR_CONTENT(v)->own_data)
+#define MANYVECTOR_NUM_THREADS(v) (MANYVECTOR_CONTENT(v)->num_threads)
+
+/* -----------------------------------------------------------------
+   Subvector execution policy
+
+   When compiled with OpenMP, the loops over subvectors are executed by a
+   team of MANYVECTOR_NUM_THREADS threads. The static round-robin schedule
+   always assigns subvector i to the same thread, so each subvector's data
+   stays with one thread across operations. Reductions combine the
+   per-subvector results at the end of a single parallel loop.
+
+   The last error is checked after every subvector operation. The error
+   codes returned by the fused and vector array operations on the
+   subvectors are combined and checked after the loop.
+   -----------------------------------------------------------------*/
 
 /* -----------------------------------------------------------------
    Prototypes of utility routines
@@ -177,6 +192,7 @@ N_Vector N_VMake_MPIManyVector(MPI_Comm comm, sunindextype num_subvectors,
   content->comm           = MPI_COMM_NULL;
   content->num_subvectors = num_subvectors;
   content->own_data       = SUNFALSE;
+  content->num_threads    = 1;
   content->subvec_array   = NULL;
   content->subvec_array = (N_Vector*)malloc(num_subvectors * sizeof(N_Vector));
   SUNAssertNull(content->subvec_array, SUN_ERR_MALLOC_FAIL);
@@ -395,6 +411,7 @@ N_Vector N_VNew_ManyVector(sunindextype num_subvectors, N_Vector* vec_array,
   /* allocate and set subvector array */
   content->num_subvectors = num_subvectors;
   content->own_data       = SUNFALSE;
+  content->num_threads    = 1;
 
   content->subvec_array = NULL;
   content->subvec_array = (N_Vector*)malloc(num_subvectors * sizeof(N_Vector));
@@ -470,6 +487,44 @@ sunindextype MVAPPEND(N_VGetNumSubvectors)(N_Vector v)
   return (MANYVECTOR_NUM_SUBVECS(v));
 }
 
+/* This function sets the number of threads used to execute operations on
+   the subvectors concurrently. It has no effect unless SUNDIALS was built
+   with OpenMP. The subvector operations update the profiler, which is not
+   thread-safe, so profiling builds only support one thread. In the MPI-aware
+   build every subvector must implement the local reduction operations,
+   otherwise the concurrent subvector reductions would issue MPI collectives
+   from multiple threads. */
+SUNErrCode MVAPPEND(N_VSetNumThreads)(N_Vector v, int num_threads)
+{
+  SUNFunctionBegin(v->sunctx);
+  SUNAssert(num_threads > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+#ifdef SUNDIALS_BUILD_WITH_PROFILING
+  if (num_threads > 1) { return SUN_ERR_ARG_INCOMPATIBLE; }
+#endif
+
+#ifdef MANYVECTOR_BUILD_WITH_MPI
+  if (num_threads > 1)
+  {
+    sunindextype i;
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(v); i++)
+    {
+      N_Vector_Ops ops = MANYVECTOR_SUBVEC(v, i)->ops;
+      if (!(ops->nvdotprodlocal && ops->nvmaxnormlocal && ops->nvminlocal &&
+            ops->nvl1normlocal && ops->nvinvtestlocal &&
+            ops->nvconstrmasklocal && ops->nvminquotientlocal &&
+            ops->nvwsqrsumlocal && ops->nvwsqrsummasklocal))
+      {
+        return SUN_ERR_ARG_INCOMPATIBLE;
+      }
+    }
+  }
+#endif
+
+  MANYVECTOR_NUM_THREADS(v) = num_threads;
+  return SUN_SUCCESS;
+}
+
 /* -----------------------------------------------------------------
    ManyVector implementations of generic NVector routines
    -----------------------------------------------------------------*/
@@ -562,10 +617,10 @@ void MVAPPEND(N_VDestroy)(N_Vector v)
   /* free ops and vector */
   if (v->ops != NULL)
   {
-    free(v->ops);
+    SUNContext_ArenaFree(v->sunctx, v->ops);
     v->ops = NULL;
   }
-  free(v);
+  SUNContext_ArenaFree(v->sunctx, v);
   v = NULL;
 
   return;
@@ -625,11 +680,12 @@ void MVAPPEND(N_VLinearSum)(sunrealtype a, N_Vector x, sunrealtype b,
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_OMP_PARALLEL_FOR(MANYVECTOR_NUM_THREADS(x))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VLinearSum(a, MANYVECTOR_SUBVEC(x, i), b, MANYVECTOR_SUBVEC(y, i),
                  MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    SUNCheckLastErrNoRet();
   }
   return;
 }
@@ -639,10 +695,11 @@ void MVAPPEND(N_VConst)(sunrealtype c, N_Vector z)
 {
   SUNFunctionBegin(z->sunctx);
   sunindextype i;
+  SUNDIALS_OMP_PARALLEL_FOR(MANYVECTOR_NUM_THREADS(z))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(z); i++)
   {
     N_VConst(c, MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    SUNCheckLastErrNoRet();
   }
   return;
 }
@@ -654,11 +711,12 @@ void MVAPPEND(N_VProd)(N_Vector x, N_Vector y, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_OMP_PARALLEL_FOR(MANYVECTOR_NUM_THREADS(x))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i),
             MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    SUNCheckLastErrNoRet();
   }
   return;
 }
@@ -670,11 +728,12 @@ void MVAPPEND(N_VDiv)(N_Vector x, N_Vector y, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_OMP_PARALLEL_FOR(MANYVECTOR_NUM_THREADS(x))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VDiv(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i),
            MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    SUNCheckLastErrNoRet();
   }
   return;
 }
@@ -686,10 +745,11 @@ void MVAPPEND(N_VScale)(sunrealtype c, N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_OMP_PARALLEL_FOR(MANYVECTOR_NUM_THREADS(x))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VScale(c, MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    SUNCheckLastErrNoRet();
   }
   return;
 }
@@ -701,10 +761,11 @@ void MVAPPEND(N_VAbs)(N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_OMP_PARALLEL_FOR(MANYVECTOR_NUM_THREADS(x))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VAbs(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    SUNCheckLastErrNoRet();
   }
   return;
 }
@@ -716,10 +777,11 @@ void MVAPPEND(N_VInv)(N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_OMP_PARALLEL_FOR(MANYVECTOR_NUM_THREADS(x))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VInv(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    SUNCheckLastErrNoRet();
   }
   return;
 }
@@ -731,10 +793,11 @@ void MVAPPEND(N_VAddConst)(N_Vector x, sunrealtype b, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_OMP_PARALLEL_FOR(MANYVECTOR_NUM_THREADS(x))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VAddConst(MANYVECTOR_SUBVEC(x, i), b, MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    SUNCheckLastErrNoRet();
   }
   return;
 }
@@ -753,41 +816,39 @@ sunrealtype MVAPPEND(N_VDotProdLocal)(N_Vector x, N_Vector y)
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
   sunrealtype sum;
-#ifdef MANYVECTOR_BUILD_WITH_MPI
-  sunrealtype contrib;
-  int rank;
-#endif
 
   /* initialize output*/
   sum = ZERO;
 
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(x), + : sum)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
+    N_Vector xi = MANYVECTOR_SUBVEC(x, i);
+    N_Vector yi = MANYVECTOR_SUBVEC(y, i);
+
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 
     /* check for nvdotprodlocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvdotprodlocal)
+    if (xi->ops->nvdotprodlocal)
     {
-      sum += N_VDotProdLocal(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
+      sum += N_VDotProdLocal(xi, yi);
       SUNCheckLastErrNoRet();
       /* otherwise, call nvdotprod and root tasks accumulate to overall sum */
     }
     else
     {
-      contrib = N_VDotProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
+      sunrealtype contrib = N_VDotProd(xi, yi);
       SUNCheckLastErrNoRet();
 
       /* get this task's rank in subvector communicator (note: serial
-         subvectors will result in rank==0) */
-      rank = SubvectorMPIRank(MANYVECTOR_SUBVEC(x, i));
-      if (rank < 0) { return (ZERO); }
-      if (rank == 0) { sum += contrib; }
+         subvectors will result in rank==0, errors in rank==-1) */
+      if (SubvectorMPIRank(xi) == 0) { sum += contrib; }
     }
 
 #else
 
     /* add subvector contribution */
-    sum += N_VDotProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
+    sum += N_VDotProd(xi, yi);
     SUNCheckLastErrNoRet();
 
 #endif
@@ -825,27 +886,31 @@ sunrealtype MVAPPEND(N_VMaxNormLocal)(N_Vector x)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
-  sunrealtype max, lmax;
+  sunrealtype max;
 
   /* initialize output*/
   max = ZERO;
 
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(x), max : max)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
+    sunrealtype lmax;
+    N_Vector xi = MANYVECTOR_SUBVEC(x, i);
+
     /* check for nvmaxnormlocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvmaxnormlocal)
+    if (xi->ops->nvmaxnormlocal)
     {
-      lmax = N_VMaxNormLocal(MANYVECTOR_SUBVEC(x, i));
+      lmax = N_VMaxNormLocal(xi);
       SUNCheckLastErrNoRet();
-      max = (max > lmax) ? max : lmax;
+      max  = (max > lmax) ? max : lmax;
 
       /* otherwise, call nvmaxnorm and accumulate to overall max */
     }
     else
     {
-      lmax = N_VMaxNorm(MANYVECTOR_SUBVEC(x, i));
+      lmax = N_VMaxNorm(xi);
       SUNCheckLastErrNoRet();
-      max = (max > lmax) ? max : lmax;
+      max  = (max > lmax) ? max : lmax;
     }
   }
 
@@ -883,39 +948,40 @@ sunrealtype N_VMaxNorm_MPIManyVector(N_Vector x)
 sunrealtype MVAPPEND(N_VWSqrSumLocal)(N_Vector x, N_Vector w)
 {
   SUNFunctionBegin(x->sunctx);
-  sunindextype i, N;
-  sunrealtype sum, contrib;
-#ifdef MANYVECTOR_BUILD_WITH_MPI
-  int rank;
-#endif
+  sunindextype i;
+  sunrealtype sum;
 
   /* initialize output*/
   sum = ZERO;
 
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(x), + : sum)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
+    sunindextype N;
+    sunrealtype contrib;
+    N_Vector xi = MANYVECTOR_SUBVEC(x, i);
+    N_Vector wi = MANYVECTOR_SUBVEC(w, i);
+
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 
     /* check for nvwsqrsumlocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvwsqrsumlocal)
+    if (xi->ops->nvwsqrsumlocal)
     {
-      sum += N_VWSqrSumLocal(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i));
+      sum += N_VWSqrSumLocal(xi, wi);
       SUNCheckLastErrNoRet();
 
       /* otherwise, call nvwrmsnorm, and accumulate to overall sum on root task */
     }
     else
     {
-      contrib = N_VWrmsNorm(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i));
+      contrib = N_VWrmsNorm(xi, wi);
       SUNCheckLastErrNoRet();
 
       /* get this task's rank in subvector communicator (note: serial
-         subvectors will result in rank==0) */
-      rank = SubvectorMPIRank(MANYVECTOR_SUBVEC(x, i));
-      if (rank < 0) { return (ZERO); }
-      if (rank == 0)
+         subvectors will result in rank==0, errors in rank==-1) */
+      if (SubvectorMPIRank(xi) == 0)
       {
-        N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
+        N = N_VGetLength(xi);
         SUNCheckLastErrNoRet();
         sum += (contrib * contrib * N);
       }
@@ -924,9 +990,9 @@ sunrealtype MVAPPEND(N_VWSqrSumLocal)(N_Vector x, N_Vector w)
 #else
 
     /* accumulate subvector contribution to overall sum */
-    contrib = N_VWrmsNorm(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i));
+    contrib = N_VWrmsNorm(xi, wi);
     SUNCheckLastErrNoRet();
-    N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
+    N = N_VGetLength(xi);
     SUNCheckLastErrNoRet();
     sum += (contrib * contrib * N);
 
@@ -974,41 +1040,41 @@ sunrealtype MVAPPEND(N_VWrmsNorm)(N_Vector x, N_Vector w)
 sunrealtype MVAPPEND(N_VWSqrSumMaskLocal)(N_Vector x, N_Vector w, N_Vector id)
 {
   SUNFunctionBegin(x->sunctx);
-  sunindextype i, N;
-  sunrealtype sum, contrib;
-#ifdef MANYVECTOR_BUILD_WITH_MPI
-  int rank;
-#endif
+  sunindextype i;
+  sunrealtype sum;
 
   /* initialize output*/
   sum = ZERO;
 
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(x), + : sum)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
+    sunindextype N;
+    sunrealtype contrib;
+    N_Vector xi  = MANYVECTOR_SUBVEC(x, i);
+    N_Vector wi  = MANYVECTOR_SUBVEC(w, i);
+    N_Vector idi = MANYVECTOR_SUBVEC(id, i);
+
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 
     /* check for nvwsqrsummasklocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvwsqrsummasklocal)
+    if (xi->ops->nvwsqrsummasklocal)
     {
-      sum += N_VWSqrSumMaskLocal(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i),
-                                 MANYVECTOR_SUBVEC(id, i));
+      sum += N_VWSqrSumMaskLocal(xi, wi, idi);
       SUNCheckLastErrNoRet();
 
       /* otherwise, call nvwrmsnormmask, and accumulate to overall sum on root task */
     }
     else
     {
-      contrib = N_VWrmsNormMask(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i),
-                                MANYVECTOR_SUBVEC(id, i));
+      contrib = N_VWrmsNormMask(xi, wi, idi);
       SUNCheckLastErrNoRet();
 
       /* get this task's rank in subvector communicator (note: serial
-         subvectors will result in rank==0) */
-      rank = SubvectorMPIRank(MANYVECTOR_SUBVEC(x, i));
-      if (rank < 0) { return (ZERO); }
-      if (rank == 0)
+         subvectors will result in rank==0, errors in rank==-1) */
+      if (SubvectorMPIRank(xi) == 0)
       {
-        N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
+        N = N_VGetLength(xi);
         SUNCheckLastErrNoRet();
         sum += (contrib * contrib * N);
       }
@@ -1017,10 +1083,9 @@ sunrealtype MVAPPEND(N_VWSqrSumMaskLocal)(N_Vector x, N_Vector w, N_Vector id)
 #else
 
     /* accumulate subvector contribution to overall sum */
-    contrib = N_VWrmsNormMask(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i),
-                              MANYVECTOR_SUBVEC(id, i));
+    contrib = N_VWrmsNormMask(xi, wi, idi);
     SUNCheckLastErrNoRet();
-    N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
+    N = N_VGetLength(xi);
     SUNCheckLastErrNoRet();
     sum += (contrib * contrib * N);
 
@@ -1063,27 +1128,31 @@ sunrealtype MVAPPEND(N_VMinLocal)(N_Vector x)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
-  sunrealtype min, lmin;
+  sunrealtype min;
 
   /* initialize output*/
   min = SUN_BIG_REAL;
 
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(x), min : min)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
+    sunrealtype lmin;
+    N_Vector xi = MANYVECTOR_SUBVEC(x, i);
+
     /* check for nvminlocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvminlocal)
+    if (xi->ops->nvminlocal)
     {
-      lmin = N_VMinLocal(MANYVECTOR_SUBVEC(x, i));
+      lmin = N_VMinLocal(xi);
       SUNCheckLastErrNoRet();
-      min = (min < lmin) ? min : lmin;
+      min  = (min < lmin) ? min : lmin;
 
       /* otherwise, call nvmin and accumulate to overall min */
     }
     else
     {
-      lmin = N_VMin(MANYVECTOR_SUBVEC(x, i));
+      lmin = N_VMin(xi);
       SUNCheckLastErrNoRet();
-      min = (min < lmin) ? min : lmin;
+      min  = (min < lmin) ? min : lmin;
     }
   }
 
@@ -1142,42 +1211,39 @@ sunrealtype MVAPPEND(N_VL1NormLocal)(N_Vector x)
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
   sunrealtype sum;
-#ifdef MANYVECTOR_BUILD_WITH_MPI
-  sunrealtype contrib;
-  int rank;
-#endif
 
   /* initialize output*/
   sum = ZERO;
 
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(x), + : sum)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
+    N_Vector xi = MANYVECTOR_SUBVEC(x, i);
+
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 
     /* check for nvl1normlocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvl1normlocal)
+    if (xi->ops->nvl1normlocal)
     {
-      sum += N_VL1NormLocal(MANYVECTOR_SUBVEC(x, i));
+      sum += N_VL1NormLocal(xi);
       SUNCheckLastErrNoRet();
 
       /* otherwise, call nvl1norm and root tasks accumulate to overall sum */
     }
     else
     {
-      contrib = N_VL1Norm(MANYVECTOR_SUBVEC(x, i));
+      sunrealtype contrib = N_VL1Norm(xi);
       SUNCheckLastErrNoRet();
 
       /* get this task's rank in subvector communicator (note: serial
-         subvectors will result in rank==0) */
-      rank = SubvectorMPIRank(MANYVECTOR_SUBVEC(x, i));
-      if (rank < 0) { return (ZERO); }
-      if (rank == 0) { sum += contrib; }
+         subvectors will result in rank==0, errors in rank==-1) */
+      if (SubvectorMPIRank(xi) == 0) { sum += contrib; }
     }
 
 #else
 
     /* accumulate subvector contribution to overall sum */
-    sum += N_VL1Norm(MANYVECTOR_SUBVEC(x, i));
+    sum += N_VL1Norm(xi);
     SUNCheckLastErrNoRet();
 
 #endif
@@ -1211,10 +1277,11 @@ void MVAPPEND(N_VCompare)(sunrealtype c, N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_OMP_PARALLEL_FOR(MANYVECTOR_NUM_THREADS(x))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VCompare(c, MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    SUNCheckLastErrNoRet();
   }
   return;
 }
@@ -1230,27 +1297,32 @@ sunbooleantype MVAPPEND(N_VInvTestLocal)(N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
-  sunbooleantype val, subval;
+  sunbooleantype val;
 
   /* initialize output*/
   val = SUNTRUE;
 
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(x), && : val)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
+    sunbooleantype subval;
+    N_Vector xi = MANYVECTOR_SUBVEC(x, i);
+    N_Vector zi = MANYVECTOR_SUBVEC(z, i);
+
     /* check for nvinvtestlocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvinvtestlocal)
+    if (xi->ops->nvinvtestlocal)
     {
-      subval = N_VInvTestLocal(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
+      subval = N_VInvTestLocal(xi, zi);
       SUNCheckLastErrNoRet();
-      val = (val && subval);
+      val    = (val && subval);
 
       /* otherwise, call nvinvtest and accumulate to overall val */
     }
     else
     {
-      subval = N_VInvTest(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
+      subval = N_VInvTest(xi, zi);
       SUNCheckLastErrNoRet();
-      val = (val && subval);
+      val    = (val && subval);
     }
   }
 
@@ -1289,30 +1361,33 @@ sunbooleantype MVAPPEND(N_VConstrMaskLocal)(N_Vector c, N_Vector x, N_Vector m)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
-  sunbooleantype val, subval;
+  sunbooleantype val;
 
   /* initialize output*/
   val = SUNTRUE;
 
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(x), && : val)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
+    sunbooleantype subval;
+    N_Vector ci = MANYVECTOR_SUBVEC(c, i);
+    N_Vector xi = MANYVECTOR_SUBVEC(x, i);
+    N_Vector mi = MANYVECTOR_SUBVEC(m, i);
+
     /* check for nvconstrmasklocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvconstrmasklocal)
+    if (xi->ops->nvconstrmasklocal)
     {
-      subval = N_VConstrMaskLocal(MANYVECTOR_SUBVEC(c, i),
-                                  MANYVECTOR_SUBVEC(x, i),
-                                  MANYVECTOR_SUBVEC(m, i));
+      subval = N_VConstrMaskLocal(ci, xi, mi);
       SUNCheckLastErrNoRet();
-      val = (val && subval);
+      val    = (val && subval);
 
       /* otherwise, call nvconstrmask and accumulate to overall val */
     }
     else
     {
-      subval = N_VConstrMask(MANYVECTOR_SUBVEC(c, i), MANYVECTOR_SUBVEC(x, i),
-                             MANYVECTOR_SUBVEC(m, i));
+      subval = N_VConstrMask(ci, xi, mi);
       SUNCheckLastErrNoRet();
-      val = (val && subval);
+      val    = (val && subval);
     }
   }
 
@@ -1351,29 +1426,32 @@ sunrealtype MVAPPEND(N_VMinQuotientLocal)(N_Vector num, N_Vector denom)
 {
   SUNFunctionBegin(num->sunctx);
   sunindextype i;
-  sunrealtype min, lmin;
+  sunrealtype min;
 
   /* initialize output*/
   min = SUN_BIG_REAL;
 
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(num), min : min)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(num); i++)
   {
+    sunrealtype lmin;
+    N_Vector numi   = MANYVECTOR_SUBVEC(num, i);
+    N_Vector denomi = MANYVECTOR_SUBVEC(denom, i);
+
     /* check for nvminquotientlocal in subvector */
-    if (MANYVECTOR_SUBVEC(num, i)->ops->nvminquotientlocal)
+    if (numi->ops->nvminquotientlocal)
     {
-      lmin = N_VMinQuotientLocal(MANYVECTOR_SUBVEC(num, i),
-                                 MANYVECTOR_SUBVEC(denom, i));
+      lmin = N_VMinQuotientLocal(numi, denomi);
       SUNCheckLastErrNoRet();
-      min = (min < lmin) ? min : lmin;
+      min  = (min < lmin) ? min : lmin;
 
       /* otherwise, call nvmin and accumulate to overall min */
     }
     else
     {
-      lmin = N_VMinQuotient(MANYVECTOR_SUBVEC(num, i),
-                            MANYVECTOR_SUBVEC(denom, i));
+      lmin = N_VMinQuotient(numi, denomi);
       SUNCheckLastErrNoRet();
-      min = (min < lmin) ? min : lmin;
+      min  = (min < lmin) ? min : lmin;
     }
   }
 
@@ -1479,26 +1557,39 @@ SUNErrCode MVAPPEND(N_VLinearCombination)(int nvec, sunrealtype* c, N_Vector* X,
                                           N_Vector z)
 {
   SUNFunctionBegin(z->sunctx);
-  sunindextype i, j;
+  sunindextype i, nsub;
   N_Vector* Xsub;
+  SUNErrCode retval;
 
-  /* create array of nvec N_Vector pointers for reuse within loop */
+  /* create array of nvec N_Vector pointers for each subvector */
+  nsub = MANYVECTOR_NUM_SUBVECS(z);
   Xsub = NULL;
-  Xsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Xsub = (N_Vector*)malloc(nsub * nvec * sizeof(N_Vector));
   SUNAssert(Xsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VLinearCombination for each subvector */
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(z); i++)
+  retval = SUN_SUCCESS;
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(z), min : retval)
+  for (i = 0; i < nsub; i++)
   {
+    sunindextype j;
+    SUNErrCode err;
+
     /* for each subvector, create the array of subvectors of X */
-    for (j = 0; j < nvec; j++) { Xsub[j] = MANYVECTOR_SUBVEC(X[j], i); }
+    for (j = 0; j < nvec; j++)
+    {
+      Xsub[i * nvec + j] = MANYVECTOR_SUBVEC(X[j], i);
+    }
 
     /* now call N_VLinearCombination for this array of subvectors */
-    SUNCheckCall(N_VLinearCombination(nvec, c, Xsub, MANYVECTOR_SUBVEC(z, i)));
+    err = N_VLinearCombination(nvec, c, Xsub + i * nvec,
+                               MANYVECTOR_SUBVEC(z, i));
+    if (err < retval) { retval = err; }
   }
 
   /* clean up and return */
   free(Xsub);
+  SUNCheckCall(retval);
   return SUN_SUCCESS;
 }
 
@@ -1515,33 +1606,43 @@ SUNErrCode MVAPPEND(N_VScaleAddMulti)(int nvec, sunrealtype* a, N_Vector x,
                                       N_Vector* Y, N_Vector* Z)
 {
   SUNFunctionBegin(x->sunctx);
-  sunindextype i, j;
+  sunindextype i, nsub;
   N_Vector *Ysub, *Zsub;
+  SUNErrCode retval;
 
-  /* create arrays of nvec N_Vector pointers for reuse within loop */
+  /* create arrays of nvec N_Vector pointers for each subvector */
+  nsub = MANYVECTOR_NUM_SUBVECS(x);
   Ysub = Zsub = NULL;
-  Ysub        = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Ysub        = (N_Vector*)malloc(nsub * nvec * sizeof(N_Vector));
   SUNAssert(Ysub, SUN_ERR_MALLOC_FAIL);
-  Zsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Zsub = (N_Vector*)malloc(nsub * nvec * sizeof(N_Vector));
   SUNAssert(Zsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VScaleAddMulti for each subvector */
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  retval = SUN_SUCCESS;
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(x), min : retval)
+  for (i = 0; i < nsub; i++)
   {
+    sunindextype j;
+    SUNErrCode err;
+
     /* for each subvector, create the array of subvectors of Y and Z */
     for (j = 0; j < nvec; j++)
     {
-      Ysub[j] = MANYVECTOR_SUBVEC(Y[j], i);
-      Zsub[j] = MANYVECTOR_SUBVEC(Z[j], i);
+      Ysub[i * nvec + j] = MANYVECTOR_SUBVEC(Y[j], i);
+      Zsub[i * nvec + j] = MANYVECTOR_SUBVEC(Z[j], i);
     }
 
     /* now call N_VScaleAddMulti for this array of subvectors */
-    SUNCheckCall(N_VScaleAddMulti(nvec, a, MANYVECTOR_SUBVEC(x, i), Ysub, Zsub));
+    err = N_VScaleAddMulti(nvec, a, MANYVECTOR_SUBVEC(x, i), Ysub + i * nvec,
+                           Zsub + i * nvec);
+    if (err < retval) { retval = err; }
   }
 
   /* clean up and return */
   free(Ysub);
   free(Zsub);
+  SUNCheckCall(retval);
   return SUN_SUCCESS;
 }
 
@@ -1597,41 +1698,52 @@ SUNErrCode MVAPPEND(N_VLinearSumVectorArray)(int nvec, sunrealtype a,
                                              N_Vector* Y, N_Vector* Z)
 {
   SUNFunctionBegin(X[0]->sunctx);
-  sunindextype i, j;
+  sunindextype i, nsub;
   N_Vector *Xsub, *Ysub, *Zsub;
+  SUNErrCode retval;
 
   SUNAssert(nvec > 0, SUN_ERR_ARG_OUTOFRANGE);
 
-  /* create arrays of nvec N_Vector pointers for reuse within loop */
+  /* create arrays of nvec N_Vector pointers for each subvector */
+  nsub = MANYVECTOR_NUM_SUBVECS(X[0]);
   Xsub = NULL;
   Ysub = NULL;
   Zsub = NULL;
-  Xsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Xsub = (N_Vector*)malloc(nsub * nvec * sizeof(N_Vector));
   SUNAssert(Xsub, SUN_ERR_MALLOC_FAIL);
-  Ysub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Ysub = (N_Vector*)malloc(nsub * nvec * sizeof(N_Vector));
   SUNAssert(Ysub, SUN_ERR_MALLOC_FAIL);
-  Zsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Zsub = (N_Vector*)malloc(nsub * nvec * sizeof(N_Vector));
   SUNAssert(Zsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VLinearSumVectorArray for each subvector */
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(X[0]); i++)
+  retval = SUN_SUCCESS;
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(X[0]),
+                                      min : retval)
+  for (i = 0; i < nsub; i++)
   {
+    sunindextype j;
+    SUNErrCode err;
+
     /* for each subvector, create the array of subvectors of X, Y and Z */
     for (j = 0; j < nvec; j++)
     {
-      Xsub[j] = MANYVECTOR_SUBVEC(X[j], i);
-      Ysub[j] = MANYVECTOR_SUBVEC(Y[j], i);
-      Zsub[j] = MANYVECTOR_SUBVEC(Z[j], i);
+      Xsub[i * nvec + j] = MANYVECTOR_SUBVEC(X[j], i);
+      Ysub[i * nvec + j] = MANYVECTOR_SUBVEC(Y[j], i);
+      Zsub[i * nvec + j] = MANYVECTOR_SUBVEC(Z[j], i);
     }
 
     /* now call N_VLinearSumVectorArray for this array of subvectors */
-    SUNCheckCall(N_VLinearSumVectorArray(nvec, a, Xsub, b, Ysub, Zsub));
+    err = N_VLinearSumVectorArray(nvec, a, Xsub + i * nvec, b, Ysub + i * nvec,
+                                  Zsub + i * nvec);
+    if (err < retval) { retval = err; }
   }
 
   /* clean up and return */
   free(Xsub);
   free(Ysub);
   free(Zsub);
+  SUNCheckCall(retval);
   return SUN_SUCCESS;
 }
 
@@ -1648,36 +1760,46 @@ SUNErrCode MVAPPEND(N_VScaleVectorArray)(int nvec, sunrealtype* c, N_Vector* X,
                                          N_Vector* Z)
 {
   SUNFunctionBegin(X[0]->sunctx);
-  sunindextype i, j;
+  sunindextype i, nsub;
   N_Vector *Xsub, *Zsub;
+  SUNErrCode retval;
 
   SUNAssert(nvec > 0, SUN_ERR_ARG_OUTOFRANGE);
 
-  /* create arrays of nvec N_Vector pointers for reuse within loop */
+  /* create arrays of nvec N_Vector pointers for each subvector */
+  nsub = MANYVECTOR_NUM_SUBVECS(X[0]);
   Xsub = NULL;
   Zsub = NULL;
-  Xsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Xsub = (N_Vector*)malloc(nsub * nvec * sizeof(N_Vector));
   SUNAssert(Xsub, SUN_ERR_MALLOC_FAIL);
-  Zsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Zsub = (N_Vector*)malloc(nsub * nvec * sizeof(N_Vector));
   SUNAssert(Zsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VScaleVectorArray for each subvector */
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(X[0]); i++)
+  retval = SUN_SUCCESS;
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(X[0]),
+                                      min : retval)
+  for (i = 0; i < nsub; i++)
   {
-    /* for each subvector, create the array of subvectors of X, Y and Z */
+    sunindextype j;
+    SUNErrCode err;
+
+    /* for each subvector, create the array of subvectors of X and Z */
     for (j = 0; j < nvec; j++)
     {
-      Xsub[j] = MANYVECTOR_SUBVEC(X[j], i);
-      Zsub[j] = MANYVECTOR_SUBVEC(Z[j], i);
+      Xsub[i * nvec + j] = MANYVECTOR_SUBVEC(X[j], i);
+      Zsub[i * nvec + j] = MANYVECTOR_SUBVEC(Z[j], i);
     }
 
     /* now call N_VScaleVectorArray for this array of subvectors */
-    SUNCheckCall(N_VScaleVectorArray(nvec, c, Xsub, Zsub));
+    err = N_VScaleVectorArray(nvec, c, Xsub + i * nvec, Zsub + i * nvec);
+    if (err < retval) { retval = err; }
   }
 
   /* clean up and return */
   free(Xsub);
   free(Zsub);
+  SUNCheckCall(retval);
   return SUN_SUCCESS;
 }
 
@@ -1691,28 +1813,41 @@ SUNErrCode MVAPPEND(N_VScaleVectorArray)(int nvec, sunrealtype* c, N_Vector* X,
 SUNErrCode MVAPPEND(N_VConstVectorArray)(int nvec, sunrealtype c, N_Vector* Z)
 {
   SUNFunctionBegin(Z[0]->sunctx);
-  sunindextype i, j;
+  sunindextype i, nsub;
   N_Vector* Zsub;
+  SUNErrCode retval;
 
   SUNAssert(nvec > 0, SUN_ERR_ARG_OUTOFRANGE);
 
-  /* create array of N_Vector pointers for reuse within loop */
+  /* create array of nvec N_Vector pointers for each subvector */
+  nsub = MANYVECTOR_NUM_SUBVECS(Z[0]);
   Zsub = NULL;
-  Zsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Zsub = (N_Vector*)malloc(nsub * nvec * sizeof(N_Vector));
   SUNAssert(Zsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VConstVectorArray for each subvector */
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(Z[0]); i++)
+  retval = SUN_SUCCESS;
+  SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(MANYVECTOR_NUM_THREADS(Z[0]),
+                                      min : retval)
+  for (i = 0; i < nsub; i++)
   {
-    /* for each subvector, create the array of subvectors of X, Y and Z */
-    for (j = 0; j < nvec; j++) { Zsub[j] = MANYVECTOR_SUBVEC(Z[j], i); }
+    sunindextype j;
+    SUNErrCode err;
+
+    /* for each subvector, create the array of subvectors of Z */
+    for (j = 0; j < nvec; j++)
+    {
+      Zsub[i * nvec + j] = MANYVECTOR_SUBVEC(Z[j], i);
+    }
 
     /* now call N_VConstVectorArray for this array of subvectors */
-    SUNCheckCall(N_VConstVectorArray(nvec, c, Zsub));
+    err = N_VConstVectorArray(nvec, c, Zsub + i * nvec);
+    if (err < retval) { retval = err; }
   }
 
   /* clean up and return */
   free(Zsub);
+  SUNCheckCall(retval);
   return SUN_SUCCESS;
 }
 
@@ -2065,6 +2200,7 @@ static N_Vector ManyVectorClone(N_Vector w, sunbooleantype cloneempty)
   content->num_subvectors = MANYVECTOR_NUM_SUBVECS(w);
   content->global_length  = MANYVECTOR_GLOBLENGTH(w);
   content->own_data       = SUNTRUE;
+  content->num_threads    = MANYVECTOR_NUM_THREADS(w);
 
   /* Allocate the subvector array */
   content->subvec_array = NULL;
@@ -2114,7 +2250,6 @@ static int SubvectorMPIRank(N_Vector x)
 
   int rank      = 0;
   MPI_Comm comm = N_VGetCommunicator(x);
-  SUNCheckLastErrNoRet();
 
   if (comm != MPI_COMM_NULL)
   {
@@ -654,6 +654,42 @@ SWIGEXPORT int _wrap_FN_VDotProdMulti_OpenMP(int const *farg1, N_Vector farg2, v
 }
 
 
+SWIGEXPORT int _wrap_FN_VProjectSubtract_OpenMP(int const *farg1, N_Vector farg2, void *farg3, double *farg4, double *farg5) {
+  int fresult ;
+  int arg1 ;
+  N_Vector arg2 = (N_Vector) 0 ;
+  N_Vector *arg3 = (N_Vector *) 0 ;
+  sunrealtype *arg4 = (sunrealtype *) 0 ;
+  sunrealtype *arg5 = (sunrealtype *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (int)(*farg1);
+  arg2 = (N_Vector)(farg2);
+  arg3 = (N_Vector *)(farg3);
+  arg4 = (sunrealtype *)(farg4);
+  arg5 = (sunrealtype *)(farg5);
+  result = (SUNErrCode)N_VProjectSubtract_OpenMP(arg1,arg2,arg3,arg4,arg5);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FN_VPascalUpdate_OpenMP(int const *farg1, double const *farg2, void *farg3) {
+  int fresult ;
+  int arg1 ;
+  sunrealtype arg2 ;
+  N_Vector *arg3 = (N_Vector *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (int)(*farg1);
+  arg2 = (sunrealtype)(*farg2);
+  arg3 = (N_Vector *)(farg3);
+  result = (SUNErrCode)N_VPascalUpdate_OpenMP(arg1,arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FN_VLinearSumVectorArray_OpenMP(int const *farg1, double const *farg2, void *farg3, double const *farg4, void *farg5, void *farg6) {
   int fresult ;
   int arg1 ;
@@ -876,6 +912,34 @@ SWIGEXPORT int _wrap_FN_VEnableDotProdMulti_OpenMP(N_Vector farg1, int const *fa
 }
 
 
+SWIGEXPORT int _wrap_FN_VEnableProjectSubtract_OpenMP(N_Vector farg1, int const *farg2) {
+  int fresult ;
+  N_Vector arg1 = (N_Vector) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (N_Vector)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)N_VEnableProjectSubtract_OpenMP(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FN_VEnablePascalUpdate_OpenMP(N_Vector farg1, int const *farg2) {
+  int fresult ;
+  N_Vector arg1 = (N_Vector) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (N_Vector)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)N_VEnableProjectSubtract_OpenMP(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FN_VEnableLinearSumVectorArray_OpenMP(N_Vector farg1, int const *farg2) {
   int fresult ;
   N_Vector arg1 = (N_Vector) 0 ;
@@ -59,6 +59,8 @@ module fnvector_openmp_mod
  public :: FN_VLinearCombination_OpenMP
  public :: FN_VScaleAddMulti_OpenMP
  public :: FN_VDotProdMulti_OpenMP
+ public :: FN_VProjectSubtract_OpenMP
+ public :: FN_VPascalUpdate_OpenMP
  public :: FN_VLinearSumVectorArray_OpenMP
  public :: FN_VScaleVectorArray_OpenMP
  public :: FN_VConstVectorArray_OpenMP
@@ -73,6 +75,8 @@ module fnvector_openmp_mod
  public :: FN_VEnableLinearCombination_OpenMP
  public :: FN_VEnableScaleAddMulti_OpenMP
  public :: FN_VEnableDotProdMulti_OpenMP
+ public :: FN_VEnableProjectSubtract_OpenMP
+ public :: FN_VEnablePascalUpdate_OpenMP
  public :: FN_VEnableLinearSumVectorArray_OpenMP
  public :: FN_VEnableScaleVectorArray_OpenMP
  public :: FN_VEnableConstVectorArray_OpenMP
@@ -375,6 +379,28 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FN_VProjectSubtract_OpenMP(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FN_VProjectSubtract_OpenMP") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
+function swigc_FN_VPascalUpdate_OpenMP(farg1, farg2, farg3) &
+bind(C, name="_wrap_FN_VPascalUpdate_OpenMP") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+real(C_DOUBLE), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VLinearSumVectorArray_OpenMP(farg1, farg2, farg3, farg4, farg5, farg6) &
 bind(C, name="_wrap_FN_VLinearSumVectorArray_OpenMP") &
 result(fresult)
@@ -514,6 +540,24 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FN_VEnableProjectSubtract_OpenMP(farg1, farg2) &
+bind(C, name="_wrap_FN_VEnableProjectSubtract_OpenMP") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FN_VEnablePascalUpdate_OpenMP(farg1, farg2) &
+bind(C, name="_wrap_FN_VEnablePascalUpdate_OpenMP") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VEnableLinearSumVectorArray_OpenMP(farg1, farg2) &
 bind(C, name="_wrap_FN_VEnableLinearSumVectorArray_OpenMP") &
 result(fresult)
@@ -1100,6 +1144,50 @@ fresult = swigc_FN_VDotProdMulti_OpenMP(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FN_VProjectSubtract_OpenMP(nvec, x, y, dotprods, sqrnorms) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec
+type(N_Vector), target, intent(inout) :: x
+type(C_PTR) :: y
+real(C_DOUBLE), dimension(*), target, intent(inout) :: dotprods
+real(C_DOUBLE), dimension(*), target, intent(inout) :: sqrnorms
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = nvec
+farg2 = c_loc(x)
+farg3 = y
+farg4 = c_loc(dotprods(1))
+farg5 = c_loc(sqrnorms(1))
+fresult = swigc_FN_VProjectSubtract_OpenMP(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
+function FN_VPascalUpdate_OpenMP(nvec, c, z) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec
+real(C_DOUBLE), intent(in) :: c
+type(C_PTR) :: z
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+real(C_DOUBLE) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = nvec
+farg2 = c
+farg3 = z
+fresult = swigc_FN_VPascalUpdate_OpenMP(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FN_VLinearSumVectorArray_OpenMP(nvec, a, x, b, y, z) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -1363,6 +1451,38 @@ fresult = swigc_FN_VEnableDotProdMulti_OpenMP(farg1, farg2)
 swig_result = fresult
 end function
 
+function FN_VEnableProjectSubtract_OpenMP(v, tf) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(N_Vector), target, intent(inout) :: v
+integer(C_INT), intent(in) :: tf
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(v)
+farg2 = tf
+fresult = swigc_FN_VEnableProjectSubtract_OpenMP(farg1, farg2)
+swig_result = fresult
+end function
+
+function FN_VEnablePascalUpdate_OpenMP(v, tf) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(N_Vector), target, intent(inout) :: v
+integer(C_INT), intent(in) :: tf
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(v)
+farg2 = tf
+fresult = swigc_FN_VEnablePascalUpdate_OpenMP(farg1, farg2)
+swig_result = fresult
+end function
+
 function FN_VEnableLinearSumVectorArray_OpenMP(v, tf) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -27,6 +27,7 @@
 #include <nvector/nvector_openmp.h>
 #include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/priv/sundials_nvector_impl.h>
 #include <sundials/sundials_context.h>
 #include <sundials/sundials_core.h>
 #include <sundials/sundials_errors.h>
@@ -38,6 +39,21 @@
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Number of entries per block in N_VProjectSubtract and N_VPascalUpdate so
+   each block of the vectors is updated while it is in cache */
+#define BLOCK_SIZE 512
+
+/* Number of dot products accumulated together in each pass over the blocks of
+   x in N_VProjectSubtract, each thread keeps one partial sum per vector */
+#define GROUP_SIZE 8
+
+/* Frees a vector without returning it to the vector pool */
+static void FreeVector_OpenMP(N_Vector v);
+
+/* Initializes the data array in parallel so that each page is placed on the
+   NUMA node of the thread that accesses it in the vector operations */
+static void FirstTouch_OpenMP(N_Vector v);
+
 /* Private functions for special cases of vector operations */
 static void VCopy_OpenMP(N_Vector x, N_Vector z);             /* z=x */
 static void VSum_OpenMP(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -166,9 +182,13 @@ N_Vector N_VNewEmpty_OpenMP(sunindextype length, int num_threads,
   v->ops->nvprint     = N_VPrint_OpenMP;
   v->ops->nvprintfile = N_VPrintFile_OpenMP;
 
+  /* Use the shared operations table if sharing is enabled */
+  SUNCheckCallNull(N_VShareOps(v));
+
   /* Create content */
   content = NULL;
-  content = (N_VectorContent_OpenMP)malloc(sizeof *content);
+  content = (N_VectorContent_OpenMP)
+    SUNContext_ArenaAlloc(v->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Attach content */
@@ -179,6 +199,7 @@ N_Vector N_VNewEmpty_OpenMP(sunindextype length, int num_threads,
   content->num_threads = num_threads;
   content->own_data    = SUNFALSE;
   content->data        = NULL;
+  content->first_touch = SUNFALSE;
 
   return (v);
 }
@@ -240,6 +261,41 @@ N_Vector N_VMake_OpenMP(sunindextype length, sunrealtype* v_data,
   return (v);
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to create a new vector with data placed by first touch
+ */
+
+N_Vector N_VNewFirstTouch_OpenMP(sunindextype length, int num_threads,
+                                 SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+
+  v = NULL;
+  v = N_VNew_OpenMP(length, num_threads, sunctx);
+  SUNCheckLastErrNull();
+
+  /* Place the data and the data of clones by first touch */
+  NV_FIRST_TOUCH_OMP(v) = SUNTRUE;
+  FirstTouch_OpenMP(v);
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to enable or disable first-touch placement of the data of clones
+ */
+
+SUNErrCode N_VSetFirstTouch_OpenMP(N_Vector v, sunbooleantype onoff)
+{
+  SUNFunctionBegin(v->sunctx);
+  SUNAssert(v->content, SUN_ERR_ARG_CORRUPT);
+
+  NV_FIRST_TOUCH_OMP(v) = onoff;
+
+  return SUN_SUCCESS;
+}
+
 /* ----------------------------------------------------------------------------
  * Function to return number of vector elements
  */
@@ -289,15 +345,13 @@ N_Vector N_VCloneEmpty_OpenMP(N_Vector w)
 
   /* Create vector */
   v = NULL;
-  v = N_VNewEmpty(w->sunctx);
+  v = N_VNewEmptyWithOps(w);
   SUNCheckLastErrNull();
 
-  /* Attach operations */
-  SUNCheckCallNull(N_VCopyOps(w, v));
-
   /* Create content */
   content = NULL;
-  content = (N_VectorContent_OpenMP)malloc(sizeof *content);
+  content = (N_VectorContent_OpenMP)
+    SUNContext_ArenaAlloc(v->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Attach content */
@@ -308,6 +362,7 @@ N_Vector N_VCloneEmpty_OpenMP(N_Vector w)
   content->num_threads = NV_NUM_THREADS_OMP(w);
   content->own_data    = SUNFALSE;
   content->data        = NULL;
+  content->first_touch = NV_FIRST_TOUCH_OMP(w);
 
   return (v);
 }
@@ -323,6 +378,22 @@ N_Vector N_VClone_OpenMP(N_Vector w)
   sunrealtype* data;
   sunindextype length;
 
+  /* reuse a vector from the vector pool of the context if possible */
+  v = SUNContext_TakePooledVector(w->sunctx, SUNDIALS_NVEC_OPENMP,
+                                  NV_LENGTH_OMP(w));
+  if (v)
+  {
+    if (v->ops != w->ops)
+    {
+      SUNCheckCallNull(N_VCopyOps(w, v));
+      SUNCheckCallNull(N_VShareOps(v));
+    }
+    /* the data keeps the placement of its first use */
+    NV_NUM_THREADS_OMP(v) = NV_NUM_THREADS_OMP(w);
+    NV_FIRST_TOUCH_OMP(v) = NV_FIRST_TOUCH_OMP(w);
+    return (v);
+  }
+
   v = NULL;
   v = N_VCloneEmpty_OpenMP(w);
   SUNCheckLastErrNull();
@@ -341,6 +412,9 @@ N_Vector N_VClone_OpenMP(N_Vector w)
   NV_OWN_DATA_OMP(v) = SUNTRUE;
   NV_DATA_OMP(v)     = data;
 
+  /* Place the data with the same distribution as w */
+  if (NV_FIRST_TOUCH_OMP(w)) { FirstTouch_OpenMP(v); }
+
   return (v);
 }
 
@@ -352,27 +426,15 @@ void N_VDestroy_OpenMP(N_Vector v)
 {
   if (v == NULL) { return; }
 
-  /* free content */
-  if (v->content != NULL)
+  /* return a vector owning its data to the vector pool of the context */
+  if (v->content != NULL && NV_OWN_DATA_OMP(v) && NV_DATA_OMP(v) != NULL &&
+      SUNContext_PoolVector(v->sunctx, v, SUNDIALS_NVEC_OPENMP,
+                            NV_LENGTH_OMP(v), FreeVector_OpenMP))
   {
-    /* free data array if it's owned by the vector */
-    if (NV_OWN_DATA_OMP(v) && NV_DATA_OMP(v) != NULL)
-    {
-      free(NV_DATA_OMP(v));
-      NV_DATA_OMP(v) = NULL;
-    }
-    free(v->content);
-    v->content = NULL;
+    return;
   }
 
-  /* free ops and vector */
-  if (v->ops != NULL)
-  {
-    free(v->ops);
-    v->ops = NULL;
-  }
-  free(v);
-  v = NULL;
+  FreeVector_OpenMP(v);
 
   return;
 }
@@ -1260,6 +1322,125 @@ SUNErrCode N_VDotProdMulti_OpenMP(int nvec, N_Vector x, N_Vector* Y,
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VProjectSubtract_OpenMP(int nvec, N_Vector x, N_Vector* Y,
+                                     sunrealtype* dotprods,
+                                     sunrealtype* sqrnorms)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  int i, ib, ie;
+  sunindextype j, jb, je, N;
+  sunrealtype sum;
+  sunrealtype sums[GROUP_SIZE + 1];
+  sunrealtype* xd = NULL;
+  sunrealtype* yd = NULL;
+
+  i = 0; /* initialize to suppress clang warning */
+  j = 0;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length and data array */
+  N  = NV_LENGTH_OMP(x);
+  xd = NV_DATA_OMP(x);
+
+  /* initialize dot products and squared norm */
+  sqrnorms[0] = ZERO;
+  for (i = 0; i < nvec; i++) { dotprods[i] = ZERO; }
+
+  /* compute the dot products and the squared norm of x, each block of x is
+     loaded once for every group of GROUP_SIZE vectors */
+#pragma omp parallel default(none) private(i, ib, ie, j, jb, je, yd, sums) \
+  shared(nvec, Y, N, xd, dotprods, sqrnorms) num_threads(NV_NUM_THREADS_OMP(x))
+  {
+    for (ib = 0; ib < nvec; ib += GROUP_SIZE)
+    {
+      ie = SUNMIN(ib + GROUP_SIZE, nvec);
+      for (i = 0; i <= GROUP_SIZE; i++) { sums[i] = ZERO; }
+
+#pragma omp for schedule(static)
+      for (jb = 0; jb < N; jb += BLOCK_SIZE)
+      {
+        je = SUNMIN(jb + BLOCK_SIZE, N);
+        if (ib == 0)
+        {
+          for (j = jb; j < je; j++) { sums[GROUP_SIZE] += xd[j] * xd[j]; }
+        }
+        for (i = ib; i < ie; i++)
+        {
+          yd = NV_DATA_OMP(Y[i]);
+          for (j = jb; j < je; j++) { sums[i - ib] += xd[j] * yd[j]; }
+        }
+      }
+
+#pragma omp critical
+      {
+        for (i = ib; i < ie; i++) { dotprods[i] += sums[i - ib]; }
+        sqrnorms[0] += sums[GROUP_SIZE];
+      }
+    }
+  }
+
+  /* subtract the projection and compute the new squared norm of x */
+  sum = ZERO;
+#pragma omp parallel for default(none) private(i, j, jb, je, yd) \
+  shared(nvec, Y, N, xd, dotprods) reduction(+ : sum) schedule(static) \
+  num_threads(NV_NUM_THREADS_OMP(x))
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
+  {
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    for (i = 0; i < nvec; i++)
+    {
+      yd = NV_DATA_OMP(Y[i]);
+      for (j = jb; j < je; j++) { xd[j] -= dotprods[i] * yd[j]; }
+    }
+    for (j = jb; j < je; j++) { sum += xd[j] * xd[j]; }
+  }
+  sqrnorms[1] = sum;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VPascalUpdate_OpenMP(int nvec, sunrealtype c, N_Vector* Z)
+{
+  SUNFunctionBegin(Z[0]->sunctx);
+
+  int i, k;
+  sunindextype j, jb, je, N;
+  sunrealtype* zd  = NULL;
+  sunrealtype* zd1 = NULL;
+
+  i = 0; /* initialize to suppress clang warning */
+  j = 0;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length */
+  N = NV_LENGTH_OMP(Z[0]);
+
+  /* apply all the updates to each block of the vectors before moving on to
+     the next block, so each block is loaded from memory once */
+#pragma omp parallel for default(none) private(i, j, k, jb, je, zd, zd1) \
+  shared(nvec, c, Z, N) schedule(static) num_threads(NV_NUM_THREADS_OMP(Z[0]))
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
+  {
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    for (k = 1; k < nvec; k++)
+    {
+      for (i = nvec - 1; i >= k; i--)
+      {
+        zd  = NV_DATA_OMP(Z[i - 1]);
+        zd1 = NV_DATA_OMP(Z[i]);
+        for (j = jb; j < je; j++) { zd[j] += c * zd1[j]; }
+      }
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * vector array operations
@@ -2428,12 +2609,17 @@ static void VaxpyVectorArray_OpenMP(int nvec, sunrealtype a, N_Vector* X,
 
 SUNErrCode N_VEnableFusedOps_OpenMP(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   if (tf)
   {
     /* enable all fused vector operations */
     v->ops->nvlinearcombination = N_VLinearCombination_OpenMP;
     v->ops->nvscaleaddmulti     = N_VScaleAddMulti_OpenMP;
     v->ops->nvdotprodmulti      = N_VDotProdMulti_OpenMP;
+    v->ops->nvprojectsubtract   = N_VProjectSubtract_OpenMP;
+    v->ops->nvpascalupdate      = N_VPascalUpdate_OpenMP;
     /* enable all vector array operations */
     v->ops->nvlinearsumvectorarray     = N_VLinearSumVectorArray_OpenMP;
     v->ops->nvscalevectorarray         = N_VScaleVectorArray_OpenMP;
@@ -2452,6 +2638,8 @@ SUNErrCode N_VEnableFusedOps_OpenMP(N_Vector v, sunbooleantype tf)
     v->ops->nvlinearcombination = NULL;
     v->ops->nvscaleaddmulti     = NULL;
     v->ops->nvdotprodmulti      = NULL;
+    v->ops->nvprojectsubtract   = NULL;
+    v->ops->nvpascalupdate      = NULL;
     /* disable all vector array operations */
     v->ops->nvlinearsumvectorarray         = NULL;
     v->ops->nvscalevectorarray             = NULL;
@@ -2464,71 +2652,196 @@ SUNErrCode N_VEnableFusedOps_OpenMP(N_Vector v, sunbooleantype tf)
     v->ops->nvdotprodmultilocal = NULL;
   }
 
+  /* switch to the shared table with the new operations */
+  SUNCheckCall(N_VShareOps(v));
+
   /* return success */
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableLinearCombination_OpenMP(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvlinearcombination = tf ? N_VLinearCombination_OpenMP : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableScaleAddMulti_OpenMP(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvscaleaddmulti = tf ? N_VScaleAddMulti_OpenMP : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableDotProdMulti_OpenMP(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvdotprodmulti      = tf ? N_VDotProdMulti_OpenMP : NULL;
   v->ops->nvdotprodmultilocal = tf ? N_VDotProdMulti_OpenMP : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableProjectSubtract_OpenMP(N_Vector v, sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
+  v->ops->nvprojectsubtract = tf ? N_VProjectSubtract_OpenMP : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnablePascalUpdate_OpenMP(N_Vector v, sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
+  v->ops->nvpascalupdate = tf ? N_VPascalUpdate_OpenMP : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableLinearSumVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvlinearsumvectorarray = tf ? N_VLinearSumVectorArray_OpenMP : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableScaleVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvscalevectorarray = tf ? N_VScaleVectorArray_OpenMP : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableConstVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvconstvectorarray = tf ? N_VConstVectorArray_OpenMP : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableWrmsNormVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvwrmsnormvectorarray = tf ? N_VWrmsNormVectorArray_OpenMP : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableWrmsNormMaskVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvwrmsnormmaskvectorarray = tf ? N_VWrmsNormMaskVectorArray_OpenMP
                                          : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableScaleAddMultiVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvscaleaddmultivectorarray = tf ? N_VScaleAddMultiVectorArray_OpenMP
                                           : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableLinearCombinationVectorArray_OpenMP(N_Vector v,
                                                         sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvlinearcombinationvectorarray =
     tf ? N_VLinearCombinationVectorArray_OpenMP : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
+
+/* ----------------------------------------------------------------------------
+ * First-touch placement of the vector data
+ */
+
+static void FirstTouch_OpenMP(N_Vector v)
+{
+  sunindextype i, N;
+  sunrealtype* vd;
+
+  i  = 0; /* initialize to suppress clang warning */
+  vd = NULL;
+
+  N  = NV_LENGTH_OMP(v);
+  vd = NV_DATA_OMP(v);
+
+  if (vd == NULL) { return; }
+
+  /* same static schedule and number of threads as the vector operations */
+#pragma omp parallel for default(none) private(i) shared(N, vd) \
+  schedule(static) num_threads(NV_NUM_THREADS_OMP(v))
+  for (i = 0; i < N; i++) { vd[i] = ZERO; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Free vector memory
+ */
+
+static void FreeVector_OpenMP(N_Vector v)
+{
+  /* free content */
+  if (v->content != NULL)
+  {
+    /* free data array if it's owned by the vector */
+    if (NV_OWN_DATA_OMP(v) && NV_DATA_OMP(v) != NULL)
+    {
+      free(NV_DATA_OMP(v));
+      NV_DATA_OMP(v) = NULL;
+    }
+    SUNContext_ArenaFree(v->sunctx, v->content);
+    v->content = NULL;
+  }
+
+  /* free ops (releasing a shared table) and vector */
+  N_VFreeEmpty(v);
+
+  return;
+}
@@ -24,6 +24,7 @@
 #include <omp.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/sundials_math.h>
 
 #define ZERO   SUN_RCONST(0.0)
@@ -479,10 +480,10 @@ void N_VDestroy_OpenMPDEV(N_Vector v)
   /* free ops and vector */
   if (v->ops != NULL)
   {
-    free(v->ops);
+    SUNContext_ArenaFree(v->sunctx, v->ops);
     v->ops = NULL;
   }
-  free(v);
+  SUNContext_ArenaFree(v->sunctx, v);
   v = NULL;
 
   return;
@@ -61,6 +61,8 @@ module fnvector_parallel_mod
  public :: FN_VLinearCombination_Parallel
  public :: FN_VScaleAddMulti_Parallel
  public :: FN_VDotProdMulti_Parallel
+ public :: FN_VProjectSubtract_Parallel
+ public :: FN_VPascalUpdate_Parallel
  public :: FN_VLinearSumVectorArray_Parallel
  public :: FN_VScaleVectorArray_Parallel
  public :: FN_VConstVectorArray_Parallel
@@ -84,6 +86,8 @@ module fnvector_parallel_mod
  public :: FN_VEnableLinearCombination_Parallel
  public :: FN_VEnableScaleAddMulti_Parallel
  public :: FN_VEnableDotProdMulti_Parallel
+ public :: FN_VEnableProjectSubtract_Parallel
+ public :: FN_VEnablePascalUpdate_Parallel
  public :: FN_VEnableLinearSumVectorArray_Parallel
  public :: FN_VEnableScaleVectorArray_Parallel
  public :: FN_VEnableConstVectorArray_Parallel
@@ -406,6 +410,28 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FN_VProjectSubtract_Parallel(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FN_VProjectSubtract_Parallel") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
+function swigc_FN_VPascalUpdate_Parallel(farg1, farg2, farg3) &
+bind(C, name="_wrap_FN_VPascalUpdate_Parallel") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+real(C_DOUBLE), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VLinearSumVectorArray_Parallel(farg1, farg2, farg3, farg4, farg5, farg6) &
 bind(C, name="_wrap_FN_VLinearSumVectorArray_Parallel") &
 result(fresult)
@@ -627,6 +653,24 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FN_VEnableProjectSubtract_Parallel(farg1, farg2) &
+bind(C, name="_wrap_FN_VEnableProjectSubtract_Parallel") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FN_VEnablePascalUpdate_Parallel(farg1, farg2) &
+bind(C, name="_wrap_FN_VEnablePascalUpdate_Parallel") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VEnableLinearSumVectorArray_Parallel(farg1, farg2) &
 bind(C, name="_wrap_FN_VEnableLinearSumVectorArray_Parallel") &
 result(fresult)
@@ -1257,6 +1301,50 @@ fresult = swigc_FN_VDotProdMulti_Parallel(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FN_VProjectSubtract_Parallel(nvec, x, y, dotprods, sqrnorms) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec
+type(N_Vector), target, intent(inout) :: x
+type(C_PTR) :: y
+real(C_DOUBLE), dimension(*), target, intent(inout) :: dotprods
+real(C_DOUBLE), dimension(*), target, intent(inout) :: sqrnorms
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = nvec
+farg2 = c_loc(x)
+farg3 = y
+farg4 = c_loc(dotprods(1))
+farg5 = c_loc(sqrnorms(1))
+fresult = swigc_FN_VProjectSubtract_Parallel(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
+function FN_VPascalUpdate_Parallel(nvec, c, z) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec
+real(C_DOUBLE), intent(in) :: c
+type(C_PTR) :: z
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+real(C_DOUBLE) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = nvec
+farg2 = c
+farg3 = z
+fresult = swigc_FN_VPascalUpdate_Parallel(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FN_VLinearSumVectorArray_Parallel(nvec, a, x, b, y, z) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -1667,6 +1755,38 @@ fresult = swigc_FN_VEnableDotProdMulti_Parallel(farg1, farg2)
 swig_result = fresult
 end function
 
+function FN_VEnableProjectSubtract_Parallel(v, tf) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(N_Vector), target, intent(inout) :: v
+integer(C_INT), intent(in) :: tf
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(v)
+farg2 = tf
+fresult = swigc_FN_VEnableProjectSubtract_Parallel(farg1, farg2)
+swig_result = fresult
+end function
+
+function FN_VEnablePascalUpdate_Parallel(v, tf) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(N_Vector), target, intent(inout) :: v
+integer(C_INT), intent(in) :: tf
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(v)
+farg2 = tf
+fresult = swigc_FN_VEnablePascalUpdate_Parallel(farg1, farg2)
+swig_result = fresult
+end function
+
 function FN_VEnableLinearSumVectorArray_Parallel(v, tf) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
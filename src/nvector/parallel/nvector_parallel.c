@@ -20,6 +20,7 @@
 #include <stdlib.h>
 
 #include <nvector/nvector_parallel.h>
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/priv/sundials_mpi_errors_impl.h>
 #include <sundials/sundials_errors.h>
@@ -32,6 +33,10 @@
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Number of entries per block in N_VProjectSubtract and N_VPascalUpdate so
+   each block of the vectors is updated while it is in cache */
+#define BLOCK_SIZE 512
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Parallel(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Parallel(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -379,10 +384,10 @@ void N_VDestroy_Parallel(N_Vector v)
   /* free ops and vector */
   if (v->ops != NULL)
   {
-    free(v->ops);
+    SUNContext_ArenaFree(v->sunctx, v->ops);
     v->ops = NULL;
   }
-  free(v);
+  SUNContext_ArenaFree(v->sunctx, v);
   v = NULL;
 
   return;
@@ -1188,6 +1193,98 @@ SUNErrCode N_VDotProdMultiAllReduce_Parallel(int nvec, N_Vector x,
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VProjectSubtract_Parallel(int nvec, N_Vector x, N_Vector* Y,
+                                       sunrealtype* dotprods,
+                                       sunrealtype* sqrnorms)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  int i;
+  sunindextype j, jb, je, N;
+  sunrealtype* xd = NULL;
+  sunrealtype* yd = NULL;
+  MPI_Comm comm;
+
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length, data array, and communicator */
+  N    = NV_LOCLENGTH_P(x);
+  xd   = NV_DATA_P(x);
+  comm = NV_COMM_P(x);
+
+  /* compute the local dot products and squared norm of x */
+  sqrnorms[0] = ZERO;
+  for (i = 0; i < nvec; i++) { dotprods[i] = ZERO; }
+
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
+  {
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    for (j = jb; j < je; j++) { sqrnorms[0] += xd[j] * xd[j]; }
+    for (i = 0; i < nvec; i++)
+    {
+      yd = NV_DATA_P(Y[i]);
+      for (j = jb; j < je; j++) { dotprods[i] += xd[j] * yd[j]; }
+    }
+  }
+
+  /* only the dot products are needed for the update, the squared norm of the
+     original x is reduced together with the new squared norm below */
+  SUNCheckMPICall(MPI_Allreduce(MPI_IN_PLACE, dotprods, nvec, MPI_SUNREALTYPE,
+                                MPI_SUM, comm));
+
+  /* subtract the projection and compute the new squared norm of x */
+  sqrnorms[1] = ZERO;
+
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
+  {
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    for (i = 0; i < nvec; i++)
+    {
+      yd = NV_DATA_P(Y[i]);
+      for (j = jb; j < je; j++) { xd[j] -= dotprods[i] * yd[j]; }
+    }
+    for (j = jb; j < je; j++) { sqrnorms[1] += xd[j] * xd[j]; }
+  }
+
+  SUNCheckMPICall(MPI_Allreduce(MPI_IN_PLACE, sqrnorms, 2, MPI_SUNREALTYPE,
+                                MPI_SUM, comm));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VPascalUpdate_Parallel(int nvec, sunrealtype c, N_Vector* Z)
+{
+  SUNFunctionBegin(Z[0]->sunctx);
+  int i, k;
+  sunindextype j, jb, je, N;
+  sunrealtype* zd  = NULL;
+  sunrealtype* zd1 = NULL;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length */
+  N = NV_LOCLENGTH_P(Z[0]);
+
+  /* apply all the updates to each block of the vectors before moving on to
+     the next block, so each block is loaded from memory once */
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
+  {
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    for (k = 1; k < nvec; k++)
+    {
+      for (i = nvec - 1; i >= k; i--)
+      {
+        zd  = NV_DATA_P(Z[i - 1]);
+        zd1 = NV_DATA_P(Z[i]);
+        for (j = jb; j < je; j++) { zd[j] += c * zd1[j]; }
+      }
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * vector array operations
@@ -2132,6 +2229,8 @@ SUNErrCode N_VEnableFusedOps_Parallel(N_Vector v, sunbooleantype tf)
     v->ops->nvlinearcombination = N_VLinearCombination_Parallel;
     v->ops->nvscaleaddmulti     = N_VScaleAddMulti_Parallel;
     v->ops->nvdotprodmulti      = N_VDotProdMulti_Parallel;
+    v->ops->nvprojectsubtract   = N_VProjectSubtract_Parallel;
+    v->ops->nvpascalupdate      = N_VPascalUpdate_Parallel;
     /* enable all vector array operations */
     v->ops->nvlinearsumvectorarray     = N_VLinearSumVectorArray_Parallel;
     v->ops->nvscalevectorarray         = N_VScaleVectorArray_Parallel;
@@ -2150,6 +2249,8 @@ SUNErrCode N_VEnableFusedOps_Parallel(N_Vector v, sunbooleantype tf)
     v->ops->nvlinearcombination = NULL;
     v->ops->nvscaleaddmulti     = NULL;
     v->ops->nvdotprodmulti      = NULL;
+    v->ops->nvprojectsubtract   = NULL;
+    v->ops->nvpascalupdate      = NULL;
     /* disable all vector array operations */
     v->ops->nvlinearsumvectorarray         = NULL;
     v->ops->nvscalevectorarray             = NULL;
@@ -2198,6 +2299,28 @@ SUNErrCode N_VEnableDotProdMulti_Parallel(N_Vector v, sunbooleantype tf)
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VEnableProjectSubtract_Parallel(N_Vector v, sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+
+  /* enable/disable operation */
+  if (tf) { v->ops->nvprojectsubtract = N_VProjectSubtract_Parallel; }
+  else { v->ops->nvprojectsubtract = NULL; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnablePascalUpdate_Parallel(N_Vector v, sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+
+  /* enable/disable operation */
+  if (tf) { v->ops->nvpascalupdate = N_VPascalUpdate_Parallel; }
+  else { v->ops->nvpascalupdate = NULL; }
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode N_VEnableLinearSumVectorArray_Parallel(N_Vector v, sunbooleantype tf)
 {
   SUNFunctionBegin(v->sunctx);
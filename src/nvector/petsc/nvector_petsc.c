@@ -22,6 +22,7 @@
 #include <stdlib.h>
 
 #include <nvector/nvector_petsc.h>
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/sundials_errors.h>
 #include <sundials/sundials_math.h>
 
@@ -374,10 +375,10 @@ void N_VDestroy_Petsc(N_Vector v)
   /* free ops and vector */
   if (v->ops != NULL)
   {
-    free(v->ops);
+    SUNContext_ArenaFree(v->sunctx, v->ops);
     v->ops = NULL;
   }
-  free(v);
+  SUNContext_ArenaFree(v->sunctx, v);
   v = NULL;
 
   return;
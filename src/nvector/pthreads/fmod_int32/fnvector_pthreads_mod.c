@@ -654,6 +654,22 @@ SWIGEXPORT int _wrap_FN_VDotProdMulti_Pthreads(int const *farg1, N_Vector farg2,
 }
 
 
+SWIGEXPORT int _wrap_FN_VPascalUpdate_Pthreads(int const *farg1, double const *farg2, void *farg3) {
+  int fresult ;
+  int arg1 ;
+  sunrealtype arg2 ;
+  N_Vector *arg3 = (N_Vector *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (int)(*farg1);
+  arg2 = (sunrealtype)(*farg2);
+  arg3 = (N_Vector *)(farg3);
+  result = (SUNErrCode)N_VPascalUpdate_Pthreads(arg1,arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FN_VLinearSumVectorArray_Pthreads(int const *farg1, double const *farg2, void *farg3, double const *farg4, void *farg5, void *farg6) {
   int fresult ;
   int arg1 ;
@@ -876,6 +892,20 @@ SWIGEXPORT int _wrap_FN_VEnableDotProdMulti_Pthreads(N_Vector farg1, int const *
 }
 
 
+SWIGEXPORT int _wrap_FN_VEnablePascalUpdate_Pthreads(N_Vector farg1, int const *farg2) {
+  int fresult ;
+  N_Vector arg1 = (N_Vector) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (N_Vector)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)N_VEnableDotProdMulti_Pthreads(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FN_VEnableLinearSumVectorArray_Pthreads(N_Vector farg1, int const *farg2) {
   int fresult ;
   N_Vector arg1 = (N_Vector) 0 ;
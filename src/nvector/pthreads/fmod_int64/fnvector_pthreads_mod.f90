@@ -59,6 +59,7 @@ module fnvector_pthreads_mod
  public :: FN_VLinearCombination_Pthreads
  public :: FN_VScaleAddMulti_Pthreads
  public :: FN_VDotProdMulti_Pthreads
+ public :: FN_VPascalUpdate_Pthreads
  public :: FN_VLinearSumVectorArray_Pthreads
  public :: FN_VScaleVectorArray_Pthreads
  public :: FN_VConstVectorArray_Pthreads
@@ -73,6 +74,7 @@ module fnvector_pthreads_mod
  public :: FN_VEnableLinearCombination_Pthreads
  public :: FN_VEnableScaleAddMulti_Pthreads
  public :: FN_VEnableDotProdMulti_Pthreads
+ public :: FN_VEnablePascalUpdate_Pthreads
  public :: FN_VEnableLinearSumVectorArray_Pthreads
  public :: FN_VEnableScaleVectorArray_Pthreads
  public :: FN_VEnableConstVectorArray_Pthreads
@@ -375,6 +377,16 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FN_VPascalUpdate_Pthreads(farg1, farg2, farg3) &
+bind(C, name="_wrap_FN_VPascalUpdate_Pthreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+real(C_DOUBLE), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VLinearSumVectorArray_Pthreads(farg1, farg2, farg3, farg4, farg5, farg6) &
 bind(C, name="_wrap_FN_VLinearSumVectorArray_Pthreads") &
 result(fresult)
@@ -514,6 +526,15 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FN_VEnablePascalUpdate_Pthreads(farg1, farg2) &
+bind(C, name="_wrap_FN_VEnablePascalUpdate_Pthreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VEnableLinearSumVectorArray_Pthreads(farg1, farg2) &
 bind(C, name="_wrap_FN_VEnableLinearSumVectorArray_Pthreads") &
 result(fresult)
@@ -1100,6 +1121,25 @@ fresult = swigc_FN_VDotProdMulti_Pthreads(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FN_VPascalUpdate_Pthreads(nvec, c, z) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec
+real(C_DOUBLE), intent(in) :: c
+type(C_PTR) :: z
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+real(C_DOUBLE) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = nvec
+farg2 = c
+farg3 = z
+fresult = swigc_FN_VPascalUpdate_Pthreads(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FN_VLinearSumVectorArray_Pthreads(nvec, a, x, b, y, z) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -1363,6 +1403,22 @@ fresult = swigc_FN_VEnableDotProdMulti_Pthreads(farg1, farg2)
 swig_result = fresult
 end function
 
+function FN_VEnablePascalUpdate_Pthreads(v, tf) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(N_Vector), target, intent(inout) :: v
+integer(C_INT), intent(in) :: tf
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(v)
+farg2 = tf
+fresult = swigc_FN_VEnablePascalUpdate_Pthreads(farg1, farg2)
+swig_result = fresult
+end function
+
 function FN_VEnableLinearSumVectorArray_Pthreads(v, tf) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -28,6 +28,7 @@
 #include <nvector/nvector_pthreads.h>
 #include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/priv/sundials_nvector_impl.h>
 #include <sundials/sundials_core.h>
 #include <sundials/sundials_errors.h>
 
@@ -38,6 +39,13 @@
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Number of entries per block in N_VPascalUpdate so each block of the vectors
+   is updated while it is in cache */
+#define BLOCK_SIZE 512
+
+/* Frees a vector without returning it to the vector pool */
+static void FreeVector_Pthreads(N_Vector v);
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Pthreads(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Pthreads(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -114,6 +122,7 @@ static void* Vaxpy_PT(void* thread_data);
 static void* nvLinearCombinationPt(void* thread_data);
 static void* nvScaleAddMultiPt(void* thread_data);
 static void* nvDotProdMultiPt(void* thread_data);
+static void* nvPascalUpdatePt(void* thread_data);
 
 /* Pthread companion functions for vector array operations */
 static void* nvLinearSumVectorArrayPt(void* thread_data);
@@ -237,9 +246,13 @@ N_Vector N_VNewEmpty_Pthreads(sunindextype length, int num_threads,
   v->ops->nvprint     = N_VPrint_Pthreads;
   v->ops->nvprintfile = N_VPrintFile_Pthreads;
 
+  /* Use the shared operations table if sharing is enabled */
+  SUNCheckCallNull(N_VShareOps(v));
+
   /* Create content */
   content = NULL;
-  content = (N_VectorContent_Pthreads)malloc(sizeof *content);
+  content = (N_VectorContent_Pthreads)
+    SUNContext_ArenaAlloc(v->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Attach content */
@@ -364,15 +377,13 @@ N_Vector N_VCloneEmpty_Pthreads(N_Vector w)
 
   /* Create vector */
   v = NULL;
-  v = N_VNewEmpty(w->sunctx);
+  v = N_VNewEmptyWithOps(w);
   SUNCheckLastErrNull();
 
-  /* Attach operations */
-  SUNCheckCallNull(N_VCopyOps(w, v));
-
   /* Create content */
   content = NULL;
-  content = (N_VectorContent_Pthreads)malloc(sizeof *content);
+  content = (N_VectorContent_Pthreads)
+    SUNContext_ArenaAlloc(v->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Attach content */
@@ -399,6 +410,20 @@ N_Vector N_VClone_Pthreads(N_Vector w)
   sunrealtype* data;
   sunindextype length;
 
+  /* reuse a vector from the vector pool of the context if possible */
+  v = SUNContext_TakePooledVector(w->sunctx, SUNDIALS_NVEC_PTHREADS,
+                                  NV_LENGTH_PT(w));
+  if (v)
+  {
+    if (v->ops != w->ops)
+    {
+      SUNCheckCallNull(N_VCopyOps(w, v));
+      SUNCheckCallNull(N_VShareOps(v));
+    }
+    NV_NUM_THREADS_PT(v) = NV_NUM_THREADS_PT(w);
+    return (v);
+  }
+
   v = NULL;
   v = N_VCloneEmpty_Pthreads(w);
   SUNCheckLastErrNull();
@@ -429,26 +454,15 @@ void N_VDestroy_Pthreads(N_Vector v)
 {
   if (v == NULL) { return; }
 
-  /* free content */
-  if (v->content != NULL)
+  /* return a vector owning its data to the vector pool of the context */
+  if (v->content != NULL && NV_OWN_DATA_PT(v) && NV_DATA_PT(v) != NULL &&
+      SUNContext_PoolVector(v->sunctx, v, SUNDIALS_NVEC_PTHREADS,
+                            NV_LENGTH_PT(v), FreeVector_Pthreads))
   {
-    if (NV_OWN_DATA_PT(v) && NV_DATA_PT(v) != NULL)
-    {
-      free(NV_DATA_PT(v));
-      NV_DATA_PT(v) = NULL;
-    }
-    free(v->content);
-    v->content = NULL;
+    return;
   }
 
-  /* free ops and vector */
-  if (v->ops != NULL)
-  {
-    free(v->ops);
-    v->ops = NULL;
-  }
-  free(v);
-  v = NULL;
+  FreeVector_Pthreads(v);
 
   return;
 }
@@ -2721,6 +2735,109 @@ static void* nvDotProdMultiPt(void* thread_data)
   pthread_exit(NULL);
 }
 
+/* -----------------------------------------------------------------------------
+ * Apply the Pascal triangle update Z[i-1] += c*Z[i], i = nvec-1,...,k, for
+ * k = 1,...,nvec-1
+ */
+
+SUNErrCode N_VPascalUpdate_Pthreads(int nvec, sunrealtype c, N_Vector* Z)
+{
+  SUNFunctionBegin(Z[0]->sunctx);
+
+  sunindextype N;
+  int i, nthreads;
+  pthread_t* threads;
+  Pthreads_Data* thread_data;
+  pthread_attr_t attr;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* nothing to update */
+  if (nvec == 1) { return SUN_SUCCESS; }
+
+  /* get vector length and data array */
+  N        = NV_LENGTH_PT(Z[0]);
+  nthreads = NV_NUM_THREADS_PT(Z[0]);
+  threads  = malloc(nthreads * sizeof(pthread_t));
+  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
+
+  /* set thread attributes */
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+
+  for (i = 0; i < nthreads; i++)
+  {
+    /* initialize thread data */
+    nvInitThreadData(&thread_data[i]);
+
+    /* compute start and end loop index for thread */
+    nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
+
+    /* pack thread data */
+    thread_data[i].nvec = nvec;
+    thread_data[i].c1   = c;
+    thread_data[i].Y1   = Z;
+
+    /* create threads and call pthread companion function */
+    pthread_create(&threads[i], &attr, nvPascalUpdatePt, (void*)&thread_data[i]);
+  }
+
+  /* wait for all threads to finish */
+  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+
+  /* clean up and return */
+  pthread_attr_destroy(&attr);
+  free(threads);
+  free(thread_data);
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------------------
+ * Pthread companion function to N_VPascalUpdate
+ */
+
+static void* nvPascalUpdatePt(void* thread_data)
+{
+  Pthreads_Data* my_data;
+  sunindextype j, jb, je, start, end;
+
+  int i, k, nvec;
+  sunrealtype c;
+  sunrealtype* zd  = NULL;
+  sunrealtype* zd1 = NULL;
+
+  /* extract thread data */
+  my_data = (Pthreads_Data*)thread_data;
+
+  start = my_data->start;
+  end   = my_data->end;
+  nvec  = my_data->nvec;
+  c     = my_data->c1;
+
+  /* apply all the updates to each block of the vectors before moving on to
+     the next block, so each block is loaded from memory once */
+  for (jb = start; jb < end; jb += BLOCK_SIZE)
+  {
+    je = SUNMIN(jb + BLOCK_SIZE, end);
+    for (k = 1; k < nvec; k++)
+    {
+      for (i = nvec - 1; i >= k; i--)
+      {
+        zd  = NV_DATA_PT(my_data->Y1[i - 1]);
+        zd1 = NV_DATA_PT(my_data->Y1[i]);
+        for (j = jb; j < je; j++) { zd[j] += c * zd1[j]; }
+      }
+    }
+  }
+
+  /* exit */
+  pthread_exit(NULL);
+}
+
 /*
  * -----------------------------------------------------------------------------
  * vector array operations
@@ -5391,12 +5508,16 @@ static void nvInitThreadData(Pthreads_Data* thread_data)
 
 SUNErrCode N_VEnableFusedOps_Pthreads(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   if (tf)
   {
     /* enable all fused vector operations */
     v->ops->nvlinearcombination = N_VLinearCombination_Pthreads;
     v->ops->nvscaleaddmulti     = N_VScaleAddMulti_Pthreads;
     v->ops->nvdotprodmulti      = N_VDotProdMulti_Pthreads;
+    v->ops->nvpascalupdate      = N_VPascalUpdate_Pthreads;
     /* enable all vector array operations */
     v->ops->nvlinearsumvectorarray     = N_VLinearSumVectorArray_Pthreads;
     v->ops->nvscalevectorarray         = N_VScaleVectorArray_Pthreads;
@@ -5415,6 +5536,7 @@ SUNErrCode N_VEnableFusedOps_Pthreads(N_Vector v, sunbooleantype tf)
     v->ops->nvlinearcombination = NULL;
     v->ops->nvscaleaddmulti     = NULL;
     v->ops->nvdotprodmulti      = NULL;
+    v->ops->nvpascalupdate      = NULL;
     /* disable all vector array operations */
     v->ops->nvlinearsumvectorarray         = NULL;
     v->ops->nvscalevectorarray             = NULL;
@@ -5427,72 +5549,160 @@ SUNErrCode N_VEnableFusedOps_Pthreads(N_Vector v, sunbooleantype tf)
     v->ops->nvdotprodmultilocal = NULL;
   }
 
+  /* switch to the shared table with the new operations */
+  SUNCheckCall(N_VShareOps(v));
+
   /* return success */
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableLinearCombination_Pthreads(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvlinearcombination = tf ? N_VLinearCombination_Pthreads : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableScaleAddMulti_Pthreads(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvscaleaddmulti = tf ? N_VScaleAddMulti_Pthreads : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableDotProdMulti_Pthreads(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvdotprodmulti      = tf ? N_VDotProdMulti_Pthreads : NULL;
   v->ops->nvdotprodmultilocal = tf ? N_VDotProdMulti_Pthreads : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnablePascalUpdate_Pthreads(N_Vector v, sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
+  v->ops->nvpascalupdate = tf ? N_VPascalUpdate_Pthreads : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableLinearSumVectorArray_Pthreads(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvlinearsumvectorarray = tf ? N_VLinearSumVectorArray_Pthreads : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableScaleVectorArray_Pthreads(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvscalevectorarray = tf ? N_VScaleVectorArray_Pthreads : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableConstVectorArray_Pthreads(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvconstvectorarray = tf ? N_VConstVectorArray_Pthreads : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableWrmsNormVectorArray_Pthreads(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvwrmsnormvectorarray = tf ? N_VWrmsNormVectorArray_Pthreads : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableWrmsNormMaskVectorArray_Pthreads(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvwrmsnormmaskvectorarray = tf ? N_VWrmsNormMaskVectorArray_Pthreads
                                          : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableScaleAddMultiVectorArray_Pthreads(N_Vector v,
                                                       sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvscaleaddmultivectorarray = tf ? N_VScaleAddMultiVectorArray_Pthreads
                                           : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableLinearCombinationVectorArray_Pthreads(N_Vector v,
                                                           sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvlinearcombinationvectorarray =
     tf ? N_VLinearCombinationVectorArray_Pthreads : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
+
+/* ----------------------------------------------------------------------------
+ * Free vector memory
+ */
+
+static void FreeVector_Pthreads(N_Vector v)
+{
+  /* free content */
+  if (v->content != NULL)
+  {
+    if (NV_OWN_DATA_PT(v) && NV_DATA_PT(v) != NULL)
+    {
+      free(NV_DATA_PT(v));
+      NV_DATA_PT(v) = NULL;
+    }
+    SUNContext_ArenaFree(v->sunctx, v->content);
+    v->content = NULL;
+  }
+
+  /* free ops (releasing a shared table) and vector */
+  N_VFreeEmpty(v);
+
+  return;
+}
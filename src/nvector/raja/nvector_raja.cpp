@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include "sundials/sundials_errors.h"
 #include "sundials_debug.h"
 
@@ -686,7 +687,7 @@ void N_VDestroy_Raja(N_Vector v)
   /* free ops structure */
   if (v->ops != NULL)
   {
-    free(v->ops);
+    SUNContext_ArenaFree(v->sunctx, v->ops);
     v->ops = NULL;
   }
 
@@ -694,7 +695,7 @@ void N_VDestroy_Raja(N_Vector v)
   vc = NVEC_RAJA_CONTENT(v);
   if (vc == NULL)
   {
-    free(v);
+    SUNContext_ArenaFree(v->sunctx, v);
     v = NULL;
     return;
   }
@@ -736,7 +737,7 @@ void N_VDestroy_Raja(N_Vector v)
   free(vc);
 
   /* free vector */
-  free(v);
+  SUNContext_ArenaFree(v->sunctx, v);
 
   return;
 }
@@ -59,6 +59,8 @@ module fnvector_serial_mod
  public :: FN_VLinearCombination_Serial
  public :: FN_VScaleAddMulti_Serial
  public :: FN_VDotProdMulti_Serial
+ public :: FN_VProjectSubtract_Serial
+ public :: FN_VPascalUpdate_Serial
  public :: FN_VLinearSumVectorArray_Serial
  public :: FN_VScaleVectorArray_Serial
  public :: FN_VConstVectorArray_Serial
@@ -73,6 +75,8 @@ module fnvector_serial_mod
  public :: FN_VEnableLinearCombination_Serial
  public :: FN_VEnableScaleAddMulti_Serial
  public :: FN_VEnableDotProdMulti_Serial
+ public :: FN_VEnableProjectSubtract_Serial
+ public :: FN_VEnablePascalUpdate_Serial
  public :: FN_VEnableLinearSumVectorArray_Serial
  public :: FN_VEnableScaleVectorArray_Serial
  public :: FN_VEnableConstVectorArray_Serial
@@ -372,6 +376,28 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FN_VProjectSubtract_Serial(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FN_VProjectSubtract_Serial") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
+function swigc_FN_VPascalUpdate_Serial(farg1, farg2, farg3) &
+bind(C, name="_wrap_FN_VPascalUpdate_Serial") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+real(C_DOUBLE), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VLinearSumVectorArray_Serial(farg1, farg2, farg3, farg4, farg5, farg6) &
 bind(C, name="_wrap_FN_VLinearSumVectorArray_Serial") &
 result(fresult)
@@ -511,6 +537,24 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FN_VEnableProjectSubtract_Serial(farg1, farg2) &
+bind(C, name="_wrap_FN_VEnableProjectSubtract_Serial") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FN_VEnablePascalUpdate_Serial(farg1, farg2) &
+bind(C, name="_wrap_FN_VEnablePascalUpdate_Serial") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VEnableLinearSumVectorArray_Serial(farg1, farg2) &
 bind(C, name="_wrap_FN_VEnableLinearSumVectorArray_Serial") &
 result(fresult)
@@ -1088,6 +1132,50 @@ fresult = swigc_FN_VDotProdMulti_Serial(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FN_VProjectSubtract_Serial(nvec, x, y, dotprods, sqrnorms) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec
+type(N_Vector), target, intent(inout) :: x
+type(C_PTR) :: y
+real(C_DOUBLE), dimension(*), target, intent(inout) :: dotprods
+real(C_DOUBLE), dimension(*), target, intent(inout) :: sqrnorms
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = nvec
+farg2 = c_loc(x)
+farg3 = y
+farg4 = c_loc(dotprods(1))
+farg5 = c_loc(sqrnorms(1))
+fresult = swigc_FN_VProjectSubtract_Serial(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
+function FN_VPascalUpdate_Serial(nvec, c, z) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec
+real(C_DOUBLE), intent(in) :: c
+type(C_PTR) :: z
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+real(C_DOUBLE) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = nvec
+farg2 = c
+farg3 = z
+fresult = swigc_FN_VPascalUpdate_Serial(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FN_VLinearSumVectorArray_Serial(nvec, a, x, b, y, z) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -1351,6 +1439,38 @@ fresult = swigc_FN_VEnableDotProdMulti_Serial(farg1, farg2)
 swig_result = fresult
 end function
 
+function FN_VEnableProjectSubtract_Serial(v, tf) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(N_Vector), target, intent(inout) :: v
+integer(C_INT), intent(in) :: tf
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(v)
+farg2 = tf
+fresult = swigc_FN_VEnableProjectSubtract_Serial(farg1, farg2)
+swig_result = fresult
+end function
+
+function FN_VEnablePascalUpdate_Serial(v, tf) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(N_Vector), target, intent(inout) :: v
+integer(C_INT), intent(in) :: tf
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(v)
+farg2 = tf
+fresult = swigc_FN_VEnablePascalUpdate_Serial(farg1, farg2)
+swig_result = fresult
+end function
+
 function FN_VEnableLinearSumVectorArray_Serial(v, tf) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -22,6 +22,7 @@
 #include <nvector/nvector_serial.h>
 #include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/priv/sundials_nvector_impl.h>
 #include <sundials/sundials_core.h>
 #include <sundials/sundials_errors.h>
 
@@ -32,6 +33,15 @@
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Number of entries per block in the fused and vector array operations. Each
+   block of the shared input or output vector is reused for all the vectors in
+   the operation while it is in the L1 cache rather than streamed from memory
+   once per vector. */
+#define BLOCK_SIZE 512
+
+/* Frees a vector without returning it to the vector pool */
+static void FreeVector_Serial(N_Vector v);
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Serial(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Serial(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -146,9 +156,13 @@ N_Vector N_VNewEmpty_Serial(sunindextype length, SUNContext sunctx)
   v->ops->nvprint     = N_VPrint_Serial;
   v->ops->nvprintfile = N_VPrintFile_Serial;
 
+  /* Use the shared operations table if sharing is enabled */
+  SUNCheckCallNull(N_VShareOps(v));
+
   /* Create content */
   content = NULL;
-  content = (N_VectorContent_Serial)malloc(sizeof *content);
+  content = (N_VectorContent_Serial)
+    SUNContext_ArenaAlloc(v->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Attach content */
@@ -277,15 +291,13 @@ N_Vector N_VCloneEmpty_Serial(N_Vector w)
 
   /* Create vector */
   v = NULL;
-  v = N_VNewEmpty(w->sunctx);
+  v = N_VNewEmptyWithOps(w);
   SUNCheckLastErrNull();
 
-  /* Attach operations */
-  SUNCheckCallNull(N_VCopyOps(w, v));
-
   /* Create content */
   content = NULL;
-  content = (N_VectorContent_Serial)malloc(sizeof *content);
+  content = (N_VectorContent_Serial)
+    SUNContext_ArenaAlloc(v->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Attach content */
@@ -306,6 +318,19 @@ N_Vector N_VClone_Serial(N_Vector w)
   sunrealtype* data;
   sunindextype length;
 
+  /* reuse a vector from the vector pool of the context if possible */
+  v = SUNContext_TakePooledVector(w->sunctx, SUNDIALS_NVEC_SERIAL,
+                                  NV_LENGTH_S(w));
+  if (v)
+  {
+    if (v->ops != w->ops)
+    {
+      SUNCheckCallNull(N_VCopyOps(w, v));
+      SUNCheckCallNull(N_VShareOps(v));
+    }
+    return (v);
+  }
+
   v = NULL;
   v = N_VCloneEmpty_Serial(w);
   SUNCheckLastErrNull();
@@ -331,27 +356,15 @@ void N_VDestroy_Serial(N_Vector v)
 {
   if (v == NULL) { return; }
 
-  /* free content */
-  if (v->content != NULL)
+  /* return a vector owning its data to the vector pool of the context */
+  if (v->content != NULL && NV_OWN_DATA_S(v) && NV_DATA_S(v) != NULL &&
+      SUNContext_PoolVector(v->sunctx, v, SUNDIALS_NVEC_SERIAL,
+                            NV_LENGTH_S(v), FreeVector_Serial))
   {
-    /* free data array if it's owned by the vector */
-    if (NV_OWN_DATA_S(v) && NV_DATA_S(v) != NULL)
-    {
-      free(NV_DATA_S(v));
-      NV_DATA_S(v) = NULL;
-    }
-    free(v->content);
-    v->content = NULL;
+    return;
   }
 
-  /* free ops and vector */
-  if (v->ops != NULL)
-  {
-    free(v->ops);
-    v->ops = NULL;
-  }
-  free(v);
-  v = NULL;
+  FreeVector_Serial(v);
 
   return;
 }
@@ -871,7 +884,7 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
   SUNFunctionBegin(X[0]->sunctx);
 
   int i;
-  sunindextype j, N;
+  sunindextype j, jb, je, N;
   sunrealtype* zd = NULL;
   sunrealtype* xd = NULL;
 
@@ -903,10 +916,14 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
    */
   if ((X[0] == z) && (c[0] == ONE))
   {
-    for (i = 1; i < nvec; i++)
+    for (jb = 0; jb < N; jb += BLOCK_SIZE)
     {
-      xd = NV_DATA_S(X[i]);
-      for (j = 0; j < N; j++) { zd[j] += c[i] * xd[j]; }
+      je = SUNMIN(jb + BLOCK_SIZE, N);
+      for (i = 1; i < nvec; i++)
+      {
+        xd = NV_DATA_S(X[i]);
+        for (j = jb; j < je; j++) { zd[j] += c[i] * xd[j]; }
+      }
     }
     return SUN_SUCCESS;
   }
@@ -916,11 +933,15 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
    */
   if (X[0] == z)
   {
-    for (j = 0; j < N; j++) { zd[j] *= c[0]; }
-    for (i = 1; i < nvec; i++)
+    for (jb = 0; jb < N; jb += BLOCK_SIZE)
     {
-      xd = NV_DATA_S(X[i]);
-      for (j = 0; j < N; j++) { zd[j] += c[i] * xd[j]; }
+      je = SUNMIN(jb + BLOCK_SIZE, N);
+      for (j = jb; j < je; j++) { zd[j] *= c[0]; }
+      for (i = 1; i < nvec; i++)
+      {
+        xd = NV_DATA_S(X[i]);
+        for (j = jb; j < je; j++) { zd[j] += c[i] * xd[j]; }
+      }
     }
     return SUN_SUCCESS;
   }
@@ -928,12 +949,16 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
   /*
    * z = sum{ c[i] * X[i] }, i = 0,...,nvec-1
    */
-  xd = NV_DATA_S(X[0]);
-  for (j = 0; j < N; j++) { zd[j] = c[0] * xd[j]; }
-  for (i = 1; i < nvec; i++)
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
   {
-    xd = NV_DATA_S(X[i]);
-    for (j = 0; j < N; j++) { zd[j] += c[i] * xd[j]; }
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    xd = NV_DATA_S(X[0]);
+    for (j = jb; j < je; j++) { zd[j] = c[0] * xd[j]; }
+    for (i = 1; i < nvec; i++)
+    {
+      xd = NV_DATA_S(X[i]);
+      for (j = jb; j < je; j++) { zd[j] += c[i] * xd[j]; }
+    }
   }
   return SUN_SUCCESS;
 }
@@ -943,7 +968,7 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
 {
   SUNFunctionBegin(x->sunctx);
   int i;
-  sunindextype j, N;
+  sunindextype j, jb, je, N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
   sunrealtype* zd = NULL;
@@ -968,10 +993,14 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
    */
   if (Y == Z)
   {
-    for (i = 0; i < nvec; i++)
+    for (jb = 0; jb < N; jb += BLOCK_SIZE)
     {
-      yd = NV_DATA_S(Y[i]);
-      for (j = 0; j < N; j++) { yd[j] += a[i] * xd[j]; }
+      je = SUNMIN(jb + BLOCK_SIZE, N);
+      for (i = 0; i < nvec; i++)
+      {
+        yd = NV_DATA_S(Y[i]);
+        for (j = jb; j < je; j++) { yd[j] += a[i] * xd[j]; }
+      }
     }
     return SUN_SUCCESS;
   }
@@ -979,11 +1008,15 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
   /*
    * Z[i][j] = Y[i][j] + a[i] * x[j]
    */
-  for (i = 0; i < nvec; i++)
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
   {
-    yd = NV_DATA_S(Y[i]);
-    zd = NV_DATA_S(Z[i]);
-    for (j = 0; j < N; j++) { zd[j] = a[i] * xd[j] + yd[j]; }
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    for (i = 0; i < nvec; i++)
+    {
+      yd = NV_DATA_S(Y[i]);
+      zd = NV_DATA_S(Z[i]);
+      for (j = jb; j < je; j++) { zd[j] = a[i] * xd[j] + yd[j]; }
+    }
   }
   return SUN_SUCCESS;
 }
@@ -993,7 +1026,7 @@ SUNErrCode N_VDotProdMulti_Serial(int nvec, N_Vector x, N_Vector* Y,
 {
   SUNFunctionBegin(x->sunctx);
   int i;
-  sunindextype j, N;
+  sunindextype j, jb, je, N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
 
@@ -1013,11 +1046,98 @@ SUNErrCode N_VDotProdMulti_Serial(int nvec, N_Vector x, N_Vector* Y,
   xd = NV_DATA_S(x);
 
   /* compute multiple dot products */
-  for (i = 0; i < nvec; i++)
+  for (i = 0; i < nvec; i++) { dotprods[i] = ZERO; }
+
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
   {
-    yd          = NV_DATA_S(Y[i]);
-    dotprods[i] = ZERO;
-    for (j = 0; j < N; j++) { dotprods[i] += xd[j] * yd[j]; }
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    for (i = 0; i < nvec; i++)
+    {
+      yd = NV_DATA_S(Y[i]);
+      for (j = jb; j < je; j++) { dotprods[i] += xd[j] * yd[j]; }
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VProjectSubtract_Serial(int nvec, N_Vector x, N_Vector* Y,
+                                     sunrealtype* dotprods,
+                                     sunrealtype* sqrnorms)
+{
+  SUNFunctionBegin(x->sunctx);
+  int i;
+  sunindextype j, jb, je, N;
+  sunrealtype* xd = NULL;
+  sunrealtype* yd = NULL;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length and data array */
+  N  = NV_LENGTH_S(x);
+  xd = NV_DATA_S(x);
+
+  /* compute the dot products and the squared norm of x */
+  sqrnorms[0] = ZERO;
+  for (i = 0; i < nvec; i++) { dotprods[i] = ZERO; }
+
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
+  {
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    for (j = jb; j < je; j++) { sqrnorms[0] += xd[j] * xd[j]; }
+    for (i = 0; i < nvec; i++)
+    {
+      yd = NV_DATA_S(Y[i]);
+      for (j = jb; j < je; j++) { dotprods[i] += xd[j] * yd[j]; }
+    }
+  }
+
+  /* subtract the projection and compute the new squared norm of x */
+  sqrnorms[1] = ZERO;
+
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
+  {
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    for (i = 0; i < nvec; i++)
+    {
+      yd = NV_DATA_S(Y[i]);
+      for (j = jb; j < je; j++) { xd[j] -= dotprods[i] * yd[j]; }
+    }
+    for (j = jb; j < je; j++) { sqrnorms[1] += xd[j] * xd[j]; }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VPascalUpdate_Serial(int nvec, sunrealtype c, N_Vector* Z)
+{
+  SUNFunctionBegin(Z[0]->sunctx);
+  int i, k;
+  sunindextype j, jb, je, N;
+  sunrealtype* zd  = NULL;
+  sunrealtype* zd1 = NULL;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length */
+  N = NV_LENGTH_S(Z[0]);
+
+  /* apply all the updates to each block of the vectors before moving on to
+     the next block, so each block is loaded from memory once */
+  for (jb = 0; jb < N; jb += BLOCK_SIZE)
+  {
+    je = SUNMIN(jb + BLOCK_SIZE, N);
+    for (k = 1; k < nvec; k++)
+    {
+      for (i = nvec - 1; i >= k; i--)
+      {
+        zd  = NV_DATA_S(Z[i - 1]);
+        zd1 = NV_DATA_S(Z[i]);
+        for (j = jb; j < je; j++) { zd[j] += c * zd1[j]; }
+      }
+    }
   }
 
   return SUN_SUCCESS;
@@ -1309,7 +1429,7 @@ SUNErrCode N_VScaleAddMultiVectorArray_Serial(int nvec, int nsum,
 {
   SUNFunctionBegin(X[0]->sunctx);
   int i, j;
-  sunindextype k, N;
+  sunindextype k, kb, ke, N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
   sunrealtype* zd = NULL;
@@ -1379,10 +1499,14 @@ SUNErrCode N_VScaleAddMultiVectorArray_Serial(int nvec, int nsum,
     for (i = 0; i < nvec; i++)
     {
       xd = NV_DATA_S(X[i]);
-      for (j = 0; j < nsum; j++)
+      for (kb = 0; kb < N; kb += BLOCK_SIZE)
       {
-        yd = NV_DATA_S(Y[j][i]);
-        for (k = 0; k < N; k++) { yd[k] += a[j] * xd[k]; }
+        ke = SUNMIN(kb + BLOCK_SIZE, N);
+        for (j = 0; j < nsum; j++)
+        {
+          yd = NV_DATA_S(Y[j][i]);
+          for (k = kb; k < ke; k++) { yd[k] += a[j] * xd[k]; }
+        }
       }
     }
     return SUN_SUCCESS;
@@ -1394,11 +1518,15 @@ SUNErrCode N_VScaleAddMultiVectorArray_Serial(int nvec, int nsum,
   for (i = 0; i < nvec; i++)
   {
     xd = NV_DATA_S(X[i]);
-    for (j = 0; j < nsum; j++)
+    for (kb = 0; kb < N; kb += BLOCK_SIZE)
     {
-      yd = NV_DATA_S(Y[j][i]);
-      zd = NV_DATA_S(Z[j][i]);
-      for (k = 0; k < N; k++) { zd[k] = a[j] * xd[k] + yd[k]; }
+      ke = SUNMIN(kb + BLOCK_SIZE, N);
+      for (j = 0; j < nsum; j++)
+      {
+        yd = NV_DATA_S(Y[j][i]);
+        zd = NV_DATA_S(Z[j][i]);
+        for (k = kb; k < ke; k++) { zd[k] = a[j] * xd[k] + yd[k]; }
+      }
     }
   }
   return SUN_SUCCESS;
@@ -1412,7 +1540,7 @@ SUNErrCode N_VLinearCombinationVectorArray_Serial(int nvec, int nsum,
   int i;          /* vector arrays index in summation [0,nsum) */
   int j;          /* vector index in vector array     [0,nvec) */
   sunindextype k; /* element index in vector          [0,N)    */
-  sunindextype N;
+  sunindextype kb, ke, N;
   sunrealtype* zd = NULL;
   sunrealtype* xd = NULL;
   sunrealtype* ctmp;
@@ -1496,10 +1624,14 @@ SUNErrCode N_VLinearCombinationVectorArray_Serial(int nvec, int nsum,
     for (j = 0; j < nvec; j++)
     {
       zd = NV_DATA_S(Z[j]);
-      for (i = 1; i < nsum; i++)
+      for (kb = 0; kb < N; kb += BLOCK_SIZE)
       {
-        xd = NV_DATA_S(X[i][j]);
-        for (k = 0; k < N; k++) { zd[k] += c[i] * xd[k]; }
+        ke = SUNMIN(kb + BLOCK_SIZE, N);
+        for (i = 1; i < nsum; i++)
+        {
+          xd = NV_DATA_S(X[i][j]);
+          for (k = kb; k < ke; k++) { zd[k] += c[i] * xd[k]; }
+        }
       }
     }
     return SUN_SUCCESS;
@@ -1513,11 +1645,15 @@ SUNErrCode N_VLinearCombinationVectorArray_Serial(int nvec, int nsum,
     for (j = 0; j < nvec; j++)
     {
       zd = NV_DATA_S(Z[j]);
-      for (k = 0; k < N; k++) { zd[k] *= c[0]; }
-      for (i = 1; i < nsum; i++)
+      for (kb = 0; kb < N; kb += BLOCK_SIZE)
       {
-        xd = NV_DATA_S(X[i][j]);
-        for (k = 0; k < N; k++) { zd[k] += c[i] * xd[k]; }
+        ke = SUNMIN(kb + BLOCK_SIZE, N);
+        for (k = kb; k < ke; k++) { zd[k] *= c[0]; }
+        for (i = 1; i < nsum; i++)
+        {
+          xd = NV_DATA_S(X[i][j]);
+          for (k = kb; k < ke; k++) { zd[k] += c[i] * xd[k]; }
+        }
       }
     }
     return SUN_SUCCESS;
@@ -1528,13 +1664,17 @@ SUNErrCode N_VLinearCombinationVectorArray_Serial(int nvec, int nsum,
    */
   for (j = 0; j < nvec; j++)
   {
-    xd = NV_DATA_S(X[0][j]);
     zd = NV_DATA_S(Z[j]);
-    for (k = 0; k < N; k++) { zd[k] = c[0] * xd[k]; }
-    for (i = 1; i < nsum; i++)
+    for (kb = 0; kb < N; kb += BLOCK_SIZE)
     {
-      xd = NV_DATA_S(X[i][j]);
-      for (k = 0; k < N; k++) { zd[k] += c[i] * xd[k]; }
+      ke = SUNMIN(kb + BLOCK_SIZE, N);
+      xd = NV_DATA_S(X[0][j]);
+      for (k = kb; k < ke; k++) { zd[k] = c[0] * xd[k]; }
+      for (i = 1; i < nsum; i++)
+      {
+        xd = NV_DATA_S(X[i][j]);
+        for (k = kb; k < ke; k++) { zd[k] += c[i] * xd[k]; }
+      }
     }
   }
   return SUN_SUCCESS;
@@ -1944,12 +2084,17 @@ static void VaxpyVectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
 
 SUNErrCode N_VEnableFusedOps_Serial(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   if (tf)
   {
     /* enable all fused vector operations */
     v->ops->nvlinearcombination = N_VLinearCombination_Serial;
     v->ops->nvscaleaddmulti     = N_VScaleAddMulti_Serial;
     v->ops->nvdotprodmulti      = N_VDotProdMulti_Serial;
+    v->ops->nvprojectsubtract   = N_VProjectSubtract_Serial;
+    v->ops->nvpascalupdate      = N_VPascalUpdate_Serial;
     /* enable all vector array operations */
     v->ops->nvlinearsumvectorarray     = N_VLinearSumVectorArray_Serial;
     v->ops->nvscalevectorarray         = N_VScaleVectorArray_Serial;
@@ -1968,6 +2113,8 @@ SUNErrCode N_VEnableFusedOps_Serial(N_Vector v, sunbooleantype tf)
     v->ops->nvlinearcombination = NULL;
     v->ops->nvscaleaddmulti     = NULL;
     v->ops->nvdotprodmulti      = NULL;
+    v->ops->nvprojectsubtract   = NULL;
+    v->ops->nvpascalupdate      = NULL;
     /* disable all vector array operations */
     v->ops->nvlinearsumvectorarray         = NULL;
     v->ops->nvscalevectorarray             = NULL;
@@ -1980,71 +2127,171 @@ SUNErrCode N_VEnableFusedOps_Serial(N_Vector v, sunbooleantype tf)
     v->ops->nvdotprodmultilocal = NULL;
   }
 
+  /* switch to the shared table with the new operations */
+  SUNCheckCall(N_VShareOps(v));
+
   /* return success */
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableLinearCombination_Serial(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvlinearcombination = tf ? N_VLinearCombination_Serial : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableScaleAddMulti_Serial(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvscaleaddmulti = tf ? N_VScaleAddMulti_Serial : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableDotProdMulti_Serial(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvdotprodmulti      = tf ? N_VDotProdMulti_Serial : NULL;
   v->ops->nvdotprodmultilocal = tf ? N_VDotProdMulti_Serial : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableProjectSubtract_Serial(N_Vector v, sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
+  v->ops->nvprojectsubtract = tf ? N_VProjectSubtract_Serial : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnablePascalUpdate_Serial(N_Vector v, sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
+  v->ops->nvpascalupdate = tf ? N_VPascalUpdate_Serial : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableLinearSumVectorArray_Serial(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvlinearsumvectorarray = tf ? N_VLinearSumVectorArray_Serial : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableScaleVectorArray_Serial(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvscalevectorarray = tf ? N_VScaleVectorArray_Serial : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableConstVectorArray_Serial(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvconstvectorarray = tf ? N_VConstVectorArray_Serial : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableWrmsNormVectorArray_Serial(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvwrmsnormvectorarray = tf ? N_VWrmsNormVectorArray_Serial : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableWrmsNormMaskVectorArray_Serial(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvwrmsnormmaskvectorarray = tf ? N_VWrmsNormMaskVectorArray_Serial
                                          : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableScaleAddMultiVectorArray_Serial(N_Vector v, sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvscaleaddmultivectorarray = tf ? N_VScaleAddMultiVectorArray_Serial
                                           : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
 
 SUNErrCode N_VEnableLinearCombinationVectorArray_Serial(N_Vector v,
                                                         sunbooleantype tf)
 {
+  SUNFunctionBegin(v->sunctx);
+  SUNCheckCall(N_VUnshareOps(v));
+
   v->ops->nvlinearcombinationvectorarray =
     tf ? N_VLinearCombinationVectorArray_Serial : NULL;
+
+  SUNCheckCall(N_VShareOps(v));
   return SUN_SUCCESS;
 }
+
+/* ----------------------------------------------------------------------------
+ * Free vector memory
+ */
+
+static void FreeVector_Serial(N_Vector v)
+{
+  /* free content */
+  if (v->content != NULL)
+  {
+    /* free data array if it's owned by the vector */
+    if (NV_OWN_DATA_S(v) && NV_DATA_S(v) != NULL)
+    {
+      free(NV_DATA_S(v));
+      NV_DATA_S(v) = NULL;
+    }
+    SUNContext_ArenaFree(v->sunctx, v->content);
+    v->content = NULL;
+  }
+
+  /* free ops (releasing a shared table) and vector */
+  N_VFreeEmpty(v);
+
+  return;
+}
@@ -24,6 +24,7 @@
 #include <sunmemory/sunmemory_sycl.h>
 
 /* SUNDIALS private headers */
+#include <sundials/priv/sundials_context_impl.h>
 #include "sundials/sundials_errors.h"
 #include "sundials_debug.h"
 #include "sundials_sycl.h"
@@ -807,7 +808,7 @@ void N_VDestroy_Sycl(N_Vector v)
   /* free ops structure */
   if (v->ops != NULL)
   {
-    free(v->ops);
+    SUNContext_ArenaFree(v->sunctx, v->ops);
     v->ops = NULL;
   }
 
@@ -815,7 +816,7 @@ void N_VDestroy_Sycl(N_Vector v)
   vc = NVEC_SYCL_CONTENT(v);
   if (vc == NULL)
   {
-    free(v);
+    SUNContext_ArenaFree(v->sunctx, v);
     v = NULL;
     return;
   }
@@ -858,7 +859,7 @@ void N_VDestroy_Sycl(N_Vector v)
 
   /* free content struct and vector */
   free(vc);
-  free(v);
+  SUNContext_ArenaFree(v->sunctx, v);
 
   return;
 }
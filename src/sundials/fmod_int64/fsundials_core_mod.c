@@ -295,6 +295,9 @@ SWIGINTERN SwigArrayWrapper SwigArrayWrapper_uninitialized() {
 #include "sundials/sundials_stepper.h"
 
 
+#include "sundials/sundials_steptrace.h"
+
+
 #include "sundials/sundials_memory.h"
 
 
@@ -498,6 +501,114 @@ SWIGEXPORT int _wrap_FSUNContext_SetLogger(void *farg1, void *farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FSUNContext_SetVectorPool(void *farg1, int const *farg2) {
+  int fresult ;
+  SUNContext arg1 = (SUNContext) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNContext)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)SUNContext_SetVectorPool(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNContext_TrimVectorPool(void *farg1, long const *farg2) {
+  int fresult ;
+  SUNContext arg1 = (SUNContext) 0 ;
+  long arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNContext)(farg1);
+  arg2 = (long)(*farg2);
+  result = (SUNErrCode)SUNContext_TrimVectorPool(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNContext_GetVectorPoolStats(void *farg1, long *farg2, long *farg3, long *farg4, long *farg5) {
+  int fresult ;
+  SUNContext arg1 = (SUNContext) 0 ;
+  long *arg2 = (long *) 0 ;
+  long *arg3 = (long *) 0 ;
+  long *arg4 = (long *) 0 ;
+  long *arg5 = (long *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNContext)(farg1);
+  arg2 = (long *)(farg2);
+  arg3 = (long *)(farg3);
+  arg4 = (long *)(farg4);
+  arg5 = (long *)(farg5);
+  result = (SUNErrCode)SUNContext_GetVectorPoolStats(arg1,arg2,arg3,arg4,arg5);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNContext_SetArena(void *farg1, int const *farg2) {
+  int fresult ;
+  SUNContext arg1 = (SUNContext) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNContext)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)SUNContext_SetArena(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNContext_GetArenaStats(void *farg1, long *farg2, long *farg3, long *farg4) {
+  int fresult ;
+  SUNContext arg1 = (SUNContext) 0 ;
+  long *arg2 = (long *) 0 ;
+  long *arg3 = (long *) 0 ;
+  long *arg4 = (long *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNContext)(farg1);
+  arg2 = (long *)(farg2);
+  arg3 = (long *)(farg3);
+  arg4 = (long *)(farg4);
+  result = (SUNErrCode)SUNContext_GetArenaStats(arg1,arg2,arg3,arg4);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNContext_SetSharedVectorOps(void *farg1, int const *farg2) {
+  int fresult ;
+  SUNContext arg1 = (SUNContext) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNContext)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)SUNContext_SetSharedVectorOps(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNContext_GetNumSharedVectorOps(void *farg1, long *farg2) {
+  int fresult ;
+  SUNContext arg1 = (SUNContext) 0 ;
+  long *arg2 = (long *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNContext)(farg1);
+  arg2 = (long *)(farg2);
+  result = (SUNErrCode)SUNContext_GetNumSharedVectorOps(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNContext_Free(void *farg1) {
   int fresult ;
   SUNContext *arg1 = (SUNContext *) 0 ;
@@ -738,6 +849,22 @@ SWIGEXPORT int _wrap_FSUNLogger_SetInfoFilename(void *farg1, SwigArrayWrapper *f
 }
 
 
+SWIGEXPORT int _wrap_FSUNLogger_SetBinaryFilename(void *farg1, SwigArrayWrapper *farg2, size_t const *farg3) {
+  int fresult ;
+  SUNLogger arg1 = (SUNLogger) 0 ;
+  char *arg2 = (char *) 0 ;
+  size_t arg3 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNLogger)(farg1);
+  arg2 = (char *)(farg2->data);
+  arg3 = (size_t)(*farg3);
+  result = (SUNErrCode)SUNLogger_SetBinaryFilename(arg1,(char const *)arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNLogger_QueueMsg(void *farg1, int const *farg2, SwigArrayWrapper *farg3, SwigArrayWrapper *farg4, SwigArrayWrapper *farg5) {
   int fresult ;
   SUNLogger arg1 = (SUNLogger) 0 ;
@@ -1273,6 +1400,42 @@ SWIGEXPORT int _wrap_FN_VDotProdMulti(int const *farg1, N_Vector farg2, void *fa
 }
 
 
+SWIGEXPORT int _wrap_FN_VProjectSubtract(int const *farg1, N_Vector farg2, void *farg3, double *farg4, double *farg5) {
+  int fresult ;
+  int arg1 ;
+  N_Vector arg2 = (N_Vector) 0 ;
+  N_Vector *arg3 = (N_Vector *) 0 ;
+  sunrealtype *arg4 = (sunrealtype *) 0 ;
+  sunrealtype *arg5 = (sunrealtype *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (int)(*farg1);
+  arg2 = (N_Vector)(farg2);
+  arg3 = (N_Vector *)(farg3);
+  arg4 = (sunrealtype *)(farg4);
+  arg5 = (sunrealtype *)(farg5);
+  result = (SUNErrCode)N_VProjectSubtract(arg1,arg2,arg3,arg4,arg5);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FN_VPascalUpdate(int const *farg1, double const *farg2, void *farg3) {
+  int fresult ;
+  int arg1 ;
+  sunrealtype arg2 ;
+  N_Vector *arg3 = (N_Vector *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (int)(*farg1);
+  arg2 = (sunrealtype)(*farg2);
+  arg3 = (N_Vector *)(farg3);
+  result = (SUNErrCode)N_VPascalUpdate(arg1,arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FN_VLinearSumVectorArray(int const *farg1, double const *farg2, void *farg3, double const *farg4, void *farg5, void *farg6) {
   int fresult ;
   int arg1 ;
@@ -2233,6 +2396,28 @@ SWIGEXPORT int _wrap_FSUNLinSolSolve(SUNLinearSolver farg1, SUNMatrix farg2, N_V
 }
 
 
+SWIGEXPORT int _wrap_FSUNLinSolSolveMultiple(SUNLinearSolver farg1, SUNMatrix farg2, int const *farg3, void *farg4, void *farg5, double const *farg6) {
+  int fresult ;
+  SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
+  SUNMatrix arg2 = (SUNMatrix) 0 ;
+  int arg3 ;
+  N_Vector *arg4 = (N_Vector *) 0 ;
+  N_Vector *arg5 = (N_Vector *) 0 ;
+  sunrealtype arg6 ;
+  int result;
+  
+  arg1 = (SUNLinearSolver)(farg1);
+  arg2 = (SUNMatrix)(farg2);
+  arg3 = (int)(*farg3);
+  arg4 = (N_Vector *)(farg4);
+  arg5 = (N_Vector *)(farg5);
+  arg6 = (sunrealtype)(*farg6);
+  result = (int)SUNLinSolSolveMultiple(arg1,arg2,arg3,arg4,arg5,arg6);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNLinSolNumIters(SUNLinearSolver farg1) {
   int fresult ;
   SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
@@ -3113,6 +3298,186 @@ SWIGEXPORT int _wrap_FSUNStepper_SetDestroyFn(void *farg1, SUNStepperDestroyFn f
 }
 
 
+SWIGEXPORT int _wrap_FSUNStepTrace_Create(long const *farg1, void *farg2, void *farg3) {
+  int fresult ;
+  long arg1 ;
+  SUNContext arg2 = (SUNContext) 0 ;
+  SUNStepTrace *arg3 = (SUNStepTrace *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (long)(*farg1);
+  arg2 = (SUNContext)(farg2);
+  arg3 = (SUNStepTrace *)(farg3);
+  result = (SUNErrCode)SUNStepTrace_Create(arg1,arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNStepTrace_Destroy(void *farg1) {
+  int fresult ;
+  SUNStepTrace *arg1 = (SUNStepTrace *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNStepTrace *)(farg1);
+  result = (SUNErrCode)SUNStepTrace_Destroy(arg1);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNStepTrace_BeginStep(void *farg1, double const *farg2, double const *farg3, int const *farg4, long const *farg5, long const *farg6, long const *farg7, long const *farg8) {
+  int fresult ;
+  SUNStepTrace arg1 = (SUNStepTrace) 0 ;
+  sunrealtype arg2 ;
+  sunrealtype arg3 ;
+  int arg4 ;
+  long arg5 ;
+  long arg6 ;
+  long arg7 ;
+  long arg8 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNStepTrace)(farg1);
+  arg2 = (sunrealtype)(*farg2);
+  arg3 = (sunrealtype)(*farg3);
+  arg4 = (int)(*farg4);
+  arg5 = (long)(*farg5);
+  arg6 = (long)(*farg6);
+  arg7 = (long)(*farg7);
+  arg8 = (long)(*farg8);
+  result = (SUNErrCode)SUNStepTrace_BeginStep(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNStepTrace_EndStep(void *farg1, int const *farg2, double const *farg3, long const *farg4, long const *farg5, long const *farg6, long const *farg7) {
+  int fresult ;
+  SUNStepTrace arg1 = (SUNStepTrace) 0 ;
+  SUNStepTraceStatus arg2 ;
+  sunrealtype arg3 ;
+  long arg4 ;
+  long arg5 ;
+  long arg6 ;
+  long arg7 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNStepTrace)(farg1);
+  arg2 = (SUNStepTraceStatus)(*farg2);
+  arg3 = (sunrealtype)(*farg3);
+  arg4 = (long)(*farg4);
+  arg5 = (long)(*farg5);
+  arg6 = (long)(*farg6);
+  arg7 = (long)(*farg7);
+  result = (SUNErrCode)SUNStepTrace_EndStep(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNStepTrace_GetNumRecords(void *farg1, long *farg2) {
+  int fresult ;
+  SUNStepTrace arg1 = (SUNStepTrace) 0 ;
+  long *arg2 = (long *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNStepTrace)(farg1);
+  arg2 = (long *)(farg2);
+  result = (SUNErrCode)SUNStepTrace_GetNumRecords(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNStepTrace_GetNumDropped(void *farg1, long *farg2) {
+  int fresult ;
+  SUNStepTrace arg1 = (SUNStepTrace) 0 ;
+  long *arg2 = (long *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNStepTrace)(farg1);
+  arg2 = (long *)(farg2);
+  result = (SUNErrCode)SUNStepTrace_GetNumDropped(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNStepTrace_GetRealField(void *farg1, int const *farg2, void *farg3) {
+  int fresult ;
+  SUNStepTrace arg1 = (SUNStepTrace) 0 ;
+  SUNStepTraceField arg2 ;
+  sunrealtype **arg3 = (sunrealtype **) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNStepTrace)(farg1);
+  arg2 = (SUNStepTraceField)(*farg2);
+  arg3 = (sunrealtype **)(farg3);
+  result = (SUNErrCode)SUNStepTrace_GetRealField(arg1,arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNStepTrace_GetLongField(void *farg1, int const *farg2, void *farg3) {
+  int fresult ;
+  SUNStepTrace arg1 = (SUNStepTrace) 0 ;
+  SUNStepTraceField arg2 ;
+  long **arg3 = (long **) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNStepTrace)(farg1);
+  arg2 = (SUNStepTraceField)(*farg2);
+  arg3 = (long **)(farg3);
+  result = (SUNErrCode)SUNStepTrace_GetLongField(arg1,arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNStepTrace_Write(void *farg1, void *farg2, int const *farg3) {
+  int fresult ;
+  SUNStepTrace arg1 = (SUNStepTrace) 0 ;
+  FILE *arg2 = (FILE *) 0 ;
+  SUNOutputFormat arg3 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNStepTrace)(farg1);
+  arg2 = (FILE *)(farg2);
+  arg3 = (SUNOutputFormat)(*farg3);
+  result = (SUNErrCode)SUNStepTrace_Write(arg1,arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNStepTrace_WriteBinary(void *farg1, void *farg2) {
+  int fresult ;
+  SUNStepTrace arg1 = (SUNStepTrace) 0 ;
+  FILE *arg2 = (FILE *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNStepTrace)(farg1);
+  arg2 = (FILE *)(farg2);
+  result = (SUNErrCode)SUNStepTrace_WriteBinary(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNStepTrace_Reset(void *farg1) {
+  int fresult ;
+  SUNStepTrace arg1 = (SUNStepTrace) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNStepTrace)(farg1);
+  result = (SUNErrCode)SUNStepTrace_Reset(arg1);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT void * _wrap_FSUNMemoryNewEmpty(void *farg1) {
   void * fresult ;
   SUNContext arg1 = (SUNContext) 0 ;
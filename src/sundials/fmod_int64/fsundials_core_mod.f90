@@ -121,6 +121,13 @@ module fsundials_core_mod
  public :: FSUNContext_SetProfiler
  public :: FSUNContext_GetLogger
  public :: FSUNContext_SetLogger
+ public :: FSUNContext_SetVectorPool
+ public :: FSUNContext_TrimVectorPool
+ public :: FSUNContext_GetVectorPoolStats
+ public :: FSUNContext_SetArena
+ public :: FSUNContext_GetArenaStats
+ public :: FSUNContext_SetSharedVectorOps
+ public :: FSUNContext_GetNumSharedVectorOps
  public :: FSUNContext_Free
  public :: FSUNProfiler_Create
  public :: FSUNProfiler_Free
@@ -148,6 +155,7 @@ module fsundials_core_mod
  public :: FSUNLogger_SetWarningFilename
  public :: FSUNLogger_SetDebugFilename
  public :: FSUNLogger_SetInfoFilename
+ public :: FSUNLogger_SetBinaryFilename
  public :: FSUNLogger_QueueMsg
  public :: FSUNLogger_Flush
  public :: FSUNLogger_GetOutputRank
@@ -214,6 +222,8 @@ module fsundials_core_mod
   type(C_FUNPTR), public :: nvlinearcombination
   type(C_FUNPTR), public :: nvscaleaddmulti
   type(C_FUNPTR), public :: nvdotprodmulti
+  type(C_FUNPTR), public :: nvprojectsubtract
+  type(C_FUNPTR), public :: nvpascalupdate
   type(C_FUNPTR), public :: nvlinearsumvectorarray
   type(C_FUNPTR), public :: nvscalevectorarray
   type(C_FUNPTR), public :: nvconstvectorarray
@@ -278,6 +288,8 @@ module fsundials_core_mod
  public :: FN_VLinearCombination
  public :: FN_VScaleAddMulti
  public :: FN_VDotProdMulti
+ public :: FN_VProjectSubtract
+ public :: FN_VPascalUpdate
  public :: FN_VLinearSumVectorArray
  public :: FN_VScaleVectorArray
  public :: FN_VConstVectorArray
@@ -320,11 +332,12 @@ module fsundials_core_mod
   enumerator :: SUNMATRIX_CUSPARSE
   enumerator :: SUNMATRIX_GINKGO
   enumerator :: SUNMATRIX_KOKKOSDENSE
+  enumerator :: SUNMATRIX_BLOCKTRIDIAG
   enumerator :: SUNMATRIX_CUSTOM
  end enum
  integer, parameter, public :: SUNMatrix_ID = kind(SUNMATRIX_DENSE)
  public :: SUNMATRIX_DENSE, SUNMATRIX_MAGMADENSE, SUNMATRIX_ONEMKLDENSE, SUNMATRIX_BAND, SUNMATRIX_SPARSE, SUNMATRIX_SLUNRLOC, &
-    SUNMATRIX_CUSPARSE, SUNMATRIX_GINKGO, SUNMATRIX_KOKKOSDENSE, SUNMATRIX_CUSTOM
+    SUNMATRIX_CUSPARSE, SUNMATRIX_GINKGO, SUNMATRIX_KOKKOSDENSE, SUNMATRIX_BLOCKTRIDIAG, SUNMATRIX_CUSTOM
  ! struct struct _generic_SUNMatrix_Ops
  type, bind(C), public :: SUNMatrix_Ops
   type(C_FUNPTR), public :: getid
@@ -410,6 +423,8 @@ module fsundials_core_mod
   enumerator :: SUNLINEARSOLVER_ONEMKLDENSE
   enumerator :: SUNLINEARSOLVER_GINKGO
   enumerator :: SUNLINEARSOLVER_KOKKOSDENSE
+  enumerator :: SUNLINEARSOLVER_MIXEDPREC
+  enumerator :: SUNLINEARSOLVER_BLOCKTRIDIAG
   enumerator :: SUNLINEARSOLVER_CUSTOM
  end enum
  integer, parameter, public :: SUNLinearSolver_ID = kind(SUNLINEARSOLVER_BAND)
@@ -417,7 +432,7 @@ module fsundials_core_mod
     SUNLINEARSOLVER_LAPACKDENSE, SUNLINEARSOLVER_PCG, SUNLINEARSOLVER_SPBCGS, SUNLINEARSOLVER_SPFGMR, SUNLINEARSOLVER_SPGMR, &
     SUNLINEARSOLVER_SPTFQMR, SUNLINEARSOLVER_SUPERLUDIST, SUNLINEARSOLVER_SUPERLUMT, SUNLINEARSOLVER_CUSOLVERSP_BATCHQR, &
     SUNLINEARSOLVER_MAGMADENSE, SUNLINEARSOLVER_ONEMKLDENSE, SUNLINEARSOLVER_GINKGO, SUNLINEARSOLVER_KOKKOSDENSE, &
-    SUNLINEARSOLVER_CUSTOM
+    SUNLINEARSOLVER_MIXEDPREC, SUNLINEARSOLVER_BLOCKTRIDIAG, SUNLINEARSOLVER_CUSTOM
  ! struct struct _generic_SUNLinearSolver_Ops
  type, bind(C), public :: SUNLinearSolver_Ops
   type(C_FUNPTR), public :: gettype
@@ -429,6 +444,7 @@ module fsundials_core_mod
   type(C_FUNPTR), public :: initialize
   type(C_FUNPTR), public :: setup
   type(C_FUNPTR), public :: solve
+  type(C_FUNPTR), public :: solvemultiple
   type(C_FUNPTR), public :: numiters
   type(C_FUNPTR), public :: resnorm
   type(C_FUNPTR), public :: lastflag
@@ -453,6 +469,7 @@ module fsundials_core_mod
  public :: FSUNLinSolInitialize
  public :: FSUNLinSolSetup
  public :: FSUNLinSolSolve
+ public :: FSUNLinSolSolveMultiple
  public :: FSUNLinSolNumIters
  public :: FSUNLinSolResNorm
  public :: FSUNLinSolResid
@@ -597,6 +614,43 @@ module fsundials_core_mod
  public :: FSUNStepper_SetForcingFn
  public :: FSUNStepper_SetGetNumStepsFn
  public :: FSUNStepper_SetDestroyFn
+ ! typedef enum SUNStepTraceStatus
+ enum, bind(c)
+  enumerator :: SUN_STEPTRACE_SUCCESS
+  enumerator :: SUN_STEPTRACE_ERRTEST_FAIL
+  enumerator :: SUN_STEPTRACE_SOLVE_FAIL
+  enumerator :: SUN_STEPTRACE_OTHER_FAIL
+ end enum
+ integer, parameter, public :: SUNStepTraceStatus = kind(SUN_STEPTRACE_SUCCESS)
+ public :: SUN_STEPTRACE_SUCCESS, SUN_STEPTRACE_ERRTEST_FAIL, SUN_STEPTRACE_SOLVE_FAIL, SUN_STEPTRACE_OTHER_FAIL
+ ! typedef enum SUNStepTraceField
+ enum, bind(c)
+  enumerator :: SUN_STEPTRACE_TIME
+  enumerator :: SUN_STEPTRACE_STEPSIZE
+  enumerator :: SUN_STEPTRACE_ERROR
+  enumerator :: SUN_STEPTRACE_ORDER
+  enumerator :: SUN_STEPTRACE_STATUS
+  enumerator :: SUN_STEPTRACE_NLS_ITERS
+  enumerator :: SUN_STEPTRACE_LS_ITERS
+  enumerator :: SUN_STEPTRACE_JAC_EVALS
+  enumerator :: SUN_STEPTRACE_LS_SETUPS
+ end enum
+ integer, parameter, public :: SUNStepTraceField = kind(SUN_STEPTRACE_TIME)
+ public :: SUN_STEPTRACE_TIME, SUN_STEPTRACE_STEPSIZE, SUN_STEPTRACE_ERROR, SUN_STEPTRACE_ORDER, SUN_STEPTRACE_STATUS, &
+    SUN_STEPTRACE_NLS_ITERS, SUN_STEPTRACE_LS_ITERS, SUN_STEPTRACE_JAC_EVALS, SUN_STEPTRACE_LS_SETUPS
+ integer(C_INT), parameter, public :: SUN_STEPTRACE_NUM_REAL_FIELDS = 3_C_INT
+ integer(C_INT), parameter, public :: SUN_STEPTRACE_NUM_FIELDS = 9_C_INT
+ public :: FSUNStepTrace_Create
+ public :: FSUNStepTrace_Destroy
+ public :: FSUNStepTrace_BeginStep
+ public :: FSUNStepTrace_EndStep
+ public :: FSUNStepTrace_GetNumRecords
+ public :: FSUNStepTrace_GetNumDropped
+ public :: FSUNStepTrace_GetRealField
+ public :: FSUNStepTrace_GetLongField
+ public :: FSUNStepTrace_Write
+ public :: FSUNStepTrace_WriteBinary
+ public :: FSUNStepTrace_Reset
  ! typedef enum SUNMemoryType
  enum, bind(c)
   enumerator :: SUNMEMTYPE_HOST
@@ -792,6 +846,74 @@ type(C_PTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNContext_SetVectorPool(farg1, farg2) &
+bind(C, name="_wrap_FSUNContext_SetVectorPool") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNContext_TrimVectorPool(farg1, farg2) &
+bind(C, name="_wrap_FSUNContext_TrimVectorPool") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_LONG), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNContext_GetVectorPoolStats(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FSUNContext_GetVectorPoolStats") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNContext_SetArena(farg1, farg2) &
+bind(C, name="_wrap_FSUNContext_SetArena") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNContext_GetArenaStats(farg1, farg2, farg3, farg4) &
+bind(C, name="_wrap_FSUNContext_GetArenaStats") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNContext_SetSharedVectorOps(farg1, farg2) &
+bind(C, name="_wrap_FSUNContext_SetSharedVectorOps") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNContext_GetNumSharedVectorOps(farg1, farg2) &
+bind(C, name="_wrap_FSUNContext_GetNumSharedVectorOps") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNContext_Free(farg1) &
 bind(C, name="_wrap_FSUNContext_Free") &
 result(fresult)
@@ -935,6 +1057,17 @@ type(SwigArrayWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNLogger_SetBinaryFilename(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSUNLogger_SetBinaryFilename") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+type(C_PTR), value :: farg1
+type(SwigArrayWrapper) :: farg2
+integer(C_SIZE_T), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNLogger_QueueMsg(farg1, farg2, farg3, farg4, farg5) &
 bind(C, name="_wrap_FSUNLogger_QueueMsg") &
 result(fresult)
@@ -1279,6 +1412,28 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FN_VProjectSubtract(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FN_VProjectSubtract") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
+function swigc_FN_VPascalUpdate(farg1, farg2, farg3) &
+bind(C, name="_wrap_FN_VPascalUpdate") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+real(C_DOUBLE), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VLinearSumVectorArray(farg1, farg2, farg3, farg4, farg5, farg6) &
 bind(C, name="_wrap_FN_VLinearSumVectorArray") &
 result(fresult)
@@ -1889,6 +2044,19 @@ real(C_DOUBLE), intent(in) :: farg5
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNLinSolSolveMultiple(farg1, farg2, farg3, farg4, farg5, farg6) &
+bind(C, name="_wrap_FSUNLinSolSolveMultiple") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+type(C_PTR), value :: farg4
+type(C_PTR), value :: farg5
+real(C_DOUBLE), intent(in) :: farg6
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNLinSolNumIters(farg1) &
 bind(C, name="_wrap_FSUNLinSolNumIters") &
 result(fresult)
@@ -2451,6 +2619,118 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNStepTrace_Create(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSUNStepTrace_Create") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_LONG), intent(in) :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNStepTrace_Destroy(farg1) &
+bind(C, name="_wrap_FSUNStepTrace_Destroy") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNStepTrace_BeginStep(farg1, farg2, farg3, farg4, farg5, farg6, farg7, farg8) &
+bind(C, name="_wrap_FSUNStepTrace_BeginStep") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+real(C_DOUBLE), intent(in) :: farg2
+real(C_DOUBLE), intent(in) :: farg3
+integer(C_INT), intent(in) :: farg4
+integer(C_LONG), intent(in) :: farg5
+integer(C_LONG), intent(in) :: farg6
+integer(C_LONG), intent(in) :: farg7
+integer(C_LONG), intent(in) :: farg8
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNStepTrace_EndStep(farg1, farg2, farg3, farg4, farg5, farg6, farg7) &
+bind(C, name="_wrap_FSUNStepTrace_EndStep") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+real(C_DOUBLE), intent(in) :: farg3
+integer(C_LONG), intent(in) :: farg4
+integer(C_LONG), intent(in) :: farg5
+integer(C_LONG), intent(in) :: farg6
+integer(C_LONG), intent(in) :: farg7
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNStepTrace_GetNumRecords(farg1, farg2) &
+bind(C, name="_wrap_FSUNStepTrace_GetNumRecords") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNStepTrace_GetNumDropped(farg1, farg2) &
+bind(C, name="_wrap_FSUNStepTrace_GetNumDropped") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNStepTrace_GetRealField(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSUNStepTrace_GetRealField") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNStepTrace_GetLongField(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSUNStepTrace_GetLongField") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNStepTrace_Write(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSUNStepTrace_Write") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNStepTrace_WriteBinary(farg1, farg2) &
+bind(C, name="_wrap_FSUNStepTrace_WriteBinary") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNStepTrace_Reset(farg1) &
+bind(C, name="_wrap_FSUNStepTrace_Reset") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNMemoryNewEmpty(farg1) &
 bind(C, name="_wrap_FSUNMemoryNewEmpty") &
 result(fresult)
@@ -3096,6 +3376,133 @@ fresult = swigc_FSUNContext_SetLogger(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSUNContext_SetVectorPool(sunctx, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: sunctx
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = sunctx
+farg2 = onoff
+fresult = swigc_FSUNContext_SetVectorPool(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNContext_TrimVectorPool(sunctx, max_pooled) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: sunctx
+integer(C_LONG), intent(in) :: max_pooled
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_LONG) :: farg2 
+
+farg1 = sunctx
+farg2 = max_pooled
+fresult = swigc_FSUNContext_TrimVectorPool(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNContext_GetVectorPoolStats(sunctx, nhits, nmisses, npooled, high_water) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: sunctx
+integer(C_LONG), dimension(*), target, intent(inout) :: nhits
+integer(C_LONG), dimension(*), target, intent(inout) :: nmisses
+integer(C_LONG), dimension(*), target, intent(inout) :: npooled
+integer(C_LONG), dimension(*), target, intent(inout) :: high_water
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = sunctx
+farg2 = c_loc(nhits(1))
+farg3 = c_loc(nmisses(1))
+farg4 = c_loc(npooled(1))
+farg5 = c_loc(high_water(1))
+fresult = swigc_FSUNContext_GetVectorPoolStats(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
+function FSUNContext_SetArena(sunctx, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: sunctx
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = sunctx
+farg2 = onoff
+fresult = swigc_FSUNContext_SetArena(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNContext_GetArenaStats(sunctx, nblocks, nlive, nbytes) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: sunctx
+integer(C_LONG), dimension(*), target, intent(inout) :: nblocks
+integer(C_LONG), dimension(*), target, intent(inout) :: nlive
+integer(C_LONG), dimension(*), target, intent(inout) :: nbytes
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+
+farg1 = sunctx
+farg2 = c_loc(nblocks(1))
+farg3 = c_loc(nlive(1))
+farg4 = c_loc(nbytes(1))
+fresult = swigc_FSUNContext_GetArenaStats(farg1, farg2, farg3, farg4)
+swig_result = fresult
+end function
+
+function FSUNContext_SetSharedVectorOps(sunctx, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: sunctx
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = sunctx
+farg2 = onoff
+fresult = swigc_FSUNContext_SetSharedVectorOps(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNContext_GetNumSharedVectorOps(sunctx, ntables) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: sunctx
+integer(C_LONG), dimension(*), target, intent(inout) :: ntables
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = sunctx
+farg2 = c_loc(ntables(1))
+fresult = swigc_FSUNContext_GetNumSharedVectorOps(farg1, farg2)
+swig_result = fresult
+end function
+
 function FSUNContext_Free(ctx) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3344,6 +3751,26 @@ fresult = swigc_FSUNLogger_SetInfoFilename(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSUNLogger_SetBinaryFilename(logger, binary_filename, buffer_size) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: logger
+character(kind=C_CHAR, len=*), target :: binary_filename
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+integer(C_SIZE_T), intent(in) :: buffer_size
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+integer(C_SIZE_T) :: farg3 
+
+farg1 = logger
+call SWIG_string_to_chararray(binary_filename, farg2_chars, farg2)
+farg3 = buffer_size
+fresult = swigc_FSUNLogger_SetBinaryFilename(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FSUNLogger_QueueMsg(logger, lvl, scope, label, msg_txt) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3961,6 +4388,50 @@ fresult = swigc_FN_VDotProdMulti(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FN_VProjectSubtract(nvec, x, y, dotprods, sqrnorms) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec
+type(N_Vector), target, intent(inout) :: x
+type(C_PTR) :: y
+real(C_DOUBLE), dimension(*), target, intent(inout) :: dotprods
+real(C_DOUBLE), dimension(*), target, intent(inout) :: sqrnorms
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = nvec
+farg2 = c_loc(x)
+farg3 = y
+farg4 = c_loc(dotprods(1))
+farg5 = c_loc(sqrnorms(1))
+fresult = swigc_FN_VProjectSubtract(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
+function FN_VPascalUpdate(nvec, c, z) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec
+real(C_DOUBLE), intent(in) :: c
+type(C_PTR) :: z
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+real(C_DOUBLE) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = nvec
+farg2 = c
+farg3 = z
+fresult = swigc_FN_VPascalUpdate(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FN_VLinearSumVectorArray(nvec, a, x, b, y, z) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5099,6 +5570,34 @@ fresult = swigc_FSUNLinSolSolve(farg1, farg2, farg3, farg4, farg5)
 swig_result = fresult
 end function
 
+function FSUNLinSolSolveMultiple(s, a, nrhs, x, b, tol) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(SUNLinearSolver), target, intent(inout) :: s
+type(SUNMatrix), target, intent(inout) :: a
+integer(C_INT), intent(in) :: nrhs
+type(C_PTR) :: x
+type(C_PTR) :: b
+real(C_DOUBLE), intent(in) :: tol
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+integer(C_INT) :: farg3 
+type(C_PTR) :: farg4 
+type(C_PTR) :: farg5 
+real(C_DOUBLE) :: farg6 
+
+farg1 = c_loc(s)
+farg2 = c_loc(a)
+farg3 = nrhs
+farg4 = x
+farg5 = b
+farg6 = tol
+fresult = swigc_FSUNLinSolSolveMultiple(farg1, farg2, farg3, farg4, farg5, farg6)
+swig_result = fresult
+end function
+
 function FSUNLinSolNumIters(s) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6118,6 +6617,221 @@ fresult = swigc_FSUNStepper_SetDestroyFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSUNStepTrace_Create(capacity, sunctx, trace) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_LONG), intent(in) :: capacity
+type(C_PTR) :: sunctx
+type(C_PTR), target, intent(inout) :: trace
+integer(C_INT) :: fresult 
+integer(C_LONG) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = capacity
+farg2 = sunctx
+farg3 = c_loc(trace)
+fresult = swigc_FSUNStepTrace_Create(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
+function FSUNStepTrace_Destroy(trace) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR), target, intent(inout) :: trace
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+
+farg1 = c_loc(trace)
+fresult = swigc_FSUNStepTrace_Destroy(farg1)
+swig_result = fresult
+end function
+
+function FSUNStepTrace_BeginStep(trace, t, h, order, nni, nli, nje, nsetups) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: trace
+real(C_DOUBLE), intent(in) :: t
+real(C_DOUBLE), intent(in) :: h
+integer(C_INT), intent(in) :: order
+integer(C_LONG), intent(in) :: nni
+integer(C_LONG), intent(in) :: nli
+integer(C_LONG), intent(in) :: nje
+integer(C_LONG), intent(in) :: nsetups
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+real(C_DOUBLE) :: farg2 
+real(C_DOUBLE) :: farg3 
+integer(C_INT) :: farg4 
+integer(C_LONG) :: farg5 
+integer(C_LONG) :: farg6 
+integer(C_LONG) :: farg7 
+integer(C_LONG) :: farg8 
+
+farg1 = trace
+farg2 = t
+farg3 = h
+farg4 = order
+farg5 = nni
+farg6 = nli
+farg7 = nje
+farg8 = nsetups
+fresult = swigc_FSUNStepTrace_BeginStep(farg1, farg2, farg3, farg4, farg5, farg6, farg7, farg8)
+swig_result = fresult
+end function
+
+function FSUNStepTrace_EndStep(trace, status, dsm, nni, nli, nje, nsetups) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: trace
+integer(SUNStepTraceStatus), intent(in) :: status
+real(C_DOUBLE), intent(in) :: dsm
+integer(C_LONG), intent(in) :: nni
+integer(C_LONG), intent(in) :: nli
+integer(C_LONG), intent(in) :: nje
+integer(C_LONG), intent(in) :: nsetups
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+real(C_DOUBLE) :: farg3 
+integer(C_LONG) :: farg4 
+integer(C_LONG) :: farg5 
+integer(C_LONG) :: farg6 
+integer(C_LONG) :: farg7 
+
+farg1 = trace
+farg2 = status
+farg3 = dsm
+farg4 = nni
+farg5 = nli
+farg6 = nje
+farg7 = nsetups
+fresult = swigc_FSUNStepTrace_EndStep(farg1, farg2, farg3, farg4, farg5, farg6, farg7)
+swig_result = fresult
+end function
+
+function FSUNStepTrace_GetNumRecords(trace, num_records) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: trace
+integer(C_LONG), dimension(*), target, intent(inout) :: num_records
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = trace
+farg2 = c_loc(num_records(1))
+fresult = swigc_FSUNStepTrace_GetNumRecords(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNStepTrace_GetNumDropped(trace, num_dropped) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: trace
+integer(C_LONG), dimension(*), target, intent(inout) :: num_dropped
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = trace
+farg2 = c_loc(num_dropped(1))
+fresult = swigc_FSUNStepTrace_GetNumDropped(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNStepTrace_GetRealField(trace, field, values) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: trace
+integer(SUNStepTraceField), intent(in) :: field
+type(C_PTR), target, intent(inout) :: values
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = trace
+farg2 = field
+farg3 = c_loc(values)
+fresult = swigc_FSUNStepTrace_GetRealField(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
+function FSUNStepTrace_GetLongField(trace, field, values) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: trace
+integer(SUNStepTraceField), intent(in) :: field
+type(C_PTR), target, intent(inout) :: values
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = trace
+farg2 = field
+farg3 = c_loc(values)
+fresult = swigc_FSUNStepTrace_GetLongField(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
+function FSUNStepTrace_Write(trace, outfile, fmt) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: trace
+type(C_PTR) :: outfile
+integer(SUNOutputFormat), intent(in) :: fmt
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+integer(C_INT) :: farg3 
+
+farg1 = trace
+farg2 = outfile
+farg3 = fmt
+fresult = swigc_FSUNStepTrace_Write(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
+function FSUNStepTrace_WriteBinary(trace, outfile) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: trace
+type(C_PTR) :: outfile
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = trace
+farg2 = outfile
+fresult = swigc_FSUNStepTrace_WriteBinary(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNStepTrace_Reset(trace) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: trace
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+
+farg1 = trace
+fresult = swigc_FSUNStepTrace_Reset(farg1)
+swig_result = fresult
+end function
+
 function FSUNMemoryNewEmpty(sunctx) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -17,6 +17,7 @@
  * -----------------------------------------------------------------*/
 
 #include <math.h>
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/sundials_adaptcontroller.h>
 
@@ -38,12 +39,12 @@ SUNAdaptController SUNAdaptController_NewEmpty(SUNContext sunctx)
 
   /* create controller object */
   C = NULL;
-  C = (SUNAdaptController)malloc(sizeof *C);
+  C = (SUNAdaptController)SUNContext_ArenaAlloc(sunctx, sizeof *C);
   SUNAssertNull(C, SUN_ERR_MALLOC_FAIL);
 
   /* create matrix ops structure */
   ops = NULL;
-  ops = (SUNAdaptController_Ops)malloc(sizeof *ops);
+  ops = (SUNAdaptController_Ops)SUNContext_ArenaAlloc(sunctx, sizeof *ops);
   SUNAssertNull(ops, SUN_ERR_MALLOC_FAIL);
 
   /* initialize operations to NULL */
@@ -76,11 +77,11 @@ void SUNAdaptController_DestroyEmpty(SUNAdaptController C)
   if (C == NULL) { return; }
 
   /* free non-NULL ops structure */
-  if (C->ops) { free(C->ops); }
+  if (C->ops) { SUNContext_ArenaFree(C->sunctx, C->ops); }
   C->ops = NULL;
 
   /* free overall SUNAdaptController object and return */
-  free(C);
+  SUNContext_ArenaFree(C->sunctx, C);
   return;
 }
 
@@ -113,15 +114,15 @@ SUNErrCode SUNAdaptController_Destroy(SUNAdaptController C)
      try to cleanup by freeing the content, ops, and matrix */
   if (C->content)
   {
-    free(C->content);
+    SUNContext_ArenaFree(C->sunctx, C->content);
     C->content = NULL;
   }
   if (C->ops)
   {
-    free(C->ops);
+    SUNContext_ArenaFree(C->sunctx, C->ops);
     C->ops = NULL;
   }
-  free(C);
+  SUNContext_ArenaFree(C->sunctx, C);
   C = NULL;
 
   return (SUN_SUCCESS);
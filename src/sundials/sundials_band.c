@@ -59,6 +59,103 @@ void SUNDlsMat_BandMatvec(SUNDlsMat A, sunrealtype* x, sunrealtype* y)
   SUNDlsMat_bandMatvec(A->cols, x, y, A->M, A->mu, A->ml, A->s_mu);
 }
 
+/*
+ * -----------------------------------------------------
+ * Kernels for narrow bands. The lower bandwidth is a
+ * compile-time constant in each call from the dispatch
+ * switches below so the loops over the subdiagonal are
+ * unrolled and the multipliers of an elimination step
+ * stay in registers while they are applied to all the
+ * columns of the step. These kernels only handle the
+ * first n - ml columns, where every column has ml
+ * entries below the diagonal, and the general loops
+ * finish the remaining columns.
+ * -----------------------------------------------------
+ */
+
+#define NARROW_ML_MAX 8
+
+static inline sunindextype bandGBTRFNarrow(sunrealtype** a, sunindextype n,
+                                           sunindextype ml, sunindextype smu,
+                                           sunindextype* p)
+{
+  sunindextype i, j, k, l, last_col_k;
+  sunrealtype *diag_k, *row_k;
+  sunrealtype mult[NARROW_ML_MAX];
+  sunrealtype max, temp, a_kj;
+
+  for (k = 0; k < n - ml; k++)
+  {
+    diag_k = a[k] + smu;
+
+    /* find the pivot row k + l */
+
+    l   = 0;
+    max = SUNRabs(diag_k[0]);
+    for (i = 1; i <= ml; i++)
+    {
+      temp = SUNRabs(diag_k[i]);
+      l    = (temp > max) ? i : l;
+      max  = (temp > max) ? temp : max;
+    }
+    p[k] = k + l;
+
+    if (diag_k[l] == ZERO) { return (k + 1); }
+
+    /* the row exchanges are done unconditionally (a no-op when l = 0) as the
+       pivot rows are not predictable */
+
+    temp      = diag_k[l];
+    diag_k[l] = diag_k[0];
+    diag_k[0] = temp;
+
+    /* store the multipliers -a(i,k)/a(k,k) */
+
+    temp = -ONE / diag_k[0];
+    for (i = 0; i < ml; i++)
+    {
+      diag_k[i + 1] *= temp;
+      mult[i] = diag_k[i + 1];
+    }
+
+    /* swap rows k and k + l and update rows k+1, ..., k+ml in columns
+       j = k+1, ..., SUNMIN(k+smu,n-1), row_k points to a(k,j) */
+
+    last_col_k = SUNMIN(k + smu, n - 1);
+    for (j = k + 1; j <= last_col_k; j++)
+    {
+      row_k = a[j] + ROW(k, j, smu);
+      a_kj     = row_k[l];
+      row_k[l] = row_k[0];
+      row_k[0] = a_kj;
+      if (a_kj != ZERO)
+      {
+        for (i = 0; i < ml; i++) { row_k[i + 1] += a_kj * mult[i]; }
+      }
+    }
+  }
+
+  return (0);
+}
+
+static inline void bandGBTRSNarrow(sunrealtype** a, sunindextype n,
+                                   sunindextype ml, sunindextype smu,
+                                   sunindextype* p, sunrealtype* b)
+{
+  sunindextype i, k, l;
+  sunrealtype mult, *diag_k;
+
+  for (k = 0; k < n - ml; k++)
+  {
+    l      = p[k];
+    mult   = b[l];
+    b[l]   = b[k];
+    b[k]   = mult;
+    diag_k = a[k] + smu;
+    for (i = 1; i <= ml; i++) { b[k + i] += mult * diag_k[i]; }
+  }
+}
+
 /*
  * -----------------------------------------------------
  * Functions working on sunrealtype**
@@ -87,9 +184,30 @@ sunindextype SUNDlsMat_bandGBTRF(sunrealtype** a, sunindextype n,
     }
   }
 
+  /* use the unrolled kernels for the first n - ml columns of narrow bands */
+
+  k = 0;
+  if (ml > 0 && ml <= NARROW_ML_MAX && n > ml)
+  {
+    switch (ml)
+    {
+    case 1: k = bandGBTRFNarrow(a, n, 1, smu, p); break;
+    case 2: k = bandGBTRFNarrow(a, n, 2, smu, p); break;
+    case 3: k = bandGBTRFNarrow(a, n, 3, smu, p); break;
+    case 4: k = bandGBTRFNarrow(a, n, 4, smu, p); break;
+    case 5: k = bandGBTRFNarrow(a, n, 5, smu, p); break;
+    case 6: k = bandGBTRFNarrow(a, n, 6, smu, p); break;
+    case 7: k = bandGBTRFNarrow(a, n, 7, smu, p); break;
+    default: k = bandGBTRFNarrow(a, n, 8, smu, p); break;
+    }
+    if (k != 0) { return (k); }
+    k = n - ml;
+    p += k;
+  }
+
   /* k = elimination step number */
 
-  for (k = 0; k < n - 1; k++, p++)
+  for (; k < n - 1; k++, p++)
   {
     col_k      = a[k];
     diag_k     = col_k + smu;
@@ -187,9 +305,27 @@ void SUNDlsMat_bandGBTRS(sunrealtype** a, sunindextype n, sunindextype smu,
   sunindextype k, l, i, first_row_k, last_row_k;
   sunrealtype mult, *diag_k;
 
-  /* Solve Ly = Pb, store solution y in b */
+  /* Solve Ly = Pb, store solution y in b, using the unrolled kernels for the
+     first n - ml columns of narrow bands */
 
-  for (k = 0; k < n - 1; k++)
+  k = 0;
+  if (ml > 0 && ml <= NARROW_ML_MAX && n > ml)
+  {
+    switch (ml)
+    {
+    case 1: bandGBTRSNarrow(a, n, 1, smu, p, b); break;
+    case 2: bandGBTRSNarrow(a, n, 2, smu, p, b); break;
+    case 3: bandGBTRSNarrow(a, n, 3, smu, p, b); break;
+    case 4: bandGBTRSNarrow(a, n, 4, smu, p, b); break;
+    case 5: bandGBTRSNarrow(a, n, 5, smu, p, b); break;
+    case 6: bandGBTRSNarrow(a, n, 6, smu, p, b); break;
+    case 7: bandGBTRSNarrow(a, n, 7, smu, p, b); break;
+    default: bandGBTRSNarrow(a, n, 8, smu, p, b); break;
+    }
+    k = n - ml;
+  }
+
+  for (; k < n - 1; k++)
   {
     l    = p[k];
     mult = b[l];
@@ -203,9 +339,18 @@ void SUNDlsMat_bandGBTRS(sunrealtype** a, sunindextype n, sunindextype smu,
     for (i = k + 1; i <= last_row_k; i++) { b[i] += mult * diag_k[i - k]; }
   }
 
-  /* Solve Ux = y, store solution x in b */
+  /* Solve Ux = y, store solution x in b. All columns k >= smu have smu
+     entries above the diagonal. */
 
-  for (k = n - 1; k >= 0; k--)
+  for (k = n - 1; k >= smu; k--)
+  {
+    diag_k = a[k] + smu;
+    b[k] /= (*diag_k);
+    mult = -b[k];
+    for (i = 1; i <= smu; i++) { b[k - i] += mult * diag_k[-i]; }
+  }
+
+  for (; k >= 0; k--)
   {
     diag_k      = a[k] + smu;
     first_row_k = SUNMAX(0, k - smu);
@@ -215,6 +360,53 @@ void SUNDlsMat_bandGBTRS(sunrealtype** a, sunindextype n, sunindextype smu,
   }
 }
 
+void SUNDlsMat_bandGBTRSMultiple(sunrealtype** a, sunindextype n,
+                                 sunindextype smu, sunindextype ml,
+                                 sunindextype* p, int nrhs, sunrealtype** b)
+{
+  sunindextype k, l, i, first_row_k, last_row_k;
+  sunrealtype mult, *diag_k, *b_j;
+  int j;
+
+  /* Solve L Y = P B, store solutions in b */
+
+  for (k = 0; k < n - 1; k++)
+  {
+    l          = p[k];
+    diag_k     = a[k] + smu;
+    last_row_k = SUNMIN(n - 1, k + ml);
+    for (j = 0; j < nrhs; j++)
+    {
+      b_j  = b[j];
+      mult = b_j[l];
+      if (l != k)
+      {
+        b_j[l] = b_j[k];
+        b_j[k] = mult;
+      }
+      for (i = k + 1; i <= last_row_k; i++) { b_j[i] += mult * diag_k[i - k]; }
+    }
+  }
+
+  /* Solve U X = Y, store solutions in b */
+
+  for (k = n - 1; k >= 0; k--)
+  {
+    diag_k      = a[k] + smu;
+    first_row_k = SUNMAX(0, k - smu);
+    for (j = 0; j < nrhs; j++)
+    {
+      b_j = b[j];
+      b_j[k] /= (*diag_k);
+      mult = -b_j[k];
+      for (i = first_row_k; i <= k - 1; i++)
+      {
+        b_j[i] += mult * diag_k[i - k];
+      }
+    }
+  }
+}
+
 void SUNDlsMat_bandCopy(sunrealtype** a, sunrealtype** b, sunindextype n,
                         sunindextype a_smu, sunindextype b_smu,
                         sunindextype copymu, sunindextype copyml)
@@ -0,0 +1,152 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Rank-one (Broyden) corrections of a factored Newton matrix used
+ * by the linear solver interfaces between matrix updates.
+ *
+ * Given the solution x = B_0^{-1} b computed with the factored
+ * matrix B_0, the solution with the updated matrix B_k is obtained
+ * from the Sherman-Morrison form of Broyden's "good" update,
+ *
+ *   B_{j+1}^{-1} b = B_j^{-1} b + z_j (s_j^T B_j^{-1} b),
+ *   z_j = (s_j - B_j^{-1} y_j) / (s_j^T B_j^{-1} y_j),
+ *
+ * where s_j is the change in the iterate and y_j the change in the
+ * nonlinear residual between consecutive solves. Since the right
+ * hand side of each solve is the negative residual, B_j^{-1} y_j is
+ * the difference of the previous and current solutions with B_j, so
+ * each update costs a few vector operations and no additional
+ * linear solves. The matrix and its factorization are never
+ * modified, and the corrections apply to any matrix type.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_BROYDEN_IMPL_H
+#define _SUNDIALS_BROYDEN_IMPL_H
+
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+typedef struct
+{
+  int maxupd;               /* maximum number of stored updates (0 = off) */
+  int nupd;                 /* number of stored updates                   */
+  sunbooleantype have_prev; /* uprev and xprev hold the previous solve    */
+  N_Vector* s;              /* changes in the iterate                     */
+  N_Vector* z;              /* correction directions                      */
+  N_Vector uprev;           /* iterate at the previous solve              */
+  N_Vector xprev;           /* solution of the previous solve             */
+  long int nbroy;           /* total number of updates                    */
+} sunBroyden;
+
+static inline void sunBroyden_Init(sunBroyden* broyden)
+{
+  broyden->maxupd    = 0;
+  broyden->nupd      = 0;
+  broyden->have_prev = SUNFALSE;
+  broyden->s         = NULL;
+  broyden->z         = NULL;
+  broyden->uprev     = NULL;
+  broyden->xprev     = NULL;
+  broyden->nbroy     = 0;
+}
+
+static inline void sunBroyden_Free(sunBroyden* broyden)
+{
+  if (broyden->s) { N_VDestroyVectorArray(broyden->s, broyden->maxupd); }
+  if (broyden->z) { N_VDestroyVectorArray(broyden->z, broyden->maxupd); }
+  if (broyden->uprev) { N_VDestroy(broyden->uprev); }
+  if (broyden->xprev) { N_VDestroy(broyden->xprev); }
+  sunBroyden_Init(broyden);
+}
+
+/* Allocates storage for up to maxupd updates cloned from tmpl, maxupd = 0
+   disables the updates. Returns 0 on success and -1 if an allocation failed,
+   in which case the updates are disabled. */
+static inline int sunBroyden_Alloc(sunBroyden* broyden, int maxupd,
+                                   N_Vector tmpl)
+{
+  long int nbroy = broyden->nbroy;
+
+  sunBroyden_Free(broyden);
+  broyden->nbroy = nbroy;
+  if (maxupd <= 0) { return 0; }
+
+  broyden->maxupd = maxupd;
+  broyden->s      = N_VCloneVectorArray(maxupd, tmpl);
+  broyden->z      = N_VCloneVectorArray(maxupd, tmpl);
+  broyden->uprev  = N_VClone(tmpl);
+  broyden->xprev  = N_VClone(tmpl);
+  if (broyden->s == NULL || broyden->z == NULL || broyden->uprev == NULL ||
+      broyden->xprev == NULL)
+  {
+    sunBroyden_Free(broyden);
+    broyden->nbroy = nbroy;
+    return -1;
+  }
+
+  return 0;
+}
+
+/* Discards the stored updates, called when the matrix is updated or a new
+   nonlinear solve starts */
+static inline void sunBroyden_Reset(sunBroyden* broyden)
+{
+  broyden->nupd      = 0;
+  broyden->have_prev = SUNFALSE;
+}
+
+/* On input x = B_0^{-1} b where b is the negative nonlinear residual at the
+   iterate u. Applies the stored updates, adds the update from the previous
+   solve to u (if there is room), and returns the corrected solution in x. */
+static inline void sunBroyden_Solve(sunBroyden* broyden, N_Vector u, N_Vector x)
+{
+  int j;
+  N_Vector s, z;
+  sunrealtype sz, ss, zz;
+
+  if (broyden->maxupd <= 0) { return; }
+
+  /* x <- B_k^{-1} b */
+  for (j = 0; j < broyden->nupd; j++)
+  {
+    N_VLinearSum(SUN_RCONST(1.0), x, N_VDotProd(broyden->s[j], x),
+                 broyden->z[j], x);
+  }
+
+  /* add the update from the previous solve: s = u - uprev and
+     B_k^{-1} y = xprev - x, skipping degenerate updates */
+  if (broyden->have_prev && broyden->nupd < broyden->maxupd)
+  {
+    s = broyden->s[broyden->nupd];
+    z = broyden->z[broyden->nupd];
+    N_VLinearSum(SUN_RCONST(1.0), u, -SUN_RCONST(1.0), broyden->uprev, s);
+    N_VLinearSum(SUN_RCONST(1.0), broyden->xprev, -SUN_RCONST(1.0), x, z);
+    sz = N_VDotProd(s, z);
+    ss = N_VDotProd(s, s);
+    zz = N_VDotProd(z, z);
+    if (ss > SUN_RCONST(0.0) &&
+        SUNRabs(sz) > SUNRsqrt(SUN_UNIT_ROUNDOFF) * SUNRsqrt(ss * zz))
+    {
+      N_VLinearSum(SUN_RCONST(1.0) / sz, s, -SUN_RCONST(1.0) / sz, z, z);
+      N_VLinearSum(SUN_RCONST(1.0), x, N_VDotProd(s, x), z, x);
+      broyden->nupd++;
+      broyden->nbroy++;
+    }
+  }
+
+  N_VScale(SUN_RCONST(1.0), u, broyden->uprev);
+  N_VScale(SUN_RCONST(1.0), x, broyden->xprev);
+  broyden->have_prev = SUNTRUE;
+}
+
+#endif
@@ -24,12 +24,62 @@
 #include <sundials/sundials_context.h>
 #include <sundials/sundials_errors.h>
 #include <sundials/sundials_logger.h>
+#include <sundials/sundials_nvector.h>
 #include <sundials/sundials_profiler.h>
 #include <sundials/sundials_types.h>
 
 #include "sundials_adiak_metadata.h"
 #include "sundials_macros.h"
 
+/* Size of an object arena block and of the largest allocation served from the
+   arena (larger requests use malloc) */
+#define SUN_ARENA_BLOCK_SIZE 65536
+#define SUN_ARENA_MAX_ALLOC  (SUN_ARENA_BLOCK_SIZE / 4)
+
+/* Alignment of arena allocations */
+#define SUN_ARENA_ALIGN 16
+#define SUN_ARENA_ROUND(n) \
+  (((n) + SUN_ARENA_ALIGN - 1) / SUN_ARENA_ALIGN * SUN_ARENA_ALIGN)
+
+struct SUNArenaBlock_
+{
+  struct SUNArenaBlock_* next; /* previous (full) block */
+  char* data;                  /* start of the block    */
+  size_t used;                 /* bytes in use          */
+};
+
+/* Offset of the data in a block */
+#define SUN_ARENA_HEADER SUN_ARENA_ROUND(sizeof(struct SUNArenaBlock_))
+
+/* Frees all arena blocks except the current one when keep_current is true */
+static void sunArenaRelease(SUNContext sunctx, sunbooleantype keep_current)
+{
+  struct SUNArenaBlock_* block = sunctx->arena;
+  struct SUNArenaBlock_* next  = NULL;
+
+  if (block == NULL) { return; }
+
+  if (keep_current)
+  {
+    next        = block->next;
+    block->next = NULL;
+    block->used = 0;
+    block       = next;
+  }
+  else { sunctx->arena = NULL; }
+
+  while (block != NULL)
+  {
+    next = block->next;
+    free(block);
+    block = next;
+  }
+
+  sunctx->arena_nblocks = (sunctx->arena != NULL) ? 1 : 0;
+  sunctx->arena_nlive   = 0;
+  sunctx->arena_nbytes  = 0;
+}
+
 SUNErrCode SUNContext_Create(SUNComm comm, SUNContext* sunctx_out)
 {
   SUNErrCode err       = SUN_SUCCESS;
@@ -98,6 +148,25 @@ SUNErrCode SUNContext_Create(SUNComm comm, SUNContext* sunctx_out)
     sunctx->last_err     = SUN_SUCCESS;
     sunctx->err_handler  = eh;
     sunctx->comm         = comm;
+
+    sunctx->vpool_enabled    = SUNFALSE;
+    sunctx->vpool            = NULL;
+    sunctx->vpool_size       = 0;
+    sunctx->vpool_capacity   = 0;
+    sunctx->vpool_nhits      = 0;
+    sunctx->vpool_nmisses    = 0;
+    sunctx->vpool_high_water = 0;
+
+    sunctx->arena_enabled = SUNFALSE;
+    sunctx->arena         = NULL;
+    sunctx->arena_nblocks = 0;
+    sunctx->arena_nlive   = 0;
+    sunctx->arena_nbytes  = 0;
+
+    sunctx->vops_enabled  = SUNFALSE;
+    sunctx->vops          = NULL;
+    sunctx->vops_size     = 0;
+    sunctx->vops_capacity = 0;
   }
   while (0);
 
@@ -250,6 +319,314 @@ SUNErrCode SUNContext_SetLogger(SUNContext sunctx, SUNLogger logger)
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNContext_SetVectorPool(SUNContext sunctx, sunbooleantype onoff)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  /* free any pooled vectors when the pool is disabled */
+  if (!onoff) { SUNCheckCall(SUNContext_TrimVectorPool(sunctx, 0)); }
+
+  sunctx->vpool_enabled = onoff;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNContext_TrimVectorPool(SUNContext sunctx, long int max_pooled)
+{
+  long int i, nfree;
+
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  if (max_pooled < 0) { max_pooled = 0; }
+  if (sunctx->vpool_size <= max_pooled) { return SUN_SUCCESS; }
+
+  /* free the least recently pooled vectors */
+  nfree = sunctx->vpool_size - max_pooled;
+  for (i = 0; i < nfree; i++)
+  {
+    sunctx->vpool[i].free_fn(sunctx->vpool[i].v);
+  }
+  memmove(sunctx->vpool, sunctx->vpool + nfree,
+          max_pooled * sizeof(struct SUNVectorPoolEntry_));
+  sunctx->vpool_size = max_pooled;
+
+  if (max_pooled == 0)
+  {
+    free(sunctx->vpool);
+    sunctx->vpool          = NULL;
+    sunctx->vpool_capacity = 0;
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNContext_GetVectorPoolStats(SUNContext sunctx, long int* nhits,
+                                         long int* nmisses, long int* npooled,
+                                         long int* high_water)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  if (nhits) { *nhits = sunctx->vpool_nhits; }
+  if (nmisses) { *nmisses = sunctx->vpool_nmisses; }
+  if (npooled) { *npooled = sunctx->vpool_size; }
+  if (high_water) { *high_water = sunctx->vpool_high_water; }
+
+  return SUN_SUCCESS;
+}
+
+struct _generic_N_Vector* SUNContext_TakePooledVector(SUNContext sunctx, int id,
+                                                      sunindextype length)
+{
+  long int i;
+  struct _generic_N_Vector* v = NULL;
+
+  if (!sunctx || !sunctx->vpool_enabled) { return NULL; }
+
+  /* search from the most recently pooled vector (warmest in cache) */
+  for (i = sunctx->vpool_size - 1; i >= 0; i--)
+  {
+    if (sunctx->vpool[i].id == id && sunctx->vpool[i].length == length)
+    {
+      v = sunctx->vpool[i].v;
+      memmove(sunctx->vpool + i, sunctx->vpool + i + 1,
+              (sunctx->vpool_size - i - 1) *
+                sizeof(struct SUNVectorPoolEntry_));
+      sunctx->vpool_size--;
+      sunctx->vpool_nhits++;
+      return v;
+    }
+  }
+
+  sunctx->vpool_nmisses++;
+  return NULL;
+}
+
+sunbooleantype SUNContext_PoolVector(SUNContext sunctx,
+                                     struct _generic_N_Vector* v, int id,
+                                     sunindextype length,
+                                     SUNVectorPoolFreeFn free_fn)
+{
+  long int capacity;
+  struct SUNVectorPoolEntry_* vpool;
+
+  if (!sunctx || !sunctx->vpool_enabled || !v || !free_fn) { return SUNFALSE; }
+
+  if (sunctx->vpool_size == sunctx->vpool_capacity)
+  {
+    capacity = (sunctx->vpool_capacity > 0) ? 2 * sunctx->vpool_capacity : 8;
+    vpool    = (struct SUNVectorPoolEntry_*)
+      realloc(sunctx->vpool, capacity * sizeof(struct SUNVectorPoolEntry_));
+    if (!vpool) { return SUNFALSE; }
+    sunctx->vpool          = vpool;
+    sunctx->vpool_capacity = capacity;
+  }
+
+  sunctx->vpool[sunctx->vpool_size].v       = v;
+  sunctx->vpool[sunctx->vpool_size].id      = id;
+  sunctx->vpool[sunctx->vpool_size].length  = length;
+  sunctx->vpool[sunctx->vpool_size].free_fn = free_fn;
+  sunctx->vpool_size++;
+
+  if (sunctx->vpool_size > sunctx->vpool_high_water)
+  {
+    sunctx->vpool_high_water = sunctx->vpool_size;
+  }
+
+  return SUNTRUE;
+}
+
+SUNErrCode SUNContext_SetArena(SUNContext sunctx, sunbooleantype onoff)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  /* objects already in the arena remain valid when it is disabled */
+  sunctx->arena_enabled = onoff;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNContext_GetArenaStats(SUNContext sunctx, long int* nblocks,
+                                    long int* nlive, long int* nbytes)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  if (nblocks) { *nblocks = sunctx->arena_nblocks; }
+  if (nlive) { *nlive = sunctx->arena_nlive; }
+  if (nbytes) { *nbytes = sunctx->arena_nbytes; }
+
+  return SUN_SUCCESS;
+}
+
+void* SUNContext_ArenaAlloc(SUNContext sunctx, size_t size)
+{
+  void* ptr                    = NULL;
+  struct SUNArenaBlock_* block = NULL;
+
+  if (!sunctx || !sunctx->arena_enabled || size == 0 ||
+      size > SUN_ARENA_MAX_ALLOC)
+  {
+    return malloc(size);
+  }
+
+  size  = SUN_ARENA_ROUND(size);
+  block = sunctx->arena;
+
+  /* start a new block when the current one is full */
+  if (block == NULL || block->used + size > SUN_ARENA_BLOCK_SIZE)
+  {
+    block = (struct SUNArenaBlock_*)malloc(SUN_ARENA_HEADER +
+                                           SUN_ARENA_BLOCK_SIZE);
+    if (block == NULL) { return NULL; }
+    block->data   = (char*)block + SUN_ARENA_HEADER;
+    block->used   = 0;
+    block->next   = sunctx->arena;
+    sunctx->arena = block;
+    sunctx->arena_nblocks++;
+  }
+
+  ptr = block->data + block->used;
+  block->used += size;
+  sunctx->arena_nlive++;
+  sunctx->arena_nbytes += (long int)size;
+
+  return ptr;
+}
+
+void SUNContext_ArenaFree(SUNContext sunctx, void* ptr)
+{
+  struct SUNArenaBlock_* block = NULL;
+
+  if (ptr == NULL) { return; }
+
+  if (sunctx)
+  {
+    for (block = sunctx->arena; block != NULL; block = block->next)
+    {
+      if ((char*)ptr >= block->data &&
+          (char*)ptr < block->data + SUN_ARENA_BLOCK_SIZE)
+      {
+        /* reuse the arena once all of its allocations are released */
+        if (--sunctx->arena_nlive == 0) { sunArenaRelease(sunctx, SUNTRUE); }
+        return;
+      }
+    }
+  }
+
+  free(ptr);
+}
+
+SUNErrCode SUNContext_SetSharedVectorOps(SUNContext sunctx,
+                                         sunbooleantype onoff)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  /* tables already shared remain valid when sharing is disabled */
+  sunctx->vops_enabled = onoff;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNContext_GetNumSharedVectorOps(SUNContext sunctx,
+                                            long int* ntables)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  *ntables = sunctx->vops_size;
+  return SUN_SUCCESS;
+}
+
+struct _generic_N_Vector_Ops* SUNContext_AcquireVectorOps(
+  SUNContext sunctx, struct _generic_N_Vector_Ops* ops)
+{
+  long int i, capacity;
+  struct SUNVectorOpsEntry_* vops;
+  struct _generic_N_Vector_Ops* shared;
+
+  if (!sunctx || !sunctx->vops_enabled || !ops) { return NULL; }
+
+  /* tables are immutable, so equal tables can be shared */
+  for (i = 0; i < sunctx->vops_size; i++)
+  {
+    if (sunctx->vops[i].ops == ops ||
+        !memcmp(sunctx->vops[i].ops, ops, sizeof(struct _generic_N_Vector_Ops)))
+    {
+      sunctx->vops[i].refcount++;
+      return sunctx->vops[i].ops;
+    }
+  }
+
+  if (sunctx->vops_size == sunctx->vops_capacity)
+  {
+    capacity = (sunctx->vops_capacity > 0) ? 2 * sunctx->vops_capacity : 4;
+    vops     = (struct SUNVectorOpsEntry_*)
+      realloc(sunctx->vops, capacity * sizeof(struct SUNVectorOpsEntry_));
+    if (!vops) { return NULL; }
+    sunctx->vops          = vops;
+    sunctx->vops_capacity = capacity;
+  }
+
+  shared = (struct _generic_N_Vector_Ops*)malloc(
+    sizeof(struct _generic_N_Vector_Ops));
+  if (!shared) { return NULL; }
+  memcpy(shared, ops, sizeof(struct _generic_N_Vector_Ops));
+
+  sunctx->vops[sunctx->vops_size].ops      = shared;
+  sunctx->vops[sunctx->vops_size].refcount = 1;
+  sunctx->vops_size++;
+
+  return shared;
+}
+
+sunbooleantype SUNContext_ReleaseVectorOps(SUNContext sunctx,
+                                           struct _generic_N_Vector_Ops* ops)
+{
+  long int i;
+
+  if (!sunctx || !ops) { return SUNFALSE; }
+
+  for (i = 0; i < sunctx->vops_size; i++)
+  {
+    if (sunctx->vops[i].ops == ops)
+    {
+      if (--sunctx->vops[i].refcount == 0)
+      {
+        free(ops);
+        sunctx->vops[i] = sunctx->vops[sunctx->vops_size - 1];
+        sunctx->vops_size--;
+      }
+      return SUNTRUE;
+    }
+  }
+
+  return SUNFALSE;
+}
+
+sunbooleantype SUNContext_IsSharedVectorOps(SUNContext sunctx,
+                                            struct _generic_N_Vector_Ops* ops)
+{
+  long int i;
+
+  if (!sunctx || !ops) { return SUNFALSE; }
+
+  for (i = 0; i < sunctx->vops_size; i++)
+  {
+    if (sunctx->vops[i].ops == ops) { return SUNTRUE; }
+  }
+
+  return SUNFALSE;
+}
+
 SUNErrCode SUNContext_Free(SUNContext* sunctx)
 {
 #ifdef SUNDIALS_ADIAK_ENABLED
@@ -258,6 +635,9 @@ SUNErrCode SUNContext_Free(SUNContext* sunctx)
 
   if (!sunctx || !(*sunctx)) { return SUN_SUCCESS; }
 
+  /* free any pooled vectors */
+  SUNContext_TrimVectorPool(*sunctx, 0);
+
 #if defined(SUNDIALS_BUILD_WITH_PROFILING) && !defined(SUNDIALS_CALIPER_ENABLED)
   /* Find out where we are printing to */
   FILE* fp                    = NULL;
@@ -292,6 +672,16 @@ SUNErrCode SUNContext_Free(SUNContext* sunctx)
 
   SUNContext_ClearErrHandlers(*sunctx);
 
+  /* release the object arena */
+  sunArenaRelease(*sunctx, SUNFALSE);
+
+  /* free the shared vector operations tables */
+  for (long int i = 0; i < (*sunctx)->vops_size; i++)
+  {
+    free((*sunctx)->vops[i].ops);
+  }
+  free((*sunctx)->vops);
+
   free(*sunctx);
   *sunctx = NULL;
 
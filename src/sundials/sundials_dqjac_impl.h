@@ -0,0 +1,123 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Per-thread work space used by the linear solver interfaces to
+ * evaluate the columns (dense) or column groups (band) of a
+ * difference quotient Jacobian concurrently.
+ *
+ * Thread s perturbs its own copy of the state, evaluates the
+ * user function into its own output vector, and writes the columns
+ * s, s + nthreads, s + 2 nthreads, ... of the Jacobian (dense) or
+ * the columns of the groups with the same stride (band). The user
+ * function is therefore called concurrently and must be reentrant.
+ * The work vectors are allocated on first use.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_DQJAC_IMPL_H
+#define _SUNDIALS_DQJAC_IMPL_H
+
+#include <stdlib.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#include "sundials_macros.h"
+
+typedef struct
+{
+  N_Vector ytemp;  /* perturbed copy of the state                */
+  N_Vector yptemp; /* perturbed copy of the state derivative     */
+  N_Vector ftemp;  /* function value at the perturbed state      */
+  long int nfe;    /* number of function evaluations (last call) */
+  int retval;      /* function return value (last call)          */
+} sunDQThread;
+
+typedef struct
+{
+  int nthreads;        /* number of threads (<= 1 = serial DQ)      */
+  sunDQThread* thread; /* work space of each thread (NULL = not yet) */
+} sunDQThreads;
+
+static inline void sunDQThreads_Init(sunDQThreads* dq)
+{
+  dq->nthreads = 1;
+  dq->thread   = NULL;
+}
+
+static inline void sunDQThreads_Free(sunDQThreads* dq)
+{
+  int s;
+
+  if (dq->thread == NULL) { return; }
+  for (s = 0; s < dq->nthreads; s++)
+  {
+    if (dq->thread[s].ytemp) { N_VDestroy(dq->thread[s].ytemp); }
+    if (dq->thread[s].yptemp) { N_VDestroy(dq->thread[s].yptemp); }
+    if (dq->thread[s].ftemp) { N_VDestroy(dq->thread[s].ftemp); }
+  }
+  free(dq->thread);
+  dq->thread = NULL;
+}
+
+/* Sets the number of threads, values less than one select the serial DQ
+   approximation. The work space of a different thread count is freed. */
+static inline void sunDQThreads_SetNumThreads(sunDQThreads* dq, int nthreads)
+{
+  if (nthreads < 1) { nthreads = 1; }
+  if (nthreads != dq->nthreads) { sunDQThreads_Free(dq); }
+  dq->nthreads = nthreads;
+}
+
+/* Allocates the work space cloned from tmpl if necessary. The yptemp vectors
+   are only allocated when need_yp is true. Returns 0 on success and -1 if an
+   allocation failed. */
+static inline int sunDQThreads_Alloc(sunDQThreads* dq, N_Vector tmpl,
+                                     sunbooleantype need_yp)
+{
+  int s;
+
+  if (dq->thread != NULL) { return 0; }
+
+  dq->thread = (sunDQThread*)calloc(dq->nthreads, sizeof(sunDQThread));
+  if (dq->thread == NULL) { return -1; }
+
+  for (s = 0; s < dq->nthreads; s++)
+  {
+    dq->thread[s].ytemp = N_VClone(tmpl);
+    dq->thread[s].ftemp = N_VClone(tmpl);
+    if (need_yp) { dq->thread[s].yptemp = N_VClone(tmpl); }
+    if (dq->thread[s].ytemp == NULL || dq->thread[s].ftemp == NULL ||
+        (need_yp && dq->thread[s].yptemp == NULL))
+    {
+      sunDQThreads_Free(dq);
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+/* Adds the function evaluations of all threads to nfe and returns the first
+   nonzero return value (in thread order) or zero */
+static inline int sunDQThreads_Finalize(sunDQThreads* dq, long int* nfe)
+{
+  int s;
+  int retval = 0;
+
+  for (s = 0; s < dq->nthreads; s++)
+  {
+    *nfe += dq->thread[s].nfe;
+    if (retval == 0) { retval = dq->thread[s].retval; }
+  }
+
+  return retval;
+}
+
+#endif
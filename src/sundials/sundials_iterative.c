@@ -117,10 +117,35 @@ SUNErrCode SUNClassicalGS(N_Vector* v, sunrealtype** h, int k, int p,
   SUNFunctionBegin(v[0]->sunctx);
   int i, i0, k_minus_1;
   sunrealtype vk_norm;
+  sunrealtype sqrnorms[2];
 
   k_minus_1 = k - 1;
   i0        = SUNMAX(k - p, 0);
 
+  /* Use the fused operation when the vector provides it, the dot products,
+     projection, and norms of v[k] before and after are computed together */
+
+  if (v[k]->ops->nvprojectsubtract != NULL)
+  {
+    SUNCheckCall(N_VProjectSubtract(k - i0, v[k], v + i0, stemp, sqrnorms));
+
+    vk_norm      = SUNRsqrt(sqrnorms[0]);
+    *new_vk_norm = SUNRsqrt(sqrnorms[1]);
+    for (i = i0; i < k; i++) { h[i][k_minus_1] = stemp[i - i0]; }
+
+    /* Reorthogonalize if necessary */
+
+    if ((FACTOR * (*new_vk_norm)) < vk_norm)
+    {
+      SUNCheckCall(N_VProjectSubtract(k - i0, v[k], v + i0, stemp, sqrnorms));
+
+      for (i = i0; i < k; i++) { h[i][k_minus_1] += stemp[i - i0]; }
+      *new_vk_norm = SUNRsqrt(sqrnorms[1]);
+    }
+
+    return SUN_SUCCESS;
+  }
+
   /* Perform Classical Gram-Schmidt */
 
   SUNCheckCall(N_VDotProdMulti(k - i0 + 1, v[k], v + i0, stemp));
@@ -154,10 +179,10 @@ SUNErrCode SUNClassicalGS(N_Vector* v, sunrealtype** h, int k, int p,
     {
       h[i][k_minus_1] += stemp[i - i0 + 1];
       stemp[i - i0 + 1] = -stemp[i - i0 + 1];
-      vtemp[i - i0 + 1] = v[i - i0];
+      vtemp[i - i0 + 1] = v[i];
     }
 
-    SUNCheckCall(N_VLinearCombination(k + 1, stemp, vtemp, v[k]));
+    SUNCheckCall(N_VLinearCombination(k - i0 + 1, stemp, vtemp, v[k]));
 
     *new_vk_norm = SUNRsqrt(N_VDotProd(v[k], v[k]));
     SUNCheckLastErr();
@@ -502,40 +527,63 @@ SUNErrCode SUNQRAdd_CGS2(N_Vector* Q, sunrealtype* R, N_Vector df, int m,
 {
   SUNFunctionBegin(Q[0]->sunctx);
   sunindextype j;
+  sunrealtype sqrnorms[2];
   SUNQRData qrdata = (SUNQRData)QRdata;
 
   N_VScale(ONE, df, qrdata->vtemp);
   SUNCheckLastErr(); /* temp = df */
 
-  if (m > 0)
+  if (m > 0 && qrdata->vtemp->ops->nvprojectsubtract != NULL)
   {
-    /* s_k = Q_k-1^T df_aa -- update with sdata as a sunrealtype* array */
-    SUNCheckCall(N_VDotProdMulti(m, qrdata->vtemp, Q, R + m * mMax));
-
-    /* y = df - Q_k-1 s_k */
-    SUNCheckCall(N_VLinearCombination(m, R + m * mMax, Q, qrdata->vtemp2));
-    N_VLinearSum(ONE, qrdata->vtemp, -ONE, qrdata->vtemp2, qrdata->vtemp2);
-    SUNCheckLastErr();
-
-    /* z_k = Q_k-1^T y */
-    SUNCheckCall(N_VDotProdMulti(m, qrdata->vtemp2, Q, qrdata->temp_array));
+    /* s_k = Q_k-1^T df and y = df - Q_k-1 s_k */
+    SUNCheckCall(
+      N_VProjectSubtract(m, qrdata->vtemp, Q, R + m * mMax, sqrnorms));
 
-    /* df = y - Q_k-1 z_k */
-    SUNCheckCall(N_VLinearCombination(m, qrdata->temp_array, Q, Q[m]));
-    N_VLinearSum(ONE, qrdata->vtemp2, -ONE, Q[m], qrdata->vtemp);
-    SUNCheckLastErr();
+    /* z_k = Q_k-1^T y and df = y - Q_k-1 z_k */
+    SUNCheckCall(N_VProjectSubtract(m, qrdata->vtemp, Q, qrdata->temp_array,
+                                    sqrnorms));
 
     /* R(1:k-1,k) = s_k + z_k */
     for (j = 0; j < m; j++)
     {
       R[m * mMax + j] = R[m * mMax + j] + qrdata->temp_array[j];
     }
+
+    /* R(k,k) = \| df \| */
+    R[m * mMax + m] = SUNRsqrt(sqrnorms[1]);
   }
+  else
+  {
+    if (m > 0)
+    {
+      /* s_k = Q_k-1^T df_aa -- update with sdata as a sunrealtype* array */
+      SUNCheckCall(N_VDotProdMulti(m, qrdata->vtemp, Q, R + m * mMax));
 
-  /* R(k,k) = \| df \| */
-  R[m * mMax + m] = N_VDotProd(qrdata->vtemp, qrdata->vtemp);
-  SUNCheckLastErr();
-  R[m * mMax + m] = SUNRsqrt(R[m * mMax + m]);
+      /* y = df - Q_k-1 s_k */
+      SUNCheckCall(N_VLinearCombination(m, R + m * mMax, Q, qrdata->vtemp2));
+      N_VLinearSum(ONE, qrdata->vtemp, -ONE, qrdata->vtemp2, qrdata->vtemp2);
+      SUNCheckLastErr();
+
+      /* z_k = Q_k-1^T y */
+      SUNCheckCall(N_VDotProdMulti(m, qrdata->vtemp2, Q, qrdata->temp_array));
+
+      /* df = y - Q_k-1 z_k */
+      SUNCheckCall(N_VLinearCombination(m, qrdata->temp_array, Q, Q[m]));
+      N_VLinearSum(ONE, qrdata->vtemp2, -ONE, Q[m], qrdata->vtemp);
+      SUNCheckLastErr();
+
+      /* R(1:k-1,k) = s_k + z_k */
+      for (j = 0; j < m; j++)
+      {
+        R[m * mMax + j] = R[m * mMax + j] + qrdata->temp_array[j];
+      }
+    }
+
+    /* R(k,k) = \| df \| */
+    R[m * mMax + m] = N_VDotProd(qrdata->vtemp, qrdata->vtemp);
+    SUNCheckLastErr();
+    R[m * mMax + m] = SUNRsqrt(R[m * mMax + m]);
+  }
   /* Q(:,k) = df / R(k,k) */
   N_VScale((1 / R[m * mMax + m]), qrdata->vtemp, Q[m]);
   SUNCheckLastErr();
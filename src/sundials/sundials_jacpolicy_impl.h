@@ -0,0 +1,195 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Cost model used by the integrator linear solver interfaces to
+ * decide when to re-evaluate the Jacobian (or preconditioner).
+ *
+ * The wall clock time of linear solver setups with and without a
+ * Jacobian evaluation and of Newton iterations are measured as the
+ * integration proceeds. The time between Jacobian evaluations is a
+ * renewal cycle: the Jacobian evaluation cost is paid once and each
+ * following interval between policy updates costs a setup (if one
+ * was done) plus its Newton iterations. The average cost per step
+ * over the cycle is minimized by re-evaluating the Jacobian once the
+ * cost per step of the most recent interval exceeds the average of
+ * the cycle.
+ *
+ * Progress is measured in successful steps rather than integration
+ * time, since the step size often changes by orders of magnitude
+ * over a cycle and the cost per unit time would then be dominated by
+ * the earliest steps.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_JACPOLICY_IMPL_H
+#define _SUNDIALS_JACPOLICY_IMPL_H
+
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_types.h>
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+#include <time.h>
+#define SUN_JACPOLICY_AVAILABLE 1
+#elif defined(WIN32) || defined(_WIN32)
+#include <windows.h>
+#define SUN_JACPOLICY_AVAILABLE 1
+#else
+#define SUN_JACPOLICY_AVAILABLE 0
+#endif
+
+/* weight of a new measurement in the running cost averages */
+#define SUN_JACPOLICY_WEIGHT 0.25
+
+typedef struct
+{
+  sunbooleantype enabled;
+
+  /* running averages of the measured costs in seconds */
+  double cost_jsetup; /* setup with a Jacobian evaluation */
+  double cost_setup;  /* setup reusing the Jacobian       */
+  double cost_iter;   /* Newton iteration                 */
+
+  /* current cycle since the last Jacobian evaluation */
+  double cycle_cost;    /* modeled cost of the intervals */
+  long int cycle_steps; /* steps advanced                */
+
+  /* current interval since the last update */
+  long int nst_update;  /* step counter at the last update        */
+  long int nsolves;     /* linear solves since the last update    */
+  sunbooleantype setup; /* a setup was done since the last update */
+
+  /* clock values */
+  double clock_setup; /* start of the current setup */
+  double clock_solve; /* start of the last solve    */
+} sunJacPolicy;
+
+/* Returns the value of a monotonic clock in seconds, the same clock used by
+   the SUNDIALS profiler */
+static inline double sunJacPolicyClock(void)
+{
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts)) { return 0.0; }
+  return (double)ts.tv_sec + 1.0e-9 * (double)ts.tv_nsec;
+#elif defined(WIN32) || defined(_WIN32)
+  LARGE_INTEGER ticks, ticks_per_sec;
+  QueryPerformanceFrequency(&ticks_per_sec);
+  QueryPerformanceCounter(&ticks);
+  return (double)ticks.QuadPart / (double)ticks_per_sec.QuadPart;
+#else
+  return 0.0;
+#endif
+}
+
+static inline void sunJacPolicyAverage(double* avg, double value)
+{
+  *avg = (*avg > 0.0) ? (1.0 - SUN_JACPOLICY_WEIGHT) * (*avg) +
+                          SUN_JACPOLICY_WEIGHT * value
+                      : value;
+}
+
+static inline void sunJacPolicy_Init(sunJacPolicy* policy,
+                                     sunbooleantype enabled)
+{
+  policy->enabled     = enabled;
+  policy->cost_jsetup = 0.0;
+  policy->cost_setup  = 0.0;
+  policy->cost_iter   = 0.0;
+  policy->cycle_cost  = 0.0;
+  policy->cycle_steps = 0;
+  policy->nst_update  = 0;
+  policy->nsolves     = 0;
+  policy->setup       = SUNFALSE;
+  policy->clock_setup = 0.0;
+  policy->clock_solve = 0.0;
+}
+
+/* Called when deciding whether to re-evaluate the Jacobian, nst is the number
+   of successful steps. Adds the interval since the previous update to the
+   cycle and returns SUNTRUE if re-evaluating the Jacobian is expected to lower
+   the cost per step. */
+static inline sunbooleantype sunJacPolicy_Update(sunJacPolicy* policy,
+                                                 long int nst)
+{
+  double jac_cost, interval_cost;
+  long int nsteps;
+  sunbooleantype stale = SUNFALSE;
+
+  nsteps        = nst - policy->nst_update;
+  interval_cost = policy->nsolves * policy->cost_iter;
+  if (policy->setup) { interval_cost += policy->cost_setup; }
+
+  policy->cycle_cost += interval_cost;
+  policy->cycle_steps += nsteps;
+
+  /* extra cost of a setup that evaluates the Jacobian */
+  jac_cost = policy->cost_jsetup - policy->cost_setup;
+  if (jac_cost < 0.0) { jac_cost = 0.0; }
+
+  /* compare the cost per step of the last interval to the cycle average */
+  if (nsteps > 0 && policy->cost_jsetup > 0.0)
+  {
+    stale = (interval_cost * policy->cycle_steps >
+             (jac_cost + policy->cycle_cost) * nsteps);
+  }
+
+  policy->nst_update = nst;
+  policy->nsolves    = 0;
+  policy->setup      = SUNFALSE;
+
+  return stale;
+}
+
+/* Called at the start of a linear solver setup */
+static inline void sunJacPolicy_BeginSetup(sunJacPolicy* policy)
+{
+  policy->clock_setup = sunJacPolicyClock();
+}
+
+/* Called after a linear solver setup, jcur indicates if the Jacobian was
+   evaluated in the setup */
+static inline void sunJacPolicy_EndSetup(sunJacPolicy* policy,
+                                         sunbooleantype jcur)
+{
+  double cost = sunJacPolicyClock() - policy->clock_setup;
+
+  if (jcur)
+  {
+    sunJacPolicyAverage(&policy->cost_jsetup, cost);
+    policy->cycle_cost  = 0.0;
+    policy->cycle_steps = 0;
+    policy->setup       = SUNFALSE;
+  }
+  else
+  {
+    sunJacPolicyAverage(&policy->cost_setup, cost);
+    policy->setup = SUNTRUE;
+  }
+
+  policy->clock_solve = 0.0;
+}
+
+/* Called at the start of each linear solve, curiter is the current Newton
+   iteration. The time between solves in the same nonlinear solve is the cost
+   of one Newton iteration. */
+static inline void sunJacPolicy_Solve(sunJacPolicy* policy, int curiter)
+{
+  double now = sunJacPolicyClock();
+
+  if (curiter > 0 && policy->clock_solve > 0.0)
+  {
+    sunJacPolicyAverage(&policy->cost_iter, now - policy->clock_solve);
+  }
+
+  policy->clock_solve = now;
+  policy->nsolves++;
+}
+
+#endif /* _SUNDIALS_JACPOLICY_IMPL_H */
@@ -19,6 +19,7 @@
  * -----------------------------------------------------------------*/
 
 #include <stdlib.h>
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/sundials_core.h>
 #include <sundials/sundials_errors.h>
@@ -48,12 +49,12 @@ SUNLinearSolver SUNLinSolNewEmpty(SUNContext sunctx)
 
   /* create linear solver object */
   LS = NULL;
-  LS = (SUNLinearSolver)malloc(sizeof *LS);
+  LS = (SUNLinearSolver)SUNContext_ArenaAlloc(sunctx, sizeof *LS);
   SUNAssertNull(LS, SUN_ERR_MALLOC_FAIL);
 
   /* create linear solver ops structure */
   ops = NULL;
-  ops = (SUNLinearSolver_Ops)malloc(sizeof *ops);
+  ops = (SUNLinearSolver_Ops)SUNContext_ArenaAlloc(sunctx, sizeof *ops);
   SUNAssertNull(ops, SUN_ERR_MALLOC_FAIL);
 
   /* initialize operations to NULL */
@@ -66,6 +67,7 @@ SUNLinearSolver SUNLinSolNewEmpty(SUNContext sunctx)
   ops->initialize        = NULL;
   ops->setup             = NULL;
   ops->solve             = NULL;
+  ops->solvemultiple     = NULL;
   ops->numiters          = NULL;
   ops->resnorm           = NULL;
   ops->resid             = NULL;
@@ -90,11 +92,11 @@ void SUNLinSolFreeEmpty(SUNLinearSolver S)
   if (S == NULL) { return; }
 
   /* free non-NULL ops structure */
-  if (S->ops) { free(S->ops); }
+  if (S->ops) { SUNContext_ArenaFree(S->sunctx, S->ops); }
   S->ops = NULL;
 
   /* free overall N_Vector object and return */
-  free(S);
+  SUNContext_ArenaFree(S->sunctx, S);
   return;
 }
 
@@ -183,6 +185,29 @@ int SUNLinSolSolve(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
   return (ier);
 }
 
+int SUNLinSolSolveMultiple(SUNLinearSolver S, SUNMatrix A, int nrhs,
+                           N_Vector* X, N_Vector* B, sunrealtype tol)
+{
+  int ier, j;
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(S));
+  if (S->ops->solvemultiple)
+  {
+    ier = S->ops->solvemultiple(S, A, nrhs, X, B, tol);
+  }
+  else
+  {
+    /* solve each system individually, stopping at the first failure */
+    ier = SUN_SUCCESS;
+    for (j = 0; j < nrhs; j++)
+    {
+      ier = S->ops->solve(S, A, X[j], B[j], tol);
+      if (ier != SUN_SUCCESS) { break; }
+    }
+  }
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(S));
+  return (ier);
+}
+
 int SUNLinSolNumIters(SUNLinearSolver S)
 {
   int result;
@@ -242,15 +267,15 @@ SUNErrCode SUNLinSolFree(SUNLinearSolver S)
      try to cleanup by freeing the content, ops, and solver */
   if (S->content)
   {
-    free(S->content);
+    SUNContext_ArenaFree(S->sunctx, S->content);
     S->content = NULL;
   }
   if (S->ops)
   {
-    free(S->ops);
+    SUNContext_ArenaFree(S->sunctx, S->ops);
     S->ops = NULL;
   }
-  free(S);
+  SUNContext_ArenaFree(S->sunctx, S);
   S = NULL;
 
   return SUN_SUCCESS;
@@ -13,9 +13,12 @@
  * -----------------------------------------------------------------*/
 
 #include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/sundials_config.h>
@@ -37,6 +40,19 @@
 /* default number of files that we allocate space for */
 #define SUN_DEFAULT_LOGFILE_HANDLES_ 8
 
+/* size of the stack buffer used to format a text log message, longer messages
+   fall back to a heap allocation */
+#define SUN_LOGMSG_BUFFER_SIZE_ 512
+
+static const char* sunLogLevelName(SUNLogLevel lvl)
+{
+  if (lvl == SUN_LOGLEVEL_DEBUG) { return "DEBUG"; }
+  else if (lvl == SUN_LOGLEVEL_WARNING) { return "WARNING"; }
+  else if (lvl == SUN_LOGLEVEL_INFO) { return "INFO"; }
+  else if (lvl == SUN_LOGLEVEL_ERROR) { return "ERROR"; }
+  return NULL;
+}
+
 void sunCreateLogMessage(SUNLogLevel lvl, int rank, const char* scope,
                          const char* label, const char* txt, va_list args,
                          char** log_msg)
@@ -59,10 +75,7 @@ void sunCreateLogMessage(SUNLogLevel lvl, int rank, const char* scope,
     free(fileAndLine);
   }
 
-  if (lvl == SUN_LOGLEVEL_DEBUG) { prefix = "DEBUG"; }
-  else if (lvl == SUN_LOGLEVEL_WARNING) { prefix = "WARNING"; }
-  else if (lvl == SUN_LOGLEVEL_INFO) { prefix = "INFO"; }
-  else if (lvl == SUN_LOGLEVEL_ERROR) { prefix = "ERROR"; }
+  prefix = sunLogLevelName(lvl);
 
   msg_length = snprintf(NULL, 0, "[%s][rank %d][%s][%s] %s\n", prefix, rank,
                         scope, label, formatted_txt);
@@ -73,6 +86,46 @@ void sunCreateLogMessage(SUNLogLevel lvl, int rank, const char* scope,
 }
 
 #if SUNDIALS_LOGGING_LEVEL > 0
+static void sunLoggerWriteText(FILE* fp, SUNLogLevel lvl, int rank,
+                               const char* scope, const char* label,
+                               const char* txt, va_list args)
+{
+  char buffer[SUN_LOGMSG_BUFFER_SIZE_];
+  char* log_msg;
+  int prefix_length, txt_length;
+  va_list args_copy;
+
+  /* format the message into a stack buffer and write it with a single call,
+     this avoids formatting the text twice and allocating a message buffer */
+  prefix_length = snprintf(buffer, SUN_LOGMSG_BUFFER_SIZE_,
+                           "[%s][rank %d][%s][%s] ", sunLogLevelName(lvl), rank,
+                           scope, label);
+  if (prefix_length >= 0 && prefix_length < SUN_LOGMSG_BUFFER_SIZE_)
+  {
+    va_copy(args_copy, args);
+    txt_length = vsnprintf(buffer + prefix_length,
+                           SUN_LOGMSG_BUFFER_SIZE_ - prefix_length, txt,
+                           args_copy);
+    va_end(args_copy);
+
+    if (txt_length >= 0 &&
+        prefix_length + txt_length + 1 < SUN_LOGMSG_BUFFER_SIZE_)
+    {
+      buffer[prefix_length + txt_length] = '\n';
+      fwrite(buffer, 1, prefix_length + txt_length + 1, fp);
+      return;
+    }
+  }
+
+  /* the message does not fit in the buffer */
+  sunCreateLogMessage(lvl, rank, scope, label, txt, args, &log_msg);
+  if (log_msg)
+  {
+    fputs(log_msg, fp);
+    free(log_msg);
+  }
+}
+
 static FILE* sunOpenLogFile(const char* fname, const char* mode)
 {
   FILE* fp = NULL;
@@ -190,6 +243,7 @@ SUNErrCode SUNLogger_CreateFromEnv(SUNComm comm, SUNLogger* logger_out)
   const char* warning_fname_env = getenv("SUNLOGGER_WARNING_FILENAME");
   const char* info_fname_env    = getenv("SUNLOGGER_INFO_FILENAME");
   const char* debug_fname_env   = getenv("SUNLOGGER_DEBUG_FILENAME");
+  const char* binary_fname_env  = getenv("SUNLOGGER_BINARY_FILENAME");
 
   if (SUNLogger_Create(comm, output_rank, &logger))
   {
@@ -205,6 +259,8 @@ SUNErrCode SUNLogger_CreateFromEnv(SUNComm comm, SUNLogger* logger_out)
     err = SUNLogger_SetDebugFilename(logger, debug_fname_env);
     if (err) { break; }
     err = SUNLogger_SetInfoFilename(logger, info_fname_env);
+    if (err) { break; }
+    err = SUNLogger_SetBinaryFilename(logger, binary_fname_env, 0);
   }
   while (0);
 
@@ -362,33 +418,25 @@ SUNErrCode SUNLogger_QueueMsg(SUNLogger logger, SUNLogLevel lvl,
       int rank = 0;
       if (sunLoggerIsOutputRank(logger, &rank))
       {
-        char* log_msg = NULL;
-        va_list args;
-        va_start(args, msg_txt);
-        sunCreateLogMessage(lvl, rank, scope, label, msg_txt, args, &log_msg);
-        va_end(args);
+        FILE* fp = NULL;
 
         switch (lvl)
         {
-        case (SUN_LOGLEVEL_DEBUG):
-          if (logger->debug_fp) { fprintf(logger->debug_fp, "%s", log_msg); }
-          break;
-        case (SUN_LOGLEVEL_WARNING):
-          if (logger->warning_fp)
-          {
-            fprintf(logger->warning_fp, "%s", log_msg);
-          }
-          break;
-        case (SUN_LOGLEVEL_INFO):
-          if (logger->info_fp) { fprintf(logger->info_fp, "%s", log_msg); }
-          break;
-        case (SUN_LOGLEVEL_ERROR):
-          if (logger->error_fp) { fprintf(logger->error_fp, "%s", log_msg); }
-          break;
+        case (SUN_LOGLEVEL_DEBUG): fp = logger->debug_fp; break;
+        case (SUN_LOGLEVEL_WARNING): fp = logger->warning_fp; break;
+        case (SUN_LOGLEVEL_INFO): fp = logger->info_fp; break;
+        case (SUN_LOGLEVEL_ERROR): fp = logger->error_fp; break;
         default: retval = SUN_ERR_UNREACHABLE;
         }
 
-        free(log_msg);
+        /* only format the message if the level has an output file */
+        if (fp)
+        {
+          va_list args;
+          va_start(args, msg_txt);
+          sunLoggerWriteText(fp, lvl, rank, scope, label, msg_txt, args);
+          va_end(args);
+        }
       }
     }
   }
@@ -489,3 +537,521 @@ SUNErrCode SUNLogger_Destroy(SUNLogger* logger_ptr)
 
   return retval;
 }
+
+/* -----------------------------------------------------------------
+ * Binary logger backend
+ *
+ * Messages are stored as compact binary records in a buffer that is
+ * written to the output file in large blocks. The message text is
+ * never formatted, a record holds the ids of the interned scope,
+ * label, and format strings along with the raw format arguments. The
+ * suntools Python module decodes the file into the text log format.
+ *
+ * File layout (native byte order):
+ *
+ *   header:  char magic[8] = "SUNLOGB", uint32 version, int32 rank
+ *   string:  uint8 kind = 1, uint32 id, uint32 length, char text[length]
+ *   message: uint8 kind = 2, uint8 level, uint64 time (ns),
+ *            uint32 scope id, uint32 label id, uint32 format id,
+ *            uint32 payload length, char payload[length]
+ *
+ * The payload holds one entry per format argument: integers and
+ * pointers as 8 byte integers, floating point values as 8 byte
+ * doubles, and strings as a uint32 length followed by the characters.
+ *
+ * The buffer, string table, and payload scratch space are shared by
+ * all threads using the logger and are guarded by a spin lock built on
+ * compiler atomics, so records from different threads are never
+ * interleaved. With compilers that provide neither the GNU __atomic
+ * builtins nor the MSVC interlocked intrinsics the lock is a no-op and
+ * the binary backend must not be used from multiple threads.
+ * ----------------------------------------------------------------- */
+
+#if SUNDIALS_LOGGING_LEVEL > 0
+
+#if defined(__GNUC__) || defined(__clang__)
+typedef char sunBinaryLogLock;
+#define SUN_BINLOG_LOCK_(lock) \
+  while (__atomic_test_and_set((lock), __ATOMIC_ACQUIRE)) {}
+#define SUN_BINLOG_UNLOCK_(lock) __atomic_clear((lock), __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+typedef volatile long sunBinaryLogLock;
+#define SUN_BINLOG_LOCK_(lock) \
+  while (_InterlockedExchange((lock), 1)) {}
+#define SUN_BINLOG_UNLOCK_(lock) _InterlockedExchange((lock), 0)
+#else
+typedef int sunBinaryLogLock;
+#define SUN_BINLOG_LOCK_(lock)   ((void)(lock))
+#define SUN_BINLOG_UNLOCK_(lock) ((void)(lock))
+#endif
+
+#define SUN_BINLOG_VERSION_     1
+#define SUN_BINLOG_STRING_      1
+#define SUN_BINLOG_MESSAGE_     2
+#define SUN_BINLOG_BUFFER_SIZE_ ((size_t)1 << 20)
+#define SUN_BINLOG_TABLE_SIZE_  64
+
+typedef struct
+{
+  const char* key; /* address of the interned string  */
+  char* text;      /* copy used to detect reused keys */
+  uint32_t id;
+} sunBinaryLogString;
+
+typedef struct
+{
+  FILE* fp;
+  int rank;
+
+  /* guards all of the members below */
+  sunBinaryLogLock lock;
+
+  /* output buffer */
+  char* buffer;
+  size_t capacity;
+  size_t length;
+
+  /* scratch space for a record payload */
+  char* payload;
+  size_t payload_capacity;
+
+  /* open addressing table of interned strings */
+  sunBinaryLogString* table;
+  size_t table_size;
+  uint32_t num_strings;
+} sunBinaryLogContent;
+
+static uint64_t sunBinaryLogTime(void)
+{
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts)) { return 0; }
+  return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+#else
+  return 0;
+#endif
+}
+
+static void sunBinaryLogDrain(sunBinaryLogContent* content)
+{
+  if (content->length > 0)
+  {
+    fwrite(content->buffer, 1, content->length, content->fp);
+    content->length = 0;
+  }
+}
+
+static void sunBinaryLogWrite(sunBinaryLogContent* content, const void* data,
+                              size_t size)
+{
+  if (content->length + size > content->capacity)
+  {
+    sunBinaryLogDrain(content);
+  }
+
+  /* records larger than the buffer are written directly */
+  if (size > content->capacity)
+  {
+    fwrite(data, 1, size, content->fp);
+    return;
+  }
+
+  memcpy(content->buffer + content->length, data, size);
+  content->length += size;
+}
+
+/* Insert a string into the table, the table size must be a power of two */
+static sunBinaryLogString* sunBinaryLogFindSlot(sunBinaryLogString* table,
+                                                size_t table_size,
+                                                const char* key)
+{
+  size_t i = ((size_t)(uintptr_t)key >> 3) & (table_size - 1);
+  while (table[i].key && table[i].key != key) { i = (i + 1) & (table_size - 1); }
+  return &table[i];
+}
+
+static SUNErrCode sunBinaryLogIntern(sunBinaryLogContent* content,
+                                     const char* str, uint32_t* id)
+{
+  sunBinaryLogString* entry;
+  unsigned char header[9];
+  uint32_t length;
+
+  if (!str) { str = "(null)"; }
+
+  /* strings are keyed by address, the text is compared to catch buffers that
+     are reused with different contents */
+  entry = sunBinaryLogFindSlot(content->table, content->table_size, str);
+  if (entry->key && !strcmp(entry->text, str))
+  {
+    *id = entry->id;
+    return SUN_SUCCESS;
+  }
+
+  if (entry->key) { free(entry->text); }
+  else if (2 * (content->num_strings + 1) > content->table_size)
+  {
+    /* grow the table to keep the load factor below one half */
+    size_t i, new_size = 2 * content->table_size;
+    sunBinaryLogString* new_table =
+      (sunBinaryLogString*)calloc(new_size, sizeof(sunBinaryLogString));
+    if (!new_table) { return SUN_ERR_MALLOC_FAIL; }
+    for (i = 0; i < content->table_size; i++)
+    {
+      if (content->table[i].key)
+      {
+        *sunBinaryLogFindSlot(new_table, new_size, content->table[i].key) =
+          content->table[i];
+      }
+    }
+    free(content->table);
+    content->table      = new_table;
+    content->table_size = new_size;
+    entry = sunBinaryLogFindSlot(content->table, content->table_size, str);
+  }
+
+  length      = (uint32_t)strlen(str);
+  entry->text = (char*)malloc(length + 1);
+  if (!entry->text)
+  {
+    entry->key = NULL;
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  memcpy(entry->text, str, length + 1);
+  entry->key = str;
+  entry->id  = content->num_strings++;
+
+  /* write the string definition before its first use */
+  header[0] = SUN_BINLOG_STRING_;
+  memcpy(header + 1, &entry->id, sizeof(uint32_t));
+  memcpy(header + 5, &length, sizeof(uint32_t));
+  sunBinaryLogWrite(content, header, sizeof(header));
+  sunBinaryLogWrite(content, str, length);
+
+  *id = entry->id;
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode sunBinaryLogAppend(sunBinaryLogContent* content,
+                                     size_t* length, const void* data,
+                                     size_t size)
+{
+  if (*length + size > content->payload_capacity)
+  {
+    size_t new_capacity = 2 * (*length + size);
+    char* new_payload   = (char*)realloc(content->payload, new_capacity);
+    if (!new_payload) { return SUN_ERR_MALLOC_FAIL; }
+    content->payload          = new_payload;
+    content->payload_capacity = new_capacity;
+  }
+  memcpy(content->payload + *length, data, size);
+  *length += size;
+  return SUN_SUCCESS;
+}
+
+/* Store the arguments of a printf style format string in the payload buffer */
+static SUNErrCode sunBinaryLogPack(sunBinaryLogContent* content,
+                                   const char* fmt, va_list args,
+                                   size_t* length)
+{
+  SUNErrCode err = SUN_SUCCESS;
+  const char* f  = fmt;
+  char mod;
+  int64_t ival;
+  uint64_t uval;
+  double dval;
+  const char* sval;
+  uint32_t slen;
+
+  *length = 0;
+
+  while (!err && (f = strchr(f, '%')) != NULL)
+  {
+    f++;
+    if (*f == '%')
+    {
+      f++;
+      continue;
+    }
+
+    /* flags */
+    while (*f && strchr("-+ #0", *f)) { f++; }
+
+    /* width */
+    if (*f == '*')
+    {
+      ival = va_arg(args, int);
+      err  = sunBinaryLogAppend(content, length, &ival, sizeof(ival));
+      f++;
+    }
+    else
+    {
+      while (*f >= '0' && *f <= '9') { f++; }
+    }
+
+    /* precision */
+    if (*f == '.')
+    {
+      f++;
+      if (*f == '*')
+      {
+        ival = va_arg(args, int);
+        err  = sunBinaryLogAppend(content, length, &ival, sizeof(ival));
+        f++;
+      }
+      else
+      {
+        while (*f >= '0' && *f <= '9') { f++; }
+      }
+    }
+
+    /* length modifier, 'H' is hh and 'q' is ll */
+    mod = '\0';
+    if (*f && strchr("hljztL", *f))
+    {
+      mod = *f++;
+      if (mod == 'h' && *f == 'h')
+      {
+        mod = 'H';
+        f++;
+      }
+      else if (mod == 'l' && *f == 'l')
+      {
+        mod = 'q';
+        f++;
+      }
+    }
+
+    switch (*f)
+    {
+    case 'd':
+    case 'i':
+      if (mod == 'l') { ival = va_arg(args, long); }
+      else if (mod == 'q') { ival = va_arg(args, long long); }
+      else if (mod == 'j') { ival = va_arg(args, intmax_t); }
+      else if (mod == 'z') { ival = (int64_t)va_arg(args, size_t); }
+      else if (mod == 't') { ival = va_arg(args, ptrdiff_t); }
+      else { ival = va_arg(args, int); }
+      err = sunBinaryLogAppend(content, length, &ival, sizeof(ival));
+      break;
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+      if (mod == 'l') { uval = va_arg(args, unsigned long); }
+      else if (mod == 'q') { uval = va_arg(args, unsigned long long); }
+      else if (mod == 'j') { uval = va_arg(args, uintmax_t); }
+      else if (mod == 'z') { uval = va_arg(args, size_t); }
+      else if (mod == 't') { uval = (uint64_t)va_arg(args, ptrdiff_t); }
+      else { uval = va_arg(args, unsigned int); }
+      err = sunBinaryLogAppend(content, length, &uval, sizeof(uval));
+      break;
+    case 'c':
+      ival = va_arg(args, int);
+      err  = sunBinaryLogAppend(content, length, &ival, sizeof(ival));
+      break;
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+      if (mod == 'L') { dval = (double)va_arg(args, long double); }
+      else { dval = va_arg(args, double); }
+      err = sunBinaryLogAppend(content, length, &dval, sizeof(dval));
+      break;
+    case 's':
+      sval = va_arg(args, const char*);
+      if (!sval) { sval = "(null)"; }
+      slen = (uint32_t)strlen(sval);
+      err  = sunBinaryLogAppend(content, length, &slen, sizeof(slen));
+      if (!err) { err = sunBinaryLogAppend(content, length, sval, slen); }
+      break;
+    case 'p':
+      uval = (uint64_t)(uintptr_t)va_arg(args, void*);
+      err  = sunBinaryLogAppend(content, length, &uval, sizeof(uval));
+      break;
+    case 'n': (void)va_arg(args, void*); break;
+    default:
+      /* unknown conversion, stop parsing the format string */
+      return err;
+    }
+    f++;
+  }
+
+  return err;
+}
+
+static SUNErrCode sunBinaryLogQueueMsg(SUNLogger logger, SUNLogLevel lvl,
+                                       const char* scope, const char* label,
+                                       const char* msg_txt, va_list args)
+{
+  SUNErrCode err;
+  sunBinaryLogContent* content = (sunBinaryLogContent*)logger->content;
+  unsigned char header[26];
+  uint64_t time;
+  uint32_t scope_id, label_id, fmt_id, length;
+  size_t payload_length;
+
+  /* like the text output, drop levels that are not enabled in this build */
+  if ((int)lvl > SUNDIALS_LOGGING_LEVEL) { return SUN_SUCCESS; }
+
+  /* errors are also written immediately to the error output */
+  if (lvl == SUN_LOGLEVEL_ERROR && logger->error_fp)
+  {
+    va_list args_copy;
+    va_copy(args_copy, args);
+    sunLoggerWriteText(logger->error_fp, lvl, content->rank, scope, label,
+                       msg_txt, args_copy);
+    va_end(args_copy);
+  }
+
+  SUN_BINLOG_LOCK_(&content->lock);
+
+  time = sunBinaryLogTime();
+
+  do {
+    err = sunBinaryLogIntern(content, scope, &scope_id);
+    if (err) { break; }
+    err = sunBinaryLogIntern(content, label, &label_id);
+    if (err) { break; }
+    err = sunBinaryLogIntern(content, msg_txt, &fmt_id);
+    if (err) { break; }
+    err = sunBinaryLogPack(content, msg_txt, args, &payload_length);
+  }
+  while (0);
+
+  if (err)
+  {
+    SUN_BINLOG_UNLOCK_(&content->lock);
+    return err;
+  }
+
+  length = (uint32_t)payload_length;
+
+  header[0] = SUN_BINLOG_MESSAGE_;
+  header[1] = (unsigned char)lvl;
+  memcpy(header + 2, &time, sizeof(uint64_t));
+  memcpy(header + 10, &scope_id, sizeof(uint32_t));
+  memcpy(header + 14, &label_id, sizeof(uint32_t));
+  memcpy(header + 18, &fmt_id, sizeof(uint32_t));
+  memcpy(header + 22, &length, sizeof(uint32_t));
+  sunBinaryLogWrite(content, header, sizeof(header));
+  sunBinaryLogWrite(content, content->payload, payload_length);
+
+  SUN_BINLOG_UNLOCK_(&content->lock);
+
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode sunBinaryLogFlush(SUNLogger logger, SUNLogLevel lvl)
+{
+  sunBinaryLogContent* content = (sunBinaryLogContent*)logger->content;
+
+  SUN_BINLOG_LOCK_(&content->lock);
+  sunBinaryLogDrain(content);
+  fflush(content->fp);
+  SUN_BINLOG_UNLOCK_(&content->lock);
+  if ((lvl == SUN_LOGLEVEL_ERROR || lvl == SUN_LOGLEVEL_ALL) && logger->error_fp)
+  {
+    fflush(logger->error_fp);
+  }
+
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode sunBinaryLogDestroy(SUNLogger* logger_ptr)
+{
+  SUNLogger logger             = *logger_ptr;
+  sunBinaryLogContent* content = (sunBinaryLogContent*)logger->content;
+  size_t i;
+
+  if (content)
+  {
+    sunBinaryLogDrain(content);
+    sunCloseLogFile(content->fp);
+    for (i = 0; i < content->table_size; i++) { free(content->table[i].text); }
+    free(content->table);
+    free(content->payload);
+    free(content->buffer);
+    free(content);
+  }
+
+  /* release the rest of the logger with the default implementation */
+  logger->content  = NULL;
+  logger->queuemsg = NULL;
+  logger->flush    = NULL;
+  logger->destroy  = NULL;
+  return SUNLogger_Destroy(logger_ptr);
+}
+
+#endif
+
+SUNErrCode SUNLogger_SetBinaryFilename(SUNLogger logger,
+                                       const char* binary_filename,
+                                       size_t buffer_size)
+{
+  if (!logger) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (!sunLoggerIsOutputRank(logger, NULL)) { return SUN_SUCCESS; }
+
+  if (binary_filename && strcmp(binary_filename, ""))
+  {
+#if SUNDIALS_LOGGING_LEVEL > 0
+    sunBinaryLogContent* content = NULL;
+    char magic[8]                = "SUNLOGB";
+    uint32_t version             = SUN_BINLOG_VERSION_;
+    int32_t rank                 = 0;
+    int irank                    = 0;
+
+    /* the binary backend replaces the message operations */
+    if (logger->queuemsg || logger->content) { return SUN_ERR_ARG_INCOMPATIBLE; }
+
+    sunLoggerIsOutputRank(logger, &irank);
+    rank = (int32_t)irank;
+
+    if (buffer_size == 0) { buffer_size = SUN_BINLOG_BUFFER_SIZE_; }
+
+    content = (sunBinaryLogContent*)calloc(1, sizeof(sunBinaryLogContent));
+    if (!content) { return SUN_ERR_MALLOC_FAIL; }
+    content->rank       = irank;
+    content->capacity   = buffer_size;
+    content->buffer     = (char*)malloc(buffer_size);
+    content->table_size = SUN_BINLOG_TABLE_SIZE_;
+    content->table      = (sunBinaryLogString*)calloc(content->table_size,
+                                                      sizeof(sunBinaryLogString));
+    if (!content->buffer || !content->table)
+    {
+      free(content->buffer);
+      free(content->table);
+      free(content);
+      return SUN_ERR_MALLOC_FAIL;
+    }
+
+    content->fp = fopen(binary_filename, "wb");
+    if (!content->fp)
+    {
+      free(content->buffer);
+      free(content->table);
+      free(content);
+      return SUN_ERR_FILE_OPEN;
+    }
+
+    sunBinaryLogWrite(content, magic, sizeof(magic));
+    sunBinaryLogWrite(content, &version, sizeof(version));
+    sunBinaryLogWrite(content, &rank, sizeof(rank));
+
+    logger->content  = content;
+    logger->queuemsg = sunBinaryLogQueueMsg;
+    logger->flush    = sunBinaryLogFlush;
+    logger->destroy  = sunBinaryLogDestroy;
+#else
+    ((void)buffer_size);
+#endif
+  }
+
+  return SUN_SUCCESS;
+}
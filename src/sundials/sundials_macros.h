@@ -36,4 +36,29 @@
 #define SUNDIALS_MAYBE_UNUSED
 #endif
 
+/* -----------------------------------------------------------------------------
+ * SUNDIALS_OMP_PARALLEL_FOR
+ *
+ * Executes the for loop that follows with a team of n OpenMP threads when
+ * compiled with OpenMP and n > 1. The static schedule with chunk size one
+ * assigns iteration i to thread i when the loop has n iterations. Without
+ * OpenMP the loop is executed serially.
+ *
+ * SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(n, clause) additionally applies the
+ * OpenMP reduction clause, e.g., SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(n, + : s).
+ * ---------------------------------------------------------------------------*/
+
+#if defined(_OPENMP)
+#define SUNDIALS_PRAGMA(x) _Pragma(#x)
+#define SUNDIALS_OMP_PARALLEL_FOR(n)                           \
+  SUNDIALS_PRAGMA(omp parallel for num_threads(n) if ((n) > 1) \
+                    schedule(static, 1))
+#define SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(n, clause)         \
+  SUNDIALS_PRAGMA(omp parallel for num_threads(n) if ((n) > 1) \
+                    schedule(static, 1) reduction(clause))
+#else
+#define SUNDIALS_OMP_PARALLEL_FOR(n)
+#define SUNDIALS_OMP_PARALLEL_FOR_REDUCTION(n, clause)
+#endif
+
 #endif /* _SUNDIALS_MACROS_H */
@@ -21,6 +21,7 @@
 #include "sundials/sundials_matrix.h"
 
 #include <stdlib.h>
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/sundials_core.h>
 
@@ -45,12 +46,12 @@ SUNMatrix SUNMatNewEmpty(SUNContext sunctx)
 
   /* create matrix object */
   A = NULL;
-  A = (SUNMatrix)malloc(sizeof *A);
+  A = (SUNMatrix)SUNContext_ArenaAlloc(sunctx, sizeof *A);
   SUNAssertNull(A, SUN_ERR_MALLOC_FAIL);
 
   /* create matrix ops structure */
   ops = NULL;
-  ops = (SUNMatrix_Ops)malloc(sizeof *ops);
+  ops = (SUNMatrix_Ops)SUNContext_ArenaAlloc(sunctx, sizeof *ops);
   SUNAssertNull(ops, SUN_ERR_MALLOC_FAIL);
 
   /* initialize operations to NULL */
@@ -83,11 +84,11 @@ void SUNMatFreeEmpty(SUNMatrix A)
   if (A == NULL) { return; }
 
   /* free non-NULL ops structure */
-  if (A->ops) { free(A->ops); }
+  if (A->ops) { SUNContext_ArenaFree(A->sunctx, A->ops); }
   A->ops = NULL;
 
   /* free overall SUNMatrix object and return */
-  free(A);
+  SUNContext_ArenaFree(A->sunctx, A);
   return;
 }
 
@@ -156,15 +157,15 @@ void SUNMatDestroy(SUNMatrix A)
      try to cleanup by freeing the content, ops, and matrix */
   if (A->content)
   {
-    free(A->content);
+    SUNContext_ArenaFree(A->sunctx, A->content);
     A->content = NULL;
   }
   if (A->ops)
   {
-    free(A->ops);
+    SUNContext_ArenaFree(A->sunctx, A->ops);
     A->ops = NULL;
   }
-  free(A);
+  SUNContext_ArenaFree(A->sunctx, A);
   A = NULL;
 
   return;
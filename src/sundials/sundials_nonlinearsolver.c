@@ -45,12 +45,12 @@ SUNNonlinearSolver SUNNonlinSolNewEmpty(SUNContext sunctx)
 
   /* create nonlinear solver object */
   NLS = NULL;
-  NLS = (SUNNonlinearSolver)malloc(sizeof *NLS);
+  NLS = (SUNNonlinearSolver)SUNContext_ArenaAlloc(sunctx, sizeof *NLS);
   SUNAssertNull(NLS, SUN_ERR_MALLOC_FAIL);
 
   /* create nonlinear solver ops structure */
   ops = NULL;
-  ops = (SUNNonlinearSolver_Ops)malloc(sizeof *ops);
+  ops = (SUNNonlinearSolver_Ops)SUNContext_ArenaAlloc(sunctx, sizeof *ops);
   SUNAssertNull(ops, SUN_ERR_MALLOC_FAIL);
 
   /* initialize operations to NULL */
@@ -85,11 +85,11 @@ void SUNNonlinSolFreeEmpty(SUNNonlinearSolver NLS)
   if (NLS == NULL) { return; }
 
   /* free non-NULL ops structure */
-  if (NLS->ops) { free(NLS->ops); }
+  if (NLS->ops) { SUNContext_ArenaFree(NLS->sunctx, NLS->ops); }
   NLS->ops = NULL;
 
   /* free overall N_Vector object and return */
-  free(NLS);
+  SUNContext_ArenaFree(NLS->sunctx, NLS);
   return;
 }
 
@@ -146,15 +146,15 @@ SUNErrCode SUNNonlinSolFree(SUNNonlinearSolver NLS)
      try to cleanup by freeing the content, ops, and solver */
   if (NLS->content)
   {
-    free(NLS->content);
+    SUNContext_ArenaFree(NLS->sunctx, NLS->content);
     NLS->content = NULL;
   }
   if (NLS->ops)
   {
-    free(NLS->ops);
+    SUNContext_ArenaFree(NLS->sunctx, NLS->ops);
     NLS->ops = NULL;
   }
-  free(NLS);
+  SUNContext_ArenaFree(NLS->sunctx, NLS);
   NLS = NULL;
 
   return (SUN_SUCCESS);
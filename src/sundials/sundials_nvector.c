@@ -20,7 +20,9 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sundials/priv/sundials_context_impl.h>
+#include <sundials/priv/sundials_nvector_impl.h>
 #include <sundials/sundials_core.h>
 #include <sundials/sundials_nvector.h>
 
@@ -50,12 +52,12 @@ N_Vector N_VNewEmpty(SUNContext sunctx)
 
   /* create vector object */
   v = NULL;
-  v = (N_Vector)malloc(sizeof *v);
+  v = (N_Vector)SUNContext_ArenaAlloc(sunctx, sizeof *v);
   SUNAssertNull(v, SUN_ERR_MALLOC_FAIL);
 
   /* create vector ops structure */
   ops = NULL;
-  ops = (N_Vector_Ops)malloc(sizeof *ops);
+  ops = (N_Vector_Ops)SUNContext_ArenaAlloc(sunctx, sizeof *ops);
   SUNAssertNull(ops, SUN_ERR_MALLOC_FAIL);
 
   /* initialize operations to NULL */
@@ -109,6 +111,8 @@ N_Vector N_VNewEmpty(SUNContext sunctx)
   ops->nvlinearcombination = NULL;
   ops->nvscaleaddmulti     = NULL;
   ops->nvdotprodmulti      = NULL;
+  ops->nvprojectsubtract   = NULL;
+  ops->nvpascalupdate      = NULL;
 
   /* vector array operations (optional) */
   ops->nvlinearsumvectorarray         = NULL;
@@ -164,12 +168,15 @@ void N_VFreeEmpty(N_Vector v)
 {
   if (v == NULL) { return; }
 
-  /* free non-NULL ops structure */
-  if (v->ops) { free(v->ops); }
+  /* free non-NULL ops structure (shared tables are released) */
+  if (v->ops && !SUNContext_ReleaseVectorOps(v->sunctx, v->ops))
+  {
+    SUNContext_ArenaFree(v->sunctx, v->ops);
+  }
   v->ops = NULL;
 
   /* free overall N_Vector object and return */
-  free(v);
+  SUNContext_ArenaFree(v->sunctx, v);
 
   return;
 }
@@ -181,6 +188,9 @@ SUNErrCode N_VCopyOps(N_Vector w, N_Vector v)
   /* Check that ops structures exist */
   SUNAssert(w && w->ops && v && v->ops, SUN_ERR_ARG_CORRUPT);
 
+  /* A shared table must not be modified */
+  SUNCheckCall(N_VUnshareOps(v));
+
   /* Copy ops from w to v */
 
   /*
@@ -233,6 +243,8 @@ SUNErrCode N_VCopyOps(N_Vector w, N_Vector v)
   v->ops->nvlinearcombination = w->ops->nvlinearcombination;
   v->ops->nvscaleaddmulti     = w->ops->nvscaleaddmulti;
   v->ops->nvdotprodmulti      = w->ops->nvdotprodmulti;
+  v->ops->nvprojectsubtract   = w->ops->nvprojectsubtract;
+  v->ops->nvpascalupdate      = w->ops->nvpascalupdate;
 
   /* vector array operations */
   v->ops->nvlinearsumvectorarray     = w->ops->nvlinearsumvectorarray;
@@ -274,6 +286,77 @@ SUNErrCode N_VCopyOps(N_Vector w, N_Vector v)
   return SUN_SUCCESS;
 }
 
+/* Create an empty NVector object with the (shared) ops of w */
+N_Vector N_VNewEmptyWithOps(N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+  N_Vector_Ops ops;
+
+  ops = SUNContext_AcquireVectorOps(w->sunctx, w->ops);
+  if (ops == NULL)
+  {
+    /* sharing is disabled, copy the ops */
+    v = N_VNewEmpty(w->sunctx);
+    SUNCheckLastErrNull();
+    SUNCheckCallNull(N_VCopyOps(w, v));
+    return v;
+  }
+
+  v = (N_Vector)SUNContext_ArenaAlloc(w->sunctx, sizeof *v);
+  if (v == NULL) { SUNContext_ReleaseVectorOps(w->sunctx, ops); }
+  SUNAssertNull(v, SUN_ERR_MALLOC_FAIL);
+
+  v->ops     = ops;
+  v->content = NULL;
+  v->sunctx  = w->sunctx;
+
+  return v;
+}
+
+/* Replace the ops of v with the equivalent shared ops */
+SUNErrCode N_VShareOps(N_Vector v)
+{
+  N_Vector_Ops ops;
+
+  ops = SUNContext_AcquireVectorOps(v->sunctx, v->ops);
+  if (ops == NULL) { return SUN_SUCCESS; }
+
+  /* v already uses the shared table, undo the second acquire */
+  if (ops == v->ops)
+  {
+    SUNContext_ReleaseVectorOps(v->sunctx, ops);
+    return SUN_SUCCESS;
+  }
+
+  /* release a previously shared table or free the private table */
+  if (!SUNContext_ReleaseVectorOps(v->sunctx, v->ops))
+  {
+    SUNContext_ArenaFree(v->sunctx, v->ops);
+  }
+  v->ops = ops;
+
+  return SUN_SUCCESS;
+}
+
+/* Replace the shared ops of v with a private copy */
+SUNErrCode N_VUnshareOps(N_Vector v)
+{
+  SUNFunctionBegin(v->sunctx);
+  N_Vector_Ops ops;
+
+  if (!SUNContext_IsSharedVectorOps(v->sunctx, v->ops)) { return SUN_SUCCESS; }
+
+  ops = (N_Vector_Ops)SUNContext_ArenaAlloc(v->sunctx, sizeof *ops);
+  SUNAssert(ops, SUN_ERR_MALLOC_FAIL);
+  memcpy(ops, v->ops, sizeof *ops);
+
+  SUNContext_ReleaseVectorOps(v->sunctx, v->ops);
+  v->ops = ops;
+
+  return SUN_SUCCESS;
+}
+
 /* -----------------------------------------------------------------
  * Functions in the 'ops' structure
  * -----------------------------------------------------------------*/
@@ -312,15 +395,15 @@ void N_VDestroy(N_Vector v)
       try to cleanup by freeing the content, ops, and vector */
     if (v->content)
     {
-      free(v->content);
+      SUNContext_ArenaFree(v->sunctx, v->content);
       v->content = NULL;
     }
-    if (v->ops)
+    if (v->ops && !SUNContext_ReleaseVectorOps(v->sunctx, v->ops))
     {
-      free(v->ops);
-      v->ops = NULL;
+      SUNContext_ArenaFree(v->sunctx, v->ops);
     }
-    free(v);
+    v->ops = NULL;
+    SUNContext_ArenaFree(v->sunctx, v);
     v = NULL;
   }
 
@@ -615,6 +698,98 @@ SUNErrCode N_VDotProdMulti(int nvec, N_Vector x, N_Vector* Y,
   return (ier);
 }
 
+SUNErrCode N_VProjectSubtract(int nvec, N_Vector x, N_Vector* Y,
+                              sunrealtype* dotprods, sunrealtype* sqrnorms)
+{
+  int i;
+  SUNErrCode ier;
+  sunrealtype* c = NULL;
+  N_Vector* V    = NULL;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
+
+  if (x->ops->nvprojectsubtract != NULL)
+  {
+    ier = x->ops->nvprojectsubtract(nvec, x, Y, dotprods, sqrnorms);
+  }
+  else if (x->ops->nvdotprodmulti != NULL ||
+           x->ops->nvlinearcombination != NULL)
+  {
+    /* allocate arrays of coefficients and vectors */
+    c = (sunrealtype*)malloc((nvec + 1) * sizeof(sunrealtype));
+    V = (N_Vector*)malloc((nvec + 1) * sizeof(N_Vector));
+
+    if (c == NULL || V == NULL) { ier = SUN_ERR_MALLOC_FAIL; }
+    else
+    {
+      V[0] = x;
+      for (i = 0; i < nvec; i++) { V[i + 1] = Y[i]; }
+
+      /* dot products and squared norm of x in a single reduction */
+      ier = N_VDotProdMulti(nvec + 1, x, V, c);
+
+      if (ier == SUN_SUCCESS)
+      {
+        sqrnorms[0] = c[0];
+        c[0]        = SUN_RCONST(1.0);
+        for (i = 0; i < nvec; i++)
+        {
+          dotprods[i] = c[i + 1];
+          c[i + 1]    = -c[i + 1];
+        }
+        ier = N_VLinearCombination(nvec + 1, c, V, x);
+      }
+
+      if (ier == SUN_SUCCESS) { sqrnorms[1] = x->ops->nvdotprod(x, x); }
+    }
+
+    /* free arrays */
+    free(c);
+    free(V);
+  }
+  else
+  {
+    sqrnorms[0] = x->ops->nvdotprod(x, x);
+    for (i = 0; i < nvec; i++) { dotprods[i] = x->ops->nvdotprod(x, Y[i]); }
+    for (i = 0; i < nvec; i++)
+    {
+      x->ops->nvlinearsum(-dotprods[i], Y[i], SUN_RCONST(1.0), x, x);
+    }
+    sqrnorms[1] = x->ops->nvdotprod(x, x);
+    ier         = SUN_SUCCESS;
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  return (ier);
+}
+
+SUNErrCode N_VPascalUpdate(int nvec, sunrealtype c, N_Vector* Z)
+{
+  int i, k;
+  SUNErrCode ier;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(Z[0]));
+
+  if (Z[0]->ops->nvpascalupdate != NULL)
+  {
+    ier = Z[0]->ops->nvpascalupdate(nvec, c, Z);
+  }
+  else
+  {
+    for (k = 1; k < nvec; k++)
+    {
+      for (i = nvec - 1; i >= k; i--)
+      {
+        Z[0]->ops->nvlinearsum(SUN_RCONST(1.0), Z[i - 1], c, Z[i], Z[i - 1]);
+      }
+    }
+    ier = SUN_SUCCESS;
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(Z[0]));
+  return (ier);
+}
+
 /* -----------------------------------------------------------------
  * OPTIONAL vector array operations
  * -----------------------------------------------------------------*/
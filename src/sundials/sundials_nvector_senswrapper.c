@@ -139,77 +139,29 @@ N_Vector N_VCloneEmpty_SensWrapper(N_Vector w)
 {
   int i;
   N_Vector v;
-  N_Vector_Ops ops;
   N_VectorContent_SensWrapper content;
 
   if (w == NULL) { return (NULL); }
 
   if (NV_NVECS_SW(w) < 1) { return (NULL); }
 
-  /* create vector */
+  /* create vector and copy operations */
   v = NULL;
-  v = (N_Vector)malloc(sizeof *v);
+  v = N_VNewEmpty(w->sunctx);
   if (v == NULL) { return (NULL); }
 
-  /* create vector operation structure */
-  ops = NULL;
-  ops = (N_Vector_Ops)malloc(sizeof *ops);
-  if (ops == NULL)
+  if (N_VCopyOps(w, v))
   {
-    free(v);
+    N_VFreeEmpty(v);
     return (NULL);
   }
 
-  ops->nvgetvectorid     = w->ops->nvgetvectorid;
-  ops->nvclone           = w->ops->nvclone;
-  ops->nvcloneempty      = w->ops->nvcloneempty;
-  ops->nvdestroy         = w->ops->nvdestroy;
-  ops->nvspace           = w->ops->nvspace;
-  ops->nvgetarraypointer = w->ops->nvgetarraypointer;
-  ops->nvsetarraypointer = w->ops->nvsetarraypointer;
-
-  /* standard vector operations */
-  ops->nvlinearsum    = w->ops->nvlinearsum;
-  ops->nvconst        = w->ops->nvconst;
-  ops->nvprod         = w->ops->nvprod;
-  ops->nvdiv          = w->ops->nvdiv;
-  ops->nvscale        = w->ops->nvscale;
-  ops->nvabs          = w->ops->nvabs;
-  ops->nvinv          = w->ops->nvinv;
-  ops->nvaddconst     = w->ops->nvaddconst;
-  ops->nvdotprod      = w->ops->nvdotprod;
-  ops->nvmaxnorm      = w->ops->nvmaxnorm;
-  ops->nvwrmsnormmask = w->ops->nvwrmsnormmask;
-  ops->nvwrmsnorm     = w->ops->nvwrmsnorm;
-  ops->nvmin          = w->ops->nvmin;
-  ops->nvwl2norm      = w->ops->nvwl2norm;
-  ops->nvl1norm       = w->ops->nvl1norm;
-  ops->nvcompare      = w->ops->nvcompare;
-  ops->nvinvtest      = w->ops->nvinvtest;
-  ops->nvconstrmask   = w->ops->nvconstrmask;
-  ops->nvminquotient  = w->ops->nvminquotient;
-
-  /* fused vector operations */
-  ops->nvlinearcombination = w->ops->nvlinearcombination;
-  ops->nvscaleaddmulti     = w->ops->nvscaleaddmulti;
-  ops->nvdotprodmulti      = w->ops->nvdotprodmulti;
-
-  /* vector array operations */
-  ops->nvlinearsumvectorarray         = w->ops->nvlinearsumvectorarray;
-  ops->nvscalevectorarray             = w->ops->nvscalevectorarray;
-  ops->nvconstvectorarray             = w->ops->nvconstvectorarray;
-  ops->nvwrmsnormvectorarray          = w->ops->nvwrmsnormvectorarray;
-  ops->nvwrmsnormmaskvectorarray      = w->ops->nvwrmsnormmaskvectorarray;
-  ops->nvscaleaddmultivectorarray     = w->ops->nvscaleaddmultivectorarray;
-  ops->nvlinearcombinationvectorarray = w->ops->nvlinearcombinationvectorarray;
-
   /* Create content */
   content = NULL;
   content = (N_VectorContent_SensWrapper)malloc(sizeof *content);
   if (content == NULL)
   {
-    free(ops);
-    free(v);
+    N_VFreeEmpty(v);
     return (NULL);
   }
 
@@ -219,18 +171,16 @@ N_Vector N_VCloneEmpty_SensWrapper(N_Vector w)
   content->vecs     = (N_Vector*)malloc(NV_NVECS_SW(w) * sizeof(N_Vector));
   if (content->vecs == NULL)
   {
-    free(ops);
-    free(v);
     free(content);
+    N_VFreeEmpty(v);
     return (NULL);
   }
 
   /* initialize vector array to null */
   for (i = 0; i < NV_NVECS_SW(w); i++) { content->vecs[i] = NULL; }
 
-  /* Attach content and ops */
+  /* Attach content */
   v->content = content;
-  v->ops     = ops;
 
   return (v);
 }
@@ -286,10 +236,8 @@ void N_VDestroy_SensWrapper(N_Vector v)
   NV_VECS_SW(v) = NULL;
   free(v->content);
   v->content = NULL;
-  free(v->ops);
-  v->ops = NULL;
-  free(v);
-  v = NULL;
+
+  N_VFreeEmpty(v);
 
   return;
 }
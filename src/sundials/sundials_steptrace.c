@@ -0,0 +1,302 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Implementation of the SUNStepTrace class. The records are stored
+ * column-wise so that each field is a contiguous array that can be
+ * returned to the user or written to a file without copying.
+ * -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_core.h>
+#include <sundials/sundials_steptrace.h>
+
+#define SUN_STEPTRACE_VERSION_ 1
+
+#define SUN_STEPTRACE_NUM_LONG_FIELDS_ \
+  (SUN_STEPTRACE_NUM_FIELDS - SUN_STEPTRACE_NUM_REAL_FIELDS)
+
+struct SUNStepTrace_
+{
+  SUNContext sunctx;
+
+  long int capacity;    /* maximum number of records           */
+  long int num_records; /* number of stored records            */
+  long int num_dropped; /* records not stored as trace is full */
+
+  /* column storage, field f of record i is at f * capacity + i */
+  sunrealtype* real_data;
+  long int* long_data;
+
+  /* values at the start of the current step attempt */
+  sunbooleantype in_step;
+  sunrealtype t, h;
+  int order;
+  long int nni, nli, nje, nsetups;
+};
+
+static const char* sunStepTraceFieldNames[SUN_STEPTRACE_NUM_FIELDS] = {
+  "time",      "step_size", "error",     "order",    "status",
+  "nls_iters", "ls_iters",  "jac_evals", "ls_setups"};
+
+SUNErrCode SUNStepTrace_Create(long int capacity, SUNContext sunctx,
+                               SUNStepTrace* trace_ptr)
+{
+  SUNFunctionBegin(sunctx);
+  SUNCheck(trace_ptr, SUN_ERR_ARG_CORRUPT);
+  SUNCheck(capacity > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  SUNStepTrace trace = (SUNStepTrace)malloc(sizeof(*trace));
+  if (!trace) { return SUN_ERR_MALLOC_FAIL; }
+
+  trace->sunctx      = sunctx;
+  trace->capacity    = capacity;
+  trace->num_records = 0;
+  trace->num_dropped = 0;
+  trace->in_step     = SUNFALSE;
+
+  trace->real_data = (sunrealtype*)malloc(SUN_STEPTRACE_NUM_REAL_FIELDS *
+                                          capacity * sizeof(sunrealtype));
+  trace->long_data = (long int*)malloc(SUN_STEPTRACE_NUM_LONG_FIELDS_ *
+                                       capacity * sizeof(long int));
+  if (!trace->real_data || !trace->long_data)
+  {
+    free(trace->real_data);
+    free(trace->long_data);
+    free(trace);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  *trace_ptr = trace;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepTrace_Destroy(SUNStepTrace* trace_ptr)
+{
+  if (trace_ptr != NULL && *trace_ptr != NULL)
+  {
+    free((*trace_ptr)->real_data);
+    free((*trace_ptr)->long_data);
+    free(*trace_ptr);
+    *trace_ptr = NULL;
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepTrace_BeginStep(SUNStepTrace trace, sunrealtype t,
+                                  sunrealtype h, int order, long int nni,
+                                  long int nli, long int nje, long int nsetups)
+{
+  SUNFunctionBegin(trace->sunctx);
+
+  trace->in_step = SUNTRUE;
+  trace->t       = t;
+  trace->h       = h;
+  trace->order   = order;
+  trace->nni     = nni;
+  trace->nli     = nli;
+  trace->nje     = nje;
+  trace->nsetups = nsetups;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepTrace_EndStep(SUNStepTrace trace, SUNStepTraceStatus status,
+                                sunrealtype dsm, long int nni, long int nli,
+                                long int nje, long int nsetups)
+{
+  SUNFunctionBegin(trace->sunctx);
+  SUNCheck(trace->in_step, SUN_ERR_OP_FAIL);
+
+  trace->in_step = SUNFALSE;
+
+  if (trace->num_records == trace->capacity)
+  {
+    trace->num_dropped++;
+    return SUN_SUCCESS;
+  }
+
+  const long int n = trace->capacity;
+  const long int i = trace->num_records++;
+
+  sunrealtype* rdata = trace->real_data + i;
+  long int* ldata    = trace->long_data + i;
+
+  rdata[SUN_STEPTRACE_TIME * n]     = trace->t;
+  rdata[SUN_STEPTRACE_STEPSIZE * n] = trace->h;
+  rdata[SUN_STEPTRACE_ERROR * n]    = dsm;
+
+  /* long fields are offset by the number of real fields */
+  ldata[0 * n] = trace->order;
+  ldata[1 * n] = status;
+  ldata[2 * n] = nni - trace->nni;
+  ldata[3 * n] = nli - trace->nli;
+  ldata[4 * n] = nje - trace->nje;
+  ldata[5 * n] = nsetups - trace->nsetups;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepTrace_GetNumRecords(SUNStepTrace trace, long int* num_records)
+{
+  SUNFunctionBegin(trace->sunctx);
+  SUNCheck(num_records, SUN_ERR_ARG_CORRUPT);
+  *num_records = trace->num_records;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepTrace_GetNumDropped(SUNStepTrace trace, long int* num_dropped)
+{
+  SUNFunctionBegin(trace->sunctx);
+  SUNCheck(num_dropped, SUN_ERR_ARG_CORRUPT);
+  *num_dropped = trace->num_dropped;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepTrace_GetRealField(SUNStepTrace trace, SUNStepTraceField field,
+                                     sunrealtype** values)
+{
+  SUNFunctionBegin(trace->sunctx);
+  SUNCheck(values, SUN_ERR_ARG_CORRUPT);
+
+  if (field < 0 || field >= SUN_STEPTRACE_NUM_REAL_FIELDS)
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+  *values = trace->real_data + field * trace->capacity;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepTrace_GetLongField(SUNStepTrace trace, SUNStepTraceField field,
+                                     long int** values)
+{
+  SUNFunctionBegin(trace->sunctx);
+  SUNCheck(values, SUN_ERR_ARG_CORRUPT);
+
+  if (field < SUN_STEPTRACE_NUM_REAL_FIELDS || field >= SUN_STEPTRACE_NUM_FIELDS)
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+  *values = trace->long_data +
+            (field - SUN_STEPTRACE_NUM_REAL_FIELDS) * trace->capacity;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepTrace_Write(SUNStepTrace trace, FILE* outfile,
+                              SUNOutputFormat fmt)
+{
+  SUNFunctionBegin(trace->sunctx);
+  SUNCheck(outfile, SUN_ERR_ARG_CORRUPT);
+
+  const long int n = trace->capacity;
+  int f;
+
+  if (fmt != SUN_OUTPUTFORMAT_TABLE && fmt != SUN_OUTPUTFORMAT_CSV)
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+  /* header line */
+  for (f = 0; f < SUN_STEPTRACE_NUM_FIELDS; f++)
+  {
+    if (fmt == SUN_OUTPUTFORMAT_TABLE)
+    {
+      fprintf(outfile, (f < SUN_STEPTRACE_NUM_REAL_FIELDS) ? "%-23s" : "%10s",
+              sunStepTraceFieldNames[f]);
+    }
+    else { fprintf(outfile, (f > 0) ? ",%s" : "%s", sunStepTraceFieldNames[f]); }
+  }
+  fprintf(outfile, "\n");
+
+  /* one line per record */
+  for (long int i = 0; i < trace->num_records; i++)
+  {
+    for (f = 0; f < SUN_STEPTRACE_NUM_REAL_FIELDS; f++)
+    {
+      if (fmt == SUN_OUTPUTFORMAT_TABLE)
+      {
+        fprintf(outfile, SUN_FORMAT_E " ", trace->real_data[f * n + i]);
+      }
+      else
+      {
+        if (f > 0) { fprintf(outfile, ","); }
+        fprintf(outfile, SUN_FORMAT_E, trace->real_data[f * n + i]);
+      }
+    }
+    for (f = 0; f < SUN_STEPTRACE_NUM_LONG_FIELDS_; f++)
+    {
+      fprintf(outfile, (fmt == SUN_OUTPUTFORMAT_TABLE) ? "%10ld" : ",%ld",
+              trace->long_data[f * n + i]);
+    }
+    fprintf(outfile, "\n");
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* The binary file holds a header followed by each field stored as a
+   contiguous array of num_records values in native byte order:
+
+     char     magic[8] = "SUNSTEP"
+     uint32_t version
+     uint32_t sizeof(sunrealtype)
+     uint32_t sizeof(long int)
+     uint32_t number of fields
+     int64_t  number of records */
+SUNErrCode SUNStepTrace_WriteBinary(SUNStepTrace trace, FILE* outfile)
+{
+  SUNFunctionBegin(trace->sunctx);
+  SUNCheck(outfile, SUN_ERR_ARG_CORRUPT);
+
+  const long int n   = trace->capacity;
+  const size_t count = (size_t)trace->num_records;
+  char magic[8]      = "SUNSTEP";
+  uint32_t header[4] = {SUN_STEPTRACE_VERSION_, sizeof(sunrealtype),
+                        sizeof(long int), SUN_STEPTRACE_NUM_FIELDS};
+  int64_t num_records = trace->num_records;
+  size_t written;
+  int f;
+
+  written = fwrite(magic, sizeof(magic), 1, outfile);
+  written += fwrite(header, sizeof(header), 1, outfile);
+  written += fwrite(&num_records, sizeof(num_records), 1, outfile);
+  if (written != 3) { return SUN_ERR_OP_FAIL; }
+
+  for (f = 0; f < SUN_STEPTRACE_NUM_REAL_FIELDS; f++)
+  {
+    written = fwrite(trace->real_data + f * n, sizeof(sunrealtype), count,
+                     outfile);
+    if (written != count) { return SUN_ERR_OP_FAIL; }
+  }
+  for (f = 0; f < SUN_STEPTRACE_NUM_LONG_FIELDS_; f++)
+  {
+    written = fwrite(trace->long_data + f * n, sizeof(long int), count, outfile);
+    if (written != count) { return SUN_ERR_OP_FAIL; }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepTrace_Reset(SUNStepTrace trace)
+{
+  SUNFunctionBegin(trace->sunctx);
+  trace->num_records = 0;
+  trace->num_dropped = 0;
+  trace->in_step     = SUNFALSE;
+  return SUN_SUCCESS;
+}
@@ -294,6 +294,28 @@ SWIGEXPORT int _wrap_FSUNLinSolSolve_Band(SUNLinearSolver farg1, SUNMatrix farg2
 }
 
 
+SWIGEXPORT int _wrap_FSUNLinSolSolveMultiple_Band(SUNLinearSolver farg1, SUNMatrix farg2, int const *farg3, void *farg4, void *farg5, double const *farg6) {
+  int fresult ;
+  SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
+  SUNMatrix arg2 = (SUNMatrix) 0 ;
+  int arg3 ;
+  N_Vector *arg4 = (N_Vector *) 0 ;
+  N_Vector *arg5 = (N_Vector *) 0 ;
+  sunrealtype arg6 ;
+  int result;
+  
+  arg1 = (SUNLinearSolver)(farg1);
+  arg2 = (SUNMatrix)(farg2);
+  arg3 = (int)(*farg3);
+  arg4 = (N_Vector *)(farg4);
+  arg5 = (N_Vector *)(farg5);
+  arg6 = (sunrealtype)(*farg6);
+  result = (int)SUNLinSolSolveMultiple_Band(arg1,arg2,arg3,arg4,arg5,arg6);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int32_t _wrap_FSUNLinSolLastFlag_Band(SUNLinearSolver farg1) {
   int32_t fresult ;
   SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
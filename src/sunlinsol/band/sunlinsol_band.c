@@ -18,6 +18,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/sundials_errors.h>
 #include <sundials/sundials_math.h>
@@ -27,6 +28,9 @@
 
 #define ONE SUN_RCONST(1.0)
 
+/* Number of right-hand sides processed together in SolveMultiple */
+#define RHS_BLOCK 8
+
 /*
  * -----------------------------------------------------------------
  * Band solver structure accessibility macros:
@@ -74,18 +78,20 @@ SUNLinearSolver SUNLinSol_Band(SUNDIALS_MAYBE_UNUSED N_Vector y, SUNMatrix A,
   SUNCheckLastErrNull();
 
   /* Attach operations */
-  S->ops->gettype    = SUNLinSolGetType_Band;
-  S->ops->getid      = SUNLinSolGetID_Band;
-  S->ops->initialize = SUNLinSolInitialize_Band;
-  S->ops->setup      = SUNLinSolSetup_Band;
-  S->ops->solve      = SUNLinSolSolve_Band;
-  S->ops->lastflag   = SUNLinSolLastFlag_Band;
-  S->ops->space      = SUNLinSolSpace_Band;
-  S->ops->free       = SUNLinSolFree_Band;
+  S->ops->gettype       = SUNLinSolGetType_Band;
+  S->ops->getid         = SUNLinSolGetID_Band;
+  S->ops->initialize    = SUNLinSolInitialize_Band;
+  S->ops->setup         = SUNLinSolSetup_Band;
+  S->ops->solve         = SUNLinSolSolve_Band;
+  S->ops->solvemultiple = SUNLinSolSolveMultiple_Band;
+  S->ops->lastflag      = SUNLinSolLastFlag_Band;
+  S->ops->space         = SUNLinSolSpace_Band;
+  S->ops->free          = SUNLinSolFree_Band;
 
   /* Create content */
   content = NULL;
-  content = (SUNLinearSolverContent_Band)malloc(sizeof *content);
+  content = (SUNLinearSolverContent_Band)
+    SUNContext_ArenaAlloc(S->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Attach content */
@@ -186,6 +192,48 @@ int SUNLinSolSolve_Band(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
   return SUN_SUCCESS;
 }
 
+int SUNLinSolSolveMultiple_Band(SUNLinearSolver S, SUNMatrix A, int nrhs,
+                                N_Vector* X, N_Vector* B,
+                                SUNDIALS_MAYBE_UNUSED sunrealtype tol)
+{
+  SUNFunctionBegin(S->sunctx);
+  sunrealtype **A_cols, *xdata[RHS_BLOCK];
+  sunindextype* pivots;
+  int j, j0, nb;
+
+  /* access data pointers (return with failure on NULL) */
+  A_cols = NULL;
+  pivots = NULL;
+  A_cols = SUNBandMatrix_Cols(A);
+  SUNCheckLastErr();
+  pivots = PIVOTS(S);
+  SUNAssert(pivots, SUN_ERR_ARG_CORRUPT);
+
+  /* solve in blocks of right-hand sides so the factors are read once per
+     block rather than once per right-hand side */
+  for (j0 = 0; j0 < nrhs; j0 += RHS_BLOCK)
+  {
+    nb = SUNMIN(RHS_BLOCK, nrhs - j0);
+    for (j = 0; j < nb; j++)
+    {
+      /* copy b_j into x_j */
+      if (X[j0 + j] != B[j0 + j])
+      {
+        N_VScale(ONE, B[j0 + j], X[j0 + j]);
+        SUNCheckLastErr();
+      }
+      xdata[j] = N_VGetArrayPointer(X[j0 + j]);
+      SUNCheckLastErr();
+      SUNAssert(xdata[j], SUN_ERR_ARG_CORRUPT);
+    }
+    SUNDlsMat_bandGBTRSMultiple(A_cols, SM_COLUMNS_B(A), SM_SUBAND_B(A),
+                                SM_LBAND_B(A), pivots, nb, xdata);
+  }
+
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
 sunindextype SUNLinSolLastFlag_Band(SUNLinearSolver S)
 {
   /* return the stored 'last_flag' value */
@@ -215,15 +263,15 @@ SUNErrCode SUNLinSolFree_Band(SUNLinearSolver S)
       free(PIVOTS(S));
       PIVOTS(S) = NULL;
     }
-    free(S->content);
+    SUNContext_ArenaFree(S->sunctx, S->content);
     S->content = NULL;
   }
   if (S->ops)
   {
-    free(S->ops);
+    SUNContext_ArenaFree(S->sunctx, S->ops);
     S->ops = NULL;
   }
-  free(S);
+  SUNContext_ArenaFree(S->sunctx, S);
   S = NULL;
   return SUN_SUCCESS;
 }
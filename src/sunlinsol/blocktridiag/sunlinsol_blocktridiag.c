@@ -0,0 +1,314 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the block-tridiagonal
+ * implementation of the SUNLINSOL package.
+ *
+ * The matrix is factored with the block Thomas algorithm. For each
+ * block row i the diagonal block is updated with the previous block
+ * row, D_i <- D_i - L_i U_{i-1}, and factored with partial pivoting.
+ * The super-diagonal block is then overwritten with D_i^{-1} U_i so
+ * that the solve only requires block matrix-vector products and
+ * dense triangular solves with the diagonal blocks.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_context_impl.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sunlinsol/sunlinsol_blocktridiag.h>
+
+#include "sundials_macros.h"
+
+#define ONE SUN_RCONST(1.0)
+
+/*
+ * -----------------------------------------------------------------
+ * Block-tridiagonal solver structure accessibility macros:
+ * -----------------------------------------------------------------
+ */
+
+#define BT_CONTENT(S) ((SUNLinearSolverContent_BlockTridiag)(S->content))
+#define PIVOTS(S)     (BT_CONTENT(S)->pivots)
+#define COLS(S)       (BT_CONTENT(S)->cols)
+#define RHS(S)        (BT_CONTENT(S)->rhs)
+#define LASTFLAG(S)   (BT_CONTENT(S)->last_flag)
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new block-tridiagonal linear solver
+ */
+
+SUNLinearSolver SUNLinSol_BlockTridiag(N_Vector y, SUNMatrix A,
+                                       SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  SUNLinearSolver S;
+  SUNLinearSolverContent_BlockTridiag content;
+  sunindextype bs;
+
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG,
+                SUN_ERR_ARG_WRONGTYPE);
+  SUNAssertNull(y->ops->nvgetarraypointer, SUN_ERR_ARG_INCOMPATIBLE);
+  SUNAssertNull(SUNBlockTridiagMatrix_Rows(A) == N_VGetLength(y),
+                SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Create an empty linear solver */
+  S = NULL;
+  S = SUNLinSolNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  S->ops->gettype    = SUNLinSolGetType_BlockTridiag;
+  S->ops->getid      = SUNLinSolGetID_BlockTridiag;
+  S->ops->initialize = SUNLinSolInitialize_BlockTridiag;
+  S->ops->setup      = SUNLinSolSetup_BlockTridiag;
+  S->ops->solve      = SUNLinSolSolve_BlockTridiag;
+  S->ops->lastflag   = SUNLinSolLastFlag_BlockTridiag;
+  S->ops->free       = SUNLinSolFree_BlockTridiag;
+
+  /* Create content */
+  content = NULL;
+  content = (SUNLinearSolverContent_BlockTridiag)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  S->content = content;
+
+  /* Fill content */
+  bs                 = SUNBlockTridiagMatrix_BlockSize(A);
+  content->N         = SUNBlockTridiagMatrix_Rows(A);
+  content->nblocks   = SUNBlockTridiagMatrix_NumBlocks(A);
+  content->blocksize = bs;
+  content->last_flag = 0;
+  content->pivots    = NULL;
+  content->cols      = NULL;
+  content->rhs       = NULL;
+
+  /* Allocate content */
+  content->pivots = (sunindextype*)malloc(content->N * sizeof(sunindextype));
+  SUNAssertNull(content->pivots, SUN_ERR_MALLOC_FAIL);
+
+  content->cols = (sunrealtype**)malloc(bs * sizeof(sunrealtype*));
+  SUNAssertNull(content->cols, SUN_ERR_MALLOC_FAIL);
+
+  content->rhs = (sunrealtype**)malloc(bs * sizeof(sunrealtype*));
+  SUNAssertNull(content->rhs, SUN_ERR_MALLOC_FAIL);
+
+  return (S);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of linear solver operations
+ * -----------------------------------------------------------------
+ */
+
+SUNLinearSolver_Type SUNLinSolGetType_BlockTridiag(
+  SUNDIALS_MAYBE_UNUSED SUNLinearSolver S)
+{
+  return (SUNLINEARSOLVER_DIRECT);
+}
+
+SUNLinearSolver_ID SUNLinSolGetID_BlockTridiag(
+  SUNDIALS_MAYBE_UNUSED SUNLinearSolver S)
+{
+  return (SUNLINEARSOLVER_BLOCKTRIDIAG);
+}
+
+SUNErrCode SUNLinSolInitialize_BlockTridiag(SUNLinearSolver S)
+{
+  /* all solver-specific memory has already been allocated */
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolSetup_BlockTridiag(SUNLinearSolver S, SUNMatrix A)
+{
+  SUNFunctionBegin(S->sunctx);
+  sunindextype i, j, k, l, bs, nb, ier;
+  sunrealtype *L, *D, *Dj, *U, *Uprev, **cols, **rhs, u;
+  sunindextype* pivots;
+
+  SUNAssert(A, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SM_NBLOCKS_BT(A) == BT_CONTENT(S)->nblocks &&
+              SM_BLOCKSIZE_BT(A) == BT_CONTENT(S)->blocksize,
+            SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access data pointers (return with failure on NULL) */
+  pivots = PIVOTS(S);
+  cols   = COLS(S);
+  rhs    = RHS(S);
+  SUNAssert(pivots, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(cols, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(rhs, SUN_ERR_ARG_CORRUPT);
+
+  bs = SM_BLOCKSIZE_BT(A);
+  nb = SM_NBLOCKS_BT(A);
+
+  for (k = 0; k < nb; k++)
+  {
+    D = SM_BLOCK_BT(A, k, k);
+
+    /* D_k <- D_k - L_k (D_{k-1}^{-1} U_{k-1}) */
+    if (k > 0)
+    {
+      L     = SM_BLOCK_BT(A, k, k - 1);
+      Uprev = SM_BLOCK_BT(A, k - 1, k);
+      for (j = 0; j < bs; j++)
+      {
+        Dj = D + j * bs;
+        for (l = 0; l < bs; l++)
+        {
+          u = SM_BLOCK_ELEMENT_BT(Uprev, l, j, bs);
+          for (i = 0; i < bs; i++) { Dj[i] -= L[l * bs + i] * u; }
+        }
+      }
+    }
+
+    /* perform LU factorization of the diagonal block */
+    for (j = 0; j < bs; j++) { cols[j] = D + j * bs; }
+    ier = SUNDlsMat_denseGETRF(cols, bs, bs, pivots + k * bs);
+
+    /* store error flag (if nonzero, that row encountered zero-valued pivot) */
+    if (ier > 0)
+    {
+      LASTFLAG(S) = k * bs + ier;
+      return (SUNLS_LUFACT_FAIL);
+    }
+
+    /* U_k <- D_k^{-1} U_k */
+    if (k < nb - 1)
+    {
+      U = SM_BLOCK_BT(A, k, k + 1);
+      for (j = 0; j < bs; j++) { rhs[j] = U + j * bs; }
+      SUNDlsMat_denseGETRSMultiple(cols, bs, pivots + k * bs, (int)bs, rhs);
+    }
+  }
+
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolSolve_BlockTridiag(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                                N_Vector b,
+                                SUNDIALS_MAYBE_UNUSED sunrealtype tol)
+{
+  SUNFunctionBegin(S->sunctx);
+  sunindextype i, j, k, bs, nb;
+  sunrealtype *L, *D, *U, *xdata, *xk, **cols;
+  sunindextype* pivots;
+
+  /* copy b into x */
+  N_VScale(ONE, b, x);
+  SUNCheckLastErr();
+
+  /* access data pointers (return with failure on NULL) */
+  xdata = NULL;
+  xdata = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  pivots = PIVOTS(S);
+  cols   = COLS(S);
+  SUNAssert(xdata, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(pivots, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(cols, SUN_ERR_ARG_CORRUPT);
+
+  bs = SM_BLOCKSIZE_BT(A);
+  nb = SM_NBLOCKS_BT(A);
+
+  /* forward sweep: x_k <- D_k^{-1} (x_k - L_k x_{k-1}) */
+  for (k = 0; k < nb; k++)
+  {
+    xk = xdata + k * bs;
+    if (k > 0)
+    {
+      L = SM_BLOCK_BT(A, k, k - 1);
+      for (j = 0; j < bs; j++)
+      {
+        for (i = 0; i < bs; i++)
+        {
+          xk[i] -= SM_BLOCK_ELEMENT_BT(L, i, j, bs) * xk[j - bs];
+        }
+      }
+    }
+    D = SM_BLOCK_BT(A, k, k);
+    for (j = 0; j < bs; j++) { cols[j] = D + j * bs; }
+    SUNDlsMat_denseGETRS(cols, bs, pivots + k * bs, xk);
+  }
+
+  /* backward sweep: x_k <- x_k - (D_k^{-1} U_k) x_{k+1} */
+  for (k = nb - 2; k >= 0; k--)
+  {
+    xk = xdata + k * bs;
+    U  = SM_BLOCK_BT(A, k, k + 1);
+    for (j = 0; j < bs; j++)
+    {
+      for (i = 0; i < bs; i++)
+      {
+        xk[i] -= SM_BLOCK_ELEMENT_BT(U, i, j, bs) * xk[j + bs];
+      }
+    }
+  }
+
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+sunindextype SUNLinSolLastFlag_BlockTridiag(SUNLinearSolver S)
+{
+  /* return the stored 'last_flag' value */
+  return LASTFLAG(S);
+}
+
+SUNErrCode SUNLinSolFree_BlockTridiag(SUNLinearSolver S)
+{
+  /* return if S is already free */
+  if (S == NULL) { return SUN_SUCCESS; }
+
+  /* delete items from contents, then delete generic structure */
+  if (S->content)
+  {
+    if (PIVOTS(S))
+    {
+      free(PIVOTS(S));
+      PIVOTS(S) = NULL;
+    }
+    if (COLS(S))
+    {
+      free(COLS(S));
+      COLS(S) = NULL;
+    }
+    if (RHS(S))
+    {
+      free(RHS(S));
+      RHS(S) = NULL;
+    }
+    free(S->content);
+    S->content = NULL;
+  }
+  if (S->ops)
+  {
+    SUNContext_ArenaFree(S->sunctx, S->ops);
+    S->ops = NULL;
+  }
+  SUNContext_ArenaFree(S->sunctx, S);
+  S = NULL;
+  return SUN_SUCCESS;
+}
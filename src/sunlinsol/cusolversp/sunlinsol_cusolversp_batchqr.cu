@@ -20,6 +20,7 @@
 #include <stdlib.h>
 #include <sunlinsol/sunlinsol_cusolversp_batchqr.h>
 #include <sunmatrix/sunmatrix_cusparse.h>
+#include <sundials/priv/sundials_context_impl.h>
 
 #include "sundials_cuda.h"
 #include "sundials_cusolver.h"
@@ -330,12 +331,12 @@ SUNErrCode SUNLinSolFree_cuSolverSp_batchQR(SUNLinearSolver S)
   /* free ops structure */
   if (S->ops)
   {
-    free(S->ops);
+    SUNContext_ArenaFree(S->sunctx, S->ops);
     S->ops = NULL;
   }
 
   /* free the actual SUNLinSol */
-  free(S);
+  SUNContext_ArenaFree(S->sunctx, S);
   S = NULL;
 
   return SUN_SUCCESS;
@@ -56,6 +56,7 @@ module fsunlinsol_klu_mod
  public :: FSUNLinSolInitialize_KLU
  public :: FSUNLinSolSetup_KLU
  public :: FSUNLinSolSolve_KLU
+ public :: FSUNLinSolSolveMultiple_KLU
  public :: FSUNLinSolLastFlag_KLU
  public :: FSUNLinSolSpace_KLU
  public :: FSUNLinSolFree_KLU
@@ -164,6 +165,19 @@ real(C_DOUBLE), intent(in) :: farg5
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNLinSolSolveMultiple_KLU(farg1, farg2, farg3, farg4, farg5, farg6) &
+bind(C, name="_wrap_FSUNLinSolSolveMultiple_KLU") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+type(C_PTR), value :: farg4
+type(C_PTR), value :: farg5
+real(C_DOUBLE), intent(in) :: farg6
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNLinSolLastFlag_KLU(farg1) &
 bind(C, name="_wrap_FSUNLinSolLastFlag_KLU") &
 result(fresult)
@@ -371,6 +385,34 @@ fresult = swigc_FSUNLinSolSolve_KLU(farg1, farg2, farg3, farg4, farg5)
 swig_result = fresult
 end function
 
+function FSUNLinSolSolveMultiple_KLU(s, a, nrhs, x, b, tol) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(SUNLinearSolver), target, intent(inout) :: s
+type(SUNMatrix), target, intent(inout) :: a
+integer(C_INT), intent(in) :: nrhs
+type(C_PTR) :: x
+type(C_PTR) :: b
+real(C_DOUBLE), intent(in) :: tol
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+integer(C_INT) :: farg3 
+type(C_PTR) :: farg4 
+type(C_PTR) :: farg5 
+real(C_DOUBLE) :: farg6 
+
+farg1 = c_loc(s)
+farg2 = c_loc(a)
+farg3 = nrhs
+farg4 = x
+farg5 = b
+farg6 = tol
+fresult = swigc_FSUNLinSolSolveMultiple_KLU(farg1, farg2, farg3, farg4, farg5, farg6)
+swig_result = fresult
+end function
+
 function FSUNLinSolLastFlag_KLU(s) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
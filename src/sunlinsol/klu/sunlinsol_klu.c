@@ -20,6 +20,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/sundials_errors.h>
 #include <sundials/sundials_math.h>
 #include <sunlinsol/sunlinsol_klu.h>
@@ -42,6 +43,8 @@
 #define NUMERIC(S)        (KLU_CONTENT(S)->numeric)
 #define COMMON(S)         (KLU_CONTENT(S)->common)
 #define SOLVE(S)          (KLU_CONTENT(S)->klu_solver)
+#define RHS(S)            (KLU_CONTENT(S)->rhs)
+#define RHSLENGTH(S)      (KLU_CONTENT(S)->rhs_length)
 
 /*
  * -----------------------------------------------------------------
@@ -79,14 +82,15 @@ SUNLinearSolver SUNLinSol_KLU(N_Vector y, SUNMatrix A, SUNContext sunctx)
   if (S == NULL) { return (NULL); }
 
   /* Attach operations */
-  S->ops->gettype    = SUNLinSolGetType_KLU;
-  S->ops->getid      = SUNLinSolGetID_KLU;
-  S->ops->initialize = SUNLinSolInitialize_KLU;
-  S->ops->setup      = SUNLinSolSetup_KLU;
-  S->ops->solve      = SUNLinSolSolve_KLU;
-  S->ops->lastflag   = SUNLinSolLastFlag_KLU;
-  S->ops->space      = SUNLinSolSpace_KLU;
-  S->ops->free       = SUNLinSolFree_KLU;
+  S->ops->gettype       = SUNLinSolGetType_KLU;
+  S->ops->getid         = SUNLinSolGetID_KLU;
+  S->ops->initialize    = SUNLinSolInitialize_KLU;
+  S->ops->setup         = SUNLinSolSetup_KLU;
+  S->ops->solve         = SUNLinSolSolve_KLU;
+  S->ops->solvemultiple = SUNLinSolSolveMultiple_KLU;
+  S->ops->lastflag      = SUNLinSolLastFlag_KLU;
+  S->ops->space         = SUNLinSolSpace_KLU;
+  S->ops->free          = SUNLinSolFree_KLU;
 
   /* Create content */
   content = NULL;
@@ -105,6 +109,8 @@ SUNLinearSolver SUNLinSol_KLU(N_Vector y, SUNMatrix A, SUNContext sunctx)
   content->first_factorize = 1;
   content->symbolic        = NULL;
   content->numeric         = NULL;
+  content->rhs             = NULL;
+  content->rhs_length      = 0;
 
 #if defined(SUNDIALS_INT64_T)
   if (SUNSparseMatrix_SparseType(A) == CSC_MAT)
@@ -254,6 +260,12 @@ int SUNLinSolSetup_KLU(SUNLinearSolver S, SUNMatrix A)
   {
     /* Perform symbolic analysis of sparsity structure */
     if (SYMBOLIC(S)) { sun_klu_free_symbolic(&SYMBOLIC(S), &COMMON(S)); }
+    if (RHS(S))
+    {
+      free(RHS(S));
+      RHS(S)       = NULL;
+      RHSLENGTH(S) = 0;
+    }
     SYMBOLIC(S) = sun_klu_analyze(SUNSparseMatrix_NP(A),
                                   SUNSparseMatrix_IndexPointers(A),
                                   SUNSparseMatrix_IndexValues(A), &COMMON(S));
@@ -375,6 +387,72 @@ int SUNLinSolSolve_KLU(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
   return (LASTFLAG(S));
 }
 
+int SUNLinSolSolveMultiple_KLU(SUNLinearSolver S, SUNMatrix A, int nrhs,
+                               N_Vector* X, N_Vector* B,
+                               SUNDIALS_MAYBE_UNUSED sunrealtype tol)
+{
+  int flag, j;
+  sunindextype i, n;
+  sunrealtype *data, *rhs;
+
+  /* check for valid inputs */
+  if ((A == NULL) || (S == NULL) || (X == NULL) || (B == NULL))
+  {
+    return SUN_ERR_ARG_CORRUPT;
+  }
+
+  /* grow the workspace holding the right-hand sides if necessary */
+  n = SUNSparseMatrix_NP(A);
+  if (RHSLENGTH(S) < n * nrhs)
+  {
+    free(RHS(S));
+    RHSLENGTH(S) = 0;
+    RHS(S)       = (sunrealtype*)malloc(n * nrhs * sizeof(sunrealtype));
+    if (RHS(S) == NULL)
+    {
+      LASTFLAG(S) = SUN_ERR_MEM_FAIL;
+      return (LASTFLAG(S));
+    }
+    RHSLENGTH(S) = n * nrhs;
+  }
+  rhs = RHS(S);
+
+  /* gather the right-hand sides into an n by nrhs column-major array */
+  for (j = 0; j < nrhs; j++)
+  {
+    data = N_VGetArrayPointer(B[j]);
+    if (data == NULL)
+    {
+      LASTFLAG(S) = SUN_ERR_MEM_FAIL;
+      return (LASTFLAG(S));
+    }
+    for (i = 0; i < n; i++) { rhs[j * n + i] = data[i]; }
+  }
+
+  /* Call KLU to solve all the linear systems at once */
+  flag = SOLVE(S)(SYMBOLIC(S), NUMERIC(S), n, nrhs, rhs, &COMMON(S));
+  if (flag == 0)
+  {
+    LASTFLAG(S) = SUNLS_PACKAGE_FAIL_REC;
+    return (LASTFLAG(S));
+  }
+
+  /* scatter the solutions */
+  for (j = 0; j < nrhs; j++)
+  {
+    data = N_VGetArrayPointer(X[j]);
+    if (data == NULL)
+    {
+      LASTFLAG(S) = SUN_ERR_MEM_FAIL;
+      return (LASTFLAG(S));
+    }
+    for (i = 0; i < n; i++) { data[i] = rhs[j * n + i]; }
+  }
+
+  LASTFLAG(S) = SUN_SUCCESS;
+  return (LASTFLAG(S));
+}
+
 sunindextype SUNLinSolLastFlag_KLU(SUNLinearSolver S) { return (LASTFLAG(S)); }
 
 SUNErrCode SUNLinSolSpace_KLU(SUNDIALS_MAYBE_UNUSED SUNLinearSolver S,
@@ -397,6 +475,11 @@ SUNErrCode SUNLinSolFree_KLU(SUNLinearSolver S)
   {
     if (NUMERIC(S)) { sun_klu_free_numeric(&NUMERIC(S), &COMMON(S)); }
     if (SYMBOLIC(S)) { sun_klu_free_symbolic(&SYMBOLIC(S), &COMMON(S)); }
+    if (RHS(S))
+    {
+      free(RHS(S));
+      RHS(S) = NULL;
+    }
     free(S->content);
     S->content = NULL;
   }
@@ -404,10 +487,10 @@ SUNErrCode SUNLinSolFree_KLU(SUNLinearSolver S)
   /* delete generic structures */
   if (S->ops)
   {
-    free(S->ops);
+    SUNContext_ArenaFree(S->sunctx, S->ops);
     S->ops = NULL;
   }
-  free(S);
+  SUNContext_ArenaFree(S->sunctx, S);
   S = NULL;
   return SUN_SUCCESS;
 }
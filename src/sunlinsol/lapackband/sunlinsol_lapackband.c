@@ -19,6 +19,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/sundials_math.h>
 #include <sunlinsol/sunlinsol_lapackband.h>
 
@@ -244,10 +245,10 @@ SUNErrCode SUNLinSolFree_LapackBand(SUNLinearSolver S)
   }
   if (S->ops)
   {
-    free(S->ops);
+    SUNContext_ArenaFree(S->sunctx, S->ops);
     S->ops = NULL;
   }
-  free(S);
+  SUNContext_ArenaFree(S->sunctx, S);
   S = NULL;
   return SUN_SUCCESS;
 }
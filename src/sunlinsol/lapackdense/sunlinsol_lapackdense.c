@@ -19,6 +19,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/sundials_math.h>
 #include <sunlinsol/sunlinsol_lapackdense.h>
 
@@ -46,8 +47,10 @@
 
 #define LAPACKDENSE_CONTENT(S) \
   ((SUNLinearSolverContent_LapackDense)(S->content))
-#define PIVOTS(S)   (LAPACKDENSE_CONTENT(S)->pivots)
-#define LASTFLAG(S) (LAPACKDENSE_CONTENT(S)->last_flag)
+#define PIVOTS(S)    (LAPACKDENSE_CONTENT(S)->pivots)
+#define LASTFLAG(S)  (LAPACKDENSE_CONTENT(S)->last_flag)
+#define RHS(S)       (LAPACKDENSE_CONTENT(S)->rhs)
+#define RHSLENGTH(S) (LAPACKDENSE_CONTENT(S)->rhs_length)
 
 /*
  * -----------------------------------------------------------------
@@ -86,14 +89,15 @@ SUNLinearSolver SUNLinSol_LapackDense(N_Vector y, SUNMatrix A, SUNContext sunctx
   if (S == NULL) { return (NULL); }
 
   /* Attach operations */
-  S->ops->gettype    = SUNLinSolGetType_LapackDense;
-  S->ops->getid      = SUNLinSolGetID_LapackDense;
-  S->ops->initialize = SUNLinSolInitialize_LapackDense;
-  S->ops->setup      = SUNLinSolSetup_LapackDense;
-  S->ops->solve      = SUNLinSolSolve_LapackDense;
-  S->ops->lastflag   = SUNLinSolLastFlag_LapackDense;
-  S->ops->space      = SUNLinSolSpace_LapackDense;
-  S->ops->free       = SUNLinSolFree_LapackDense;
+  S->ops->gettype       = SUNLinSolGetType_LapackDense;
+  S->ops->getid         = SUNLinSolGetID_LapackDense;
+  S->ops->initialize    = SUNLinSolInitialize_LapackDense;
+  S->ops->setup         = SUNLinSolSetup_LapackDense;
+  S->ops->solve         = SUNLinSolSolve_LapackDense;
+  S->ops->solvemultiple = SUNLinSolSolveMultiple_LapackDense;
+  S->ops->lastflag      = SUNLinSolLastFlag_LapackDense;
+  S->ops->space         = SUNLinSolSpace_LapackDense;
+  S->ops->free          = SUNLinSolFree_LapackDense;
 
   /* Create content */
   content = NULL;
@@ -108,9 +112,11 @@ SUNLinearSolver SUNLinSol_LapackDense(N_Vector y, SUNMatrix A, SUNContext sunctx
   S->content = content;
 
   /* Fill content */
-  content->N         = MatrixRows;
-  content->last_flag = 0;
-  content->pivots    = NULL;
+  content->N          = MatrixRows;
+  content->last_flag  = 0;
+  content->pivots     = NULL;
+  content->rhs        = NULL;
+  content->rhs_length = 0;
 
   /* Allocate content */
   content->pivots = (sunindextype*)malloc(MatrixRows * sizeof(sunindextype));
@@ -206,6 +212,71 @@ int SUNLinSolSolve_LapackDense(SUNLinearSolver S, SUNMatrix A, N_Vector x,
   return SUN_SUCCESS;
 }
 
+int SUNLinSolSolveMultiple_LapackDense(SUNLinearSolver S, SUNMatrix A,
+                                       int nrhs, N_Vector* X, N_Vector* B,
+                                       SUNDIALS_MAYBE_UNUSED sunrealtype tol)
+{
+  sunindextype i, n, nb, ier;
+  sunrealtype *data, *rhs;
+  int j;
+
+  if ((A == NULL) || (S == NULL) || (X == NULL) || (B == NULL))
+  {
+    return SUN_ERR_ARG_CORRUPT;
+  }
+
+  /* grow the workspace holding the right-hand sides if necessary */
+  n  = SUNDenseMatrix_Rows(A);
+  nb = nrhs;
+  if (RHSLENGTH(S) < n * nb)
+  {
+    free(RHS(S));
+    RHSLENGTH(S) = 0;
+    RHS(S)       = (sunrealtype*)malloc(n * nb * sizeof(sunrealtype));
+    if (RHS(S) == NULL)
+    {
+      LASTFLAG(S) = SUN_ERR_MEM_FAIL;
+      return SUN_ERR_MEM_FAIL;
+    }
+    RHSLENGTH(S) = n * nb;
+  }
+  rhs = RHS(S);
+
+  /* gather the right-hand sides into an n by nrhs column-major array */
+  for (j = 0; j < nrhs; j++)
+  {
+    data = N_VGetArrayPointer(B[j]);
+    if (data == NULL)
+    {
+      LASTFLAG(S) = SUN_ERR_MEM_FAIL;
+      return SUN_ERR_MEM_FAIL;
+    }
+    for (i = 0; i < n; i++) { rhs[j * n + i] = data[i]; }
+  }
+
+  /* Call LAPACK to solve all the linear systems at once */
+  ier = 0;
+  xgetrs_f77("N", &n, &nb, SUNDenseMatrix_Data(A), &n, PIVOTS(S), rhs, &n,
+             &ier);
+  LASTFLAG(S) = ier;
+  if (ier < 0) { return SUN_ERR_EXT_FAIL; }
+
+  /* scatter the solutions */
+  for (j = 0; j < nrhs; j++)
+  {
+    data = N_VGetArrayPointer(X[j]);
+    if (data == NULL)
+    {
+      LASTFLAG(S) = SUN_ERR_MEM_FAIL;
+      return SUN_ERR_MEM_FAIL;
+    }
+    for (i = 0; i < n; i++) { data[i] = rhs[j * n + i]; }
+  }
+
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
 sunindextype SUNLinSolLastFlag_LapackDense(SUNLinearSolver S)
 {
   return (LASTFLAG(S));
@@ -214,7 +285,7 @@ sunindextype SUNLinSolLastFlag_LapackDense(SUNLinearSolver S)
 SUNErrCode SUNLinSolSpace_LapackDense(SUNLinearSolver S, long int* lenrwLS,
                                       long int* leniwLS)
 {
-  *lenrwLS = 0;
+  *lenrwLS = (long int)RHSLENGTH(S);
   *leniwLS = 2 + LAPACKDENSE_CONTENT(S)->N;
   return SUN_SUCCESS;
 }
@@ -232,15 +303,20 @@ SUNErrCode SUNLinSolFree_LapackDense(SUNLinearSolver S)
       free(PIVOTS(S));
       PIVOTS(S) = NULL;
     }
+    if (RHS(S))
+    {
+      free(RHS(S));
+      RHS(S) = NULL;
+    }
     free(S->content);
     S->content = NULL;
   }
   if (S->ops)
   {
-    free(S->ops);
+    SUNContext_ArenaFree(S->sunctx, S->ops);
     S->ops = NULL;
   }
-  free(S);
+  SUNContext_ArenaFree(S->sunctx, S);
   S = NULL;
   return SUN_SUCCESS;
 }
@@ -14,6 +14,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/sundials_math.h>
 #include <sunlinsol/sunlinsol_magmadense.h>
 #include <sunmatrix/sunmatrix_magmadense.h>
@@ -416,10 +417,10 @@ SUNErrCode SUNLinSolFree_MagmaDense(SUNLinearSolver S)
   }
   if (S->ops)
   {
-    free(S->ops);
+    SUNContext_ArenaFree(S->sunctx, S->ops);
     S->ops = NULL;
   }
-  free(S);
+  SUNContext_ArenaFree(S->sunctx, S);
   S = NULL;
   return SUN_SUCCESS;
 }
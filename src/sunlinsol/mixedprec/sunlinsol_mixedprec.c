@@ -0,0 +1,671 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the mixed-precision dense/band
+ * implementation of the SUNLINSOL package.
+ *
+ * The setup copies the matrix into single precision and factors it
+ * there, halving the memory traffic of the factorization. The solve
+ * applies the single precision factors and then performs iterative
+ * refinement,
+ *
+ *   r = b - A x,  A_lo d = r,  x = x + d,
+ *
+ * with the residual computed in sunrealtype precision until the
+ * correction is at the level of the sunrealtype unit roundoff.
+ * -----------------------------------------------------------------*/
+
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_context_impl.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sunlinsol/sunlinsol_mixedprec.h>
+
+#include "sundials_macros.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define HALF SUN_RCONST(0.5)
+#define ONE  SUN_RCONST(1.0)
+
+/*
+ * -----------------------------------------------------------------
+ * Mixed-precision solver structure accessibility macros:
+ * -----------------------------------------------------------------
+ */
+
+#define MP_CONTENT(S) ((SUNLinearSolverContent_MixedPrec)(S->content))
+#define PIVOTS(S)     (MP_CONTENT(S)->pivots)
+#define LASTFLAG(S)   (MP_CONTENT(S)->last_flag)
+#define NUMITERS(S)   (MP_CONTENT(S)->num_iters)
+
+/*
+ * -----------------------------------------------------------------
+ * private single precision factorization and solve kernels
+ * -----------------------------------------------------------------
+ */
+
+static sunindextype denseGETRF_lo(float** a, sunindextype n, sunindextype* p);
+static void denseGETRS_lo(float** a, sunindextype n, sunindextype* p, float* b);
+static sunindextype bandGBTRF_lo(float** a, sunindextype n, sunindextype mu,
+                                 sunindextype ml, sunindextype smu,
+                                 sunindextype* p);
+static void bandGBTRS_lo(float** a, sunindextype n, sunindextype smu,
+                         sunindextype ml, sunindextype* p, float* b);
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new mixed-precision linear solver
+ */
+
+SUNLinearSolver SUNLinSol_MixedPrec(N_Vector y, SUNMatrix A, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  SUNLinearSolver S;
+  SUNLinearSolverContent_MixedPrec content;
+  SUNMatrix_ID matid;
+  sunindextype MatrixRows, j;
+
+  matid = SUNMatGetID(A);
+  SUNAssertNull(matid == SUNMATRIX_DENSE || matid == SUNMATRIX_BAND,
+                SUN_ERR_ARG_WRONGTYPE);
+  SUNAssertNull(y->ops->nvgetarraypointer, SUN_ERR_ARG_INCOMPATIBLE);
+
+  if (matid == SUNMATRIX_DENSE)
+  {
+    SUNAssertNull(SUNDenseMatrix_Rows(A) == SUNDenseMatrix_Columns(A),
+                  SUN_ERR_ARG_DIMSMISMATCH);
+    MatrixRows = SUNDenseMatrix_Rows(A);
+  }
+  else
+  {
+    SUNAssertNull(SUNBandMatrix_Rows(A) == SUNBandMatrix_Columns(A),
+                  SUN_ERR_ARG_DIMSMISMATCH);
+    MatrixRows = SUNBandMatrix_Rows(A);
+
+    /* Check that A has appropriate storage upper bandwidth for factorization */
+    SUNAssertNull(SUNBandMatrix_StoredUpperBandwidth(A) >=
+                    SUNMIN(MatrixRows - 1, SUNBandMatrix_LowerBandwidth(A) +
+                                             SUNBandMatrix_UpperBandwidth(A)),
+                  SUN_ERR_ARG_INCOMPATIBLE);
+  }
+  SUNAssertNull(MatrixRows == N_VGetLength(y), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Create an empty linear solver */
+  S = NULL;
+  S = SUNLinSolNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  S->ops->gettype    = SUNLinSolGetType_MixedPrec;
+  S->ops->getid      = SUNLinSolGetID_MixedPrec;
+  S->ops->initialize = SUNLinSolInitialize_MixedPrec;
+  S->ops->setup      = SUNLinSolSetup_MixedPrec;
+  S->ops->solve      = SUNLinSolSolve_MixedPrec;
+  S->ops->numiters   = SUNLinSolNumIters_MixedPrec;
+  S->ops->lastflag   = SUNLinSolLastFlag_MixedPrec;
+  S->ops->free       = SUNLinSolFree_MixedPrec;
+
+  /* Create content */
+  content = NULL;
+  content = (SUNLinearSolverContent_MixedPrec)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  S->content = content;
+
+  /* Fill content */
+  content->matid     = matid;
+  content->N         = MatrixRows;
+  content->ldim      = MatrixRows;
+  content->mu        = 0;
+  content->ml        = 0;
+  content->smu       = 0;
+  content->data      = NULL;
+  content->cols      = NULL;
+  content->work      = NULL;
+  content->pivots    = NULL;
+  content->res       = NULL;
+  content->rhs       = NULL;
+  content->max_iters = SUNMIXEDPREC_MAXITERS_DEFAULT;
+  content->num_iters = 0;
+  content->last_flag = 0;
+
+  if (matid == SUNMATRIX_BAND)
+  {
+    content->ldim = SUNBandMatrix_LDim(A);
+    content->mu   = SUNBandMatrix_UpperBandwidth(A);
+    content->ml   = SUNBandMatrix_LowerBandwidth(A);
+    content->smu  = SUNBandMatrix_StoredUpperBandwidth(A);
+  }
+
+  /* Allocate content */
+  content->data = (float*)malloc(content->ldim * MatrixRows * sizeof(float));
+  SUNAssertNull(content->data, SUN_ERR_MALLOC_FAIL);
+
+  content->cols = (float**)malloc(MatrixRows * sizeof(float*));
+  SUNAssertNull(content->cols, SUN_ERR_MALLOC_FAIL);
+  for (j = 0; j < MatrixRows; j++)
+  {
+    content->cols[j] = content->data + j * content->ldim;
+  }
+
+  content->work = (float*)malloc(MatrixRows * sizeof(float));
+  SUNAssertNull(content->work, SUN_ERR_MALLOC_FAIL);
+
+  content->pivots = (sunindextype*)malloc(MatrixRows * sizeof(sunindextype));
+  SUNAssertNull(content->pivots, SUN_ERR_MALLOC_FAIL);
+
+  content->res = N_VClone(y);
+  SUNCheckLastErrNull();
+
+  content->rhs = N_VClone(y);
+  SUNCheckLastErrNull();
+
+  return (S);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to set the maximum number of refinement steps
+ */
+
+SUNErrCode SUNLinSol_MixedPrecSetMaxIters(SUNLinearSolver S, int max_iters)
+{
+  /* Illegal max_iters implies use of default value */
+  if (max_iters < 0) { max_iters = SUNMIXEDPREC_MAXITERS_DEFAULT; }
+
+  MP_CONTENT(S)->max_iters = max_iters;
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of linear solver operations
+ * -----------------------------------------------------------------
+ */
+
+SUNLinearSolver_Type SUNLinSolGetType_MixedPrec(
+  SUNDIALS_MAYBE_UNUSED SUNLinearSolver S)
+{
+  return (SUNLINEARSOLVER_DIRECT);
+}
+
+SUNLinearSolver_ID SUNLinSolGetID_MixedPrec(SUNDIALS_MAYBE_UNUSED SUNLinearSolver S)
+{
+  return (SUNLINEARSOLVER_MIXEDPREC);
+}
+
+SUNErrCode SUNLinSolInitialize_MixedPrec(SUNLinearSolver S)
+{
+  /* all solver-specific memory has already been allocated */
+  NUMITERS(S) = 0;
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolSetup_MixedPrec(SUNLinearSolver S, SUNMatrix A)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNLinearSolverContent_MixedPrec content;
+  sunrealtype* A_data;
+  sunindextype i, len;
+
+  SUNAssert(A, SUN_ERR_ARG_CORRUPT);
+  content = MP_CONTENT(S);
+  SUNAssert(SUNMatGetID(A) == content->matid, SUN_ERR_ARG_WRONGTYPE);
+
+  /* access data pointers (return with failure on NULL) */
+  A_data = NULL;
+  if (content->matid == SUNMATRIX_DENSE) { A_data = SUNDenseMatrix_Data(A); }
+  else { A_data = SUNBandMatrix_Data(A); }
+  SUNAssert(A_data, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(content->pivots, SUN_ERR_ARG_CORRUPT);
+
+  /* copy A into single precision, entries outside the single precision
+     range cannot be factored so return with a recoverable failure */
+  len = content->ldim * content->N;
+  for (i = 0; i < len; i++)
+  {
+    if (SUNRabs(A_data[i]) > (sunrealtype)FLT_MAX)
+    {
+      LASTFLAG(S) = i / content->ldim + 1;
+      return SUNLS_PACKAGE_FAIL_REC;
+    }
+    content->data[i] = (float)A_data[i];
+  }
+
+  /* perform LU factorization of the single precision matrix */
+  if (content->matid == SUNMATRIX_DENSE)
+  {
+    LASTFLAG(S) = denseGETRF_lo(content->cols, content->N, content->pivots);
+  }
+  else
+  {
+    LASTFLAG(S) = bandGBTRF_lo(content->cols, content->N, content->mu,
+                               content->ml, content->smu, content->pivots);
+  }
+
+  /* store error flag (if nonzero, this row encountered zero-valued pivot) */
+  if (LASTFLAG(S) > 0) { return (SUNLS_LUFACT_FAIL); }
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolSolve_MixedPrec(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                             N_Vector b, SUNDIALS_MAYBE_UNUSED sunrealtype tol)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNLinearSolverContent_MixedPrec content;
+  sunrealtype *xdata, *rdata;
+  sunrealtype xnorm, dnorm, dnorm_prev;
+  float* work;
+  sunindextype i, N;
+
+  content = MP_CONTENT(S);
+  N       = content->N;
+  work    = content->work;
+
+  NUMITERS(S) = 0;
+
+  /* the residual needs the original right-hand side, save a copy if the
+     solution overwrites it */
+  if (x == b)
+  {
+    N_VScale(ONE, b, content->rhs);
+    SUNCheckLastErr();
+    b = content->rhs;
+  }
+
+  /* access data pointers (return with failure on NULL) */
+  xdata = NULL;
+  rdata = NULL;
+  xdata = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  rdata = N_VGetArrayPointer(b);
+  SUNCheckLastErr();
+  SUNAssert(xdata, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(rdata, SUN_ERR_ARG_CORRUPT);
+
+  /* initial solve with the single precision factors */
+  dnorm = ZERO;
+  xnorm = ZERO;
+  for (i = 0; i < N; i++) { work[i] = (float)rdata[i]; }
+  if (content->matid == SUNMATRIX_DENSE)
+  {
+    denseGETRS_lo(content->cols, N, content->pivots, work);
+  }
+  else
+  {
+    bandGBTRS_lo(content->cols, N, content->smu, content->ml, content->pivots,
+                 work);
+  }
+  for (i = 0; i < N; i++)
+  {
+    xdata[i] = (sunrealtype)work[i];
+    xnorm    = SUNMAX(xnorm, SUNRabs(xdata[i]));
+  }
+
+  /* iterative refinement, the residual is computed in sunrealtype precision */
+  rdata = N_VGetArrayPointer(content->res);
+  SUNCheckLastErr();
+  SUNAssert(rdata, SUN_ERR_ARG_CORRUPT);
+
+  dnorm_prev = xnorm;
+  while (NUMITERS(S) < content->max_iters)
+  {
+    /* r = b - A x */
+    SUNCheckCall(SUNMatMatvec(A, x, content->res));
+    N_VLinearSum(ONE, b, -ONE, content->res, content->res);
+    SUNCheckLastErr();
+
+    /* solve A_lo d = r */
+    for (i = 0; i < N; i++) { work[i] = (float)rdata[i]; }
+    if (content->matid == SUNMATRIX_DENSE)
+    {
+      denseGETRS_lo(content->cols, N, content->pivots, work);
+    }
+    else
+    {
+      bandGBTRS_lo(content->cols, N, content->smu, content->ml,
+                   content->pivots, work);
+    }
+
+    /* x = x + d */
+    dnorm = ZERO;
+    xnorm = ZERO;
+    for (i = 0; i < N; i++)
+    {
+      xdata[i] += (sunrealtype)work[i];
+      dnorm = SUNMAX(dnorm, SUNRabs((sunrealtype)work[i]));
+      xnorm = SUNMAX(xnorm, SUNRabs(xdata[i]));
+    }
+    NUMITERS(S)++;
+
+    /* stop once the correction is at the unit roundoff or stagnates */
+    if (!isfinite(dnorm) || !isfinite(xnorm)) { break; }
+    if (dnorm <= SUN_UNIT_ROUNDOFF * xnorm) { break; }
+    if (dnorm > HALF * dnorm_prev) { break; }
+    dnorm_prev = dnorm;
+  }
+
+  /* refinement failed to recover an accurate solution, the matrix is too
+     ill-conditioned for a single precision factorization */
+  if (!isfinite(dnorm) || !isfinite(xnorm) ||
+      dnorm > SUNRsqrt(SUN_UNIT_ROUNDOFF) * xnorm)
+  {
+    LASTFLAG(S) = SUNLS_PACKAGE_FAIL_REC;
+    return SUNLS_PACKAGE_FAIL_REC;
+  }
+
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolNumIters_MixedPrec(SUNLinearSolver S)
+{
+  /* return the stored 'num_iters' value */
+  return (NUMITERS(S));
+}
+
+sunindextype SUNLinSolLastFlag_MixedPrec(SUNLinearSolver S)
+{
+  /* return the stored 'last_flag' value */
+  return (LASTFLAG(S));
+}
+
+SUNErrCode SUNLinSolFree_MixedPrec(SUNLinearSolver S)
+{
+  /* return if S is already free */
+  if (S == NULL) { return SUN_SUCCESS; }
+
+  /* delete items from contents, then delete generic structure */
+  if (S->content)
+  {
+    if (MP_CONTENT(S)->data)
+    {
+      free(MP_CONTENT(S)->data);
+      MP_CONTENT(S)->data = NULL;
+    }
+    if (MP_CONTENT(S)->cols)
+    {
+      free(MP_CONTENT(S)->cols);
+      MP_CONTENT(S)->cols = NULL;
+    }
+    if (MP_CONTENT(S)->work)
+    {
+      free(MP_CONTENT(S)->work);
+      MP_CONTENT(S)->work = NULL;
+    }
+    if (PIVOTS(S))
+    {
+      free(PIVOTS(S));
+      PIVOTS(S) = NULL;
+    }
+    if (MP_CONTENT(S)->res)
+    {
+      N_VDestroy(MP_CONTENT(S)->res);
+      MP_CONTENT(S)->res = NULL;
+    }
+    if (MP_CONTENT(S)->rhs)
+    {
+      N_VDestroy(MP_CONTENT(S)->rhs);
+      MP_CONTENT(S)->rhs = NULL;
+    }
+    free(S->content);
+    S->content = NULL;
+  }
+  if (S->ops)
+  {
+    SUNContext_ArenaFree(S->sunctx, S->ops);
+    S->ops = NULL;
+  }
+  SUNContext_ArenaFree(S->sunctx, S);
+  S = NULL;
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Single precision versions of SUNDlsMat_denseGETRF and SUNDlsMat_denseGETRS
+ * for a square matrix stored by columns
+ */
+
+static sunindextype denseGETRF_lo(float** a, sunindextype n, sunindextype* p)
+{
+  sunindextype i, j, k, l;
+  float *col_j, *col_k;
+  float temp, mult, a_kj;
+
+  /* k-th elimination step number */
+  for (k = 0; k < n; k++)
+  {
+    col_k = a[k];
+
+    /* find l = pivot row number */
+    l = k;
+    for (i = k + 1; i < n; i++)
+    {
+      if (fabsf(col_k[i]) > fabsf(col_k[l])) { l = i; }
+    }
+    p[k] = l;
+
+    /* check for zero pivot element */
+    if (col_k[l] == 0.0f) { return (k + 1); }
+
+    /* swap a(k,1:n) and a(l,1:n) if necessary */
+    if (l != k)
+    {
+      for (i = 0; i < n; i++)
+      {
+        temp    = a[i][l];
+        a[i][l] = a[i][k];
+        a[i][k] = temp;
+      }
+    }
+
+    /* scale the elements below the diagonal in column k by 1.0/a(k,k) */
+    mult = 1.0f / col_k[k];
+    for (i = k + 1; i < n; i++) { col_k[i] *= mult; }
+
+    /* row_i = row_i - [a(i,k)/a(k,k)] row_k, i=k+1, ..., n-1 */
+    for (j = k + 1; j < n; j++)
+    {
+      col_j = a[j];
+      a_kj  = col_j[k];
+      if (a_kj != 0.0f)
+      {
+        for (i = k + 1; i < n; i++) { col_j[i] -= a_kj * col_k[i]; }
+      }
+    }
+  }
+
+  return (0);
+}
+
+static void denseGETRS_lo(float** a, sunindextype n, sunindextype* p, float* b)
+{
+  sunindextype i, k, pk;
+  float *col_k, tmp;
+
+  /* Permute b, based on pivot information in p */
+  for (k = 0; k < n; k++)
+  {
+    pk = p[k];
+    if (pk != k)
+    {
+      tmp   = b[k];
+      b[k]  = b[pk];
+      b[pk] = tmp;
+    }
+  }
+
+  /* Solve Ly = b, store solution y in b */
+  for (k = 0; k < n - 1; k++)
+  {
+    col_k = a[k];
+    for (i = k + 1; i < n; i++) { b[i] -= col_k[i] * b[k]; }
+  }
+
+  /* Solve Ux = y, store solution x in b */
+  for (k = n - 1; k > 0; k--)
+  {
+    col_k = a[k];
+    b[k] /= col_k[k];
+    for (i = 0; i < k; i++) { b[i] -= col_k[i] * b[k]; }
+  }
+  b[0] /= a[0][0];
+}
+
+/* ----------------------------------------------------------------------------
+ * Single precision versions of SUNDlsMat_bandGBTRF and SUNDlsMat_bandGBTRS
+ * using the band matrix storage layout
+ */
+
+#define ROW(i, j, smu) (i - j + smu)
+
+static sunindextype bandGBTRF_lo(float** a, sunindextype n, sunindextype mu,
+                                 sunindextype ml, sunindextype smu,
+                                 sunindextype* p)
+{
+  sunindextype c, r, num_rows;
+  sunindextype i, j, k, l, storage_l, storage_k, last_col_k, last_row_k;
+  float *a_c, *col_k, *diag_k, *sub_diag_k, *col_j, *kptr, *jptr;
+  float max, temp, mult, a_kj;
+  sunbooleantype swap;
+
+  /* zero out the first smu - mu rows of the rectangular array a */
+  num_rows = smu - mu;
+  if (num_rows > 0)
+  {
+    for (c = 0; c < n; c++)
+    {
+      a_c = a[c];
+      for (r = 0; r < num_rows; r++) { a_c[r] = 0.0f; }
+    }
+  }
+
+  /* k = elimination step number */
+  for (k = 0; k < n - 1; k++, p++)
+  {
+    col_k      = a[k];
+    diag_k     = col_k + smu;
+    sub_diag_k = diag_k + 1;
+    last_row_k = SUNMIN(n - 1, k + ml);
+
+    /* find l = pivot row number */
+    l   = k;
+    max = fabsf(*diag_k);
+    for (i = k + 1, kptr = sub_diag_k; i <= last_row_k; i++, kptr++)
+    {
+      if (fabsf(*kptr) > max)
+      {
+        l   = i;
+        max = fabsf(*kptr);
+      }
+    }
+    storage_l = ROW(l, k, smu);
+    *p        = l;
+
+    /* check for zero pivot element */
+    if (col_k[storage_l] == 0.0f) { return (k + 1); }
+
+    /* swap a(l,k) and a(k,k) if necessary */
+    if ((swap = (l != k)))
+    {
+      temp             = col_k[storage_l];
+      col_k[storage_l] = *diag_k;
+      *diag_k          = temp;
+    }
+
+    /* scale the elements below the diagonal in column k by -1.0 / a(k,k) */
+    mult = -1.0f / (*diag_k);
+    for (i = k + 1, kptr = sub_diag_k; i <= last_row_k; i++, kptr++)
+    {
+      (*kptr) *= mult;
+    }
+
+    /* row_i = row_i - [a(i,k)/a(k,k)] row_k, i=k+1, ..., SUNMIN(n-1,k+ml) */
+    last_col_k = SUNMIN(k + smu, n - 1);
+    for (j = k + 1; j <= last_col_k; j++)
+    {
+      col_j     = a[j];
+      storage_l = ROW(l, j, smu);
+      storage_k = ROW(k, j, smu);
+      a_kj      = col_j[storage_l];
+
+      /* Swap the elements a(k,j) and a(k,l) if l!=k. */
+      if (swap)
+      {
+        col_j[storage_l] = col_j[storage_k];
+        col_j[storage_k] = a_kj;
+      }
+
+      if (a_kj != 0.0f)
+      {
+        for (i = k + 1, kptr = sub_diag_k, jptr = col_j + ROW(k + 1, j, smu);
+             i <= last_row_k; i++, kptr++, jptr++)
+        {
+          (*jptr) += a_kj * (*kptr);
+        }
+      }
+    }
+  }
+
+  /* set the last pivot row to be n-1 and check for a zero pivot */
+  *p = n - 1;
+  if (a[n - 1][smu] == 0.0f) { return (n); }
+
+  return (0);
+}
+
+static void bandGBTRS_lo(float** a, sunindextype n, sunindextype smu,
+                         sunindextype ml, sunindextype* p, float* b)
+{
+  sunindextype k, l, i, first_row_k, last_row_k;
+  float mult, *diag_k;
+
+  /* Solve Ly = Pb, store solution y in b */
+  for (k = 0; k < n - 1; k++)
+  {
+    l    = p[k];
+    mult = b[l];
+    if (l != k)
+    {
+      b[l] = b[k];
+      b[k] = mult;
+    }
+    diag_k     = a[k] + smu;
+    last_row_k = SUNMIN(n - 1, k + ml);
+    for (i = k + 1; i <= last_row_k; i++) { b[i] += mult * diag_k[i - k]; }
+  }
+
+  /* Solve Ux = y, store solution x in b */
+  for (k = n - 1; k >= 0; k--)
+  {
+    diag_k      = a[k] + smu;
+    first_row_k = SUNMAX(0, k - smu);
+    b[k] /= (*diag_k);
+    mult = -b[k];
+    for (i = first_row_k; i <= k - 1; i++) { b[i] += mult * diag_k[i - k]; }
+  }
+}
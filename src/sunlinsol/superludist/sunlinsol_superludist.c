@@ -20,6 +20,7 @@
 
 #include <superlu_ddefs.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/sundials_math.h>
 #include <sunlinsol/sunlinsol_superludist.h>
 #include <sunmatrix/sunmatrix_slunrloc.h>
@@ -290,12 +291,12 @@ SUNErrCode SUNLinSolFree_SuperLUDIST(SUNLinearSolver S)
   /* free ops structure */
   if (S->ops)
   {
-    free(S->ops);
+    SUNContext_ArenaFree(S->sunctx, S->ops);
     S->ops = NULL;
   }
 
   /* free the actual SUNLinSol */
-  free(S);
+  SUNContext_ArenaFree(S->sunctx, S);
   S = NULL;
 
   return SUN_SUCCESS;
@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/sundials_errors.h>
 #include <sundials/sundials_math.h>
@@ -90,7 +91,8 @@ SUNMatrix SUNBandMatrixStorage(sunindextype N, sunindextype mu, sunindextype ml,
 
   /* Create content */
   content = NULL;
-  content = (SUNMatrixContent_Band)malloc(sizeof *content);
+  content = (SUNMatrixContent_Band)
+    SUNContext_ArenaAlloc(A->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Attach content */
@@ -260,17 +262,17 @@ void SUNMatDestroy_Band(SUNMatrix A)
       SM_COLS_B(A) = NULL;
     }
     /* free content struct */
-    free(A->content);
+    SUNContext_ArenaFree(A->sunctx, A->content);
     A->content = NULL;
   }
 
   /* free ops and matrix */
   if (A->ops)
   {
-    free(A->ops);
+    SUNContext_ArenaFree(A->sunctx, A->ops);
     A->ops = NULL;
   }
-  free(A);
+  SUNContext_ArenaFree(A->sunctx, A);
   A = NULL;
 
   return;
@@ -526,7 +528,7 @@ SUNErrCode SMScaleAddNew_Band(sunrealtype c, SUNMatrix A, SUNMatrix B)
   SM_DATA_B(A) = NULL;
   free(SM_COLS_B(A));
   SM_COLS_B(A) = NULL;
-  free(A->content);
+  SUNContext_ArenaFree(A->sunctx, A->content);
   A->content = NULL;
   A->content = C->content;
   C->content = NULL;
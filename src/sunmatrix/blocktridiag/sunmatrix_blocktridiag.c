@@ -0,0 +1,440 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the block-tridiagonal
+ * implementation of the SUNMATRIX package.
+ * -----------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_context_impl.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sunmatrix/sunmatrix_blocktridiag.h>
+
+#include "sundials_macros.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Private function prototypes */
+static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B);
+static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
+                                                 N_Vector y);
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new block-tridiagonal matrix
+ */
+
+SUNMatrix SUNBlockTridiagMatrix(sunindextype nblocks, sunindextype blocksize,
+                                SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  SUNMatrix A;
+  SUNMatrixContent_BlockTridiag content;
+  sunindextype k, blockSize2;
+
+  SUNAssertNull(nblocks > 0, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(blocksize > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Create an empty matrix object */
+  A = NULL;
+  A = SUNMatNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  A->ops->getid                    = SUNMatGetID_BlockTridiag;
+  A->ops->clone                    = SUNMatClone_BlockTridiag;
+  A->ops->destroy                  = SUNMatDestroy_BlockTridiag;
+  A->ops->zero                     = SUNMatZero_BlockTridiag;
+  A->ops->copy                     = SUNMatCopy_BlockTridiag;
+  A->ops->scaleadd                 = SUNMatScaleAdd_BlockTridiag;
+  A->ops->scaleaddi                = SUNMatScaleAddI_BlockTridiag;
+  A->ops->matvec                   = SUNMatMatvec_BlockTridiag;
+  A->ops->mathermitiantransposevec = SUNMatHermitianTransposeVec_BlockTridiag;
+
+  /* Create content */
+  content = NULL;
+  content = (SUNMatrixContent_BlockTridiag)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  A->content = content;
+
+  /* Fill content */
+  blockSize2         = blocksize * blocksize;
+  content->N         = nblocks * blocksize;
+  content->nblocks   = nblocks;
+  content->blocksize = blocksize;
+  content->ldata     = 3 * nblocks * blockSize2;
+  content->data      = NULL;
+  content->blocks    = NULL;
+
+  /* Allocate content */
+  content->data = (sunrealtype*)calloc(content->ldata, sizeof(sunrealtype));
+  SUNAssertNull(content->data, SUN_ERR_MALLOC_FAIL);
+
+  content->blocks = (sunrealtype**)malloc(3 * nblocks * sizeof(sunrealtype*));
+  SUNAssertNull(content->blocks, SUN_ERR_MALLOC_FAIL);
+  for (k = 0; k < 3 * nblocks; k++)
+  {
+    content->blocks[k] = content->data + k * blockSize2;
+  }
+
+  return (A);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to print the block-tridiagonal matrix
+ */
+
+void SUNBlockTridiagMatrix_Print(SUNMatrix A, FILE* outfile)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, bs, start, finish;
+
+  SUNAssertVoid(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG,
+                SUN_ERR_ARG_WRONGTYPE);
+
+  /* perform operation */
+  bs = SM_BLOCKSIZE_BT(A);
+  fprintf(outfile, "\n");
+  for (i = 0; i < SM_ROWS_BT(A); i++)
+  {
+    start  = SUNMAX(0, (i / bs - 1) * bs);
+    finish = SUNMIN(SM_COLUMNS_BT(A) - 1, (i / bs + 2) * bs - 1);
+    for (j = 0; j < start; j++) { fprintf(outfile, "%12s  ", ""); }
+    for (j = start; j <= finish; j++)
+    {
+      fprintf(outfile, SUN_FORMAT_E "  ", SM_ELEMENT_BT(A, i, j));
+    }
+    fprintf(outfile, "\n");
+  }
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Functions to access the contents of the block-tridiagonal matrix structure
+ */
+
+sunindextype SUNBlockTridiagMatrix_Rows(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG,
+                 SUN_ERR_ARG_WRONGTYPE);
+  return SM_ROWS_BT(A);
+}
+
+sunindextype SUNBlockTridiagMatrix_Columns(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG,
+                 SUN_ERR_ARG_WRONGTYPE);
+  return SM_COLUMNS_BT(A);
+}
+
+sunindextype SUNBlockTridiagMatrix_NumBlocks(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG,
+                 SUN_ERR_ARG_WRONGTYPE);
+  return SM_NBLOCKS_BT(A);
+}
+
+sunindextype SUNBlockTridiagMatrix_BlockSize(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG,
+                 SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCKSIZE_BT(A);
+}
+
+sunindextype SUNBlockTridiagMatrix_LData(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG,
+                 SUN_ERR_ARG_WRONGTYPE);
+  return SM_LDATA_BT(A);
+}
+
+sunrealtype* SUNBlockTridiagMatrix_Data(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG,
+                SUN_ERR_ARG_WRONGTYPE);
+  return SM_DATA_BT(A);
+}
+
+sunrealtype* SUNBlockTridiagMatrix_Block(SUNMatrix A, sunindextype I,
+                                         sunindextype J)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG,
+                SUN_ERR_ARG_WRONGTYPE);
+  SUNAssertNull(I >= 0 && I < SM_NBLOCKS_BT(A), SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(J >= 0 && J < SM_NBLOCKS_BT(A), SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(I - J <= 1 && J - I <= 1, SUN_ERR_ARG_OUTOFRANGE);
+  return SM_BLOCK_BT(A, I, J);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of matrix operations
+ * -----------------------------------------------------------------
+ */
+
+SUNMatrix_ID SUNMatGetID_BlockTridiag(SUNDIALS_MAYBE_UNUSED SUNMatrix A)
+{
+  return SUNMATRIX_BLOCKTRIDIAG;
+}
+
+SUNMatrix SUNMatClone_BlockTridiag(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNMatrix B = SUNBlockTridiagMatrix(SM_NBLOCKS_BT(A), SM_BLOCKSIZE_BT(A),
+                                      A->sunctx);
+  SUNCheckLastErrNull();
+  return (B);
+}
+
+void SUNMatDestroy_BlockTridiag(SUNMatrix A)
+{
+  if (A == NULL) { return; }
+
+  /* free content */
+  if (A->content != NULL)
+  {
+    /* free data array */
+    if (SM_DATA_BT(A))
+    {
+      free(SM_DATA_BT(A));
+      SM_DATA_BT(A) = NULL;
+    }
+    /* free block pointers */
+    if (SM_BLOCKS_BT(A))
+    {
+      free(SM_BLOCKS_BT(A));
+      SM_BLOCKS_BT(A) = NULL;
+    }
+    /* free content struct */
+    free(A->content);
+    A->content = NULL;
+  }
+
+  /* free ops and matrix */
+  if (A->ops)
+  {
+    SUNContext_ArenaFree(A->sunctx, A->ops);
+    A->ops = NULL;
+  }
+  SUNContext_ArenaFree(A->sunctx, A);
+  A = NULL;
+
+  return;
+}
+
+SUNErrCode SUNMatZero_BlockTridiag(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype* Adata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG, SUN_ERR_ARG_WRONGTYPE);
+
+  /* Perform operation */
+  Adata = SM_DATA_BT(A);
+  for (i = 0; i < SM_LDATA_BT(A); i++) { Adata[i] = ZERO; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatCopy_BlockTridiag(SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype *Adata, *Bdata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_BLOCKTRIDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Perform operation */
+  Adata = SM_DATA_BT(A);
+  Bdata = SM_DATA_BT(B);
+  for (i = 0; i < SM_LDATA_BT(A); i++) { Bdata[i] = Adata[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAddI_BlockTridiag(sunrealtype c, SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, k, bs;
+  sunrealtype *Adata, *D;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG, SUN_ERR_ARG_WRONGTYPE);
+
+  /* Perform operation */
+  Adata = SM_DATA_BT(A);
+  for (i = 0; i < SM_LDATA_BT(A); i++) { Adata[i] *= c; }
+
+  bs = SM_BLOCKSIZE_BT(A);
+  for (k = 0; k < SM_NBLOCKS_BT(A); k++)
+  {
+    D = SM_BLOCK_BT(A, k, k);
+    for (i = 0; i < bs; i++) { SM_BLOCK_ELEMENT_BT(D, i, i, bs) += ONE; }
+  }
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAdd_BlockTridiag(sunrealtype c, SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype *Adata, *Bdata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKTRIDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_BLOCKTRIDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Perform operation */
+  Adata = SM_DATA_BT(A);
+  Bdata = SM_DATA_BT(B);
+  for (i = 0; i < SM_LDATA_BT(A); i++) { Adata[i] = c * Adata[i] + Bdata[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatMatvec_BlockTridiag(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, I, J, bs, nb;
+  sunrealtype *block, *xd, *yd, *xJ, *yI;
+
+  SUNCheck(compatibleMatrixAndVectors(A, x, y), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access vector data (return if failure) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+
+  SUNAssert(xd, SUN_ERR_MEM_FAIL);
+  SUNAssert(yd, SUN_ERR_MEM_FAIL);
+
+  /* Perform operation */
+  bs = SM_BLOCKSIZE_BT(A);
+  nb = SM_NBLOCKS_BT(A);
+  for (i = 0; i < SM_ROWS_BT(A); i++) { yd[i] = ZERO; }
+  for (I = 0; I < nb; I++)
+  {
+    yI = yd + I * bs;
+    for (J = SUNMAX(0, I - 1); J <= SUNMIN(nb - 1, I + 1); J++)
+    {
+      block = SM_BLOCK_BT(A, I, J);
+      xJ    = xd + J * bs;
+      for (j = 0; j < bs; j++)
+      {
+        for (i = 0; i < bs; i++)
+        {
+          yI[i] += SM_BLOCK_ELEMENT_BT(block, i, j, bs) * xJ[j];
+        }
+      }
+    }
+  }
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatHermitianTransposeVec_BlockTridiag(SUNMatrix A, N_Vector x,
+                                                    N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, I, J, bs, nb;
+  sunrealtype *block, *xd, *yd, *xI, *yJ;
+
+  SUNCheck(compatibleMatrixAndVectors(A, y, x), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access vector data (return if failure) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+
+  SUNAssert(xd, SUN_ERR_MEM_FAIL);
+  SUNAssert(yd, SUN_ERR_MEM_FAIL);
+
+  /* Perform operation */
+  bs = SM_BLOCKSIZE_BT(A);
+  nb = SM_NBLOCKS_BT(A);
+  for (i = 0; i < SM_COLUMNS_BT(A); i++) { yd[i] = ZERO; }
+  for (I = 0; I < nb; I++)
+  {
+    xI = xd + I * bs;
+    for (J = SUNMAX(0, I - 1); J <= SUNMIN(nb - 1, I + 1); J++)
+    {
+      block = SM_BLOCK_BT(A, I, J);
+      yJ    = yd + J * bs;
+      for (j = 0; j < bs; j++)
+      {
+        for (i = 0; i < bs; i++)
+        {
+          yJ[j] += SM_BLOCK_ELEMENT_BT(block, i, j, bs) * xI[i];
+        }
+      }
+    }
+  }
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_MAYBE_UNUSED
+static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B)
+{
+  /* both matrices must have the same block structure */
+  if (SM_NBLOCKS_BT(A) != SM_NBLOCKS_BT(B)) { return SUNFALSE; }
+  if (SM_BLOCKSIZE_BT(A) != SM_BLOCKSIZE_BT(B)) { return SUNFALSE; }
+  return SUNTRUE;
+}
+
+SUNDIALS_MAYBE_UNUSED
+static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
+                                                 N_Vector y)
+{
+  /* Vectors must provide nvgetarraypointer */
+  if (!x->ops->nvgetarraypointer || !y->ops->nvgetarraypointer)
+  {
+    return SUNFALSE;
+  }
+
+  /* Check that the dimensions agree */
+  if ((N_VGetLength(x) != SM_COLUMNS_BT(A)) ||
+      (N_VGetLength(y) != SM_ROWS_BT(A)))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
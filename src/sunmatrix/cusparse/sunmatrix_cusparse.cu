@@ -23,6 +23,7 @@
 #include <sunmemory/sunmemory_cuda.h>
 
 #include "cusparse_kernels.cuh"
+#include <sundials/priv/sundials_context_impl.h>
 #include "sundials/sundials_errors.h"
 #include "sundials/sundials_math.h"
 #include "sundials_cuda.h"
@@ -806,10 +807,10 @@ void SUNMatDestroy_cuSparse(SUNMatrix A)
   /* free ops and matrix */
   if (A->ops)
   {
-    free(A->ops);
+    SUNContext_ArenaFree(A->sunctx, A->ops);
     A->ops = NULL;
   }
-  free(A);
+  SUNContext_ArenaFree(A->sunctx, A);
   A = NULL;
 
   return;
@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/sundials_errors.h>
 #include <sunmatrix/sunmatrix_dense.h>
@@ -74,7 +75,8 @@ SUNMatrix SUNDenseMatrix(sunindextype M, sunindextype N, SUNContext sunctx)
 
   /* Create content */
   content = NULL;
-  content = (SUNMatrixContent_Dense)malloc(sizeof *content);
+  content = (SUNMatrixContent_Dense)
+    SUNContext_ArenaAlloc(A->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Attach content */
@@ -207,17 +209,17 @@ void SUNMatDestroy_Dense(SUNMatrix A)
       SM_CONTENT_D(A)->cols = NULL;
     }
     /* free content struct */
-    free(A->content);
+    SUNContext_ArenaFree(A->sunctx, A->content);
     A->content = NULL;
   }
 
   /* free ops and matrix */
   if (A->ops)
   {
-    free(A->ops);
+    SUNContext_ArenaFree(A->sunctx, A->ops);
     A->ops = NULL;
   }
-  free(A);
+  SUNContext_ArenaFree(A->sunctx, A);
   A = NULL;
 
   return;
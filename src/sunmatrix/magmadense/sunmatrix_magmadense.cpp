@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <sunmatrix/sunmatrix_magmadense.h>
+#include <sundials/priv/sundials_context_impl.h>
 
 #if defined(SUNDIALS_MAGMA_BACKENDS_CUDA)
 
@@ -389,12 +390,12 @@ void SUNMatDestroy_MagmaDense(SUNMatrix Amat)
   /* Free ops */
   if (Amat->ops)
   {
-    free(Amat->ops);
+    SUNContext_ArenaFree(Amat->sunctx, Amat->ops);
     Amat->ops = NULL;
   }
 
   /* Free matrix */
-  free(Amat);
+  SUNContext_ArenaFree(Amat->sunctx, Amat);
   Amat = NULL;
 
   /* Call magma_finalize, but note that magma_finalize does
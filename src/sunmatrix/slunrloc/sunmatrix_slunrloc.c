@@ -23,6 +23,7 @@
 
 #include <superlu_ddefs.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/sundials_math.h>
 #include <sundials/sundials_mpi_types.h>
 #include <sunmatrix/sunmatrix_slunrloc.h>
@@ -240,11 +241,11 @@ void SUNMatDestroy_SLUNRloc(SUNMatrix A)
 
   if (A->ops)
   {
-    free(A->ops);
+    SUNContext_ArenaFree(A->sunctx, A->ops);
     A->ops = NULL;
   }
 
-  free(A);
+  SUNContext_ArenaFree(A->sunctx, A);
   A = NULL;
 
   return;
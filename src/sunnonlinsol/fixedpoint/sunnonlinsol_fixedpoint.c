@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/sundials_nvector_senswrapper.h>
 #include <sunnonlinsol/sunnonlinsol_fixedpoint.h>
@@ -73,7 +74,8 @@ SUNNonlinearSolver SUNNonlinSol_FixedPoint(N_Vector y, int m, SUNContext sunctx)
 
   /* Create nonlinear solver content structure */
   content = NULL;
-  content = (SUNNonlinearSolverContent_FixedPoint)malloc(sizeof *content);
+  content = (SUNNonlinearSolverContent_FixedPoint)
+    SUNContext_ArenaAlloc(NLS->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Initialize all components of content to 0/NULL */
@@ -288,19 +290,19 @@ SUNErrCode SUNNonlinSolFree_FixedPoint(SUNNonlinearSolver NLS)
   if (NLS->content)
   {
     FreeContent(NLS);
-    free(NLS->content);
+    SUNContext_ArenaFree(NLS->sunctx, NLS->content);
     NLS->content = NULL;
   }
 
   /* free the ops structure */
   if (NLS->ops)
   {
-    free(NLS->ops);
+    SUNContext_ArenaFree(NLS->sunctx, NLS->ops);
     NLS->ops = NULL;
   }
 
   /* free the overall NLS structure */
-  free(NLS);
+  SUNContext_ArenaFree(NLS->sunctx, NLS);
 
   return SUN_SUCCESS;
 }
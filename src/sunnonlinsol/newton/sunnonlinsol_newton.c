@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/sundials_math.h>
 #include <sundials/sundials_nvector_senswrapper.h>
@@ -69,7 +70,8 @@ SUNNonlinearSolver SUNNonlinSol_Newton(N_Vector y, SUNContext sunctx)
 
   /* Create content */
   content = NULL;
-  content = (SUNNonlinearSolverContent_Newton)malloc(sizeof *content);
+  content = (SUNNonlinearSolverContent_Newton)
+    SUNContext_ArenaAlloc(NLS->sunctx, sizeof *content);
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Initialize all components of content to 0/NULL */
@@ -336,19 +338,19 @@ SUNErrCode SUNNonlinSolFree_Newton(SUNNonlinearSolver NLS)
     }
     NEWTON_CONTENT(NLS)->delta = NULL;
 
-    free(NLS->content);
+    SUNContext_ArenaFree(NLS->sunctx, NLS->content);
     NLS->content = NULL;
   }
 
   /* free the ops structure */
   if (NLS->ops)
   {
-    free(NLS->ops);
+    SUNContext_ArenaFree(NLS->sunctx, NLS->ops);
     NLS->ops = NULL;
   }
 
   /* free the nonlinear solver */
-  free(NLS);
+  SUNContext_ArenaFree(NLS->sunctx, NLS);
 
   return SUN_SUCCESS;
 }
@@ -22,6 +22,7 @@
 #include <petscsnes.h>
 
 #include <nvector/nvector_petsc.h>
+#include <sundials/priv/sundials_context_impl.h>
 #include <sundials/sundials_errors.h>
 #include <sundials/sundials_math.h>
 #include <sunnonlinsol/sunnonlinsol_petscsnes.h>
@@ -269,12 +270,12 @@ SUNErrCode SUNNonlinSolFree_PetscSNES(SUNNonlinearSolver NLS)
   /* free the ops structure */
   if (NLS->ops)
   {
-    free(NLS->ops);
+    SUNContext_ArenaFree(NLS->sunctx, NLS->ops);
     NLS->ops = NULL;
   }
 
   /* free the nonlinear solver */
-  free(NLS);
+  SUNContext_ArenaFree(NLS->sunctx, NLS);
 
   return SUN_SUCCESS;
 }
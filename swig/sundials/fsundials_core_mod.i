@@ -26,6 +26,7 @@
 %include "fsundials_nonlinearsolver.i"
 %include "fsundials_adaptcontroller.i"
 %include "fsundials_stepper.i"
+%include "fsundials_steptrace.i"
 %include "fsundials_memory.i"
 %include "fsundials_adjoint.i"
 %include "fcopyright.i"
@@ -125,6 +125,19 @@ int main()
       numfails++;
     }
 
+    // report methods with independent (parallel) stages
+    int ngroups;
+    if (ARKodeButcherTable_GetStageGroups(B, &ngroups, NULL))
+    {
+      std::cout << "  ERROR: unable to compute stage groups\n";
+      numfails++;
+    }
+    else if (ngroups < B->stages)
+    {
+      std::cout << "  table has " << ngroups
+                << " groups of independent stages\n";
+    }
+
     // clean up after this test
     ARKodeButcherTable_Free(B);
   }
@@ -175,6 +188,54 @@ int main()
     ARKodeButcherTable_Free(Bi);
   }
 
+  // check the stage groups of a parallel and of sequential DIRK methods
+  std::cout << "\nTesting stage groups:\n\n";
+  struct Stage_Groups
+  {
+    const char* const name;
+    std::vector<int> group;
+  };
+
+  std::vector<Stage_Groups> stage_groups = {{"ARKODE_PDIRK_3_2_3", {0, 0, 1}},
+                                            {"ARKODE_SDIRK_2_1_2", {0, 1}},
+                                            {"ARKODE_ARK2_DIRK_3_1_2",
+                                             {0, 1, 2}}};
+
+  for (const auto& sg : stage_groups)
+  {
+    std::cout << "Testing method " << sg.name << ":";
+
+    ARKodeButcherTable B = ARKodeButcherTable_LoadDIRKByName(sg.name);
+    if (B == NULL)
+    {
+      std::cout << "  error retrieving table, aborting\n";
+      return 1;
+    }
+
+    int ngroups = -1;
+    std::vector<int> group(B->stages, -1);
+    if (ARKodeButcherTable_GetStageGroups(B, &ngroups, group.data()) ||
+        ngroups != sg.group.back() + 1 || group != sg.group)
+    {
+      std::cout << "  ERROR: stage groups do not match, ngroups = " << ngroups
+                << "\n";
+      numfails++;
+    }
+    else { std::cout << "  " << ngroups << " stage groups match\n"; }
+
+    ARKodeButcherTable_Free(B);
+  }
+
+  // invalid inputs
+  {
+    int ngroups;
+    if (ARKodeButcherTable_GetStageGroups(NULL, &ngroups, NULL) != -1)
+    {
+      std::cout << "  ERROR: stage groups of a NULL table\n";
+      numfails++;
+    }
+  }
+
   // determine overall success/failure and return
   if (numfails == 0)
   {
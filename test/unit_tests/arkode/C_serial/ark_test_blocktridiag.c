@@ -0,0 +1,205 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the block-tridiagonal difference quotient Jacobian. The 1D
+ * Brusselator reaction-diffusion system
+ *
+ *   u_t = a - (b + 1) u + u^2 v + d u_xx
+ *   v_t = b u - u^2 v + d v_xx
+ *
+ * with Dirichlet boundaries at the steady state is integrated by ARKStep with
+ * the default DIRK method. The block-tridiagonal matrix and linear solver using
+ * the internal DQ Jacobian and the dense matrix and linear solver are used.
+ * Each DQ Jacobian must use 3 * blocksize RHS evaluations and the solutions
+ * must agree to within the integration tolerances.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_arkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_blocktridiag.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_blocktridiag.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NBLOCKS 20
+#define BS      2
+#define NEQ     (NBLOCKS * BS)
+#define A_PAR   SUN_RCONST(1.0)
+#define B_PAR   SUN_RCONST(3.0)
+#define D_PAR   SUN_RCONST(0.02)
+#define RTOL    SUN_RCONST(1.0e-6)
+#define ATOL    SUN_RCONST(1.0e-9)
+#define ONE     SUN_RCONST(1.0)
+#define TWO     SUN_RCONST(2.0)
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+  sunrealtype dx  = ONE / (NBLOCKS + 1);
+  sunrealtype c   = D_PAR / (dx * dx);
+
+  for (int i = 0; i < NBLOCKS; i++)
+  {
+    sunrealtype u  = yd[BS * i];
+    sunrealtype v  = yd[BS * i + 1];
+    sunrealtype ul = (i > 0) ? yd[BS * (i - 1)] : A_PAR;
+    sunrealtype vl = (i > 0) ? yd[BS * (i - 1) + 1] : B_PAR / A_PAR;
+    sunrealtype ur = (i < NBLOCKS - 1) ? yd[BS * (i + 1)] : A_PAR;
+    sunrealtype vr = (i < NBLOCKS - 1) ? yd[BS * (i + 1) + 1] : B_PAR / A_PAR;
+
+    fd[BS * i] = A_PAR - (B_PAR + ONE) * u + u * u * v +
+                 c * (ul - TWO * u + ur);
+    fd[BS * i + 1] = B_PAR * u - u * u * v + c * (vl - TWO * v + vr);
+  }
+
+  return 0;
+}
+
+/* Integrates to tf with the given matrix type */
+static int solve(int blocktridiag, N_Vector y, long int* nje, long int* nfeLS,
+                 SUNContext sunctx)
+{
+  sunrealtype t      = SUN_RCONST(0.0);
+  sunrealtype tf     = SUN_RCONST(1.0);
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* arkode_mem   = NULL;
+  int flag;
+
+  for (int i = 0; i < NBLOCKS; i++)
+  {
+    sunrealtype x     = (i + 1) * (ONE / (NBLOCKS + 1));
+    ydata[BS * i]     = A_PAR + TWO * x * (ONE - x);
+    ydata[BS * i + 1] = B_PAR / A_PAR;
+  }
+
+  arkode_mem = ARKStepCreate(NULL, ode_rhs, t, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  flag = ARKodeSStolerances(arkode_mem, RTOL, ATOL);
+  if (flag) { return 1; }
+
+  if (blocktridiag) { A = SUNBlockTridiagMatrix(NBLOCKS, BS, sunctx); }
+  else { A = SUNDenseMatrix(NEQ, NEQ, sunctx); }
+  if (!A) { return 1; }
+
+  if (blocktridiag) { LS = SUNLinSol_BlockTridiag(y, A, sunctx); }
+  else { LS = SUNLinSol_Dense(y, A, sunctx); }
+  if (!LS) { return 1; }
+
+  flag = ARKodeSetLinearSolver(arkode_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = ARKodeEvolve(arkode_mem, tf, y, &t, ARK_NORMAL);
+  if (flag) { return 1; }
+
+  flag = ARKodeGetNumJacEvals(arkode_mem, nje);
+  if (flag) { return 1; }
+
+  flag = ARKodeGetNumLinRhsEvals(arkode_mem, nfeLS);
+  if (flag) { return 1; }
+
+  ARKodeFree(&arkode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector yref     = NULL;
+  N_Vector y        = NULL;
+  N_Vector tmp      = NULL;
+  long int nje[2]   = {0, 0};
+  long int nfeLS[2] = {0, 0};
+  sunrealtype err;
+  int fails = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  yref = N_VNew_Serial(NEQ, sunctx);
+  y    = N_VNew_Serial(NEQ, sunctx);
+  tmp  = N_VNew_Serial(NEQ, sunctx);
+  if (!yref || !y || !tmp)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  if (solve(0, yref, &nje[0], &nfeLS[0], sunctx))
+  {
+    fprintf(stderr, "FAIL: dense solve\n");
+    return 1;
+  }
+
+  if (solve(1, y, &nje[1], &nfeLS[1], sunctx))
+  {
+    fprintf(stderr, "FAIL: block-tridiagonal solve\n");
+    return 1;
+  }
+
+  /* difference relative to the tolerances */
+  N_VAbs(yref, tmp);
+  N_VScale(RTOL, tmp, tmp);
+  N_VAddConst(tmp, ATOL, tmp);
+  N_VInv(tmp, tmp);
+  N_VLinearSum(ONE, y, -ONE, yref, y);
+  N_VProd(y, tmp, y);
+  err = N_VMaxNorm(y);
+
+  printf("dense:          nje = %ld, nfeLS = %ld\n", nje[0], nfeLS[0]);
+  printf("block-tridiag:  nje = %ld, nfeLS = %ld, difference = %" GSYM "\n",
+         nje[1], nfeLS[1], err);
+
+  if (nje[1] < 1 || nfeLS[1] != 3 * BS * nje[1])
+  {
+    fprintf(stderr, "FAIL: block-tridiagonal DQ Jacobian RHS evals\n");
+    fails++;
+  }
+
+  if (err > ONE)
+  {
+    fprintf(stderr, "FAIL: block-tridiagonal solution does not match dense\n");
+    fails++;
+  }
+
+  N_VDestroy(yref);
+  N_VDestroy(y);
+  N_VDestroy(tmp);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
@@ -0,0 +1,185 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the threaded difference quotient Jacobian. The stiff
+ * reaction-diffusion system
+ *
+ *   y_i' = (y_{i-1} - 2 y_i + y_{i+1}) / dx^2 - y_i^2,  i = 0, ..., N - 1
+ *
+ * with homogeneous Dirichlet boundaries is integrated with a DIRK method and
+ * the internal dense and band DQ Jacobians. The solutions and the number of
+ * RHS evaluations for the DQ Jacobian computed with several threads must match
+ * the serial ones exactly.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_arkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_band.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NEQ 23
+#define ONE SUN_RCONST(1.0)
+#define TWO SUN_RCONST(2.0)
+
+/* The RHS only accesses its arguments and is therefore reentrant */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunrealtype dx         = ONE / (NEQ + 1);
+  sunrealtype c          = ONE / (dx * dx);
+
+  for (int i = 0; i < NEQ; i++)
+  {
+    sunrealtype yl = (i > 0) ? y_data[i - 1] : SUN_RCONST(0.0);
+    sunrealtype yr = (i < NEQ - 1) ? y_data[i + 1] : SUN_RCONST(0.0);
+    ydot_data[i]   = c * (yl - TWO * y_data[i] + yr) - y_data[i] * y_data[i];
+  }
+
+  return 0;
+}
+
+/* Integrates to tf with the given matrix type and number of DQ threads */
+static int solve(int band, int nthreads, N_Vector y, long int* nfeLS,
+                 SUNContext sunctx)
+{
+  sunrealtype t      = SUN_RCONST(0.0);
+  sunrealtype tf     = SUN_RCONST(0.1);
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* arkode_mem   = NULL;
+  int flag;
+
+  for (int i = 0; i < NEQ; i++)
+  {
+    sunrealtype x = (i + 1) * (ONE / (NEQ + 1));
+    ydata[i]      = SUN_RCONST(4.0) * x * (ONE - x);
+  }
+
+  arkode_mem = ARKStepCreate(NULL, ode_rhs, t, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  flag = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  if (band) { A = SUNBandMatrix(NEQ, 1, 1, sunctx); }
+  else { A = SUNDenseMatrix(NEQ, NEQ, sunctx); }
+  if (!A) { return 1; }
+
+  if (band) { LS = SUNLinSol_Band(y, A, sunctx); }
+  else { LS = SUNLinSol_Dense(y, A, sunctx); }
+  if (!LS) { return 1; }
+
+  flag = ARKodeSetLinearSolver(arkode_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = ARKodeSetDQJacNumThreads(arkode_mem, nthreads);
+  if (flag) { return 1; }
+
+  flag = ARKodeEvolve(arkode_mem, tf, y, &t, ARK_NORMAL);
+  if (flag) { return 1; }
+
+  flag = ARKodeGetNumLinRhsEvals(arkode_mem, nfeLS);
+  if (flag) { return 1; }
+
+  ARKodeFree(&arkode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector yref     = NULL;
+  N_Vector y        = NULL;
+  int fails         = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  yref = N_VNew_Serial(NEQ, sunctx);
+  y    = N_VNew_Serial(NEQ, sunctx);
+  if (!yref || !y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  for (int band = 0; band < 2; band++)
+  {
+    long int nfeLS_ref = 0;
+
+    if (solve(band, 1, yref, &nfeLS_ref, sunctx))
+    {
+      fprintf(stderr, "FAIL: %s serial solve\n", band ? "band" : "dense");
+      fails++;
+      continue;
+    }
+
+    /* more threads than band column groups leaves some threads idle */
+    for (int nthreads = 2; nthreads <= 4; nthreads++)
+    {
+      long int nfeLS = 0;
+
+      if (solve(band, nthreads, y, &nfeLS, sunctx))
+      {
+        fprintf(stderr, "FAIL: %s solve with %d threads\n",
+                band ? "band" : "dense", nthreads);
+        fails++;
+        continue;
+      }
+
+      N_VLinearSum(ONE, y, -ONE, yref, y);
+      sunrealtype diff = N_VMaxNorm(y);
+
+      printf("%s, %d threads: nfeLS = %ld (%ld), difference = %" GSYM "\n",
+             band ? "band" : "dense", nthreads, nfeLS, nfeLS_ref, diff);
+
+      if (nfeLS != nfeLS_ref || diff != SUN_RCONST(0.0))
+      {
+        fprintf(stderr, "FAIL: %s with %d threads does not match serial\n",
+                band ? "band" : "dense", nthreads);
+        fails++;
+      }
+    }
+  }
+
+  N_VDestroy(yref);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
@@ -0,0 +1,191 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit tests for the ARKODE parareal module. The oscillator
+ *
+ *   y_1' = y_2, y_2' = -y_1 - 0.1 y_2
+ *
+ * is integrated with an explicit Runge-Kutta coarse propagator with a large
+ * fixed step and fine propagators with a small fixed step. The tests verify
+ * that the iteration reproduces the sequential fine solution after as many
+ * iterations as slices, that it converges in fewer iterations with the default
+ * tolerances, and that reaching the maximum number of iterations is reported.
+ * ---------------------------------------------------------------------------*/
+
+#include <arkode/arkode_erkstep.h>
+#include <arkode/arkode_parareal.h>
+#include <nvector/nvector_serial.h>
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NFINE   4
+#define NSLICES 10
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* ydd = N_VGetArrayPointer(ydot);
+
+  ydd[0] = yd[1];
+  ydd[1] = -yd[0] - SUN_RCONST(0.1) * yd[1];
+  return 0;
+}
+
+static void* create_erk(sunrealtype h, int order, N_Vector y,
+                        SUNStepper* stepper, SUNContext ctx)
+{
+  void* arkode_mem = ERKStepCreate(f, SUN_RCONST(0.0), y, ctx);
+  ARKodeSetOrder(arkode_mem, order);
+  ARKodeSetFixedStep(arkode_mem, h);
+  ARKodeSetMaxNumSteps(arkode_mem, -1);
+  ARKodeCreateSUNStepper(arkode_mem, stepper);
+  return arkode_mem;
+}
+
+static int check(const char* name, sunbooleantype fail)
+{
+  if (fail) { fprintf(stderr, "FAIL: %s\n", name); }
+  else { printf("PASS: %s\n", name); }
+  return fail ? 1 : 0;
+}
+
+int main(void)
+{
+  SUNContext ctx = NULL;
+  SUNErrCode err = SUNContext_Create(SUN_COMM_NULL, &ctx);
+  if (err != SUN_SUCCESS)
+  {
+    fprintf(stderr, "Failed to create the SUNContext\n");
+    return 1;
+  }
+
+  sunrealtype t0 = SUN_RCONST(0.0);
+  sunrealtype tf = SUN_RCONST(10.0);
+
+  N_Vector y0   = N_VNew_Serial(2, ctx);
+  N_Vector yf   = N_VClone(y0);
+  N_Vector yref = N_VClone(y0);
+  N_VGetArrayPointer(y0)[0] = SUN_RCONST(1.0);
+  N_VGetArrayPointer(y0)[1] = SUN_RCONST(0.0);
+
+  /* coarse and fine propagators */
+  SUNStepper coarse;
+  void* coarse_mem = create_erk(SUN_RCONST(0.25), 2, y0, &coarse, ctx);
+
+  /* the fine steppers are evolved concurrently, so each one has its own
+     context and vectors */
+  SUNContext fine_ctx[NFINE];
+  N_Vector fine_y[NFINE];
+  SUNStepper fine[NFINE];
+  void* fine_mem[NFINE];
+  for (int i = 0; i < NFINE; i++)
+  {
+    err = SUNContext_Create(SUN_COMM_NULL, &fine_ctx[i]);
+    if (err != SUN_SUCCESS)
+    {
+      fprintf(stderr, "Failed to create the SUNContext\n");
+      return 1;
+    }
+    fine_y[i] = N_VNew_Serial(2, fine_ctx[i]);
+    N_VGetArrayPointer(fine_y[i])[0] = N_VGetArrayPointer(y0)[0];
+    N_VGetArrayPointer(fine_y[i])[1] = N_VGetArrayPointer(y0)[1];
+    fine_mem[i] = create_erk(SUN_RCONST(0.01), 4, fine_y[i], &fine[i],
+                             fine_ctx[i]);
+  }
+
+  /* sequential fine solution over the same slices */
+  N_VScale(SUN_RCONST(1.0), y0, yref);
+  for (int n = 0; n < NSLICES; n++)
+  {
+    sunrealtype tn   = t0 + (tf - t0) * ((sunrealtype)n / NSLICES);
+    sunrealtype tn1  = (n == NSLICES - 1)
+                         ? tf
+                         : t0 + (tf - t0) * ((sunrealtype)(n + 1) / NSLICES);
+    sunrealtype tret = tn;
+    ARKodeReset(fine_mem[0], tn, yref);
+    ARKodeSetStopTime(fine_mem[0], tn1);
+    ARKodeEvolve(fine_mem[0], tn1, yref, &tret, ARK_NORMAL);
+  }
+
+  void* pr_mem = ARKPararealCreate(coarse, NFINE, fine, ctx);
+  ARKPararealSetNumSlices(pr_mem, NSLICES);
+
+  int fails = 0;
+  int niters, niters_default;
+  int flag;
+  sunrealtype dnorm;
+
+  /* with tight tolerances the iteration runs until it reproduces the fine
+     solution */
+  ARKPararealSetTolerances(pr_mem, SUN_RCONST(1.0e-30), SUN_RCONST(1.0e-30));
+  flag = ARKPararealEvolve(pr_mem, t0, y0, tf, yf);
+  ARKPararealGetNumIters(pr_mem, &niters);
+  N_VLinearSum(SUN_RCONST(1.0), yf, -SUN_RCONST(1.0), yref, yf);
+  dnorm = N_VMaxNorm(yf);
+  printf("exact iteration: flag = %d, iters = %d, error = %" GSYM "\n", flag,
+         niters, dnorm);
+  fails += check("exact iteration",
+                 flag != ARK_SUCCESS || niters != NSLICES ||
+                   dnorm > SUN_RCONST(100.0) * SUN_UNIT_ROUNDOFF);
+
+  /* with the default tolerances the iteration stops early */
+  ARKPararealSetTolerances(pr_mem, SUN_RCONST(0.0), SUN_RCONST(0.0));
+  flag = ARKPararealEvolve(pr_mem, t0, y0, tf, yf);
+  ARKPararealGetNumIters(pr_mem, &niters);
+  N_VLinearSum(SUN_RCONST(1.0), yf, -SUN_RCONST(1.0), yref, yf);
+  dnorm = N_VMaxNorm(yf);
+  printf("default tolerances: flag = %d, iters = %d, error = %" GSYM "\n",
+         flag, niters, dnorm);
+  fails += check("default tolerances", flag != ARK_SUCCESS ||
+                                         niters >= NSLICES ||
+                                         dnorm > SUN_RCONST(1.0e-5));
+  niters_default = niters;
+
+  /* limiting the number of iterations */
+  ARKPararealSetMaxIters(pr_mem, 1);
+  flag = ARKPararealEvolve(pr_mem, t0, y0, tf, yf);
+  ARKPararealGetNumIters(pr_mem, &niters);
+  printf("one iteration: flag = %d, iters = %d\n", flag, niters);
+  fails += check("one iteration", flag != ARK_CONV_FAILURE || niters != 1);
+
+  long int ntotiters;
+  ARKPararealGetTotalIters(pr_mem, &ntotiters);
+  fails += check("total iterations",
+                 ntotiters != NSLICES + niters_default + niters);
+
+  ARKPararealFree(&pr_mem);
+  for (int i = 0; i < NFINE; i++)
+  {
+    SUNStepper_Destroy(&fine[i]);
+    ARKodeFree(&fine_mem[i]);
+    N_VDestroy(fine_y[i]);
+    SUNContext_Free(&fine_ctx[i]);
+  }
+  SUNStepper_Destroy(&coarse);
+  ARKodeFree(&coarse_mem);
+  N_VDestroy(y0);
+  N_VDestroy(yf);
+  N_VDestroy(yref);
+  SUNContext_Free(&ctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
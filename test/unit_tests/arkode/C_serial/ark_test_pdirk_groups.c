@@ -0,0 +1,252 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the concurrent solves of independent implicit stage groups in
+ * ARKStep. The stiff reaction-diffusion system
+ *
+ *   y_i' = (y_{i-1} - 2 y_i + y_{i+1}) / dx^2 - y_i^2,  i = 0, ..., N - 1
+ *
+ * with homogeneous Dirichlet boundaries is integrated with the parallel DIRK
+ * method ARKODE_PDIRK_3_2_3, whose first two stages form a group, and the
+ * dense and band linear solvers. The solutions with the stages of the group
+ * solved concurrently must agree with the sequential stage solves to within
+ * the integration tolerances, and the solutions and statistics must not depend
+ * on the number of threads. A user-supplied linear system function is not
+ * supported with concurrent stage solves and must be rejected.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_arkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_band.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NEQ 23
+#define ONE SUN_RCONST(1.0)
+#define TWO SUN_RCONST(2.0)
+
+/* The RHS only accesses its arguments and is therefore reentrant */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunrealtype dx         = ONE / (NEQ + 1);
+  sunrealtype c          = ONE / (dx * dx);
+
+  for (int i = 0; i < NEQ; i++)
+  {
+    sunrealtype yl = (i > 0) ? y_data[i - 1] : SUN_RCONST(0.0);
+    sunrealtype yr = (i < NEQ - 1) ? y_data[i + 1] : SUN_RCONST(0.0);
+    ydot_data[i]   = c * (yl - TWO * y_data[i] + yr) - y_data[i] * y_data[i];
+  }
+
+  return 0;
+}
+
+/* A linear system function that is never called */
+static int linsys(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix A,
+                  SUNMatrix M, sunbooleantype jok, sunbooleantype* jcur,
+                  sunrealtype gamma, void* user_data, N_Vector tmp1,
+                  N_Vector tmp2, N_Vector tmp3)
+{
+  return -1;
+}
+
+/* Integrates to tf with the given matrix type and number of stage threads and
+   returns the number of steps, fi evaluations, and nonlinear iterations */
+static int solve(int band, int nthreads, sunbooleantype user_linsys,
+                 N_Vector y, long int* stats, SUNContext sunctx)
+{
+  sunrealtype t      = SUN_RCONST(0.0);
+  sunrealtype tf     = SUN_RCONST(0.1);
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* arkode_mem   = NULL;
+  int flag;
+
+  for (int i = 0; i < NEQ; i++)
+  {
+    sunrealtype x = (i + 1) * (ONE / (NEQ + 1));
+    ydata[i]      = SUN_RCONST(4.0) * x * (ONE - x);
+  }
+
+  arkode_mem = ARKStepCreate(NULL, ode_rhs, t, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  flag = ARKStepSetTableName(arkode_mem, "ARKODE_PDIRK_3_2_3",
+                             "ARKODE_ERK_NONE");
+  if (flag) { return 1; }
+
+  flag = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  if (band) { A = SUNBandMatrix(NEQ, 1, 1, sunctx); }
+  else { A = SUNDenseMatrix(NEQ, NEQ, sunctx); }
+  if (!A) { return 1; }
+
+  if (band) { LS = SUNLinSol_Band(y, A, sunctx); }
+  else { LS = SUNLinSol_Dense(y, A, sunctx); }
+  if (!LS) { return 1; }
+
+  flag = ARKodeSetLinearSolver(arkode_mem, LS, A);
+  if (flag) { return 1; }
+
+  if (user_linsys)
+  {
+    flag = ARKodeSetLinSysFn(arkode_mem, linsys);
+    if (flag) { return 1; }
+  }
+
+  flag = ARKStepSetStageGroupNumThreads(arkode_mem, nthreads);
+  if (flag) { return 1; }
+
+  flag = ARKodeEvolve(arkode_mem, tf, y, &t, ARK_NORMAL);
+  if (user_linsys)
+  {
+    ARKodeFree(&arkode_mem);
+    SUNLinSolFree(LS);
+    SUNMatDestroy(A);
+    return (flag == ARK_ILL_INPUT) ? 0 : 1;
+  }
+  if (flag) { return 1; }
+
+  flag = ARKodeGetNumSteps(arkode_mem, &stats[0]);
+  if (flag) { return 1; }
+
+  flag = ARKodeGetNumRhsEvals(arkode_mem, 1, &stats[1]);
+  if (flag) { return 1; }
+
+  flag = ARKodeGetNumNonlinSolvIters(arkode_mem, &stats[2]);
+  if (flag) { return 1; }
+
+  ARKodeFree(&arkode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector yseq     = NULL;
+  N_Vector yref     = NULL;
+  N_Vector y        = NULL;
+  int fails         = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  yseq = N_VNew_Serial(NEQ, sunctx);
+  yref = N_VNew_Serial(NEQ, sunctx);
+  y    = N_VNew_Serial(NEQ, sunctx);
+  if (!yseq || !yref || !y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  for (int band = 0; band < 2; band++)
+  {
+    long int stats_seq[3] = {0, 0, 0};
+    long int stats_ref[3] = {0, 0, 0};
+
+    if (solve(band, 1, SUNFALSE, yseq, stats_seq, sunctx) ||
+        solve(band, 2, SUNFALSE, yref, stats_ref, sunctx))
+    {
+      fprintf(stderr, "FAIL: %s reference solves\n", band ? "band" : "dense");
+      fails++;
+      continue;
+    }
+
+    N_VLinearSum(ONE, yref, -ONE, yseq, y);
+    sunrealtype diff = N_VMaxNorm(y);
+
+    printf("%s, sequential: nst = %ld, nfi = %ld, nni = %ld\n",
+           band ? "band" : "dense", stats_seq[0], stats_seq[1], stats_seq[2]);
+    printf("%s, 2 threads: nst = %ld, nfi = %ld, nni = %ld, difference = %" GSYM
+           "\n",
+           band ? "band" : "dense", stats_ref[0], stats_ref[1], stats_ref[2],
+           diff);
+
+    if (diff > SUN_RCONST(1.0e-4))
+    {
+      fprintf(stderr, "FAIL: %s concurrent solve does not match sequential\n",
+              band ? "band" : "dense");
+      fails++;
+    }
+
+    /* more threads than stages in a group leaves some threads idle */
+    for (int nthreads = 3; nthreads <= 4; nthreads++)
+    {
+      long int stats[3] = {0, 0, 0};
+
+      if (solve(band, nthreads, SUNFALSE, y, stats, sunctx))
+      {
+        fprintf(stderr, "FAIL: %s solve with %d threads\n",
+                band ? "band" : "dense", nthreads);
+        fails++;
+        continue;
+      }
+
+      N_VLinearSum(ONE, y, -ONE, yref, y);
+      diff = N_VMaxNorm(y);
+
+      printf("%s, %d threads: nst = %ld, nfi = %ld, nni = %ld, difference = "
+             "%" GSYM "\n",
+             band ? "band" : "dense", nthreads, stats[0], stats[1], stats[2],
+             diff);
+
+      if (stats[0] != stats_ref[0] || stats[1] != stats_ref[1] ||
+          stats[2] != stats_ref[2] || diff != SUN_RCONST(0.0))
+      {
+        fprintf(stderr, "FAIL: %s with %d threads does not match 2 threads\n",
+                band ? "band" : "dense", nthreads);
+        fails++;
+      }
+    }
+  }
+
+  if (solve(0, 2, SUNTRUE, y, NULL, sunctx))
+  {
+    fprintf(stderr, "FAIL: user linear system function not rejected\n");
+    fails++;
+  }
+
+  N_VDestroy(yseq);
+  N_VDestroy(yref);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
@@ -0,0 +1,207 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit tests for adaptive time stepping with SPRKStep. The Kepler problem
+ *
+ *   q' = p, p' = -q / |q|^3
+ *
+ * with eccentricity 0.5 is integrated over one orbit, after which the solution
+ * returns to the initial condition. The tests verify for each SPRK method of
+ * order two or higher, with and without compensated summation, that the local
+ * error estimate decreases at least quadratically with the step size and that
+ * the adaptive solution meets the requested accuracy. The first order
+ * symplectic Euler method has no embedding and must fail to initialize without
+ * a fixed step size.
+ * ---------------------------------------------------------------------------*/
+
+#include <arkode/arkode_sprk.h>
+#include <arkode/arkode_sprkstep.h>
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_math.h>
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ECC SUN_RCONST(0.5)
+#define PI  SUN_RCONST(3.141592653589793238462643383279502884197169)
+
+/* y = [q1, q2, p1, p2] */
+static int f1(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* ydd = N_VGetArrayPointer(ydot);
+  sunrealtype r    = SUNRsqrt(yd[0] * yd[0] + yd[1] * yd[1]);
+
+  ydd[2] = -yd[0] / (r * r * r);
+  ydd[3] = -yd[1] / (r * r * r);
+  return 0;
+}
+
+static int f2(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* ydd = N_VGetArrayPointer(ydot);
+
+  ydd[0] = yd[2];
+  ydd[1] = yd[3];
+  return 0;
+}
+
+static void initial_condition(N_Vector y)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+
+  yd[0] = SUN_RCONST(1.0) - ECC;
+  yd[1] = SUN_RCONST(0.0);
+  yd[2] = SUN_RCONST(0.0);
+  yd[3] = SUNRsqrt((SUN_RCONST(1.0) + ECC) / (SUN_RCONST(1.0) - ECC));
+}
+
+static int check(const char* name, sunbooleantype fail)
+{
+  if (fail) { fprintf(stderr, "FAIL: %s\n", name); }
+  else { printf("PASS: %s\n", name); }
+  return fail ? 1 : 0;
+}
+
+/* Returns the max norm of the local error estimate of one step of size h */
+static sunrealtype estimate(const char* method, sunrealtype h, N_Vector y,
+                            N_Vector ele, SUNContext ctx)
+{
+  sunrealtype t   = SUN_RCONST(0.0);
+  sunrealtype est = SUN_RCONST(-1.0);
+
+  initial_condition(y);
+  void* arkode_mem = SPRKStepCreate(f1, f2, t, y, ctx);
+  SPRKStepSetMethodName(arkode_mem, method);
+
+  /* loose tolerances so the first step is accepted */
+  ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e10), SUN_RCONST(1.0));
+  ARKodeSetInitStep(arkode_mem, h);
+  if (ARKodeEvolve(arkode_mem, SUN_RCONST(1.0), y, &t, ARK_ONE_STEP) ==
+        ARK_SUCCESS &&
+      ARKodeGetEstLocalErrors(arkode_mem, ele) == ARK_SUCCESS)
+  {
+    est = N_VMaxNorm(ele);
+  }
+
+  ARKodeFree(&arkode_mem);
+  return est;
+}
+
+int main(void)
+{
+  const char* methods[] = {"ARKODE_SPRK_LEAPFROG_2_2",
+                           "ARKODE_SPRK_PSEUDO_LEAPFROG_2_2",
+                           "ARKODE_SPRK_MCLACHLAN_2_2",
+                           "ARKODE_SPRK_RUTH_3_3",
+                           "ARKODE_SPRK_MCLACHLAN_3_3",
+                           "ARKODE_SPRK_CANDY_ROZMUS_4_4",
+                           "ARKODE_SPRK_MCLACHLAN_4_4",
+                           "ARKODE_SPRK_MCLACHLAN_5_6",
+                           "ARKODE_SPRK_YOSHIDA_6_8",
+                           "ARKODE_SPRK_SUZUKI_UMENO_8_16",
+                           "ARKODE_SPRK_SOFRONIOU_10_36"};
+  const int nmethods    = sizeof(methods) / sizeof(methods[0]);
+
+  SUNContext ctx = NULL;
+  SUNErrCode err = SUNContext_Create(SUN_COMM_NULL, &ctx);
+  if (err != SUN_SUCCESS)
+  {
+    fprintf(stderr, "Failed to create the SUNContext\n");
+    return 1;
+  }
+
+  sunrealtype tol = SUNMAX(SUN_RCONST(1.0e-8),
+                           SUN_RCONST(1000.0) * SUN_UNIT_ROUNDOFF);
+  sunrealtype tf  = SUN_RCONST(2.0) * PI;
+
+  N_Vector y    = N_VNew_Serial(4, ctx);
+  N_Vector y0   = N_VClone(y);
+  N_Vector ele  = N_VClone(y);
+  int fails     = 0;
+  char name[128];
+
+  initial_condition(y0);
+
+  for (int m = 0; m < nmethods; m++)
+  {
+    /* the error estimate decreases at least quadratically */
+    sunrealtype est1 = estimate(methods[m], SUN_RCONST(0.1), y, ele, ctx);
+    sunrealtype est2 = estimate(methods[m], SUN_RCONST(0.05), y, ele, ctx);
+    sunrealtype ratio = (est1 > 0 && est2 > 0) ? est1 / est2 : SUN_RCONST(0.0);
+    printf("%s: error estimate ratio = %.2" GSYM "\n", methods[m], ratio);
+    snprintf(name, sizeof(name), "%s error estimate", methods[m]);
+    fails += check(name, ratio < SUN_RCONST(3.5));
+
+    /* adaptive integration over one orbit */
+    for (int comp = 0; comp < 2; comp++)
+    {
+      sunrealtype t = SUN_RCONST(0.0);
+      long int nst  = 0;
+      long int netf = 0;
+
+      initial_condition(y);
+      void* arkode_mem = SPRKStepCreate(f1, f2, t, y, ctx);
+      SPRKStepSetMethodName(arkode_mem, methods[m]);
+      SPRKStepSetUseCompensatedSums(arkode_mem, comp);
+      ARKodeSStolerances(arkode_mem, tol, tol);
+      ARKodeSetMaxNumSteps(arkode_mem, -1);
+      ARKodeSetStopTime(arkode_mem, tf);
+
+      int flag = ARKodeEvolve(arkode_mem, tf, y, &t, ARK_NORMAL);
+      ARKodeGetNumSteps(arkode_mem, &nst);
+      ARKodeGetNumErrTestFails(arkode_mem, &netf);
+
+      N_VLinearSum(SUN_RCONST(1.0), y, -SUN_RCONST(1.0), y0, y);
+      sunrealtype error = N_VMaxNorm(y);
+      printf("%s (compensated = %d): flag = %d, steps = %ld, error test "
+             "fails = %ld, error = %.2" GSYM "\n",
+             methods[m], comp, flag, nst, netf, error);
+      snprintf(name, sizeof(name), "%s adaptive%s", methods[m],
+               comp ? " compensated" : "");
+      fails += check(name, flag != ARK_TSTOP_RETURN ||
+                             error > SUN_RCONST(1.0e4) * tol);
+
+      ARKodeFree(&arkode_mem);
+    }
+  }
+
+  /* symplectic Euler requires a fixed step size */
+  {
+    sunrealtype t = SUN_RCONST(0.0);
+
+    initial_condition(y);
+    void* arkode_mem = SPRKStepCreate(f1, f2, t, y, ctx);
+    SPRKStepSetMethodName(arkode_mem, "ARKODE_SPRK_EULER_1_1");
+    ARKodeSStolerances(arkode_mem, tol, tol);
+    int flag = ARKodeEvolve(arkode_mem, tf, y, &t, ARK_NORMAL);
+    fails += check("ARKODE_SPRK_EULER_1_1 adaptive", flag != ARK_ILL_INPUT);
+    ARKodeFree(&arkode_mem);
+  }
+
+  N_VDestroy(y);
+  N_VDestroy(y0);
+  N_VDestroy(ele);
+  SUNContext_Free(&ctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
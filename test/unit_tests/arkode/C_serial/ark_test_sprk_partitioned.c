@@ -0,0 +1,203 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit tests for the partitioned SPRKStep formulation. The Kepler problem
+ *
+ *   p' = -q / |q|^3, q' = p
+ *
+ * with eccentricity 0.5 is integrated over one orbit with a ManyVector state
+ * y = [p, q]. The solutions computed with the partitioned formulation, with
+ * and without a fused force update function, are compared to the solution
+ * computed with the standard formulation for fixed and adaptive steps.
+ * ---------------------------------------------------------------------------*/
+
+#include <arkode/arkode_sprk.h>
+#include <arkode/arkode_sprkstep.h>
+#include <nvector/nvector_manyvector.h>
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_math.h>
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ECC SUN_RCONST(0.5)
+#define PI  SUN_RCONST(3.141592653589793238462643383279502884197169)
+
+/* p' = f1(t, q) */
+static int f1(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* q  = N_VGetSubvectorArrayPointer_ManyVector(y, 1);
+  sunrealtype* pd = N_VGetSubvectorArrayPointer_ManyVector(ydot, 0);
+  sunrealtype r   = SUNRsqrt(q[0] * q[0] + q[1] * q[1]);
+
+  pd[0] = -q[0] / (r * r * r);
+  pd[1] = -q[1] / (r * r * r);
+  return 0;
+}
+
+/* q' = f2(t, p) */
+static int f2(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* p  = N_VGetSubvectorArrayPointer_ManyVector(y, 0);
+  sunrealtype* qd = N_VGetSubvectorArrayPointer_ManyVector(ydot, 1);
+
+  qd[0] = p[0];
+  qd[1] = p[1];
+  return 0;
+}
+
+/* p = p + c f1(t, q) */
+static int force_update(sunrealtype t, N_Vector q, sunrealtype c, N_Vector p,
+                        void* user_data)
+{
+  sunrealtype* qd = N_VGetArrayPointer(q);
+  sunrealtype* pd = N_VGetArrayPointer(p);
+  sunrealtype r   = SUNRsqrt(qd[0] * qd[0] + qd[1] * qd[1]);
+
+  pd[0] -= c * qd[0] / (r * r * r);
+  pd[1] -= c * qd[1] / (r * r * r);
+  return 0;
+}
+
+static void initial_condition(N_Vector y)
+{
+  sunrealtype* p = N_VGetSubvectorArrayPointer_ManyVector(y, 0);
+  sunrealtype* q = N_VGetSubvectorArrayPointer_ManyVector(y, 1);
+
+  q[0] = SUN_RCONST(1.0) - ECC;
+  q[1] = SUN_RCONST(0.0);
+  p[0] = SUN_RCONST(0.0);
+  p[1] = SUNRsqrt((SUN_RCONST(1.0) + ECC) / (SUN_RCONST(1.0) - ECC));
+}
+
+static int check(const char* name, sunbooleantype fail)
+{
+  if (fail) { fprintf(stderr, "FAIL: %s\n", name); }
+  else { printf("PASS: %s\n", name); }
+  return fail ? 1 : 0;
+}
+
+/* mode 0 = standard, 1 = partitioned, 2 = partitioned with force update */
+static int solve(const char* method, int mode, sunbooleantype adaptive,
+                 N_Vector y, long int* nf1, SUNContext ctx)
+{
+  sunrealtype t  = SUN_RCONST(0.0);
+  sunrealtype tf = SUN_RCONST(2.0) * PI;
+
+  initial_condition(y);
+  void* arkode_mem = SPRKStepCreate(f1, f2, t, y, ctx);
+  SPRKStepSetMethodName(arkode_mem, method);
+  if (mode > 0)
+  {
+    int flag = SPRKStepSetPartitioned(arkode_mem, SUNTRUE);
+    if (flag != ARK_SUCCESS) { return flag; }
+  }
+  if (mode > 1) { SPRKStepSetForceUpdateFn(arkode_mem, force_update); }
+  if (adaptive)
+  {
+    ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-6));
+  }
+  else { ARKodeSetFixedStep(arkode_mem, SUN_RCONST(0.01)); }
+  ARKodeSetMaxNumSteps(arkode_mem, -1);
+  ARKodeSetStopTime(arkode_mem, tf);
+
+  int flag = ARKodeEvolve(arkode_mem, tf, y, &t, ARK_NORMAL);
+  ARKodeGetNumRhsEvals(arkode_mem, 0, nf1);
+  ARKodeFree(&arkode_mem);
+
+  return flag;
+}
+
+int main(void)
+{
+  const char* methods[] = {"ARKODE_SPRK_EULER_1_1", "ARKODE_SPRK_LEAPFROG_2_2",
+                           "ARKODE_SPRK_MCLACHLAN_4_4",
+                           "ARKODE_SPRK_YOSHIDA_6_8"};
+  const int nmethods    = sizeof(methods) / sizeof(methods[0]);
+
+  SUNContext ctx = NULL;
+  SUNErrCode err = SUNContext_Create(SUN_COMM_NULL, &ctx);
+  if (err != SUN_SUCCESS)
+  {
+    fprintf(stderr, "Failed to create the SUNContext\n");
+    return 1;
+  }
+
+  N_Vector pq[2]  = {N_VNew_Serial(2, ctx), N_VNew_Serial(2, ctx)};
+  N_Vector yref   = N_VNew_ManyVector(2, pq, ctx);
+  N_Vector y      = N_VClone(yref);
+  sunrealtype tol = SUNRsqrt(SUN_UNIT_ROUNDOFF);
+  int fails       = 0;
+  char name[128];
+
+  for (int m = 0; m < nmethods; m++)
+  {
+    for (int adaptive = 0; adaptive < 2; adaptive++)
+    {
+      long int nf1_ref = 0;
+
+      /* symplectic Euler has no error estimate */
+      if (m == 0 && adaptive) { continue; }
+
+      int flag = solve(methods[m], 0, adaptive, yref, &nf1_ref, ctx);
+      snprintf(name, sizeof(name), "%s %s standard", methods[m],
+               adaptive ? "adaptive" : "fixed");
+      fails += check(name, flag != ARK_TSTOP_RETURN);
+
+      for (int mode = 1; mode < 3; mode++)
+      {
+        long int nf1 = 0;
+
+        flag = solve(methods[m], mode, adaptive, y, &nf1, ctx);
+        N_VLinearSum(SUN_RCONST(1.0), y, -SUN_RCONST(1.0), yref, y);
+        sunrealtype diff = N_VMaxNorm(y);
+        printf("%s %s %s: flag = %d, nf1 = %ld (%ld), difference = "
+               "%.2" GSYM "\n",
+               methods[m], adaptive ? "adaptive" : "fixed",
+               mode == 1 ? "partitioned" : "force update", flag, nf1, nf1_ref,
+               diff);
+        snprintf(name, sizeof(name), "%s %s %s", methods[m],
+                 adaptive ? "adaptive" : "fixed",
+                 mode == 1 ? "partitioned" : "force update");
+        fails += check(name, flag != ARK_TSTOP_RETURN || nf1 != nf1_ref ||
+                               diff > tol);
+      }
+    }
+  }
+
+  /* the partitioned formulation requires a ManyVector with two subvectors */
+  {
+    N_Vector ys      = N_VNew_Serial(4, ctx);
+    void* arkode_mem = SPRKStepCreate(f1, f2, SUN_RCONST(0.0), ys, ctx);
+    int flag         = SPRKStepSetPartitioned(arkode_mem, SUNTRUE);
+    fails += check("serial vector rejected", flag != ARK_ILL_INPUT);
+    ARKodeFree(&arkode_mem);
+    N_VDestroy(ys);
+  }
+
+  N_VDestroy(y);
+  N_VDestroy(yref);
+  N_VDestroy(pq[0]);
+  N_VDestroy(pq[1]);
+  SUNContext_Free(&ctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
@@ -0,0 +1,257 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit tests for the time reversible step size control in SPRKStep. The Kepler
+ * problem
+ *
+ *   q' = p, p' = -q / |q|^3
+ *
+ * with eccentricity 0.5 is integrated with the step density rho = |q|^(-3/2).
+ * The tests verify, with and without compensated summation, that the step size
+ * varies along the orbit, that the solution returns to the initial condition
+ * after one orbit, and that the energy error remains bounded over many orbits,
+ * i.e., the largest error over the second half of the integration does not
+ * exceed the largest error over the first half by more than a small factor.
+ * Invalid inputs must be rejected.
+ * ---------------------------------------------------------------------------*/
+
+#include <arkode/arkode_sprk.h>
+#include <arkode/arkode_sprkstep.h>
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_math.h>
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ECC     SUN_RCONST(0.5)
+#define PI      SUN_RCONST(3.141592653589793238462643383279502884197169)
+#define NORBITS 100
+
+/* y = [q1, q2, p1, p2] */
+static int f1(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* ydd = N_VGetArrayPointer(ydot);
+  sunrealtype r    = SUNRsqrt(yd[0] * yd[0] + yd[1] * yd[1]);
+
+  ydd[2] = -yd[0] / (r * r * r);
+  ydd[3] = -yd[1] / (r * r * r);
+  return 0;
+}
+
+static int f2(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* ydd = N_VGetArrayPointer(ydot);
+
+  ydd[0] = yd[2];
+  ydd[1] = yd[3];
+  return 0;
+}
+
+/* rho = |q|^(-3/2) and d rho/dt = -3/2 |q|^(-7/2) (q . p) */
+static int density(sunrealtype t, N_Vector y, sunrealtype* rho,
+                   sunrealtype* rho_dot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype r2  = yd[0] * yd[0] + yd[1] * yd[1];
+  sunrealtype qp  = yd[0] * yd[2] + yd[1] * yd[3];
+
+  *rho     = SUNRpowerR(r2, SUN_RCONST(-0.75));
+  *rho_dot = SUN_RCONST(-1.5) * (*rho) * qp / r2;
+  return 0;
+}
+
+static sunrealtype energy(N_Vector y)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+
+  return SUN_RCONST(0.5) * (yd[2] * yd[2] + yd[3] * yd[3]) -
+         SUN_RCONST(1.0) / SUNRsqrt(yd[0] * yd[0] + yd[1] * yd[1]);
+}
+
+static void initial_condition(N_Vector y)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+
+  yd[0] = SUN_RCONST(1.0) - ECC;
+  yd[1] = SUN_RCONST(0.0);
+  yd[2] = SUN_RCONST(0.0);
+  yd[3] = SUNRsqrt((SUN_RCONST(1.0) + ECC) / (SUN_RCONST(1.0) - ECC));
+}
+
+static int check(const char* name, sunbooleantype fail)
+{
+  if (fail) { fprintf(stderr, "FAIL: %s\n", name); }
+  else { printf("PASS: %s\n", name); }
+  return fail ? 1 : 0;
+}
+
+/* Integrates over NORBITS orbits with the reversible control and returns the
+   largest energy errors over the first and second half, the error after one
+   orbit, and the ratio of the largest and smallest step sizes */
+static int integrate(sunrealtype eps, int comp, N_Vector y, N_Vector y0,
+                     sunrealtype* err_energy, sunrealtype* err_orbit,
+                     sunrealtype* hrange, long int* nst, SUNContext ctx)
+{
+  sunrealtype t    = SUN_RCONST(0.0);
+  sunrealtype H0   = SUN_RCONST(0.0);
+  sunrealtype hmin = SUN_RCONST(0.0);
+  sunrealtype hmax = SUN_RCONST(0.0);
+  int flag         = 0;
+
+  initial_condition(y);
+  H0 = energy(y);
+
+  void* arkode_mem = SPRKStepCreate(f1, f2, t, y, ctx);
+  if (!arkode_mem) { return -1; }
+
+  flag = SPRKStepSetMethodName(arkode_mem, "ARKODE_SPRK_LEAPFROG_2_2");
+  if (flag) { return flag; }
+
+  flag = SPRKStepSetUseCompensatedSums(arkode_mem, comp);
+  if (flag) { return flag; }
+
+  flag = SPRKStepSetReversibleStepControl(arkode_mem, density, eps);
+  if (flag) { return flag; }
+
+  flag = ARKodeSetMaxNumSteps(arkode_mem, -1);
+  if (flag) { return flag; }
+
+  err_energy[0] = err_energy[1] = SUN_RCONST(0.0);
+
+  for (int orbit = 1; orbit <= NORBITS; orbit++)
+  {
+    sunrealtype tout = SUN_RCONST(2.0) * PI * orbit;
+
+    flag = ARKodeSetStopTime(arkode_mem, tout);
+    if (flag) { return flag; }
+
+    while (t < tout)
+    {
+      sunrealtype h = SUN_RCONST(0.0);
+
+      flag = ARKodeEvolve(arkode_mem, tout, y, &t, ARK_ONE_STEP);
+      if (flag < 0) { return flag; }
+
+      /* the energy error after each step and the step sizes except for the
+         shortened last step of each orbit */
+      sunrealtype err  = SUNRabs(energy(y) - H0);
+      int half         = (2 * orbit > NORBITS) ? 1 : 0;
+      err_energy[half] = SUNMAX(err_energy[half], err);
+
+      if (flag == ARK_TSTOP_RETURN) { continue; }
+      flag = ARKodeGetLastStep(arkode_mem, &h);
+      if (flag) { return flag; }
+      hmin = (hmin == SUN_RCONST(0.0)) ? h : SUNMIN(hmin, h);
+      hmax = SUNMAX(hmax, h);
+    }
+
+    if (orbit == 1)
+    {
+      N_VLinearSum(SUN_RCONST(1.0), y, -SUN_RCONST(1.0), y0, y0);
+      *err_orbit = N_VMaxNorm(y0);
+      initial_condition(y0);
+    }
+  }
+
+  *hrange = hmax / hmin;
+
+  flag = ARKodeGetNumSteps(arkode_mem, nst);
+  if (flag) { return flag; }
+
+  ARKodeFree(&arkode_mem);
+  return 0;
+}
+
+int main(void)
+{
+  SUNContext ctx = NULL;
+  SUNErrCode err = SUNContext_Create(SUN_COMM_NULL, &ctx);
+  if (err != SUN_SUCCESS)
+  {
+    fprintf(stderr, "Failed to create the SUNContext\n");
+    return 1;
+  }
+
+  sunrealtype eps = SUN_RCONST(0.01);
+  N_Vector y      = N_VNew_Serial(4, ctx);
+  N_Vector y0     = N_VClone(y);
+  int fails       = 0;
+  char name[128];
+
+  initial_condition(y0);
+
+  for (int comp = 0; comp < 2; comp++)
+  {
+    sunrealtype err_energy[2] = {SUN_RCONST(0.0), SUN_RCONST(0.0)};
+    sunrealtype err_orbit     = SUN_RCONST(0.0);
+    sunrealtype hrange        = SUN_RCONST(0.0);
+    long int nst              = 0;
+
+    int flag = integrate(eps, comp, y, y0, err_energy, &err_orbit, &hrange,
+                         &nst, ctx);
+    printf("reversible (compensated = %d): flag = %d, steps = %ld, hmax/hmin "
+           "= %.2" GSYM ", orbit error = %.2" GSYM ", energy error = %.2" GSYM
+           ", %.2" GSYM "\n",
+           comp, flag, nst, hrange, err_orbit, err_energy[0], err_energy[1]);
+    snprintf(name, sizeof(name), "reversible%s", comp ? " compensated" : "");
+    fails += check(name, flag != 0);
+    if (flag) { continue; }
+
+    snprintf(name, sizeof(name), "reversible%s step variation",
+             comp ? " compensated" : "");
+    fails += check(name, hrange < SUN_RCONST(4.0));
+
+    snprintf(name, sizeof(name), "reversible%s orbit error",
+             comp ? " compensated" : "");
+    fails += check(name, err_orbit > SUN_RCONST(1.0e-2));
+
+    snprintf(name, sizeof(name), "reversible%s energy error",
+             comp ? " compensated" : "");
+    fails += check(name, err_energy[0] > SUN_RCONST(1.0e-3) ||
+                           err_energy[1] > SUN_RCONST(2.0) * err_energy[0]);
+  }
+
+  /* invalid inputs */
+  {
+    sunrealtype t = SUN_RCONST(0.0);
+
+    initial_condition(y);
+    void* arkode_mem = SPRKStepCreate(f1, f2, t, y, ctx);
+    int flag = SPRKStepSetReversibleStepControl(arkode_mem, density,
+                                                SUN_RCONST(0.0));
+    fails += check("zero transformed step", flag != ARK_ILL_INPUT);
+
+    SPRKStepSetReversibleStepControl(arkode_mem, density, eps);
+    ARKodeSetFixedStep(arkode_mem, SUN_RCONST(0.0));
+    flag = ARKodeEvolve(arkode_mem, SUN_RCONST(1.0), y, &t, ARK_ONE_STEP);
+    fails += check("reversible control without fixed step",
+                   flag != ARK_ILL_INPUT);
+    ARKodeFree(&arkode_mem);
+  }
+
+  N_VDestroy(y);
+  N_VDestroy(y0);
+  SUNContext_Free(&ctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
@@ -0,0 +1,235 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the adaptive Jacobian evaluation policy. The Robertson chemical
+ * kinetics problem
+ *
+ *   y0' = -0.04 y0 + 1e4 y1 y2
+ *   y1' =  0.04 y0 - 1e4 y1 y2 - 3e7 y1^2
+ *   y2' =  3e7 y1^2
+ *
+ * is integrated with a Jacobian function that is made expensive compared to
+ * the RHS. With the adaptive policy enabled the integrator must evaluate the
+ * Jacobian fewer times than with the default fixed step interval and the
+ * solution must agree with a reference solution to within the tolerances.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NEQ  3
+#define RTOL SUN_RCONST(1.0e-6)
+#define ATOL SUN_RCONST(1.0e-10)
+#define TF   SUN_RCONST(4.0e5)
+
+/* number of times the Jacobian is recomputed in each evaluation */
+#define JAC_REPEAT 20000
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = SUN_RCONST(-0.04) * yd[0] + SUN_RCONST(1.0e4) * yd[1] * yd[2];
+  fd[2] = SUN_RCONST(3.0e7) * yd[1] * yd[1];
+  fd[1] = -fd[0] - fd[2];
+
+  return 0;
+}
+
+static int ode_jac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix J,
+                   void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+
+  /* repeat the evaluation to model an expensive Jacobian */
+  for (volatile int k = 0; k < JAC_REPEAT; k++)
+  {
+    SM_ELEMENT_D(J, 0, 0) = SUN_RCONST(-0.04);
+    SM_ELEMENT_D(J, 0, 1) = SUN_RCONST(1.0e4) * yd[2];
+    SM_ELEMENT_D(J, 0, 2) = SUN_RCONST(1.0e4) * yd[1];
+
+    SM_ELEMENT_D(J, 1, 0) = SUN_RCONST(0.04);
+    SM_ELEMENT_D(J, 1, 1) = SUN_RCONST(-1.0e4) * yd[2] -
+                            SUN_RCONST(6.0e7) * yd[1];
+    SM_ELEMENT_D(J, 1, 2) = SUN_RCONST(-1.0e4) * yd[1];
+
+    SM_ELEMENT_D(J, 2, 0) = SUN_RCONST(0.0);
+    SM_ELEMENT_D(J, 2, 1) = SUN_RCONST(6.0e7) * yd[1];
+    SM_ELEMENT_D(J, 2, 2) = SUN_RCONST(0.0);
+  }
+
+  return 0;
+}
+
+/* Integrates to TF with the given tolerance scale and Jacobian policy */
+static int solve(sunrealtype tol_scale, sunbooleantype adaptive, N_Vector y,
+                 long int* nje, long int* nst, SUNContext sunctx)
+{
+  sunrealtype t      = SUN_RCONST(0.0);
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+  int flag;
+
+  ydata[0] = SUN_RCONST(1.0);
+  ydata[1] = SUN_RCONST(0.0);
+  ydata[2] = SUN_RCONST(0.0);
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, t, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, tol_scale * RTOL, tol_scale * ATOL);
+  if (flag) { return 1; }
+
+  flag = CVodeSetMaxNumSteps(cvode_mem, 100000);
+  if (flag) { return 1; }
+
+  A = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = CVodeSetJacFn(cvode_mem, ode_jac);
+  if (flag) { return 1; }
+
+  flag = CVodeSetAdaptiveJacEval(cvode_mem, adaptive);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, TF, y, &t, CV_NORMAL);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumJacEvals(cvode_mem, nje);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumSteps(cvode_mem, nst);
+  if (flag) { return 1; }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+/* Returns the maximum error relative to the tolerances */
+static sunrealtype error_norm(N_Vector y, N_Vector yref, N_Vector tmp)
+{
+  N_VAbs(yref, tmp);
+  N_VScale(RTOL, tmp, tmp);
+  N_VAddConst(tmp, ATOL, tmp);
+  N_VInv(tmp, tmp);
+  N_VLinearSum(SUN_RCONST(1.0), y, SUN_RCONST(-1.0), yref, y);
+  N_VProd(y, tmp, y);
+  return N_VMaxNorm(y);
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector yref     = NULL;
+  N_Vector y        = NULL;
+  N_Vector tmp      = NULL;
+  long int nje[2]   = {0, 0};
+  long int nst[2]   = {0, 0};
+  sunrealtype err[2];
+  int fails = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  yref = N_VNew_Serial(NEQ, sunctx);
+  y    = N_VNew_Serial(NEQ, sunctx);
+  tmp  = N_VNew_Serial(NEQ, sunctx);
+  if (!yref || !y || !tmp)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  /* reference solution with tighter tolerances */
+  if (solve(SUN_RCONST(1.0e-4), SUNFALSE, yref, &nje[0], &nst[0], sunctx))
+  {
+    fprintf(stderr, "FAIL: reference solve\n");
+    return 1;
+  }
+
+  for (int adaptive = 0; adaptive < 2; adaptive++)
+  {
+    if (solve(SUN_RCONST(1.0), adaptive, y, &nje[adaptive], &nst[adaptive],
+              sunctx))
+    {
+      fprintf(stderr, "FAIL: solve with adaptive = %d\n", adaptive);
+      fails++;
+      continue;
+    }
+
+    err[adaptive] = error_norm(y, yref, tmp);
+
+    printf("adaptive = %d: nst = %ld, nje = %ld, error = %" GSYM "\n",
+           adaptive, nst[adaptive], nje[adaptive], err[adaptive]);
+  }
+
+  if (!fails)
+  {
+    if (nje[1] >= nje[0])
+    {
+      fprintf(stderr, "FAIL: adaptive policy did not reduce Jacobian evals\n");
+      fails++;
+    }
+
+    /* the policy is timing based so the step sequence varies between runs,
+       the global error must be within a small factor of the error with the
+       default policy (which may itself exceed the local tolerances) */
+    if (err[1] > SUN_RCONST(5.0) * SUNMAX(err[0], SUN_RCONST(1.0)))
+    {
+      fprintf(stderr, "FAIL: adaptive policy solution is not accurate\n");
+      fails++;
+    }
+  }
+
+  N_VDestroy(yref);
+  N_VDestroy(y);
+  N_VDestroy(tmp);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
@@ -0,0 +1,232 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the BBD preconditioner sub-blocks. The system consists of
+ * NCHAIN independent reaction-diffusion chains
+ *
+ *   y_i' = (y_{i-1} - 2 y_i + y_{i+1}) / dx^2 - y_i^2,  i = 0, ..., NPTS - 1
+ *
+ * with homogeneous Dirichlet boundaries stored one after another. It is
+ * integrated with GMRES and the BBD preconditioner using one and several
+ * sub-blocks. When the sub-blocks match the chains the preconditioner does not
+ * drop any nonzero entries and the solution and solver statistics must match
+ * the single sub-block results exactly. Otherwise the solution must agree to
+ * within a small multiple of the integration tolerances.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "cvode/cvode_bbdpre.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_spgmr.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NCHAIN 3
+#define NPTS   12
+#define NEQ    (NCHAIN * NPTS)
+#define RTOL   SUN_RCONST(1.0e-6)
+#define ATOL   SUN_RCONST(1.0e-8)
+#define ZERO   SUN_RCONST(0.0)
+#define ONE    SUN_RCONST(1.0)
+#define TWO    SUN_RCONST(2.0)
+
+/* The local function only accesses its arguments and is therefore reentrant */
+static int local_fn(sunindextype Nlocal, sunrealtype t, N_Vector y, N_Vector g,
+                    void* user_data)
+{
+  sunrealtype* y_data = N_VGetArrayPointer(y);
+  sunrealtype* g_data = N_VGetArrayPointer(g);
+  sunrealtype dx      = ONE / (NPTS + 1);
+  sunrealtype c       = ONE / (dx * dx);
+
+  for (int k = 0; k < NCHAIN; k++)
+  {
+    sunrealtype* yk = y_data + k * NPTS;
+    sunrealtype* gk = g_data + k * NPTS;
+    for (int i = 0; i < NPTS; i++)
+    {
+      sunrealtype yl = (i > 0) ? yk[i - 1] : ZERO;
+      sunrealtype yr = (i < NPTS - 1) ? yk[i + 1] : ZERO;
+      gk[i]          = c * (yl - TWO * yk[i] + yr) - yk[i] * yk[i];
+    }
+  }
+
+  return 0;
+}
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  return local_fn(NEQ, t, y, ydot, user_data);
+}
+
+/* Integrates to tf with the given number of sub-blocks */
+static int solve(int nsub, N_Vector y, long int* stats, SUNContext sunctx)
+{
+  sunrealtype t      = ZERO;
+  sunrealtype tf     = SUN_RCONST(0.1);
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+  int flag;
+
+  for (int k = 0; k < NCHAIN; k++)
+  {
+    for (int i = 0; i < NPTS; i++)
+    {
+      sunrealtype x       = (i + 1) * (ONE / (NPTS + 1));
+      ydata[k * NPTS + i] = (k + 1) * x * (ONE - x);
+    }
+  }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, t, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, RTOL, ATOL);
+  if (flag) { return 1; }
+
+  LS = SUNLinSol_SPGMR(y, SUN_PREC_LEFT, 0, sunctx);
+  if (!LS) { return 1; }
+
+  flag = CVodeSetLinearSolver(cvode_mem, LS, NULL);
+  if (flag) { return 1; }
+
+  flag = CVBBDPrecInit(cvode_mem, NEQ, 1, 1, 1, 1, ZERO, local_fn, NULL);
+  if (flag) { return 1; }
+
+  flag = CVBBDPrecSetNumSubBlocks(cvode_mem, nsub);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, tf, y, &t, CV_NORMAL);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumSteps(cvode_mem, &stats[0]);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumLinIters(cvode_mem, &stats[1]);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumPrecEvals(cvode_mem, &stats[2]);
+  if (flag) { return 1; }
+
+  flag = CVBBDPrecGetNumGfnEvals(cvode_mem, &stats[3]);
+  if (flag) { return 1; }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx     = NULL;
+  N_Vector yref         = NULL;
+  N_Vector y            = NULL;
+  N_Vector tmp          = NULL;
+  long int stats_ref[4] = {0, 0, 0, 0};
+  int fails             = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  yref = N_VNew_Serial(NEQ, sunctx);
+  y    = N_VNew_Serial(NEQ, sunctx);
+  tmp  = N_VNew_Serial(NEQ, sunctx);
+  if (!yref || !y || !tmp)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  if (solve(1, yref, stats_ref, sunctx))
+  {
+    fprintf(stderr, "FAIL: solve with 1 sub-block\n");
+    return 1;
+  }
+
+  printf("1 sub-block: nst = %ld, nli = %ld, npe = %ld, nge = %ld\n",
+         stats_ref[0], stats_ref[1], stats_ref[2], stats_ref[3]);
+
+  /* NCHAIN sub-blocks match the chains, 2 and 4 sub-blocks split a chain */
+  for (int nsub = 2; nsub <= 4; nsub++)
+  {
+    long int stats[4] = {0, 0, 0, 0};
+    sunrealtype err;
+
+    if (solve(nsub, y, stats, sunctx))
+    {
+      fprintf(stderr, "FAIL: solve with %d sub-blocks\n", nsub);
+      fails++;
+      continue;
+    }
+
+    /* difference relative to the tolerances */
+    N_VAbs(yref, tmp);
+    N_VScale(RTOL, tmp, tmp);
+    N_VAddConst(tmp, ATOL, tmp);
+    N_VInv(tmp, tmp);
+    N_VLinearSum(ONE, y, -ONE, yref, y);
+    N_VProd(y, tmp, y);
+    err = N_VMaxNorm(y);
+
+    printf("%d sub-blocks: nst = %ld, nli = %ld, npe = %ld, nge = %ld, "
+           "difference = %" GSYM "\n",
+           nsub, stats[0], stats[1], stats[2], stats[3], err);
+
+    if (nsub == NCHAIN)
+    {
+      for (int i = 0; i < 4; i++)
+      {
+        if (stats[i] != stats_ref[i]) { err = ONE; }
+      }
+      if (err != ZERO)
+      {
+        fprintf(stderr, "FAIL: %d sub-blocks do not match 1 sub-block\n",
+                nsub);
+        fails++;
+      }
+    }
+    /* the global error may exceed the local tolerances by a small factor */
+    else if (err > SUN_RCONST(10.0))
+    {
+      fprintf(stderr, "FAIL: %d sub-blocks solution is not accurate\n", nsub);
+      fails++;
+    }
+  }
+
+  N_VDestroy(yref);
+  N_VDestroy(y);
+  N_VDestroy(tmp);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
@@ -0,0 +1,213 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the Broyden updates of the Newton matrix. The Robertson
+ * chemical kinetics problem
+ *
+ *   y0' = -0.04 y0 + 1e4 y1 y2
+ *   y1' =  0.04 y0 - 1e4 y1 y2 - 3e7 y1^2
+ *   y2' =  3e7 y1^2
+ *
+ * is integrated with and without Broyden updates between linear solver
+ * setups. With the updates enabled the integrator must apply updates and the
+ * solution must agree with a reference solution to within the tolerances. The
+ * updates must not be applied when they are disabled.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NEQ  3
+#define RTOL SUN_RCONST(1.0e-4)
+#define ATOL SUN_RCONST(1.0e-8)
+#define TF   SUN_RCONST(4.0e5)
+
+/* maximum number of Broyden updates between setups */
+#define MAXUPD 3
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = SUN_RCONST(-0.04) * yd[0] + SUN_RCONST(1.0e4) * yd[1] * yd[2];
+  fd[2] = SUN_RCONST(3.0e7) * yd[1] * yd[1];
+  fd[1] = -fd[0] - fd[2];
+
+  return 0;
+}
+
+/* Integrates to TF with the given tolerance scale and number of updates */
+static int solve(sunrealtype tol_scale, int maxupd, N_Vector y, long int* nni,
+                 long int* nbroy, SUNContext sunctx)
+{
+  sunrealtype t      = SUN_RCONST(0.0);
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+  int flag;
+
+  ydata[0] = SUN_RCONST(1.0);
+  ydata[1] = SUN_RCONST(0.0);
+  ydata[2] = SUN_RCONST(0.0);
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, t, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, tol_scale * RTOL, tol_scale * ATOL);
+  if (flag) { return 1; }
+
+  flag = CVodeSetMaxNumSteps(cvode_mem, 100000);
+  if (flag) { return 1; }
+
+  A = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = CVodeSetMaxBroydenUpdates(cvode_mem, maxupd);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, TF, y, &t, CV_NORMAL);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumNonlinSolvIters(cvode_mem, nni);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumBroydenUpdates(cvode_mem, nbroy);
+  if (flag) { return 1; }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+/* Returns the maximum error relative to the tolerances */
+static sunrealtype error_norm(N_Vector y, N_Vector yref, N_Vector tmp)
+{
+  N_VAbs(yref, tmp);
+  N_VScale(RTOL, tmp, tmp);
+  N_VAddConst(tmp, ATOL, tmp);
+  N_VInv(tmp, tmp);
+  N_VLinearSum(SUN_RCONST(1.0), y, SUN_RCONST(-1.0), yref, y);
+  N_VProd(y, tmp, y);
+  return N_VMaxNorm(y);
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector yref     = NULL;
+  N_Vector y        = NULL;
+  N_Vector tmp      = NULL;
+  long int nni[2]   = {0, 0};
+  long int nbroy[2] = {0, 0};
+  sunrealtype err[2];
+  int fails = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  yref = N_VNew_Serial(NEQ, sunctx);
+  y    = N_VNew_Serial(NEQ, sunctx);
+  tmp  = N_VNew_Serial(NEQ, sunctx);
+  if (!yref || !y || !tmp)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  /* reference solution with tighter tolerances */
+  if (solve(SUN_RCONST(1.0e-4), 0, yref, &nni[0], &nbroy[0], sunctx))
+  {
+    fprintf(stderr, "FAIL: reference solve\n");
+    return 1;
+  }
+
+  for (int k = 0; k < 2; k++)
+  {
+    int maxupd = (k == 0) ? 0 : MAXUPD;
+
+    if (solve(SUN_RCONST(1.0), maxupd, y, &nni[k], &nbroy[k], sunctx))
+    {
+      fprintf(stderr, "FAIL: solve with maxupd = %d\n", maxupd);
+      fails++;
+      continue;
+    }
+
+    err[k] = error_norm(y, yref, tmp);
+
+    printf("maxupd = %d: nni = %ld, nbroy = %ld, error = %" GSYM "\n", maxupd,
+           nni[k], nbroy[k], err[k]);
+
+    /* the global error may exceed the local tolerances by a small factor */
+    if (err[k] > SUN_RCONST(10.0))
+    {
+      fprintf(stderr, "FAIL: solution with maxupd = %d is not accurate\n",
+              maxupd);
+      fails++;
+    }
+  }
+
+  if (!fails)
+  {
+    if (nbroy[0] != 0)
+    {
+      fprintf(stderr, "FAIL: updates applied when disabled\n");
+      fails++;
+    }
+
+    if (nbroy[1] < 1 || nbroy[1] > nni[1])
+    {
+      fprintf(stderr, "FAIL: unexpected number of updates\n");
+      fails++;
+    }
+  }
+
+  N_VDestroy(yref);
+  N_VDestroy(y);
+  N_VDestroy(tmp);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
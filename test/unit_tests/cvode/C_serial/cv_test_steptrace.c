@@ -0,0 +1,181 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for recording step attempts with a SUNStepTrace. The per-attempt
+ * records are checked against the integrator counters for the stiff problem
+ *
+ *   y' = lambda (y - 1) + t,  y(0) = 0
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+static const sunrealtype lambda = SUN_RCONST(-1.0e4);
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* ydata  = N_VGetArrayPointer(y);
+  sunrealtype* yddata = N_VGetArrayPointer(ydot);
+  yddata[0]           = lambda * (ydata[0] - ONE) + t;
+  return 0;
+}
+
+static int check_flag(int flag, const char* funcname)
+{
+  if (flag)
+  {
+    fprintf(stderr, "%s returned %i\n", funcname, flag);
+    return 1;
+  }
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int flag              = 0;
+  SUNContext sunctx     = NULL;
+  N_Vector y            = NULL;
+  SUNMatrix A           = NULL;
+  SUNLinearSolver LS    = NULL;
+  SUNStepTrace trace    = NULL;
+  void* cvode_mem       = NULL;
+  FILE* fp              = NULL;
+  sunrealtype tret      = ZERO;
+  sunrealtype* time     = NULL;
+  long int* status      = NULL;
+  long int* nls_iters   = NULL;
+  long int* jac_evals   = NULL;
+  long int nrec         = 0;
+  long int ndrop        = 0;
+  long int nst          = 0;
+  long int netf         = 0;
+  long int ncfn         = 0;
+  long int nni          = 0;
+  long int nje          = 0;
+  long int i            = 0;
+  long int sum_success  = 0;
+  long int sum_nls      = 0;
+  long int sum_jac      = 0;
+  const long int nstore = 10000;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (check_flag(flag, "SUNContext_Create")) { return 1; }
+
+  y = N_VNew_Serial(1, sunctx);
+  if (!y) { return 1; }
+  N_VConst(ZERO, y);
+
+  A = SUNDenseMatrix(1, 1, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  flag = SUNStepTrace_Create(nstore, sunctx, &trace);
+  if (check_flag(flag, "SUNStepTrace_Create")) { return 1; }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, f, ZERO, y);
+  if (check_flag(flag, "CVodeInit")) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10));
+  if (check_flag(flag, "CVodeSStolerances")) { return 1; }
+
+  flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (check_flag(flag, "CVodeSetLinearSolver")) { return 1; }
+
+  flag = CVodeSetStepTrace(cvode_mem, trace);
+  if (check_flag(flag, "CVodeSetStepTrace")) { return 1; }
+
+  flag = CVode(cvode_mem, SUN_RCONST(10.0), y, &tret, CV_NORMAL);
+  if (flag < 0)
+  {
+    fprintf(stderr, "CVode returned %i\n", flag);
+    return 1;
+  }
+
+  /* Compare the trace with the integrator counters */
+  flag = CVodeGetNumSteps(cvode_mem, &nst);
+  flag += CVodeGetNumErrTestFails(cvode_mem, &netf);
+  flag += CVodeGetNumStepSolveFails(cvode_mem, &ncfn);
+  flag += CVodeGetNumNonlinSolvIters(cvode_mem, &nni);
+  flag += CVodeGetNumJacEvals(cvode_mem, &nje);
+  if (check_flag(flag, "CVodeGet*")) { return 1; }
+
+  flag = SUNStepTrace_GetNumRecords(trace, &nrec);
+  flag += SUNStepTrace_GetNumDropped(trace, &ndrop);
+  flag += SUNStepTrace_GetRealField(trace, SUN_STEPTRACE_TIME, &time);
+  flag += SUNStepTrace_GetLongField(trace, SUN_STEPTRACE_STATUS, &status);
+  flag += SUNStepTrace_GetLongField(trace, SUN_STEPTRACE_NLS_ITERS, &nls_iters);
+  flag += SUNStepTrace_GetLongField(trace, SUN_STEPTRACE_JAC_EVALS, &jac_evals);
+  if (check_flag(flag, "SUNStepTrace_Get*")) { return 1; }
+
+  if (ndrop != 0 || nrec != nst + netf + ncfn)
+  {
+    fprintf(stderr, "records = %ld, dropped = %ld, expected %ld attempts\n",
+            nrec, ndrop, nst + netf + ncfn);
+    return 1;
+  }
+
+  for (i = 0; i < nrec; i++)
+  {
+    if (status[i] == SUN_STEPTRACE_SUCCESS) { sum_success++; }
+    sum_nls += nls_iters[i];
+    sum_jac += jac_evals[i];
+    if (i > 0 && time[i] < time[i - 1])
+    {
+      fprintf(stderr, "record %ld: time decreased\n", i);
+      return 1;
+    }
+  }
+
+  if (sum_success != nst || sum_nls != nni || sum_jac != nje)
+  {
+    fprintf(stderr,
+            "trace totals (steps %ld, nni %ld, nje %ld) do not match "
+            "counters (steps %ld, nni %ld, nje %ld)\n",
+            sum_success, sum_nls, sum_jac, nst, nni, nje);
+    return 1;
+  }
+
+  /* Exercise the writers */
+  fp = tmpfile();
+  if (!fp) { return 1; }
+  flag = SUNStepTrace_Write(trace, fp, SUN_OUTPUTFORMAT_CSV);
+  flag += SUNStepTrace_WriteBinary(trace, fp);
+  fclose(fp);
+  if (check_flag(flag, "SUNStepTrace_Write*")) { return 1; }
+
+  /* Clean up */
+  CVodeFree(&cvode_mem);
+  SUNStepTrace_Destroy(&trace);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,226 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the SUNContext object arena with forward sensitivity analysis.
+ * The stiff reaction-diffusion system
+ *
+ *   y_i' = (y_{i-1} - 2 y_i + y_{i+1}) / dx^2 - p y_i^2,  i = 0, ..., N - 1
+ *
+ * with homogeneous Dirichlet boundaries is integrated together with the
+ * sensitivity with respect to p, using the simultaneous and the staggered
+ * corrector, once with a context without an arena and once with a context
+ * with the arena enabled. The sensitivity correctors use wrapper vectors that
+ * are created and cloned from the arena. The solutions, sensitivities, and
+ * step counts must match exactly, all objects must be placed in the arena,
+ * and the arena must be empty after the objects are destroyed.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvodes/cvodes.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NEQ 23
+#define ONE SUN_RCONST(1.0)
+#define TWO SUN_RCONST(2.0)
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* p         = (sunrealtype*)user_data;
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunrealtype dx         = ONE / (NEQ + 1);
+  sunrealtype c          = ONE / (dx * dx);
+
+  for (int i = 0; i < NEQ; i++)
+  {
+    sunrealtype yl = (i > 0) ? y_data[i - 1] : SUN_RCONST(0.0);
+    sunrealtype yr = (i < NEQ - 1) ? y_data[i + 1] : SUN_RCONST(0.0);
+    ydot_data[i]   = c * (yl - TWO * y_data[i] + yr) -
+                   p[0] * y_data[i] * y_data[i];
+  }
+
+  return 0;
+}
+
+/* Integrates to tf in a new context and copies the solution and sensitivity
+   to yout. The arena statistics are returned after the setup (nlive_setup)
+   and after all objects are destroyed (nlive_end, nblocks_end). */
+static int solve(int ism, sunbooleantype arena, sunrealtype* yout,
+                 long int* nst, long int* nlive_setup, long int* nlive_end,
+                 long int* nblocks_end)
+{
+  sunrealtype t      = SUN_RCONST(0.0);
+  sunrealtype tf     = SUN_RCONST(0.1);
+  sunrealtype p[1]   = {ONE};
+  SUNContext sunctx  = NULL;
+  N_Vector y         = NULL;
+  N_Vector* yS       = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+  sunrealtype* ydata;
+  sunrealtype* ySdata;
+  int flag;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+  if (SUNContext_SetArena(sunctx, arena)) { return 1; }
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y) { return 1; }
+
+  ydata = N_VGetArrayPointer(y);
+  for (int i = 0; i < NEQ; i++)
+  {
+    sunrealtype x = (i + 1) * (ONE / (NEQ + 1));
+    ydata[i]      = SUN_RCONST(4.0) * x * (ONE - x);
+  }
+
+  yS = N_VCloneVectorArray(1, y);
+  if (!yS) { return 1; }
+  N_VConst(SUN_RCONST(0.0), yS[0]);
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, t, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSetUserData(cvode_mem, p);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  A = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (flag) { return 1; }
+
+  /* difference quotient sensitivity right-hand side */
+  flag = CVodeSensInit1(cvode_mem, 1, ism, NULL, yS);
+  if (flag) { return 1; }
+
+  flag = CVodeSensEEtolerances(cvode_mem);
+  if (flag) { return 1; }
+
+  flag = CVodeSetSensParams(cvode_mem, p, NULL, NULL);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, tf, y, &t, CV_NORMAL);
+  if (flag) { return 1; }
+
+  flag = CVodeGetSens(cvode_mem, &t, yS);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumSteps(cvode_mem, nst);
+  if (flag) { return 1; }
+
+  ySdata = N_VGetArrayPointer(yS[0]);
+  for (int i = 0; i < NEQ; i++)
+  {
+    yout[i]       = ydata[i];
+    yout[NEQ + i] = ySdata[i];
+  }
+
+  SUNContext_GetArenaStats(sunctx, NULL, nlive_setup, NULL);
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroyVectorArray(yS, 1);
+  N_VDestroy(y);
+
+  SUNContext_GetArenaStats(sunctx, nblocks_end, nlive_end, NULL);
+  SUNContext_Free(&sunctx);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  const int isms[]        = {CV_SIMULTANEOUS, CV_STAGGERED};
+  const char* ism_names[] = {"simultaneous", "staggered"};
+  sunrealtype yref[2 * NEQ];
+  sunrealtype y[2 * NEQ];
+  int fails = 0;
+
+  for (int m = 0; m < 2; m++)
+  {
+    long int nst_ref, nst, nlive_setup, nlive_end, nblocks_end;
+    sunrealtype diff = SUN_RCONST(0.0);
+
+    if (solve(isms[m], SUNFALSE, yref, &nst_ref, &nlive_setup, &nlive_end,
+              &nblocks_end) ||
+        nlive_setup != 0 || nblocks_end != 0)
+    {
+      fprintf(stderr, "FAIL: %s solve without arena\n", ism_names[m]);
+      fails++;
+      continue;
+    }
+
+    if (solve(isms[m], SUNTRUE, y, &nst, &nlive_setup, &nlive_end,
+              &nblocks_end))
+    {
+      fprintf(stderr, "FAIL: %s solve with arena\n", ism_names[m]);
+      fails++;
+      continue;
+    }
+
+    for (int i = 0; i < 2 * NEQ; i++)
+    {
+      diff = SUNMAX(diff, SUNRabs(y[i] - yref[i]));
+    }
+
+    printf("%s: nst = %ld (%ld), difference = %" GSYM ", arena allocations "
+           "= %ld, after free = %ld, blocks = %ld\n",
+           ism_names[m], nst, nst_ref, diff, nlive_setup, nlive_end,
+           nblocks_end);
+
+    if (nst != nst_ref || diff != SUN_RCONST(0.0))
+    {
+      fprintf(stderr, "FAIL: %s with arena does not match\n", ism_names[m]);
+      fails++;
+    }
+
+    /* the vectors, wrapper vectors, matrix, solvers, and integrator are in
+       the arena and the arena is rewound (one block kept) once they are
+       destroyed */
+    if (nlive_setup < 10 || nlive_end != 0 || nblocks_end != 1)
+    {
+      fprintf(stderr, "FAIL: %s unexpected arena statistics\n", ism_names[m]);
+      fails++;
+    }
+  }
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
@@ -0,0 +1,205 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the contiguous Nordsieck history storage. The Robertson
+ * chemical kinetics problem
+ *
+ *   y0' = -0.04 y0 + 1e4 y1 y2
+ *   y1' =  0.04 y0 - 1e4 y1 y2 - 3e7 y1^2
+ *   y2' =  3e7 y1^2
+ *
+ * is integrated to T1, reinitialized with the solution at T1, and integrated
+ * to T2. The contiguous storage is enabled or disabled after CVodeInit, in the
+ * middle of the first integration, and after CVodeReInit. The storage layout
+ * must not change the results, so the solutions and the number of steps must
+ * be bitwise identical to a run that does not set the option.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cvodes/cvodes.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define NEQ  3
+#define RTOL SUN_RCONST(1.0e-6)
+#define ATOL SUN_RCONST(1.0e-10)
+#define TMID SUN_RCONST(4.0e-1)
+#define T1   SUN_RCONST(4.0e1)
+#define T2   SUN_RCONST(4.0e5)
+
+/* option settings after CVodeInit, at TMID, and after CVodeReInit */
+#define NRUNS 4
+static const int settings[NRUNS][3] = {{-1, -1, -1},
+                                       {1, 1, 1},
+                                       {1, 0, 1},
+                                       {0, 1, 0}};
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = SUN_RCONST(-0.04) * yd[0] + SUN_RCONST(1.0e4) * yd[1] * yd[2];
+  fd[2] = SUN_RCONST(3.0e7) * yd[1] * yd[1];
+  fd[1] = -fd[0] - fd[2];
+
+  return 0;
+}
+
+/* Sets the option unless the setting is negative */
+static int set_contiguous(void* cvode_mem, int setting)
+{
+  if (setting < 0) { return 0; }
+  return CVodeSetContiguousHistory(cvode_mem, setting ? SUNTRUE : SUNFALSE);
+}
+
+/* Integrates with the given option settings, returns the solutions at T1 and
+   T2 and the number of steps */
+static int solve(const int* setting, N_Vector y1, N_Vector y2, long int* nst,
+                 SUNContext sunctx)
+{
+  sunrealtype t      = SUN_RCONST(0.0);
+  sunrealtype* ydata = N_VGetArrayPointer(y1);
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+  int flag;
+
+  ydata[0] = SUN_RCONST(1.0);
+  ydata[1] = SUN_RCONST(0.0);
+  ydata[2] = SUN_RCONST(0.0);
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, t, y1);
+  if (flag) { return 1; }
+
+  flag = set_contiguous(cvode_mem, setting[0]);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, RTOL, ATOL);
+  if (flag) { return 1; }
+
+  flag = CVodeSetMaxNumSteps(cvode_mem, 100000);
+  if (flag) { return 1; }
+
+  A = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y1, A, sunctx);
+  if (!LS) { return 1; }
+
+  flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, TMID, y1, &t, CV_NORMAL);
+  if (flag) { return 1; }
+
+  flag = set_contiguous(cvode_mem, setting[1]);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, T1, y1, &t, CV_NORMAL);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumSteps(cvode_mem, &nst[0]);
+  if (flag) { return 1; }
+
+  flag = CVodeReInit(cvode_mem, t, y1);
+  if (flag) { return 1; }
+
+  flag = set_contiguous(cvode_mem, setting[2]);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, T2, y2, &t, CV_NORMAL);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumSteps(cvode_mem, &nst[1]);
+  if (flag) { return 1; }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx  = NULL;
+  N_Vector y1[NRUNS] = {NULL};
+  N_Vector y2[NRUNS] = {NULL};
+  long int nst[NRUNS][2];
+  int fails = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  for (int run = 0; run < NRUNS; run++)
+  {
+    y1[run] = N_VNew_Serial(NEQ, sunctx);
+    y2[run] = N_VNew_Serial(NEQ, sunctx);
+    if (!y1[run] || !y2[run])
+    {
+      fprintf(stderr, "N_VNew_Serial returned NULL\n");
+      return 1;
+    }
+
+    if (solve(settings[run], y1[run], y2[run], nst[run], sunctx))
+    {
+      fprintf(stderr, "FAIL: solve with settings %d %d %d\n", settings[run][0],
+              settings[run][1], settings[run][2]);
+      return 1;
+    }
+
+    printf("settings %2d %2d %2d: nst = %ld, %ld\n", settings[run][0],
+           settings[run][1], settings[run][2], nst[run][0], nst[run][1]);
+  }
+
+  /* compare to the run that does not set the option */
+  for (int run = 1; run < NRUNS; run++)
+  {
+    if (nst[run][0] != nst[0][0] || nst[run][1] != nst[0][1] ||
+        memcmp(N_VGetArrayPointer(y1[run]), N_VGetArrayPointer(y1[0]),
+               NEQ * sizeof(sunrealtype)) ||
+        memcmp(N_VGetArrayPointer(y2[run]), N_VGetArrayPointer(y2[0]),
+               NEQ * sizeof(sunrealtype)))
+    {
+      fprintf(stderr, "FAIL: settings %d %d %d do not match\n",
+              settings[run][0], settings[run][1], settings[run][2]);
+      fails++;
+    }
+  }
+
+  for (int run = 0; run < NRUNS; run++)
+  {
+    N_VDestroy(y1[run]);
+    N_VDestroy(y2[run]);
+  }
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
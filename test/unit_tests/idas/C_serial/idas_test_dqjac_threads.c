@@ -0,0 +1,209 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the threaded difference quotient Jacobian. The stiff
+ * reaction-diffusion system
+ *
+ *   (1 + y_i^2) y_i' = (y_{i-1} - 2 y_i + y_{i+1}) / dx^2 - y_i^2,
+ *
+ * i = 0, ..., N - 1, with homogeneous Dirichlet boundaries is integrated with
+ * the internal dense and band DQ Jacobians. The residual depends nonlinearly
+ * on y and y' so the DQ Jacobian perturbs both. The solutions and the number
+ * of residual evaluations for the DQ Jacobian computed with several threads
+ * must match the serial ones exactly.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "idas/idas.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_band.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NEQ 23
+#define ONE SUN_RCONST(1.0)
+#define TWO SUN_RCONST(2.0)
+
+/* The right-hand side of the diffusion-reaction terms */
+static sunrealtype rhs(const sunrealtype* y, int i)
+{
+  sunrealtype dx = ONE / (NEQ + 1);
+  sunrealtype yl = (i > 0) ? y[i - 1] : SUN_RCONST(0.0);
+  sunrealtype yr = (i < NEQ - 1) ? y[i + 1] : SUN_RCONST(0.0);
+
+  return (yl - TWO * y[i] + yr) / (dx * dx) - y[i] * y[i];
+}
+
+/* The residual only accesses its arguments and is therefore reentrant */
+static int res(sunrealtype t, N_Vector y, N_Vector yp, N_Vector r,
+               void* user_data)
+{
+  sunrealtype* y_data  = N_VGetArrayPointer(y);
+  sunrealtype* yp_data = N_VGetArrayPointer(yp);
+  sunrealtype* r_data  = N_VGetArrayPointer(r);
+
+  for (int i = 0; i < NEQ; i++)
+  {
+    r_data[i] = (ONE + y_data[i] * y_data[i]) * yp_data[i] - rhs(y_data, i);
+  }
+
+  return 0;
+}
+
+/* Integrates to tf with the given matrix type and number of DQ threads */
+static int solve(int band, int nthreads, N_Vector y, long int* nreLS,
+                 SUNContext sunctx)
+{
+  sunrealtype t       = SUN_RCONST(0.0);
+  sunrealtype tf      = SUN_RCONST(0.1);
+  sunrealtype* ydata  = N_VGetArrayPointer(y);
+  sunrealtype* ypdata = NULL;
+  N_Vector yp         = NULL;
+  SUNMatrix A         = NULL;
+  SUNLinearSolver LS  = NULL;
+  void* ida_mem       = NULL;
+  int flag;
+
+  yp = N_VClone(y);
+  if (!yp) { return 1; }
+  ypdata = N_VGetArrayPointer(yp);
+
+  /* consistent initial conditions */
+  for (int i = 0; i < NEQ; i++)
+  {
+    sunrealtype x = (i + 1) * (ONE / (NEQ + 1));
+    ydata[i]      = SUN_RCONST(4.0) * x * (ONE - x);
+  }
+  for (int i = 0; i < NEQ; i++)
+  {
+    ypdata[i] = rhs(ydata, i) / (ONE + ydata[i] * ydata[i]);
+  }
+
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem) { return 1; }
+
+  flag = IDAInit(ida_mem, res, t, y, yp);
+  if (flag) { return 1; }
+
+  flag = IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  if (band) { A = SUNBandMatrix(NEQ, 1, 1, sunctx); }
+  else { A = SUNDenseMatrix(NEQ, NEQ, sunctx); }
+  if (!A) { return 1; }
+
+  if (band) { LS = SUNLinSol_Band(y, A, sunctx); }
+  else { LS = SUNLinSol_Dense(y, A, sunctx); }
+  if (!LS) { return 1; }
+
+  flag = IDASetLinearSolver(ida_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = IDASetDQJacNumThreads(ida_mem, nthreads);
+  if (flag) { return 1; }
+
+  flag = IDASolve(ida_mem, tf, &t, y, yp, IDA_NORMAL);
+  if (flag) { return 1; }
+
+  flag = IDAGetNumLinResEvals(ida_mem, nreLS);
+  if (flag) { return 1; }
+
+  IDAFree(&ida_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(yp);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector yref     = NULL;
+  N_Vector y        = NULL;
+  int fails         = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  yref = N_VNew_Serial(NEQ, sunctx);
+  y    = N_VNew_Serial(NEQ, sunctx);
+  if (!yref || !y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  for (int band = 0; band < 2; band++)
+  {
+    long int nreLS_ref = 0;
+
+    if (solve(band, 1, yref, &nreLS_ref, sunctx))
+    {
+      fprintf(stderr, "FAIL: %s serial solve\n", band ? "band" : "dense");
+      fails++;
+      continue;
+    }
+
+    /* more threads than band column groups leaves some threads idle */
+    for (int nthreads = 2; nthreads <= 4; nthreads++)
+    {
+      long int nreLS = 0;
+
+      if (solve(band, nthreads, y, &nreLS, sunctx))
+      {
+        fprintf(stderr, "FAIL: %s solve with %d threads\n",
+                band ? "band" : "dense", nthreads);
+        fails++;
+        continue;
+      }
+
+      N_VLinearSum(ONE, y, -ONE, yref, y);
+      sunrealtype diff = N_VMaxNorm(y);
+
+      printf("%s, %d threads: nreLS = %ld (%ld), difference = %" GSYM "\n",
+             band ? "band" : "dense", nthreads, nreLS, nreLS_ref, diff);
+
+      if (nreLS != nreLS_ref || diff != SUN_RCONST(0.0))
+      {
+        fprintf(stderr, "FAIL: %s with %d threads does not match serial\n",
+                band ? "band" : "dense", nthreads);
+        fails++;
+      }
+    }
+  }
+
+  N_VDestroy(yref);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
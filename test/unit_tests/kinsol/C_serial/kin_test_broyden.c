@@ -0,0 +1,209 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the Broyden updates of the Jacobian between setups. The
+ * nonlinear system
+ *
+ *   F_i(u) = u_i^3 + 2 u_i - (u_{i-1} + u_{i+1}) / 2 - (i + 1) / NEQ = 0
+ *
+ * is solved with a modified Newton iteration that rarely updates the Jacobian.
+ * With the updates enabled the solver must apply updates, converge to
+ * the same solution, and use fewer nonlinear iterations than without them.
+ * The updates must not be applied when they are disabled.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kinsol/kinsol.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NEQ    10
+#define FTOL   SUN_RCONST(1.0e-10)
+#define MAXUPD 5
+#define ZERO   SUN_RCONST(0.0)
+#define HALF   SUN_RCONST(0.5)
+#define ONE    SUN_RCONST(1.0)
+#define TWO    SUN_RCONST(2.0)
+
+static int F(N_Vector u, N_Vector r, void* user_data)
+{
+  sunrealtype* ud = N_VGetArrayPointer(u);
+  sunrealtype* rd = N_VGetArrayPointer(r);
+
+  for (int i = 0; i < NEQ; i++)
+  {
+    sunrealtype ul = (i > 0) ? ud[i - 1] : ZERO;
+    sunrealtype ur = (i < NEQ - 1) ? ud[i + 1] : ZERO;
+    rd[i] = ud[i] * ud[i] * ud[i] + TWO * ud[i] - HALF * (ul + ur) -
+            (sunrealtype)(i + 1) / NEQ;
+  }
+
+  return 0;
+}
+
+/* Solves the system with the given maximum number of updates */
+static int solve(int maxupd, N_Vector u, long int* nni, long int* nbroy,
+                 SUNContext sunctx)
+{
+  SUNMatrix J        = NULL;
+  SUNLinearSolver LS = NULL;
+  N_Vector scale     = NULL;
+  void* kinsol_mem   = NULL;
+  long int nje       = 0;
+  int flag;
+
+  N_VConst(ONE, u);
+
+  scale = N_VClone(u);
+  if (!scale) { return 1; }
+  N_VConst(ONE, scale);
+
+  kinsol_mem = KINCreate(sunctx);
+  if (!kinsol_mem) { return 1; }
+
+  flag = KINInit(kinsol_mem, F, u);
+  if (flag) { return 1; }
+
+  flag = KINSetFuncNormTol(kinsol_mem, FTOL);
+  if (flag) { return 1; }
+
+  flag = KINSetNumMaxIters(kinsol_mem, 100);
+  if (flag) { return 1; }
+
+  /* reuse the Jacobian for many iterations */
+  flag = KINSetMaxSetupCalls(kinsol_mem, 100);
+  if (flag) { return 1; }
+
+  J = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!J) { return 1; }
+
+  LS = SUNLinSol_Dense(u, J, sunctx);
+  if (!LS) { return 1; }
+
+  flag = KINSetLinearSolver(kinsol_mem, LS, J);
+  if (flag) { return 1; }
+
+  flag = KINSetMaxBroydenUpdates(kinsol_mem, maxupd);
+  if (flag) { return 1; }
+
+  flag = KINSol(kinsol_mem, u, KIN_NONE, scale, scale);
+  if (flag < 0) { return 1; }
+
+  flag = KINGetNumNonlinSolvIters(kinsol_mem, nni);
+  if (flag) { return 1; }
+
+  flag = KINGetNumBroydenUpdates(kinsol_mem, nbroy);
+  if (flag) { return 1; }
+
+  flag = KINGetNumJacEvals(kinsol_mem, &nje);
+  if (flag) { return 1; }
+
+  printf("maxupd = %d: nni = %ld, nje = %ld, nbroy = %ld\n", maxupd, *nni,
+         nje, *nbroy);
+
+  KINFree(&kinsol_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(J);
+  N_VDestroy(scale);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector uref     = NULL;
+  N_Vector u        = NULL;
+  long int nni[2]   = {0, 0};
+  long int nbroy[2] = {0, 0};
+  sunrealtype err;
+  int fails = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  uref = N_VNew_Serial(NEQ, sunctx);
+  u    = N_VNew_Serial(NEQ, sunctx);
+  if (!uref || !u)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  if (solve(0, uref, &nni[0], &nbroy[0], sunctx))
+  {
+    fprintf(stderr, "FAIL: solve without updates\n");
+    return 1;
+  }
+
+  if (solve(MAXUPD, u, &nni[1], &nbroy[1], sunctx))
+  {
+    fprintf(stderr, "FAIL: solve with updates\n");
+    return 1;
+  }
+
+  /* the system is diagonally dominant so the solution error is bounded by a
+     small multiple of the residual tolerance */
+  N_VLinearSum(ONE, u, -ONE, uref, u);
+  err = N_VMaxNorm(u);
+
+  printf("difference = %" GSYM "\n", err);
+
+  if (nbroy[0] != 0)
+  {
+    fprintf(stderr, "FAIL: updates applied when disabled\n");
+    fails++;
+  }
+
+  if (nbroy[1] < 1 || nbroy[1] > MAXUPD)
+  {
+    fprintf(stderr, "FAIL: unexpected number of updates\n");
+    fails++;
+  }
+
+  if (nni[1] >= nni[0])
+  {
+    fprintf(stderr, "FAIL: updates did not reduce the nonlinear iterations\n");
+    fails++;
+  }
+
+  if (err > SUN_RCONST(10.0) * FTOL)
+  {
+    fprintf(stderr, "FAIL: solution with updates does not match\n");
+    fails++;
+  }
+
+  N_VDestroy(uref);
+  N_VDestroy(u);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
@@ -0,0 +1,191 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the threaded difference quotient Jacobian. The nonlinear
+ * system
+ *
+ *   F_i(u) = u_i^3 + 2 u_i - (u_{i-1} + u_{i+1}) / 2 - (i + 1) / NEQ = 0
+ *
+ * is solved with Newton's method and the internal dense and band DQ
+ * Jacobians. The solutions and the number of function evaluations for the DQ
+ * Jacobian computed with several threads must match the serial ones exactly.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kinsol/kinsol.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_band.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NEQ  23
+#define ZERO SUN_RCONST(0.0)
+#define HALF SUN_RCONST(0.5)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+
+/* The function only accesses its arguments and is therefore reentrant */
+static int F(N_Vector u, N_Vector r, void* user_data)
+{
+  sunrealtype* ud = N_VGetArrayPointer(u);
+  sunrealtype* rd = N_VGetArrayPointer(r);
+
+  for (int i = 0; i < NEQ; i++)
+  {
+    sunrealtype ul = (i > 0) ? ud[i - 1] : ZERO;
+    sunrealtype ur = (i < NEQ - 1) ? ud[i + 1] : ZERO;
+    rd[i] = ud[i] * ud[i] * ud[i] + TWO * ud[i] - HALF * (ul + ur) -
+            (sunrealtype)(i + 1) / NEQ;
+  }
+
+  return 0;
+}
+
+/* Solves the system with the given matrix type and number of DQ threads */
+static int solve(int band, int nthreads, N_Vector u, long int* nfeLS,
+                 SUNContext sunctx)
+{
+  SUNMatrix J        = NULL;
+  SUNLinearSolver LS = NULL;
+  N_Vector scale     = NULL;
+  void* kinsol_mem   = NULL;
+  int flag;
+
+  N_VConst(ONE, u);
+
+  scale = N_VClone(u);
+  if (!scale) { return 1; }
+  N_VConst(ONE, scale);
+
+  kinsol_mem = KINCreate(sunctx);
+  if (!kinsol_mem) { return 1; }
+
+  flag = KINInit(kinsol_mem, F, u);
+  if (flag) { return 1; }
+
+  flag = KINSetFuncNormTol(kinsol_mem, SUN_RCONST(1.0e-10));
+  if (flag) { return 1; }
+
+  /* update the Jacobian every iteration */
+  flag = KINSetMaxSetupCalls(kinsol_mem, 1);
+  if (flag) { return 1; }
+
+  if (band) { J = SUNBandMatrix(NEQ, 1, 1, sunctx); }
+  else { J = SUNDenseMatrix(NEQ, NEQ, sunctx); }
+  if (!J) { return 1; }
+
+  if (band) { LS = SUNLinSol_Band(u, J, sunctx); }
+  else { LS = SUNLinSol_Dense(u, J, sunctx); }
+  if (!LS) { return 1; }
+
+  flag = KINSetLinearSolver(kinsol_mem, LS, J);
+  if (flag) { return 1; }
+
+  flag = KINSetDQJacNumThreads(kinsol_mem, nthreads);
+  if (flag) { return 1; }
+
+  flag = KINSol(kinsol_mem, u, KIN_NONE, scale, scale);
+  if (flag < 0) { return 1; }
+
+  flag = KINGetNumLinFuncEvals(kinsol_mem, nfeLS);
+  if (flag) { return 1; }
+
+  KINFree(&kinsol_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(J);
+  N_VDestroy(scale);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector uref     = NULL;
+  N_Vector u        = NULL;
+  int fails         = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  uref = N_VNew_Serial(NEQ, sunctx);
+  u    = N_VNew_Serial(NEQ, sunctx);
+  if (!uref || !u)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  for (int band = 0; band < 2; band++)
+  {
+    long int nfeLS_ref = 0;
+
+    if (solve(band, 1, uref, &nfeLS_ref, sunctx))
+    {
+      fprintf(stderr, "FAIL: %s serial solve\n", band ? "band" : "dense");
+      fails++;
+      continue;
+    }
+
+    /* more threads than band column groups leaves some threads idle */
+    for (int nthreads = 2; nthreads <= 4; nthreads++)
+    {
+      long int nfeLS = 0;
+
+      if (solve(band, nthreads, u, &nfeLS, sunctx))
+      {
+        fprintf(stderr, "FAIL: %s solve with %d threads\n",
+                band ? "band" : "dense", nthreads);
+        fails++;
+        continue;
+      }
+
+      N_VLinearSum(ONE, u, -ONE, uref, u);
+      sunrealtype diff = N_VMaxNorm(u);
+
+      printf("%s, %d threads: nfeLS = %ld (%ld), difference = %" GSYM "\n",
+             band ? "band" : "dense", nthreads, nfeLS, nfeLS_ref, diff);
+
+      if (nfeLS != nfeLS_ref || diff != ZERO)
+      {
+        fprintf(stderr, "FAIL: %s with %d threads does not match serial\n",
+                band ? "band" : "dense", nthreads);
+        fails++;
+      }
+    }
+  }
+
+  N_VDestroy(uref);
+  N_VDestroy(u);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
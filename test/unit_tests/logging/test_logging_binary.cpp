@@ -0,0 +1,177 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Test the binary logger output. The same messages are written to a binary log
+ * (from several threads when OpenMP is available) and to a text log. Messages
+ * are also written to a binary log set with the SUNLOGGER_BINARY_FILENAME
+ * environment variable. The test_logging_binary.py script decodes the binary
+ * files and compares them to the text output.
+ * ---------------------------------------------------------------------------*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "sundials/sundials_context.hpp"
+#include "sundials/sundials_errors.h"
+#include "sundials/sundials_logger.h"
+
+#include "utilities/check_return.hpp"
+
+using namespace std;
+
+// Number of threads and messages per thread
+#define NTHREADS 4
+#define NMSG     200
+
+// Writes the messages for one thread
+static int log_messages(SUNLogger logger, int thread)
+{
+  for (int i = 0; i < NMSG; i++)
+  {
+    SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_WARNING, "log_messages", "thread",
+                       "thread = %d, msg = %ld, value = %.6e, name = %s",
+                       thread, static_cast<long>(i), 0.5 * i + thread,
+                       (i % 2) ? "odd" : "even");
+    if (i % 50 == 0)
+    {
+      SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "log_messages",
+                         "checkpoint", "thread = %d, %5.1f%% done", thread,
+                         100.0 * i / NMSG);
+    }
+  }
+  return 0;
+}
+
+// Checks that a file starts with the binary log magic string
+static int check_header(const string& filename)
+{
+  char magic[8] = {0};
+
+  FILE* fp = fopen(filename.c_str(), "rb");
+  if (check_ptr(fp, "fopen")) { return 1; }
+  size_t nread = fread(magic, 1, sizeof(magic), fp);
+  fclose(fp);
+
+  if (nread != sizeof(magic) || strcmp(magic, "SUNLOGB"))
+  {
+    cerr << "ERROR: " << filename << " is not a binary log file" << endl;
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  cout << "Start binary logging test" << endl;
+
+  // Directory for the output files
+  string outdir = ".";
+  if (argc > 1) { outdir = argv[1]; }
+
+  const string binary_file = outdir + "/test_logging_binary.bin";
+  const string text_file   = outdir + "/test_logging_binary.txt";
+  const string env_file    = outdir + "/test_logging_binary_env.bin";
+
+  // ---------------------------------------------------------------
+  // Binary output set with SUNLogger_SetBinaryFilename, a small
+  // buffer is used so it is written to the file several times
+  // ---------------------------------------------------------------
+
+  SUNLogger logger = nullptr;
+  int flag         = SUNLogger_Create(SUN_COMM_NULL, 0, &logger);
+  if (check_flag(flag, "SUNLogger_Create")) { return 1; }
+
+  flag = SUNLogger_SetBinaryFilename(logger, binary_file.c_str(), 256);
+  if (check_flag(flag, "SUNLogger_SetBinaryFilename")) { return 1; }
+
+  // A second binary file can not be set
+  flag = SUNLogger_SetBinaryFilename(logger, binary_file.c_str(), 0);
+  if (flag != SUN_ERR_ARG_INCOMPATIBLE)
+  {
+    cerr << "ERROR: SUNLogger_SetBinaryFilename did not fail" << endl;
+    return 1;
+  }
+
+  int nthreads = 1;
+#ifdef _OPENMP
+  nthreads = NTHREADS;
+#pragma omp parallel for num_threads(NTHREADS) schedule(static, 1)
+#endif
+  for (int thread = 0; thread < nthreads; thread++)
+  {
+    log_messages(logger, thread);
+  }
+
+  flag = SUNLogger_Flush(logger, SUN_LOGLEVEL_ALL);
+  if (check_flag(flag, "SUNLogger_Flush")) { return 1; }
+
+  flag = SUNLogger_Destroy(&logger);
+  if (check_flag(flag, "SUNLogger_Destroy")) { return 1; }
+
+  if (check_header(binary_file)) { return 1; }
+
+  // ---------------------------------------------------------------
+  // The same messages written serially to a text file
+  // ---------------------------------------------------------------
+
+  flag = SUNLogger_Create(SUN_COMM_NULL, 0, &logger);
+  if (check_flag(flag, "SUNLogger_Create")) { return 1; }
+
+  flag = SUNLogger_SetInfoFilename(logger, text_file.c_str());
+  if (check_flag(flag, "SUNLogger_SetInfoFilename")) { return 1; }
+
+  flag = SUNLogger_SetWarningFilename(logger, text_file.c_str());
+  if (check_flag(flag, "SUNLogger_SetWarningFilename")) { return 1; }
+
+  for (int thread = 0; thread < nthreads; thread++)
+  {
+    log_messages(logger, thread);
+  }
+
+  flag = SUNLogger_Destroy(&logger);
+  if (check_flag(flag, "SUNLogger_Destroy")) { return 1; }
+
+  // ---------------------------------------------------------------
+  // Binary output set with the environment variable
+  // ---------------------------------------------------------------
+
+#ifdef _WIN32
+  flag = _putenv_s("SUNLOGGER_BINARY_FILENAME", env_file.c_str());
+#else
+  flag = setenv("SUNLOGGER_BINARY_FILENAME", env_file.c_str(), 1);
+#endif
+  if (check_flag(flag, "setenv")) { return 1; }
+
+  {
+    sundials::Context sunctx;
+
+    flag = SUNContext_GetLogger(sunctx, &logger);
+    if (check_flag(flag, "SUNContext_GetLogger")) { return 1; }
+
+    SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_WARNING, "main", "env",
+                       "written with %s", "SUNLOGGER_BINARY_FILENAME");
+  }
+
+  if (check_header(env_file)) { return 1; }
+
+  cout << "End binary logging test" << endl;
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# SUNDIALS Copyright Start
+# Copyright (c) 2002-2025, Lawrence Livermore National Security
+# and Southern Methodist University.
+# All rights reserved.
+#
+# See the top-level LICENSE and NOTICE files for details.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# SUNDIALS Copyright End
+# -----------------------------------------------------------------------------
+# Decode the binary logs written by test_logging_binary with the suntools
+# decode_binary_log function and the tools/log_decode.py script and compare the
+# decoded messages to the text log.
+# -----------------------------------------------------------------------------
+
+import os
+import subprocess
+import sys
+
+# return code to mark the test as skipped
+SKIP_RETURN_CODE = 77
+
+
+def main():
+
+    import argparse
+
+    parser = argparse.ArgumentParser(description="Test binary log decoding")
+
+    parser.add_argument("tooldir", type=str, help="Path to the tools directory")
+
+    parser.add_argument("outdir", type=str, help="Directory with the log files")
+
+    args = parser.parse_args()
+
+    sys.path.insert(0, args.tooldir)
+    try:
+        from suntools import logs as sunlog
+    except ImportError as err:
+        print(f"SKIPPED: could not import suntools ({err})")
+        return SKIP_RETURN_CODE
+
+    binary_file = os.path.join(args.outdir, "test_logging_binary.bin")
+    text_file = os.path.join(args.outdir, "test_logging_binary.txt")
+    env_file = os.path.join(args.outdir, "test_logging_binary_env.bin")
+    decoded_file = os.path.join(args.outdir, "test_logging_binary_decoded.txt")
+
+    with open(text_file, "r") as logfile:
+        text_lines = logfile.read().splitlines()
+
+    # messages from different threads may be in any order
+    fails = 0
+    lines = sunlog.decode_binary_log(binary_file)
+    if not sunlog.is_binary_log(binary_file):
+        print(f"FAIL: {binary_file} is not recognized as a binary log")
+        fails += 1
+    if sorted(lines) != sorted(text_lines):
+        print("FAIL: decode_binary_log output does not match the text log")
+        fails += 1
+
+    # messages from one thread must be in order
+    for thread in range(4):
+        tag = f"[thread] thread = {thread},"
+        if [l for l in lines if tag in l] != [l for l in text_lines if tag in l]:
+            print(f"FAIL: messages from thread {thread} are out of order")
+            fails += 1
+
+    # decode with the script
+    env = dict(os.environ)
+    env["PYTHONPATH"] = os.pathsep.join(
+        [args.tooldir] + [p for p in [env.get("PYTHONPATH")] if p]
+    )
+    subprocess.run(
+        [
+            sys.executable,
+            os.path.join(args.tooldir, "log_decode.py"),
+            binary_file,
+            "--output",
+            decoded_file,
+        ],
+        check=True,
+        env=env,
+    )
+    with open(decoded_file, "r") as logfile:
+        script_lines = logfile.read().splitlines()
+    if script_lines != lines:
+        print("FAIL: log_decode.py output does not match decode_binary_log")
+        fails += 1
+
+    # log set with the environment variable
+    expected = [
+        "[WARNING][rank 0][main][env] written with SUNLOGGER_BINARY_FILENAME"
+    ]
+    if sunlog.decode_binary_log(env_file) != expected:
+        print("FAIL: SUNLOGGER_BINARY_FILENAME log does not match")
+        fails += 1
+
+    if fails:
+        print(f"FAIL: {fails} checks failed")
+        return 1
+
+    print(f"SUCCESS: decoded {len(lines)} messages")
+    return 0
+
+
+# run the main routine
+if __name__ == "__main__":
+    sys.exit(main())
@@ -23,6 +23,9 @@
 
 #include "test_nvector.h"
 
+/* OpenMP specific tests */
+static int Test_N_VFirstTouch_OpenMP(sunindextype length, int nthreads);
+
 /* ----------------------------------------------------------------------
  * Main NVector Testing Routine
  * --------------------------------------------------------------------*/
@@ -94,9 +97,14 @@ int main(int argc, char* argv[])
   /* Test clone functions */
   fails += Test_N_VCloneEmpty(X, 0);
   fails += Test_N_VClone(X, length, 0);
+  fails += Test_N_VClonePool(X, length, 0);
+  fails += Test_N_VCloneSharedOps(X, N_VEnableFusedOps_OpenMP, 0);
   fails += Test_N_VCloneEmptyVectorArray(5, X, 0);
   fails += Test_N_VCloneVectorArray(5, X, length, 0);
 
+  /* Test first-touch placement of the vector data */
+  fails += Test_N_VFirstTouch_OpenMP(length, nthreads);
+
   /* Test setting/getting array data */
   fails += Test_N_VSetArrayPointer(W, length, 0);
   fails += Test_N_VGetArrayPointer(X, length, 0);
@@ -164,6 +172,8 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(U, length, 0);
   fails += Test_N_VScaleAddMulti(U, length, 0);
   fails += Test_N_VDotProdMulti(U, length, 0);
+  fails += Test_N_VProjectSubtract(U, length, 0);
+  fails += Test_N_VPascalUpdate(U, length, 0);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(U, length, 0);
@@ -195,6 +205,8 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(V, length, 0);
   fails += Test_N_VScaleAddMulti(V, length, 0);
   fails += Test_N_VDotProdMulti(V, length, 0);
+  fails += Test_N_VProjectSubtract(V, length, 0);
+  fails += Test_N_VPascalUpdate(V, length, 0);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(V, length, 0);
@@ -245,6 +257,60 @@ int main(int argc, char* argv[])
   return (fails);
 }
 
+/* ----------------------------------------------------------------------
+ * N_VNewFirstTouch_OpenMP Test
+ *
+ * The data of a vector created with N_VNewFirstTouch_OpenMP and of its
+ * clones is initialized to zero by the threads of the vector operations.
+ * Clones inherit the first-touch setting of the vector they are cloned from.
+ * --------------------------------------------------------------------*/
+static int Test_N_VFirstTouch_OpenMP(sunindextype length, int nthreads)
+{
+  int failure = 0;
+  N_Vector X, Y, Z;
+
+  X = N_VNewFirstTouch_OpenMP(length, nthreads, sunctx);
+  if (X == NULL || !has_data(X) || !NV_FIRST_TOUCH_OMP(X) ||
+      check_ans(ZERO, X, length))
+  {
+    printf(">>> FAILED test -- N_VNewFirstTouch_OpenMP \n");
+    printf("    Vector data is not initialized \n\n");
+    if (X) { N_VDestroy(X); }
+    return (1);
+  }
+
+  /* clones keep the distribution of X */
+  Y = N_VClone(X);
+  if (Y == NULL || !has_data(Y) || !NV_FIRST_TOUCH_OMP(Y) ||
+      check_ans(ZERO, Y, length))
+  {
+    printf(">>> FAILED test -- N_VNewFirstTouch_OpenMP \n");
+    printf("    Clone data is not initialized \n\n");
+    failure = 1;
+  }
+
+  /* clones of a vector with first touch disabled do not inherit it */
+  if (!failure && N_VSetFirstTouch_OpenMP(Y, SUNFALSE) == SUN_SUCCESS)
+  {
+    Z = N_VClone(Y);
+    if (Z == NULL || !has_data(Z) || NV_FIRST_TOUCH_OMP(Z))
+    {
+      printf(">>> FAILED test -- N_VNewFirstTouch_OpenMP \n");
+      printf("    Clone inherited disabled first touch \n\n");
+      failure = 1;
+    }
+    if (Z) { N_VDestroy(Z); }
+  }
+
+  N_VDestroy(X);
+  if (Y) { N_VDestroy(Y); }
+
+  if (failure) { return (1); }
+
+  printf("PASSED test -- N_VNewFirstTouch_OpenMP \n");
+  return (0);
+}
+
 /* ----------------------------------------------------------------------
  * Implementation specific utility functions for vector tests
  * --------------------------------------------------------------------*/
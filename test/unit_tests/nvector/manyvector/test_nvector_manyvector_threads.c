@@ -0,0 +1,337 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the concurrent execution of the ManyVector subvector
+ * operations. The ManyVector has subvectors of different lengths and types:
+ * serial vectors with and without fused operations and a nested ManyVector.
+ * The standard, reduction, fused, and vector array operations are applied
+ * with several numbers of threads, including more threads than subvectors.
+ * The vector results and the max, min, and boolean reductions must match the
+ * results with one thread exactly, the sums up to roundoff.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "nvector/nvector_manyvector.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NSUB   5
+#define NVEC   3
+#define NSUM   17
+#define NBOOL  7
+#define ZERO   SUN_RCONST(0.0)
+#define HALF   SUN_RCONST(0.5)
+#define ONE    SUN_RCONST(1.0)
+#define TWO    SUN_RCONST(2.0)
+#define SUMTOL (SUN_RCONST(100.0) * SUN_UNIT_ROUNDOFF)
+
+/* Fills the serial leaves of x with values in [offset - 1, offset + 1]
+   depending on seed */
+static void fill(N_Vector x, int seed, sunrealtype offset, sunindextype* k)
+{
+  if (N_VGetVectorID(x) == SUNDIALS_NVEC_MANYVECTOR)
+  {
+    for (sunindextype i = 0; i < N_VGetNumSubvectors_ManyVector(x); i++)
+    {
+      fill(N_VGetSubvector_ManyVector(x, i), seed, offset, k);
+    }
+    return;
+  }
+
+  sunrealtype* data = N_VGetArrayPointer(x);
+  for (sunindextype j = 0; j < N_VGetLength(x); j++, (*k)++)
+  {
+    data[j] = offset - ONE +
+              (sunrealtype)(((*k + 1) * seed) % 101) / SUN_RCONST(50.0);
+  }
+}
+
+/* Copies the serial leaves of x to out */
+static void gather(N_Vector x, sunrealtype* out, sunindextype* k)
+{
+  if (N_VGetVectorID(x) == SUNDIALS_NVEC_MANYVECTOR)
+  {
+    for (sunindextype i = 0; i < N_VGetNumSubvectors_ManyVector(x); i++)
+    {
+      gather(N_VGetSubvector_ManyVector(x, i), out, k);
+    }
+    return;
+  }
+
+  sunrealtype* data = N_VGetArrayPointer(x);
+  for (sunindextype j = 0; j < N_VGetLength(x); j++, (*k)++)
+  {
+    out[*k] = data[j];
+  }
+}
+
+/* Creates the ManyVector with heterogeneous subvectors */
+static N_Vector create(SUNContext sunctx)
+{
+  const sunindextype len[NSUB] = {1000, 7, 300, 2500, 1};
+  N_Vector sub[NSUB];
+  N_Vector nested[2];
+
+  for (int i = 0; i < NSUB; i++)
+  {
+    if (i == 2)
+    {
+      /* nested ManyVector subvector */
+      nested[0] = N_VNew_Serial(len[i], sunctx);
+      nested[1] = N_VNew_Serial(1, sunctx);
+      if (!nested[0] || !nested[1]) { return NULL; }
+      sub[i] = N_VNew_ManyVector(2, nested, sunctx);
+      if (!sub[i]) { return NULL; }
+      if (N_VEnableFusedOps_ManyVector(sub[i], SUNTRUE)) { return NULL; }
+      continue;
+    }
+
+    sub[i] = N_VNew_Serial(len[i], sunctx);
+    if (!sub[i]) { return NULL; }
+
+    /* every other serial subvector uses the fused operations */
+    if (N_VEnableFusedOps_Serial(sub[i], (i % 2 == 0) ? SUNTRUE : SUNFALSE))
+    {
+      return NULL;
+    }
+  }
+
+  return N_VNew_ManyVector(NSUB, sub, sunctx);
+}
+
+/* Destroys the ManyVector created by create() and its subvectors */
+static void destroy(N_Vector x)
+{
+  if (N_VGetVectorID(x) == SUNDIALS_NVEC_MANYVECTOR)
+  {
+    for (sunindextype i = 0; i < N_VGetNumSubvectors_ManyVector(x); i++)
+    {
+      destroy(N_VGetSubvector_ManyVector(x, i));
+    }
+  }
+  N_VDestroy(x);
+}
+
+/* Applies the operations with the given number of threads and stores the
+   vector results in vout and the reduction results in sout (sums) and bout
+   (max, min, and boolean results) */
+static int apply(int nthreads, sunrealtype* vout, sunrealtype* sout,
+                 sunrealtype* bout, SUNContext sunctx)
+{
+  sunrealtype c[NVEC] = {SUN_RCONST(0.5), -SUN_RCONST(1.25), SUN_RCONST(2.0)};
+  sunrealtype dots[NVEC], nrms[NVEC];
+  N_Vector X[NVEC], Y[NVEC], Z[NVEC];
+  N_Vector x, y, z, w, id, cons;
+  sunindextype k, n = 0;
+  int ns = 0, nb = 0;
+
+  x = create(sunctx);
+  if (!x) { return 1; }
+
+  if (N_VSetNumThreads_ManyVector(x, nthreads)) { return 1; }
+  if (N_VEnableFusedOps_ManyVector(x, SUNTRUE)) { return 1; }
+
+  /* clones inherit the number of threads and the fused operations */
+  y    = N_VClone(x);
+  z    = N_VClone(x);
+  w    = N_VClone(x);
+  id   = N_VClone(x);
+  cons = N_VClone(x);
+  if (!y || !z || !w || !id || !cons) { return 1; }
+  for (int j = 0; j < NVEC; j++)
+  {
+    X[j] = N_VClone(x);
+    Y[j] = N_VClone(x);
+    Z[j] = N_VClone(x);
+    if (!X[j] || !Y[j] || !Z[j]) { return 1; }
+  }
+
+  k = 0;
+  fill(x, 37, ZERO, &k);
+  k = 0;
+  fill(y, 11, TWO, &k);
+  k = 0;
+  fill(w, 5, ONE, &k);
+  for (int j = 0; j < NVEC; j++)
+  {
+    k = 0;
+    fill(X[j], 20 + j, ZERO, &k);
+    k = 0;
+    fill(Y[j], 30 + j, TWO, &k);
+  }
+
+  /* mask and constraints */
+  N_VCompare(HALF, x, id);
+  N_VConst(ONE, cons);
+
+  /* standard operations */
+  N_VLinearSum(TWO, x, -HALF, y, z);
+  gather(z, vout, &n);
+  N_VProd(x, y, z);
+  gather(z, vout, &n);
+  N_VDiv(x, y, z);
+  gather(z, vout, &n);
+  N_VScale(-TWO, x, z);
+  gather(z, vout, &n);
+  N_VAbs(x, z);
+  gather(z, vout, &n);
+  N_VInv(y, z);
+  gather(z, vout, &n);
+  N_VAddConst(x, HALF, z);
+  gather(z, vout, &n);
+  N_VCompare(SUN_RCONST(0.25), x, z);
+  gather(z, vout, &n);
+  gather(id, vout, &n);
+
+  /* reductions */
+  sout[ns++] = N_VDotProd(x, y);
+  sout[ns++] = N_VWrmsNorm(x, w);
+  sout[ns++] = N_VWrmsNormMask(x, w, id);
+  sout[ns++] = N_VWL2Norm(x, w);
+  sout[ns++] = N_VL1Norm(x);
+  bout[nb++] = N_VMaxNorm(x);
+  bout[nb++] = N_VMin(x);
+  bout[nb++] = N_VMinQuotient(x, y);
+  bout[nb++] = (sunrealtype)N_VInvTest(y, z);
+  gather(z, vout, &n);
+  bout[nb++] = (sunrealtype)N_VInvTest(x, z);
+  bout[nb++] = (sunrealtype)N_VConstrMask(cons, y, z);
+  bout[nb++] = (sunrealtype)N_VConstrMask(cons, x, z);
+  gather(z, vout, &n);
+
+  /* fused operations */
+  if (N_VLinearCombination(NVEC, c, X, z)) { return 1; }
+  gather(z, vout, &n);
+  if (N_VScaleAddMulti(NVEC, c, x, Y, Z)) { return 1; }
+  for (int j = 0; j < NVEC; j++) { gather(Z[j], vout, &n); }
+  if (N_VDotProdMulti(NVEC, x, Y, dots)) { return 1; }
+  for (int j = 0; j < NVEC; j++) { sout[ns++] = dots[j]; }
+
+  /* vector array operations */
+  if (N_VLinearSumVectorArray(NVEC, -ONE, X, TWO, Y, Z)) { return 1; }
+  for (int j = 0; j < NVEC; j++) { gather(Z[j], vout, &n); }
+  if (N_VScaleVectorArray(NVEC, c, X, Z)) { return 1; }
+  for (int j = 0; j < NVEC; j++) { gather(Z[j], vout, &n); }
+  if (N_VWrmsNormVectorArray(NVEC, X, Y, nrms)) { return 1; }
+  for (int j = 0; j < NVEC; j++) { sout[ns++] = nrms[j]; }
+  if (N_VWrmsNormMaskVectorArray(NVEC, X, Y, id, nrms)) { return 1; }
+  for (int j = 0; j < NVEC; j++) { sout[ns++] = nrms[j]; }
+  if (N_VConstVectorArray(NVEC, SUN_RCONST(3.0), Z)) { return 1; }
+  for (int j = 0; j < NVEC; j++) { gather(Z[j], vout, &n); }
+
+  /* single buffer reduction */
+  if (N_VDotProdMultiLocal(NVEC, x, X, dots)) { return 1; }
+  for (int j = 0; j < NVEC; j++) { sout[ns++] = dots[j]; }
+
+  /* the clones own their subvectors */
+  for (int j = 0; j < NVEC; j++)
+  {
+    N_VDestroy(X[j]);
+    N_VDestroy(Y[j]);
+    N_VDestroy(Z[j]);
+  }
+  N_VDestroy(y);
+  N_VDestroy(z);
+  N_VDestroy(w);
+  N_VDestroy(id);
+  N_VDestroy(cons);
+  destroy(x);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  sunrealtype *vref = NULL, *v = NULL;
+  sunrealtype sref[NSUM], s[NSUM], bref[NBOOL], b[NBOOL];
+  sunindextype nv = 0;
+  int fails       = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create returned nonzero\n");
+    return 1;
+  }
+
+  /* 24 vector results of length 3809 */
+  nv   = 24 * 3809;
+  vref = (sunrealtype*)malloc(nv * sizeof(sunrealtype));
+  v    = (sunrealtype*)malloc(nv * sizeof(sunrealtype));
+  if (!vref || !v)
+  {
+    fprintf(stderr, "malloc returned NULL\n");
+    return 1;
+  }
+
+  if (apply(1, vref, sref, bref, sunctx))
+  {
+    fprintf(stderr, "FAIL: operations with one thread\n");
+    return 1;
+  }
+
+  for (int nthreads = 2; nthreads <= 8; nthreads *= 2)
+  {
+    sunrealtype vdiff = ZERO, sdiff = ZERO, bdiff = ZERO;
+
+    if (apply(nthreads, v, s, b, sunctx))
+    {
+      fprintf(stderr, "FAIL: operations with %d threads\n", nthreads);
+      fails++;
+      continue;
+    }
+
+    for (sunindextype i = 0; i < nv; i++)
+    {
+      vdiff = SUNMAX(vdiff, SUNRabs(v[i] - vref[i]));
+    }
+    for (int i = 0; i < NSUM; i++)
+    {
+      sdiff = SUNMAX(sdiff, SUNRabs(s[i] - sref[i]) / SUNRabs(sref[i]));
+    }
+    for (int i = 0; i < NBOOL; i++)
+    {
+      bdiff = SUNMAX(bdiff, SUNRabs(b[i] - bref[i]));
+    }
+
+    printf("%d threads: vector difference = %" GSYM
+           ", relative sum difference = %" GSYM ", max/min/test difference "
+           "= %" GSYM "\n",
+           nthreads, vdiff, sdiff, bdiff);
+
+    if (vdiff != ZERO || sdiff > SUMTOL || bdiff != ZERO)
+    {
+      fprintf(stderr, "FAIL: %d threads do not match one thread\n", nthreads);
+      fails++;
+    }
+  }
+
+  free(vref);
+  free(v);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d test(s) failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: all tests passed\n");
+  return 0;
+}
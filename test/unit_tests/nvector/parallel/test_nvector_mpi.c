@@ -182,6 +182,8 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(U, local_length, myid);
   fails += Test_N_VScaleAddMulti(U, local_length, myid);
   fails += Test_N_VDotProdMulti(U, local_length, myid);
+  fails += Test_N_VProjectSubtract(U, local_length, myid);
+  fails += Test_N_VPascalUpdate(U, local_length, myid);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(U, local_length, myid);
@@ -216,6 +218,8 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(V, local_length, myid);
   fails += Test_N_VScaleAddMulti(V, local_length, myid);
   fails += Test_N_VDotProdMulti(V, local_length, myid);
+  fails += Test_N_VProjectSubtract(V, local_length, myid);
+  fails += Test_N_VPascalUpdate(V, local_length, myid);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(V, local_length, myid);
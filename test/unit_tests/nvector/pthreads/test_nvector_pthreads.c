@@ -94,6 +94,8 @@ int main(int argc, char* argv[])
   /* Test clone functions */
   fails += Test_N_VCloneEmpty(X, 0);
   fails += Test_N_VClone(X, length, 0);
+  fails += Test_N_VClonePool(X, length, 0);
+  fails += Test_N_VCloneSharedOps(X, N_VEnableFusedOps_Pthreads, 0);
   fails += Test_N_VCloneEmptyVectorArray(5, X, 0);
   fails += Test_N_VCloneVectorArray(5, X, length, 0);
 
@@ -164,6 +166,7 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(U, length, 0);
   fails += Test_N_VScaleAddMulti(U, length, 0);
   fails += Test_N_VDotProdMulti(U, length, 0);
+  fails += Test_N_VPascalUpdate(U, length, 0);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(U, length, 0);
@@ -195,6 +198,7 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(V, length, 0);
   fails += Test_N_VScaleAddMulti(V, length, 0);
   fails += Test_N_VDotProdMulti(V, length, 0);
+  fails += Test_N_VPascalUpdate(V, length, 0);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(V, length, 0);
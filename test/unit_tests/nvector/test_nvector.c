@@ -358,6 +358,209 @@ int Test_N_VClone(N_Vector W, sunindextype local_length, int myid)
   return (0);
 }
 
+/* ----------------------------------------------------------------------
+ * N_VClone Test with the vector pool of the context
+ *
+ * NOTE: This routine depends on N_VConst to check vector data.
+ * --------------------------------------------------------------------*/
+int Test_N_VClonePool(N_Vector W, sunindextype local_length, int myid)
+{
+  int failure;
+  double start_time, stop_time, maxt;
+  long int nhits, nmisses, npooled, high_water;
+  N_Vector X, Y;
+  SUNContext ctx = W->sunctx;
+
+  /* check if the required operations are implemented */
+  if (W->ops->nvconst == NULL)
+  {
+    printf(">>> FAILED test -- N_VClonePool, Proc %d missing required "
+           "operations\n",
+           myid);
+    return (1);
+  }
+
+  if (SUNContext_SetVectorPool(ctx, SUNTRUE))
+  {
+    printf(">>> FAILED test -- N_VClonePool, Proc %d \n", myid);
+    printf("    SUNContext_SetVectorPool returned nonzero \n\n");
+    return (1);
+  }
+
+  /* the first clone misses and is returned to the pool on destruction */
+  X = N_VClone(W);
+  if (X == NULL || !has_data(X))
+  {
+    printf(">>> FAILED test -- N_VClonePool, Proc %d \n", myid);
+    printf("    After N_VClone, X or its data == NULL \n\n");
+    SUNContext_SetVectorPool(ctx, SUNFALSE);
+    return (1);
+  }
+  N_VDestroy(X);
+
+  SUNContext_GetVectorPoolStats(ctx, &nhits, &nmisses, &npooled, &high_water);
+  if (nhits != 0 || nmisses != 1 || npooled != 1 || high_water != 1)
+  {
+    printf(">>> FAILED test -- N_VClonePool, Proc %d \n", myid);
+    printf("    After N_VDestroy, nhits = %ld, nmisses = %ld, npooled = %ld, "
+           "high_water = %ld (expected 0, 1, 1, 1) \n\n",
+           nhits, nmisses, npooled, high_water);
+    SUNContext_SetVectorPool(ctx, SUNFALSE);
+    return (1);
+  }
+
+  /* the next clone reuses the pooled vector */
+  start_time = get_time();
+  Y          = N_VClone(W);
+  stop_time  = get_time();
+
+  SUNContext_GetVectorPoolStats(ctx, &nhits, &nmisses, &npooled, &high_water);
+  if (Y != X || nhits != 1 || npooled != 0)
+  {
+    printf(">>> FAILED test -- N_VClonePool, Proc %d \n", myid);
+    printf("    Pooled vector not reused, nhits = %ld, npooled = %ld \n\n",
+           nhits, npooled);
+    if (Y) { N_VDestroy(Y); }
+    SUNContext_SetVectorPool(ctx, SUNFALSE);
+    return (1);
+  }
+
+  /* the reused vector must behave like a new clone */
+  N_VConst(ONE, Y);
+  failure = check_ans(ONE, Y, local_length);
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VClonePool, Proc %d \n", myid);
+    printf("    Failed N_VClonePool check \n\n");
+    N_VDestroy(Y);
+    SUNContext_SetVectorPool(ctx, SUNFALSE);
+    return (1);
+  }
+
+  /* vectors without data are never pooled */
+  X = N_VCloneEmpty(W);
+  N_VDestroy(X);
+  N_VDestroy(Y);
+
+  SUNContext_GetVectorPoolStats(ctx, &nhits, &nmisses, &npooled, &high_water);
+  if (npooled != 1)
+  {
+    printf(">>> FAILED test -- N_VClonePool, Proc %d \n", myid);
+    printf("    After N_VDestroy, npooled = %ld (expected 1) \n\n", npooled);
+    SUNContext_SetVectorPool(ctx, SUNFALSE);
+    return (1);
+  }
+
+  /* trimming frees the pooled vectors */
+  SUNContext_TrimVectorPool(ctx, 0);
+  SUNContext_GetVectorPoolStats(ctx, &nhits, &nmisses, &npooled, &high_water);
+  SUNContext_SetVectorPool(ctx, SUNFALSE);
+  if (npooled != 0 || high_water != 1)
+  {
+    printf(">>> FAILED test -- N_VClonePool, Proc %d \n", myid);
+    printf("    After trimming, npooled = %ld, high_water = %ld (expected 0, "
+           "1) \n\n",
+           npooled, high_water);
+    return (1);
+  }
+
+  if (myid == 0) { printf("PASSED test -- N_VClonePool \n"); }
+
+  /* find max time across all processes */
+  maxt = max_time(W, stop_time - start_time);
+  PRINT_TIME("N_VClonePool", maxt);
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * N_VCloneSharedOps Test
+ *
+ * Clones share one operations table when shared vector operations are
+ * enabled and enable_fused (the N_VEnableFusedOps function of the vector
+ * implementation) switches a vector to another shared table without changing
+ * the operations of the other vectors.
+ * --------------------------------------------------------------------*/
+int Test_N_VCloneSharedOps(N_Vector W,
+                           SUNErrCode (*enable_fused)(N_Vector, sunbooleantype),
+                           int myid)
+{
+  int failure = 0;
+  long int ntables;
+  sunbooleantype fused;
+  N_Vector X, Y, Z;
+  SUNContext ctx = W->sunctx;
+
+  if (SUNContext_SetSharedVectorOps(ctx, SUNTRUE))
+  {
+    printf(">>> FAILED test -- N_VCloneSharedOps, Proc %d \n", myid);
+    printf("    SUNContext_SetSharedVectorOps returned nonzero \n\n");
+    return (1);
+  }
+
+  /* clones of the same vector use the same table */
+  X = N_VClone(W);
+  Y = N_VClone(W);
+  SUNContext_GetNumSharedVectorOps(ctx, &ntables);
+  if (X == NULL || Y == NULL || X->ops != Y->ops || ntables != 1)
+  {
+    printf(">>> FAILED test -- N_VCloneSharedOps, Proc %d \n", myid);
+    printf("    Clones do not share operations, ntables = %ld \n\n", ntables);
+    failure = 1;
+  }
+
+  /* changing the operations of Y does not change the operations of X */
+  fused = (X->ops->nvlinearcombination != NULL);
+  if (!failure)
+  {
+    enable_fused(Y, !fused);
+    SUNContext_GetNumSharedVectorOps(ctx, &ntables);
+    if (X->ops == Y->ops || (X->ops->nvlinearcombination != NULL) != fused ||
+        (Y->ops->nvlinearcombination != NULL) == fused || ntables != 2)
+    {
+      printf(">>> FAILED test -- N_VCloneSharedOps, Proc %d \n", myid);
+      printf("    Enabling fused operations modified a shared table, ntables "
+             "= %ld \n\n",
+             ntables);
+      failure = 1;
+    }
+  }
+
+  /* a clone with the same operations as Y uses the table of Y */
+  if (!failure)
+  {
+    Z = N_VClone(W);
+    enable_fused(Z, !fused);
+    SUNContext_GetNumSharedVectorOps(ctx, &ntables);
+    if (Z == NULL || Z->ops != Y->ops || ntables != 2)
+    {
+      printf(">>> FAILED test -- N_VCloneSharedOps, Proc %d \n", myid);
+      printf("    Equal operations are not shared, ntables = %ld \n\n",
+             ntables);
+      failure = 1;
+    }
+    N_VDestroy(Z);
+  }
+
+  /* the tables are freed with the last vector using them */
+  N_VDestroy(X);
+  N_VDestroy(Y);
+  SUNContext_GetNumSharedVectorOps(ctx, &ntables);
+  SUNContext_SetSharedVectorOps(ctx, SUNFALSE);
+  if (!failure && ntables != 0)
+  {
+    printf(">>> FAILED test -- N_VCloneSharedOps, Proc %d \n", myid);
+    printf("    After N_VDestroy, ntables = %ld (expected 0) \n\n", ntables);
+    failure = 1;
+  }
+
+  if (failure) { return (1); }
+
+  if (myid == 0) { printf("PASSED test -- N_VCloneSharedOps \n"); }
+
+  return (0);
+}
+
 /* ----------------------------------------------------------------------
  * N_VGetArrayPointer Test
  *
@@ -2694,6 +2897,246 @@ int Test_N_VDotProdMulti(N_Vector X, sunindextype local_length, int myid)
   return (fails);
 }
 
+/* ----------------------------------------------------------------------
+ * N_VProjectSubtract Test
+ * --------------------------------------------------------------------*/
+int Test_N_VProjectSubtract(N_Vector X, sunindextype local_length, int myid)
+{
+  int fails = 0, failure = 0, ierr = 0;
+  double start_time, stop_time, maxt;
+
+  int j;
+  sunindextype i, global_length;
+  N_Vector Xref;
+  N_Vector* V;
+  sunrealtype dotprods[3], dot_ref[3];
+  sunrealtype sqrnorms[2];
+  sunrealtype ans, sqr_ref, tol;
+
+  /* get global length */
+  global_length = N_VGetLength(X);
+
+  /* create vectors for testing */
+  V = N_VCloneVectorArray(3, X);
+
+  /*
+   * Case 1: d[0] = x . V[0], x = x - d[0] V[0]
+   */
+
+  /* fill vector data */
+  N_VConst(TWO, X);
+  N_VConst(HALF, V[0]);
+
+  start_time = get_time();
+  ierr       = N_VProjectSubtract(1, X, V, dotprods, sqrnorms);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* dotprod[0] should equal the global vector length, x should equal
+     2 - length/2, and the norms should match the old and new x values */
+  ans = TWO - HALF * (sunrealtype)global_length;
+  if (ierr == 0)
+  {
+    failure = SUNRCompare(dotprods[0], (sunrealtype)global_length);
+    failure += SUNRCompare(sqrnorms[0], (sunrealtype)4 * global_length);
+    failure += SUNRCompare(sqrnorms[1], ans * ans * global_length);
+    failure += check_ans(ans, X, local_length);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VProjectSubtract Case 1, Proc %d \n", myid);
+    fails++;
+  }
+  else if (myid == 0) { printf("PASSED test -- N_VProjectSubtract Case 1 \n"); }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VProjectSubtract", maxt);
+
+  /*
+   * Case 2: d[i] = x . V[i], x = x - sum d[i] V[i]
+   */
+
+  /* fill vector data */
+  N_VConst(TWO, X);
+  N_VConst(NEG_HALF, V[0]);
+  N_VConst(HALF, V[1]);
+  N_VConst(ONE, V[2]);
+
+  start_time = get_time();
+  ierr       = N_VProjectSubtract(3, X, V, dotprods, sqrnorms);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* dotprod[i] should equal -1, +1, and 2 times the global vector length and
+     x should equal 2 - 3 times the global vector length */
+  ans = TWO - (sunrealtype)3 * global_length;
+  if (ierr == 0)
+  {
+    failure = SUNRCompare(dotprods[0], (sunrealtype)-1 * global_length);
+    failure += SUNRCompare(dotprods[1], (sunrealtype)global_length);
+    failure += SUNRCompare(dotprods[2], (sunrealtype)2 * global_length);
+    failure += SUNRCompare(sqrnorms[0], (sunrealtype)4 * global_length);
+    failure += SUNRCompare(sqrnorms[1], ans * ans * global_length);
+    failure += check_ans(ans, X, local_length);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VProjectSubtract Case 2, Proc %d \n", myid);
+    fails++;
+  }
+  else if (myid == 0) { printf("PASSED test -- N_VProjectSubtract Case 2 \n"); }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VProjectSubtract", maxt);
+
+  /*
+   * Case 3: same as case 2 with non-constant vectors, compared against the
+   * result computed with N_VDotProd and N_VLinearSum
+   */
+
+  /* fill vector data */
+  for (i = 0; i < local_length; i++)
+  {
+    set_element(X, i, ONE + (sunrealtype)(i % 7) / (sunrealtype)7);
+    set_element(V[0], i, (sunrealtype)(i % 5 - 2) / (sunrealtype)4);
+    set_element(V[1], i, (sunrealtype)((3 * i) % 4) / (sunrealtype)8 - HALF);
+    set_element(V[2], i, (sunrealtype)((i + 1) % 3) / (sunrealtype)3);
+  }
+
+  /* compute the reference values */
+  Xref    = N_VClone(X);
+  N_VScale(ONE, X, Xref);
+  sqr_ref = N_VDotProd(Xref, Xref);
+  for (j = 0; j < 3; j++) { dot_ref[j] = N_VDotProd(Xref, V[j]); }
+  for (j = 0; j < 3; j++) { N_VLinearSum(ONE, Xref, -dot_ref[j], V[j], Xref); }
+
+  start_time = get_time();
+  ierr       = N_VProjectSubtract(3, X, V, dotprods, sqrnorms);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* the results should match the reference values up to rounding */
+  tol = SUNRsqrt(SUN_UNIT_ROUNDOFF);
+  if (ierr == 0)
+  {
+    failure = 0;
+    for (j = 0; j < 3; j++)
+    {
+      failure += SUNRCompareTol(dotprods[j], dot_ref[j], tol);
+    }
+    failure += SUNRCompareTol(sqrnorms[0], sqr_ref, tol);
+    failure += SUNRCompareTol(sqrnorms[1], N_VDotProd(Xref, Xref), tol);
+    N_VLinearSum(ONE, X, -ONE, Xref, Xref);
+    failure += (N_VMaxNorm(Xref) > tol * N_VMaxNorm(X));
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VProjectSubtract Case 3, Proc %d \n", myid);
+    fails++;
+  }
+  else if (myid == 0) { printf("PASSED test -- N_VProjectSubtract Case 3 \n"); }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VProjectSubtract", maxt);
+
+  /* Free vectors */
+  N_VDestroy(Xref);
+  N_VDestroyVectorArray(V, 3);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * N_VPascalUpdate Test
+ * --------------------------------------------------------------------*/
+int Test_N_VPascalUpdate(N_Vector X, sunindextype local_length, int myid)
+{
+  int fails = 0, failure = 0, ierr = 0;
+  double start_time, stop_time, maxt;
+
+  N_Vector* Z;
+
+  /* create vectors for testing */
+  Z = N_VCloneVectorArray(3, X);
+
+  /*
+   * Case 1: Z[0] = Z[0] + Z[1] + Z[2], Z[1] = Z[1] + 2 Z[2]
+   */
+
+  /* fill vector data */
+  N_VConst(ONE, Z[0]);
+  N_VConst(TWO, Z[1]);
+  N_VConst(HALF, Z[2]);
+
+  start_time = get_time();
+  ierr       = N_VPascalUpdate(3, ONE, Z);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* Z[0] should equal 3.5, Z[1] should equal 3, and Z[2] is unchanged */
+  if (ierr == 0)
+  {
+    failure = check_ans(SUN_RCONST(3.5), Z[0], local_length);
+    failure += check_ans(SUN_RCONST(3.0), Z[1], local_length);
+    failure += check_ans(HALF, Z[2], local_length);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VPascalUpdate Case 1, Proc %d \n", myid);
+    fails++;
+  }
+  else if (myid == 0) { printf("PASSED test -- N_VPascalUpdate Case 1 \n"); }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VPascalUpdate", maxt);
+
+  /*
+   * Case 2: the update with c = -1 reverts the update with c = 1
+   */
+
+  start_time = get_time();
+  ierr       = N_VPascalUpdate(3, NEG_ONE, Z);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* Z[0] should equal 1, Z[1] should equal 2, and Z[2] is unchanged */
+  if (ierr == 0)
+  {
+    failure = check_ans(ONE, Z[0], local_length);
+    failure += check_ans(TWO, Z[1], local_length);
+    failure += check_ans(HALF, Z[2], local_length);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VPascalUpdate Case 2, Proc %d \n", myid);
+    fails++;
+  }
+  else if (myid == 0) { printf("PASSED test -- N_VPascalUpdate Case 2 \n"); }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VPascalUpdate", maxt);
+
+  /* Free vectors */
+  N_VDestroyVectorArray(Z, 3);
+
+  return (fails);
+}
+
 /* ----------------------------------------------------------------------
  * N_VLinearSumVectorArray Test
  * --------------------------------------------------------------------*/
@@ -64,6 +64,10 @@ int Test_N_VCloneVectorArray(int count, N_Vector W, sunindextype local_length,
 int Test_N_VCloneEmptyVectorArray(int count, N_Vector W, int myid);
 int Test_N_VCloneEmpty(N_Vector W, int myid);
 int Test_N_VClone(N_Vector W, sunindextype local_length, int myid);
+int Test_N_VClonePool(N_Vector W, sunindextype local_length, int myid);
+int Test_N_VCloneSharedOps(N_Vector W,
+                           SUNErrCode (*enable_fused)(N_Vector, sunbooleantype),
+                           int myid);
 
 /* Vector get/set function tests */
 int Test_N_VGetArrayPointer(N_Vector W, sunindextype local_length, int myid);
@@ -103,6 +107,8 @@ int Test_N_VMinQuotient(N_Vector NUM, N_Vector DENOM, sunindextype local_length,
 int Test_N_VLinearCombination(N_Vector X, sunindextype local_length, int myid);
 int Test_N_VScaleAddMulti(N_Vector X, sunindextype local_length, int myid);
 int Test_N_VDotProdMulti(N_Vector X, sunindextype local_length, int myid);
+int Test_N_VProjectSubtract(N_Vector X, sunindextype local_length, int myid);
+int Test_N_VPascalUpdate(N_Vector X, sunindextype local_length, int myid);
 
 /* Vector array operation tests */
 int Test_N_VLinearSumVectorArray(N_Vector X, sunindextype local_length, int myid);
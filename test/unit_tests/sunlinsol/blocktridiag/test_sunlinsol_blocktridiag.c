@@ -0,0 +1,236 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the SUNLinSol BlockTridiag
+ * module implementation.
+ * -----------------------------------------------------------------
+ */
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunlinsol/sunlinsol_blocktridiag.h>
+#include <sunmatrix/sunmatrix_blocktridiag.h>
+
+#include "test_sunlinsol.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+/* ----------------------------------------------------------------------
+ * SUNLinSol_BlockTridiag Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;               /* counter for test failures */
+  sunindextype nblocks, bs, N; /* matrix dimensions         */
+  SUNLinearSolver LS;          /* solver object             */
+  SUNMatrix A, B;              /* test matrices             */
+  N_Vector x, y, b;            /* test vectors              */
+  int print_timing;
+  sunindextype i, j, I, J;
+  sunrealtype *block, *xdata;
+  SUNContext sunctx;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed\n");
+    return (-1);
+  }
+
+  /* check input and set matrix dimensions */
+  if (argc < 4)
+  {
+    printf("ERROR: THREE (3) Inputs required: number of blocks, block size, "
+           "print timing \n");
+    return (-1);
+  }
+
+  nblocks = (sunindextype)atol(argv[1]);
+  if (nblocks <= 0)
+  {
+    printf("ERROR: number of blocks must be a positive integer \n");
+    return (-1);
+  }
+
+  bs = (sunindextype)atol(argv[2]);
+  if (bs <= 0)
+  {
+    printf("ERROR: block size must be a positive integer \n");
+    return (-1);
+  }
+
+  print_timing = atoi(argv[3]);
+  SetTiming(print_timing);
+
+  N = nblocks * bs;
+
+  printf("\nBlock-tridiagonal linear solver test: %ld blocks of size %ld\n\n",
+         (long int)nblocks, (long int)bs);
+
+  /* Create matrices and vectors */
+  A = SUNBlockTridiagMatrix(nblocks, bs, sunctx);
+  B = SUNBlockTridiagMatrix(nblocks, bs, sunctx);
+  x = N_VNew_Serial(N, sunctx);
+  y = N_VNew_Serial(N, sunctx);
+  b = N_VNew_Serial(N, sunctx);
+
+  /* Fill matrix blocks and x vector with uniform random data in [0,1] */
+  for (I = 0; I < nblocks; I++)
+  {
+    for (J = SUNMAX(0, I - 1); J <= SUNMIN(nblocks - 1, I + 1); J++)
+    {
+      block = SUNBlockTridiagMatrix_Block(A, I, J);
+      for (j = 0; j < bs; j++)
+      {
+        for (i = 0; i < bs; i++)
+        {
+          SM_BLOCK_ELEMENT_BT(block, i, j, bs) = (sunrealtype)rand() /
+                                                 (sunrealtype)RAND_MAX;
+        }
+      }
+    }
+  }
+
+  xdata = N_VGetArrayPointer(x);
+  for (i = 0; i < N; i++)
+  {
+    xdata[i] = (sunrealtype)rand() / (sunrealtype)RAND_MAX;
+  }
+
+  /* Scale/shift matrix to ensure diagonal dominance */
+  fails += SUNMatScaleAddI(ONE / (3 * bs), A);
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol SUNMatScaleAddI failure\n");
+
+    /* Free matrices and vectors */
+    SUNMatDestroy(A);
+    SUNMatDestroy(B);
+    N_VDestroy(x);
+    N_VDestroy(y);
+    N_VDestroy(b);
+
+    return (1);
+  }
+
+  /* copy A and x into B and y to print in case of solver failure */
+  SUNMatCopy(A, B);
+  N_VScale(ONE, x, y);
+
+  /* create right-hand side vector for linear solve */
+  fails = SUNMatMatvec(A, x, b);
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol SUNMatMatvec failure\n");
+
+    /* Free matrices and vectors */
+    SUNMatDestroy(A);
+    SUNMatDestroy(B);
+    N_VDestroy(x);
+    N_VDestroy(y);
+    N_VDestroy(b);
+
+    return (1);
+  }
+
+  /* Create block-tridiagonal linear solver */
+  LS = SUNLinSol_BlockTridiag(x, A, sunctx);
+  if (LS == NULL)
+  {
+    printf("FAIL: SUNLinSol_BlockTridiag returned NULL\n");
+
+    /* Free matrices and vectors */
+    SUNMatDestroy(A);
+    SUNMatDestroy(B);
+    N_VDestroy(x);
+    N_VDestroy(y);
+    N_VDestroy(b);
+
+    return (1);
+  }
+
+  /* Run Tests */
+  fails += Test_SUNLinSolInitialize(LS, 0);
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolve(LS, A, x, b, 100 * SUN_UNIT_ROUNDOFF, SUNTRUE, 0);
+
+  fails += Test_SUNLinSolGetType(LS, SUNLINEARSOLVER_DIRECT, 0);
+  fails += Test_SUNLinSolGetID(LS, SUNLINEARSOLVER_BLOCKTRIDIAG, 0);
+  fails += Test_SUNLinSolLastFlag(LS, 0);
+
+  /* Print result */
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol module failed %i tests \n \n", fails);
+    printf("\nA (original) =\n");
+    SUNBlockTridiagMatrix_Print(B, stdout);
+    printf("\nA (factored) =\n");
+    SUNBlockTridiagMatrix_Print(A, stdout);
+    printf("\nx (original) =\n");
+    N_VPrint_Serial(y);
+    printf("\nx (computed) =\n");
+    N_VPrint_Serial(x);
+  }
+  else { printf("SUCCESS: SUNLinSol module passed all tests \n \n"); }
+
+  /* Free solver, matrix and vectors */
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  SUNMatDestroy(B);
+  N_VDestroy(x);
+  N_VDestroy(y);
+  N_VDestroy(b);
+  SUNContext_Free(&sunctx);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Implementation-specific 'check' routines
+ * --------------------------------------------------------------------*/
+int check_vector(N_Vector X, N_Vector Y, sunrealtype tol)
+{
+  int failure = 0;
+  sunindextype i, local_length;
+  sunrealtype *Xdata, *Ydata, maxerr;
+
+  Xdata        = N_VGetArrayPointer(X);
+  Ydata        = N_VGetArrayPointer(Y);
+  local_length = N_VGetLength_Serial(X);
+
+  /* check vector data */
+  for (i = 0; i < local_length; i++)
+  {
+    failure += SUNRCompareTol(Xdata[i], Ydata[i], tol);
+  }
+
+  if (failure > ZERO)
+  {
+    maxerr = ZERO;
+    for (i = 0; i < local_length; i++)
+    {
+      maxerr = SUNMAX(SUNRabs(Xdata[i] - Ydata[i]), maxerr);
+    }
+    printf("check err failure: maxerr = %" GSYM " (tol = %" GSYM ")\n", maxerr,
+           tol);
+    return (1);
+  }
+  else { return (0); }
+}
+
+void sync_device(void) {}
@@ -132,6 +132,21 @@ int main(int argc, char* argv[])
   fails += Test_SUNLinSolInitialize(LS, 0);
   fails += Test_SUNLinSolSetup(LS, A, 0);
   fails += Test_SUNLinSolSolve(LS, A, x, b, 1000 * SUN_UNIT_ROUNDOFF, SUNTRUE, 0);
+  fails += Test_SUNLinSolSolveMultiple(LS, A, x, b, 1000 * SUN_UNIT_ROUNDOFF,
+                                       0);
+
+  /* Reinitialize the solver so the next setup repeats the symbolic analysis,
+     then solve with multiple right-hand sides again to reuse the workspace */
+  if (SUNLinSol_KLUReInit(LS, A, SUNSparseMatrix_NNZ(A),
+                          SUNKLU_REINIT_PARTIAL))
+  {
+    printf("FAIL: SUNLinSol_KLUReInit failure\n");
+    fails += 1;
+  }
+  else { printf("    PASSED test -- SUNLinSol_KLUReInit \n"); }
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolveMultiple(LS, A, x, b, 1000 * SUN_UNIT_ROUNDOFF,
+                                       0);
 
   fails += Test_SUNLinSolGetType(LS, SUNLINEARSOLVER_DIRECT, 0);
   fails += Test_SUNLinSolGetID(LS, SUNLINEARSOLVER_KLU, 0);
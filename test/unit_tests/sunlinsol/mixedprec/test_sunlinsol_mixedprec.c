@@ -0,0 +1,230 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the SUNLinSol MixedPrec
+ * module implementation with dense and band matrices.
+ * -----------------------------------------------------------------
+ */
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunlinsol/sunlinsol_mixedprec.h>
+#include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_dense.h>
+
+#include "test_sunlinsol.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+/* ----------------------------------------------------------------------
+ * SUNLinSol_MixedPrec Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;             /* counter for test failures  */
+  int band;                  /* use a band matrix          */
+  sunindextype cols, bwidth; /* matrix columns, bandwidth  */
+  SUNLinearSolver LS;        /* solver object              */
+  SUNMatrix A;               /* test matrix                */
+  N_Vector x, b;             /* test vectors               */
+  int print_timing;
+  sunindextype j, k, kstart, kend;
+  sunrealtype *colj, *xdata;
+  SUNContext sunctx;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed\n");
+    return (-1);
+  }
+
+  /* check input and set matrix dimensions */
+  if (argc < 5)
+  {
+    printf("ERROR: FOUR (4) Inputs required: matrix type (0 = dense, "
+           "1 = band), matrix cols, matrix bandwidth, print timing \n");
+    return (-1);
+  }
+
+  band = atoi(argv[1]);
+
+  cols = (sunindextype)atol(argv[2]);
+  if (cols <= 0)
+  {
+    printf("ERROR: number of matrix columns must be a positive integer \n");
+    return (-1);
+  }
+
+  bwidth = (sunindextype)atol(argv[3]);
+  if (band && ((bwidth <= 0) || (bwidth >= cols)))
+  {
+    printf("ERROR: matrix bandwidth must be a positive integer, less "
+           "than number of columns \n");
+    return (-1);
+  }
+
+  print_timing = atoi(argv[4]);
+  SetTiming(print_timing);
+
+  if (band)
+  {
+    printf("\nMixed-precision band linear solver test: size %ld, bandwidth "
+           "%ld\n\n",
+           (long int)cols, (long int)bwidth);
+  }
+  else
+  {
+    printf("\nMixed-precision dense linear solver test: size %ld\n\n",
+           (long int)cols);
+  }
+
+  /* Create matrix and vectors */
+  if (band) { A = SUNBandMatrix(cols, bwidth, bwidth, sunctx); }
+  else { A = SUNDenseMatrix(cols, cols, sunctx); }
+  x = N_VNew_Serial(cols, sunctx);
+  b = N_VNew_Serial(cols, sunctx);
+
+  /* Fill matrix and x vector with uniform random data in [0,1], the values
+     are not representable in single precision so the solve must recover
+     the remaining digits through refinement */
+  xdata = N_VGetArrayPointer(x);
+  for (j = 0; j < cols; j++)
+  {
+    if (band)
+    {
+      colj   = SUNBandMatrix_Column(A, j);
+      kstart = (j < bwidth) ? -j : -bwidth;
+      kend   = (j > cols - 1 - bwidth) ? cols - 1 - j : bwidth;
+    }
+    else
+    {
+      colj   = SUNDenseMatrix_Column(A, j);
+      kstart = 0;
+      kend   = cols - 1;
+    }
+    for (k = kstart; k <= kend; k++)
+    {
+      colj[k] = (sunrealtype)rand() / (sunrealtype)RAND_MAX;
+    }
+
+    xdata[j] = (sunrealtype)rand() / (sunrealtype)RAND_MAX;
+  }
+
+  /* Scale/shift matrix to ensure diagonal dominance */
+  if (band) { fails += SUNMatScaleAddI(ONE / (2 * bwidth + 1), A); }
+  else { fails += SUNMatScaleAddI(ONE / cols, A); }
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol SUNMatScaleAddI failure\n");
+
+    /* Free matrix and vectors */
+    SUNMatDestroy(A);
+    N_VDestroy(x);
+    N_VDestroy(b);
+
+    return (1);
+  }
+
+  /* create right-hand side vector for linear solve */
+  fails = SUNMatMatvec(A, x, b);
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol SUNMatMatvec failure\n");
+
+    /* Free matrix and vectors */
+    SUNMatDestroy(A);
+    N_VDestroy(x);
+    N_VDestroy(b);
+
+    return (1);
+  }
+
+  /* Create mixed-precision linear solver */
+  LS = SUNLinSol_MixedPrec(x, A, sunctx);
+  if (LS == NULL)
+  {
+    printf("FAIL: SUNLinSol_MixedPrec returned NULL\n");
+
+    /* Free matrix and vectors */
+    SUNMatDestroy(A);
+    N_VDestroy(x);
+    N_VDestroy(b);
+
+    return (1);
+  }
+
+  /* Run Tests */
+  fails += Test_SUNLinSolInitialize(LS, 0);
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolve(LS, A, x, b, 100 * SUN_UNIT_ROUNDOFF, SUNTRUE, 0);
+  fails += Test_SUNLinSolNumIters(LS, 0);
+  fails += Test_SUNLinSolSolveMultiple(LS, A, x, b, 100 * SUN_UNIT_ROUNDOFF, 0);
+
+  fails += Test_SUNLinSolGetType(LS, SUNLINEARSOLVER_DIRECT, 0);
+  fails += Test_SUNLinSolGetID(LS, SUNLINEARSOLVER_MIXEDPREC, 0);
+  fails += Test_SUNLinSolLastFlag(LS, 0);
+
+  /* Print result */
+  if (fails) { printf("FAIL: SUNLinSol module failed %i tests \n \n", fails); }
+  else { printf("SUCCESS: SUNLinSol module passed all tests \n \n"); }
+
+  /* Free solver, matrix and vectors */
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(x);
+  N_VDestroy(b);
+  SUNContext_Free(&sunctx);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Implementation-specific 'check' routines
+ * --------------------------------------------------------------------*/
+int check_vector(N_Vector X, N_Vector Y, sunrealtype tol)
+{
+  int failure = 0;
+  sunindextype i, local_length;
+  sunrealtype *Xdata, *Ydata, maxerr;
+
+  Xdata        = N_VGetArrayPointer(X);
+  Ydata        = N_VGetArrayPointer(Y);
+  local_length = N_VGetLength_Serial(X);
+
+  /* check vector data */
+  for (i = 0; i < local_length; i++)
+  {
+    failure += SUNRCompareTol(Xdata[i], Ydata[i], tol);
+  }
+
+  if (failure > ZERO)
+  {
+    maxerr = ZERO;
+    for (i = 0; i < local_length; i++)
+    {
+      maxerr = SUNMAX(SUNRabs(Xdata[i] - Ydata[i]), maxerr);
+    }
+    printf("check err failure: maxerr = %" GSYM " (tol = %" GSYM ")\n", maxerr,
+           tol);
+    return (1);
+  }
+  else { return (0); }
+}
+
+void sync_device(void) {}
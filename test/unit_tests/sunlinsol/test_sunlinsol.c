@@ -515,6 +515,110 @@ int Test_SUNLinSolSolve(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
   return (0);
 }
 
+/* ----------------------------------------------------------------------
+ * SUNLinSolSolveMultiple Test
+ *
+ * Solves nrhs systems A Y_j = B_j with B_j = (j+1) b, first into separate
+ * solution vectors and then in place, and compares the results to the
+ * solutions X_j computed one at a time with SUNLinSolSolve. Note that the
+ * solver must already be set up with A.
+ * --------------------------------------------------------------------*/
+int Test_SUNLinSolSolveMultiple(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                                N_Vector b, sunrealtype tol, int myid)
+{
+  int failure, j;
+  const int nrhs = 10;
+  double start_time, stop_time;
+  N_Vector *X, *Y, *B;
+
+  /* create the right-hand sides and solution vectors */
+  X = N_VCloneVectorArray(nrhs, x);
+  Y = N_VCloneVectorArray(nrhs, x);
+  B = N_VCloneVectorArray(nrhs, b);
+  for (j = 0; j < nrhs; j++)
+  {
+    N_VScale((sunrealtype)(j + 1), b, B[j]);
+    N_VConst(ZERO, X[j]);
+    N_VConst(ZERO, Y[j]);
+  }
+
+  sync_device();
+
+  /* compute the reference solutions one at a time */
+  for (j = 0; j < nrhs; j++)
+  {
+    failure = SUNLinSolSolve(S, A, X[j], B[j], tol);
+    if (failure)
+    {
+      printf(">>> FAILED test -- SUNLinSolSolve returned %d on Proc %d \n",
+             failure, myid);
+      N_VDestroyVectorArray(X, nrhs);
+      N_VDestroyVectorArray(Y, nrhs);
+      N_VDestroyVectorArray(B, nrhs);
+      return (1);
+    }
+  }
+  sync_device();
+
+  /* perform solve into separate solution vectors */
+  start_time = get_time();
+  failure    = SUNLinSolSolveMultiple(S, A, nrhs, Y, B, tol);
+  sync_device();
+  stop_time = get_time();
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNLinSolSolveMultiple returned %d on Proc %d \n",
+           failure, myid);
+    N_VDestroyVectorArray(X, nrhs);
+    N_VDestroyVectorArray(Y, nrhs);
+    N_VDestroyVectorArray(B, nrhs);
+    return (1);
+  }
+
+  /* perform solve in place */
+  failure = SUNLinSolSolveMultiple(S, A, nrhs, B, B, tol);
+  sync_device();
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNLinSolSolveMultiple (in place) returned %d "
+           "on Proc %d \n",
+           failure, myid);
+    N_VDestroyVectorArray(X, nrhs);
+    N_VDestroyVectorArray(Y, nrhs);
+    N_VDestroyVectorArray(B, nrhs);
+    return (1);
+  }
+
+  /* Check solutions */
+  for (j = 0; j < nrhs; j++)
+  {
+    failure += check_vector(X[j], Y[j], 10.0 * tol);
+    failure += check_vector(X[j], B[j], 10.0 * tol);
+  }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNLinSolSolveMultiple check, Proc %d \n", myid);
+    PRINT_TIME("    SUNLinSolSolveMultiple Time: %22.15e \n \n",
+               stop_time - start_time);
+    N_VDestroyVectorArray(X, nrhs);
+    N_VDestroyVectorArray(Y, nrhs);
+    N_VDestroyVectorArray(B, nrhs);
+    return (1);
+  }
+  else if (myid == 0)
+  {
+    printf("    PASSED test -- SUNLinSolSolveMultiple \n");
+    PRINT_TIME("    SUNLinSolSolveMultiple Time: %22.15e \n \n",
+               stop_time - start_time);
+  }
+
+  N_VDestroyVectorArray(X, nrhs);
+  N_VDestroyVectorArray(Y, nrhs);
+  N_VDestroyVectorArray(B, nrhs);
+  return (0);
+}
+
 /* ======================================================================
  * Private functions
  * ====================================================================*/
@@ -0,0 +1,263 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the SUNMatrix BlockTridiag
+ * module implementation.
+ * -----------------------------------------------------------------
+ */
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunmatrix/sunmatrix_blocktridiag.h>
+
+#include "test_sunmatrix.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+/* first and last columns of the block-tridiagonal pattern in row i */
+#define JSTART(i, bs)  (SUNMAX(0, ((i) / (bs) - 1) * (bs)))
+#define JEND(i, bs, N) (SUNMIN((N) - 1, ((i) / (bs) + 2) * (bs) - 1))
+
+/* ----------------------------------------------------------------------
+ * Main SUNMatrix Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;               /* counter for test failures */
+  sunindextype nblocks, bs, N; /* matrix dimensions         */
+  SUNMatrix A, AT, I;          /* test matrices             */
+  N_Vector x, y;               /* test vectors              */
+  int print_timing;
+  sunindextype i, j;
+  sunrealtype *xdata, *ydata;
+  SUNContext sunctx;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed\n");
+    return (-1);
+  }
+
+  /* check input and set matrix dimensions */
+  if (argc < 4)
+  {
+    printf("ERROR: THREE (3) Inputs required: number of blocks, block size, "
+           "print timing \n");
+    return (-1);
+  }
+
+  nblocks = (sunindextype)atol(argv[1]);
+  if (nblocks <= 0)
+  {
+    printf("ERROR: number of blocks must be a positive integer \n");
+    return (-1);
+  }
+
+  bs = (sunindextype)atol(argv[2]);
+  if (bs <= 0)
+  {
+    printf("ERROR: block size must be a positive integer \n");
+    return (-1);
+  }
+
+  print_timing = atoi(argv[3]);
+  SetTiming(print_timing);
+
+  N = nblocks * bs;
+
+  printf("\nBlock-tridiagonal matrix test: %ld blocks of size %ld\n\n",
+         (long int)nblocks, (long int)bs);
+
+  /* Create matrices and vectors */
+  A  = SUNBlockTridiagMatrix(nblocks, bs, sunctx);
+  AT = SUNBlockTridiagMatrix(nblocks, bs, sunctx);
+  I  = SUNBlockTridiagMatrix(nblocks, bs, sunctx);
+  x  = N_VNew_Serial(N, sunctx);
+  y  = N_VNew_Serial(N, sunctx);
+
+  /* Fill matrices */
+  for (i = 0; i < N; i++)
+  {
+    /* identity matrix */
+    SM_ELEMENT_BT(I, i, i) = SUN_RCONST(1.0);
+
+    /* A matrix, A(i,j) = j + (j-i), and its transpose */
+    for (j = JSTART(i, bs); j <= JEND(i, bs, N); j++)
+    {
+      SM_ELEMENT_BT(A, i, j)  = j + (j - i);
+      SM_ELEMENT_BT(AT, j, i) = j + (j - i);
+    }
+  }
+
+  /* Fill vectors */
+  xdata = N_VGetArrayPointer(x);
+  ydata = N_VGetArrayPointer(y);
+  for (i = 0; i < N; i++)
+  {
+    /* x vector */
+    xdata[i] = i;
+
+    /* y vector */
+    ydata[i] = SUN_RCONST(0.0);
+    for (j = JSTART(i, bs); j <= JEND(i, bs, N); j++)
+    {
+      ydata[i] += (j + j - i) * (j);
+    }
+  }
+
+  /* Run Tests */
+  fails += Test_SUNMatGetID(A, SUNMATRIX_BLOCKTRIDIAG, 0);
+  fails += Test_SUNMatClone(A, 0);
+  fails += Test_SUNMatCopy(A, 0);
+  fails += Test_SUNMatZero(A, 0);
+  fails += Test_SUNMatScaleAdd(A, I, 0);
+  fails += Test_SUNMatScaleAddI(A, I, 0);
+  fails += Test_SUNMatMatvec(A, x, y, 0);
+  fails += Test_SUNMatHermitianTransposeVec(A, AT, x, y, 0);
+
+  /* Print result */
+  if (fails)
+  {
+    printf("FAIL: SUNMatrix module failed %i tests \n \n", fails);
+    printf("\nA =\n");
+    SUNBlockTridiagMatrix_Print(A, stdout);
+    printf("\nA^T =\n");
+    SUNBlockTridiagMatrix_Print(AT, stdout);
+    printf("\nI =\n");
+    SUNBlockTridiagMatrix_Print(I, stdout);
+    printf("\nx =\n");
+    N_VPrint_Serial(x);
+    printf("\ny =\n");
+    N_VPrint_Serial(y);
+  }
+  else { printf("SUCCESS: SUNMatrix module passed all tests \n \n"); }
+
+  /* Free matrices and vectors */
+  SUNMatDestroy(A);
+  SUNMatDestroy(AT);
+  SUNMatDestroy(I);
+  N_VDestroy(x);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Implementation-specific 'check' routines
+ * --------------------------------------------------------------------*/
+int check_matrix(SUNMatrix A, SUNMatrix B, sunrealtype tol)
+{
+  int failure = 0;
+  sunindextype i, j, N, bs;
+
+  /* check matrix type and dimensions */
+  if (SUNMatGetID(A) != SUNMatGetID(B)) { return 1; }
+  if (SUNBlockTridiagMatrix_NumBlocks(A) != SUNBlockTridiagMatrix_NumBlocks(B))
+  {
+    return 1;
+  }
+  if (SUNBlockTridiagMatrix_BlockSize(A) != SUNBlockTridiagMatrix_BlockSize(B))
+  {
+    return 1;
+  }
+
+  /* check matrix data */
+  N  = SUNBlockTridiagMatrix_Rows(A);
+  bs = SUNBlockTridiagMatrix_BlockSize(A);
+  for (i = 0; i < N; i++)
+  {
+    for (j = JSTART(i, bs); j <= JEND(i, bs, N); j++)
+    {
+      failure += SUNRCompareTol(SM_ELEMENT_BT(A, i, j), SM_ELEMENT_BT(B, i, j),
+                                tol);
+    }
+  }
+
+  if (failure > ZERO)
+  {
+    printf("check_matrix failure, A = \n");
+    SUNBlockTridiagMatrix_Print(A, stdout);
+    printf("B = \n");
+    SUNBlockTridiagMatrix_Print(B, stdout);
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+int check_matrix_entry(SUNMatrix A, sunrealtype val, sunrealtype tol)
+{
+  int failure = 0;
+  sunindextype i, j, N, bs;
+
+  /* check matrix data */
+  N  = SUNBlockTridiagMatrix_Rows(A);
+  bs = SUNBlockTridiagMatrix_BlockSize(A);
+  for (i = 0; i < N; i++)
+  {
+    for (j = JSTART(i, bs); j <= JEND(i, bs, N); j++)
+    {
+      if (SUNRCompareTol(SM_ELEMENT_BT(A, i, j), val, tol))
+      {
+        failure++;
+        printf("A(%li,%li) = %" GSYM ", val = %" GSYM "\n", (long int)i,
+               (long int)j, SM_ELEMENT_BT(A, i, j), val);
+      }
+    }
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+int check_vector(N_Vector X, N_Vector Y, sunrealtype tol)
+{
+  int failure = 0;
+  sunindextype i, local_length;
+  sunrealtype *Xdata, *Ydata;
+
+  Xdata        = N_VGetArrayPointer(X);
+  Ydata        = N_VGetArrayPointer(Y);
+  local_length = N_VGetLength_Serial(X);
+
+  /* check vector data */
+  for (i = 0; i < local_length; i++)
+  {
+    failure += SUNRCompareTol(Xdata[i], Ydata[i], tol);
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+sunbooleantype has_data(SUNMatrix A)
+{
+  sunrealtype* Adata = SUNBlockTridiagMatrix_Data(A);
+  if (Adata == NULL) { return SUNFALSE; }
+  else { return SUNTRUE; }
+}
+
+sunbooleantype is_square(SUNMatrix A) { return SUNTRUE; }
+
+void sync_device(SUNMatrix A)
+{
+  /* not running on GPU, just return */
+  return;
+}
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# SUNDIALS Copyright Start
+# Copyright (c) 2002-2025, Lawrence Livermore National Security
+# and Southern Methodist University.
+# All rights reserved.
+#
+# See the top-level LICENSE and NOTICE files for details.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# SUNDIALS Copyright End
+# -----------------------------------------------------------------------------
+# Example script that converts a binary log file to the text log format
+# -----------------------------------------------------------------------------
+
+def main():
+
+    import argparse
+
+    from suntools import logs as sunlog
+
+    parser = argparse.ArgumentParser(description='Decode a binary log file')
+
+    parser.add_argument('logfile', type=str,
+                        help='Binary log file to decode')
+
+    parser.add_argument('--output', type=str, default=None,
+                        help='Text log file to write (default stdout)')
+
+    # parse command line args
+    args = parser.parse_args()
+
+    # decode log and write the text lines
+    lines = sunlog.decode_binary_log(args.logfile)
+    if args.output:
+        with open(args.output, 'w') as outfile:
+            outfile.write('\n'.join(lines) + '\n')
+    else:
+        print('\n'.join(lines))
+
+
+# run the main routine
+if __name__ == '__main__':
+    import sys
+    sys.exit(main())
@@ -17,6 +17,7 @@
 # -----------------------------------------------------------------------------
 
 import re
+import struct
 import numpy as np
 from collections import ChainMap
 
@@ -32,6 +33,127 @@ def convert_to_num(s):
             return s
 
 
+# Magic bytes at the start of a binary log file written by SUNLogger
+BINARY_LOG_MAGIC = b"SUNLOGB\0"
+
+# Binary log record kinds
+BINARY_LOG_STRING = 1
+BINARY_LOG_MESSAGE = 2
+
+# Log level names indexed by SUNLogLevel value
+BINARY_LOG_LEVELS = {1: "ERROR", 2: "WARNING", 3: "INFO", 4: "DEBUG"}
+
+
+def is_binary_log(filename):
+    """Check if a file is a binary log produced by SUNLogger"""
+    with open(filename, "rb") as logfile:
+        return logfile.read(len(BINARY_LOG_MAGIC)) == BINARY_LOG_MAGIC
+
+
+def format_binary_payload(fmt, payload, endian="<"):
+    """
+    Apply a printf style format string to the arguments stored in the payload
+    of a binary log message. Integers and pointers are stored as 8 byte
+    integers, floating point values as 8 byte doubles, and strings as a 4 byte
+    length followed by the characters.
+    """
+    conversion = re.compile(
+        r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(?:hh|h|ll|l|j|z|t|L)?([diouxXcsfFeEgGaApn%])"
+    )
+    offset = 0
+
+    def unpack(code):
+        nonlocal offset
+        value = struct.unpack_from(endian + code, payload, offset)[0]
+        offset += struct.calcsize(code)
+        return value
+
+    text = []
+    position = 0
+    for match in conversion.finditer(fmt):
+        text.append(fmt[position : match.start()])
+        position = match.end()
+        flags, width, precision, conv = match.groups()
+        if conv == "%":
+            text.append("%")
+            continue
+        if width == "*":
+            width = str(unpack("q"))
+        if precision == "*":
+            precision = str(unpack("q"))
+        spec = "%" + flags + (width or "")
+        if precision is not None:
+            spec += "." + precision
+        if conv in "di":
+            text.append((spec + "d") % unpack("q"))
+        elif conv == "u":
+            text.append((spec + "d") % unpack("Q"))
+        elif conv in "oxX":
+            text.append((spec + conv) % unpack("Q"))
+        elif conv == "c":
+            text.append((spec + "c") % chr(unpack("q")))
+        elif conv in "fFeEgG":
+            text.append((spec + conv) % unpack("d"))
+        elif conv in "aA":
+            value = float.hex(unpack("d"))
+            text.append(value.upper() if conv == "A" else value)
+        elif conv == "s":
+            length = unpack("I")
+            value = payload[offset : offset + length].decode(errors="replace")
+            offset += length
+            text.append((spec + "s") % value)
+        elif conv == "p":
+            value = unpack("Q")
+            text.append(hex(value) if value else "(nil)")
+    text.append(fmt[position:])
+
+    return "".join(text)
+
+
+def decode_binary_log(filename):
+    """
+    Decode a binary log file produced by SUNLogger into a list of lines in the
+    text log format i.e., [loglvl][rank][scope][label] payload
+    """
+    with open(filename, "rb") as logfile:
+        data = logfile.read()
+
+    if data[: len(BINARY_LOG_MAGIC)] != BINARY_LOG_MAGIC:
+        raise ValueError(f"{filename} is not a SUNDIALS binary log file")
+
+    # The file is written in the byte order of the machine that produced it
+    endian = "<" if struct.unpack_from("<I", data, 8)[0] == 1 else ">"
+    rank = struct.unpack_from(endian + "i", data, 12)[0]
+
+    message = struct.Struct(endian + "BQIIII")
+    strings = {}
+    lines = []
+    offset = 16
+    while offset < len(data):
+        kind = data[offset]
+        offset += 1
+        if kind == BINARY_LOG_STRING:
+            string_id, length = struct.unpack_from(endian + "II", data, offset)
+            offset += 8
+            strings[string_id] = data[offset : offset + length].decode(errors="replace")
+            offset += length
+        elif kind == BINARY_LOG_MESSAGE:
+            level, _, scope, label, fmt, length = message.unpack_from(data, offset)
+            offset += message.size
+            text = format_binary_payload(
+                strings[fmt], data[offset : offset + length], endian
+            )
+            offset += length
+            lines.extend(
+                f"[{BINARY_LOG_LEVELS[level]}][rank {rank}][{strings[scope]}]"
+                f"[{strings[label]}] {text}".split("\n")
+            )
+        else:
+            raise ValueError(f"{filename} has an invalid record at byte {offset - 1}")
+
+    return lines
+
+
 def parse_logfile_payload(payload, line_number, all_lines, array_indicator="(:)"):
     """
     Parse the payload of a SUNDIALS log file line into a dictionary. The payload
@@ -169,8 +291,11 @@ def log_file_to_list(filename):
         # Partition for split integrators e.g., operator splitting methods
         partition = 0
 
-        # Read the log file
-        all_lines = logfile.readlines()
+        # Read the log file, binary logs are decoded into text lines
+        if is_binary_log(filename):
+            all_lines = decode_binary_log(filename)
+        else:
+            all_lines = logfile.readlines()
 
         # Create instance of helper class for building attempt dictionary
         s = StepData()